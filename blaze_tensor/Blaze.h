@@ -45,6 +45,7 @@
 
 #include <blaze_tensor/system/Version.h>
 #include <blaze_tensor/Math.h>
+#include <blaze_tensor/util/ArenaAllocator.h>
 
 
 
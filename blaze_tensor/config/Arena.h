@@ -0,0 +1,68 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/config/Arena.h
+//  \brief Configuration of the arena allocation of temporaries
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//  Copyright (C) 2019 Bita Hasheminezhad - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the arena allocation of temporaries.
+// \ingroup config
+//
+// This compilation switch enables/disables the allocation of library-internal temporaries from
+// the thread-local arena (see ArenaAllocator and TemporaryTrait). If the switch is enabled, the
+// temporaries created during the evaluation of tensor and array expressions use an
+// ArenaAllocator, which draws the memory from the arena of the calling thread in case an
+// ArenaScope is open and from the aligned system allocator otherwise. If the switch is disabled,
+// all temporaries use the default allocator and ArenaScopes only affect tensors and arrays that
+// explicitly use an ArenaAllocator.
+//
+// Possible settings for the switch:
+//  - Disabled: \b 0 (default)
+//  - Enabled : \b 1
+//
+// \warning Changing the setting of this compilation switch requires a recompilation of all code
+// using the Blaze library!
+//
+// \note It is possible to (de-)activate the arena allocation of temporaries via command line or
+// by defining this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_ARENA_TEMPORARIES 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_ARENA_TEMPORARIES
+#define BLAZE_USE_ARENA_TEMPORARIES 0
+#endif
+//*************************************************************************************************
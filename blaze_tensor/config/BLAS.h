@@ -124,3 +124,36 @@
 #define BLAZE_USE_BLAS_TENSOR_TENSOR_MULTIPLICATION 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the batched BLAS tensor/tensor multiplication kernels.
+// \ingroup config
+//
+// This compilation switch enables/disables the use of strided batched BLAS kernels (i.e.
+// \c cblas_?gemm_batch_strided() as provided for instance by the Intel MKL) for the
+// multiplication of dense tensors. If the switch is enabled, all pages of a tensor/tensor
+// multiplication are computed by a single BLAS call, if it is disabled \c gemm() is called
+// separately for each page. This switch only has an effect in case both the BLAS mode and
+// the BLAS tensor/tensor multiplication kernels are enabled.
+//
+// Possible settings for the switch:
+//  - Disabled: \b 0 (default)
+//  - Enabled : \b 1
+//
+// \warning Changing the setting of this compilation switch requires a recompilation of all code
+// using the Blaze library!
+//
+// \note It is possible to (de-)activate the use of the batched BLAS tensor/tensor multiplication
+// kernels via command line or by defining this symbol manually before including any Blaze header
+// file:
+
+   \code
+   #define BLAZE_USE_BLAS_BATCHED_TENSOR_TENSOR_MULTIPLICATION 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_BLAS_BATCHED_TENSOR_TENSOR_MULTIPLICATION
+#define BLAZE_USE_BLAS_BATCHED_TENSOR_TENSOR_MULTIPLICATION 0
+#endif
+//*************************************************************************************************
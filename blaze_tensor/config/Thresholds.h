@@ -109,6 +109,110 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP dense array assignment threshold.
+// \ingroup config
+//
+// This threshold specifies when an assignment with a simple dense array can be executed in
+// parallel. In case the number of elements of the target array is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 48400 (which corresponds to an array size of
+// \f$ 220 \times 220 \f$). In case the threshold is set to 0, the operation is unconditionally
+// executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DARRASSIGN_THRESHOLD 48400UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DARRASSIGN_THRESHOLD
+#define BLAZE_SMP_DARRASSIGN_THRESHOLD 48400UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense tensor reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when the total reduction of a dense tensor (as for instance by means
+// of the sum(), prod(), min() or max() functions) can be executed in parallel. In case the number
+// of elements of the tensor is larger or equal to this threshold, the operation is executed in
+// parallel. If the number of elements is below this threshold the operation is executed
+// single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 160000 (which corresponds to a tensor size of
+// \f$ 4 \times 200 \times 200 \f$). In case the threshold is set to 0, the operation is
+// unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DTENSREDUCE_THRESHOLD 160000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DTENSREDUCE_THRESHOLD
+#define BLAZE_SMP_DTENSREDUCE_THRESHOLD 160000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense array reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when the total reduction of a dense array (as for instance by means
+// of the sum(), prod(), min(), max() or norm() functions) can be executed in parallel. In case
+// the number of elements of the array is larger or equal to this threshold, the operation is
+// executed in parallel. If the number of elements is below this threshold the operation is
+// executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 160000 (which corresponds to an array size of
+// \f$ 4 \times 200 \times 200 \f$). In case the threshold is set to 0, the operation is
+// unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DARRREDUCE_THRESHOLD 160000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DARRREDUCE_THRESHOLD
+#define BLAZE_SMP_DARRREDUCE_THRESHOLD 160000UL
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief SMP row-major dense matrix/dense vector multiplication threshold.
 // \ingroup config
@@ -117,7 +117,9 @@
 #include <blaze/math/views/Subvector.h>
 
 #include <blaze_tensor/math/Array.h>
+#include <blaze_tensor/math/dense/ArgReduce.h>
 #include <blaze_tensor/math/dense/DenseArray.h>
+#include <blaze_tensor/math/dense/Welford.h>
 // #include <blaze_tensor/math/expressions/DTensDTensAddExpr.h>
 #include <blaze_tensor/math/expressions/DArrDArrEqualExpr.h>
 #include <blaze_tensor/math/expressions/DArrDArrMapExpr.h>
@@ -122,15 +122,20 @@
 #include <blaze/math/views/Subvector.h>
 
 #include <blaze_tensor/math/Tensor.h>
+#include <blaze_tensor/math/dense/ArgReduce.h>
 #include <blaze_tensor/math/dense/DenseTensor.h>
+#include <blaze_tensor/math/dense/Normalization.h>
+#include <blaze_tensor/math/dense/Welford.h>
 #include <blaze_tensor/math/expressions/DMatExpandExpr.h>
 #include <blaze_tensor/math/expressions/DMatRavelExpr.h>
+#include <blaze_tensor/math/expressions/DTensDMatMapExpr.h>
 #include <blaze_tensor/math/expressions/DTensDMatSchurExpr.h>
 #include <blaze_tensor/math/expressions/DTensDTensAddExpr.h>
 #include <blaze_tensor/math/expressions/DTensDTensEqualExpr.h>
 #include <blaze_tensor/math/expressions/DTensDTensMultExpr.h>
 #include <blaze_tensor/math/expressions/DTensDTensSchurExpr.h>
 #include <blaze_tensor/math/expressions/DTensDTensSubExpr.h>
+#include <blaze_tensor/math/expressions/DTensDVecMapExpr.h>
 #include <blaze_tensor/math/expressions/DTensDVecMultExpr.h>
 #include <blaze_tensor/math/expressions/DTensMapExpr.h>
 #include <blaze_tensor/math/expressions/DTensRavelExpr.h>
@@ -73,28 +73,30 @@ namespace blaze {
 //
 // This specialization of the Rand class creates random instances of DynamicArray.
 */
-template< size_t N, typename Type > // Data type of the array
-class Rand< DynamicArray<N, Type> >
+template< size_t N         // The dimensionality of the array
+        , typename Type    // Data type of the array
+        , typename Alloc > // Type of the allocator
+class Rand< DynamicArray<N, Type, Alloc> >
 {
  public:
    //**Generate functions**************************************************************************
    /*!\name Generate functions */
    //@{
    template< typename... Dims>
-   inline const DynamicArray<N, Type> generate( Dims... dims ) const;
+   inline const DynamicArray<N, Type, Alloc> generate( Dims... dims ) const;
 
    template< typename Arg, typename... Dims, size_t DummyN = N, typename = EnableIf_t< sizeof...(Dims) == DummyN > >
-   inline const DynamicArray<N, Type> generate( const Arg& min, const Arg& max, Dims... dims ) const;
+   inline const DynamicArray<N, Type, Alloc> generate( const Arg& min, const Arg& max, Dims... dims ) const;
    //@}
    //**********************************************************************************************
 
    //**Randomize functions*************************************************************************
    /*!\name Randomize functions */
    //@{
-   inline void randomize( DynamicArray<N, Type>& array ) const;
+   inline void randomize( DynamicArray<N, Type, Alloc>& array ) const;
 
    template< typename Arg >
-   inline void randomize( DynamicArray<N, Type>& array, const Arg& min, const Arg& max ) const;
+   inline void randomize( DynamicArray<N, Type, Alloc>& array, const Arg& min, const Arg& max ) const;
    //@}
    //**********************************************************************************************
 };
@@ -111,12 +113,13 @@ class Rand< DynamicArray<N, Type> >
 // \return The generated random array.
 */
 template< size_t N         // The dimensionality of the array
-        , typename Type>   // Data type of the array
+        , typename Type    // Data type of the array
+        , typename Alloc > // Type of the allocator
 template< typename... Dims >
-inline const DynamicArray<N, Type>
-   Rand< DynamicArray<N, Type> >::generate( Dims... dims ) const
+inline const DynamicArray<N, Type, Alloc>
+   Rand< DynamicArray<N, Type, Alloc> >::generate( Dims... dims ) const
 {
-   DynamicArray<N, Type> array( dims... );
+   DynamicArray<N, Type, Alloc> array( dims... );
    randomize( array );
    return array;
 }
@@ -135,15 +138,16 @@ inline const DynamicArray<N, Type>
 // \return The generated random array.
 */
 template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+        , typename Type    // Data type of the array
+        , typename Alloc > // Type of the allocator
 template< typename Arg     // Min/max argument type
         , typename... Dims
         , size_t DummyN     // Dummy variable equal to N
         , typename Enable >
-inline const DynamicArray<N, Type>
-   Rand< DynamicArray<N, Type> >::generate( const Arg& min, const Arg& max, Dims... dims ) const
+inline const DynamicArray<N, Type, Alloc>
+   Rand< DynamicArray<N, Type, Alloc> >::generate( const Arg& min, const Arg& max, Dims... dims ) const
 {
-   DynamicArray<N, Type> array( dims... );
+   DynamicArray<N, Type, Alloc> array( dims... );
    randomize( array, min, max );
    return array;
 }
@@ -159,8 +163,9 @@ inline const DynamicArray<N, Type>
 // \return void
 */
 template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline void Rand< DynamicArray<N, Type> >::randomize( DynamicArray<N, Type>& array ) const
+        , typename Type    // Data type of the array
+        , typename Alloc > // Type of the allocator
+inline void Rand< DynamicArray<N, Type, Alloc> >::randomize( DynamicArray<N, Type, Alloc>& array ) const
 {
    using blaze::randomize;
 
@@ -183,10 +188,11 @@ inline void Rand< DynamicArray<N, Type> >::randomize( DynamicArray<N, Type>& arr
 // \return void
 */
 template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+        , typename Type    // Data type of the array
+        , typename Alloc > // Type of the allocator
 template< typename Arg >    // Min/max argument type
-inline void Rand< DynamicArray< N, Type > >::randomize(
-   DynamicArray< N, Type >& array, const Arg& min, const Arg& max ) const
+inline void Rand< DynamicArray< N, Type, Alloc > >::randomize(
+   DynamicArray< N, Type, Alloc >& array, const Arg& min, const Arg& max ) const
 {
    using blaze::randomize;
 
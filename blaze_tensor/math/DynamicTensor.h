@@ -61,27 +61,28 @@ namespace blaze {
 //
 // This specialization of the Rand class creates random instances of DynamicTensor.
 */
-template< typename Type > // Data type of the tensor
-class Rand< DynamicTensor<Type> >
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+class Rand< DynamicTensor<Type,Alloc> >
 {
  public:
    //**Generate functions**************************************************************************
    /*!\name Generate functions */
    //@{
-   inline const DynamicTensor<Type> generate( size_t o, size_t m, size_t n ) const;
+   inline const DynamicTensor<Type,Alloc> generate( size_t o, size_t m, size_t n ) const;
 
    template< typename Arg >
-   inline const DynamicTensor<Type> generate( size_t o, size_t m, size_t n, const Arg& min, const Arg& max ) const;
+   inline const DynamicTensor<Type,Alloc> generate( size_t o, size_t m, size_t n, const Arg& min, const Arg& max ) const;
    //@}
    //**********************************************************************************************
 
    //**Randomize functions*************************************************************************
    /*!\name Randomize functions */
    //@{
-   inline void randomize( DynamicTensor<Type>& tensor ) const;
+   inline void randomize( DynamicTensor<Type,Alloc>& tensor ) const;
 
    template< typename Arg >
-   inline void randomize( DynamicTensor<Type>& tensor, const Arg& min, const Arg& max ) const;
+   inline void randomize( DynamicTensor<Type,Alloc>& tensor, const Arg& min, const Arg& max ) const;
    //@}
    //**********************************************************************************************
 };
@@ -97,11 +98,12 @@ class Rand< DynamicTensor<Type> >
 // \param n The number of columns of the random tensor.
 // \return The generated random tensor.
 */
-template< typename Type > // Data type of the tensor
-inline const DynamicTensor<Type>
-   Rand< DynamicTensor<Type> >::generate( size_t o, size_t m, size_t n ) const
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline const DynamicTensor<Type,Alloc>
+   Rand< DynamicTensor<Type,Alloc> >::generate( size_t o, size_t m, size_t n ) const
 {
-   DynamicTensor<Type> tensor( o, m, n );
+   DynamicTensor<Type,Alloc> tensor( o, m, n );
    randomize( tensor );
    return tensor;
 }
@@ -119,12 +121,13 @@ inline const DynamicTensor<Type>
 // \param max The largest possible value for a tensor element.
 // \return The generated random tensor.
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename Arg >  // Min/max argument type
-inline const DynamicTensor<Type>
-   Rand< DynamicTensor<Type> >::generate( size_t o, size_t m, size_t n, const Arg& min, const Arg& max ) const
+inline const DynamicTensor<Type,Alloc>
+   Rand< DynamicTensor<Type,Alloc> >::generate( size_t o, size_t m, size_t n, const Arg& min, const Arg& max ) const
 {
-   DynamicTensor<Type> tensor( o, m, n );
+   DynamicTensor<Type,Alloc> tensor( o, m, n );
    randomize( tensor, min, max );
    return tensor;
 }
@@ -139,8 +142,9 @@ inline const DynamicTensor<Type>
 // \param tensor The tensor to be randomized.
 // \return void
 */
-template< typename Type > // Data type of the tensor
-inline void Rand< DynamicTensor<Type> >::randomize( DynamicTensor<Type>& tensor ) const
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline void Rand< DynamicTensor<Type,Alloc> >::randomize( DynamicTensor<Type,Alloc>& tensor ) const
 {
    using blaze::randomize;
 
@@ -169,10 +173,11 @@ inline void Rand< DynamicTensor<Type> >::randomize( DynamicTensor<Type>& tensor
 // \param max The largest possible value for a tensor element.
 // \return void
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename Arg >  // Min/max argument type
-inline void Rand< DynamicTensor<Type> >::randomize( DynamicTensor<Type>& tensor,
-                                                       const Arg& min, const Arg& max ) const
+inline void Rand< DynamicTensor<Type,Alloc> >::randomize( DynamicTensor<Type,Alloc>& tensor,
+                                                             const Arg& min, const Arg& max ) const
 {
    using blaze::randomize;
 
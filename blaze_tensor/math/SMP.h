@@ -44,5 +44,6 @@
 #include <blaze/math/SMP.h>
 
 #include <blaze_tensor/math/smp/DenseTensor.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
 
 #endif
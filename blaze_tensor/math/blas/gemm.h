@@ -0,0 +1,342 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/blas/gemm.h
+//  \brief Header file for the BLAS batched general matrix/matrix multiplication functions (gemm)
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+
+#ifndef _BLAZE_TENSOR_MATH_BLAS_GEMM_H_
+#define _BLAZE_TENSOR_MATH_BLAS_GEMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/blas/gemm.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/ConstDataAccess.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/system/BLAS.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/NumericCast.h>
+#include <blaze/util/StaticAssert.h>
+
+#include <blaze_tensor/config/BLAS.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+
+
+namespace blaze {
+
+#if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_BATCHED_TENSOR_TENSOR_MULTIPLICATION
+
+//=================================================================================================
+//
+//  BLAS WRAPPER FUNCTIONS (GEMM_BATCH_STRIDED)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BLAS wrapper functions (gemm_batch_strided) */
+//@{
+BLAZE_ALWAYS_INLINE void gemmBatchStrided( CBLAS_ORDER order, CBLAS_TRANSPOSE transA,
+                                           CBLAS_TRANSPOSE transB, int m, int n, int k,
+                                           float alpha, const float* A, int lda, int strideA,
+                                           const float* B, int ldb, int strideB, float beta,
+                                           float* C, int ldc, int strideC, int batch );
+
+BLAZE_ALWAYS_INLINE void gemmBatchStrided( CBLAS_ORDER order, CBLAS_TRANSPOSE transA,
+                                           CBLAS_TRANSPOSE transB, int m, int n, int k,
+                                           double alpha, const double* A, int lda, int strideA,
+                                           const double* B, int ldb, int strideB, double beta,
+                                           double* C, int ldc, int strideC, int batch );
+
+BLAZE_ALWAYS_INLINE void gemmBatchStrided( CBLAS_ORDER order, CBLAS_TRANSPOSE transA,
+                                           CBLAS_TRANSPOSE transB, int m, int n, int k,
+                                           complex<float> alpha, const complex<float>* A,
+                                           int lda, int strideA, const complex<float>* B,
+                                           int ldb, int strideB, complex<float> beta,
+                                           complex<float>* C, int ldc, int strideC, int batch );
+
+BLAZE_ALWAYS_INLINE void gemmBatchStrided( CBLAS_ORDER order, CBLAS_TRANSPOSE transA,
+                                           CBLAS_TRANSPOSE transB, int m, int n, int k,
+                                           complex<double> alpha, const complex<double>* A,
+                                           int lda, int strideA, const complex<double>* B,
+                                           int ldb, int strideB, complex<double> beta,
+                                           complex<double>* C, int ldc, int strideC, int batch );
+
+template< typename TT1, typename TT2, typename TT3, typename ST >
+void gemmBatchStrided( DenseTensor<TT1>& C, const DenseTensor<TT2>& A,
+                       const DenseTensor<TT3>& B, ST alpha, ST beta );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief BLAS kernel for a strided batch of dense matrix/dense matrix multiplications with
+//        single precision operands (\f$ C_k=\alpha*A_k*B_k+\beta*C_k \f$).
+// \ingroup blas
+//
+// \param order Specifies the storage order of the matrices (\a CblasRowMajor or \a CblasColMajor).
+// \param transA Specifies whether to transpose the left-hand side matrices (\a CblasNoTrans or \a CblasTrans).
+// \param transB Specifies whether to transpose the right-hand side matrices (\a CblasNoTrans or \a CblasTrans).
+// \param m The number of rows of each matrix \f$ A_k \f$ and \f$ C_k \f$ \f$[0..\infty)\f$.
+// \param n The number of columns of each matrix \f$ B_k \f$ and \f$ C_k \f$ \f$[0..\infty)\f$.
+// \param k The number of columns of each matrix \f$ A_k \f$ and rows of \f$ B_k \f$ \f$[0..\infty)\f$.
+// \param alpha The scaling factor for \f$ A_k*B_k \f$.
+// \param A Pointer to the first element of the first left-hand side matrix.
+// \param lda The total number of elements between two rows/columns of the matrices \f$ A_k \f$.
+// \param strideA The total number of elements between two consecutive matrices \f$ A_k \f$.
+// \param B Pointer to the first element of the first right-hand side matrix.
+// \param ldb The total number of elements between two rows/columns of the matrices \f$ B_k \f$.
+// \param strideB The total number of elements between two consecutive matrices \f$ B_k \f$.
+// \param beta The scaling factor for \f$ C_k \f$.
+// \param C Pointer to the first element of the first target matrix.
+// \param ldc The total number of elements between two rows/columns of the matrices \f$ C_k \f$.
+// \param strideC The total number of elements between two consecutive matrices \f$ C_k \f$.
+// \param batch The number of matrix/matrix multiplications in the batch.
+// \return void
+//
+// This function performs the strided batched dense matrix/dense matrix multiplication for single
+// precision operands based on the cblas_sgemm_batch_strided() function. Note that this function
+// is only available in case the BLAS library provides this extension (as for instance the Intel
+// MKL) and the BLAZE_USE_BLAS_BATCHED_TENSOR_TENSOR_MULTIPLICATION switch is enabled.
+*/
+BLAZE_ALWAYS_INLINE void gemmBatchStrided( CBLAS_ORDER order, CBLAS_TRANSPOSE transA,
+                                           CBLAS_TRANSPOSE transB, int m, int n, int k,
+                                           float alpha, const float* A, int lda, int strideA,
+                                           const float* B, int ldb, int strideB, float beta,
+                                           float* C, int ldc, int strideC, int batch )
+{
+   cblas_sgemm_batch_strided( order, transA, transB, m, n, k, alpha, A, lda, strideA,
+                              B, ldb, strideB, beta, C, ldc, strideC, batch );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief BLAS kernel for a strided batch of dense matrix/dense matrix multiplications with
+//        double precision operands (\f$ C_k=\alpha*A_k*B_k+\beta*C_k \f$).
+// \ingroup blas
+//
+// \param order Specifies the storage order of the matrices (\a CblasRowMajor or \a CblasColMajor).
+// \param transA Specifies whether to transpose the left-hand side matrices (\a CblasNoTrans or \a CblasTrans).
+// \param transB Specifies whether to transpose the right-hand side matrices (\a CblasNoTrans or \a CblasTrans).
+// \param m The number of rows of each matrix \f$ A_k \f$ and \f$ C_k \f$ \f$[0..\infty)\f$.
+// \param n The number of columns of each matrix \f$ B_k \f$ and \f$ C_k \f$ \f$[0..\infty)\f$.
+// \param k The number of columns of each matrix \f$ A_k \f$ and rows of \f$ B_k \f$ \f$[0..\infty)\f$.
+// \param alpha The scaling factor for \f$ A_k*B_k \f$.
+// \param A Pointer to the first element of the first left-hand side matrix.
+// \param lda The total number of elements between two rows/columns of the matrices \f$ A_k \f$.
+// \param strideA The total number of elements between two consecutive matrices \f$ A_k \f$.
+// \param B Pointer to the first element of the first right-hand side matrix.
+// \param ldb The total number of elements between two rows/columns of the matrices \f$ B_k \f$.
+// \param strideB The total number of elements between two consecutive matrices \f$ B_k \f$.
+// \param beta The scaling factor for \f$ C_k \f$.
+// \param C Pointer to the first element of the first target matrix.
+// \param ldc The total number of elements between two rows/columns of the matrices \f$ C_k \f$.
+// \param strideC The total number of elements between two consecutive matrices \f$ C_k \f$.
+// \param batch The number of matrix/matrix multiplications in the batch.
+// \return void
+//
+// This function performs the strided batched dense matrix/dense matrix multiplication for double
+// precision operands based on the cblas_dgemm_batch_strided() function. Note that this function
+// is only available in case the BLAS library provides this extension (as for instance the Intel
+// MKL) and the BLAZE_USE_BLAS_BATCHED_TENSOR_TENSOR_MULTIPLICATION switch is enabled.
+*/
+BLAZE_ALWAYS_INLINE void gemmBatchStrided( CBLAS_ORDER order, CBLAS_TRANSPOSE transA,
+                                           CBLAS_TRANSPOSE transB, int m, int n, int k,
+                                           double alpha, const double* A, int lda, int strideA,
+                                           const double* B, int ldb, int strideB, double beta,
+                                           double* C, int ldc, int strideC, int batch )
+{
+   cblas_dgemm_batch_strided( order, transA, transB, m, n, k, alpha, A, lda, strideA,
+                              B, ldb, strideB, beta, C, ldc, strideC, batch );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief BLAS kernel for a strided batch of dense matrix/dense matrix multiplications with
+//        single precision complex operands (\f$ C_k=\alpha*A_k*B_k+\beta*C_k \f$).
+// \ingroup blas
+//
+// \param order Specifies the storage order of the matrices (\a CblasRowMajor or \a CblasColMajor).
+// \param transA Specifies whether to transpose the left-hand side matrices (\a CblasNoTrans or \a CblasTrans).
+// \param transB Specifies whether to transpose the right-hand side matrices (\a CblasNoTrans or \a CblasTrans).
+// \param m The number of rows of each matrix \f$ A_k \f$ and \f$ C_k \f$ \f$[0..\infty)\f$.
+// \param n The number of columns of each matrix \f$ B_k \f$ and \f$ C_k \f$ \f$[0..\infty)\f$.
+// \param k The number of columns of each matrix \f$ A_k \f$ and rows of \f$ B_k \f$ \f$[0..\infty)\f$.
+// \param alpha The scaling factor for \f$ A_k*B_k \f$.
+// \param A Pointer to the first element of the first left-hand side matrix.
+// \param lda The total number of elements between two rows/columns of the matrices \f$ A_k \f$.
+// \param strideA The total number of elements between two consecutive matrices \f$ A_k \f$.
+// \param B Pointer to the first element of the first right-hand side matrix.
+// \param ldb The total number of elements between two rows/columns of the matrices \f$ B_k \f$.
+// \param strideB The total number of elements between two consecutive matrices \f$ B_k \f$.
+// \param beta The scaling factor for \f$ C_k \f$.
+// \param C Pointer to the first element of the first target matrix.
+// \param ldc The total number of elements between two rows/columns of the matrices \f$ C_k \f$.
+// \param strideC The total number of elements between two consecutive matrices \f$ C_k \f$.
+// \param batch The number of matrix/matrix multiplications in the batch.
+// \return void
+//
+// This function performs the strided batched dense matrix/dense matrix multiplication for single
+// precision complex operands based on the cblas_cgemm_batch_strided() function. Note that this
+// function is only available in case the BLAS library provides this extension (as for instance
+// the Intel MKL) and the BLAZE_USE_BLAS_BATCHED_TENSOR_TENSOR_MULTIPLICATION switch is enabled.
+*/
+BLAZE_ALWAYS_INLINE void gemmBatchStrided( CBLAS_ORDER order, CBLAS_TRANSPOSE transA,
+                                           CBLAS_TRANSPOSE transB, int m, int n, int k,
+                                           complex<float> alpha, const complex<float>* A,
+                                           int lda, int strideA, const complex<float>* B,
+                                           int ldb, int strideB, complex<float> beta,
+                                           complex<float>* C, int ldc, int strideC, int batch )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+
+   cblas_cgemm_batch_strided( order, transA, transB, m, n, k, reinterpret_cast<const float*>( &alpha ),
+                              reinterpret_cast<const float*>( A ), lda, strideA,
+                              reinterpret_cast<const float*>( B ), ldb, strideB,
+                              reinterpret_cast<const float*>( &beta ),
+                              reinterpret_cast<float*>( C ), ldc, strideC, batch );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief BLAS kernel for a strided batch of dense matrix/dense matrix multiplications with
+//        double precision complex operands (\f$ C_k=\alpha*A_k*B_k+\beta*C_k \f$).
+// \ingroup blas
+//
+// \param order Specifies the storage order of the matrices (\a CblasRowMajor or \a CblasColMajor).
+// \param transA Specifies whether to transpose the left-hand side matrices (\a CblasNoTrans or \a CblasTrans).
+// \param transB Specifies whether to transpose the right-hand side matrices (\a CblasNoTrans or \a CblasTrans).
+// \param m The number of rows of each matrix \f$ A_k \f$ and \f$ C_k \f$ \f$[0..\infty)\f$.
+// \param n The number of columns of each matrix \f$ B_k \f$ and \f$ C_k \f$ \f$[0..\infty)\f$.
+// \param k The number of columns of each matrix \f$ A_k \f$ and rows of \f$ B_k \f$ \f$[0..\infty)\f$.
+// \param alpha The scaling factor for \f$ A_k*B_k \f$.
+// \param A Pointer to the first element of the first left-hand side matrix.
+// \param lda The total number of elements between two rows/columns of the matrices \f$ A_k \f$.
+// \param strideA The total number of elements between two consecutive matrices \f$ A_k \f$.
+// \param B Pointer to the first element of the first right-hand side matrix.
+// \param ldb The total number of elements between two rows/columns of the matrices \f$ B_k \f$.
+// \param strideB The total number of elements between two consecutive matrices \f$ B_k \f$.
+// \param beta The scaling factor for \f$ C_k \f$.
+// \param C Pointer to the first element of the first target matrix.
+// \param ldc The total number of elements between two rows/columns of the matrices \f$ C_k \f$.
+// \param strideC The total number of elements between two consecutive matrices \f$ C_k \f$.
+// \param batch The number of matrix/matrix multiplications in the batch.
+// \return void
+//
+// This function performs the strided batched dense matrix/dense matrix multiplication for double
+// precision complex operands based on the cblas_zgemm_batch_strided() function. Note that this
+// function is only available in case the BLAS library provides this extension (as for instance
+// the Intel MKL) and the BLAZE_USE_BLAS_BATCHED_TENSOR_TENSOR_MULTIPLICATION switch is enabled.
+*/
+BLAZE_ALWAYS_INLINE void gemmBatchStrided( CBLAS_ORDER order, CBLAS_TRANSPOSE transA,
+                                           CBLAS_TRANSPOSE transB, int m, int n, int k,
+                                           complex<double> alpha, const complex<double>* A,
+                                           int lda, int strideA, const complex<double>* B,
+                                           int ldb, int strideB, complex<double> beta,
+                                           complex<double>* C, int ldc, int strideC, int batch )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+
+   cblas_zgemm_batch_strided( order, transA, transB, m, n, k, reinterpret_cast<const double*>( &alpha ),
+                              reinterpret_cast<const double*>( A ), lda, strideA,
+                              reinterpret_cast<const double*>( B ), ldb, strideB,
+                              reinterpret_cast<const double*>( &beta ),
+                              reinterpret_cast<double*>( C ), ldc, strideC, batch );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief BLAS kernel for a page-wise dense tensor/dense tensor multiplication
+//        (\f$ C_k=\alpha*A_k*B_k+\beta*C_k \f$).
+// \ingroup blas
+//
+// \param C The target left-hand side dense tensor.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A_k*B_k \f$.
+// \param beta The scaling factor for \f$ C_k \f$.
+// \return void
+//
+// This function multiplies each page \f$ A_k \f$ of \a A with the according page \f$ B_k \f$
+// of \a B by means of a single call to the strided batched BLAS gemm function. The distance
+// between two consecutive pages is taken from the tensors themselves, such that views as for
+// instance subtensors, whose pages are \c rows()*spacing() elements of the underlying tensor
+// apart, are handled correctly.
+*/
+template< typename TT1   // Type of the left-hand side target tensor
+        , typename TT2   // Type of the left-hand side tensor operand
+        , typename TT3   // Type of the right-hand side tensor operand
+        , typename ST >  // Type of the scalar factors
+inline void gemmBatchStrided( DenseTensor<TT1>& C, const DenseTensor<TT2>& A,
+                              const DenseTensor<TT3>& B, ST alpha, ST beta )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( TT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( TT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( TT3 );
+
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( TT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS  ( TT2 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS  ( TT3 );
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<TT1> );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<TT2> );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<TT3> );
+
+   BLAZE_INTERNAL_ASSERT( (~A).pages() == (~B).pages() && (~A).pages() == (~C).pages(), "Invalid number of pages" );
+
+   const int m    ( numeric_cast<int>( (~A).rows()    ) );
+   const int n    ( numeric_cast<int>( (~B).columns() ) );
+   const int k    ( numeric_cast<int>( (~A).columns() ) );
+   const int lda  ( numeric_cast<int>( (~A).spacing() ) );
+   const int ldb  ( numeric_cast<int>( (~B).spacing() ) );
+   const int ldc  ( numeric_cast<int>( (~C).spacing() ) );
+   const int batch( numeric_cast<int>( (~C).pages()   ) );
+
+   gemmBatchStrided( CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k, alpha,
+                     (~A).data(), lda, numeric_cast<int>( pageStride( ~A ) ),
+                     (~B).data(), ldb, numeric_cast<int>( pageStride( ~B ) ), beta,
+                     (~C).data(), ldc, numeric_cast<int>( pageStride( ~C ) ), batch );
+}
+//*************************************************************************************************
+
+#endif
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1065 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/ArgReduce.h
+//  \brief Header file for the argmin, argmax and top-k selection of dense tensors and arrays
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_ARGREDUCE_H_
+#define _BLAZE_TENSOR_MATH_DENSE_ARGREDUCE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+#include <blaze_tensor/math/ReductionFlag.h>
+#include <blaze_tensor/math/dense/DynamicArray.h>
+#include <blaze_tensor/math/dense/DynamicTensor.h>
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/simd/AnyGreater.h>
+#include <blaze_tensor/math/simd/CmpBlend.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/system/Thresholds.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY ALIAS DECLARATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary alias declaration for the storage of an argmin/argmax/topk operand.
+// \ingroup math
+//
+// Operands that provide direct access to contiguous rows are used in-place, including views
+// such as subtensors, whose pages are addressed via their page stride. All other operands (as
+// for instance expressions) are evaluated once.
+*/
+template< typename T >
+using ArgReduceOperand_t =
+   If_t< IsContiguous_v<T> && HasConstDataAccess_v<T>
+       , const T&
+       , const ResultType_t<T> >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ARGMIN/ARGMAX KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether \a a is preferred over \a b by an argmax (MAX) or argmin reduction.
+// \ingroup math
+*/
+template< bool MAX, typename T >
+BLAZE_ALWAYS_INLINE bool argBetter( const T& a, const T& b ) noexcept
+{
+   return MAX ? ( b < a ) : ( a < b );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Combines the per-lane results of a vectorized argmin/argmax kernel.
+// \ingroup math
+//
+// \param values The best value of each SIMD lane.
+// \param indices The index of the best value of each SIMD lane.
+// \param lanes The number of SIMD lanes.
+// \param x Pointer to the first element of the row.
+// \param jpos The index of the first element not processed by the SIMD lanes.
+// \param n The number of elements in the row.
+// \return The index of the first minimum/maximum element of the row.
+*/
+template< bool MAX, typename T, typename I >
+inline size_t argRowFinish( const T* values, const I* indices, size_t lanes,
+                            const T* x, size_t jpos, size_t n ) noexcept
+{
+   T best( values[0] );
+   size_t index( indices[0] );
+
+   for( size_t l=1UL; l<lanes; ++l ) {
+      if( argBetter<MAX>( values[l], best ) ||
+          ( values[l] == best && size_t( indices[l] ) < index ) ) {
+         best  = values[l];
+         index = indices[l];
+      }
+   }
+
+   for( size_t j=jpos; j<n; ++j ) {
+      if( argBetter<MAX>( x[j], best ) ) {
+         best  = x[j];
+         index = j;
+      }
+   }
+
+   return index;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default argmin/argmax kernel for a contiguous row of elements.
+// \ingroup math
+//
+// \param x Pointer to the first element of the row.
+// \param n The number of elements in the row.
+// \return The index of the first minimum/maximum element of the row.
+*/
+template< bool MAX, typename T >
+inline size_t argRow( const T* x, size_t n ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( n > 0UL, "Invalid number of elements detected" );
+
+   T best( x[0] );
+   size_t index( 0UL );
+
+   for( size_t j=1UL; j<n; ++j ) {
+      if( argBetter<MAX>( x[j], best ) ) {
+         best  = x[j];
+         index = j;
+      }
+   }
+
+   return index;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX2/AVX-512 argmin/argmax kernel for a contiguous row of 'float' values.
+// \ingroup math
+//
+// \param x Pointer to the first element of the row.
+// \param n The number of elements in the row.
+// \return The index of the first minimum/maximum element of the row.
+//
+// Every SIMD lane tracks its best value and the corresponding 32-bit index. Per step the new
+// values are compared to the best values and both the values and the indices are blended
+// according to the resulting mask (see cmpBlend()). Rows that exceed the 32-bit index range are
+// handled by the default kernel.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_AVX2_MODE
+template< bool MAX >
+inline size_t argRow( const float* x, size_t n ) noexcept
+{
+   using IndexType = SIMDTrait_t<int32_t>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<float>::size );
+
+   BLAZE_STATIC_ASSERT( SIMDTrait<int32_t>::size == SIMDSIZE );
+
+   if( n < 2UL*SIMDSIZE || n > size_t( INT_MAX ) ) {
+      return argRow<MAX,float>( x, n );
+   }
+
+   const size_t jpos( n - ( n % SIMDSIZE ) );
+
+   alignas( AlignmentOf_v<float> ) float values[SIMDSIZE];
+   alignas( AlignmentOf_v<int32_t> ) int32_t indices[SIMDSIZE];
+
+   for( size_t l=0UL; l<SIMDSIZE; ++l ) {
+      indices[l] = int32_t( l );
+   }
+
+   const IndexType step( set( int32_t( SIMDSIZE ) ) );
+   SIMDfloat best( loadu( x ) );
+   IndexType bidx( loada( indices ) );
+   IndexType index( bidx );
+
+   for( size_t j=SIMDSIZE; j<jpos; j+=SIMDSIZE ) {
+      index = index + step;
+      cmpBlend<MAX>( best, bidx, loadu( x+j ), index );
+   }
+
+   storea( values , best );
+   storea( indices, bidx );
+
+   return argRowFinish<MAX>( values, indices, SIMDSIZE, x, jpos, n );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX2/AVX-512 argmin/argmax kernel for a contiguous row of 'double' values.
+// \ingroup math
+//
+// \param x Pointer to the first element of the row.
+// \param n The number of elements in the row.
+// \return The index of the first minimum/maximum element of the row.
+//
+// This kernel works as the 'float' kernel, but tracks 64-bit indices.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_AVX2_MODE
+template< bool MAX >
+inline size_t argRow( const double* x, size_t n ) noexcept
+{
+   using IndexType = SIMDTrait_t<int64_t>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<double>::size );
+
+   BLAZE_STATIC_ASSERT( SIMDTrait<int64_t>::size == SIMDSIZE );
+
+   if( n < 2UL*SIMDSIZE ) {
+      return argRow<MAX,double>( x, n );
+   }
+
+   const size_t jpos( n - ( n % SIMDSIZE ) );
+
+   alignas( AlignmentOf_v<double> ) double values[SIMDSIZE];
+   alignas( AlignmentOf_v<int64_t> ) int64_t indices[SIMDSIZE];
+
+   for( size_t l=0UL; l<SIMDSIZE; ++l ) {
+      indices[l] = int64_t( l );
+   }
+
+   const IndexType step( set( int64_t( SIMDSIZE ) ) );
+   SIMDdouble best( loadu( x ) );
+   IndexType bidx( loada( indices ) );
+   IndexType index( bidx );
+
+   for( size_t j=SIMDSIZE; j<jpos; j+=SIMDSIZE ) {
+      index = index + step;
+      cmpBlend<MAX>( best, bidx, loadu( x+j ), index );
+   }
+
+   storea( values , best );
+   storea( indices, bidx );
+
+   return argRowFinish<MAX>( values, indices, SIMDSIZE, x, jpos, n );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Argmin/argmax reduction along the contiguous rows of a dense operand.
+// \ingroup math
+//
+// \param A Pointer to the first element of the operand.
+// \param spacing The distance between two consecutive rows of the operand.
+// \param pageRows The number of rows per page of the operand.
+// \param pageStride The distance between two consecutive pages of the operand.
+// \param rows The total number of rows of the operand.
+// \param n The number of elements per row.
+// \param result Pointer to the first element of the resulting indices.
+// \param ocolumns The number of columns of the result.
+// \param ospacing The spacing between two rows of the result.
+// \param parallel \a true in case the rows should be processed in parallel.
+// \return void
+//
+// The index for the \a r-th row is written to the \a r-th element (in row-major order) of the
+// result.
+*/
+template< bool MAX, typename T >
+void argAlongRows( const T* A, size_t spacing, size_t pageRows, size_t pageStride,
+                   size_t rows, size_t n,
+                   size_t* result, size_t ocolumns, size_t ospacing, bool parallel )
+{
+   smpFor( rows, parallel, [=]( size_t begin, size_t end )
+   {
+      for( size_t r=begin; r<end; ++r ) {
+         const size_t index( ( r / ocolumns ) * ospacing + r % ocolumns );
+         const T* x( A + ( r / pageRows )*pageStride + ( r % pageRows )*spacing );
+         result[index] = argRow<MAX>( x, n );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Argmin/argmax reduction across the rows of a dense operand.
+// \ingroup math
+//
+// \param A Pointer to the first element of the operand.
+// \param spacing The distance between two consecutive rows of the operand.
+// \param pageRows The number of rows per page of the operand.
+// \param pageStride The distance between two consecutive pages of the operand.
+// \param n The number of elements per row.
+// \param inner The number of consecutive rows between two samples of the same fiber.
+// \param extent The number of samples per fiber.
+// \param outer The number of independent blocks of \a inner times \a extent rows.
+// \param result Pointer to the first element of the resulting indices.
+// \param ospacing The spacing between two rows of the result.
+// \param parallel \a true in case the blocks should be processed in parallel.
+// \return void
+//
+// The rows of the operand are interpreted as a three-dimensional \a outer x \a extent x
+// \a inner arrangement and the reduction is performed along the \a extent dimension. The
+// indices for the rows (o,:,a) are written to row \a o*inner+a of the result. The update of
+// the best values and indices is formulated as a branch-free select over complete rows, which
+// is compiled to a vectorized compare-and-blend.
+*/
+template< bool MAX, typename T >
+void argAcrossRows( const T* A, size_t spacing, size_t pageRows, size_t pageStride,
+                    size_t n, size_t inner, size_t extent, size_t outer,
+                    size_t* result, size_t ospacing, bool parallel )
+{
+   smpFor( outer*inner, parallel, [=]( size_t begin, size_t end )
+   {
+      DynamicVector<T> best( n );
+
+      for( size_t f=begin; f<end; ++f )
+      {
+         const size_t o( f / inner );
+         const size_t a( f % inner );
+
+         size_t* index( result + f*ospacing );
+         T* b( best.data() );
+
+         const auto row = [=]( size_t e ) {
+            const size_t r( ( o*extent + e )*inner + a );
+            return A + ( r / pageRows )*pageStride + ( r % pageRows )*spacing;
+         };
+
+         const T* x( row( 0UL ) );
+         std::copy( x, x+n, b );
+         std::fill( index, index+n, size_t( 0 ) );
+
+         for( size_t e=1UL; e<extent; ++e ) {
+            x = row( e );
+            for( size_t j=0UL; j<n; ++j ) {
+               const bool better( argBetter<MAX>( x[j], b[j] ) );
+               b[j]     = better ? x[j] : b[j];
+               index[j] = better ? e : index[j];
+            }
+         }
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TOP-K KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether any of the next SIMDSIZE elements is greater than the given threshold.
+// \ingroup math
+//
+// \param x Pointer to the first element.
+// \param threshold The threshold value.
+// \return \a true if at least one element is greater than \a threshold, \a false if not.
+*/
+template< typename T >
+BLAZE_ALWAYS_INLINE bool anyGreater( const T* x, const T& threshold ) noexcept
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<T>::size );
+
+   bool result( false );
+   for( size_t l=0UL; l<SIMDSIZE; ++l ) {
+      result |= ( threshold < x[l] );
+   }
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether any of the next SIMDSIZE 'float' values is greater than the threshold.
+// \ingroup math
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_AVX2_MODE
+BLAZE_ALWAYS_INLINE bool anyGreater( const float* x, const float& threshold ) noexcept
+{
+   return anyGreater( loadu( x ), set( threshold ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether any of the next SIMDSIZE 'double' values is greater than the threshold.
+// \ingroup math
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_AVX2_MODE
+BLAZE_ALWAYS_INLINE bool anyGreater( const double* x, const double& threshold ) noexcept
+{
+   return anyGreater( loadu( x ), set( threshold ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selection of the \a k largest elements of a contiguous row of elements.
+// \ingroup math
+//
+// \param x Pointer to the first element of the row.
+// \param n The number of elements in the row.
+// \param k The number of elements to be selected (\f$ 0 < k \leq n \f$).
+// \param values Pointer to the first resulting value.
+// \param vstride The distance between two consecutive resulting values.
+// \param indices Pointer to the first resulting index.
+// \param istride The distance between two consecutive resulting indices.
+// \param heap Buffer for the selection with a capacity of at least \a k elements.
+// \return void
+//
+// The \a k largest elements are kept in a min-heap. The smallest selected value serves as
+// threshold, which is compared against SIMDSIZE elements at once; only chunks that contain
+// at least one larger element update the heap. The selected elements are written in
+// descending order; equal values are ordered by ascending index.
+*/
+template< typename T >
+void topkRow( const T* x, size_t n, size_t k,
+              T* values, size_t vstride, size_t* indices, size_t istride,
+              std::vector< std::pair<T,size_t> >& heap )
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<T>::size );
+
+   BLAZE_INTERNAL_ASSERT( k > 0UL && k <= n, "Invalid number of elements detected" );
+
+   const auto better = []( const std::pair<T,size_t>& a, const std::pair<T,size_t>& b ) {
+      return ( b.first < a.first ) || ( !( a.first < b.first ) && a.second < b.second );
+   };
+
+   heap.clear();
+   for( size_t j=0UL; j<k; ++j ) {
+      heap.emplace_back( x[j], j );
+   }
+   std::make_heap( heap.begin(), heap.end(), better );
+
+   T threshold( heap.front().first );
+
+   const auto update = [&]( size_t j ) {
+      if( threshold < x[j] ) {
+         std::pop_heap( heap.begin(), heap.end(), better );
+         heap.back() = std::make_pair( x[j], j );
+         std::push_heap( heap.begin(), heap.end(), better );
+         threshold = heap.front().first;
+      }
+   };
+
+   size_t j( k );
+
+   for( ; j+SIMDSIZE<=n; j+=SIMDSIZE ) {
+      if( anyGreater( x+j, threshold ) ) {
+         for( size_t l=0UL; l<SIMDSIZE; ++l ) {
+            update( j+l );
+         }
+      }
+   }
+
+   for( ; j<n; ++j ) {
+      update( j );
+   }
+
+   std::sort_heap( heap.begin(), heap.end(), better );
+
+   for( size_t t=0UL; t<k; ++t ) {
+      values [t*vstride] = heap[t].first;
+      indices[t*istride] = heap[t].second;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Top-k selection along the contiguous rows of a dense operand.
+// \ingroup math
+//
+// \param A Pointer to the first element of the operand.
+// \param spacing The distance between two consecutive rows of the operand.
+// \param pageRows The number of rows per page of the operand.
+// \param pageStride The distance between two consecutive pages of the operand.
+// \param rows The total number of rows of the operand.
+// \param n The number of elements per row.
+// \param k The number of elements to be selected per row.
+// \param values Pointer to the first element of the resulting values.
+// \param vspacing The spacing between two rows of the resulting values.
+// \param indices Pointer to the first element of the resulting indices.
+// \param ispacing The spacing between two rows of the resulting indices.
+// \param parallel \a true in case the rows should be processed in parallel.
+// \return void
+*/
+template< typename T >
+void topkAlongRows( const T* A, size_t spacing, size_t pageRows, size_t pageStride,
+                    size_t rows, size_t n, size_t k,
+                    T* values, size_t vspacing, size_t* indices, size_t ispacing, bool parallel )
+{
+   smpFor( rows, parallel, [=]( size_t begin, size_t end )
+   {
+      std::vector< std::pair<T,size_t> > heap;
+      heap.reserve( k );
+
+      for( size_t r=begin; r<end; ++r ) {
+         const size_t page( r / pageRows );
+         const T* x( A + page*pageStride + ( r - page*pageRows )*spacing );
+         topkRow( x, n, k, values + r*vspacing, 1UL, indices + r*ispacing, 1UL, heap );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Top-k selection across the rows of a dense operand.
+// \ingroup math
+//
+// \param A Pointer to the first element of the operand.
+// \param spacing The distance between two consecutive rows of the operand.
+// \param pageRows The number of rows per page of the operand.
+// \param pageStride The distance between two consecutive pages of the operand.
+// \param n The number of elements per row.
+// \param inner The number of consecutive rows between two samples of the same fiber.
+// \param extent The number of samples per fiber.
+// \param outer The number of independent blocks of \a inner times \a extent rows.
+// \param k The number of elements to be selected per fiber.
+// \param values Pointer to the first element of the resulting values.
+// \param vspacing The spacing between two rows of the resulting values.
+// \param indices Pointer to the first element of the resulting indices.
+// \param ispacing The spacing between two rows of the resulting indices.
+// \param parallel \a true in case the blocks should be processed in parallel.
+// \return void
+//
+// The rows of the operand are interpreted as a three-dimensional \a outer x \a extent x
+// \a inner arrangement and the selection is performed along the \a extent dimension. The
+// results are arranged as \a outer x \a k x \a inner rows. Every \a extent x \a n slab is
+// first transposed into a column-major buffer, such that all fibers are selected from
+// contiguous memory.
+*/
+template< typename T >
+void topkAcrossRows( const T* A, size_t spacing, size_t pageRows, size_t pageStride,
+                     size_t n, size_t inner, size_t extent, size_t outer, size_t k,
+                     T* values, size_t vspacing, size_t* indices, size_t ispacing, bool parallel )
+{
+   using SlabType = CustomMatrix<const T,unaligned,unpadded,rowMajor>;
+
+   // The samples of a fiber lie either within one page or at the same row of consecutive pages
+   const size_t stride( inner % pageRows == 0UL ? ( inner / pageRows )*pageStride : inner*spacing );
+
+   smpFor( outer*inner, parallel, [=]( size_t begin, size_t end )
+   {
+      std::vector< std::pair<T,size_t> > heap;
+      heap.reserve( k );
+
+      DynamicMatrix<T,columnMajor> buffer( extent, n );
+
+      for( size_t f=begin; f<end; ++f )
+      {
+         const size_t o( f / inner );
+         const size_t a( f % inner );
+
+         const size_t r( o*extent*inner + a );
+         assign( buffer, SlabType( A + ( r / pageRows )*pageStride + ( r % pageRows )*spacing,
+                                   extent, n, stride ) );
+
+         const size_t offset( o*k*inner + a );
+
+         for( size_t j=0UL; j<n; ++j ) {
+            topkRow( buffer.data( j ), extent, k,
+                     values  + offset*vspacing + j, inner*vspacing,
+                     indices + offset*ispacing + j, inner*ispacing, heap );
+         }
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DENSE TENSOR FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the row-/column-/pagewise argmin and argmax functions.
+// \ingroup dense_tensor
+//
+// \param dt The given dense tensor.
+// \return The indices of the minimum/maximum elements.
+// \exception std::invalid_argument Invalid input tensor.
+*/
+template< size_t RF      // Reduction flag
+        , bool MAX       // Flag for the argmax reduction
+        , typename TT >  // Type of the dense tensor
+DynamicMatrix<size_t,rowMajor> argReduce_backend( const DenseTensor<TT>& dt )
+{
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   const size_t O( (~dt).pages()   );
+   const size_t M( (~dt).rows()    );
+   const size_t N( (~dt).columns() );
+
+   if( ( RF == rowwise ? N : RF == columnwise ? M : O ) == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid input tensor" );
+   }
+
+   DynamicMatrix<size_t,rowMajor> result( RF == pagewise ? M : O, RF == rowwise ? M : N );
+
+   if( O*M*N != 0UL )
+   {
+      ArgReduceOperand_t<TT> A( ~dt );
+
+      const bool parallel( !isSerialSectionActive() && O*M*N >= SMP_DTENSREDUCE_THRESHOLD );
+      const size_t stride( pageStride( A ) );
+
+      if( RF == rowwise ) {
+         argAlongRows<MAX>( A.data(), A.spacing(), M, stride, O*M, N,
+                            result.data(), M, result.spacing(), parallel );
+      }
+      else if( RF == columnwise ) {
+         argAcrossRows<MAX>( A.data(), A.spacing(), M, stride, N, 1UL, M, O,
+                             result.data(), result.spacing(), parallel );
+      }
+      else {
+         argAcrossRows<MAX>( A.data(), A.spacing(), M, stride, N, M, O, 1UL,
+                             result.data(), result.spacing(), parallel );
+      }
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the row-/column-/pagewise indices of the minimum elements of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param dt The given dense tensor.
+// \return The indices of the minimum elements.
+// \exception std::invalid_argument Invalid input tensor.
+//
+// This function returns the index of the first minimum element along the dimension specified
+// by \a RF. The shape of the resulting index matrix corresponds to the shape of the result of
+// \c min<RF>(): pages-by-rows for \a blaze::rowwise (column indices), pages-by-columns for
+// \a blaze::columnwise (row indices) and rows-by-columns for \a blaze::pagewise (page
+// indices). Example:
+
+   \code
+   using blaze::DynamicTensor;
+   using blaze::DynamicMatrix;
+
+   DynamicTensor<int> A{ { { 1, 3, 2 }, { 2, 6, 4 } }, { { 9, 6, 3 }, { 4, 5, 2 } } };
+   DynamicMatrix<size_t> ri, ci, pi;
+
+   ri = argmin<rowwise>( A );     // Results in ( ( 0, 0 ), ( 2, 2 ) )
+   ci = argmin<columnwise>( A );  // Results in ( ( 0, 0, 0 ), ( 1, 1, 1 ) )
+   pi = argmin<pagewise>( A );    // Results in ( ( 0, 0, 0 ), ( 0, 1, 1 ) )
+   \endcode
+
+// In case the extent of the reduced dimension is 0, a \a std::invalid_argument is thrown.
+*/
+template< size_t RF      // Reduction flag
+        , typename TT >  // Type of the dense tensor
+inline DynamicMatrix<size_t,rowMajor> argmin( const DenseTensor<TT>& dt )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return argReduce_backend<RF,false>( ~dt );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the row-/column-/pagewise indices of the maximum elements of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param dt The given dense tensor.
+// \return The indices of the maximum elements.
+// \exception std::invalid_argument Invalid input tensor.
+//
+// This function returns the index of the first maximum element along the dimension specified
+// by \a RF (see argmin()). Rows of single and double precision values are reduced by an AVX2
+// or AVX-512 compare-and-blend kernel, which tracks the best value and its index per SIMD lane.
+// In case the SMP parallelization is active, the independent rows or slices are processed in
+// parallel. In case the extent of the reduced dimension is 0, a \a std::invalid_argument is
+// thrown.
+*/
+template< size_t RF      // Reduction flag
+        , typename TT >  // Type of the dense tensor
+inline DynamicMatrix<size_t,rowMajor> argmax( const DenseTensor<TT>& dt )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return argReduce_backend<RF,true>( ~dt );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Selects the \a k largest elements along the given dimension of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param dt The given dense tensor.
+// \param k The number of elements to be selected.
+// \return A pair of the selected values and their indices.
+// \exception std::invalid_argument Invalid number of elements.
+//
+// This function selects the \a k largest elements along the dimension specified by \a RF and
+// returns both the selected values and their indices along that dimension. The two resulting
+// tensors have the shape of the given tensor with the extent of the reduced dimension replaced
+// by \a k. The selected elements are sorted in descending order; equal values are ordered by
+// ascending index. Example:
+
+   \code
+   using blaze::DynamicTensor;
+
+   DynamicTensor<int> A{ { { 1, 3, 2 }, { 2, 6, 4 } }, { { 9, 6, 3 }, { 4, 5, 2 } } };
+
+   const auto t = topk<rowwise>( A, 2UL );
+   // t.first  results in ( ( ( 3, 2 ), ( 6, 4 ) ), ( ( 9, 6 ), ( 5, 4 ) ) )
+   // t.second results in ( ( ( 1, 2 ), ( 1, 2 ) ), ( ( 0, 1 ), ( 1, 0 ) ) )
+   \endcode
+
+// Per fiber the selection keeps a heap of the current \a k largest elements and compares the
+// smallest of them against complete SIMD vectors of the remaining elements, such that only
+// candidates are inserted into the heap. In case the SMP parallelization is active, the
+// independent fibers are processed in parallel. In case \a k exceeds the extent of the reduced
+// dimension, a \a std::invalid_argument is thrown.
+*/
+template< size_t RF      // Reduction flag
+        , typename TT >  // Type of the dense tensor
+auto topk( const DenseTensor<TT>& dt, size_t k )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   using ET = RemoveConst_t< ElementType_t<TT> >;
+
+   const size_t O( (~dt).pages()   );
+   const size_t M( (~dt).rows()    );
+   const size_t N( (~dt).columns() );
+
+   if( k > ( RF == rowwise ? N : RF == columnwise ? M : O ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of elements" );
+   }
+
+   const size_t o( RF == pagewise   ? k : O );
+   const size_t m( RF == columnwise ? k : M );
+   const size_t n( RF == rowwise    ? k : N );
+
+   DynamicTensor<ET>     values ( o, m, n );
+   DynamicTensor<size_t> indices( o, m, n );
+
+   if( k != 0UL && O*M*N != 0UL )
+   {
+      ArgReduceOperand_t<TT> A( ~dt );
+
+      const bool parallel( !isSerialSectionActive() && O*M*N >= SMP_DTENSREDUCE_THRESHOLD );
+      const size_t stride( pageStride( A ) );
+
+      if( RF == rowwise ) {
+         topkAlongRows( A.data(), A.spacing(), M, stride, O*M, N, k,
+                        values.data(), values.spacing(), indices.data(), indices.spacing(),
+                        parallel );
+      }
+      else if( RF == columnwise ) {
+         topkAcrossRows( A.data(), A.spacing(), M, stride, N, 1UL, M, O, k,
+                         values.data(), values.spacing(), indices.data(), indices.spacing(),
+                         parallel );
+      }
+      else {
+         topkAcrossRows( A.data(), A.spacing(), M, stride, N, M, O, 1UL, k,
+                         values.data(), values.spacing(), indices.data(), indices.spacing(),
+                         parallel );
+      }
+   }
+
+   return std::make_pair( std::move( values ), std::move( indices ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DENSE ARRAY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the argmin and argmax functions along dimension \a R.
+// \ingroup dense_array
+//
+// \param da The given dense array.
+// \return The indices of the minimum/maximum elements along dimension \a R.
+// \exception std::invalid_argument Invalid input array.
+*/
+template< size_t R       // Reduction dimension
+        , bool MAX       // Flag for the argmax reduction
+        , typename AT >  // Type of the dense array
+auto argReduce_backend( const DenseArray<AT>& da )
+{
+   constexpr size_t N( AT::num_dimensions );
+
+   BLAZE_STATIC_ASSERT_MSG( N > 1UL, "Invalid array dimensionality" );
+   BLAZE_STATIC_ASSERT_MSG( R < N, "Invalid reduction dimension" );
+
+   const std::array<size_t,N>& dims( (~da).dimensions() );
+
+   if( dims[R] == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid input array" );
+   }
+
+   std::array<size_t,N-1UL> rdims;
+   size_t inner( 1UL ), outer( 1UL ), total( 1UL );
+
+   for( size_t i=0UL, j=0UL; i<N; ++i ) {
+      total *= dims[i];
+      if( i == R ) continue;
+      rdims[j++] = dims[i];
+      if( i > 0UL && i < R ) inner *= dims[i];
+      if( i > R ) outer *= dims[i];
+   }
+
+   DynamicArray<N-1UL,size_t> result( rdims );
+
+   if( total != 0UL )
+   {
+      ArgReduceOperand_t<AT> A( ~da );
+
+      const bool parallel( !isSerialSectionActive() && total >= SMP_DARRREDUCE_THRESHOLD );
+
+      const size_t rows( total / dims[0] );
+
+      if( R == 0UL ) {
+         argAlongRows<MAX>( A.data(), A.spacing(), rows, rows*A.spacing(), rows, dims[0],
+                            result.data(), rdims[0], result.spacing(), parallel );
+      }
+      else {
+         argAcrossRows<MAX>( A.data(), A.spacing(), rows, rows*A.spacing(),
+                             dims[0], inner, dims[R], outer,
+                             result.data(), result.spacing(), parallel );
+      }
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the indices of the minimum elements along dimension \a R of a dense array.
+// \ingroup dense_array
+//
+// \param da The given dense array.
+// \return The indices of the minimum elements along dimension \a R.
+// \exception std::invalid_argument Invalid input array.
+//
+// This function returns the index of the first minimum element along the dimension \a R of
+// the given N-dimensional dense array \a da. The result is a (N-1)-dimensional array with the
+// dimension \a R removed. Dimension 0 refers to the columns of the array. In case the extent
+// of dimension \a R is 0, a \a std::invalid_argument is thrown.
+*/
+template< size_t R       // Reduction dimension
+        , typename AT >  // Type of the dense array
+inline auto argmin( const DenseArray<AT>& da )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return argReduce_backend<R,false>( ~da );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the indices of the maximum elements along dimension \a R of a dense array.
+// \ingroup dense_array
+//
+// \param da The given dense array.
+// \return The indices of the maximum elements along dimension \a R.
+// \exception std::invalid_argument Invalid input array.
+//
+// This function returns the index of the first maximum element along the dimension \a R of
+// the given N-dimensional dense array \a da (see argmin()). In case the SMP parallelization is
+// active, the independent fibers are processed in parallel. In case the extent of dimension
+// \a R is 0, a \a std::invalid_argument is thrown.
+*/
+template< size_t R       // Reduction dimension
+        , typename AT >  // Type of the dense array
+inline auto argmax( const DenseArray<AT>& da )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return argReduce_backend<R,true>( ~da );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Selects the \a k largest elements along dimension \a R of a dense array.
+// \ingroup dense_array
+//
+// \param da The given dense array.
+// \param k The number of elements to be selected.
+// \return A pair of the selected values and their indices.
+// \exception std::invalid_argument Invalid number of elements.
+//
+// This function selects the \a k largest elements along the dimension \a R of the given dense
+// array \a da and returns both the selected values and their indices along that dimension.
+// The two resulting arrays have the shape of the given array with the extent of dimension
+// \a R replaced by \a k. The selected elements are sorted in descending order; equal values
+// are ordered by ascending index. In case \a k exceeds the extent of dimension \a R, a
+// \a std::invalid_argument is thrown.
+*/
+template< size_t R       // Reduction dimension
+        , typename AT >  // Type of the dense array
+auto topk( const DenseArray<AT>& da, size_t k )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   constexpr size_t N( AT::num_dimensions );
+
+   BLAZE_STATIC_ASSERT_MSG( R < N, "Invalid reduction dimension" );
+
+   using ET = RemoveConst_t< ElementType_t<AT> >;
+
+   const std::array<size_t,N>& dims( (~da).dimensions() );
+
+   if( k > dims[R] ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of elements" );
+   }
+
+   std::array<size_t,N> rdims( dims );
+   rdims[R] = k;
+
+   size_t inner( 1UL ), outer( 1UL ), total( 1UL );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      total *= dims[i];
+      if( i > 0UL && i < R ) inner *= dims[i];
+      if( i > R ) outer *= dims[i];
+   }
+
+   DynamicArray<N,ET>     values ( rdims );
+   DynamicArray<N,size_t> indices( rdims );
+
+   if( k != 0UL && total != 0UL )
+   {
+      ArgReduceOperand_t<AT> A( ~da );
+
+      const bool parallel( !isSerialSectionActive() && total >= SMP_DARRREDUCE_THRESHOLD );
+
+      const size_t rows( total / dims[0] );
+
+      if( R == 0UL ) {
+         topkAlongRows( A.data(), A.spacing(), rows, rows*A.spacing(), rows, dims[0], k,
+                        values.data(), values.spacing(), indices.data(), indices.spacing(),
+                        parallel );
+      }
+      else {
+         topkAcrossRows( A.data(), A.spacing(), rows, rows*A.spacing(),
+                         dims[0], inner, dims[R], outer, k,
+                         values.data(), values.spacing(), indices.data(), indices.spacing(),
+                         parallel );
+      }
+   }
+
+   return std::make_pair( std::move( values ), std::move( indices ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
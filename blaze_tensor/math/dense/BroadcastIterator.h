@@ -0,0 +1,309 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/BroadcastIterator.h
+//  \brief Header file for the BroadcastIterator class template
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_BROADCASTITERATOR_H_
+#define _BLAZE_TENSOR_MATH_DENSE_BROADCASTITERATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <blaze/math/SIMD.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Implementation of a generic iterator over a single broadcast value.
+// \ingroup math
+//
+// The BroadcastIterator represents a random access iterator over a row that consists of a
+// single repeated value, as it appears when a matrix or vector element is broadcast across a
+// row of a tensor. In contrast to an iterator over a uniform matrix, the iterator stores the
+// broadcast value by value instead of referring to it. Therefore the value can be kept in a
+// register for the complete row and each call to the load() function only broadcasts it into
+// a SIMD element.
+*/
+template< typename Type >  // Type of the broadcast value
+class BroadcastIterator
+{
+ public:
+   //**Type definitions****************************************************************************
+   using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+   using ValueType        = Type;                             //!< Type of the underlying elements.
+   using PointerType      = const Type*;                      //!< Pointer return type.
+   using ReferenceType    = const Type&;                      //!< Reference return type.
+   using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+
+   // STL iterator requirements
+   using iterator_category = IteratorCategory;  //!< The iterator category.
+   using value_type        = ValueType;         //!< Type of the underlying elements.
+   using pointer           = PointerType;       //!< Pointer return type.
+   using reference         = ReferenceType;     //!< Reference return type.
+   using difference_type   = DifferenceType;    //!< Difference between two iterators.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BroadcastIterator class.
+   //
+   // \param value The broadcast value.
+   // \param index The initial position of the iterator.
+   */
+   explicit inline BroadcastIterator( const Type& value, size_t index = 0UL )
+      : value_( value )  // The broadcast value
+      , index_( index )  // The current position of the iterator
+   {}
+   //**********************************************************************************************
+
+   //**Addition assignment operator****************************************************************
+   /*!\brief Addition assignment operator.
+   //
+   // \param inc The increment of the iterator.
+   // \return The incremented iterator.
+   */
+   inline BroadcastIterator& operator+=( ptrdiff_t inc ) noexcept {
+      index_ += inc;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Subtraction assignment operator*************************************************************
+   /*!\brief Subtraction assignment operator.
+   //
+   // \param dec The decrement of the iterator.
+   // \return The decremented iterator.
+   */
+   inline BroadcastIterator& operator-=( ptrdiff_t dec ) noexcept {
+      index_ -= dec;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Prefix increment operator*******************************************************************
+   /*!\brief Pre-increment operator.
+   //
+   // \return Reference to the incremented iterator.
+   */
+   inline BroadcastIterator& operator++() noexcept {
+      ++index_;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Postfix increment operator******************************************************************
+   /*!\brief Post-increment operator.
+   //
+   // \return The previous position of the iterator.
+   */
+   inline const BroadcastIterator operator++( int ) {
+      return BroadcastIterator( value_, index_++ );
+   }
+   //**********************************************************************************************
+
+   //**Prefix decrement operator*******************************************************************
+   /*!\brief Pre-decrement operator.
+   //
+   // \return Reference to the decremented iterator.
+   */
+   inline BroadcastIterator& operator--() noexcept {
+      --index_;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Postfix decrement operator******************************************************************
+   /*!\brief Post-decrement operator.
+   //
+   // \return The previous position of the iterator.
+   */
+   inline const BroadcastIterator operator--( int ) {
+      return BroadcastIterator( value_, index_-- );
+   }
+   //**********************************************************************************************
+
+   //**Element access operator*********************************************************************
+   /*!\brief Direct access to the element at the current iterator position.
+   //
+   // \return Reference to the broadcast value.
+   */
+   inline ReferenceType operator*() const noexcept {
+      return value_;
+   }
+   //**********************************************************************************************
+
+   //**Load function*******************************************************************************
+   /*!\brief Access to the SIMD elements of the row.
+   //
+   // \return The broadcast value packed into a SIMD element.
+   */
+   BLAZE_ALWAYS_INLINE auto load() const noexcept {
+      return set( value_ );
+   }
+   //**********************************************************************************************
+
+   //**Equality operator***************************************************************************
+   /*!\brief Equality comparison between two BroadcastIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the iterators refer to the same element, \a false if not.
+   */
+   inline bool operator==( const BroadcastIterator& rhs ) const noexcept {
+      return index_ == rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Inequality operator*************************************************************************
+   /*!\brief Inequality comparison between two BroadcastIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the iterators don't refer to the same element, \a false if they do.
+   */
+   inline bool operator!=( const BroadcastIterator& rhs ) const noexcept {
+      return index_ != rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Less-than operator**************************************************************************
+   /*!\brief Less-than comparison between two BroadcastIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is smaller, \a false if not.
+   */
+   inline bool operator<( const BroadcastIterator& rhs ) const noexcept {
+      return index_ < rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Greater-than operator***********************************************************************
+   /*!\brief Greater-than comparison between two BroadcastIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is greater, \a false if not.
+   */
+   inline bool operator>( const BroadcastIterator& rhs ) const noexcept {
+      return index_ > rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Less-or-equal-than operator*****************************************************************
+   /*!\brief Less-than comparison between two BroadcastIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+   */
+   inline bool operator<=( const BroadcastIterator& rhs ) const noexcept {
+      return index_ <= rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Greater-or-equal-than operator**************************************************************
+   /*!\brief Greater-than comparison between two BroadcastIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+   */
+   inline bool operator>=( const BroadcastIterator& rhs ) const noexcept {
+      return index_ >= rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Subtraction operator************************************************************************
+   /*!\brief Calculating the number of elements between two iterators.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return The number of elements between the two iterators.
+   */
+   inline DifferenceType operator-( const BroadcastIterator& rhs ) const noexcept {
+      return index_ - rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Addition operator***************************************************************************
+   /*!\brief Addition between a BroadcastIterator and an integral value.
+   //
+   // \param it The iterator to be incremented.
+   // \param inc The number of elements the iterator is incremented.
+   // \return The incremented iterator.
+   */
+   friend inline const BroadcastIterator operator+( const BroadcastIterator& it, size_t inc ) {
+      return BroadcastIterator( it.value_, it.index_ + inc );
+   }
+   //**********************************************************************************************
+
+   //**Addition operator***************************************************************************
+   /*!\brief Addition between an integral value and a BroadcastIterator.
+   //
+   // \param inc The number of elements the iterator is incremented.
+   // \param it The iterator to be incremented.
+   // \return The incremented iterator.
+   */
+   friend inline const BroadcastIterator operator+( size_t inc, const BroadcastIterator& it ) {
+      return BroadcastIterator( it.value_, it.index_ + inc );
+   }
+   //**********************************************************************************************
+
+   //**Subtraction operator************************************************************************
+   /*!\brief Subtraction between a BroadcastIterator and an integral value.
+   //
+   // \param it The iterator to be decremented.
+   // \param dec The number of elements the iterator is decremented.
+   // \return The decremented iterator.
+   */
+   friend inline const BroadcastIterator operator-( const BroadcastIterator& it, size_t dec ) {
+      return BroadcastIterator( it.value_, it.index_ - dec );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Type      value_;  //!< The broadcast value.
+   ptrdiff_t index_;  //!< The current position of the iterator.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1084 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/Contraction.h
+//  \brief Header file for the contraction of dense vectors, matrices, tensors and arrays
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_CONTRACTION_H_
+#define _BLAZE_TENSOR_MATH_DENSE_CONTRACTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <string>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsDenseVector.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+#include <blaze_tensor/math/dense/DynamicArray.h>
+#include <blaze_tensor/math/dense/DynamicTensor.h>
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/expressions/DTensTransExpr.h>
+#include <blaze_tensor/math/typetraits/IsDenseArray.h>
+#include <blaze_tensor/math/typetraits/IsDenseTensor.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY CLASS TEMPLATES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the number of dimensions of a contraction operand.
+// \ingroup dense_tensor
+//
+// This type trait evaluates to the number of dimensions of the given dense vector (1), dense
+// matrix (2), dense tensor (3) or dense array (N). For all other types it evaluates to 0.
+*/
+template< typename T, typename = void >
+struct ContractionRank
+   : public IntegralConstant<size_t,0UL>
+{};
+
+template< typename T >
+struct ContractionRank< T, EnableIf_t< IsDenseVector_v<T> > >
+   : public IntegralConstant<size_t,1UL>
+{};
+
+template< typename T >
+struct ContractionRank< T, EnableIf_t< IsDenseMatrix_v<T> > >
+   : public IntegralConstant<size_t,2UL>
+{};
+
+template< typename T >
+struct ContractionRank< T, EnableIf_t< IsDenseTensor_v<T> > >
+   : public IntegralConstant<size_t,3UL>
+{};
+
+template< typename T >
+struct ContractionRank< T, EnableIf_t< IsDenseArray_v<T> > >
+   : public IntegralConstant<size_t,T::num_dimensions>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary alias declaration for the storage of a contraction operand.
+// \ingroup dense_tensor
+//
+// Operands that provide direct access to contiguous rows are used in-place, all other operands
+// (as for instance expressions or dilated views) are evaluated once.
+*/
+template< typename T >
+using ContractionOperand_t =
+   If_t< IsContiguous_v<T> && HasConstDataAccess_v<T>, const T&, const ResultType_t<T> >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the result type of a contraction.
+// \ingroup dense_tensor
+//
+// The result of a contraction with \a R remaining dimensions is stored in a DynamicVector (1),
+// a row-major DynamicMatrix (2), a DynamicTensor (3) or a DynamicArray (N) of element type
+// \a ET. The extents passed to the \a create() function are given in natural order, i.e. the
+// outermost dimension first.
+*/
+template< size_t R, typename ET >
+struct ContractionResult
+{
+   using Type = DynamicArray<R,ET>;
+
+   static inline Type create( const std::array<size_t,R>& extents )
+   {
+      std::array<size_t,R> dims;
+      for( size_t i=0UL; i<R; ++i ) {
+         dims[i] = extents[R-i-1UL];
+      }
+      return Type( dims );
+   }
+};
+
+template< typename ET >
+struct ContractionResult<1UL,ET>
+{
+   using Type = DynamicVector<ET>;
+
+   static inline Type create( const std::array<size_t,1UL>& extents ) {
+      return Type( extents[0] );
+   }
+};
+
+template< typename ET >
+struct ContractionResult<2UL,ET>
+{
+   using Type = DynamicMatrix<ET,rowMajor>;
+
+   static inline Type create( const std::array<size_t,2UL>& extents ) {
+      return Type( extents[0], extents[1] );
+   }
+};
+
+template< typename ET >
+struct ContractionResult<3UL,ET>
+{
+   using Type = DynamicTensor<ET>;
+
+   static inline Type create( const std::array<size_t,3UL>& extents ) {
+      return Type( extents[0], extents[1], extents[2] );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Strided memory layout of a contraction operand.
+// \ingroup dense_tensor
+//
+// The extents and strides (in elements) of all dimensions of an operand, outermost first.
+*/
+template< size_t R >
+struct ContractionLayout
+{
+   std::array<size_t,R> extents;  //!< The extents of the dimensions.
+   std::array<size_t,R> strides;  //!< The distances between consecutive elements of the dimensions.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Matrix interpretation of a contraction operand.
+// \ingroup dense_tensor
+//
+// Describes an operand as \a m x \a n matrix, where the rows and columns are formed by two
+// groups of the operand's dimensions. In case the strides of the operand allow it the matrix
+// is a direct, row-major or column-major view on the operand's memory (\a viewable). Otherwise
+// \a rowOffsets and \a colOffsets contain the offsets of all rows and columns, which are used
+// to permute the operand into (or out of) a temporary matrix.
+*/
+struct ContractionFold
+{
+   size_t m;                        //!< The number of rows of the matrix.
+   size_t n;                        //!< The number of columns of the matrix.
+   bool viewable;                   //!< Flag for a zero-copy view on the operand.
+   bool rowMajor;                   //!< Storage order of the zero-copy view.
+   size_t spacing;                  //!< Spacing between the rows/columns of the zero-copy view.
+   std::vector<size_t> rowOffsets;  //!< The offsets of the rows for the permuting copy.
+   std::vector<size_t> colOffsets;  //!< The offsets of the columns for the permuting copy.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LAYOUT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the memory layout of the given contiguous dense vector.
+// \ingroup dense_tensor
+//
+// \param v The given dense vector.
+// \return The memory layout of the vector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline ContractionLayout<1UL> contractionLayout( const DenseVector<VT,TF>& v ) noexcept
+{
+   ContractionLayout<1UL> layout;
+   layout.extents[0] = (~v).size();
+   layout.strides[0] = 1UL;
+   return layout;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the memory layout of the given contiguous dense matrix.
+// \ingroup dense_tensor
+//
+// \param m The given dense matrix.
+// \return The memory layout of the matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline ContractionLayout<2UL> contractionLayout( const DenseMatrix<MT,SO>& m ) noexcept
+{
+   ContractionLayout<2UL> layout;
+   layout.extents[0] = (~m).rows();
+   layout.extents[1] = (~m).columns();
+   layout.strides[0] = ( SO == rowMajor )?( (~m).spacing() ):( 1UL );
+   layout.strides[1] = ( SO == rowMajor )?( 1UL ):( (~m).spacing() );
+   return layout;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the memory layout of the given contiguous dense tensor.
+// \ingroup dense_tensor
+//
+// \param t The given dense tensor.
+// \return The memory layout of the tensor.
+//
+// The distance between two pages is taken from the tensor itself, which makes this function
+// work for views into larger tensors (as for instance subtensors) as well.
+*/
+template< typename TT >  // Type of the dense tensor
+inline ContractionLayout<3UL> contractionLayout( const DenseTensor<TT>& t ) noexcept
+{
+   ContractionLayout<3UL> layout;
+   layout.extents[0] = (~t).pages();
+   layout.extents[1] = (~t).rows();
+   layout.extents[2] = (~t).columns();
+   layout.strides[0] = ( (~t).pages() > 1UL )
+                       ?( static_cast<size_t>( (~t).data(0UL,1UL) - (~t).data(0UL,0UL) ) )
+                       :( (~t).rows() * (~t).spacing() );
+   layout.strides[1] = (~t).spacing();
+   layout.strides[2] = 1UL;
+   return layout;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the memory layout of the given contiguous dense array.
+// \ingroup dense_tensor
+//
+// \param a The given dense array.
+// \return The memory layout of the array.
+*/
+template< typename AT >  // Type of the dense array
+inline ContractionLayout<AT::num_dimensions> contractionLayout( const DenseArray<AT>& a ) noexcept
+{
+   constexpr size_t N = AT::num_dimensions;
+
+   const auto& dims( (~a).dimensions() );
+
+   ContractionLayout<N> layout;
+   size_t stride( 1UL );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      layout.extents[N-i-1UL] = dims[i];
+      layout.strides[N-i-1UL] = stride;
+      stride *= ( i == 0UL )?( (~a).spacing() ):( dims[i] );
+   }
+
+   return layout;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Folds a group of dimensions into a single strided dimension.
+// \ingroup dense_tensor
+//
+// \param layout The memory layout of the operand.
+// \param axes The group of dimensions, outermost first.
+// \param extent The total extent of the group.
+// \param stride The stride of the folded dimension (0 in case all extents are 1).
+// \return \a true in case the group can be folded, \a false if not.
+*/
+template< size_t R    // Number of dimensions of the operand
+        , size_t G >  // Number of dimensions in the group
+inline bool foldContractionAxes( const ContractionLayout<R>& layout,
+                                 const std::array<size_t,G>& axes,
+                                 size_t& extent, size_t& stride ) noexcept
+{
+   bool folded( true );
+
+   extent = 1UL;
+   stride = 0UL;
+
+   for( size_t t=0UL; t<G; ++t )
+   {
+      const size_t axis( axes[t] );
+
+      extent *= layout.extents[axis];
+
+      if( layout.extents[axis] == 1UL )
+         continue;
+
+      if( stride != 0UL && stride != layout.strides[axis] * layout.extents[axis] )
+         folded = false;
+
+      stride = layout.strides[axis];
+   }
+
+   return folded;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the offsets of all elements of a group of dimensions.
+// \ingroup dense_tensor
+//
+// \param layout The memory layout of the operand.
+// \param axes The group of dimensions, outermost first.
+// \param offsets The resulting offsets in row-major order of the group.
+// \return void
+*/
+template< size_t R    // Number of dimensions of the operand
+        , size_t G >  // Number of dimensions in the group
+inline void contractionOffsets( const ContractionLayout<R>& layout,
+                                const std::array<size_t,G>& axes,
+                                std::vector<size_t>& offsets )
+{
+   std::vector<size_t> tmp;
+
+   offsets.assign( 1UL, 0UL );
+
+   for( size_t t=0UL; t<G; ++t )
+   {
+      const size_t extent( layout.extents[axes[t]] );
+      const size_t stride( layout.strides[axes[t]] );
+
+      tmp.clear();
+      tmp.reserve( offsets.size() * extent );
+
+      for( size_t i=0UL; i<offsets.size(); ++i ) {
+         for( size_t x=0UL; x<extent; ++x ) {
+            tmp.push_back( offsets[i] + x*stride );
+         }
+      }
+
+      std::swap( offsets, tmp );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Interprets an operand as matrix of two groups of its dimensions.
+// \ingroup dense_tensor
+//
+// \param layout The memory layout of the operand.
+// \param rows The dimensions forming the rows of the matrix.
+// \param cols The dimensions forming the columns of the matrix.
+// \return The matrix interpretation of the operand.
+*/
+template< size_t R     // Number of dimensions of the operand
+        , size_t G1    // Number of row dimensions
+        , size_t G2 >  // Number of column dimensions
+inline ContractionFold foldContraction( const ContractionLayout<R>& layout,
+                                        const std::array<size_t,G1>& rows,
+                                        const std::array<size_t,G2>& cols )
+{
+   ContractionFold fold;
+
+   size_t rs, cs;
+   const bool rowsFolded( foldContractionAxes( layout, rows, fold.m, rs ) );
+   const bool colsFolded( foldContractionAxes( layout, cols, fold.n, cs ) );
+
+   fold.viewable = false;
+   fold.rowMajor = true;
+   fold.spacing  = 0UL;
+
+   if( rowsFolded && colsFolded )
+   {
+      if( ( fold.n <= 1UL || cs == 1UL ) && ( fold.m <= 1UL || rs >= fold.n ) ) {
+         fold.viewable = true;
+         fold.rowMajor = true;
+         fold.spacing  = ( fold.m <= 1UL )?( fold.n ):( rs );
+      }
+      else if( ( fold.m <= 1UL || rs == 1UL ) && ( fold.n <= 1UL || cs >= fold.m ) ) {
+         fold.viewable = true;
+         fold.rowMajor = false;
+         fold.spacing  = ( fold.n <= 1UL )?( fold.m ):( cs );
+      }
+   }
+
+   if( !fold.viewable ) {
+      contractionOffsets( layout, rows, fold.rowOffsets );
+      contractionOffsets( layout, cols, fold.colOffsets );
+   }
+
+   return fold;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the dimensions that are not contracted.
+// \ingroup dense_tensor
+//
+// \param axes The contracted dimensions.
+// \param free The remaining dimensions in ascending order.
+// \return void
+// \exception std::invalid_argument Invalid contraction axes.
+*/
+template< size_t R    // Number of dimensions of the operand
+        , size_t K    // Number of contracted dimensions
+        , size_t F >  // Number of remaining dimensions
+inline void contractionFreeAxes( const std::array<size_t,K>& axes, std::array<size_t,F>& free )
+{
+   BLAZE_STATIC_ASSERT( R == K + F );
+
+   std::array<bool,R> contracted{};
+
+   for( size_t t=0UL; t<K; ++t ) {
+      if( axes[t] >= R || contracted[axes[t]] ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid contraction axes" );
+      }
+      contracted[axes[t]] = true;
+   }
+
+   for( size_t r=0UL, f=0UL; r<R; ++r ) {
+      if( !contracted[r] )
+         free[f++] = r;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONTRACTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Stores the product of the two matrix operands of a contraction.
+// \ingroup dense_tensor
+//
+// \param A The left-hand side matrix operand.
+// \param B The right-hand side matrix operand.
+// \param c Pointer to the first element of the result.
+// \param fc The matrix interpretation of the result.
+// \return void
+//
+// In case the result can be viewed as matrix, the product is directly assigned to the result
+// and thus uses the dense matrix/dense matrix multiplication kernels (including BLAS). Otherwise
+// the product is computed into a temporary matrix which is permuted into the result.
+*/
+template< typename MT1  // Type of the left-hand side matrix operand
+        , bool SO1      // Storage order of the left-hand side matrix operand
+        , typename MT2  // Type of the right-hand side matrix operand
+        , bool SO2      // Storage order of the right-hand side matrix operand
+        , typename ET > // Element type of the result
+void contractionKernel( const DenseMatrix<MT1,SO1>& A, const DenseMatrix<MT2,SO2>& B,
+                        ET* c, const ContractionFold& fc )
+{
+   if( fc.viewable && fc.rowMajor ) {
+      CustomMatrix<ET,unaligned,unpadded,rowMajor> C( c, fc.m, fc.n, fc.spacing );
+      C = (~A) * (~B);
+   }
+   else if( fc.viewable ) {
+      CustomMatrix<ET,unaligned,unpadded,columnMajor> C( c, fc.m, fc.n, fc.spacing );
+      C = (~A) * (~B);
+   }
+   else {
+      const DynamicMatrix<ET,rowMajor> C( (~A) * (~B) );
+      for( size_t i=0UL; i<fc.m; ++i ) {
+         ET* row( c + fc.rowOffsets[i] );
+         for( size_t j=0UL; j<fc.n; ++j ) {
+            row[fc.colOffsets[j]] = C(i,j);
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes a contraction for a given left-hand side matrix operand.
+// \ingroup dense_tensor
+//
+// \param A The left-hand side matrix operand.
+// \param b Pointer to the first element of the right-hand side operand.
+// \param fb The matrix interpretation of the right-hand side operand.
+// \param c Pointer to the first element of the result.
+// \param fc The matrix interpretation of the result.
+// \return void
+*/
+template< typename MT1   // Type of the left-hand side matrix operand
+        , bool SO1       // Storage order of the left-hand side matrix operand
+        , typename ET2   // Element type of the right-hand side operand
+        , typename ET3 > // Element type of the result
+void contractionKernel( const DenseMatrix<MT1,SO1>& A, const ET2* b, const ContractionFold& fb,
+                        ET3* c, const ContractionFold& fc )
+{
+   if( fb.viewable && fb.rowMajor ) {
+      const CustomMatrix<const ET2,unaligned,unpadded,rowMajor> B( b, fb.m, fb.n, fb.spacing );
+      contractionKernel( ~A, B, c, fc );
+   }
+   else if( fb.viewable ) {
+      const CustomMatrix<const ET2,unaligned,unpadded,columnMajor> B( b, fb.m, fb.n, fb.spacing );
+      contractionKernel( ~A, B, c, fc );
+   }
+   else {
+      DynamicMatrix<ET2,rowMajor> B( fb.m, fb.n );
+      for( size_t i=0UL; i<fb.m; ++i ) {
+         const ET2* row( b + fb.rowOffsets[i] );
+         for( size_t j=0UL; j<fb.n; ++j ) {
+            B(i,j) = row[fb.colOffsets[j]];
+         }
+      }
+      contractionKernel( ~A, B, c, fc );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes a contraction of two operands given by their matrix interpretation.
+// \ingroup dense_tensor
+//
+// \param a Pointer to the first element of the left-hand side operand.
+// \param fa The matrix interpretation of the left-hand side operand.
+// \param b Pointer to the first element of the right-hand side operand.
+// \param fb The matrix interpretation of the right-hand side operand.
+// \param c Pointer to the first element of the result.
+// \param fc The matrix interpretation of the result.
+// \return void
+//
+// Operands whose strides permit it are used in-place via unpadded custom matrices, all other
+// operands are permuted into a temporary row-major matrix before the multiplication.
+*/
+template< typename ET1   // Element type of the left-hand side operand
+        , typename ET2   // Element type of the right-hand side operand
+        , typename ET3 > // Element type of the result
+void contractionKernel( const ET1* a, const ContractionFold& fa,
+                        const ET2* b, const ContractionFold& fb,
+                        ET3* c, const ContractionFold& fc )
+{
+   if( fa.viewable && fa.rowMajor ) {
+      const CustomMatrix<const ET1,unaligned,unpadded,rowMajor> A( a, fa.m, fa.n, fa.spacing );
+      contractionKernel( A, b, fb, c, fc );
+   }
+   else if( fa.viewable ) {
+      const CustomMatrix<const ET1,unaligned,unpadded,columnMajor> A( a, fa.m, fa.n, fa.spacing );
+      contractionKernel( A, b, fb, c, fc );
+   }
+   else {
+      DynamicMatrix<ET1,rowMajor> A( fa.m, fa.n );
+      for( size_t i=0UL; i<fa.m; ++i ) {
+         const ET1* row( a + fa.rowOffsets[i] );
+         for( size_t j=0UL; j<fa.n; ++j ) {
+            A(i,j) = row[fa.colOffsets[j]];
+         }
+      }
+      contractionKernel( A, b, fb, c, fc );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Contraction of two dense operands over the given pairs of dimensions.
+// \ingroup dense_tensor
+//
+// \param a The left-hand side dense vector, matrix, tensor or array.
+// \param b The right-hand side dense vector, matrix, tensor or array.
+// \param axesA The contracted dimensions of the left-hand side operand.
+// \param axesB The contracted dimensions of the right-hand side operand.
+// \return The result of the contraction.
+// \exception std::invalid_argument Invalid contraction axes.
+// \exception std::invalid_argument Contraction extents do not match.
+//
+// This function sums the products of the elements of \a a and \a b over the dimensions
+// \a axesA[t] of \a a and \a axesB[t] of \a b (see numpy.tensordot()). The dimensions of the
+// result are the remaining dimensions of \a a followed by the remaining dimensions of \a b,
+// each in their original order. Depending on the number of remaining dimensions the result
+// is a DynamicVector, a DynamicMatrix, a DynamicTensor or a DynamicArray:
+
+   \code
+   blaze::DynamicTensor<double> A( 4UL, 5UL, 6UL );
+   blaze::DynamicMatrix<double> B( 5UL, 7UL );
+   // ... Initialization
+
+   // C(i,l,k) = sum_j A(i,j,k) * B(j,l)
+   blaze::DynamicTensor<double> C =
+      tensordot( A, B, std::array<size_t,1UL>{ 1UL }, std::array<size_t,1UL>{ 0UL } );
+   \endcode
+
+// The contraction is mapped to a single dense matrix/dense matrix multiplication, which uses
+// the optimized (and if enabled BLAS) matrix kernels. Whenever the memory layout of an operand
+// already matches the required matrix layout, the operand is used in-place. Only operands that
+// require a permutation of their dimensions are copied into a temporary matrix.
+*/
+template< size_t K       // Number of contracted dimensions
+        , typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+inline decltype(auto)
+   tensordot( const T1& a, const T2& b,
+              const std::array<size_t,K>& axesA, const std::array<size_t,K>& axesB )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   constexpr size_t RA = ContractionRank<T1>::value;
+   constexpr size_t RB = ContractionRank<T2>::value;
+
+   BLAZE_STATIC_ASSERT_MSG( RA > 0UL && RB > 0UL, "Invalid contraction operand detected" );
+   BLAZE_STATIC_ASSERT_MSG( K <= RA && K <= RB, "Invalid number of contracted dimensions" );
+   BLAZE_STATIC_ASSERT_MSG( RA + RB > 2UL*K, "Full contraction to a scalar detected" );
+
+   constexpr size_t RC = RA + RB - 2UL*K;
+
+   using ET1 = ElementType_t<T1>;
+   using ET2 = ElementType_t<T2>;
+   using RT  = ContractionResult< RC, MultTrait_t<ET1,ET2> >;
+
+   ContractionOperand_t<T1> A( a );
+   ContractionOperand_t<T2> B( b );
+
+   const ContractionLayout<RA> la( contractionLayout( A ) );
+   const ContractionLayout<RB> lb( contractionLayout( B ) );
+
+   std::array<size_t,RA-K> freeA;
+   std::array<size_t,RB-K> freeB;
+
+   contractionFreeAxes<RA>( axesA, freeA );
+   contractionFreeAxes<RB>( axesB, freeB );
+
+   for( size_t t=0UL; t<K; ++t ) {
+      if( la.extents[axesA[t]] != lb.extents[axesB[t]] ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Contraction extents do not match" );
+      }
+   }
+
+   std::array<size_t,RC> extents;
+   std::array<size_t,RA-K> rowsC;
+   std::array<size_t,RB-K> colsC;
+
+   for( size_t i=0UL; i<RA-K; ++i ) {
+      extents[i] = la.extents[freeA[i]];
+      rowsC[i] = i;
+   }
+   for( size_t j=0UL; j<RB-K; ++j ) {
+      extents[RA-K+j] = lb.extents[freeB[j]];
+      colsC[j] = RA-K+j;
+   }
+
+   typename RT::Type result( RT::create( extents ) );
+
+   const ContractionFold fa( foldContraction( la, freeA, axesA ) );
+   const ContractionFold fb( foldContraction( lb, axesB, freeB ) );
+   const ContractionFold fc( foldContraction( contractionLayout( result ), rowsC, colsC ) );
+
+   if( fc.m == 0UL || fc.n == 0UL ) {
+      return result;
+   }
+
+   if( fa.n == 0UL ) {
+      reset( result );
+      return result;
+   }
+
+   contractionKernel( A.data(), fa, B.data(), fb, result.data(), fc );
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Contraction of the last \a K dimensions of \a a with the first \a K dimensions of \a b.
+// \ingroup dense_tensor
+//
+// \param a The left-hand side dense vector, matrix, tensor or array.
+// \param b The right-hand side dense vector, matrix, tensor or array.
+// \return The result of the contraction.
+// \exception std::invalid_argument Contraction extents do not match.
+//
+// This function is the equivalent of numpy.tensordot( a, b, axes=K ):
+
+   \code
+   blaze::DynamicTensor<double> A( 4UL, 5UL, 6UL );
+   blaze::DynamicMatrix<double> B( 6UL, 7UL );
+   // ... Initialization
+
+   // C(i,j,l) = sum_k A(i,j,k) * B(k,l)
+   blaze::DynamicTensor<double> C = tensordot<1UL>( A, B );
+   \endcode
+*/
+template< size_t K       // Number of contracted dimensions
+        , typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+inline decltype(auto) tensordot( const T1& a, const T2& b )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   constexpr size_t RA = ContractionRank<T1>::value;
+
+   BLAZE_STATIC_ASSERT_MSG( K <= RA, "Invalid number of contracted dimensions" );
+
+   std::array<size_t,K> axesA;
+   std::array<size_t,K> axesB;
+
+   for( size_t t=0UL; t<K; ++t ) {
+      axesA[t] = RA - K + t;
+      axesB[t] = t;
+   }
+
+   return tensordot( a, b, axesA, axesB );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Splits an einsum specification into the labels of the operands and the result.
+// \ingroup dense_tensor
+//
+// \param spec The einsum specification (e.g. "ijk,kl->ijl").
+// \param la The labels of the left-hand side operand.
+// \param lb The labels of the right-hand side operand.
+// \param lc The labels of the result.
+// \return void
+// \exception std::invalid_argument Invalid einsum specification.
+//
+// In case the specification does not contain an explicit result ("->"), the result consists
+// of all labels that occur exactly once, in alphabetical order.
+*/
+inline void parseEinsum( const std::string& spec,
+                         std::string& la, std::string& lb, std::string& lc )
+{
+   std::string s;
+   for( char ch : spec ) {
+      if( !std::isspace( static_cast<unsigned char>( ch ) ) )
+         s.push_back( ch );
+   }
+
+   const size_t arrow( s.find( "->" ) );
+   const std::string inputs( s.substr( 0UL, arrow ) );
+   const size_t comma( inputs.find( ',' ) );
+
+   if( comma == std::string::npos || inputs.find( ',', comma+1UL ) != std::string::npos ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid einsum specification" );
+   }
+
+   la = inputs.substr( 0UL, comma );
+   lb = inputs.substr( comma+1UL );
+
+   if( arrow != std::string::npos ) {
+      lc = s.substr( arrow+2UL );
+   }
+   else {
+      const std::string labels( la + lb );
+      lc.clear();
+      for( char ch : labels ) {
+         if( std::count( labels.begin(), labels.end(), ch ) == 1 )
+            lc.push_back( ch );
+      }
+      std::sort( lc.begin(), lc.end() );
+   }
+
+   for( char ch : la + lb + lc ) {
+      if( !std::isalpha( static_cast<unsigned char>( ch ) ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid einsum specification" );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assigns the permutation of a three-dimensional contraction result.
+// \ingroup dense_tensor
+//
+// \param tmp The contraction result in natural order.
+// \param perm The permutation of the dimensions.
+// \param c The target of the assignment.
+// \return void
+*/
+template< typename TT    // Type of the contraction result
+        , typename T3 >  // Type of the target
+inline void einsumPermute( const TT& tmp, const std::array<size_t,3UL>& perm, T3& c, TrueType )
+{
+   c = trans( tmp, perm.data(), perm.size() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assigns the permutation of an N-dimensional contraction result.
+// \ingroup dense_tensor
+//
+// \param tmp The contraction result in natural order.
+// \param perm The permutation of the dimensions.
+// \param c The target of the assignment.
+// \return void
+*/
+template< typename AT    // Type of the contraction result
+        , size_t R       // Number of dimensions of the contraction result
+        , typename T3 >  // Type of the target
+inline void einsumPermute( const AT& tmp, const std::array<size_t,R>& perm, T3& c, FalseType )
+{
+   using RT = ContractionResult< R, ElementType_t<AT> >;
+
+   const ContractionLayout<R> ls( contractionLayout( tmp ) );
+
+   std::array<size_t,R> extents;
+   for( size_t d=0UL; d<R; ++d ) {
+      extents[d] = ls.extents[perm[d]];
+   }
+
+   typename RT::Type result( RT::create( extents ) );
+
+   const ContractionLayout<R> lr( contractionLayout( result ) );
+
+   std::array<size_t,R-1UL> rowsS;
+   std::array<size_t,R-1UL> rowsR;
+   for( size_t d=0UL; d<R-1UL; ++d ) {
+      rowsS[d] = perm[d];
+      rowsR[d] = d;
+   }
+
+   std::vector<size_t> offsetsS, offsetsR;
+   contractionOffsets( ls, rowsS, offsetsS );
+   contractionOffsets( lr, rowsR, offsetsR );
+
+   const size_t n ( extents[R-1UL] );
+   const size_t ss( ls.strides[perm[R-1UL]] );
+   const size_t sr( lr.strides[R-1UL] );
+
+   for( size_t i=0UL; i<offsetsR.size(); ++i ) {
+      const auto* src( tmp.data() + offsetsS[i] );
+      auto* dst( result.data() + offsetsR[i] );
+      for( size_t j=0UL; j<n; ++j ) {
+         dst[j*sr] = src[j*ss];
+      }
+   }
+
+   c = std::move( result );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Einstein summation of two dense operands.
+// \ingroup dense_tensor
+//
+// \param spec The einsum specification (e.g. "ijk,kl->ijl").
+// \param a The left-hand side dense vector, matrix, tensor or array.
+// \param b The right-hand side dense vector, matrix, tensor or array.
+// \param c The target of the result.
+// \return void
+// \exception std::invalid_argument Invalid einsum specification.
+// \exception std::invalid_argument Contraction extents do not match.
+//
+// This function evaluates the given einsum specification for the two operands \a a and \a b
+// and assigns the result to \a c. Every label has to be used at most once per operand. Labels
+// that occur in both operands are contracted; all other labels have to occur in the result.
+// Without an explicit result ("->") the result consists of the labels that occur only once,
+// in alphabetical order (see numpy.einsum()):
+
+   \code
+   blaze::DynamicTensor<double> A( 4UL, 5UL, 6UL );
+   blaze::DynamicMatrix<double> B( 6UL, 7UL );
+   blaze::DynamicTensor<double> C;
+   // ... Initialization
+
+   einsum( "ijk,kl->ijl", A, B, C );  // C(i,j,l) = sum_k A(i,j,k) * B(k,l)
+   einsum( "ijk,kl->lij", A, B, C );  // C(l,i,j) = sum_k A(i,j,k) * B(k,l)
+   \endcode
+
+// The contraction is computed by means of tensordot(). Results that require a different order
+// of the dimensions are either computed with swapped operands or permuted by means of trans().
+// Labels that occur in both operands and the result (batch dimensions) as well as repeated
+// labels within an operand (traces) are not supported.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2    // Type of the right-hand side operand
+        , typename T3 >  // Type of the target
+inline void einsum( const std::string& spec, const T1& a, const T2& b, T3& c )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   constexpr size_t RA = ContractionRank<T1>::value;
+   constexpr size_t RB = ContractionRank<T2>::value;
+   constexpr size_t RC = ContractionRank<T3>::value;
+
+   BLAZE_STATIC_ASSERT_MSG( RA > 0UL && RB > 0UL && RC > 0UL, "Invalid einsum operand detected" );
+   BLAZE_STATIC_ASSERT_MSG( RA + RB >= RC && ( RA + RB - RC ) % 2UL == 0UL,
+                            "Invalid einsum operand detected" );
+
+   constexpr size_t K = ( RA + RB - RC ) / 2UL;
+
+   std::string la, lb, lc;
+   parseEinsum( spec, la, lb, lc );
+
+   if( la.size() != RA || lb.size() != RB || lc.size() != RC ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid einsum specification" );
+   }
+
+   std::array<size_t,K> axesA;
+   std::array<size_t,K> axesB;
+   std::string labels;
+   size_t k( 0UL );
+
+   for( size_t i=0UL; i<RA; ++i )
+   {
+      const size_t j( lb.find( la[i] ) );
+
+      if( la.find( la[i] ) != i ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid einsum specification" );
+      }
+
+      if( j == std::string::npos ) {
+         labels.push_back( la[i] );
+      }
+      else if( lc.find( la[i] ) != std::string::npos || k == K ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid einsum specification" );
+      }
+      else {
+         axesA[k] = i;
+         axesB[k] = j;
+         ++k;
+      }
+   }
+
+   for( size_t j=0UL; j<RB; ++j )
+   {
+      if( lb.find( lb[j] ) != j ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid einsum specification" );
+      }
+
+      if( la.find( lb[j] ) == std::string::npos ) {
+         labels.push_back( lb[j] );
+      }
+   }
+
+   if( k != K ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid einsum specification" );
+   }
+
+   std::array<size_t,RC> perm;
+   bool natural( true ), swapped( true );
+
+   for( size_t d=0UL; d<RC; ++d )
+   {
+      const size_t pos( labels.find( lc[d] ) );
+
+      if( pos == std::string::npos || lc.find( lc[d] ) != d ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid einsum specification" );
+      }
+
+      perm[d] = pos;
+      natural = natural && ( pos == d );
+      swapped = swapped && ( pos == ( d + RA - K ) % RC );
+   }
+
+   if( natural ) {
+      c = tensordot( a, b, axesA, axesB );
+   }
+   else if( swapped ) {
+      c = tensordot( b, a, axesB, axesA );
+   }
+   else {
+      einsumPermute( tensordot( a, b, axesA, axesB ), perm, c, BoolConstant< RC == 3UL >() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
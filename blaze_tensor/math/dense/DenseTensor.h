@@ -41,8 +41,23 @@
 // Includes
 //*************************************************************************************************
 
+#include <cmath>
 #include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/TransposeFlag.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DVecDVecAddExpr.h>
+#include <blaze/math/expressions/DVecDVecDivExpr.h>
+#include <blaze/math/expressions/DVecDVecMapExpr.h>
+#include <blaze/math/expressions/DVecDVecSubExpr.h>
+#include <blaze/math/expressions/DVecMapExpr.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
+#include <blaze/math/functors/Bind2nd.h>
+#include <blaze/math/functors/Sub.h>
 #include <blaze/math/shims/Equal.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/IsNaN.h>
@@ -51,14 +66,17 @@
 #include <blaze/math/shims/IsZero.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsRestricted.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/StaticAssert.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 
+#include <blaze_tensor/math/ReductionFlag.h>
 #include <blaze_tensor/math/expressions/DTensDTensAddExpr.h>
 #include <blaze_tensor/math/expressions/DTensDTensEqualExpr.h>
 #include <blaze_tensor/math/expressions/DTensDTensMapExpr.h>
@@ -73,6 +91,8 @@
 #include <blaze_tensor/math/expressions/DTensScalarMultExpr.h>
 #include <blaze_tensor/math/expressions/DTensSerialExpr.h>
 #include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/system/Thresholds.h>
 
 namespace blaze {
 
@@ -388,6 +408,15 @@ bool isUniform( const DenseTensor<MT>& dm );
 
 template< typename MT >
 auto softmax( const DenseTensor<MT>& dm );
+
+template< size_t RF, typename TT >
+auto softmax( const DenseTensor<TT>& dt );
+
+template< typename TT >
+auto logsoftmax( const DenseTensor<TT>& dt );
+
+template< size_t RF, typename TT >
+auto logsoftmax( const DenseTensor<TT>& dt );
 //@}
 //*************************************************************************************************
 
@@ -440,18 +469,314 @@ bool isnan( const DenseTensor<TT>& dm )
 //
 // This function computes the softmax function (i.e. the normalized exponential function) for
 // the given dense tensor \a dm (see also https://en.wikipedia.org/wiki/Softmax_function). The
-// resulting dense tensor consists of real values in the range (0..1], which add up to 1.
+// resulting dense tensor consists of real values in the range (0..1], which add up to 1. In
+// order to avoid overflow for large elements, the maximum element is subtracted from all
+// elements before the exponential function is applied.
 */
 template< typename MT > // Type of the dense tensor
 auto softmax( const DenseTensor<MT>& dm )
 {
-   auto tmp( evaluate( exp( ~dm ) ) );
+   const auto mx( max( ~dm ) );
+   auto tmp( evaluate( exp( map( ~dm, bind2nd( Sub(), mx ) ) ) ) );
    const auto scalar( sum( ~tmp ) );
    tmp /= scalar;
    return tmp;
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the rowwise softmax and log-softmax functions for dense tensors.
+// \ingroup dense_tensor
+//
+// \param A The evaluated dense tensor to be normalized in-place.
+// \return void
+//
+// This function normalizes each row of the given dense tensor in-place. Since every row is
+// stored contiguously, the maximum, the sum of exponentials and the normalization are computed
+// by vectorized kernels while the row remains in cache. In case SMP parallelization is enabled,
+// the rows are distributed among the available threads (see smpFor()).
+*/
+template< bool LOG       // Log-softmax flag
+        , typename TT >  // Type of the dense tensor
+void softmaxRowwise_backend( TT& A )
+{
+   using ET      = ElementType_t<TT>;
+   using RowType = CustomVector<ET,unaligned,unpadded,rowVector>;
+
+   using std::log;
+
+   const size_t M( A.rows()    );
+   const size_t N( A.columns() );
+   const size_t fibers( A.pages() * M );
+   const bool parallel( !isSerialSectionActive() && fibers*N >= SMP_DTENSREDUCE_THRESHOLD );
+
+   smpFor( fibers, parallel, [&]( size_t begin, size_t end )
+   {
+      for( size_t f=begin; f<end; ++f )
+      {
+         RowType x( A.data( f % M, f / M ), N );
+         const ET mx( max( x ) );
+
+         if( LOG ) {
+            const ET lse( mx + log( sum( exp( map( x, bind2nd( Sub(), mx ) ) ) ) ) );
+            assign( x, map( x, bind2nd( Sub(), lse ) ) );
+         }
+         else {
+            assign( x, exp( map( x, bind2nd( Sub(), mx ) ) ) );
+            assign( x, x / sum( x ) );
+         }
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the columnwise and pagewise softmax and log-softmax functions.
+// \ingroup dense_tensor
+//
+// \param count The number of rows to be normalized against each other.
+// \param rowAt Accessor returning a pointer to the first element of the given row.
+// \param mx Buffer for the running maximum, sized to the number of columns of the rows.
+// \param s Buffer for the sum of exponentials, sized to the number of columns of the rows.
+// \return void
+//
+// This function normalizes the elements at the same column index across \a count contiguous
+// rows, i.e. it reduces along the rows of a page slice (columnwise) or along the pages of a
+// row slice (pagewise). The running maximum and the sum of exponentials are kept in the two
+// given buffers, such that all passes run as vectorized row kernels. The buffers are provided
+// by the caller in order to reuse them for all slices processed by the same thread.
+*/
+template< bool LOG            // Log-softmax flag
+        , typename ET         // Element type of the dense tensor
+        , typename Accessor > // Type of the row accessor
+void softmaxAcrossRows_backend( size_t count, Accessor rowAt,
+                                DynamicVector<ET,rowVector>& mx, DynamicVector<ET,rowVector>& s )
+{
+   using RowType = CustomVector<ET,unaligned,unpadded,rowVector>;
+
+   using std::log;
+
+   const size_t N( mx.size() );
+
+   assign( mx, RowType( rowAt( 0UL ), N ) );
+   reset( s );
+
+   for( size_t r=1UL; r<count; ++r ) {
+      assign( mx, max( mx, RowType( rowAt( r ), N ) ) );
+   }
+
+   for( size_t r=0UL; r<count; ++r ) {
+      RowType x( rowAt( r ), N );
+      if( LOG ) {
+         addAssign( s, exp( x - mx ) );
+      }
+      else {
+         assign( x, exp( x - mx ) );
+         addAssign( s, x );
+      }
+   }
+
+   if( LOG ) {
+      assign( s, mx + log( s ) );
+   }
+
+   for( size_t r=0UL; r<count; ++r ) {
+      RowType x( rowAt( r ), N );
+      if( LOG ) subAssign( x, s );
+      else      divAssign( x, s );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the columnwise softmax and log-softmax functions for dense tensors.
+// \ingroup dense_tensor
+//
+// \param A The evaluated dense tensor to be normalized in-place.
+// \return void
+*/
+template< bool LOG       // Log-softmax flag
+        , typename TT >  // Type of the dense tensor
+void softmaxColumnwise_backend( TT& A )
+{
+   using ET = ElementType_t<TT>;
+
+   const size_t O( A.pages() );
+   const bool parallel( !isSerialSectionActive() &&
+                        O*A.rows()*A.columns() >= SMP_DTENSREDUCE_THRESHOLD );
+
+   smpFor( O, parallel, [&]( size_t begin, size_t end )
+   {
+      DynamicVector<ET,rowVector> mx( A.columns() ), s( A.columns() );
+
+      for( size_t k=begin; k<end; ++k ) {
+         softmaxAcrossRows_backend<LOG>( A.rows(), [&A,k]( size_t i ) { return A.data( i, k ); },
+                                         mx, s );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the pagewise softmax and log-softmax functions for dense tensors.
+// \ingroup dense_tensor
+//
+// \param A The evaluated dense tensor to be normalized in-place.
+// \return void
+*/
+template< bool LOG       // Log-softmax flag
+        , typename TT >  // Type of the dense tensor
+void softmaxPagewise_backend( TT& A )
+{
+   using ET = ElementType_t<TT>;
+
+   const size_t M( A.rows() );
+   const bool parallel( !isSerialSectionActive() &&
+                        M*A.pages()*A.columns() >= SMP_DTENSREDUCE_THRESHOLD );
+
+   smpFor( M, parallel, [&]( size_t begin, size_t end )
+   {
+      DynamicVector<ET,rowVector> mx( A.columns() ), s( A.columns() );
+
+      for( size_t i=begin; i<end; ++i ) {
+         softmaxAcrossRows_backend<LOG>( A.pages(), [&A,i]( size_t k ) { return A.data( i, k ); },
+                                         mx, s );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the softmax and log-softmax functions along a single tensor axis.
+// \ingroup dense_tensor
+//
+// \param dt The given dense tensor for the softmax computation.
+// \return The resulting tensor.
+*/
+template< size_t RF      // Reduction flag
+        , bool LOG       // Log-softmax flag
+        , typename TT >  // Type of the dense tensor
+auto softmax_backend( const DenseTensor<TT>& dt )
+{
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   ResultType_t<TT> tmp( ~dt );
+
+   if( tmp.pages() == 0UL || tmp.rows() == 0UL || tmp.columns() == 0UL )
+      return tmp;
+
+   if( RF == rowwise )
+      softmaxRowwise_backend<LOG>( tmp );
+   else if( RF == columnwise )
+      softmaxColumnwise_backend<LOG>( tmp );
+   else
+      softmaxPagewise_backend<LOG>( tmp );
+
+   return tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the softmax function along the given axis of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dt The given dense tensor for the softmax computation.
+// \return The resulting tensor.
+//
+// This function computes the softmax function (i.e. the normalized exponential function) along
+// one axis of the given dense tensor \a dt (see also
+// https://en.wikipedia.org/wiki/Softmax_function).
+// In case the reduction flag \a RF is set to \a blaze::rowwise, the elements of each row add up
+// to 1, in case \a RF is set to \a blaze::columnwise, the elements of each column add up to 1,
+// and in case \a RF is set to \a blaze::pagewise, the elements along each page fiber add up to 1:
+
+   \code
+   blaze::DynamicTensor<double> A( 4UL, 5UL, 6UL ), B;
+   // ... Initialization
+
+   B = softmax<rowwise>( A );     // sum( row( pageslice( B, k ), i ) ) == 1
+   B = softmax<columnwise>( A );  // sum( column( pageslice( B, k ), j ) ) == 1
+   B = softmax<pagewise>( A );    // sum( column( rowslice( B, i ), k ) ) == 1 for all (i,j)
+   \endcode
+
+// Per row the maximum element is subtracted before the exponential function is applied, which
+// guarantees that no overflow occurs. The result is computed in a single result tensor without
+// any further full-size temporaries.
+*/
+template< size_t RF      // Reduction flag
+        , typename TT >  // Type of the dense tensor
+auto softmax( const DenseTensor<TT>& dt )
+{
+   return softmax_backend<RF,false>( ~dt );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the logarithm of the softmax function for the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dt The given dense tensor for the log-softmax computation.
+// \return The resulting tensor.
+//
+// This function computes the logarithm of the softmax function for the given dense tensor
+// \a dt, i.e. \f$ x_i - \log(\sum_j e^{x_j}) \f$. The log-sum-exp term is computed with the
+// maximum element subtracted, which avoids both overflow and the loss of precision that results
+// from taking the logarithm of very small softmax values.
+*/
+template< typename TT > // Type of the dense tensor
+auto logsoftmax( const DenseTensor<TT>& dt )
+{
+   using std::log;
+
+   ResultType_t<TT> tmp( ~dt );
+
+   if( tmp.pages() == 0UL || tmp.rows() == 0UL || tmp.columns() == 0UL )
+      return tmp;
+
+   const auto mx( max( tmp ) );
+   const auto lse( mx + log( sum( exp( map( tmp, bind2nd( Sub(), mx ) ) ) ) ) );
+   tmp = map( tmp, bind2nd( Sub(), lse ) );
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the logarithm of the softmax function along the given axis of the given tensor.
+// \ingroup dense_tensor
+//
+// \param dt The given dense tensor for the log-softmax computation.
+// \return The resulting tensor.
+//
+// This function computes the logarithm of the softmax function along the axis specified by
+// the reduction flag \a RF (\a blaze::rowwise, \a blaze::columnwise or \a blaze::pagewise). See
+// the rowwise, columnwise and pagewise softmax() function for the meaning of the flag.
+*/
+template< size_t RF      // Reduction flag
+        , typename TT >  // Type of the dense tensor
+auto logsoftmax( const DenseTensor<TT>& dt )
+{
+   return softmax_backend<RF,true>( ~dt );
+}
+//*************************************************************************************************
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Checks if the given row-major general dense tensor is a uniform tensor.
@@ -44,6 +44,7 @@
 #include <array>
 
 #include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/shims/Conjugate.h>
 #include <blaze/math/traits/DivTrait.h>
 #include <blaze/math/traits/ExpandTrait.h>
 #include <blaze/math/traits/MapTrait.h>
@@ -54,12 +55,14 @@
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsShrinkable.h>
+#include <blaze/system/Blocking.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/IntegerSequence.h>
 #include <blaze/util/StaticAssert.h>
 
 #include <blaze_tensor/math/Array.h>
+#include <blaze_tensor/config/Arena.h>
 #include <blaze_tensor/math/Forward.h>
 #include <blaze_tensor/math/InitFromValue.h>
 #include <blaze_tensor/math/InitializerList.h>
@@ -68,10 +71,14 @@
 #include <blaze_tensor/math/dense/Transposition.h>
 #include <blaze_tensor/math/expressions/DenseArray.h>
 #include <blaze_tensor/math/traits/QuatSliceTrait.h>
+#include <blaze_tensor/math/traits/TemporaryTrait.h>
 #include <blaze_tensor/math/typetraits/IsNdArray.h>
 #include <blaze_tensor/math/typetraits/IsDenseArray.h>
 #include <blaze_tensor/math/typetraits/IsRowMajorArray.h>
+#include <blaze_tensor/system/Thresholds.h>
+#include <blaze_tensor/util/ArenaAllocator.h>
 #include <blaze_tensor/util/ArrayForEach.h>
+#include <blaze_tensor/util/Memory.h>
 
 namespace blaze {
 
@@ -93,12 +100,17 @@ namespace blaze {
 // and the storage order of the array can be specified via the two template parameters:
 
    \code
-   template< typename Type >
+   template< size_t N, typename Type, typename Alloc >
    class DynamicArray;
    \endcode
 
-//  - Type: specifies the type of the array elements. DynamicArray can be used with any
-//          non-cv-qualified, non-reference, non-pointer element type.
+//  - N    : specifies the number of dimensions of the array.
+//  - Type : specifies the type of the array elements. DynamicArray can be used with any
+//           non-cv-qualified, non-reference, non-pointer element type.
+//  - Alloc: specifies the type of the allocator used for the array elements. The allocator has
+//           to be default constructible and stateless, i.e. any two instances have to be able
+//           to deallocate memory allocated by the other. The default is AlignedAllocator<Type>.
+//           See ArenaAllocator for a thread-local arena allocator for temporary arrays.
 //
 // The use of DynamicArray is very natural and intuitive. All operations (addition, subtraction,
 // multiplication, scaling, ...) can be performed on all possible combinations of matrices with
@@ -135,9 +147,11 @@ namespace blaze {
    F *= A * D;    // Multiplication assignment
    \endcode
 */
-template< size_t N, typename Type >                   // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 class DynamicArray
-   : public DenseArray< DynamicArray<N, Type> >
+   : public DenseArray< DynamicArray<N, Type, Alloc> >
 {
  private:
    //**********************************************************************************************
@@ -147,11 +161,11 @@ class DynamicArray
 
  public:
    //**Type definitions****************************************************************************
-   using This          = DynamicArray<N, Type>;     //!< Type of this DynamicArray instance.
+   using This          = DynamicArray<N, Type, Alloc>;     //!< Type of this DynamicArray instance.
    using BaseType      = DenseArray<This>;          //!< Base type of this DynamicArray instance.
    using ResultType    = This;                      //!< Result type for expression template evaluations.
-   using OppositeType  = DynamicArray<N, Type>;     //!< Result type with opposite storage order for expression template evaluations.
-   using TransposeType = DynamicArray<N, Type>;     //!< Transpose type for expression template evaluations.
+   using OppositeType  = DynamicArray<N, Type, Alloc>;     //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = DynamicArray<N, Type, Alloc>;     //!< Transpose type for expression template evaluations.
    using ElementType   = Type;                      //!< Type of the array elements.
    using SIMDType      = SIMDTrait_t<ElementType>;  //!< SIMD type of the array elements.
    using ReturnType    = const Type&;               //!< Return type for expression template evaluations.
@@ -171,7 +185,8 @@ class DynamicArray
    */
    template< typename NewType >  // Data type of the other array
    struct Rebind {
-      using Other = DynamicArray<N, NewType>;  //!< The type of the other DynamicArray.
+      //! The type of the other DynamicArray.
+      using Other = DynamicArray< N, NewType, typename std::allocator_traits<Alloc>::template rebind_alloc<NewType> >;
    };
    //**********************************************************************************************
 
@@ -181,7 +196,7 @@ class DynamicArray
 //    template< size_t... NewDims >  // Dimensions of the other array
 //    struct Resize {
 //       BLAZE_STATIC_ASSERT_MSG(N == sizeof...(NewDims), "incompatible dimensionality of other array");
-//       using Other = DynamicArray<N, Type>;  //!< The type of the other DynamicArray.
+//       using Other = DynamicArray<N, Type, Alloc>;  //!< The type of the other DynamicArray.
 //    };
    //**********************************************************************************************
 
@@ -451,28 +466,28 @@ class DynamicArray
    BLAZE_ALWAYS_INLINE void stream( const SIMDType& value, Dims... dims ) noexcept;
 
    template< typename MT >
-   inline auto assign( const DenseArray<MT>& rhs ) /*-> EnableIf_t< !VectorizedAssign_v<MT> >*/;
+   inline auto assign( const DenseArray<MT>& rhs ) -> EnableIf_t< !VectorizedAssign_v<MT> >;
 
-   //template< typename MT >
-   //inline auto assign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT> >;
+   template< typename MT >
+   inline auto assign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT> >;
 
    template< typename MT >
-   inline auto addAssign( const DenseArray<MT>& rhs ) /*-> EnableIf_t< !VectorizedAddAssign_v<MT> >*/;
+   inline auto addAssign( const DenseArray<MT>& rhs ) -> EnableIf_t< !VectorizedAddAssign_v<MT> >;
 
-   //template< typename MT >
-   //inline auto addAssign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<MT> >;
+   template< typename MT >
+   inline auto addAssign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<MT> >;
 
    template< typename MT >
-   inline auto subAssign( const DenseArray<MT>& rhs ) /*-> EnableIf_t< !VectorizedSubAssign_v<MT> >*/;
+   inline auto subAssign( const DenseArray<MT>& rhs ) -> EnableIf_t< !VectorizedSubAssign_v<MT> >;
 
-   //template< typename MT >
-   //inline auto subAssign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<MT> >;
+   template< typename MT >
+   inline auto subAssign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<MT> >;
 
    template< typename MT >
-   inline auto schurAssign( const DenseArray<MT>& rhs ) /*-> EnableIf_t< !VectorizedSchurAssign_v<MT> >*/;
+   inline auto schurAssign( const DenseArray<MT>& rhs ) -> EnableIf_t< !VectorizedSchurAssign_v<MT> >;
 
-   //template< typename MT >
-   //inline auto schurAssign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedSchurAssign_v<MT> >;
+   template< typename MT >
+   inline auto schurAssign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedSchurAssign_v<MT> >;
    //@}
    //**********************************************************************************************
 
@@ -483,12 +498,18 @@ class DynamicArray
    template< typename... Dims >
    inline static std::array< size_t, N > initDimensions( Dims... dims ) noexcept;
    inline static size_t addPadding( size_t value ) noexcept;
+   inline static Type* allocateStorage( size_t n );
+   inline static void deallocateStorage( Type* ptr, size_t n ) noexcept;
    inline size_t calcCapacity() const noexcept;
    template< typename... Dims >
    inline size_t index( Dims... dims ) const noexcept;
    inline size_t index( std::array< size_t, N > const& indices ) const noexcept;
    template< typename... Dims >
    inline size_t row_index( size_t i, Dims... subdims ) const noexcept;
+   template< typename T >
+   inline bool transposeInPlace( const T* indices );
+   template< typename T, typename OP >
+   inline DynamicArray permuted( const T* indices, OP op ) const;
    //@}
    //**********************************************************************************************
 
@@ -525,9 +546,10 @@ class DynamicArray
 //*************************************************************************************************
 /*!\brief The default constructor for DynamicArray.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type > // Data type of the array
-inline DynamicArray<N, Type>::DynamicArray() noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline DynamicArray<N, Type, Alloc>::DynamicArray() noexcept
    : dims_    (  )         // The current dimensions of the array
    , nn_      ( 0UL )      // The length of a padded row
    , capacity_( 0UL )      // The maximum capacity of the array
@@ -545,14 +567,15 @@ inline DynamicArray<N, Type>::DynamicArray() noexcept
 // \note This constructor is only responsible to allocate the required dynamic memory. No
 // element initialization is performed!
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type > // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims, typename Enable >
-inline DynamicArray< N, Type >::DynamicArray( size_t dim0, Dims... dims )
+inline DynamicArray<N, Type, Alloc>::DynamicArray( size_t dim0, Dims... dims )
    : dims_    ( initDimensions( dim0, dims... ) )   // The current dimensions of the array
    , nn_      ( addPadding( dims_[0] ) )  // The length of a padded row
    , capacity_( calcCapacity() )          // The maximum capacity of the array
-   , v_( allocate< Type >( capacity_ ) )  // The array elements
+   , v_( allocateStorage( capacity_ ) )  // The array elements
 {
    BLAZE_STATIC_ASSERT( N - 1 == sizeof...( dims ) );
 
@@ -574,10 +597,11 @@ inline DynamicArray< N, Type >::DynamicArray( size_t dim0, Dims... dims )
 //
 // All array elements are initialized with the specified value.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type > // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
-inline DynamicArray<N, Type>::DynamicArray( InitFromValue, const Type& init, Dims...dims )
+inline DynamicArray<N, Type, Alloc>::DynamicArray( InitFromValue, const Type& init, Dims...dims )
    : DynamicArray( dims... )
 {
    BLAZE_STATIC_ASSERT( N == sizeof...( dims ) );
@@ -612,9 +636,10 @@ inline DynamicArray<N, Type>::DynamicArray( InitFromValue, const Type& init, Dim
 // initialized by the values of the given initializer list. Missing values are initialized as
 // default (as e.g. the value 6 in the example).
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type > // Data type of the array
-inline DynamicArray<N, Type>::DynamicArray( nested_initializer_list< N, Type > list )
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline DynamicArray<N, Type, Alloc>::DynamicArray( nested_initializer_list< N, Type > list )
    : DynamicArray( list.dimensions() )
 {
    list.transfer_data( *this );
@@ -647,10 +672,11 @@ inline DynamicArray<N, Type>::DynamicArray( nested_initializer_list< N, Type > l
 // from the given array. Note that it is expected that the given \a array has at least \a m by
 // \a n elements. Providing an array with less elements results in undefined behavior!
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type > // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename Other, typename... Dims, typename Enable >  // Data type of the initialization array
-inline DynamicArray<N, Type>::DynamicArray( const Other* array, Dims... dims )
+inline DynamicArray<N, Type, Alloc>::DynamicArray( const Other* array, Dims... dims )
    : DynamicArray( dims... )
 {
    BLAZE_STATIC_ASSERT( N == sizeof...( dims ) );
@@ -679,13 +705,14 @@ inline DynamicArray<N, Type>::DynamicArray( const Other* array, Dims... dims )
 // The copy constructor is explicitly defined due to the required dynamic memory management
 // and in order to enable/facilitate NRV optimization.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type > // Data type of the array
-inline DynamicArray<N, Type>::DynamicArray( const DynamicArray& m )
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline DynamicArray<N, Type, Alloc>::DynamicArray( const DynamicArray& m )
    : dims_    ( m.dims_ )                 // The current dimensions of the array
    , nn_      ( m.nn_ )                   // The length of a padded row
    , capacity_( m.capacity_ )             // The maximum capacity of the array
-   , v_( allocate< Type >( capacity_ ) )  // The array elements
+   , v_( allocateStorage( capacity_ ) )  // The array elements
 {
    smpAssign( *this, m );
 
@@ -699,9 +726,10 @@ inline DynamicArray<N, Type>::DynamicArray( const DynamicArray& m )
 //
 // \param m The array to be move into this instance.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type > // Data type of the array
-inline DynamicArray<N, Type>::DynamicArray( DynamicArray&& m ) noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline DynamicArray<N, Type, Alloc>::DynamicArray( DynamicArray&& m ) noexcept
    : dims_    ( std::move(m.dims_) )   // The current dimensions of the array
    , nn_      ( m.nn_ )                // The length of a padded row
    , capacity_( m.capacity_ )          // The maximum capacity of the array
@@ -719,10 +747,11 @@ inline DynamicArray<N, Type>::DynamicArray( DynamicArray&& m ) noexcept
 //
 // \param m Array to be copied.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT >    // Type of the foreign array
-inline DynamicArray<N, Type>::DynamicArray( const Array<MT>& rhs )
+inline DynamicArray<N, Type, Alloc>::DynamicArray( const Array<MT>& rhs )
    : DynamicArray( (~rhs).dimensions() )
 {
    if( (~rhs).canAlias( this ) ) {
@@ -743,10 +772,11 @@ inline DynamicArray<N, Type>::DynamicArray( const Array<MT>& rhs )
 //
 // \param m Array to be copied.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT, bool TF, size_t M, typename Enable >
-inline DynamicArray<N, Type>::DynamicArray( const Vector<MT, TF>& rhs )
+inline DynamicArray<N, Type, Alloc>::DynamicArray( const Vector<MT, TF>& rhs )
 {
    using ET = ElementType_t<MT>;
    using custom_array = CustomArray<1, ET, unaligned, padded>;
@@ -769,10 +799,11 @@ inline DynamicArray<N, Type>::DynamicArray( const Vector<MT, TF>& rhs )
 //
 // \param m Array to be copied.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT, bool SO, size_t M, typename Enable >
-inline DynamicArray<N, Type>::DynamicArray( const Matrix<MT,SO>& rhs )
+inline DynamicArray<N, Type, Alloc>::DynamicArray( const Matrix<MT,SO>& rhs )
 {
    using ET = ElementType_t<MT>;
    using custom_array = CustomArray<2, ET, unaligned, padded>;
@@ -797,10 +828,11 @@ inline DynamicArray<N, Type>::DynamicArray( const Matrix<MT,SO>& rhs )
 //
 // \param m Array to be copied.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT, size_t M, typename Enable >
-inline DynamicArray<N, Type>::DynamicArray( const Tensor<MT>& rhs )
+inline DynamicArray<N, Type, Alloc>::DynamicArray( const Tensor<MT>& rhs )
 {
    using ET = ElementType_t<MT>;
    using custom_array = CustomArray<2, ET, unaligned, padded>;
@@ -827,13 +859,14 @@ inline DynamicArray<N, Type>::DynamicArray( const Tensor<MT>& rhs )
 //
 // \param m Array to be copied.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline DynamicArray<N, Type>::DynamicArray( const std::array<size_t, N>& dims )
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline DynamicArray<N, Type, Alloc>::DynamicArray( const std::array<size_t, N>& dims )
    : dims_    ( dims )         // The current dimensions of the array
    , nn_      ( addPadding( dims_[0] ) )     // The length of a padded row
    , capacity_( calcCapacity() )             // The maximum capacity of the array
-   , v_( allocate< Type >( capacity_ ) )     // The array elements
+   , v_( allocateStorage( capacity_ ) )     // The array elements
 {
    if( IsVectorizable_v<Type> ) {
       ArrayForEachPadded( dims_, nn_, [&]( size_t i ) { v_[i] = Type(); } );
@@ -854,11 +887,12 @@ inline DynamicArray<N, Type>::DynamicArray( const std::array<size_t, N>& dims )
 //*************************************************************************************************
 /*!\brief The destructor for DynamicArray.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline DynamicArray<N, Type>::~DynamicArray()
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline DynamicArray<N, Type, Alloc>::~DynamicArray()
 {
-   deallocate( v_ );
+   deallocateStorage( v_, capacity_ );
 }
 //*************************************************************************************************
 
@@ -882,11 +916,12 @@ inline DynamicArray<N, Type>::~DynamicArray()
 // This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
 // the at() function is guaranteed to perform a check of the given access indices.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
-inline typename DynamicArray<N, Type>::Reference
-   DynamicArray<N, Type>::operator()( Dims... dims ) noexcept
+inline typename DynamicArray<N, Type, Alloc>::Reference
+   DynamicArray<N, Type, Alloc>::operator()( Dims... dims ) noexcept
 {
    BLAZE_STATIC_ASSERT( N == sizeof...( dims ) );
 
@@ -915,11 +950,12 @@ inline typename DynamicArray<N, Type>::Reference
 // This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
 // the at() function is guaranteed to perform a check of the given access indices.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
-inline typename DynamicArray<N, Type>::ConstReference
-   DynamicArray<N, Type>::operator()( Dims... dims ) const noexcept
+inline typename DynamicArray<N, Type, Alloc>::ConstReference
+   DynamicArray<N, Type, Alloc>::operator()( Dims... dims ) const noexcept
 {
    BLAZE_STATIC_ASSERT( N == sizeof...( dims ) );
 
@@ -948,10 +984,11 @@ inline typename DynamicArray<N, Type>::ConstReference
 // This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
 // the at() function is guaranteed to perform a check of the given access indices.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline typename DynamicArray<N, Type>::Reference
-   DynamicArray<N, Type>::operator()( std::array< size_t, N > const& indices ) noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicArray<N, Type, Alloc>::Reference
+   DynamicArray<N, Type, Alloc>::operator()( std::array< size_t, N > const& indices ) noexcept
 {
 #if defined(BLAZE_USER_ASSERTION)
    ArrayDimForEach( dims_, [&]( size_t i, size_t dim ) {
@@ -975,10 +1012,11 @@ inline typename DynamicArray<N, Type>::Reference
 // This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
 // the at() function is guaranteed to perform a check of the given access indices.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline typename DynamicArray<N, Type>::ConstReference
-   DynamicArray<N, Type>::operator()( std::array< size_t, N > const& indices ) const noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicArray<N, Type, Alloc>::ConstReference
+   DynamicArray<N, Type, Alloc>::operator()( std::array< size_t, N > const& indices ) const noexcept
 {
 #if defined(BLAZE_USER_ASSERTION)
    ArrayDimForEach( dims_, [&]( size_t i, size_t dim ) {
@@ -1003,11 +1041,12 @@ inline typename DynamicArray<N, Type>::ConstReference
 // In contrast to the subscript operator this function always performs a check of the given
 // access indices.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
-inline typename DynamicArray<N, Type>::Reference
-   DynamicArray<N, Type>::at( Dims... dims )
+inline typename DynamicArray<N, Type, Alloc>::Reference
+   DynamicArray<N, Type, Alloc>::at( Dims... dims )
 {
    BLAZE_STATIC_ASSERT( N == sizeof...( dims ) );
 
@@ -1036,11 +1075,12 @@ inline typename DynamicArray<N, Type>::Reference
 // In contrast to the subscript operator this function always performs a check of the given
 // access indices.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
-inline typename DynamicArray<N, Type>::ConstReference
-   DynamicArray<N, Type>::at( Dims... dims ) const
+inline typename DynamicArray<N, Type, Alloc>::ConstReference
+   DynamicArray<N, Type, Alloc>::at( Dims... dims ) const
 {
    BLAZE_STATIC_ASSERT( N == sizeof...( dims ) );
 
@@ -1069,10 +1109,11 @@ inline typename DynamicArray<N, Type>::ConstReference
 // In contrast to the subscript operator this function always performs a check of the given
 // access indices.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline typename DynamicArray<N, Type>::Reference
-   DynamicArray<N, Type>::at( std::array< size_t, N > const& indices )
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicArray<N, Type, Alloc>::Reference
+   DynamicArray<N, Type, Alloc>::at( std::array< size_t, N > const& indices )
 {
    ArrayDimForEach( dims_, [&]( size_t i, size_t dim ) {
       if( indices[i] >= dim ) {
@@ -1097,10 +1138,11 @@ inline typename DynamicArray<N, Type>::Reference
 // In contrast to the subscript operator this function always performs a check of the given
 // access indices.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline typename DynamicArray<N, Type>::ConstReference
-   DynamicArray<N, Type>::at( std::array< size_t, N > const& indices ) const
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicArray<N, Type, Alloc>::ConstReference
+   DynamicArray<N, Type, Alloc>::at( std::array< size_t, N > const& indices ) const
 {
    ArrayDimForEach( dims_, [&]( size_t i, size_t dim ) {
       if( indices[i] >= dim ) {
@@ -1125,10 +1167,11 @@ inline typename DynamicArray<N, Type>::ConstReference
 // respectively, the total number of elements including padding is given by the \c spacing()
 // member function.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline typename DynamicArray<N, Type>::Pointer
-   DynamicArray<N, Type>::data() noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicArray<N, Type, Alloc>::Pointer
+   DynamicArray<N, Type, Alloc>::data() noexcept
 {
    return v_;
 }
@@ -1147,10 +1190,11 @@ inline typename DynamicArray<N, Type>::Pointer
 // respectively, the total number of elements including padding is given by the \c spacing()
 // member function.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline typename DynamicArray<N, Type>::ConstPointer
-   DynamicArray<N, Type>::data() const noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicArray<N, Type, Alloc>::ConstPointer
+   DynamicArray<N, Type, Alloc>::data() const noexcept
 {
    return v_;
 }
@@ -1166,11 +1210,12 @@ inline typename DynamicArray<N, Type>::ConstPointer
 //
 // This function returns a pointer to the internal storage for the elements in row/column \a i.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
-inline typename DynamicArray<N, Type>::Pointer
-   DynamicArray<N, Type>::data( size_t i, Dims... dims ) noexcept
+inline typename DynamicArray<N, Type, Alloc>::Pointer
+   DynamicArray<N, Type, Alloc>::data( size_t i, Dims... dims ) noexcept
 {
    BLAZE_STATIC_ASSERT( N - 2 == sizeof...( dims ) );
 
@@ -1188,11 +1233,12 @@ inline typename DynamicArray<N, Type>::Pointer
 //
 // This function returns a pointer to the internal storage for the elements in row/column \a i.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
-inline typename DynamicArray<N, Type>::ConstPointer
-   DynamicArray<N, Type>::data( size_t i, Dims... dims ) const noexcept
+inline typename DynamicArray<N, Type, Alloc>::ConstPointer
+   DynamicArray<N, Type, Alloc>::data( size_t i, Dims... dims ) const noexcept
 {
    BLAZE_STATIC_ASSERT( N - 2 == sizeof...( dims ) );
 
@@ -1213,11 +1259,12 @@ inline typename DynamicArray<N, Type>::ConstPointer
 // of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
 // to the first element of column \a i.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
-inline typename DynamicArray<N, Type>::Iterator
-   DynamicArray<N, Type>::begin( size_t i, Dims... dims ) noexcept
+inline typename DynamicArray<N, Type, Alloc>::Iterator
+   DynamicArray<N, Type, Alloc>::begin( size_t i, Dims... dims ) noexcept
 {
    BLAZE_STATIC_ASSERT( N - 2 == sizeof...( dims ) );
 
@@ -1238,11 +1285,12 @@ inline typename DynamicArray<N, Type>::Iterator
 // of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
 // to the first element of column \a i.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
-inline typename DynamicArray<N, Type>::ConstIterator
-   DynamicArray<N, Type>::begin( size_t i, Dims... dims ) const noexcept
+inline typename DynamicArray<N, Type, Alloc>::ConstIterator
+   DynamicArray<N, Type, Alloc>::begin( size_t i, Dims... dims ) const noexcept
 {
    BLAZE_STATIC_ASSERT( N - 2 == sizeof...( dims ) );
 
@@ -1263,11 +1311,12 @@ inline typename DynamicArray<N, Type>::ConstIterator
 // of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
 // to the first element of column \a i.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
-inline typename DynamicArray<N, Type>::ConstIterator
-   DynamicArray<N, Type>::cbegin( size_t i, Dims... dims ) const noexcept
+inline typename DynamicArray<N, Type, Alloc>::ConstIterator
+   DynamicArray<N, Type, Alloc>::cbegin( size_t i, Dims... dims ) const noexcept
 {
    BLAZE_STATIC_ASSERT( N - 2 == sizeof...( dims ) );
 
@@ -1288,11 +1337,12 @@ inline typename DynamicArray<N, Type>::ConstIterator
 // the last element of row \a i, in case the storage flag is set to \a columnMajor the function
 // returns an iterator just past the last element of column \a i.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
-inline typename DynamicArray<N, Type>::Iterator
-   DynamicArray<N, Type>::end( size_t i, Dims... dims ) noexcept
+inline typename DynamicArray<N, Type, Alloc>::Iterator
+   DynamicArray<N, Type, Alloc>::end( size_t i, Dims... dims ) noexcept
 {
    BLAZE_STATIC_ASSERT( N - 2 == sizeof...( dims ) );
 
@@ -1313,11 +1363,12 @@ inline typename DynamicArray<N, Type>::Iterator
 // the last element of row \a i, in case the storage flag is set to \a columnMajor the function
 // returns an iterator just past the last element of column \a i.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
-inline typename DynamicArray<N, Type>::ConstIterator
-   DynamicArray<N, Type>::end( size_t i, Dims... dims ) const noexcept
+inline typename DynamicArray<N, Type, Alloc>::ConstIterator
+   DynamicArray<N, Type, Alloc>::end( size_t i, Dims... dims ) const noexcept
 {
    BLAZE_STATIC_ASSERT( N - 2 == sizeof...( dims ) );
 
@@ -1338,11 +1389,12 @@ inline typename DynamicArray<N, Type>::ConstIterator
 // the last element of row \a i, in case the storage flag is set to \a columnMajor the function
 // returns an iterator just past the last element of column \a i.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
-inline typename DynamicArray<N, Type>::ConstIterator
-   DynamicArray<N, Type>::cend( size_t i, Dims... dims ) const noexcept
+inline typename DynamicArray<N, Type, Alloc>::ConstIterator
+   DynamicArray<N, Type, Alloc>::cend( size_t i, Dims... dims ) const noexcept
 {
    BLAZE_STATIC_ASSERT( N - 2 == sizeof...( dims ) );
 
@@ -1365,9 +1417,10 @@ inline typename DynamicArray<N, Type>::ConstIterator
 // \param rhs Scalar value to be assigned to all array elements.
 // \return Reference to the assigned array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator=(const Type& rhs)
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::operator=(const Type& rhs)
 {
    ArrayForEach( dims_, nn_, [&]( size_t i ) { v_[i] = rhs; } );
 
@@ -1397,10 +1450,11 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator=(const Type& rhs)
 // assigned the values from the given initializer list. Missing values are initialized as
 // default (as e.g. the value 6 in the example).
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline DynamicArray<N, Type>&
-   DynamicArray<N, Type>::operator=( nested_initializer_list< N, Type > list )
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline DynamicArray<N, Type, Alloc>&
+   DynamicArray<N, Type, Alloc>::operator=( nested_initializer_list< N, Type > list )
 {
    resize( list.dimensions(), false );
 
@@ -1424,9 +1478,10 @@ inline DynamicArray<N, Type>&
 // The array is resized according to the given \f$ M \times N \f$ array and initialized as a
 // copy of this array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator=( const DynamicArray& rhs )
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::operator=( const DynamicArray& rhs )
 {
    if( &rhs == this ) return *this;
 
@@ -1447,11 +1502,12 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator=( const DynamicArr
 // \param rhs The array to be moved into this instance.
 // \return Reference to the assigned array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator=( DynamicArray&& rhs ) noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::operator=( DynamicArray&& rhs ) noexcept
 {
-   deallocate( v_ );
+   deallocateStorage( v_, capacity_ );
 
    dims_     = std::move( rhs.dims_ );
    nn_       = rhs.nn_;
@@ -1476,10 +1532,11 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator=( DynamicArray&& r
 // The array is resized according to the given \f$ M \times N \f$ array and initialized as a
 // copy of this array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side array
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator=( const Array<MT>& rhs )
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::operator=( const Array<MT>& rhs )
 {
    if( (~rhs).canAlias( this ) ) {
       DynamicArray tmp( ~rhs );
@@ -1507,10 +1564,11 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator=( const Array<MT>&
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT >   // Type of the right-hand side array
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator+=( const Array<MT>& rhs )
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::operator+=( const Array<MT>& rhs )
 {
    if( (~rhs).dimensions() != dims_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Array sizes do not match" );
@@ -1541,10 +1599,11 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator+=( const Array<MT>
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT >   // Type of the right-hand side array
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator-=( const Array<MT>& rhs )
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::operator-=( const Array<MT>& rhs )
 {
    if( (~rhs).dimensions() != dims_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Array sizes do not match" );
@@ -1575,10 +1634,11 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator-=( const Array<MT>
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side array
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator%=( const Array<MT>& rhs )
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::operator%=( const Array<MT>& rhs )
 {
    if( (~rhs).dimensions() != dims_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Array sizes do not match" );
@@ -1605,10 +1665,11 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator%=( const Array<MT>
 // \param rhs Array to be copied.
 // \return Reference to the assigned array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT, bool TF, size_t M, typename Enable >
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator=( const Vector<MT, TF>& rhs )
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::operator=( const Vector<MT, TF>& rhs )
 {
    using ET = ElementType_t<MT>;
    using custom_array = CustomArray<1, ET, unaligned, padded>;
@@ -1635,10 +1696,11 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator=( const Vector<MT,
 // \param rhs The right-hand side array to be added to the array.
 // \return Reference to the assigned array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT, bool TF, size_t M, typename Enable >
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator+=( const Vector<MT, TF>& rhs )
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::operator+=( const Vector<MT, TF>& rhs )
 {
    using ET = ElementType_t<MT>;
    using custom_array = CustomArray<1, ET, unaligned, padded>;
@@ -1665,10 +1727,11 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator+=( const Vector<MT
 // \param rhs The right-hand side array to be subtracted from the array.
 // \return Reference to the assigned array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT, bool TF, size_t M, typename Enable >
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator-=( const Vector<MT, TF>& rhs )
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::operator-=( const Vector<MT, TF>& rhs )
 {
    using ET = ElementType_t<MT>;
    using custom_array = CustomArray<1, ET, unaligned, padded>;
@@ -1695,10 +1758,11 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator-=( const Vector<MT
 // \param rhs The right-hand side array for the Schur product.
 // \return Reference to the assigned array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT, bool TF, size_t M, typename Enable >
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator%=( const Vector<MT, TF>& rhs )
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::operator%=( const Vector<MT, TF>& rhs )
 {
    using ET = ElementType_t<MT>;
    using custom_array = CustomArray<1, ET, unaligned, padded>;
@@ -1725,10 +1789,11 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator%=( const Vector<MT
 // \param rhs Array to be copied.
 // \return Reference to the assigned array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT, bool SO, size_t M, typename Enable >
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator=( const Matrix<MT, SO>& rhs )
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::operator=( const Matrix<MT, SO>& rhs )
 {
    using ET = ElementType_t<MT>;
    using custom_array = CustomArray<2, ET, unaligned, padded>;
@@ -1757,10 +1822,11 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator=( const Matrix<MT,
 // \param rhs The right-hand side array to be added to the array.
 // \return Reference to the assigned array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT, bool SO, size_t M, typename Enable >
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator+=( const Matrix<MT, SO>& rhs )
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::operator+=( const Matrix<MT, SO>& rhs )
 {
    using ET = ElementType_t<MT>;
    using custom_array = CustomArray<2, ET, unaligned, padded>;
@@ -1789,10 +1855,11 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator+=( const Matrix<MT
 // \param rhs The right-hand side array to be subtracted from the array.
 // \return Reference to the assigned array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT, bool SO, size_t M, typename Enable >
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator-=( const Matrix<MT, SO>& rhs )
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::operator-=( const Matrix<MT, SO>& rhs )
 {
    using ET = ElementType_t<MT>;
    using custom_array = CustomArray<2, ET, unaligned, padded>;
@@ -1821,10 +1888,11 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator-=( const Matrix<MT
 // \param rhs The right-hand side array for the Schur product.
 // \return Reference to the assigned array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT, bool SO, size_t M, typename Enable >
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator%=( const Matrix<MT, SO>& rhs )
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::operator%=( const Matrix<MT, SO>& rhs )
 {
    using ET = ElementType_t<MT>;
    using custom_array = CustomArray<2, ET, unaligned, padded>;
@@ -1853,10 +1921,11 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator%=( const Matrix<MT
 // \param rhs Array to be copied.
 // \return Reference to the assigned array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT, size_t M, typename Enable >
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator=( const Tensor<MT>& rhs )
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::operator=( const Tensor<MT>& rhs )
 {
    using ET = ElementType_t<MT>;
    using custom_array = CustomArray<3, ET, unaligned, padded>;
@@ -1887,10 +1956,11 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator=( const Tensor<MT>
 // \param rhs The right-hand side array to be added to the array.
 // \return Reference to the assigned array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT, size_t M, typename Enable >
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator+=( const Tensor<MT>& rhs )
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::operator+=( const Tensor<MT>& rhs )
 {
    using ET = ElementType_t<MT>;
    using custom_array = CustomArray<3, ET, unaligned, padded>;
@@ -1921,10 +1991,11 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator+=( const Tensor<MT
 // \param rhs The right-hand side array to be subtracted from the array.
 // \return Reference to the assigned array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT, size_t M, typename Enable >
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator-=( const Tensor<MT>& rhs )
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::operator-=( const Tensor<MT>& rhs )
 {
    using ET = ElementType_t<MT>;
    using custom_array = CustomArray<3, ET, unaligned, padded>;
@@ -1955,10 +2026,11 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator-=( const Tensor<MT
 // \param rhs The right-hand side array for the Schur product.
 // \return Reference to the assigned array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT, size_t M, typename Enable >
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator%=( const Tensor<MT>& rhs )
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::operator%=( const Tensor<MT>& rhs )
 {
    using ET = ElementType_t<MT>;
    using custom_array = CustomArray<3, ET, unaligned, padded>;
@@ -1998,10 +2070,11 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::operator%=( const Tensor<MT
 //
 // \return The number of cubes of the array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template < size_t Dim >
-inline size_t DynamicArray<N, Type>::dimension() const noexcept
+inline size_t DynamicArray<N, Type, Alloc>::dimension() const noexcept
 {
    BLAZE_STATIC_ASSERT( Dim < N );
 
@@ -2020,9 +2093,10 @@ inline size_t DynamicArray<N, Type>::dimension() const noexcept
 // the function returns the spacing between two rows, in case the storage flag is set to
 // \a columnMajor the function returns the spacing between two columns.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline size_t DynamicArray<N, Type>::spacing() const noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicArray<N, Type, Alloc>::spacing() const noexcept
 {
    return nn_;
 }
@@ -2034,9 +2108,10 @@ inline size_t DynamicArray<N, Type>::spacing() const noexcept
 //
 // \return The capacity of the array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline size_t DynamicArray<N, Type>::capacity() const noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicArray<N, Type, Alloc>::capacity() const noexcept
 {
    return capacity_;
 }
@@ -2052,10 +2127,11 @@ inline size_t DynamicArray<N, Type>::capacity() const noexcept
 //
 // This function returns the current capacity of the specified row/column.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
-inline size_t DynamicArray<N, Type>::capacity( size_t i, Dims... dims ) const noexcept
+inline size_t DynamicArray<N, Type, Alloc>::capacity( size_t i, Dims... dims ) const noexcept
 {
    BLAZE_STATIC_ASSERT( N - 2 == sizeof...( Dims ) );
 
@@ -2081,9 +2157,10 @@ inline size_t DynamicArray<N, Type>::capacity( size_t i, Dims... dims ) const no
 //
 // \return The number of non-zero elements in the dense array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline size_t DynamicArray<N, Type>::nonZeros() const
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicArray<N, Type, Alloc>::nonZeros() const
 {
    size_t nonzeros( 0UL );
 
@@ -2106,10 +2183,11 @@ inline size_t DynamicArray<N, Type>::nonZeros() const
 //
 // This function returns the current number of non-zero elements in the specified row.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
-inline size_t DynamicArray<N, Type>::nonZeros( size_t i, Dims... dims ) const
+inline size_t DynamicArray<N, Type, Alloc>::nonZeros( size_t i, Dims... dims ) const
 {
    BLAZE_STATIC_ASSERT( N - 2 == sizeof...( Dims ) );
 
@@ -2139,9 +2217,10 @@ inline size_t DynamicArray<N, Type>::nonZeros( size_t i, Dims... dims ) const
 //
 // \return void
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline void DynamicArray<N, Type>::reset()
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline void DynamicArray<N, Type, Alloc>::reset()
 {
    using blaze::clear;
    ArrayForEach( dims_, nn_, [&]( size_t i ) { clear( v_[i] ); } );
@@ -2160,10 +2239,11 @@ inline void DynamicArray<N, Type>::reset()
 // the storage order is set to \a columnMajor the function resets the values in column \a i.
 // Note that the capacity of the row/column remains unchanged.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
-inline void DynamicArray<N, Type>::reset( size_t i, Dims... dims )
+inline void DynamicArray<N, Type, Alloc>::reset( size_t i, Dims... dims )
 {
    BLAZE_STATIC_ASSERT( N - 2 == sizeof...( dims ) );
 
@@ -2186,9 +2266,10 @@ inline void DynamicArray<N, Type>::reset( size_t i, Dims... dims )
 //
 // After the clear() function, the size of the array is 0.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline void DynamicArray<N, Type>::clear()
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline void DynamicArray<N, Type, Alloc>::clear()
 {
    resize( std::array< size_t, N >{}, false );
 }
@@ -2229,9 +2310,10 @@ inline void DynamicArray<N, Type>::clear()
                               \end{array}\right)
                               \f]
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-void DynamicArray<N, Type>::resize( std::array< size_t, N > const& dims, bool preserve )
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+void DynamicArray<N, Type, Alloc>::resize( std::array< size_t, N > const& dims, bool preserve )
 {
    BLAZE_USER_ASSERT( N == dims.size(), "invalid dimensionality specified" );
 
@@ -2253,7 +2335,7 @@ void DynamicArray<N, Type>::resize( std::array< size_t, N > const& dims, bool pr
 
    if( preserve )
    {
-      Type* BLAZE_RESTRICT v = allocate<Type>( new_capacity );
+      Type* BLAZE_RESTRICT v = allocateStorage( new_capacity );
 
 //       const size_t min_m( min( m, m_ ) );
 //       const size_t min_n( min( n, n_ ) );
@@ -2271,13 +2353,13 @@ void DynamicArray<N, Type>::resize( std::array< size_t, N > const& dims, bool pr
 //       }
 
       swap( v_, v );
-      deallocate( v );
+      deallocateStorage( v, capacity_ );
       capacity_ = new_capacity;
    }
    else if( new_capacity > capacity_ ) {
-      Type* BLAZE_RESTRICT v = allocate<Type>( new_capacity );
+      Type* BLAZE_RESTRICT v = allocateStorage( new_capacity );
       swap( v_, v );
-      deallocate( v );
+      deallocateStorage( v, capacity_ );
       capacity_ = new_capacity;
    }
 
@@ -2305,9 +2387,10 @@ void DynamicArray<N, Type>::resize( std::array< size_t, N > const& dims, bool pr
 // values, the \a preserve flag can be set to \a true. However, new array elements are not
 // initialized!
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline void DynamicArray<N, Type>::extend( std::array< size_t, N > const& dims, bool preserve )
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline void DynamicArray<N, Type, Alloc>::extend( std::array< size_t, N > const& dims, bool preserve )
 {
    BLAZE_USER_ASSERT( N == n, "invalid dimensionality specified" );
 
@@ -2328,16 +2411,17 @@ inline void DynamicArray<N, Type>::extend( std::array< size_t, N > const& dims,
 // This function increases the capacity of the dense array to at least \a elements elements.
 // The current values of the array elements are preserved.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline void DynamicArray<N, Type>::reserve( size_t elements )
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline void DynamicArray<N, Type, Alloc>::reserve( size_t elements )
 {
    using std::swap;
 
    if( elements > capacity_ )
    {
       // Allocating a new array
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+      Type* BLAZE_RESTRICT tmp = allocateStorage( elements );
 
       // Initializing the new array
       transfer( v_, v_ + capacity_, tmp );
@@ -2349,7 +2433,7 @@ inline void DynamicArray<N, Type>::reserve( size_t elements )
 
       // Replacing the old array
       swap( tmp, v_ );
-      deallocate( tmp );
+      deallocateStorage( tmp, capacity_ );
       capacity_ = elements;
    }
 }
@@ -2366,9 +2450,10 @@ inline void DynamicArray<N, Type>::reserve( size_t elements )
 // Please also note that in case a reallocation occurs, all iterators (including end() iterators),
 // all pointers and references to elements of this array are invalidated.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline void DynamicArray<N, Type>::shrinkToFit()
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline void DynamicArray<N, Type, Alloc>::shrinkToFit()
 {
    if( calcCapacity() < capacity_ ) {
       DynamicArray( *this ).swap( *this );
@@ -2383,9 +2468,10 @@ inline void DynamicArray<N, Type>::shrinkToFit()
 // \param m The array to be swapped.
 // \return void
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline void DynamicArray<N, Type>::swap( DynamicArray& m ) noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline void DynamicArray<N, Type, Alloc>::swap( DynamicArray& m ) noexcept
 {
    using std::swap;
 
@@ -2405,9 +2491,10 @@ inline void DynamicArray<N, Type>::swap( DynamicArray& m ) noexcept
 // This function increments the given \a value by the necessary amount of padding based on the
 // vector's data type \a Type.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline size_t DynamicArray<N, Type>::addPadding( size_t value ) noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicArray<N, Type, Alloc>::addPadding( size_t value ) noexcept
 {
    if( usePadding && IsVectorizable_v<Type> )
       return nextMultiple<size_t>( value, SIMDSIZE );
@@ -2416,6 +2503,42 @@ inline size_t DynamicArray<N, Type>::addPadding( size_t value ) noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Allocation of the element storage by means of the allocator of the array.
+//
+// \param n The number of elements to be allocated.
+// \return Pointer to the first allocated element.
+// \exception std::bad_alloc Allocation failed.
+*/
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline Type* DynamicArray<N, Type, Alloc>::allocateStorage( size_t n )
+{
+   Alloc alloc;
+   return allocateElements( alloc, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of element storage by means of the allocator of the array.
+//
+// \param ptr Pointer to the first element of the storage (may be \c nullptr).
+// \param n The number of allocated elements.
+// \return void
+*/
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline void DynamicArray<N, Type, Alloc>::deallocateStorage( Type* ptr, size_t n ) noexcept
+{
+   Alloc alloc;
+   deallocateElements( alloc, ptr, n );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Initialize the dimensions array.
 //
@@ -2424,10 +2547,11 @@ inline size_t DynamicArray<N, Type>::addPadding( size_t value ) noexcept
 //
 // This function initializes the internal dimensions array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
-inline std::array< size_t, N > DynamicArray<N, Type>::initDimensions( Dims... dims ) noexcept
+inline std::array< size_t, N > DynamicArray<N, Type, Alloc>::initDimensions( Dims... dims ) noexcept
 {
    BLAZE_STATIC_ASSERT( N == sizeof...( dims ) );
 
@@ -2450,9 +2574,10 @@ inline std::array< size_t, N > DynamicArray<N, Type>::initDimensions( Dims... di
 //
 // This function calculates the overall needed capacity for the array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline size_t DynamicArray<N, Type>::calcCapacity() const noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicArray<N, Type, Alloc>::calcCapacity() const noexcept
 {
    size_t capacity = nn_;
    for( size_t i = 1; i < N; ++i ) {
@@ -2471,10 +2596,11 @@ inline size_t DynamicArray<N, Type>::calcCapacity() const noexcept
 //
 // This function calculates the overall index of the first of the give row
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
-inline size_t DynamicArray<N, Type>::row_index( size_t i, Dims... dims ) const noexcept
+inline size_t DynamicArray<N, Type, Alloc>::row_index( size_t i, Dims... dims ) const noexcept
 {
    BLAZE_STATIC_ASSERT( N - 2 == sizeof...( dims ) );
 
@@ -2502,10 +2628,11 @@ inline size_t DynamicArray<N, Type>::row_index( size_t i, Dims... dims ) const n
 //
 // This function calculates the overall element index into the underlying memory from the ND indices
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
-inline size_t DynamicArray<N, Type>::index( Dims... dims ) const noexcept
+inline size_t DynamicArray<N, Type, Alloc>::index( Dims... dims ) const noexcept
 {
    BLAZE_STATIC_ASSERT( N == sizeof...( dims ) );
 
@@ -2535,9 +2662,10 @@ inline size_t DynamicArray<N, Type>::index( Dims... dims ) const noexcept
 */
 //       3         3    2     2    1     0     0
 // ( ( ( c + 0 ) * o_ + k ) * m_ + i ) * nn_ + j
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline size_t DynamicArray<N, Type>::index( std::array< size_t, N > const& indices ) const noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicArray<N, Type, Alloc>::index( std::array< size_t, N > const& indices ) const noexcept
 {
    size_t idx = 0UL;
    for( size_t i = N - 1; i > 1; --i ) {
@@ -2561,9 +2689,10 @@ inline size_t DynamicArray<N, Type>::index( std::array< size_t, N > const& indic
 //
 // This function calculates the overall index of the first of the give row
 */
-template< size_t N   // The dimensionality of the array
-        , typename Type >   // Data type of the array
-inline constexpr std::array< size_t, N > const& DynamicArray< N, Type >::dimensions() const noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline constexpr std::array< size_t, N > const& DynamicArray<N, Type, Alloc>::dimensions() const noexcept
 {
    return dims_;
 }
@@ -2578,9 +2707,10 @@ inline constexpr std::array< size_t, N > const& DynamicArray< N, Type >::dimensi
 //
 // This function calculates the overall index of the first of the give row
 */
-template< size_t N   // The dimensionality of the array
-        , typename Type >   // Data type of the array
-inline size_t DynamicArray< N, Type >::quats() const noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicArray<N, Type, Alloc>::quats() const noexcept
 {
    return dims_[3];
 }
@@ -2595,9 +2725,10 @@ inline size_t DynamicArray< N, Type >::quats() const noexcept
 //
 // This function calculates the overall index of the first of the give row
 */
-template< size_t N   // The dimensionality of the array
-        , typename Type >   // Data type of the array
-inline size_t DynamicArray< N, Type >::pages() const noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicArray<N, Type, Alloc>::pages() const noexcept
 {
    return dims_[2];
 }
@@ -2612,9 +2743,10 @@ inline size_t DynamicArray< N, Type >::pages() const noexcept
 //
 // This function calculates the overall index of the first of the give row
 */
-template< size_t N   // The dimensionality of the array
-        , typename Type >   // Data type of the array
-inline size_t DynamicArray< N, Type >::rows() const noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicArray<N, Type, Alloc>::rows() const noexcept
 {
    return dims_[1];
 }
@@ -2629,9 +2761,10 @@ inline size_t DynamicArray< N, Type >::rows() const noexcept
 //
 // This function calculates the overall index of the first of the give row
 */
-template< size_t N   // The dimensionality of the array
-        , typename Type >   // Data type of the array
-inline size_t DynamicArray< N, Type >::columns() const noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicArray<N, Type, Alloc>::columns() const noexcept
 {
    return dims_[0];
 }
@@ -2649,9 +2782,10 @@ inline size_t DynamicArray< N, Type >::columns() const noexcept
 //
 // \return Reference to the transposed array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::transpose()
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::transpose()
 {
    using std::swap;
 //    if( l_ == n_ && o_ == n_ && m_ == n_ )
@@ -2672,23 +2806,29 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::transpose()
 //*************************************************************************************************
 /*!\brief In-place transpose of the array.
 //
+// \param indices The \a N mapping indices of the transposition.
+// \param n The number of mapping indices (has to be \a N).
 // \return Reference to the transposed array.
+//
+// This function permutes the dimensions of the array according to the given mapping indices.
+// As long as the transposed array fits into the current capacity of the array, the elements
+// are permuted in place and no second copy of the elements is required. Only in case the
+// transposed array requires more memory (due to a different padding of the new rows) a
+// temporary array is created.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename T >     // Type of the mapping indices
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::transpose( const T* indices, size_t n )
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::transpose( const T* indices, size_t n )
 {
-   using std::swap;
-//    if( l_ == n_ && o_ == n_ && m_ == n_ )
-//    {
-//       transposeGeneral( *this, indices, n );
-//    }
-//    else
-//    {
-       DynamicArray tmp( trans(*this, indices, n ) );
-       this->swap( tmp );
-//    }
+   BLAZE_USER_ASSERT( n == N, "Invalid number of transpose mapping indices" );
+   MAYBE_UNUSED( n );
+
+   if( !transposeInPlace( indices ) ) {
+      DynamicArray tmp( permuted( indices, []( Type& a, const Type& b ){ a = b; } ) );
+      swap( tmp );
+   }
 
    return *this;
 }
@@ -2700,9 +2840,10 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::transpose( const T* indices
 //
 // \return Reference to the transposed array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::ctranspose()
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::ctranspose()
 {
    using std::swap;
 //    constexpr size_t block( BLOCK_SIZE );
@@ -2741,47 +2882,211 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::ctranspose()
 //*************************************************************************************************
 /*!\brief In-place conjugate transpose of the array.
 //
+// \param indices The \a N mapping indices of the transposition.
+// \param n The number of mapping indices (has to be \a N).
 // \return Reference to the transposed array.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename T >     // Type of the mapping indices
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::ctranspose( const T* indices, size_t n )
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::ctranspose( const T* indices, size_t n )
 {
-   using std::swap;
-//    constexpr size_t block( BLOCK_SIZE );
-//
-//    if( o_ == n_ && m_ == n_ )
-//    {
-//       for( size_t ii=0UL; ii<m_; ii+=block ) {
-//          const size_t iend( min( ii+block, m_ ) );
-//          for( size_t jj=0UL; jj<ii; jj+=block ) {
-//             const size_t jend( min( jj+block, n_ ) );
-//             for( size_t i=ii; i<iend; ++i ) {
-//                for( size_t j=jj; j<jend; ++j ) {
-//                   cswap( v_[i*nn_+j], v_[j*nn_+i] );
-//                }
-//             }
-//          }
-//          for( size_t i=ii; i<iend; ++i ) {
-//             for( size_t j=ii; j<i; ++j ) {
-//                cswap( v_[i*nn_+j], v_[j*nn_+i] );
-//             }
-//             conjugate( v_[i*nn_+i] );
-//          }
-//       }
-//    }
-//    else
-//    {
-       DynamicArray tmp( ctrans(*this, indices, n ) );
-       swap( tmp );
-//    }
+   BLAZE_USER_ASSERT( n == N, "Invalid number of transpose mapping indices" );
+   MAYBE_UNUSED( n );
+
+   if( transposeInPlace( indices ) ) {
+      ArrayForEach( dims_, nn_, [&]( size_t i ) { conjugate( v_[i] ); } );
+   }
+   else {
+      DynamicArray tmp( permuted( indices, []( Type& a, const Type& b ){ a = conj( b ); } ) );
+      swap( tmp );
+   }
 
    return *this;
 }
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transposition of the array within its current capacity.
+//
+// \param indices Pointer to the \a N mapping indices of the permutation.
+// \return \a true in case the array has been transposed, \a false if not.
+//
+// This function permutes the elements of the array without additional element storage. The
+// padding elements are removed, the densely stored elements are permuted by following the
+// cycles of the permutation, and the padding of the new rows is restored. In case the
+// transposed array does not fit into the current capacity, the array remains unchanged and
+// the function returns \a false.
+*/
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+template< typename T >     // Type of the mapping indices
+inline bool DynamicArray<N, Type, Alloc>::transposeInPlace( const T* indices )
+{
+   std::array< size_t, N > extents;
+   std::array< size_t, N > tdims;
+
+   for( size_t d=0UL; d<N; ++d ) {
+      extents[d] = dims_[N-1UL-d];
+   }
+
+   for( size_t d=0UL; d<N; ++d ) {
+      BLAZE_USER_ASSERT( static_cast<size_t>( indices[d] ) < N, "Invalid transpose mapping index" );
+      tdims[N-1UL-d] = extents[indices[d]];
+   }
+
+   size_t rows( 1UL );
+   size_t trows( 1UL );
+   for( size_t d=1UL; d<N; ++d ) {
+      rows  *= dims_[d];
+      trows *= tdims[d];
+   }
+
+   const size_t nn( addPadding( tdims[0] ) );
+
+   if( trows*nn > capacity_ )
+      return false;
+
+   packPaddedRows( v_, rows, dims_[0], nn_ );
+   permuteDense( v_, extents.data(), indices, N );
+   unpackPaddedRows( v_, trows, tdims[0], nn );
+
+   dims_ = tdims;
+   nn_   = nn;
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Out-of-place permutation of the dimensions of the array.
+//
+// \param indices Pointer to the \a N mapping indices of the permutation.
+// \param op The element-wise assignment operation.
+// \return The permuted array.
+//
+// This function returns a copy of the array with the dimensions permuted according to the given
+// mapping indices, i.e. dimension \a d of the result corresponds to dimension \a indices[d] of
+// the array (both in natural order). In case the innermost dimension is preserved, the elements
+// are moved by contiguous row copies. Otherwise the result dimension that walks the contiguous
+// rows of the array is combined with the innermost dimension of the result into a 2D
+// transposition, which is tiled in blocks of size \a BLOCK_SIZE to keep both the read and the
+// write streams in the cache. All remaining dimensions are traversed in the outer loops.
+*/
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+template< typename T       // Type of the mapping indices
+        , typename OP >    // Type of the element-wise assignment operation
+inline DynamicArray<N, Type, Alloc> DynamicArray<N, Type, Alloc>::permuted( const T* indices, OP op ) const
+{
+   std::array< size_t, N > extents;
+   std::array< size_t, N > strides;
+
+   for( size_t d=0UL; d<N; ++d ) {
+      extents[d] = dims_[N-1UL-d];
+   }
+
+   strides[N-1UL] = 1UL;
+   for( size_t d=N-1UL; d>0UL; --d ) {
+      strides[d-1UL] = ( d == N-1UL ? nn_ : strides[d]*extents[d] );
+   }
+
+   std::array< size_t, N > tdims;
+   std::array< size_t, N > sstrides;
+   size_t x( N-1UL );
+
+   for( size_t d=0UL; d<N; ++d ) {
+      BLAZE_USER_ASSERT( static_cast<size_t>( indices[d] ) < N, "Invalid transpose mapping index" );
+      tdims[N-1UL-d] = extents[indices[d]];
+      sstrides[d]    = strides[indices[d]];
+      if( static_cast<size_t>( indices[d] ) == N-1UL ) x = d;
+   }
+
+   DynamicArray tmp( tdims );
+
+   std::array< size_t, N > textents;
+   std::array< size_t, N > tstrides;
+
+   for( size_t d=0UL; d<N; ++d ) {
+      textents[d] = tdims[N-1UL-d];
+   }
+
+   tstrides[N-1UL] = 1UL;
+   for( size_t d=N-1UL; d>0UL; --d ) {
+      tstrides[d-1UL] = ( d == N-1UL ? tmp.nn_ : tstrides[d]*textents[d] );
+   }
+
+   for( size_t d=0UL; d<N; ++d ) {
+      if( textents[d] == 0UL ) return tmp;
+   }
+
+   const size_t nj( textents[N-1UL] );
+   const size_t sj( sstrides[N-1UL] );
+
+   // Odometer over all outer dimensions (all but the innermost and the blocked dimension)
+   std::array< size_t, N > pos{};
+
+   while( true )
+   {
+      size_t soff( 0UL );
+      size_t toff( 0UL );
+      for( size_t d=0UL; d+1UL<N; ++d ) {
+         soff += pos[d]*sstrides[d];
+         toff += pos[d]*tstrides[d];
+      }
+
+      if( x == N-1UL )
+      {
+         Type* BLAZE_RESTRICT dst( tmp.v_ + toff );
+         const Type* BLAZE_RESTRICT src( v_ + soff );
+         for( size_t j=0UL; j<nj; ++j ) {
+            op( dst[j], src[j] );
+         }
+      }
+      else
+      {
+         const size_t na( textents[x] );
+         for( size_t aa=0UL; aa<na; aa+=BLOCK_SIZE ) {
+            const size_t aend( min( aa+BLOCK_SIZE, na ) );
+            for( size_t jj=0UL; jj<nj; jj+=BLOCK_SIZE ) {
+               const size_t jend( min( jj+BLOCK_SIZE, nj ) );
+               for( size_t a=aa; a<aend; ++a ) {
+                  Type* BLAZE_RESTRICT dst( tmp.v_ + toff + a*tstrides[x] );
+                  const Type* BLAZE_RESTRICT src( v_ + soff + a );
+                  for( size_t j=jj; j<jend; ++j ) {
+                     op( dst[j], src[j*sj] );
+                  }
+               }
+            }
+         }
+      }
+
+      bool next( false );
+      for( size_t d=N-1UL; !next && d-- > 0UL; ) {
+         if( d == x ) continue;
+         if( ++pos[d] < textents[d] ) next = true;
+         else pos[d] = 0UL;
+      }
+
+      if( !next ) break;
+   }
+
+   return tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Scaling of the array by the scalar value \a scalar (\f$ A=B*s \f$).
 //
@@ -2799,10 +3104,11 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::ctranspose( const T* indice
    A.scale( 4 );  // Same effect as above
    \endcode
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the scalar value
-inline DynamicArray<N, Type>& DynamicArray<N, Type>::scale( const Other& scalar )
+inline DynamicArray<N, Type, Alloc>& DynamicArray<N, Type, Alloc>::scale( const Other& scalar )
 {
    ArrayForEach( dims_, nn_, [&]( size_t i ) { v_[i] *= scalar; } );
    return *this;
@@ -2827,9 +3133,10 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::scale( const Other& scalar
 // state is valid. In case the invariants are intact, the function returns \a true, else it
 // will return \a false.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline bool DynamicArray<N, Type>::isIntact() const noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicArray<N, Type, Alloc>::isIntact() const noexcept
 {
    if( calcCapacity() > capacity_ )
       return false;
@@ -2866,10 +3173,11 @@ inline bool DynamicArray<N, Type>::isIntact() const noexcept
 // to the isAliased() function this function is allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool DynamicArray<N, Type>::canAlias( const Other* alias ) const noexcept
+inline bool DynamicArray<N, Type, Alloc>::canAlias( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2886,10 +3194,11 @@ inline bool DynamicArray<N, Type>::canAlias( const Other* alias ) const noexcept
 // to the canAlias() function this function is not allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool DynamicArray<N, Type>::isAliased( const Other* alias ) const noexcept
+inline bool DynamicArray<N, Type, Alloc>::isAliased( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2905,9 +3214,10 @@ inline bool DynamicArray<N, Type>::isAliased( const Other* alias ) const noexcep
 // whether the beginning and the end of each row/column of the array are guaranteed to conform
 // to the alignment restrictions of the element type \a Type.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline bool DynamicArray<N, Type>::isAligned() const noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicArray<N, Type, Alloc>::isAligned() const noexcept
 {
    return ( usePadding || dims_[0] % SIMDSIZE == 0UL );
 }
@@ -2924,11 +3234,12 @@ inline bool DynamicArray<N, Type>::isAligned() const noexcept
 // function additionally provides runtime information (as for instance the current number of
 // rows and/or columns of the array).
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline bool DynamicArray<N, Type>::canSMPAssign() const noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicArray<N, Type, Alloc>::canSMPAssign() const noexcept
 {
-   return ( capacity_ >= SMP_DMATASSIGN_THRESHOLD );
+   return ( capacity_ >= SMP_DARRASSIGN_THRESHOLD );
 }
 //*************************************************************************************************
 
@@ -2948,11 +3259,12 @@ inline bool DynamicArray<N, Type>::canSMPAssign() const noexcept
 // performance optimized evaluation of expression templates. Calling this function explicitly
 // might result in erroneous results and/or in compilation errors.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
-BLAZE_ALWAYS_INLINE typename DynamicArray<N, Type>::SIMDType
-   DynamicArray<N, Type>::load( Dims... dims ) const noexcept
+BLAZE_ALWAYS_INLINE typename DynamicArray<N, Type, Alloc>::SIMDType
+   DynamicArray<N, Type, Alloc>::load( Dims... dims ) const noexcept
 {
    if( usePadding )
       return loada( dims... );
@@ -2977,11 +3289,12 @@ BLAZE_ALWAYS_INLINE typename DynamicArray<N, Type>::SIMDType
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
-BLAZE_ALWAYS_INLINE typename DynamicArray<N, Type>::SIMDType
-   DynamicArray<N, Type>::loada( Dims... dims ) const noexcept
+BLAZE_ALWAYS_INLINE typename DynamicArray<N, Type, Alloc>::SIMDType
+   DynamicArray<N, Type, Alloc>::loada( Dims... dims ) const noexcept
 {
    using blaze::loada;
 
@@ -3018,11 +3331,12 @@ BLAZE_ALWAYS_INLINE typename DynamicArray<N, Type>::SIMDType
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
-BLAZE_ALWAYS_INLINE typename DynamicArray<N, Type>::SIMDType
-   DynamicArray<N, Type>::loadu( Dims... dims ) const noexcept
+BLAZE_ALWAYS_INLINE typename DynamicArray<N, Type, Alloc>::SIMDType
+   DynamicArray<N, Type, Alloc>::loadu( Dims... dims ) const noexcept
 {
    using blaze::loadu;
 
@@ -3058,11 +3372,12 @@ BLAZE_ALWAYS_INLINE typename DynamicArray<N, Type>::SIMDType
 // performance optimized evaluation of expression templates. Calling this function explicitly
 // might result in erroneous results and/or in compilation errors.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
 BLAZE_ALWAYS_INLINE void
-   DynamicArray<N, Type>::store( const SIMDType& value, Dims... dims ) noexcept
+   DynamicArray<N, Type, Alloc>::store( const SIMDType& value, Dims... dims ) noexcept
 {
    if( usePadding )
       storea( value, dims... );
@@ -3088,11 +3403,12 @@ BLAZE_ALWAYS_INLINE void
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
 BLAZE_ALWAYS_INLINE void
-   DynamicArray<N, Type>::storea( const SIMDType& value, Dims... dims ) noexcept
+   DynamicArray<N, Type, Alloc>::storea( const SIMDType& value, Dims... dims ) noexcept
 {
    using blaze::storea;
 
@@ -3129,11 +3445,12 @@ BLAZE_ALWAYS_INLINE void
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
 BLAZE_ALWAYS_INLINE void
-   DynamicArray<N, Type>::storeu( const SIMDType& value, Dims... dims ) noexcept
+   DynamicArray<N, Type, Alloc>::storeu( const SIMDType& value, Dims... dims ) noexcept
 {
    using blaze::storeu;
 
@@ -3169,11 +3486,12 @@ BLAZE_ALWAYS_INLINE void
 // templates. Calling this function explicitly might result in erroneous results and/or in
 // compilation errors.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename... Dims >
 BLAZE_ALWAYS_INLINE void
-   DynamicArray<N, Type>::stream( const SIMDType& value, Dims... dims ) noexcept
+   DynamicArray<N, Type, Alloc>::stream( const SIMDType& value, Dims... dims ) noexcept
 {
    using blaze::stream;
 
@@ -3205,11 +3523,12 @@ BLAZE_ALWAYS_INLINE void
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side dense array
-inline auto DynamicArray<N, Type>::assign( const DenseArray<MT>& rhs )
-   //-> EnableIf_t< !VectorizedAssign_v<MT> >
+inline auto DynamicArray<N, Type, Alloc>::assign( const DenseArray<MT>& rhs )
+   -> EnableIf_t< !VectorizedAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
 
@@ -3235,63 +3554,64 @@ inline auto DynamicArray<N, Type>::assign( const DenseArray<MT>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-//template< size_t N         // The dimensionality of the array
-//        , typename Type >  // Data type of the array
-//template< typename MT >  // Type of the right-hand side dense array
-//inline auto DynamicArray<N, Type>::assign( const DenseArray<MT>& rhs )
-//   -> EnableIf_t< VectorizedAssign_v<MT> >
-//{
-//   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
-//
-//   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
-//
-//   constexpr bool remainder( !usePadding || !IsPadded_v<MT> );
-//
-//   const size_t jpos( ( remainder )?( dims_[0] & size_t(-SIMDSIZE) ):( dims_[0] ) );
-//   BLAZE_INTERNAL_ASSERT( !remainder || ( dims_[0] - ( dims_[0] % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+template< typename MT >  // Type of the right-hand side dense array
+inline auto DynamicArray<N, Type, Alloc>::assign( const DenseArray<MT>& rhs )
+   -> EnableIf_t< VectorizedAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
 
-//    if( usePadding && useStreaming &&
-//        ( o_*m_*n_ > ( cacheSize / ( sizeof(Type) * 3UL ) ) ) && !(~rhs).isAliased( this ) )
-//    {
-//       for (size_t k=0UL; k<o_; ++k) {
-//          for (size_t i=0UL; i<m_; ++i) {
-//             size_t j(0UL);
-//             Iterator left(begin(i, k));
-//             ConstIterator_t<MT> right((~rhs).begin(i, k));
-//
-//             for (; j<jpos; j+=SIMDSIZE, left+=SIMDSIZE, right+=SIMDSIZE) {
-//                left.stream(right.load());
-//             }
-//             for (; remainder && j<n_; ++j, ++left, ++right) {
-//                *left = *right;
-//             }
-//          }
-//       }
-//    }
-//    else
-//    {
-//       for (size_t k=0UL; k<o_; ++k) {
-//          for (size_t i=0UL; i<m_; ++i) {
-//             size_t j(0UL);
-//             Iterator left(begin(i, k));
-//             ConstIterator_t<MT> right((~rhs).begin(i, k));
-//
-//             for (; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL) {
-//                left.store(right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//                left.store(right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//                left.store(right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//                left.store(right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//             }
-//             for (; j<jpos; j+=SIMDSIZE) {
-//                left.store(right.load()); left+=SIMDSIZE, right+=SIMDSIZE;
-//             }
-//             for (; remainder && j<n_; ++j) {
-//                *left = *right; ++left; ++right;
-//             }
-//          }
-//       }
-//    }
-//}
+   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
+
+   constexpr bool remainder( !usePadding || !IsPadded_v<MT> );
+
+   const size_t n( dims_[0] );
+   const size_t jpos( ( remainder )?( n & size_t(-SIMDSIZE) ):( n ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( n - ( n % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
+
+   size_t elements( 1UL );
+   ArrayDimForEach( dims_, [&]( size_t, size_t dim ) { elements *= dim; } );
+
+   if( usePadding && useStreaming &&
+       ( elements > ( cacheSize / ( sizeof(Type) * 3UL ) ) ) && !(~rhs).isAliased( this ) )
+   {
+      ArrayForEachRow( dims_, [&]( std::array< size_t, N > const& dims ) {
+         size_t j(0UL);
+         Iterator left( ArrayRowBegin( *this, dims ) );
+         ConstIterator_t<MT> right( ArrayRowBegin( ~rhs, dims ) );
+
+         for (; j<jpos; j+=SIMDSIZE, left+=SIMDSIZE, right+=SIMDSIZE) {
+            left.stream(right.load());
+         }
+         for (; remainder && j<n; ++j, ++left, ++right) {
+            *left = *right;
+         }
+      } );
+   }
+   else
+   {
+      ArrayForEachRow( dims_, [&]( std::array< size_t, N > const& dims ) {
+         size_t j(0UL);
+         Iterator left( ArrayRowBegin( *this, dims ) );
+         ConstIterator_t<MT> right( ArrayRowBegin( ~rhs, dims ) );
+
+         for (; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL) {
+            left.store(right.load()); left += SIMDSIZE; right += SIMDSIZE;
+            left.store(right.load()); left += SIMDSIZE; right += SIMDSIZE;
+            left.store(right.load()); left += SIMDSIZE; right += SIMDSIZE;
+            left.store(right.load()); left += SIMDSIZE; right += SIMDSIZE;
+         }
+         for (; j<jpos; j+=SIMDSIZE) {
+            left.store(right.load()); left+=SIMDSIZE, right+=SIMDSIZE;
+         }
+         for (; remainder && j<n; ++j) {
+            *left = *right; ++left; ++right;
+         }
+      } );
+   }
+}
 //*************************************************************************************************
 
 
@@ -3306,11 +3626,12 @@ inline auto DynamicArray<N, Type>::assign( const DenseArray<MT>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side dense array
-inline auto DynamicArray<N, Type>::addAssign( const DenseArray<MT>& rhs )
-   //-> EnableIf_t< !VectorizedAddAssign_v<MT> >
+inline auto DynamicArray<N, Type, Alloc>::addAssign( const DenseArray<MT>& rhs )
+   -> EnableIf_t< !VectorizedAddAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
 
@@ -3336,46 +3657,42 @@ inline auto DynamicArray<N, Type>::addAssign( const DenseArray<MT>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-//template< size_t N         // The dimensionality of the array
-//        , typename Type >  // Data type of the array
-//template< typename MT >  // Type of the right-hand side dense array
-//inline auto DynamicArray<N, Type>::addAssign( const DenseArray<MT>& rhs )
-//   -> EnableIf_t< VectorizedAddAssign_v<MT> >
-//{
-//   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
-//
-//   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
-//
-//   constexpr bool remainder( !usePadding || !IsPadded_v<MT> );
-//
-//   for (size_t k=0UL; k<o_; ++k) {
-//      for (size_t i=0UL; i<m_; ++i) {
-//         const size_t jbegin(0UL);
-//         const size_t jend  (n_);
-//         BLAZE_INTERNAL_ASSERT(jbegin <= jend, "Invalid loop indices detected");
-//
-//         const size_t jpos((remainder)?(jend & size_t(-SIMDSIZE)):(jend));
-//         BLAZE_INTERNAL_ASSERT(!remainder || (jend - (jend % (SIMDSIZE))) == jpos, "Invalid end calculation");
-//
-//         size_t j(jbegin);
-//         Iterator left(begin(i, k) + jbegin);
-//         ConstIterator_t<MT> right((~rhs).begin(i, k) + jbegin);
-//
-//         for (; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL) {
-//            left.store(left.load() + right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//            left.store(left.load() + right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//            left.store(left.load() + right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//            left.store(left.load() + right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//         }
-//         for (; j<jpos; j+=SIMDSIZE) {
-//            left.store(left.load() + right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//         }
-//         for (; remainder && j<jend; ++j) {
-//            *left += *right; ++left; ++right;
-//         }
-//      }
-//   }
-//}
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+template< typename MT >  // Type of the right-hand side dense array
+inline auto DynamicArray<N, Type, Alloc>::addAssign( const DenseArray<MT>& rhs )
+   -> EnableIf_t< VectorizedAddAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
+
+   constexpr bool remainder( !usePadding || !IsPadded_v<MT> );
+
+   const size_t n( dims_[0] );
+   const size_t jpos( ( remainder )?( n & size_t(-SIMDSIZE) ):( n ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( n - ( n % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
+
+   ArrayForEachRow( dims_, [&]( std::array< size_t, N > const& dims ) {
+      size_t j(0UL);
+      Iterator left( ArrayRowBegin( *this, dims ) );
+      ConstIterator_t<MT> right( ArrayRowBegin( ~rhs, dims ) );
+
+      for (; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL) {
+         left.store(left.load() + right.load()); left += SIMDSIZE; right += SIMDSIZE;
+         left.store(left.load() + right.load()); left += SIMDSIZE; right += SIMDSIZE;
+         left.store(left.load() + right.load()); left += SIMDSIZE; right += SIMDSIZE;
+         left.store(left.load() + right.load()); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for (; j<jpos; j+=SIMDSIZE) {
+         left.store(left.load() + right.load()); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for (; remainder && j<n; ++j) {
+         *left += *right; ++left; ++right;
+      }
+   } );
+}
 //*************************************************************************************************
 
 
@@ -3390,11 +3707,12 @@ inline auto DynamicArray<N, Type>::addAssign( const DenseArray<MT>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side dense array
-inline auto DynamicArray<N, Type>::subAssign( const DenseArray<MT>& rhs )
-   //-> EnableIf_t< !VectorizedSubAssign_v<MT> >
+inline auto DynamicArray<N, Type, Alloc>::subAssign( const DenseArray<MT>& rhs )
+   -> EnableIf_t< !VectorizedSubAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
 
@@ -3420,47 +3738,42 @@ inline auto DynamicArray<N, Type>::subAssign( const DenseArray<MT>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-//template< size_t N         // The dimensionality of the array
-//        , typename Type >  // Data type of the array
-//template< typename MT >  // Type of the right-hand side dense array
-//inline auto DynamicArray<N, Type>::subAssign( const DenseArray<MT>& rhs )
-//   -> EnableIf_t< VectorizedSubAssign_v<MT> >
-//{
-//   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
-//
-//   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
-//
-//   constexpr bool remainder( !usePadding || !IsPadded_v<MT> );
-//
-//   for (size_t k=0UL; k<o_; ++k) {
-//      for (size_t i=0UL; i<m_; ++i)
-//      {
-//         const size_t jbegin(0UL);
-//         const size_t jend  (n_);
-//         BLAZE_INTERNAL_ASSERT(jbegin <= jend, "Invalid loop indices detected");
-//
-//         const size_t jpos((remainder)?(jend & size_t(-SIMDSIZE)):(jend));
-//         BLAZE_INTERNAL_ASSERT(!remainder || (jend - (jend % (SIMDSIZE))) == jpos, "Invalid end calculation");
-//
-//         size_t j(jbegin);
-//         Iterator left(begin(i, k) + jbegin);
-//         ConstIterator_t<MT> right((~rhs).begin(i, k) + jbegin);
-//
-//         for (; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL) {
-//            left.store(left.load() - right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//            left.store(left.load() - right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//            left.store(left.load() - right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//            left.store(left.load() - right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//         }
-//         for (; j<jpos; j+=SIMDSIZE) {
-//            left.store(left.load() - right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//         }
-//         for (; remainder && j<jend; ++j) {
-//            *left -= *right; ++left; ++right;
-//         }
-//      }
-//   }
-//}
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+template< typename MT >  // Type of the right-hand side dense array
+inline auto DynamicArray<N, Type, Alloc>::subAssign( const DenseArray<MT>& rhs )
+   -> EnableIf_t< VectorizedSubAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
+
+   constexpr bool remainder( !usePadding || !IsPadded_v<MT> );
+
+   const size_t n( dims_[0] );
+   const size_t jpos( ( remainder )?( n & size_t(-SIMDSIZE) ):( n ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( n - ( n % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
+
+   ArrayForEachRow( dims_, [&]( std::array< size_t, N > const& dims ) {
+      size_t j(0UL);
+      Iterator left( ArrayRowBegin( *this, dims ) );
+      ConstIterator_t<MT> right( ArrayRowBegin( ~rhs, dims ) );
+
+      for (; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL) {
+         left.store(left.load() - right.load()); left += SIMDSIZE; right += SIMDSIZE;
+         left.store(left.load() - right.load()); left += SIMDSIZE; right += SIMDSIZE;
+         left.store(left.load() - right.load()); left += SIMDSIZE; right += SIMDSIZE;
+         left.store(left.load() - right.load()); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for (; j<jpos; j+=SIMDSIZE) {
+         left.store(left.load() - right.load()); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for (; remainder && j<n; ++j) {
+         *left -= *right; ++left; ++right;
+      }
+   } );
+}
 //*************************************************************************************************
 
 
@@ -3475,11 +3788,12 @@ inline auto DynamicArray<N, Type>::subAssign( const DenseArray<MT>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side dense array
-inline auto DynamicArray<N, Type>::schurAssign( const DenseArray<MT>& rhs )
-   //-> EnableIf_t< !VectorizedSchurAssign_v<MT> >
+inline auto DynamicArray<N, Type, Alloc>::schurAssign( const DenseArray<MT>& rhs )
+   -> EnableIf_t< !VectorizedSchurAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
 
@@ -3505,43 +3819,42 @@ inline auto DynamicArray<N, Type>::schurAssign( const DenseArray<MT>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-//template< size_t N         // The dimensionality of the array
-//        , typename Type >  // Data type of the array
-//template< typename MT >  // Type of the right-hand side dense array
-//inline auto DynamicArray<N, Type>::schurAssign( const DenseArray<MT>& rhs )
-//   -> EnableIf_t< VectorizedSchurAssign_v<MT> >
-//{
-//   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
-//
-//   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
-//
-//   constexpr bool remainder( !usePadding || !IsPadded_v<MT> );
-//
-//   for (size_t k=0UL; k<o_; ++k) {
-//      for (size_t i=0UL; i<m_; ++i)
-//      {
-//         const size_t jpos((remainder)?(n_ & size_t(-SIMDSIZE)):(n_));
-//         BLAZE_INTERNAL_ASSERT(!remainder || (n_ - (n_ % (SIMDSIZE))) == jpos, "Invalid end calculation");
-//
-//         size_t j(0UL);
-//         Iterator left(begin(i, k));
-//         ConstIterator_t<MT> right((~rhs).begin(i, k));
-//
-//         for (; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL) {
-//            left.store(left.load() * right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//            left.store(left.load() * right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//            left.store(left.load() * right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//            left.store(left.load() * right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//         }
-//         for (; j<jpos; j+=SIMDSIZE) {
-//            left.store(left.load() * right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//         }
-//         for (; remainder && j<n_; ++j) {
-//            *left *= *right; ++left; ++right;
-//         }
-//      }
-//   }
-//}
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+template< typename MT >  // Type of the right-hand side dense array
+inline auto DynamicArray<N, Type, Alloc>::schurAssign( const DenseArray<MT>& rhs )
+   -> EnableIf_t< VectorizedSchurAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
+
+   constexpr bool remainder( !usePadding || !IsPadded_v<MT> );
+
+   const size_t n( dims_[0] );
+   const size_t jpos( ( remainder )?( n & size_t(-SIMDSIZE) ):( n ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( n - ( n % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
+
+   ArrayForEachRow( dims_, [&]( std::array< size_t, N > const& dims ) {
+      size_t j(0UL);
+      Iterator left( ArrayRowBegin( *this, dims ) );
+      ConstIterator_t<MT> right( ArrayRowBegin( ~rhs, dims ) );
+
+      for (; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL) {
+         left.store(left.load() * right.load()); left += SIMDSIZE; right += SIMDSIZE;
+         left.store(left.load() * right.load()); left += SIMDSIZE; right += SIMDSIZE;
+         left.store(left.load() * right.load()); left += SIMDSIZE; right += SIMDSIZE;
+         left.store(left.load() * right.load()); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for (; j<jpos; j+=SIMDSIZE) {
+         left.store(left.load() * right.load()); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for (; remainder && j<n; ++j) {
+         *left *= *right; ++left; ++right;
+      }
+   } );
+}
 //*************************************************************************************************
 
 
@@ -3558,31 +3871,36 @@ inline auto DynamicArray<N, Type>::schurAssign( const DenseArray<MT>& rhs )
 //*************************************************************************************************
 /*!\name DynamicArray operators */
 //@{
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline void reset( DynamicArray<N, Type>& m );
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline void reset( DynamicArray<N, Type, Alloc>& m );
 
 template< size_t N            // The dimensionality of the array
         , typename Type       // Data type of the array
+        , typename Alloc      // Type of the allocator
         , typename... Dims >  // list of row indices
-inline void reset( DynamicArray<N, Type>& m, size_t i, Dims... dims );
+inline void reset( DynamicArray<N, Type, Alloc>& m, size_t i, Dims... dims );
 
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline void clear( DynamicArray<N, Type>& m );
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline void clear( DynamicArray<N, Type, Alloc>& m );
 
 template< bool RF
         , size_t N         // The dimensionality of the array
         , typename Type >  // Data type of the array
-inline bool isDefault( const DynamicArray<N, Type>& m );
+inline bool isDefault( const DynamicArray<N, Type, Alloc>& m );
 
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline bool isIntact( const DynamicArray<N, Type>& m ) noexcept;
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline bool isIntact( const DynamicArray<N, Type, Alloc>& m ) noexcept;
 
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline void swap( DynamicArray<N, Type>& a, DynamicArray<N, Type>& b ) noexcept;
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline void swap( DynamicArray<N, Type, Alloc>& a, DynamicArray<N, Type, Alloc>& b ) noexcept;
 //@}
 //*************************************************************************************************
 
@@ -3594,9 +3912,10 @@ inline void swap( DynamicArray<N, Type>& a, DynamicArray<N, Type>& b ) noexcept;
 // \param m The array to be resetted.
 // \return void
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline void reset( DynamicArray<N, Type>& m )
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline void reset( DynamicArray<N, Type, Alloc>& m )
 {
    m.reset();
 }
@@ -3619,8 +3938,9 @@ inline void reset( DynamicArray<N, Type>& m )
 */
 template< size_t N            // The dimensionality of the array
         , typename Type       // Data type of the array
+        , typename Alloc      // Type of the allocator
         , typename... Dims >  // list of row indices
-inline void reset( DynamicArray<N, Type>& m, size_t i, Dims... dims )
+inline void reset( DynamicArray<N, Type, Alloc>& m, size_t i, Dims... dims )
 {
    m.reset( i, dims... );
 }
@@ -3634,9 +3954,10 @@ inline void reset( DynamicArray<N, Type>& m, size_t i, Dims... dims )
 // \param m The array to be cleared.
 // \return void
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline void clear( DynamicArray<N, Type>& m )
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline void clear( DynamicArray<N, Type, Alloc>& m )
 {
    m.clear();
 }
@@ -3671,7 +3992,7 @@ inline void clear( DynamicArray<N, Type>& m )
 template< bool RF        // Relaxation flag
         , size_t N         // The dimensionality of the array
         , typename Type >  // Data type of the array
-inline bool isDefault( const DynamicArray<N, Type>& m )
+inline bool isDefault( const DynamicArray<N, Type, Alloc>& m )
 {
    auto const& dims = m.dimensions();
    return ArrayDimAllOf( dims, [&]( size_t, size_t dim ) { return dim == 0; } );
@@ -3697,9 +4018,10 @@ inline bool isDefault( const DynamicArray<N, Type>& m )
    if( isIntact( A ) ) { ... }
    \endcode
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline bool isIntact( const DynamicArray<N, Type>& m ) noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline bool isIntact( const DynamicArray<N, Type, Alloc>& m ) noexcept
 {
    return m.isIntact();
 }
@@ -3714,9 +4036,10 @@ inline bool isIntact( const DynamicArray<N, Type>& m ) noexcept
 // \param b The second array to be swapped.
 // \return void
 */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-inline void swap( DynamicArray<N, Type>& a, DynamicArray<N, Type>& b ) noexcept
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+inline void swap( DynamicArray<N, Type, Alloc>& a, DynamicArray<N, Type, Alloc>& b ) noexcept
 {
    a.swap( b );
 }
@@ -3733,9 +4056,10 @@ inline void swap( DynamicArray<N, Type>& a, DynamicArray<N, Type>& b ) noexcept
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-struct HasConstDataAccess< DynamicArray<N, Type> >
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+struct HasConstDataAccess< DynamicArray<N, Type, Alloc> >
    : public TrueType
 {};
 /*! \endcond */
@@ -3752,9 +4076,10 @@ struct HasConstDataAccess< DynamicArray<N, Type> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-struct HasMutableDataAccess< DynamicArray<N, Type> >
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+struct HasMutableDataAccess< DynamicArray<N, Type, Alloc> >
    : public TrueType
 {};
 /*! \endcond */
@@ -3771,9 +4096,10 @@ struct HasMutableDataAccess< DynamicArray<N, Type> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-struct IsAligned< DynamicArray<N, Type> >
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+struct IsAligned< DynamicArray<N, Type, Alloc> >
    : public BoolConstant<usePadding>
 {};
 /*! \endcond */
@@ -3790,9 +4116,10 @@ struct IsAligned< DynamicArray<N, Type> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-struct IsContiguous< DynamicArray<N, Type> >
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+struct IsContiguous< DynamicArray<N, Type, Alloc> >
    : public TrueType
 {};
 /*! \endcond */
@@ -3809,9 +4136,10 @@ struct IsContiguous< DynamicArray<N, Type> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-struct IsPadded< DynamicArray<N, Type> >
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+struct IsPadded< DynamicArray<N, Type, Alloc> >
    : public BoolConstant<usePadding>
 {};
 /*! \endcond */
@@ -3828,9 +4156,10 @@ struct IsPadded< DynamicArray<N, Type> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-struct IsResizable< DynamicArray<N, Type> >
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+struct IsResizable< DynamicArray<N, Type, Alloc> >
    : public TrueType
 {};
 /*! \endcond */
@@ -3847,9 +4176,10 @@ struct IsResizable< DynamicArray<N, Type> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< size_t N         // The dimensionality of the array
-        , typename Type >  // Data type of the array
-struct IsShrinkable< DynamicArray<N, Type> >
+template< size_t N          // The dimensionality of the array
+        , typename Type     // Data type of the array
+        , typename Alloc >  // Type of the allocator
+struct IsShrinkable< DynamicArray<N, Type, Alloc> >
    : public TrueType
 {};
 /*! \endcond */
@@ -3976,15 +4306,15 @@ struct IsShrinkable< DynamicArray<N, Type> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< size_t N, typename ET1, typename T2 >
-struct MultTraitEval2< DynamicArray<N, ET1>, T2
+template< size_t N, typename ET1, typename A1, typename T2 >
+struct MultTraitEval2< DynamicArray<N, ET1, A1>, T2
                      , EnableIf_t< IsNumeric_v<T2>  > >
 {
    using Type = DynamicArray< N, MultTrait_t<ET1,T2> >;
 };
 
-template< typename T1, size_t N, typename ET2 >
-struct MultTraitEval2< T1, DynamicArray<N, ET2>
+template< typename T1, size_t N, typename ET2, typename A2 >
+struct MultTraitEval2< T1, DynamicArray<N, ET2, A2>
                      , EnableIf_t< IsNumeric_v<T1> > >
 {
    using Type = DynamicArray< N, MultTrait_t<T1,ET2> >;
@@ -4027,8 +4357,8 @@ struct MultTraitEval2< T1, DynamicArray<N, ET2>
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< size_t N, typename ET1, typename T2 >
-struct DivTraitEval2< DynamicArray<N, ET1>, T2
+template< size_t N, typename ET1, typename A1, typename T2 >
+struct DivTraitEval2< DynamicArray<N, ET1, A1>, T2
                     , EnableIf_t< IsNumeric_v<T2> > >
 {
    using Type = DynamicArray< N, DivTrait_t<ET1,T2> >;
@@ -4047,8 +4377,8 @@ struct DivTraitEval2< DynamicArray<N, ET1>, T2
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename ET, size_t I >
-struct QuatSliceTraitEval2< DynamicArray<4, ET>, I >
+template< typename ET, typename A, size_t I >
+struct QuatSliceTraitEval2< DynamicArray<4, ET, A>, I >
 {
    using Type = DynamicTensor< ET >;
 };
@@ -4065,8 +4395,8 @@ struct QuatSliceTraitEval2< DynamicArray<4, ET>, I >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< size_t N, typename ET, typename OP >
-struct UnaryMapTraitEval2< DynamicArray<N, ET>, OP>
+template< size_t N, typename ET, typename A, typename OP >
+struct UnaryMapTraitEval2< DynamicArray<N, ET, A>, OP>
 {
    using Type = DynamicArray< N, MapTrait_t<ET,OP> >;
 };
@@ -4076,8 +4406,8 @@ struct UnaryMapTraitEval2< DynamicArray<N, ET>, OP>
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< size_t N, typename ET1, typename ET2, typename OP >
-struct BinaryMapTraitEval2< DynamicArray< N, ET1 > , DynamicArray< N, ET2 >, OP >
+template< size_t N, typename ET1, typename A1, typename ET2, typename A2, typename OP >
+struct BinaryMapTraitEval2< DynamicArray< N, ET1, A1 > , DynamicArray< N, ET2, A2 >, OP >
 {
    using Type = DynamicArray< N, MapTrait_t<ET1,ET2,OP> >;
 };
@@ -4140,6 +4470,27 @@ struct BinaryMapTraitEval2< DynamicArray< N, ET1 > , DynamicArray< N, ET2 >, OP
 
 
 
+//=================================================================================================
+//
+//  TEMPORARYTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if BLAZE_USE_ARENA_TEMPORARIES
+template< size_t N, typename ET, typename A >
+struct TemporaryTrait< DynamicArray<N, ET, A> >
+{
+   using Type = DynamicArray< N, ET, ArenaAllocator<ET> >;
+};
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  HIGHTYPE SPECIALIZATIONS
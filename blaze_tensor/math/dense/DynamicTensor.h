@@ -41,8 +41,11 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <blaze/math/shims/Conjugate.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 
+#include <blaze_tensor/config/Arena.h>
 #include <blaze_tensor/math/Forward.h>
 #include <blaze_tensor/math/InitializerList.h>
 #include <blaze_tensor/math/SMP.h>
@@ -57,10 +60,13 @@
 #include <blaze_tensor/math/traits/RavelTrait.h>
 #include <blaze_tensor/math/traits/RowSliceTrait.h>
 #include <blaze_tensor/math/traits/SubtensorTrait.h>
+#include <blaze_tensor/math/traits/TemporaryTrait.h>
 #include <blaze_tensor/math/typetraits/IsDenseArray.h>
 #include <blaze_tensor/math/typetraits/IsDenseTensor.h>
 #include <blaze_tensor/math/typetraits/IsRowMajorTensor.h>
 #include <blaze_tensor/math/typetraits/IsTensor.h>
+#include <blaze_tensor/util/ArenaAllocator.h>
+#include <blaze_tensor/util/Memory.h>
 
 namespace blaze {
 
@@ -82,12 +88,16 @@ namespace blaze {
 // and the storage order of the tensor can be specified via the two template parameters:
 
    \code
-   template< typename Type >
+   template< typename Type, typename Alloc >
    class DynamicTensor;
    \endcode
 
-//  - Type: specifies the type of the tensor elements. DynamicTensor can be used with any
-//          non-cv-qualified, non-reference, non-pointer element type.
+//  - Type : specifies the type of the tensor elements. DynamicTensor can be used with any
+//           non-cv-qualified, non-reference, non-pointer element type.
+//  - Alloc: specifies the type of the allocator used for the tensor elements. The allocator has
+//           to be default constructible and stateless, i.e. any two instances have to be able
+//           to deallocate memory allocated by the other. The default is AlignedAllocator<Type>.
+//           See ArenaAllocator for a thread-local arena allocator for temporary tensors.
 //
 // The use of DynamicTensor is very natural and intuitive. All operations (addition, subtraction,
 // multiplication, scaling, ...) can be performed on all possible combinations of matrices with
@@ -124,9 +134,10 @@ namespace blaze {
    F *= A * D;    // Multiplication assignment
    \endcode
 */
-template< typename Type >                   // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 class DynamicTensor
-   : public DenseTensor< DynamicTensor<Type> >
+   : public DenseTensor< DynamicTensor<Type,Alloc> >
 {
  private:
    //**********************************************************************************************
@@ -136,11 +147,11 @@ class DynamicTensor
 
  public:
    //**Type definitions****************************************************************************
-   using This          = DynamicTensor<Type>;       //!< Type of this DynamicTensor instance.
+   using This          = DynamicTensor<Type,Alloc>;       //!< Type of this DynamicTensor instance.
    using BaseType      = DenseTensor<This>;         //!< Base type of this DynamicTensor instance.
    using ResultType    = This;                      //!< Result type for expression template evaluations.
-   using OppositeType  = DynamicTensor<Type>;       //!< Result type with opposite storage order for expression template evaluations.
-   using TransposeType = DynamicTensor<Type>;       //!< Transpose type for expression template evaluations.
+   using OppositeType  = DynamicTensor<Type,Alloc>;       //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = DynamicTensor<Type,Alloc>;       //!< Transpose type for expression template evaluations.
    using ElementType   = Type;                      //!< Type of the tensor elements.
    using SIMDType      = SIMDTrait_t<ElementType>;  //!< SIMD type of the tensor elements.
    using ReturnType    = const Type&;               //!< Return type for expression template evaluations.
@@ -160,7 +171,8 @@ class DynamicTensor
    */
    template< typename NewType >  // Data type of the other tensor
    struct Rebind {
-      using Other = DynamicTensor<NewType>;  //!< The type of the other DynamicTensor.
+      //! The type of the other DynamicTensor.
+      using Other = DynamicTensor< NewType, typename std::allocator_traits<Alloc>::template rebind_alloc<NewType> >;
    };
    //**********************************************************************************************
 
@@ -171,7 +183,7 @@ class DynamicTensor
            , size_t NewM    // Number of rows of the other tensor
            , size_t NewN >  // Number of columns of the other tensor
    struct Resize {
-      using Other = DynamicTensor<Type>;  //!< The type of the other DynamicTensor.
+      using Other = DynamicTensor<Type,Alloc>;  //!< The type of the other DynamicTensor.
    };
    //**********************************************************************************************
 
@@ -406,6 +418,12 @@ class DynamicTensor
    /*!\name Utility functions */
    //@{
    inline size_t addPadding( size_t value ) const noexcept;
+
+   static inline Type* allocateStorage  ( size_t n );
+   static inline void  deallocateStorage( Type* ptr, size_t n ) noexcept;
+
+   template< typename T >
+   inline bool transposeInPlace( const T* indices );
    //@}
    //**********************************************************************************************
 
@@ -453,8 +471,9 @@ class DynamicTensor
 //*************************************************************************************************
 /*!\brief The default constructor for DynamicTensor.
 */
-template< typename Type > // Data type of the tensor
-inline DynamicTensor<Type>::DynamicTensor() noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline DynamicTensor<Type,Alloc>::DynamicTensor() noexcept
    : o_       ( 0UL )      // The current number of pages of the tensor
    , m_       ( 0UL )      // The current number of rows of the tensor
    , n_       ( 0UL )      // The current number of columns of the tensor
@@ -474,14 +493,15 @@ inline DynamicTensor<Type>::DynamicTensor() noexcept
 // \note This constructor is only responsible to allocate the required dynamic memory. No
 // element initialization is performed!
 */
-template< typename Type > // Data type of the tensor
-inline DynamicTensor<Type>::DynamicTensor( size_t o, size_t m, size_t n )
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline DynamicTensor<Type,Alloc>::DynamicTensor( size_t o, size_t m, size_t n )
    : o_       ( o )                            // The current number of pages of the tensor
    , m_       ( m )                            // The current number of rows of the tensor
    , n_       ( n )                            // The current number of columns of the tensor
    , nn_      ( addPadding( n ) )              // The alignment adjusted number of columns
    , capacity_( m_*nn_*o_ )                    // The maximum capacity of the tensor
-   , v_       ( allocate<Type>( capacity_ ) )  // The tensor elements
+   , v_       ( allocateStorage( capacity_ ) )  // The tensor elements
 {
    if( IsVectorizable_v<Type> ) {
       for (size_t k=0UL; k<o_; ++k) {
@@ -508,8 +528,9 @@ inline DynamicTensor<Type>::DynamicTensor( size_t o, size_t m, size_t n )
 //
 // All tensor elements are initialized with the specified value.
 */
-template< typename Type > // Data type of the tensor
-inline DynamicTensor<Type>::DynamicTensor( size_t o, size_t m, size_t n, const Type& init )
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline DynamicTensor<Type,Alloc>::DynamicTensor( size_t o, size_t m, size_t n, const Type& init )
    : DynamicTensor( o, m, n )
 {
    for (size_t k=0UL; k<o; ++k) {
@@ -549,8 +570,9 @@ inline DynamicTensor<Type>::DynamicTensor( size_t o, size_t m, size_t n, const T
 // initialized by the values of the given initializer list. Missing values are initialized as
 // default (as e.g. the value 6 in the example).
 */
-template< typename Type > // Data type of the tensor
-inline DynamicTensor<Type>::DynamicTensor( initializer_list< initializer_list< initializer_list<Type> > > list )
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline DynamicTensor<Type,Alloc>::DynamicTensor( initializer_list< initializer_list< initializer_list<Type> > > list )
    : DynamicTensor( list.size(), determineRows( list ), determineColumns( list ) )
 {
    size_t k( 0UL );
@@ -592,9 +614,10 @@ inline DynamicTensor<Type>::DynamicTensor( initializer_list< initializer_list< i
 // from the given array. Note that it is expected that the given \a array has at least \a m by
 // \a n elements. Providing an array with less elements results in undefined behavior!
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the initialization array
-inline DynamicTensor<Type>::DynamicTensor( size_t o, size_t m, size_t n, const Other* array )
+inline DynamicTensor<Type,Alloc>::DynamicTensor( size_t o, size_t m, size_t n, const Other* array )
    : DynamicTensor( o, m, n )
 {
    for (size_t k=0UL; k<o; ++k) {
@@ -638,12 +661,13 @@ inline DynamicTensor<Type>::DynamicTensor( size_t o, size_t m, size_t n, const O
 // the given array. Missing values are initialized with default values (as e.g. the value 6 in
 // the example).
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename Other  // Data type of the initialization array
         , size_t Rows     // Number of rows of the initialization array
         , size_t Cols     // Number of columns of the initialization array
         , size_t Pages >  // Number of pages of the initialization array
-inline DynamicTensor<Type>::DynamicTensor( const Other (&array)[Pages][Rows][Cols] )
+inline DynamicTensor<Type,Alloc>::DynamicTensor( const Other (&array)[Pages][Rows][Cols] )
    : DynamicTensor( Pages, Rows, Cols )
 {
    for (size_t k=0UL; k<Pages; ++k) {
@@ -668,8 +692,9 @@ inline DynamicTensor<Type>::DynamicTensor( const Other (&array)[Pages][Rows][Col
 // The copy constructor is explicitly defined due to the required dynamic memory management
 // and in order to enable/facilitate NRV optimization.
 */
-template< typename Type > // Data type of the tensor
-inline DynamicTensor<Type>::DynamicTensor( const DynamicTensor& m )
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline DynamicTensor<Type,Alloc>::DynamicTensor( const DynamicTensor& m )
    : DynamicTensor( m.o_, m.m_, m.n_ )
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
@@ -686,8 +711,9 @@ inline DynamicTensor<Type>::DynamicTensor( const DynamicTensor& m )
 //
 // \param m The tensor to be move into this instance.
 */
-template< typename Type > // Data type of the tensor
-inline DynamicTensor<Type>::DynamicTensor( DynamicTensor&& m ) noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline DynamicTensor<Type,Alloc>::DynamicTensor( DynamicTensor&& m ) noexcept
    : o_       ( m.o_        )  // The current number of pages of the tensor
    , m_       ( m.m_        )  // The current number of rows of the tensor
    , n_       ( m.n_        )  // The current number of columns of the tensor
@@ -710,9 +736,10 @@ inline DynamicTensor<Type>::DynamicTensor( DynamicTensor&& m ) noexcept
 //
 // \param m Tensor to be copied.
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename MT >   // Type of the foreign tensor
-inline DynamicTensor<Type>::DynamicTensor( const Tensor<MT>& m )
+inline DynamicTensor<Type,Alloc>::DynamicTensor( const Tensor<MT>& m )
    : DynamicTensor( (~m).pages(), (~m).rows(), (~m).columns() )
 {
    smpAssign( *this, ~m );
@@ -733,10 +760,11 @@ inline DynamicTensor<Type>::DynamicTensor( const Tensor<MT>& m )
 //*************************************************************************************************
 /*!\brief The destructor for DynamicTensor.
 */
-template< typename Type > // Data type of the tensor
-inline DynamicTensor<Type>::~DynamicTensor()
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline DynamicTensor<Type,Alloc>::~DynamicTensor()
 {
-   deallocate( v_ );
+   deallocateStorage( v_, capacity_ );
 }
 //*************************************************************************************************
 
@@ -760,9 +788,10 @@ inline DynamicTensor<Type>::~DynamicTensor()
 // This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
 // the at() function is guaranteed to perform a check of the given access indices.
 */
-template< typename Type > // Data type of the tensor
-inline typename DynamicTensor<Type>::Reference
-   DynamicTensor<Type>::operator()( size_t k, size_t i, size_t j ) noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicTensor<Type,Alloc>::Reference
+   DynamicTensor<Type,Alloc>::operator()( size_t k, size_t i, size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
@@ -783,9 +812,10 @@ inline typename DynamicTensor<Type>::Reference
 // This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
 // the at() function is guaranteed to perform a check of the given access indices.
 */
-template< typename Type > // Data type of the tensor
-inline typename DynamicTensor<Type>::ConstReference
-   DynamicTensor<Type>::operator()( size_t k, size_t i, size_t j ) const noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicTensor<Type,Alloc>::ConstReference
+   DynamicTensor<Type,Alloc>::operator()( size_t k, size_t i, size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
@@ -807,9 +837,10 @@ inline typename DynamicTensor<Type>::ConstReference
 // In contrast to the subscript operator this function always performs a check of the given
 // access indices.
 */
-template< typename Type > // Data type of the tensor
-inline typename DynamicTensor<Type>::Reference
-   DynamicTensor<Type>::at( size_t k, size_t i, size_t j )
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicTensor<Type,Alloc>::Reference
+   DynamicTensor<Type,Alloc>::at( size_t k, size_t i, size_t j )
 {
    if( i >= m_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
@@ -837,9 +868,10 @@ inline typename DynamicTensor<Type>::Reference
 // In contrast to the subscript operator this function always performs a check of the given
 // access indices.
 */
-template< typename Type > // Data type of the tensor
-inline typename DynamicTensor<Type>::ConstReference
-   DynamicTensor<Type>::at( size_t k, size_t i, size_t j ) const
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicTensor<Type,Alloc>::ConstReference
+   DynamicTensor<Type,Alloc>::at( size_t k, size_t i, size_t j ) const
 {
    if( i >= m_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
@@ -867,9 +899,10 @@ inline typename DynamicTensor<Type>::ConstReference
 // respectively, the total number of elements including padding is given by the \c spacing()
 // member function.
 */
-template< typename Type > // Data type of the tensor
-inline typename DynamicTensor<Type>::Pointer
-   DynamicTensor<Type>::data() noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicTensor<Type,Alloc>::Pointer
+   DynamicTensor<Type,Alloc>::data() noexcept
 {
    return v_;
 }
@@ -888,9 +921,10 @@ inline typename DynamicTensor<Type>::Pointer
 // respectively, the total number of elements including padding is given by the \c spacing()
 // member function.
 */
-template< typename Type > // Data type of the tensor
-inline typename DynamicTensor<Type>::ConstPointer
-   DynamicTensor<Type>::data() const noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicTensor<Type,Alloc>::ConstPointer
+   DynamicTensor<Type,Alloc>::data() const noexcept
 {
    return v_;
 }
@@ -906,9 +940,10 @@ inline typename DynamicTensor<Type>::ConstPointer
 //
 // This function returns a pointer to the internal storage for the elements in row/column \a i.
 */
-template< typename Type > // Data type of the tensor
-inline typename DynamicTensor<Type>::Pointer
-   DynamicTensor<Type>::data( size_t i, size_t k ) noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicTensor<Type,Alloc>::Pointer
+   DynamicTensor<Type,Alloc>::data( size_t i, size_t k ) noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense tensor row access index" );
    BLAZE_USER_ASSERT( k < o_, "Invalid dense tensor row access index" );
@@ -926,9 +961,10 @@ inline typename DynamicTensor<Type>::Pointer
 //
 // This function returns a pointer to the internal storage for the elements in row/column \a i.
 */
-template< typename Type > // Data type of the tensor
-inline typename DynamicTensor<Type>::ConstPointer
-   DynamicTensor<Type>::data( size_t i, size_t k ) const noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicTensor<Type,Alloc>::ConstPointer
+   DynamicTensor<Type,Alloc>::data( size_t i, size_t k ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense tensor row access index" );
    BLAZE_USER_ASSERT( k < o_, "Invalid dense tensor page access index" );
@@ -949,9 +985,10 @@ inline typename DynamicTensor<Type>::ConstPointer
 // of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
 // to the first element of column \a i.
 */
-template< typename Type > // Data type of the tensor
-inline typename DynamicTensor<Type>::Iterator
-   DynamicTensor<Type>::begin( size_t i, size_t k ) noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicTensor<Type,Alloc>::Iterator
+   DynamicTensor<Type,Alloc>::begin( size_t i, size_t k ) noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense tensor row access index" );
    BLAZE_USER_ASSERT( k < o_, "Invalid dense tensor page access index" );
@@ -972,9 +1009,10 @@ inline typename DynamicTensor<Type>::Iterator
 // of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
 // to the first element of column \a i.
 */
-template< typename Type > // Data type of the tensor
-inline typename DynamicTensor<Type>::ConstIterator
-   DynamicTensor<Type>::begin( size_t i, size_t k ) const noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicTensor<Type,Alloc>::ConstIterator
+   DynamicTensor<Type,Alloc>::begin( size_t i, size_t k ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense tensor row access index" );
    BLAZE_USER_ASSERT( k < o_, "Invalid dense tensor page access index" );
@@ -995,9 +1033,10 @@ inline typename DynamicTensor<Type>::ConstIterator
 // of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
 // to the first element of column \a i.
 */
-template< typename Type > // Data type of the tensor
-inline typename DynamicTensor<Type>::ConstIterator
-   DynamicTensor<Type>::cbegin( size_t i, size_t k ) const noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicTensor<Type,Alloc>::ConstIterator
+   DynamicTensor<Type,Alloc>::cbegin( size_t i, size_t k ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense tensor row access index" );
    BLAZE_USER_ASSERT( k < o_, "Invalid dense tensor page access index" );
@@ -1018,9 +1057,10 @@ inline typename DynamicTensor<Type>::ConstIterator
 // the last element of row \a i, in case the storage flag is set to \a columnMajor the function
 // returns an iterator just past the last element of column \a i.
 */
-template< typename Type > // Data type of the tensor
-inline typename DynamicTensor<Type>::Iterator
-   DynamicTensor<Type>::end( size_t i, size_t k ) noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicTensor<Type,Alloc>::Iterator
+   DynamicTensor<Type,Alloc>::end( size_t i, size_t k ) noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense tensor row access index" );
    BLAZE_USER_ASSERT( k < o_, "Invalid dense tensor page access index" );
@@ -1041,9 +1081,10 @@ inline typename DynamicTensor<Type>::Iterator
 // the last element of row \a i, in case the storage flag is set to \a columnMajor the function
 // returns an iterator just past the last element of column \a i.
 */
-template< typename Type > // Data type of the tensor
-inline typename DynamicTensor<Type>::ConstIterator
-   DynamicTensor<Type>::end( size_t i, size_t k ) const noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicTensor<Type,Alloc>::ConstIterator
+   DynamicTensor<Type,Alloc>::end( size_t i, size_t k ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense tensor row access index" );
    BLAZE_USER_ASSERT( k < o_, "Invalid dense tensor page access index" );
@@ -1064,9 +1105,10 @@ inline typename DynamicTensor<Type>::ConstIterator
 // the last element of row \a i, in case the storage flag is set to \a columnMajor the function
 // returns an iterator just past the last element of column \a i.
 */
-template< typename Type > // Data type of the tensor
-inline typename DynamicTensor<Type>::ConstIterator
-   DynamicTensor<Type>::cend( size_t i, size_t k ) const noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline typename DynamicTensor<Type,Alloc>::ConstIterator
+   DynamicTensor<Type,Alloc>::cend( size_t i, size_t k ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense tensor row access index" );
    BLAZE_USER_ASSERT( k < o_, "Invalid dense tensor page access index" );
@@ -1089,8 +1131,9 @@ inline typename DynamicTensor<Type>::ConstIterator
 // \param rhs Scalar value to be assigned to all tensor elements.
 // \return Reference to the assigned tensor.
 */
-template< typename Type > // Data type of the tensor
-inline DynamicTensor<Type>& DynamicTensor<Type>::operator=(const Type& rhs)
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline DynamicTensor<Type,Alloc>& DynamicTensor<Type,Alloc>::operator=(const Type& rhs)
 {
    for (size_t k=0UL; k<o_; ++k) {
       for (size_t i=0UL; i<m_; ++i) {
@@ -1126,9 +1169,10 @@ inline DynamicTensor<Type>& DynamicTensor<Type>::operator=(const Type& rhs)
 // assigned the values from the given initializer list. Missing values are initialized as
 // default (as e.g. the value 6 in the example).
 */
-template< typename Type > // Data type of the tensor
-inline DynamicTensor<Type>&
-   DynamicTensor<Type>::operator=( initializer_list< initializer_list<initializer_list<Type> > > list )
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline DynamicTensor<Type,Alloc>&
+   DynamicTensor<Type,Alloc>::operator=( initializer_list< initializer_list<initializer_list<Type> > > list )
 {
    resize( list.size(), determineRows( list ), determineColumns( list ), false );
 
@@ -1175,12 +1219,13 @@ inline DynamicTensor<Type>&
 // The tensor is resized according to the size of the array and assigned the values of the given
 // array. Missing values are initialized with default values (as e.g. the value 6 in the example).
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename Other  // Data type of the initialization array
         , size_t Rows     // Number of rows of the initialization array
         , size_t Cols     // Number of columns of the initialization array
         , size_t Pages >  // Number of pages of the initialization array
-inline DynamicTensor<Type>& DynamicTensor<Type>::operator=( const Other (&array)[Pages][Rows][Cols] )
+inline DynamicTensor<Type,Alloc>& DynamicTensor<Type,Alloc>::operator=( const Other (&array)[Pages][Rows][Cols] )
 {
    resize( Pages, Rows, Cols, false );
 
@@ -1205,8 +1250,9 @@ inline DynamicTensor<Type>& DynamicTensor<Type>::operator=( const Other (&array)
 // The tensor is resized according to the given \f$ M \times N \f$ tensor and initialized as a
 // copy of this tensor.
 */
-template< typename Type > // Data type of the tensor
-inline DynamicTensor<Type>& DynamicTensor<Type>::operator=( const DynamicTensor& rhs )
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline DynamicTensor<Type,Alloc>& DynamicTensor<Type,Alloc>::operator=( const DynamicTensor& rhs )
 {
    if( &rhs == this ) return *this;
 
@@ -1226,10 +1272,11 @@ inline DynamicTensor<Type>& DynamicTensor<Type>::operator=( const DynamicTensor&
 // \param rhs The tensor to be moved into this instance.
 // \return Reference to the assigned tensor.
 */
-template< typename Type > // Data type of the tensor
-inline DynamicTensor<Type>& DynamicTensor<Type>::operator=( DynamicTensor&& rhs ) noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline DynamicTensor<Type,Alloc>& DynamicTensor<Type,Alloc>::operator=( DynamicTensor&& rhs ) noexcept
 {
-   deallocate( v_ );
+   deallocateStorage( v_, capacity_ );
 
    o_        = rhs.o_;
    m_        = rhs.m_;
@@ -1259,9 +1306,10 @@ inline DynamicTensor<Type>& DynamicTensor<Type>::operator=( DynamicTensor&& rhs
 // The tensor is resized according to the given \f$ M \times N \f$ tensor and initialized as a
 // copy of this tensor.
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side tensor
-inline DynamicTensor<Type>& DynamicTensor<Type>::operator=( const Tensor<MT>& rhs )
+inline DynamicTensor<Type,Alloc>& DynamicTensor<Type,Alloc>::operator=( const Tensor<MT>& rhs )
 {
    if( (~rhs).canAlias( this ) ) {
       DynamicTensor tmp( ~rhs );
@@ -1289,9 +1337,10 @@ inline DynamicTensor<Type>& DynamicTensor<Type>::operator=( const Tensor<MT>& rh
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename MT >   // Type of the right-hand side tensor
-inline DynamicTensor<Type>& DynamicTensor<Type>::operator+=( const Tensor<MT>& rhs )
+inline DynamicTensor<Type,Alloc>& DynamicTensor<Type,Alloc>::operator+=( const Tensor<MT>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ || (~rhs).pages() != o_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
@@ -1322,9 +1371,10 @@ inline DynamicTensor<Type>& DynamicTensor<Type>::operator+=( const Tensor<MT>& r
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename MT >   // Type of the right-hand side tensor
-inline DynamicTensor<Type>& DynamicTensor<Type>::operator-=( const Tensor<MT>& rhs )
+inline DynamicTensor<Type,Alloc>& DynamicTensor<Type,Alloc>::operator-=( const Tensor<MT>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ || (~rhs).pages() != o_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
@@ -1355,9 +1405,10 @@ inline DynamicTensor<Type>& DynamicTensor<Type>::operator-=( const Tensor<MT>& r
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side tensor
-inline DynamicTensor<Type>& DynamicTensor<Type>::operator%=( const Tensor<MT>& rhs )
+inline DynamicTensor<Type,Alloc>& DynamicTensor<Type,Alloc>::operator%=( const Tensor<MT>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ || (~rhs).pages() != o_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
@@ -1391,8 +1442,9 @@ inline DynamicTensor<Type>& DynamicTensor<Type>::operator%=( const Tensor<MT>& r
 //
 // \return The number of rows of the tensor.
 */
-template< typename Type > // Data type of the tensor
-inline size_t DynamicTensor<Type>::rows() const noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicTensor<Type,Alloc>::rows() const noexcept
 {
    return m_;
 }
@@ -1404,8 +1456,9 @@ inline size_t DynamicTensor<Type>::rows() const noexcept
 //
 // \return The number of columns of the tensor.
 */
-template< typename Type > // Data type of the tensor
-inline size_t DynamicTensor<Type>::columns() const noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicTensor<Type,Alloc>::columns() const noexcept
 {
    return n_;
 }
@@ -1417,8 +1470,9 @@ inline size_t DynamicTensor<Type>::columns() const noexcept
 //
 // \return The number of pages of the tensor.
 */
-template< typename Type > // Data type of the tensor
-inline size_t DynamicTensor<Type>::pages() const noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicTensor<Type,Alloc>::pages() const noexcept
 {
    return o_;
 }
@@ -1435,8 +1489,9 @@ inline size_t DynamicTensor<Type>::pages() const noexcept
 // the function returns the spacing between two rows, in case the storage flag is set to
 // \a columnMajor the function returns the spacing between two columns.
 */
-template< typename Type > // Data type of the tensor
-inline size_t DynamicTensor<Type>::spacing() const noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicTensor<Type,Alloc>::spacing() const noexcept
 {
    return nn_;
 }
@@ -1448,8 +1503,9 @@ inline size_t DynamicTensor<Type>::spacing() const noexcept
 //
 // \return The capacity of the tensor.
 */
-template< typename Type > // Data type of the tensor
-inline size_t DynamicTensor<Type>::capacity() const noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicTensor<Type,Alloc>::capacity() const noexcept
 {
    return capacity_;
 }
@@ -1465,8 +1521,9 @@ inline size_t DynamicTensor<Type>::capacity() const noexcept
 //
 // This function returns the current capacity of the specified row/column.
 */
-template< typename Type > // Data type of the tensor
-inline size_t DynamicTensor<Type>::capacity( size_t i, size_t k ) const noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicTensor<Type,Alloc>::capacity( size_t i, size_t k ) const noexcept
 {
    MAYBE_UNUSED( i );
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
@@ -1481,8 +1538,9 @@ inline size_t DynamicTensor<Type>::capacity( size_t i, size_t k ) const noexcept
 //
 // \return The number of non-zero elements in the dense tensor.
 */
-template< typename Type > // Data type of the tensor
-inline size_t DynamicTensor<Type>::nonZeros() const
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicTensor<Type,Alloc>::nonZeros() const
 {
    size_t nonzeros( 0UL );
 
@@ -1511,8 +1569,9 @@ inline size_t DynamicTensor<Type>::nonZeros() const
 // elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
 // the number of non-zero elements in column \a i.
 */
-template< typename Type > // Data type of the tensor
-inline size_t DynamicTensor<Type>::nonZeros( size_t i, size_t k ) const
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicTensor<Type,Alloc>::nonZeros( size_t i, size_t k ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    BLAZE_USER_ASSERT( k < pages(), "Invalid page access index" );
@@ -1534,8 +1593,9 @@ inline size_t DynamicTensor<Type>::nonZeros( size_t i, size_t k ) const
 //
 // \return void
 */
-template< typename Type > // Data type of the tensor
-inline void DynamicTensor<Type>::reset()
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline void DynamicTensor<Type,Alloc>::reset()
 {
    using blaze::clear;
 
@@ -1562,8 +1622,9 @@ inline void DynamicTensor<Type>::reset()
 // the storage order is set to \a columnMajor the function resets the values in column \a i.
 // Note that the capacity of the row/column remains unchanged.
 */
-template< typename Type > // Data type of the tensor
-inline void DynamicTensor<Type>::reset( size_t i, size_t k )
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline void DynamicTensor<Type,Alloc>::reset( size_t i, size_t k )
 {
    using blaze::clear;
 
@@ -1585,8 +1646,9 @@ inline void DynamicTensor<Type>::reset( size_t i, size_t k )
 //
 // After the clear() function, the size of the tensor is 0.
 */
-template< typename Type > // Data type of the tensor
-inline void DynamicTensor<Type>::clear()
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline void DynamicTensor<Type,Alloc>::clear()
 {
    resize( 0UL, 0UL, 0UL, false );
 }
@@ -1607,6 +1669,9 @@ inline void DynamicTensor<Type>::clear()
 // ...) on the tensor if it is used to shrink the tensor. Additionally, the resize operation
 // potentially changes all tensor elements. In order to preserve the old tensor values, the
 // \a preserve flag can be set to \a true. However, new tensor elements are not initialized!
+// If the new size fits into the current capacity, the existing memory is reused. This also
+// holds when preserving the old values, as long as the padded row length and the page size
+// either both grow or both shrink (as for instance when only the number of pages changes).
 //
 // The following example illustrates the resize operation of a \f$ 2 \times 4 \f$ tensor to a
 // \f$ 4 \times 2 \f$ tensor. The new, uninitialized elements are marked with \a x:
@@ -1627,8 +1692,9 @@ inline void DynamicTensor<Type>::clear()
                               \end{array}\right)
                               \f]
 */
-template< typename Type > // Data type of the tensor
-void DynamicTensor<Type>::resize( size_t o, size_t m, size_t n, bool preserve )
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+void DynamicTensor<Type,Alloc>::resize( size_t o, size_t m, size_t n, bool preserve )
 {
    using std::swap;
    using blaze::min;
@@ -1639,24 +1705,53 @@ void DynamicTensor<Type>::resize( size_t o, size_t m, size_t n, bool preserve )
 
    if( preserve )
    {
-      Type* BLAZE_RESTRICT v = allocate<Type>( o*m*nn );
       const size_t min_m( min( m, m_ ) );
       const size_t min_n( min( n, n_ ) );
       const size_t min_o( min( o, o_ ) );
 
-      for (size_t k=0UL; k<min_o; ++k) {
-         for (size_t i=0UL; i<min_m; ++i) {
-            transfer(v_+(k*m_+i)*nn_, v_+(k*m_+i)*nn_+min_n, v+(k*m+i)*nn);
+      // Row and page strides that do not grow (or do not shrink) allow the preserved rows to
+      // be moved within the existing storage in ascending (or descending) order without any
+      // row overwriting a row that still has to be moved.
+      const bool shrinking( nn <= nn_ && m*nn <= m_*nn_ );
+      const bool growing  ( nn >= nn_ && m*nn >= m_*nn_ );
+
+      if( o*m*nn <= capacity_ && shrinking ) {
+         for (size_t k=0UL; k<min_o; ++k) {
+            for (size_t i=0UL; i<min_m; ++i) {
+               Type* src( v_+(k*m_+i)*nn_ );
+               Type* dst( v_+(k*m +i)*nn  );
+               if( src != dst )
+                  std::move( src, src+min_n, dst );
+            }
          }
       }
-      swap( v_, v );
-      deallocate( v );
-      capacity_ = o*m*nn;
+      else if( o*m*nn <= capacity_ && growing ) {
+         for (size_t k=min_o; k-- > 0UL; ) {
+            for (size_t i=min_m; i-- > 0UL; ) {
+               Type* src( v_+(k*m_+i)*nn_ );
+               Type* dst( v_+(k*m +i)*nn  );
+               if( src != dst )
+                  std::move_backward( src, src+min_n, dst+min_n );
+            }
+         }
+      }
+      else {
+         Type* BLAZE_RESTRICT v = allocateStorage( o*m*nn );
+
+         for (size_t k=0UL; k<min_o; ++k) {
+            for (size_t i=0UL; i<min_m; ++i) {
+               transfer(v_+(k*m_+i)*nn_, v_+(k*m_+i)*nn_+min_n, v+(k*m+i)*nn);
+            }
+         }
+         swap( v_, v );
+         deallocateStorage( v, capacity_ );
+         capacity_ = o*m*nn;
+      }
    }
    else if( o*m*nn > capacity_ ) {
-      Type* BLAZE_RESTRICT v = allocate<Type>( o*m*nn );
+      Type* BLAZE_RESTRICT v = allocateStorage( o*m*nn );
       swap( v_, v );
-      deallocate( v );
+      deallocateStorage( v, capacity_ );
       capacity_ = o*m*nn;
    }
 
@@ -1693,8 +1788,9 @@ void DynamicTensor<Type>::resize( size_t o, size_t m, size_t n, bool preserve )
 // values, the \a preserve flag can be set to \a true. However, new tensor elements are not
 // initialized!
 */
-template< typename Type > // Data type of the tensor
-inline void DynamicTensor<Type>::extend( size_t o, size_t m, size_t n, bool preserve )
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline void DynamicTensor<Type,Alloc>::extend( size_t o, size_t m, size_t n, bool preserve )
 {
    resize( o_+o, m_+m, n_+n, preserve );
 }
@@ -1710,15 +1806,16 @@ inline void DynamicTensor<Type>::extend( size_t o, size_t m, size_t n, bool pres
 // This function increases the capacity of the dense tensor to at least \a elements elements.
 // The current values of the tensor elements are preserved.
 */
-template< typename Type > // Data type of the tensor
-inline void DynamicTensor<Type>::reserve( size_t elements )
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline void DynamicTensor<Type,Alloc>::reserve( size_t elements )
 {
    using std::swap;
 
    if( elements > capacity_ )
    {
       // Allocating a new array
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+      Type* BLAZE_RESTRICT tmp = allocateStorage( elements );
 
       // Initializing the new array
       transfer( v_, v_+capacity_, tmp );
@@ -1730,7 +1827,7 @@ inline void DynamicTensor<Type>::reserve( size_t elements )
 
       // Replacing the old array
       swap( tmp, v_ );
-      deallocate( tmp );
+      deallocateStorage( tmp, capacity_ );
       capacity_ = elements;
    }
 }
@@ -1747,8 +1844,9 @@ inline void DynamicTensor<Type>::reserve( size_t elements )
 // Please also note that in case a reallocation occurs, all iterators (including end() iterators),
 // all pointers and references to elements of this tensor are invalidated.
 */
-template< typename Type > // Data type of the tensor
-inline void DynamicTensor<Type>::shrinkToFit()
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline void DynamicTensor<Type,Alloc>::shrinkToFit()
 {
    if( ( o_ * m_ * nn_ ) < capacity_ ) {
       DynamicTensor( *this ).swap( *this );
@@ -1763,8 +1861,9 @@ inline void DynamicTensor<Type>::shrinkToFit()
 // \param m The tensor to be swapped.
 // \return void
 */
-template< typename Type > // Data type of the tensor
-inline void DynamicTensor<Type>::swap( DynamicTensor& m ) noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline void DynamicTensor<Type,Alloc>::swap( DynamicTensor& m ) noexcept
 {
    using std::swap;
 
@@ -1787,8 +1886,9 @@ inline void DynamicTensor<Type>::swap( DynamicTensor& m ) noexcept
 // This function increments the given \a value by the necessary amount of padding based on the
 // vector's data type \a Type.
 */
-template< typename Type > // Data type of the tensor
-inline size_t DynamicTensor<Type>::addPadding( size_t value ) const noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline size_t DynamicTensor<Type,Alloc>::addPadding( size_t value ) const noexcept
 {
    if( usePadding && IsVectorizable_v<Type> )
       return nextMultiple<size_t>( value, SIMDSIZE );
@@ -1797,6 +1897,40 @@ inline size_t DynamicTensor<Type>::addPadding( size_t value ) const noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Allocation of the element storage by means of the allocator of the tensor.
+//
+// \param n The number of elements to be allocated.
+// \return Pointer to the first allocated element.
+// \exception std::bad_alloc Allocation failed.
+*/
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline Type* DynamicTensor<Type,Alloc>::allocateStorage( size_t n )
+{
+   Alloc alloc;
+   return allocateElements( alloc, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of element storage by means of the allocator of the tensor.
+//
+// \param ptr Pointer to the first element of the storage (may be \c nullptr).
+// \param n The number of allocated elements.
+// \return void
+*/
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline void DynamicTensor<Type,Alloc>::deallocateStorage( Type* ptr, size_t n ) noexcept
+{
+   Alloc alloc;
+   deallocateElements( alloc, ptr, n );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -1809,21 +1943,16 @@ inline size_t DynamicTensor<Type>::addPadding( size_t value ) const noexcept
 /*!\brief In-place transpose of the tensor.
 //
 // \return Reference to the transposed tensor.
+//
+// This function reverses the order of the dimensions of the tensor (i.e. it applies the axis
+// mapping {2, 1, 0}). See the transpose( const T*, size_t ) function for details.
 */
-template< typename Type >  // Data type of the tensor
-inline DynamicTensor<Type>& DynamicTensor<Type>::transpose()
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline DynamicTensor<Type,Alloc>& DynamicTensor<Type,Alloc>::transpose()
 {
-   if( o_ == n_ && m_ == n_ )
-   {
-      transposeGeneral( *this );
-   }
-   else
-   {
-      DynamicTensor tmp( trans( *this ) );
-      this->swap( tmp );
-   }
-
-   return *this;
+   const size_t indices[3] = { 2UL, 1UL, 0UL };
+   return transpose( indices, 3UL );
 }
 //*************************************************************************************************
 
@@ -1831,19 +1960,25 @@ inline DynamicTensor<Type>& DynamicTensor<Type>::transpose()
 //*************************************************************************************************
 /*!\brief In-place transpose of the tensor.
 //
+// \param indices The three mapping indices of the transposition.
+// \param n The number of mapping indices (has to be 3).
 // \return Reference to the transposed tensor.
+//
+// This function permutes the dimensions of the tensor according to the given mapping indices.
+// Cubic tensors are transposed by blocked element swaps. All other shapes are transposed in
+// place as long as the transposed tensor fits into the current capacity of the tensor, in which
+// case no second copy of the elements is required. Only in case the transposed tensor requires
+// more memory (due to a different padding of the new rows) a temporary tensor is created.
 */
-template< typename Type >  // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename T >     // Type of the mapping indices
-inline DynamicTensor<Type>& DynamicTensor<Type>::transpose( const T* indices, size_t n )
+inline DynamicTensor<Type,Alloc>& DynamicTensor<Type,Alloc>::transpose( const T* indices, size_t n )
 {
-   if( o_ == n_ && m_ == n_ )
-   {
-      transposeGeneral( *this, indices, n );
-   }
-   else
-   {
-      DynamicTensor tmp( trans(*this, indices, n ) );
+   BLAZE_USER_ASSERT( n == 3UL, "Invalid number of transposition axes" );
+
+   if( !transposeInPlace( indices ) ) {
+      DynamicTensor tmp( trans( *this, indices, n ) );
       this->swap( tmp );
    }
 
@@ -1857,38 +1992,12 @@ inline DynamicTensor<Type>& DynamicTensor<Type>::transpose( const T* indices, si
 //
 // \return Reference to the transposed tensor.
 */
-template< typename Type >  // Data type of the tensor
-inline DynamicTensor<Type>& DynamicTensor<Type>::ctranspose()
-{
-//    constexpr size_t block( BLOCK_SIZE );
-//
-//    if( o_ == n_ && m_ == n_ )
-//    {
-//       for( size_t ii=0UL; ii<m_; ii+=block ) {
-//          const size_t iend( min( ii+block, m_ ) );
-//          for( size_t jj=0UL; jj<ii; jj+=block ) {
-//             const size_t jend( min( jj+block, n_ ) );
-//             for( size_t i=ii; i<iend; ++i ) {
-//                for( size_t j=jj; j<jend; ++j ) {
-//                   cswap( v_[i*nn_+j], v_[j*nn_+i] );
-//                }
-//             }
-//          }
-//          for( size_t i=ii; i<iend; ++i ) {
-//             for( size_t j=ii; j<i; ++j ) {
-//                cswap( v_[i*nn_+j], v_[j*nn_+i] );
-//             }
-//             conjugate( v_[i*nn_+i] );
-//          }
-//       }
-//    }
-//    else
-//    {
-      DynamicTensor tmp( ctrans( *this ) );
-      swap( tmp );
-//    }
-
-   return *this;
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline DynamicTensor<Type,Alloc>& DynamicTensor<Type,Alloc>::ctranspose()
+{
+   const size_t indices[3] = { 2UL, 1UL, 0UL };
+   return ctranspose( indices, 3UL );
 }
 //*************************************************************************************************
 
@@ -1896,45 +2005,88 @@ inline DynamicTensor<Type>& DynamicTensor<Type>::ctranspose()
 //*************************************************************************************************
 /*!\brief In-place conjugate transpose of the tensor.
 //
+// \param indices The three mapping indices of the transposition.
+// \param n The number of mapping indices (has to be 3).
 // \return Reference to the transposed tensor.
 */
-template< typename Type >  // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename T >     // Type of the mapping indices
-inline DynamicTensor<Type>& DynamicTensor<Type>::ctranspose( const T* indices, size_t n )
-{
-//    constexpr size_t block( BLOCK_SIZE );
-//
-//    if( o_ == n_ && m_ == n_ )
-//    {
-//       for( size_t ii=0UL; ii<m_; ii+=block ) {
-//          const size_t iend( min( ii+block, m_ ) );
-//          for( size_t jj=0UL; jj<ii; jj+=block ) {
-//             const size_t jend( min( jj+block, n_ ) );
-//             for( size_t i=ii; i<iend; ++i ) {
-//                for( size_t j=jj; j<jend; ++j ) {
-//                   cswap( v_[i*nn_+j], v_[j*nn_+i] );
-//                }
-//             }
-//          }
-//          for( size_t i=ii; i<iend; ++i ) {
-//             for( size_t j=ii; j<i; ++j ) {
-//                cswap( v_[i*nn_+j], v_[j*nn_+i] );
-//             }
-//             conjugate( v_[i*nn_+i] );
-//          }
-//       }
-//    }
-//    else
-//    {
-      DynamicTensor tmp( ctrans(*this, indices, n ) );
+inline DynamicTensor<Type,Alloc>& DynamicTensor<Type,Alloc>::ctranspose( const T* indices, size_t n )
+{
+   BLAZE_USER_ASSERT( n == 3UL, "Invalid number of transposition axes" );
+
+   if( transposeInPlace( indices ) ) {
+      for( size_t k=0UL; k<o_; ++k ) {
+         for( size_t i=0UL; i<m_; ++i ) {
+            Type* row( v_ + ( k*m_ + i )*nn_ );
+            for( size_t j=0UL; j<n_; ++j ) {
+               conjugate( row[j] );
+            }
+         }
+      }
+   }
+   else {
+      DynamicTensor tmp( ctrans( *this, indices, n ) );
       swap( tmp );
-//    }
+   }
 
    return *this;
 }
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transposition of the tensor within its current capacity.
+//
+// \param indices The three mapping indices of the transposition.
+// \return \a true in case the tensor has been transposed, \a false if not.
+//
+// This function permutes the elements of the tensor without additional element storage. Cubic
+// tensors are transposed by blocked element swaps. For all other shapes the padding elements
+// are removed, the densely stored elements are permuted by following the cycles of the
+// permutation, and the padding of the new rows is restored. In case the transposed tensor
+// does not fit into the current capacity, the tensor remains unchanged and the function
+// returns \a false.
+*/
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+template< typename T >     // Type of the mapping indices
+inline bool DynamicTensor<Type,Alloc>::transposeInPlace( const T* indices )
+{
+   if( o_ == n_ && m_ == n_ ) {
+      transposeGeneral( *this, indices, 3UL );
+      return true;
+   }
+
+   const size_t dims[3] = { o_, m_, n_ };
+
+   const size_t o ( dims[indices[0]] );
+   const size_t m ( dims[indices[1]] );
+   const size_t n ( dims[indices[2]] );
+   const size_t nn( addPadding( n ) );
+
+   if( o*m*nn > capacity_ )
+      return false;
+
+   packPaddedRows( v_, o_*m_, n_, nn_ );
+   permuteDense( v_, dims, indices, 3UL );
+   unpackPaddedRows( v_, o*m, n, nn );
+
+   o_  = o;
+   m_  = m;
+   n_  = n;
+   nn_ = nn;
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Scaling of the tensor by the scalar value \a scalar (\f$ A=B*s \f$).
 //
@@ -1952,9 +2104,10 @@ inline DynamicTensor<Type>& DynamicTensor<Type>::ctranspose( const T* indices, s
    A.scale( 4 );  // Same effect as above
    \endcode
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the scalar value
-inline DynamicTensor<Type>& DynamicTensor<Type>::scale( const Other& scalar )
+inline DynamicTensor<Type,Alloc>& DynamicTensor<Type,Alloc>::scale( const Other& scalar )
 {
    for (size_t k=0UL; k<o_; ++k) {
       for (size_t i=0UL; i<m_; ++i) {
@@ -1986,8 +2139,9 @@ inline DynamicTensor<Type>& DynamicTensor<Type>::scale( const Other& scalar )
 // state is valid. In case the invariants are intact, the function returns \a true, else it
 // will return \a false.
 */
-template< typename Type > // Data type of the tensor
-inline bool DynamicTensor<Type>::isIntact() const noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicTensor<Type,Alloc>::isIntact() const noexcept
 {
    if( o_ * m_ * n_ > capacity_ )
       return false;
@@ -2027,9 +2181,10 @@ inline bool DynamicTensor<Type>::isIntact() const noexcept
 // to the isAliased() function this function is allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool DynamicTensor<Type>::canAlias( const Other* alias ) const noexcept
+inline bool DynamicTensor<Type,Alloc>::canAlias( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2046,9 +2201,10 @@ inline bool DynamicTensor<Type>::canAlias( const Other* alias ) const noexcept
 // to the canAlias() function this function is not allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool DynamicTensor<Type>::isAliased( const Other* alias ) const noexcept
+inline bool DynamicTensor<Type,Alloc>::isAliased( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2064,8 +2220,9 @@ inline bool DynamicTensor<Type>::isAliased( const Other* alias ) const noexcept
 // whether the beginning and the end of each row/column of the tensor are guaranteed to conform
 // to the alignment restrictions of the element type \a Type.
 */
-template< typename Type > // Data type of the tensor
-inline bool DynamicTensor<Type>::isAligned() const noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicTensor<Type,Alloc>::isAligned() const noexcept
 {
    return ( usePadding || columns() % SIMDSIZE == 0UL );
 }
@@ -2082,8 +2239,9 @@ inline bool DynamicTensor<Type>::isAligned() const noexcept
 // function additionally provides runtime information (as for instance the current number of
 // rows and/or columns of the tensor).
 */
-template< typename Type > // Data type of the tensor
-inline bool DynamicTensor<Type>::canSMPAssign() const noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline bool DynamicTensor<Type,Alloc>::canSMPAssign() const noexcept
 {
    return ( rows() * columns() >= SMP_DMATASSIGN_THRESHOLD );
 }
@@ -2105,9 +2263,10 @@ inline bool DynamicTensor<Type>::canSMPAssign() const noexcept
 // performance optimized evaluation of expression templates. Calling this function explicitly
 // might result in erroneous results and/or in compilation errors.
 */
-template< typename Type > // Data type of the tensor
-BLAZE_ALWAYS_INLINE typename DynamicTensor<Type>::SIMDType
-   DynamicTensor<Type>::load( size_t k, size_t i, size_t j ) const noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicTensor<Type,Alloc>::SIMDType
+   DynamicTensor<Type,Alloc>::load( size_t k, size_t i, size_t j ) const noexcept
 {
    if( usePadding )
       return loada( k, i, j );
@@ -2132,9 +2291,10 @@ BLAZE_ALWAYS_INLINE typename DynamicTensor<Type>::SIMDType
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type > // Data type of the tensor
-BLAZE_ALWAYS_INLINE typename DynamicTensor<Type>::SIMDType
-   DynamicTensor<Type>::loada( size_t k, size_t i, size_t j ) const noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicTensor<Type,Alloc>::SIMDType
+   DynamicTensor<Type,Alloc>::loada( size_t k, size_t i, size_t j ) const noexcept
 {
    using blaze::loada;
 
@@ -2167,9 +2327,10 @@ BLAZE_ALWAYS_INLINE typename DynamicTensor<Type>::SIMDType
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type > // Data type of the tensor
-BLAZE_ALWAYS_INLINE typename DynamicTensor<Type>::SIMDType
-   DynamicTensor<Type>::loadu( size_t k, size_t i, size_t j ) const noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicTensor<Type,Alloc>::SIMDType
+   DynamicTensor<Type,Alloc>::loadu( size_t k, size_t i, size_t j ) const noexcept
 {
    using blaze::loadu;
 
@@ -2201,9 +2362,10 @@ BLAZE_ALWAYS_INLINE typename DynamicTensor<Type>::SIMDType
 // performance optimized evaluation of expression templates. Calling this function explicitly
 // might result in erroneous results and/or in compilation errors.
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicTensor<Type>::store( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept
+   DynamicTensor<Type,Alloc>::store( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept
 {
    if( usePadding )
       storea( k, i, j, value );
@@ -2229,9 +2391,10 @@ BLAZE_ALWAYS_INLINE void
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicTensor<Type>::storea( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept
+   DynamicTensor<Type,Alloc>::storea( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept
 {
    using blaze::storea;
 
@@ -2265,9 +2428,10 @@ BLAZE_ALWAYS_INLINE void
 // internally for the performance optimized evaluation of expression templates. Calling this
 // function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicTensor<Type>::storeu( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept
+   DynamicTensor<Type,Alloc>::storeu( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept
 {
    using blaze::storeu;
 
@@ -2300,9 +2464,10 @@ BLAZE_ALWAYS_INLINE void
 // templates. Calling this function explicitly might result in erroneous results and/or in
 // compilation errors.
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicTensor<Type>::stream( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept
+   DynamicTensor<Type,Alloc>::stream( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept
 {
    using blaze::stream;
 
@@ -2331,9 +2496,10 @@ BLAZE_ALWAYS_INLINE void
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side dense tensor
-inline auto DynamicTensor<Type>::assign( const DenseTensor<MT>& rhs )
+inline auto DynamicTensor<Type,Alloc>::assign( const DenseTensor<MT>& rhs )
    -> EnableIf_t< !VectorizedAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
@@ -2370,9 +2536,10 @@ inline auto DynamicTensor<Type>::assign( const DenseTensor<MT>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side dense tensor
-inline auto DynamicTensor<Type>::assign( const DenseTensor<MT>& rhs )
+inline auto DynamicTensor<Type,Alloc>::assign( const DenseTensor<MT>& rhs )
    -> EnableIf_t< VectorizedAssign_v<MT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
@@ -2442,9 +2609,10 @@ inline auto DynamicTensor<Type>::assign( const DenseTensor<MT>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side dense tensor
-inline auto DynamicTensor<Type>::addAssign( const DenseTensor<MT>& rhs )
+inline auto DynamicTensor<Type,Alloc>::addAssign( const DenseTensor<MT>& rhs )
    -> EnableIf_t< !VectorizedAddAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
@@ -2484,9 +2652,10 @@ inline auto DynamicTensor<Type>::addAssign( const DenseTensor<MT>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side dense tensor
-inline auto DynamicTensor<Type>::addAssign( const DenseTensor<MT>& rhs )
+inline auto DynamicTensor<Type,Alloc>::addAssign( const DenseTensor<MT>& rhs )
    -> EnableIf_t< VectorizedAddAssign_v<MT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
@@ -2539,9 +2708,10 @@ inline auto DynamicTensor<Type>::addAssign( const DenseTensor<MT>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side dense tensor
-inline auto DynamicTensor<Type>::subAssign( const DenseTensor<MT>& rhs )
+inline auto DynamicTensor<Type,Alloc>::subAssign( const DenseTensor<MT>& rhs )
    -> EnableIf_t< !VectorizedSubAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
@@ -2581,9 +2751,10 @@ inline auto DynamicTensor<Type>::subAssign( const DenseTensor<MT>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side dense tensor
-inline auto DynamicTensor<Type>::subAssign( const DenseTensor<MT>& rhs )
+inline auto DynamicTensor<Type,Alloc>::subAssign( const DenseTensor<MT>& rhs )
    -> EnableIf_t< VectorizedSubAssign_v<MT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
@@ -2637,9 +2808,10 @@ inline auto DynamicTensor<Type>::subAssign( const DenseTensor<MT>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side dense tensor
-inline auto DynamicTensor<Type>::schurAssign( const DenseTensor<MT>& rhs )
+inline auto DynamicTensor<Type,Alloc>::schurAssign( const DenseTensor<MT>& rhs )
    -> EnableIf_t< !VectorizedSchurAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
@@ -2676,9 +2848,10 @@ inline auto DynamicTensor<Type>::schurAssign( const DenseTensor<MT>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type > // Data type of the tensor
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side dense tensor
-inline auto DynamicTensor<Type>::schurAssign( const DenseTensor<MT>& rhs )
+inline auto DynamicTensor<Type,Alloc>::schurAssign( const DenseTensor<MT>& rhs )
    -> EnableIf_t< VectorizedSchurAssign_v<MT> >
 {
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
@@ -2730,23 +2903,28 @@ inline auto DynamicTensor<Type>::schurAssign( const DenseTensor<MT>& rhs )
 //*************************************************************************************************
 /*!\name DynamicTensor operators */
 //@{
-template< typename Type >
-inline void reset( DynamicTensor<Type>& m );
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline void reset( DynamicTensor<Type,Alloc>& m );
 
-template< typename Type >
-inline void reset( DynamicTensor<Type>& m, size_t i, size_t k );
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline void reset( DynamicTensor<Type,Alloc>& m, size_t i, size_t k );
 
-template< typename Type >
-inline void clear( DynamicTensor<Type>& m );
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline void clear( DynamicTensor<Type,Alloc>& m );
 
-template< bool RF, typename Type >
-inline bool isDefault( const DynamicTensor<Type>& m );
+template< bool RF, typename Type, typename Alloc >
+inline bool isDefault( const DynamicTensor<Type,Alloc>& m );
 
-template< typename Type >
-inline bool isIntact( const DynamicTensor<Type>& m ) noexcept;
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline bool isIntact( const DynamicTensor<Type,Alloc>& m ) noexcept;
 
-template< typename Type >
-inline void swap( DynamicTensor<Type>& a, DynamicTensor<Type>& b ) noexcept;
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline void swap( DynamicTensor<Type,Alloc>& a, DynamicTensor<Type,Alloc>& b ) noexcept;
 //@}
 //*************************************************************************************************
 
@@ -2758,8 +2936,9 @@ inline void swap( DynamicTensor<Type>& a, DynamicTensor<Type>& b ) noexcept;
 // \param m The tensor to be resetted.
 // \return void
 */
-template< typename Type > // Data type of the tensor
-inline void reset( DynamicTensor<Type>& m )
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline void reset( DynamicTensor<Type,Alloc>& m )
 {
    m.reset();
 }
@@ -2780,8 +2959,9 @@ inline void reset( DynamicTensor<Type>& m )
 // values in row \a i, if it is a \a columnMajor tensor the function resets the values in column
 // \a i. Note that the capacity of the row/column remains unchanged.
 */
-template< typename Type > // Data type of the tensor
-inline void reset( DynamicTensor<Type>& m, size_t i, size_t k )
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline void reset( DynamicTensor<Type,Alloc>& m, size_t i, size_t k )
 {
    m.reset( i, k );
 }
@@ -2795,8 +2975,9 @@ inline void reset( DynamicTensor<Type>& m, size_t i, size_t k )
 // \param m The tensor to be cleared.
 // \return void
 */
-template< typename Type > // Data type of the tensor
-inline void clear( DynamicTensor<Type>& m )
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline void clear( DynamicTensor<Type,Alloc>& m )
 {
    m.clear();
 }
@@ -2828,9 +3009,10 @@ inline void clear( DynamicTensor<Type>& m )
    if( isDefault<relaxed>( A ) ) { ... }
    \endcode
 */
-template< bool RF        // Relaxation flag
-        , typename Type > // Data type of the tensor
-inline bool isDefault( const DynamicTensor<Type>& m )
+template< bool RF          // Relaxation flag
+        , typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline bool isDefault( const DynamicTensor<Type,Alloc>& m )
 {
    return ( m.rows() == 0UL && m.columns() == 0UL && m.pages() == 0UL );
 }
@@ -2855,8 +3037,9 @@ inline bool isDefault( const DynamicTensor<Type>& m )
    if( isIntact( A ) ) { ... }
    \endcode
 */
-template< typename Type > // Data type of the tensor
-inline bool isIntact( const DynamicTensor<Type>& m ) noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline bool isIntact( const DynamicTensor<Type,Alloc>& m ) noexcept
 {
    return m.isIntact();
 }
@@ -2871,8 +3054,9 @@ inline bool isIntact( const DynamicTensor<Type>& m ) noexcept
 // \param b The second tensor to be swapped.
 // \return void
 */
-template< typename Type > // Data type of the tensor
-inline void swap( DynamicTensor<Type>& a, DynamicTensor<Type>& b ) noexcept
+template< typename Type     // Data type of the tensor
+        , typename Alloc >  // Type of the allocator
+inline void swap( DynamicTensor<Type,Alloc>& a, DynamicTensor<Type,Alloc>& b ) noexcept
 {
    a.swap( b );
 }
@@ -2889,8 +3073,9 @@ inline void swap( DynamicTensor<Type>& a, DynamicTensor<Type>& b ) noexcept
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T > // Data type of the tensor
-struct HasConstDataAccess< DynamicTensor<T> >
+template< typename T     // Data type of the tensor
+        , typename A >  // Type of the allocator
+struct HasConstDataAccess< DynamicTensor<T,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -2907,8 +3092,9 @@ struct HasConstDataAccess< DynamicTensor<T> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T > // Data type of the tensor
-struct HasMutableDataAccess< DynamicTensor<T> >
+template< typename T     // Data type of the tensor
+        , typename A >  // Type of the allocator
+struct HasMutableDataAccess< DynamicTensor<T,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -2925,8 +3111,9 @@ struct HasMutableDataAccess< DynamicTensor<T> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T > // Data type of the tensor
-struct IsAligned< DynamicTensor<T> >
+template< typename T     // Data type of the tensor
+        , typename A >  // Type of the allocator
+struct IsAligned< DynamicTensor<T,A> >
    : public BoolConstant<usePadding>
 {};
 /*! \endcond */
@@ -2943,8 +3130,9 @@ struct IsAligned< DynamicTensor<T> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T > // Data type of the tensor
-struct IsContiguous< DynamicTensor<T> >
+template< typename T     // Data type of the tensor
+        , typename A >  // Type of the allocator
+struct IsContiguous< DynamicTensor<T,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -2961,8 +3149,9 @@ struct IsContiguous< DynamicTensor<T> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T > // Data type of the tensor
-struct IsPadded< DynamicTensor<T> >
+template< typename T     // Data type of the tensor
+        , typename A >  // Type of the allocator
+struct IsPadded< DynamicTensor<T,A> >
    : public BoolConstant<usePadding>
 {};
 /*! \endcond */
@@ -2979,8 +3168,9 @@ struct IsPadded< DynamicTensor<T> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T > // Data type of the tensor
-struct IsResizable< DynamicTensor<T> >
+template< typename T     // Data type of the tensor
+        , typename A >  // Type of the allocator
+struct IsResizable< DynamicTensor<T,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -2997,8 +3187,9 @@ struct IsResizable< DynamicTensor<T> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T > // Data type of the tensor
-struct IsShrinkable< DynamicTensor<T> >
+template< typename T     // Data type of the tensor
+        , typename A >  // Type of the allocator
+struct IsShrinkable< DynamicTensor<T,A> >
    : public TrueType
 {};
 /*! \endcond */
@@ -3429,8 +3620,8 @@ struct RavelTraitEval1< T
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, typename T2 >
-struct HighType< DynamicTensor<T1>, DynamicTensor<T2> >
+template< typename T1, typename A1, typename T2, typename A2 >
+struct HighType< DynamicTensor<T1,A1>, DynamicTensor<T2,A2> >
 {
    using Type = DynamicTensor< typename HighType<T1,T2>::Type >;
 };
@@ -3448,8 +3639,8 @@ struct HighType< DynamicTensor<T1>, DynamicTensor<T2> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, typename T2 >
-struct LowType< DynamicTensor<T1>, DynamicTensor<T2> >
+template< typename T1, typename A1, typename T2, typename A2 >
+struct LowType< DynamicTensor<T1,A1>, DynamicTensor<T2,A2> >
 {
    using Type = DynamicTensor< typename LowType<T1,T2>::Type >;
 };
@@ -3559,6 +3750,27 @@ struct SubtensorTraitEval2< MT, inf, inf, inf, inf, inf, inf,
 
 
 
+//=================================================================================================
+//
+//  TEMPORARYTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if BLAZE_USE_ARENA_TEMPORARIES
+template< typename T, typename A >
+struct TemporaryTrait< DynamicTensor<T,A> >
+{
+   using Type = DynamicTensor< T, ArenaAllocator<T> >;
+};
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COLUMNSTRAIT SPECIALIZATIONS
@@ -0,0 +1,312 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/Expansion.h
+//  \brief Header file for the dense matrix expansion kernels
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_EXPANSION_H_
+#define _BLAZE_TENSOR_MATH_DENSE_EXPANSION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/SIMD.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/AlignmentCheck.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+#include <blaze_tensor/math/smp/ParallelFor.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY VARIABLE TEMPLATES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the vectorized expansion kernels.
+// \ingroup math
+*/
+template< typename ET    // Element type of the expanded operand
+        , typename RT >  // Type of the result elements
+constexpr bool UseVectorizedExpansion_v =
+   ( useOptimizedKernels && IsSame_v<ET,RT> && IsVectorizable_v<ET> );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROW KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default copy of a single expanded row.
+// \ingroup math
+//
+// \param a Pointer to the first element of the source row.
+// \param n The number of elements per row.
+// \param b Pointer to the first element of the target row.
+// \param streaming \a true in case non-temporal stores should be used.
+// \return void
+*/
+template< typename ET    // Element type of the source row
+        , typename RT >  // Type of the result elements
+BLAZE_ALWAYS_INLINE void expandRow( const ET* a, size_t n, RT* b, bool streaming, FalseType )
+{
+   MAYBE_UNUSED( streaming );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      b[j] = a[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized copy of a single expanded row.
+// \ingroup math
+//
+// \param a Pointer to the first element of the source row.
+// \param n The number of elements per row.
+// \param b Pointer to the first element of the target row.
+// \param streaming \a true in case non-temporal stores should be used.
+// \return void
+//
+// In case \a streaming is \a true and the target row is properly aligned, the row is written
+// by means of non-temporal stores, which bypass the cache. This avoids that the written pages,
+// which are not read again by the expansion, evict the cached rows of the source matrix.
+*/
+template< typename ET    // Element type of the source row
+        , typename RT >  // Type of the result elements
+BLAZE_ALWAYS_INLINE void expandRow( const ET* a, size_t n, RT* b, bool streaming, TrueType )
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<RT>::size );
+
+   const size_t jpos( n - ( n % SIMDSIZE ) );
+   BLAZE_INTERNAL_ASSERT( jpos <= n, "Invalid end calculation" );
+
+   size_t j( 0UL );
+
+   if( streaming && checkAlignment( b ) )
+   {
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         stream( b+j, loadu( a+j ) );
+      }
+   }
+   else
+   {
+      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+         storeu( b+j             , loadu( a+j              ) );
+         storeu( b+j+SIMDSIZE    , loadu( a+j+SIMDSIZE     ) );
+         storeu( b+j+SIMDSIZE*2UL, loadu( a+j+SIMDSIZE*2UL ) );
+         storeu( b+j+SIMDSIZE*3UL, loadu( a+j+SIMDSIZE*3UL ) );
+      }
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         storeu( b+j, loadu( a+j ) );
+      }
+   }
+
+   for( ; j<n; ++j ) {
+      b[j] = a[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default combination of a single expanded row with a row of a dense operand.
+// \ingroup math
+//
+// \param c Pointer to the first element of the row of the dense operand.
+// \param a Pointer to the first element of the expanded row.
+// \param n The number of elements per row.
+// \param b Pointer to the first element of the target row.
+// \param op The binary operation.
+// \return void
+//
+// This function computes \f$ b_j = op( c_j, a_j ) \f$. The target row may coincide with the row
+// of the dense operand.
+*/
+template< typename T1    // Element type of the dense operand
+        , typename T2    // Element type of the expanded row
+        , typename RT    // Type of the result elements
+        , typename OP >  // Type of the binary operation
+BLAZE_ALWAYS_INLINE void expandMapRow( const T1* c, const T2* a, size_t n, RT* b, OP op, FalseType )
+{
+   for( size_t j=0UL; j<n; ++j ) {
+      b[j] = op( c[j], a[j] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized combination of a single expanded row with a row of a dense operand.
+// \ingroup math
+//
+// \param c Pointer to the first element of the row of the dense operand.
+// \param a Pointer to the first element of the expanded row.
+// \param n The number of elements per row.
+// \param b Pointer to the first element of the target row.
+// \param op The binary operation.
+// \return void
+//
+// This function computes \f$ b_j = op( c_j, a_j ) \f$. The target row may coincide with the row
+// of the dense operand.
+*/
+template< typename T1    // Element type of the dense operand
+        , typename T2    // Element type of the expanded row
+        , typename RT    // Type of the result elements
+        , typename OP >  // Type of the binary operation
+BLAZE_ALWAYS_INLINE void expandMapRow( const T1* c, const T2* a, size_t n, RT* b, OP op, TrueType )
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<RT>::size );
+
+   const size_t jpos( n - ( n % SIMDSIZE ) );
+   BLAZE_INTERNAL_ASSERT( jpos <= n, "Invalid end calculation" );
+
+   size_t j( 0UL );
+
+   for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
+      storeu( b+j         , op.load( loadu( c+j          ), loadu( a+j          ) ) );
+      storeu( b+j+SIMDSIZE, op.load( loadu( c+j+SIMDSIZE ), loadu( a+j+SIMDSIZE ) ) );
+   }
+   for( ; j<jpos; j+=SIMDSIZE ) {
+      storeu( b+j, op.load( loadu( c+j ), loadu( a+j ) ) );
+   }
+   for( ; j<n; ++j ) {
+      b[j] = op( c[j], a[j] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPANSION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of matrix rows that are expanded together.
+// \ingroup math
+//
+// \param n The number of elements per row.
+// \param size The size of a single element in bytes.
+// \return The number of rows per block.
+//
+// The rows of a block occupy at most half of the cache, the other half is left to the target.
+*/
+inline size_t expansionBlockSize( size_t n, size_t size ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( n > 0UL && size > 0UL, "Invalid row size detected" );
+
+   return max( cacheSize / ( 2UL * n * size ), 1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Expansion of the rows of a dense matrix into all pages of a dense tensor.
+// \ingroup math
+//
+// \param m The number of rows per page.
+// \param o The number of pages.
+// \param block The number of rows per block (see expansionBlockSize()).
+// \param kernel The row kernel, which is called with a row index and a page index.
+// \param parallel \a true in case the pages should be processed in parallel.
+// \return void
+//
+// The rows are processed in blocks of \a block rows and each block is written to all pages
+// before the next block is touched. Therefore every row of the matrix is read from memory only
+// once and is served from the cache for all remaining pages. In the parallel case every thread
+// receives a contiguous range of pages (see smpFor()) and walks all blocks over its own pages,
+// such that no synchronization is required between two blocks.
+*/
+template< typename Kernel >  // Type of the row kernel
+void expandPages( size_t m, size_t o, size_t block, Kernel kernel, bool parallel )
+{
+   BLAZE_INTERNAL_ASSERT( block > 0UL, "Invalid block size detected" );
+
+   smpFor( o, parallel, [&]( size_t kbegin, size_t kend )
+   {
+      for( size_t ii=0UL; ii<m; ii+=block )
+      {
+         const size_t iend( min( ii+block, m ) );
+
+         for( size_t k=kbegin; k<kend; ++k ) {
+            for( size_t i=ii; i<iend; ++i ) {
+               kernel( i, k );
+            }
+         }
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
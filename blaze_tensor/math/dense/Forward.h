@@ -41,6 +41,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/util/AlignedAllocator.h>
 #include <blaze/util/Types.h>
 
 
@@ -53,9 +54,9 @@ namespace blaze {
 //=================================================================================================
 
 template< size_t, typename, AlignmentFlag, PaddingFlag, typename > class CustomArray;
-template< size_t, typename > class DynamicArray;
+template< size_t N, typename Type, typename Alloc = AlignedAllocator<Type> > class DynamicArray;
 template< typename, AlignmentFlag, PaddingFlag, typename > class CustomTensor;
-template< typename > class DynamicTensor;
+template< typename Type, typename Alloc = AlignedAllocator<Type> > class DynamicTensor;
 template< typename, size_t, size_t, size_t > class StaticTensor;
 template< typename > class UniformTensor;
 
@@ -0,0 +1,729 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/Normalization.h
+//  \brief Header file for the layer and batch normalization of dense tensors
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_NORMALIZATION_H_
+#define _BLAZE_TENSOR_MATH_DENSE_NORMALIZATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsPointer.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+#include <blaze_tensor/math/ReductionFlag.h>
+#include <blaze_tensor/math/dense/DynamicTensor.h>
+#include <blaze_tensor/math/dense/Welford.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/system/Thresholds.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY VARIABLE TEMPLATES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the vectorized normalization kernel.
+// \ingroup math
+*/
+template< typename ET    // Element type of the operand
+        , typename RT >  // Type of the result elements
+constexpr bool UseVectorizedNormalization_v =
+   ( useOptimizedKernels &&
+     IsSame_v<ET,RT> && IsVectorizable_v<ET> &&
+     HasSIMDAdd_v<ET,ET> && HasSIMDMult_v<ET,ET> );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the \a j-th element of a broadcast (scalar) normalization operand.
+// \ingroup math
+*/
+template< typename RT    // Type of the result elements
+        , typename T >   // Type of the operand
+BLAZE_ALWAYS_INLINE auto normalizeElement( const T& value, size_t ) noexcept
+   -> EnableIf_t< !IsPointer_v<T>, RT >
+{
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the \a j-th element of a per-column normalization operand.
+// \ingroup math
+*/
+template< typename RT    // Type of the result elements
+        , typename T >   // Type of the operand
+BLAZE_ALWAYS_INLINE auto normalizeElement( const T& values, size_t j ) noexcept
+   -> EnableIf_t< IsPointer_v<T>, RT >
+{
+   return values[j];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loads the SIMD vector starting at the \a j-th element of a broadcast normalization
+//        operand.
+// \ingroup math
+*/
+template< typename RT    // Type of the result elements
+        , typename T >   // Type of the operand
+BLAZE_ALWAYS_INLINE auto normalizeLoad( const T& value, size_t ) noexcept
+   -> EnableIf_t< !IsPointer_v<T>, SIMDTrait_t<RT> >
+{
+   return set( value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loads the SIMD vector starting at the \a j-th element of a per-column normalization
+//        operand.
+// \ingroup math
+*/
+template< typename RT    // Type of the result elements
+        , typename T >   // Type of the operand
+BLAZE_ALWAYS_INLINE auto normalizeLoad( const T& values, size_t j ) noexcept
+   -> EnableIf_t< IsPointer_v<T>, SIMDTrait_t<RT> >
+{
+   return loadu( values+j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NORMALIZATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default normalization of a contiguous row of elements.
+// \ingroup math
+//
+// \param x Pointer to the first element of the row.
+// \param n The number of elements in the row.
+// \param y Pointer to the first element of the resulting row.
+// \param scale The scaling factor(s) of the standardization.
+// \param shift The shift(s) of the standardization.
+// \param gamma The scaling factor(s) of the affine transformation.
+// \param beta The shift(s) of the affine transformation.
+// \return void
+//
+// This function computes \f$ y_j = ( x_j \cdot scale_j + shift_j ) \cdot \gamma_j + \beta_j \f$.
+// Each of the four operands is either a single value, which is broadcast to the complete row,
+// or a pointer to \a n values.
+*/
+template< typename ET     // Element type of the operand
+        , typename RT     // Type of the result elements
+        , typename OT1    // Type of the standardization factor(s)
+        , typename OT2    // Type of the standardization shift(s)
+        , typename OT3    // Type of the affine factor(s)
+        , typename OT4 >  // Type of the affine shift(s)
+inline auto normalizeRow( const ET* x, size_t n, RT* y, const OT1& scale, const OT2& shift,
+                          const OT3& gamma, const OT4& beta ) noexcept
+   -> EnableIf_t< !UseVectorizedNormalization_v<ET,RT> >
+{
+   for( size_t j=0UL; j<n; ++j ) {
+      y[j] = ( RT( x[j] ) * normalizeElement<RT>( scale, j ) + normalizeElement<RT>( shift, j ) )
+           * normalizeElement<RT>( gamma, j ) + normalizeElement<RT>( beta, j );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD-based normalization of a contiguous row of elements.
+// \ingroup math
+//
+// \param x Pointer to the first element of the row.
+// \param n The number of elements in the row.
+// \param y Pointer to the first element of the resulting row.
+// \param scale The scaling factor(s) of the standardization.
+// \param shift The shift(s) of the standardization.
+// \param gamma The scaling factor(s) of the affine transformation.
+// \param beta The shift(s) of the affine transformation.
+// \return void
+*/
+template< typename ET     // Element type of the operand
+        , typename RT     // Type of the result elements
+        , typename OT1    // Type of the standardization factor(s)
+        , typename OT2    // Type of the standardization shift(s)
+        , typename OT3    // Type of the affine factor(s)
+        , typename OT4 >  // Type of the affine shift(s)
+inline auto normalizeRow( const ET* x, size_t n, RT* y, const OT1& scale, const OT2& shift,
+                          const OT3& gamma, const OT4& beta ) noexcept
+   -> EnableIf_t< UseVectorizedNormalization_v<ET,RT> >
+{
+   using SIMDType = SIMDTrait_t<RT>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<RT>::size );
+
+   const size_t jpos( n - ( n % SIMDSIZE ) );
+   BLAZE_INTERNAL_ASSERT( jpos <= n, "Invalid end calculation" );
+
+   size_t j( 0UL );
+
+   for( ; j<jpos; j+=SIMDSIZE ) {
+      SIMDType xmm( loadu( x+j ) * normalizeLoad<RT>( scale, j ) + normalizeLoad<RT>( shift, j ) );
+      xmm = xmm * normalizeLoad<RT>( gamma, j ) + normalizeLoad<RT>( beta, j );
+      storeu( y+j, xmm );
+   }
+
+   for( ; j<n; ++j ) {
+      y[j] = ( x[j] * normalizeElement<RT>( scale, j ) + normalizeElement<RT>( shift, j ) )
+           * normalizeElement<RT>( gamma, j ) + normalizeElement<RT>( beta, j );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Layer normalization along the contiguous rows of a dense operand.
+// \ingroup math
+//
+// \param A Pointer to the first element of the operand.
+// \param spacing The distance between two consecutive rows of the operand.
+// \param pageRows The number of rows per page of the operand.
+// \param pageStride The distance between two consecutive pages of the operand.
+// \param rows The total number of rows of the operand.
+// \param n The number of elements per row.
+// \param B Pointer to the first element of the result.
+// \param bspacing The distance between two consecutive rows of the result.
+// \param gamma Pointer to the \a n scaling factors of the affine transformation.
+// \param beta Pointer to the \a n shifts of the affine transformation.
+// \param eps The value added to the variance for numerical stability.
+// \param parallel \a true in case the rows should be processed in parallel.
+// \return void
+//
+// Every row is first accumulated by the Welford kernel and immediately afterwards normalized
+// while it still resides in cache, such that each element is loaded from memory only once.
+*/
+template< typename ET    // Element type of the operand
+        , typename RT >  // Type of the result elements
+void layernormAlongRows( const ET* A, size_t spacing, size_t pageRows, size_t pageStride,
+                         size_t rows, size_t n,
+                         RT* B, size_t bspacing, const RT* gamma, const RT* beta,
+                         RT eps, bool parallel )
+{
+   using std::sqrt;
+
+   BLAZE_INTERNAL_ASSERT( n > 0UL, "Invalid number of samples detected" );
+
+   const RT invn( RT(1) / RT( n ) );
+
+   smpFor( rows, parallel, [=]( size_t begin, size_t end )
+   {
+      for( size_t r=begin; r<end; ++r )
+      {
+         const ET* x( A + ( r / pageRows )*pageStride + ( r % pageRows )*spacing );
+
+         RT mean, m2;
+         welfordRow( x, n, mean, m2 );
+
+         const RT scale( RT(1) / sqrt( m2*invn + eps ) );
+         normalizeRow( x, n, B + r*bspacing, scale, RT( -mean*scale ), gamma, beta );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Layer normalization across the rows of a dense operand.
+// \ingroup math
+//
+// \param A Pointer to the first element of the operand.
+// \param spacing The distance between two consecutive rows of the operand.
+// \param pageRows The number of rows per page of the operand.
+// \param pageStride The distance between two consecutive pages of the operand.
+// \param n The number of elements per row.
+// \param inner The number of consecutive rows between two samples of the same fiber.
+// \param extent The number of samples per fiber.
+// \param outer The number of independent blocks of \a inner times \a extent rows.
+// \param B Pointer to the first element of the result.
+// \param bspacing The distance between two consecutive rows of the result.
+// \param gamma Pointer to the \a extent scaling factors of the affine transformation.
+// \param beta Pointer to the \a extent shifts of the affine transformation.
+// \param eps The value added to the variance for numerical stability.
+// \param parallel \a true in case the fibers should be processed in parallel.
+// \return void
+//
+// The rows of the operand are interpreted as a three-dimensional \a outer x \a extent x
+// \a inner arrangement (see welfordAcrossRows()) and every fiber along the \a extent dimension
+// is normalized. The statistics of all \a n fibers of a slice are accumulated by vectorized
+// row updates, afterwards the \a extent rows of the slice are normalized right away.
+*/
+template< typename ET    // Element type of the operand
+        , typename RT >  // Type of the result elements
+void layernormAcrossRows( const ET* A, size_t spacing, size_t pageRows, size_t pageStride,
+                          size_t n, size_t inner, size_t extent, size_t outer,
+                          RT* B, size_t bspacing, const RT* gamma, const RT* beta,
+                          RT eps, bool parallel )
+{
+   using RowType = CustomVector<const ET,unaligned,unpadded,rowVector>;
+
+   using std::sqrt;
+
+   BLAZE_INTERNAL_ASSERT( extent > 0UL, "Invalid number of samples detected" );
+
+   const RT invn( RT(1) / RT( extent ) );
+
+   smpFor( outer*inner, parallel, [=]( size_t begin, size_t end )
+   {
+      DynamicVector<RT,rowVector> mean ( n );
+      DynamicVector<RT,rowVector> scale( n );
+      DynamicVector<RT,rowVector> delta( n );
+
+      for( size_t f=begin; f<end; ++f )
+      {
+         const size_t o( f / inner );
+         const size_t a( f % inner );
+
+         reset( mean  );
+         reset( scale );
+
+         for( size_t e=0UL; e<extent; ++e ) {
+            const size_t row( ( o*extent + e )*inner + a );
+            const RowType x( A + ( row / pageRows )*pageStride + ( row % pageRows )*spacing, n );
+            assign   ( delta, x - mean );
+            addAssign( mean , delta / RT( e+1UL ) );
+            addAssign( scale, delta * ( x - mean ) );
+         }
+
+         for( size_t j=0UL; j<n; ++j ) {
+            scale[j] = RT(1) / sqrt( scale[j]*invn + eps );
+            mean[j]  = -mean[j] * scale[j];
+         }
+
+         const RT* const xscale( scale.data() );
+         const RT* const xshift( mean.data()  );
+
+         for( size_t e=0UL; e<extent; ++e ) {
+            const size_t row( ( o*extent + e )*inner + a );
+            const ET* x( A + ( row / pageRows )*pageStride + ( row % pageRows )*spacing );
+            normalizeRow( x, n, B + row*bspacing, xscale, xshift, gamma[e], beta[e] );
+         }
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Normalization of the contiguous rows of a dense operand by given row statistics.
+// \ingroup math
+//
+// \param A Pointer to the first element of the operand.
+// \param spacing The distance between two consecutive rows of the operand.
+// \param pageRows The number of rows per page of the operand.
+// \param pageStride The distance between two consecutive pages of the operand.
+// \param rows The total number of rows of the operand.
+// \param n The number of elements per row.
+// \param B Pointer to the first element of the result.
+// \param bspacing The distance between two consecutive rows of the result.
+// \param scale Pointer to the first element of the per-row scaling factors.
+// \param shift Pointer to the first element of the per-row shifts.
+// \param scolumns The number of columns of the scaling factors and shifts.
+// \param sspacing The spacing between two rows of the scaling factors and shifts.
+// \param parallel \a true in case the rows should be processed in parallel.
+// \return void
+//
+// The \a r-th row of the operand is transformed by the \a r-th element (in row-major order)
+// of the given scaling factors and shifts.
+*/
+template< typename ET    // Element type of the operand
+        , typename RT >  // Type of the result elements
+void affineAlongRows( const ET* A, size_t spacing, size_t pageRows, size_t pageStride,
+                      size_t rows, size_t n,
+                      RT* B, size_t bspacing, const RT* scale, const RT* shift,
+                      size_t scolumns, size_t sspacing, bool parallel )
+{
+   smpFor( rows, parallel, [=]( size_t begin, size_t end )
+   {
+      for( size_t r=begin; r<end; ++r )
+      {
+         const size_t index( ( r / scolumns ) * sspacing + r % scolumns );
+         const ET* x( A + ( r / pageRows )*pageStride + ( r % pageRows )*spacing );
+         normalizeRow( x, n, B + r*bspacing, RT(1), RT(), scale[index], shift[index] );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Normalization across the rows of a dense operand by given fiber statistics.
+// \ingroup math
+//
+// \param A Pointer to the first element of the operand.
+// \param spacing The distance between two consecutive rows of the operand.
+// \param pageRows The number of rows per page of the operand.
+// \param pageStride The distance between two consecutive pages of the operand.
+// \param n The number of elements per row.
+// \param inner The number of consecutive rows between two samples of the same fiber.
+// \param extent The number of samples per fiber.
+// \param outer The number of independent blocks of \a inner times \a extent rows.
+// \param B Pointer to the first element of the result.
+// \param bspacing The distance between two consecutive rows of the result.
+// \param scale Pointer to the first element of the per-fiber scaling factors.
+// \param shift Pointer to the first element of the per-fiber shifts.
+// \param sspacing The spacing between two rows of the scaling factors and shifts.
+// \param parallel \a true in case the rows should be processed in parallel.
+// \return void
+//
+// The rows (o,:,a) of the operand are transformed by row \a o*inner+a of the given scaling
+// factors and shifts.
+*/
+template< typename ET    // Element type of the operand
+        , typename RT >  // Type of the result elements
+void affineAcrossRows( const ET* A, size_t spacing, size_t pageRows, size_t pageStride,
+                       size_t n, size_t inner, size_t extent, size_t outer,
+                       RT* B, size_t bspacing, const RT* scale, const RT* shift,
+                       size_t sspacing, bool parallel )
+{
+   smpFor( outer*extent*inner, parallel, [=]( size_t begin, size_t end )
+   {
+      for( size_t r=begin; r<end; ++r )
+      {
+         const size_t o( r / ( extent*inner ) );
+         const size_t a( r % inner );
+         const size_t index( ( o*inner + a )*sspacing );
+         const ET* x( A + ( r / pageRows )*pageStride + ( r % pageRows )*spacing );
+
+         normalizeRow( x, n, B + r*bspacing, scale + index, shift + index, RT(1), RT() );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the row-/column-/pagewise layer normalization of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dt The given dense tensor to be normalized.
+// \param gamma The scaling factors of the affine transformation.
+// \param beta The shifts of the affine transformation.
+// \param eps The value added to the variance for numerical stability.
+// \return The normalized tensor.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function normalizes every fiber of the given dense tensor \a dt along the dimension
+// specified by \a RF to zero mean and unit variance and subsequently applies an elementwise
+// affine transformation:
+
+                  \f[ y_i = \frac{x_i - \mu}{\sqrt{\sigma^2 + \epsilon}} \gamma_i + \beta_i, \f]
+
+// where \f$ \mu \f$ and \f$ \sigma^2 \f$ denote the mean and the (biased) variance of the
+// fiber. The size of both \a gamma and \a beta has to match the extent of the normalized
+// dimension, i.e. the number of columns for \a blaze::rowwise, the number of rows for
+// \a blaze::columnwise and the number of pages for \a blaze::pagewise. Example:
+
+   \code
+   using blaze::DynamicTensor;
+   using blaze::DynamicVector;
+
+   DynamicTensor<double> A( 8UL, 16UL, 64UL );
+   DynamicVector<double> gamma( 64UL, 1.0 ), beta( 64UL, 0.0 );
+   // ... Initialization
+
+   DynamicTensor<double> B( layernorm<rowwise>( A, gamma, beta ) );
+   \endcode
+
+// The statistics and the normalization are fused into a single kernel: every fiber is first
+// accumulated by a vectorized Welford pass and normalized immediately afterwards, while it
+// still resides in cache. In case the SMP parallelization is active, the independent fibers
+// are processed in parallel. The element type of the result corresponds to the result type of
+// mean(). In case the size of \a gamma or \a beta does not match the extent of the
+// normalized dimension, a \a std::invalid_argument is thrown.
+*/
+template< size_t RF      // Reduction flag
+        , typename TT    // Type of the dense tensor
+        , typename VT1   // Type of the scaling vector
+        , bool TF1       // Transpose flag of the scaling vector
+        , typename VT2   // Type of the shift vector
+        , bool TF2 >     // Transpose flag of the shift vector
+auto layernorm( const DenseTensor<TT>& dt, const DenseVector<VT1,TF1>& gamma,
+                const DenseVector<VT2,TF2>& beta, double eps = 1.0E-5 )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   using RT = WelfordType_t< ElementType_t<TT> >;
+
+   const size_t O( (~dt).pages()   );
+   const size_t M( (~dt).rows()    );
+   const size_t N( (~dt).columns() );
+
+   const size_t extent( RF == rowwise ? N : RF == columnwise ? M : O );
+
+   if( (~gamma).size() != extent || (~beta).size() != extent ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   DynamicTensor<RT> result( O, M, N );
+
+   if( O*M*N != 0UL )
+   {
+      WelfordOperand_t<TT> A( ~dt );
+
+      const DynamicVector<RT,TF1> g( ~gamma );
+      const DynamicVector<RT,TF2> b( ~beta  );
+
+      const bool parallel( !isSerialSectionActive() && O*M*N >= SMP_DTENSREDUCE_THRESHOLD );
+      const size_t stride( pageStride( A ) );
+
+      if( RF == rowwise ) {
+         layernormAlongRows( A.data(), A.spacing(), M, stride, O*M, N,
+                             result.data(), result.spacing(),
+                             g.data(), b.data(), RT( eps ), parallel );
+      }
+      else if( RF == columnwise ) {
+         layernormAcrossRows( A.data(), A.spacing(), M, stride, N, 1UL, M, O,
+                              result.data(), result.spacing(),
+                              g.data(), b.data(), RT( eps ), parallel );
+      }
+      else {
+         layernormAcrossRows( A.data(), A.spacing(), M, stride, N, M, O, 1UL,
+                              result.data(), result.spacing(),
+                              g.data(), b.data(), RT( eps ), parallel );
+      }
+   }
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the row-/column-/pagewise batch normalization of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dt The given dense tensor to be normalized.
+// \param mean The means of the normalized fibers.
+// \param var The variances of the normalized fibers.
+// \param gamma The scaling factors of the affine transformation.
+// \param beta The shifts of the affine transformation.
+// \param eps The value added to the variance for numerical stability.
+// \return The normalized tensor.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function normalizes every fiber of the given dense tensor \a dt along the dimension
+// specified by \a RF by the given statistics and subsequently applies an affine transformation:
+
+                  \f[ y_i = \frac{x_i - \mu}{\sqrt{\sigma^2 + \epsilon}} \gamma + \beta. \f]
+
+// In contrast to layernorm() the statistics are not computed from \a dt, but passed in (as for
+// instance the running statistics during inference). The four given matrices hold one value
+// per fiber and therefore have the shape of the result of \c mean<RF>(): pages-by-rows for
+// \a blaze::rowwise, pages-by-columns for \a blaze::columnwise and rows-by-columns for
+// \a blaze::pagewise. Example:
+
+   \code
+   using blaze::DynamicTensor;
+   using blaze::DynamicMatrix;
+
+   DynamicTensor<double> A( 32UL, 16UL, 64UL );  // A batch of 32 16x64 samples
+   DynamicMatrix<double> gamma( 16UL, 64UL, 1.0 ), beta( 16UL, 64UL, 0.0 );
+   // ... Initialization
+
+   const auto mv = meanvar<pagewise>( A );
+   DynamicTensor<double> B( batchnorm<pagewise>( A, mv.first, mv.second, gamma, beta ) );
+   \endcode
+
+// The four matrices are first folded into a single scaling factor and shift per fiber, which
+// are subsequently applied to the tensor in a single vectorized pass. In case the SMP
+// parallelization is active, the independent rows are processed in parallel. The element type
+// of the result corresponds to the result type of mean(). In case the size of any of the
+// given matrices does not match, a \a std::invalid_argument is thrown.
+*/
+template< size_t RF      // Reduction flag
+        , typename TT    // Type of the dense tensor
+        , typename MT1   // Type of the mean matrix
+        , bool SO1       // Storage order of the mean matrix
+        , typename MT2   // Type of the variance matrix
+        , bool SO2       // Storage order of the variance matrix
+        , typename MT3   // Type of the scaling matrix
+        , bool SO3       // Storage order of the scaling matrix
+        , typename MT4   // Type of the shift matrix
+        , bool SO4 >     // Storage order of the shift matrix
+auto batchnorm( const DenseTensor<TT>& dt, const DenseMatrix<MT1,SO1>& mean,
+                const DenseMatrix<MT2,SO2>& var, const DenseMatrix<MT3,SO3>& gamma,
+                const DenseMatrix<MT4,SO4>& beta, double eps = 1.0E-5 )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   using RT = WelfordType_t< ElementType_t<TT> >;
+
+   using std::sqrt;
+
+   const size_t O( (~dt).pages()   );
+   const size_t M( (~dt).rows()    );
+   const size_t N( (~dt).columns() );
+
+   const size_t m( RF == pagewise ? M : O );
+   const size_t n( RF == rowwise  ? M : N );
+
+   if( (~mean).rows()  != m || (~mean).columns()  != n ||
+       (~var).rows()   != m || (~var).columns()   != n ||
+       (~gamma).rows() != m || (~gamma).columns() != n ||
+       (~beta).rows()  != m || (~beta).columns()  != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   DynamicTensor<RT> result( O, M, N );
+
+   if( O*M*N != 0UL )
+   {
+      WelfordOperand_t<TT> A( ~dt );
+
+      CompositeType_t<MT1> mu   ( ~mean  );
+      CompositeType_t<MT2> sigma( ~var   );
+      CompositeType_t<MT3> g    ( ~gamma );
+      CompositeType_t<MT4> b    ( ~beta  );
+
+      DynamicMatrix<RT,rowMajor> scale( m, n );
+      DynamicMatrix<RT,rowMajor> shift( m, n );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            scale(i,j) = RT( g(i,j) ) / sqrt( RT( sigma(i,j) ) + RT( eps ) );
+            shift(i,j) = RT( b(i,j) ) - RT( mu(i,j) ) * scale(i,j);
+         }
+      }
+
+      const bool parallel( !isSerialSectionActive() && O*M*N >= SMP_DTENSREDUCE_THRESHOLD );
+      const size_t stride( pageStride( A ) );
+
+      if( RF == rowwise ) {
+         affineAlongRows( A.data(), A.spacing(), M, stride, O*M, N,
+                          result.data(), result.spacing(),
+                          scale.data(), shift.data(), n, scale.spacing(), parallel );
+      }
+      else if( RF == columnwise ) {
+         affineAcrossRows( A.data(), A.spacing(), M, stride, N, 1UL, M, O,
+                           result.data(), result.spacing(),
+                           scale.data(), shift.data(), scale.spacing(), parallel );
+      }
+      else {
+         affineAcrossRows( A.data(), A.spacing(), M, stride, N, M, O, 1UL,
+                           result.data(), result.spacing(),
+                           scale.data(), shift.data(), scale.spacing(), parallel );
+      }
+   }
+
+   return result;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
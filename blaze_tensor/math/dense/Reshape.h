@@ -0,0 +1,585 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/Reshape.h
+//  \brief Header file for the reshaping of dense vectors, matrices, tensors and arrays
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_RESHAPE_H_
+#define _BLAZE_TENSOR_MATH_DENSE_RESHAPE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <array>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/CustomVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+#include <blaze/util/typetraits/RemovePointer.h>
+
+#include <blaze_tensor/math/dense/Contraction.h>
+#include <blaze_tensor/math/dense/CustomArray.h>
+#include <blaze_tensor/math/dense/CustomTensor.h>
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY CLASS TEMPLATES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row interpretation of a dense operand.
+// \ingroup dense_tensor
+//
+// Describes an operand as a sequence of \a rows rows of \a columns elements each, where the
+// innermost dimension forms the rows and all outer dimensions are flattened. The operand is
+// \a regular in case all rows are \a spacing elements apart, i.e. in case the rows can be
+// addressed via a single pointer.
+*/
+struct ReshapeLayout
+{
+   size_t rows;     //!< The total number of rows.
+   size_t columns;  //!< The number of elements per row.
+   size_t spacing;  //!< The distance between two consecutive rows.
+   bool   regular;  //!< Flag for equidistant rows.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the type of a reshape view.
+// \ingroup dense_tensor
+//
+// A reshape view with \a R dimensions is represented by an unaligned, unpadded CustomVector (1),
+// row-major CustomMatrix (2), CustomTensor (3) or CustomArray (N) of (possibly const-qualified)
+// element type \a ET. The extents passed to the \a create() function are given in natural
+// order, i.e. the outermost dimension first.
+*/
+template< size_t R, typename ET >
+struct ReshapeView
+{
+   using Type = CustomArray<R,ET,unaligned,unpadded>;
+
+   template< typename... Dims >
+   static inline Type create( ET* ptr, size_t spacing, Dims... dims ) {
+      return Type( ptr, dims..., spacing );
+   }
+};
+
+template< typename ET >
+struct ReshapeView<1UL,ET>
+{
+   using Type = CustomVector<ET,unaligned,unpadded,defaultTransposeFlag>;
+
+   static inline Type create( ET* ptr, size_t /*spacing*/, size_t n ) {
+      return Type( ptr, n );
+   }
+};
+
+template< typename ET >
+struct ReshapeView<2UL,ET>
+{
+   using Type = CustomMatrix<ET,unaligned,unpadded,rowMajor>;
+
+   static inline Type create( ET* ptr, size_t spacing, size_t m, size_t n ) {
+      return Type( ptr, m, n, spacing );
+   }
+};
+
+template< typename ET >
+struct ReshapeView<3UL,ET>
+{
+   using Type = CustomTensor<ET,unaligned,unpadded>;
+
+   static inline Type create( ET* ptr, size_t spacing, size_t o, size_t m, size_t n ) {
+      return Type( ptr, o, m, n, spacing );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary alias declaration for the evaluation of a reshape operand.
+// \ingroup dense_tensor
+//
+// Operands that cannot be reshaped in-place are evaluated into a temporary with regular rows.
+// For matrices this is always a row-major matrix, since the rows of a column-major matrix are
+// not contiguous.
+*/
+template< typename T >
+using ReshapeEval_t =
+   If_t< IsDenseMatrix_v<T>, DynamicMatrix< ElementType_t<T>, rowMajor >, ResultType_t<T> >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LAYOUT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the row interpretation of the given dense vector.
+// \ingroup dense_tensor
+//
+// \param v The given dense vector.
+// \return The row interpretation of the vector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline ReshapeLayout reshapeLayout( const DenseVector<VT,TF>& v ) noexcept
+{
+   return ReshapeLayout{ 1UL, (~v).size(), (~v).size(), IsContiguous_v<VT> };
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the row interpretation of the given dense matrix.
+// \ingroup dense_tensor
+//
+// \param m The given dense matrix.
+// \return The row interpretation of the matrix.
+//
+// Only row-major matrices with contiguous rows are regular. Views with non-contiguous rows (as
+// for instance dilated submatrices) provide data access, but their spacing does not describe
+// the distance between two consecutive elements.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline ReshapeLayout reshapeLayout( const DenseMatrix<MT,SO>& m ) noexcept
+{
+   return ReshapeLayout{ (~m).rows(), (~m).columns(), (~m).spacing(),
+                         SO == rowMajor && IsContiguous_v<MT> };
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the row interpretation of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param t The given dense tensor.
+// \return The row interpretation of the tensor.
+//
+// The distance between two pages is taken from the tensor itself. Views on larger tensors
+// (as for instance subtensors) therefore only have regular rows if their pages are adjacent.
+// Views with non-contiguous rows (as for instance dilated subtensors) are never regular.
+*/
+template< typename TT >  // Type of the dense tensor
+inline ReshapeLayout reshapeLayout( const DenseTensor<TT>& t ) noexcept
+{
+   const size_t pages  ( (~t).pages()   );
+   const size_t rows   ( (~t).rows()    );
+   const size_t spacing( (~t).spacing() );
+
+   const size_t pageSpacing( ( pages > 1UL && rows > 0UL )
+                             ?( static_cast<size_t>( (~t).data(0UL,1UL) - (~t).data(0UL,0UL) ) )
+                             :( rows * spacing ) );
+
+   return ReshapeLayout{ pages*rows, (~t).columns(), spacing,
+                         IsContiguous_v<TT> && pageSpacing == rows*spacing };
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the row interpretation of the given dense array.
+// \ingroup dense_tensor
+//
+// \param a The given dense array.
+// \return The row interpretation of the array.
+*/
+template< typename AT >  // Type of the dense array
+inline ReshapeLayout reshapeLayout( const DenseArray<AT>& a ) noexcept
+{
+   const auto& dims( (~a).dimensions() );
+
+   size_t rows( 1UL );
+   for( size_t i=1UL; i<AT::num_dimensions; ++i ) {
+      rows *= dims[i];
+   }
+
+   return ReshapeLayout{ rows, dims[0], (~a).spacing(), IsContiguous_v<AT> };
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the row spacing of a reshape view.
+// \ingroup dense_tensor
+//
+// \param layout The row interpretation of the reshaped operand.
+// \param rank The number of dimensions of the view.
+// \param columns The innermost extent of the view.
+// \param spacing The resulting distance between two rows of the view.
+// \return \a true in case the operand can be viewed in the given shape, \a false if not.
+//
+// A view is possible if the innermost extent is preserved (in which case the padding of the
+// operand is kept), or if the elements of the operand are stored without gaps.
+*/
+inline bool reshapeSpacing( const ReshapeLayout& layout, size_t rank, size_t columns,
+                            size_t& spacing ) noexcept
+{
+   if( !layout.regular ) {
+      return false;
+   }
+
+   if( rank > 1UL && columns == layout.columns ) {
+      spacing = layout.spacing;
+      return true;
+   }
+
+   if( layout.rows <= 1UL || layout.spacing == layout.columns ) {
+      spacing = columns;
+      return true;
+   }
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the elements of a dense operand in row-major order into another shape.
+// \ingroup dense_tensor
+//
+// \param src Pointer to the first element of the source operand.
+// \param from The row interpretation of the source operand.
+// \param dst Pointer to the first element of the target operand.
+// \param to The row interpretation of the target operand.
+// \return void
+//
+// Both operands are required to be regular and to have the same number of elements. The
+// elements are copied in chunks of consecutive elements that belong to a single row of both
+// the source and the target.
+*/
+template< typename ET1    // Element type of the source operand
+        , typename ET2 >  // Element type of the target operand
+void reshapeKernel( const ET1* src, const ReshapeLayout& from,
+                    ET2* dst, const ReshapeLayout& to )
+{
+   BLAZE_INTERNAL_ASSERT( from.regular && to.regular, "Invalid operand layout detected" );
+   BLAZE_INTERNAL_ASSERT( from.rows*from.columns == to.rows*to.columns,
+                          "Invalid number of elements" );
+
+   size_t srow( 0UL ), scol( 0UL );
+   size_t drow( 0UL ), dcol( 0UL );
+
+   for( size_t remaining=from.rows*from.columns; remaining>0UL; )
+   {
+      const size_t len( std::min( from.columns - scol, to.columns - dcol ) );
+      const ET1* s( src + srow*from.spacing + scol );
+
+      std::copy( s, s+len, dst + drow*to.spacing + dcol );
+
+      remaining -= len;
+      scol      += len;
+      dcol      += len;
+
+      if( scol == from.columns ) {
+         scol = 0UL;
+         ++srow;
+      }
+      if( dcol == to.columns ) {
+         dcol = 0UL;
+         ++drow;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies an operand with data access into the result of a reshape operation.
+// \ingroup dense_tensor
+//
+// \param x The reshaped operand.
+// \param result The target of the reshape operation.
+// \return void
+// \exception std::invalid_argument Invalid reshape extents.
+*/
+template< typename T    // Type of the reshaped operand
+        , typename RT > // Type of the result
+inline void reshapeAssign( const T& x, RT& result, TrueType )
+{
+   const ReshapeLayout from( reshapeLayout( x ) );
+   const ReshapeLayout to  ( reshapeLayout( result ) );
+
+   if( from.rows * from.columns != to.rows * to.columns ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid reshape extents" );
+   }
+
+   if( from.regular ) {
+      reshapeKernel( x.data(), from, result.data(), to );
+   }
+   else {
+      const ReshapeEval_t<T> tmp( x );
+      reshapeKernel( tmp.data(), reshapeLayout( tmp ), result.data(), to );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies an operand without data access into the result of a reshape operation.
+// \ingroup dense_tensor
+//
+// \param x The reshaped operand.
+// \param result The target of the reshape operation.
+// \return void
+// \exception std::invalid_argument Invalid reshape extents.
+//
+// Operands without data access (as for instance expressions) are evaluated first.
+*/
+template< typename T    // Type of the reshaped operand
+        , typename RT > // Type of the result
+inline void reshapeAssign( const T& x, RT& result, FalseType )
+{
+   const ReshapeEval_t<T> tmp( x );
+
+   const ReshapeLayout from( reshapeLayout( tmp ) );
+   const ReshapeLayout to  ( reshapeLayout( result ) );
+
+   if( from.rows * from.columns != to.rows * to.columns ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid reshape extents" );
+   }
+
+   reshapeKernel( tmp.data(), from, result.data(), to );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checks whether the given operand can be viewed in the given shape without copying.
+// \ingroup dense_tensor
+//
+// \param x The dense vector, matrix, tensor or array to be reshaped.
+// \param dims The new extents, outermost first.
+// \return \a true in case reshape() can create a view in the given shape, \a false if not.
+//
+// This function returns \a true in case the total number of elements matches and the memory
+// layout of \a x allows a zero-copy view (see reshape()).
+*/
+template< typename T         // Type of the operand
+        , typename... Dims > // Types of the new extents
+inline bool canReshape( const T& x, Dims... dims )
+{
+   BLAZE_STATIC_ASSERT_MSG( ContractionRank<T>::value > 0UL, "Invalid reshape operand detected" );
+   BLAZE_STATIC_ASSERT_MSG( sizeof...(Dims) > 0UL, "Invalid number of extents" );
+
+   const std::array<size_t,sizeof...(Dims)> extents{ { static_cast<size_t>( dims )... } };
+
+   size_t total( 1UL );
+   for( size_t extent : extents ) {
+      total *= extent;
+   }
+
+   const ReshapeLayout layout( reshapeLayout( x ) );
+   size_t spacing( 0UL );
+
+   return total == layout.rows * layout.columns &&
+          reshapeSpacing( layout, sizeof...(Dims), extents.back(), spacing );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a view on the given operand in a different shape.
+// \ingroup dense_tensor
+//
+// \param x The dense vector, matrix, tensor or array to be reshaped.
+// \param dims The new extents, outermost first.
+// \return A custom vector, matrix, tensor or array referring to the elements of \a x.
+// \exception std::invalid_argument Invalid reshape extents.
+// \exception std::invalid_argument Invalid memory layout for a reshape view.
+//
+// This function reinterprets the elements of \a x in row-major order as a vector (one extent),
+// a row-major matrix (two extents), a tensor (three extents) or an array (more than three
+// extents) without copying any element:
+
+   \code
+   blaze::DynamicTensor<double> A( 8UL, 16UL, 64UL );
+   blaze::DynamicMatrix<double> W( 64UL, 32UL );
+   // ... Initialization
+
+   // Flattening the pages and rows of A for a single matrix multiplication
+   blaze::DynamicMatrix<double> C( reshape( A, 8UL*16UL, 64UL ) * W );
+
+   // Viewing A as a 4D array
+   auto B = reshape( A, 2UL, 4UL, 16UL, 64UL );
+   \endcode
+
+// The view refers to the memory of \a x, i.e. changes to the view are reflected in \a x and
+// vice versa, and it is invalidated by any operation that reallocates \a x. Since the rows of
+// \a x may be padded, a view is possible in case the innermost extent is preserved (keeping
+// the padding), or in case the elements of \a x are stored without gaps (as for instance for
+// a single row, a vector, or a tensor whose number of columns is a multiple of the SIMD width).
+// In all other cases a \a std::invalid_argument exception is thrown; canReshape() allows to
+// check the layout in advance and reshapeCopy() provides an evaluated fallback. In case \a x
+// is const, the view provides read-only access.
+*/
+template< typename T         // Type of the operand
+        , typename... Dims > // Types of the new extents
+inline auto reshape( T& x, Dims... dims )
+   -> typename ReshapeView< sizeof...(Dims), RemovePointer_t< decltype( x.data() ) > >::Type
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( ContractionRank< RemoveConst_t<T> >::value > 0UL,
+                            "Invalid reshape operand detected" );
+   BLAZE_STATIC_ASSERT_MSG( sizeof...(Dims) > 0UL, "Invalid number of extents" );
+
+   using View = ReshapeView< sizeof...(Dims), RemovePointer_t< decltype( x.data() ) > >;
+
+   const std::array<size_t,sizeof...(Dims)> extents{ { static_cast<size_t>( dims )... } };
+
+   size_t total( 1UL );
+   for( size_t extent : extents ) {
+      total *= extent;
+   }
+
+   const ReshapeLayout layout( reshapeLayout( x ) );
+
+   if( total != layout.rows * layout.columns ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid reshape extents" );
+   }
+
+   size_t spacing( 0UL );
+
+   if( !reshapeSpacing( layout, sizeof...(Dims), extents.back(), spacing ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid memory layout for a reshape view" );
+   }
+
+   return View::create( x.data(), spacing, static_cast<size_t>( dims )... );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a copy of the given operand in a different shape.
+// \ingroup dense_tensor
+//
+// \param x The dense vector, matrix, tensor or array to be reshaped.
+// \param dims The new extents, outermost first.
+// \return A dynamic vector, matrix, tensor or array containing the elements of \a x.
+// \exception std::invalid_argument Invalid reshape extents.
+//
+// This function copies the elements of \a x in row-major order into a new DynamicVector (one
+// extent), row-major DynamicMatrix (two extents), DynamicTensor (three extents) or DynamicArray
+// (more than three extents). In contrast to reshape(), it works for all operands, including
+// expressions and views with non-contiguous rows:
+
+   \code
+   blaze::DynamicTensor<double> A( 4UL, 5UL, 6UL );
+   // ... Initialization
+
+   blaze::DynamicMatrix<double> B( reshapeCopy( trans( A ), 6UL, 20UL ) );
+   \endcode
+*/
+template< typename T         // Type of the operand
+        , typename... Dims > // Types of the new extents
+inline decltype(auto) reshapeCopy( const T& x, Dims... dims )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( ContractionRank<T>::value > 0UL, "Invalid reshape operand detected" );
+   BLAZE_STATIC_ASSERT_MSG( sizeof...(Dims) > 0UL, "Invalid number of extents" );
+
+   using RT = ContractionResult< sizeof...(Dims), RemoveConst_t< ElementType_t<T> > >;
+
+   const std::array<size_t,sizeof...(Dims)> extents{ { static_cast<size_t>( dims )... } };
+
+   typename RT::Type result( RT::create( extents ) );
+
+   reshapeAssign( x, result, BoolConstant< HasConstDataAccess_v<T> >() );
+
+   return result;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -48,6 +48,7 @@
 #include <blaze_tensor/math/expressions/DenseTensor.h>
 
 #include <algorithm>
+#include <vector>
 
 namespace blaze {
 
@@ -407,6 +408,197 @@ inline void transposeGeneral210( DenseTensor<TT>& dt )
 /*! \endcond */
 //*************************************************************************************************
 
+
+//=================================================================================================
+//
+//  IN-PLACE PERMUTATION OF DENSE STORAGE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Removal of the padding elements between the rows of a dense storage.
+// \ingroup dense_tensor
+//
+// \param data Pointer to the first element of the storage.
+// \param rows The total number of rows of the storage.
+// \param n The number of elements per row.
+// \param nn The number of elements per row including the padding elements.
+// \return void
+//
+// This function moves all rows of the given padded storage to the front of the storage such
+// that the \a rows times \a n elements are stored densely.
+*/
+template< typename Type >  // Data type of the elements
+inline void packPaddedRows( Type* data, size_t rows, size_t n, size_t nn )
+{
+   BLAZE_INTERNAL_ASSERT( n <= nn, "Invalid padded row length" );
+
+   if( n == nn )
+      return;
+
+   for( size_t i=1UL; i<rows; ++i ) {
+      std::move( data+i*nn, data+i*nn+n, data+i*n );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Insertion of the padding elements between the rows of a dense storage.
+// \ingroup dense_tensor
+//
+// \param data Pointer to the first element of the storage.
+// \param rows The total number of rows of the storage.
+// \param n The number of elements per row.
+// \param nn The number of elements per row including the padding elements.
+// \return void
+//
+// This function is the inverse of the packPaddedRows() function: it distributes the \a rows
+// times \a n densely stored elements into rows of length \a nn and resets all padding elements
+// to their default value. The storage must provide space for at least \a rows times \a nn
+// elements.
+*/
+template< typename Type >  // Data type of the elements
+inline void unpackPaddedRows( Type* data, size_t rows, size_t n, size_t nn )
+{
+   BLAZE_INTERNAL_ASSERT( n <= nn, "Invalid padded row length" );
+
+   if( n == nn )
+      return;
+
+   for( size_t i=rows; i-->1UL; ) {
+      std::move_backward( data+i*n, data+i*n+n, data+i*nn+n );
+   }
+
+   for( size_t i=0UL; i<rows; ++i ) {
+      std::fill( data+i*nn+n, data+(i+1UL)*nn, Type() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place permutation of the dimensions of a densely stored array.
+// \ingroup dense_tensor
+//
+// \param data Pointer to the first element of the dense storage.
+// \param extents The \a n extents of the stored array (in natural order).
+// \param indices The \a n mapping indices of the permutation.
+// \param n The number of dimensions.
+// \return void
+//
+// This function permutes the dimensions of the given densely stored (i.e. unpadded) array in
+// place, such that dimension \a d of the result corresponds to dimension \a indices[d] of the
+// given array. The permutation is performed by following the cycles of the induced permutation
+// of the storage positions. Leading dimensions that are not moved by the permutation are treated
+// as independent batches, and trailing dimensions that are not moved are combined into blocks
+// of contiguous elements that are moved as a unit. Apart from a buffer for a single block, the
+// only scratch memory required is one bit per block of a single batch to mark the visited
+// positions.
+*/
+template< typename Type    // Data type of the elements
+        , typename T >     // Type of the mapping indices
+inline void permuteDense( Type* data, const size_t* extents, const T* indices, size_t n )
+{
+   size_t lead( 0UL );
+   while( lead < n && static_cast<size_t>( indices[lead] ) == lead ) {
+      ++lead;
+   }
+
+   if( lead == n )
+      return;
+
+   size_t trail( n );
+   while( static_cast<size_t>( indices[trail-1UL] ) == trail-1UL ) {
+      --trail;
+   }
+
+   size_t batches( 1UL );
+   for( size_t d=0UL; d<lead; ++d ) {
+      batches *= extents[d];
+   }
+
+   size_t unit( 1UL );
+   for( size_t d=trail; d<n; ++d ) {
+      unit *= extents[d];
+   }
+
+   const size_t r( trail - lead );
+
+   std::vector<size_t> strides( r );
+   std::vector<size_t> rextents( r );
+   std::vector<size_t> rstrides( r );
+
+   strides[r-1UL] = 1UL;
+   for( size_t d=r-1UL; d>0UL; --d ) {
+      strides[d-1UL] = strides[d] * extents[lead+d];
+   }
+
+   size_t count( 1UL );
+   for( size_t d=0UL; d<r; ++d ) {
+      BLAZE_USER_ASSERT( static_cast<size_t>( indices[lead+d] ) >= lead &&
+                         static_cast<size_t>( indices[lead+d] ) <  trail,
+                         "Invalid transposition mapping index" );
+      rextents[d] = extents[indices[lead+d]];
+      rstrides[d] = strides[indices[lead+d]-lead];
+      count *= rextents[d];
+   }
+
+   if( count == 0UL || unit == 0UL )
+      return;
+
+   // Computes the position of the source block of the block at position p of the result
+   const auto source = [&]( size_t p ) {
+      size_t s( 0UL );
+      for( size_t d=r; d-->0UL; ) {
+         s += ( p % rextents[d] ) * rstrides[d];
+         p /= rextents[d];
+      }
+      return s;
+   };
+
+   std::vector<bool> visited( count );
+   std::vector<Type> buffer( unit );
+
+   for( size_t b=0UL; b<batches; ++b )
+   {
+      Type* base( data + b*count*unit );
+
+      std::fill( visited.begin(), visited.end(), false );
+
+      for( size_t p0=0UL; p0<count; ++p0 )
+      {
+         if( visited[p0] )
+            continue;
+
+         visited[p0] = true;
+
+         size_t s( source( p0 ) );
+         if( s == p0 )
+            continue;
+
+         std::move( base+p0*unit, base+(p0+1UL)*unit, buffer.begin() );
+
+         size_t p( p0 );
+         while( s != p0 ) {
+            std::move( base+s*unit, base+(s+1UL)*unit, base+p*unit );
+            p = s;
+            visited[p] = true;
+            s = source( p );
+         }
+
+         std::move( buffer.begin(), buffer.end(), base+p*unit );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
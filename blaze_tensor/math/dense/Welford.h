@@ -0,0 +1,1115 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/Welford.h
+//  \brief Header file for the one-pass mean and variance computation of dense tensors and arrays
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_WELFORD_H_
+#define _BLAZE_TENSOR_MATH_DENSE_WELFORD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <cmath>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DMatMapExpr.h>
+#include <blaze/math/expressions/DMatScalarMultExpr.h>
+#include <blaze/math/shims/Invert.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+#include <blaze_tensor/math/ReductionFlag.h>
+#include <blaze_tensor/math/dense/DynamicArray.h>
+#include <blaze_tensor/math/expressions/DArrMapExpr.h>
+#include <blaze_tensor/math/expressions/DTensReduceExpr.h>
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/system/Thresholds.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY ALIAS DECLARATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary alias declaration for the element type of mean and variance computations.
+// \ingroup math
+//
+// Floating point elements are accumulated in their own precision, all other element types
+// (as for instance integral types) are accumulated in double precision.
+*/
+template< typename ET >
+using WelfordType_t = If_t< IsFloatingPoint_v<ET>, ET, double >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary alias declaration for the storage of a mean or variance operand.
+// \ingroup math
+//
+// Operands that provide direct access to contiguous rows (including views as for instance
+// subtensors) are used in-place, all other operands (as for instance expressions) are evaluated
+// once.
+*/
+template< typename T >
+using WelfordOperand_t =
+   If_t< IsContiguous_v<T> && HasConstDataAccess_v<T>
+       , const T&
+       , const ResultType_t<T> >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the vectorized Welford kernel.
+// \ingroup math
+*/
+template< typename ET    // Element type of the operand
+        , typename RT >  // Accumulation type
+constexpr bool UseVectorizedWelford_v =
+   ( useOptimizedKernels &&
+     IsSame_v<ET,RT> && IsVectorizable_v<ET> &&
+     HasSIMDAdd_v<ET,ET> && HasSIMDSub_v<ET,ET> && HasSIMDMult_v<ET,ET> );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  WELFORD KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Merges two partial Welford accumulations.
+// \ingroup math
+//
+// \param count The number of samples of the first accumulation; updated to the combined count.
+// \param mean The mean of the first accumulation; updated to the combined mean.
+// \param m2 The sum of squared deviations of the first accumulation; updated accordingly.
+// \param count2 The number of samples of the second accumulation.
+// \param mean2 The mean of the second accumulation.
+// \param m22 The sum of squared deviations of the second accumulation.
+// \return void
+//
+// This function combines two partial results by means of the pairwise update by Chan et al.,
+// which is as numerically stable as a single Welford pass over all samples.
+*/
+template< typename RT >  // Accumulation type
+inline void welfordMerge( size_t& count, RT& mean, RT& m2,
+                          size_t count2, const RT& mean2, const RT& m22 ) noexcept
+{
+   if( count2 == 0UL ) return;
+
+   if( count == 0UL ) {
+      count = count2;
+      mean  = mean2;
+      m2    = m22;
+      return;
+   }
+
+   const size_t total( count + count2 );
+   const RT delta( mean2 - mean );
+   const RT weight( RT( count2 ) / RT( total ) );
+
+   mean += delta * weight;
+   m2   += m22 + delta * delta * RT( count ) * weight;
+   count = total;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default Welford accumulation of a contiguous row of elements.
+// \ingroup math
+//
+// \param x Pointer to the first element of the row.
+// \param n The number of elements in the row.
+// \param mean The resulting mean of the row.
+// \param m2 The resulting sum of squared deviations from the mean.
+// \return void
+*/
+template< typename ET    // Element type of the operand
+        , typename RT >  // Accumulation type
+inline auto welfordRow( const ET* x, size_t n, RT& mean, RT& m2 ) noexcept
+   -> EnableIf_t< !UseVectorizedWelford_v<ET,RT> >
+{
+   mean = RT();
+   m2   = RT();
+
+   for( size_t j=0UL; j<n; ++j ) {
+      const RT value( x[j] );
+      const RT delta( value - mean );
+      mean += delta / RT( j+1UL );
+      m2   += delta * ( value - mean );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD-based Welford accumulation of a contiguous row of elements.
+// \ingroup math
+//
+// \param x Pointer to the first element of the row.
+// \param n The number of elements in the row.
+// \param mean The resulting mean of the row.
+// \param m2 The resulting sum of squared deviations from the mean.
+// \return void
+//
+// Every SIMD lane performs an independent Welford pass over every SIMDSIZE-th element. Since
+// all lanes have seen the same number of samples, the reciprocal of the count is broadcast
+// once per step. Afterwards the lanes and the remaining elements are merged pairwise.
+*/
+template< typename ET    // Element type of the operand
+        , typename RT >  // Accumulation type
+inline auto welfordRow( const ET* x, size_t n, RT& mean, RT& m2 ) noexcept
+   -> EnableIf_t< UseVectorizedWelford_v<ET,RT> >
+{
+   using SIMDType = SIMDTrait_t<RT>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<RT>::size );
+
+   const size_t jpos( n - ( n % SIMDSIZE ) );
+   BLAZE_INTERNAL_ASSERT( jpos <= n, "Invalid end calculation" );
+
+   SIMDType xmean( set( RT() ) );
+   SIMDType xm2  ( set( RT() ) );
+   size_t steps( 0UL );
+
+   for( size_t j=0UL; j<jpos; j+=SIMDSIZE ) {
+      const SIMDType value( loadu( x+j ) );
+      const SIMDType delta( value - xmean );
+      xmean += delta * set( RT(1) / RT( ++steps ) );
+      xm2   += delta * ( value - xmean );
+   }
+
+   alignas( AlignmentOf_v<RT> ) RT means[SIMDSIZE];
+   alignas( AlignmentOf_v<RT> ) RT m2s  [SIMDSIZE];
+
+   storea( means, xmean );
+   storea( m2s  , xm2   );
+
+   size_t count( 0UL );
+   mean = RT();
+   m2   = RT();
+
+   for( size_t l=0UL; l<SIMDSIZE; ++l ) {
+      welfordMerge( count, mean, m2, steps, means[l], m2s[l] );
+   }
+
+   for( size_t j=jpos; j<n; ++j ) {
+      const RT delta( x[j] - mean );
+      mean += delta / RT( ++count );
+      m2   += delta * ( x[j] - mean );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Welford accumulation along the contiguous rows of a dense operand.
+// \ingroup math
+//
+// \param A Pointer to the first element of the operand.
+// \param spacing The distance between two consecutive rows of the operand.
+// \param pageRows The number of rows per page of the operand.
+// \param pageStride The distance between two consecutive pages of the operand.
+// \param rows The total number of rows of the operand.
+// \param n The number of elements per row.
+// \param mean Pointer to the first element of the resulting means.
+// \param var Pointer to the first element of the resulting variances.
+// \param ocolumns The number of columns of the result.
+// \param ospacing The spacing between two rows of the result.
+// \param parallel \a true in case the rows should be processed in parallel.
+// \return void
+//
+// This function computes the mean and the sample variance of each row of the given operand
+// and writes the result for the \a r-th row to the \a r-th element (in row-major order) of
+// the result. The \a r-th row starts at \a (r/pageRows)*pageStride+(r%pageRows)*spacing, such
+// that the pages of views can be processed in-place. In case a row consists of a single element,
+// its variance is 0.
+*/
+template< typename ET    // Element type of the operand
+        , typename RT >  // Accumulation type
+void welfordAlongRows( const ET* A, size_t spacing, size_t pageRows, size_t pageStride,
+                       size_t rows, size_t n, RT* mean, RT* var,
+                       size_t ocolumns, size_t ospacing, bool parallel )
+{
+   BLAZE_INTERNAL_ASSERT( n > 0UL, "Invalid number of samples detected" );
+
+   const RT scale( n > 1UL ? RT(1) / RT( n-1UL ) : RT() );
+
+   smpFor( rows, parallel, [=]( size_t begin, size_t end )
+   {
+      for( size_t r=begin; r<end; ++r )
+      {
+         const size_t index( ( r / ocolumns ) * ospacing + r % ocolumns );
+         const ET* x( A + ( r / pageRows )*pageStride + ( r % pageRows )*spacing );
+         RT m2;
+         welfordRow( x, n, mean[index], m2 );
+         var[index] = m2 * scale;
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Welford accumulation across the rows of a dense operand.
+// \ingroup math
+//
+// \param A Pointer to the first element of the operand.
+// \param spacing The distance between two consecutive rows of the operand.
+// \param pageRows The number of rows per page of the operand.
+// \param pageStride The distance between two consecutive pages of the operand.
+// \param n The number of elements per row.
+// \param inner The number of consecutive rows between two samples of the same fiber.
+// \param extent The number of samples per fiber.
+// \param outer The number of independent blocks of \a inner times \a extent rows.
+// \param mean Pointer to the first element of the resulting means.
+// \param var Pointer to the first element of the resulting variances.
+// \param ospacing The spacing between two rows of the result.
+// \param parallel \a true in case the blocks should be processed in parallel.
+// \return void
+//
+// The rows of the operand are interpreted as a three-dimensional \a outer x \a extent x
+// \a inner arrangement and the reduction is performed along the \a extent dimension. The
+// result for the rows (o,:,a) is written to row \a o*inner+a of the result. The rows are
+// addressed page by page as in welfordAlongRows(). All samples of
+// a fiber are processed at once for all \a n columns such that every Welford update is a
+// vectorized row operation and the running state of the row remains in cache.
+*/
+template< typename ET    // Element type of the operand
+        , typename RT >  // Accumulation type
+void welfordAcrossRows( const ET* A, size_t spacing, size_t pageRows, size_t pageStride,
+                        size_t n, size_t inner, size_t extent, size_t outer,
+                        RT* mean, RT* var, size_t ospacing, bool parallel )
+{
+   using RowType    = CustomVector<const ET,unaligned,unpadded,rowVector>;
+   using ResultType = CustomVector<RT,unaligned,unpadded,rowVector>;
+
+   BLAZE_INTERNAL_ASSERT( extent > 0UL, "Invalid number of samples detected" );
+
+   const RT scale( extent > 1UL ? RT(1) / RT( extent-1UL ) : RT() );
+
+   smpFor( outer*inner, parallel, [=]( size_t begin, size_t end )
+   {
+      DynamicVector<RT,rowVector> delta( n );
+
+      for( size_t f=begin; f<end; ++f )
+      {
+         const size_t o( f / inner );
+         const size_t a( f % inner );
+
+         ResultType xmean( mean + f*ospacing, n );
+         ResultType xm2  ( var  + f*ospacing, n );
+
+         reset( xmean );
+         reset( xm2   );
+
+         for( size_t e=0UL; e<extent; ++e ) {
+            const size_t row( ( o*extent + e )*inner + a );
+            const RowType x( A + ( row / pageRows )*pageStride + ( row % pageRows )*spacing, n );
+            assign   ( delta, x - xmean );
+            addAssign( xmean, delta / RT( e+1UL ) );
+            addAssign( xm2  , delta * ( x - xmean ) );
+         }
+
+         assign( xm2, xm2 * scale );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Welford accumulation over all elements of a dense operand.
+// \ingroup math
+//
+// \param A Pointer to the first element of the operand.
+// \param spacing The distance between two consecutive rows of the operand.
+// \param pageRows The number of rows per page of the operand.
+// \param pageStride The distance between two consecutive pages of the operand.
+// \param rows The total number of rows of the operand.
+// \param n The number of elements per row.
+// \param mean The resulting mean of all elements.
+// \param m2 The resulting sum of squared deviations from the mean.
+// \param parallel \a true in case the rows should be processed in parallel.
+// \return void
+*/
+template< typename ET    // Element type of the operand
+        , typename RT >  // Accumulation type
+void welfordTotal( const ET* A, size_t spacing, size_t pageRows, size_t pageStride,
+                   size_t rows, size_t n, RT& mean, RT& m2, bool parallel )
+{
+   DynamicVector<RT> means( rows );
+   DynamicVector<RT> m2s  ( rows );
+
+   smpFor( rows, parallel, [&]( size_t begin, size_t end )
+   {
+      for( size_t r=begin; r<end; ++r ) {
+         const ET* x( A + ( r / pageRows )*pageStride + ( r % pageRows )*spacing );
+         welfordRow( x, n, means[r], m2s[r] );
+      }
+   } );
+
+   size_t count( 0UL );
+   mean = RT();
+   m2   = RT();
+
+   for( size_t r=0UL; r<rows; ++r ) {
+      welfordMerge( count, mean, m2, n, means[r], m2s[r] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DENSE TENSOR FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the mean and the variance for the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dt The given dense tensor for the computation.
+// \return A pair of the mean and the sample variance of the given tensor.
+// \exception std::invalid_argument Invalid input tensor.
+//
+// This function computes both the arithmetic mean and the
+// <a href="https://en.wikipedia.org/wiki/Variance">sample variance</a> for the given dense
+// tensor \a dt by means of a single pass over all elements. Every row is accumulated by a
+// vectorized Welford kernel and the partial results are merged pairwise, which results in
+// the same numerical stability as the classical two-pass algorithm. Example:
+
+   \code
+   using blaze::DynamicTensor;
+
+   DynamicTensor<int> A{ { { 1, 3, 2 }, { 2, 6, 4 } }, { { 9, 6, 3 }, { 4, 5, 2 } } };
+
+   const auto mv = meanvar( A );  // Results in ( 47/12, 683/132 )
+   \endcode
+
+// In case the size of the given tensor is smaller than 2, a \a std::invalid_argument is thrown.
+*/
+template< typename TT >  // Type of the dense tensor
+auto meanvar( const DenseTensor<TT>& dt )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using RT = WelfordType_t< ElementType_t<TT> >;
+
+   const size_t n( (~dt).pages() * (~dt).rows() * (~dt).columns() );
+
+   if( n < 2UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid input tensor" );
+   }
+
+   WelfordOperand_t<TT> A( ~dt );
+
+   const bool parallel( !isSerialSectionActive() && n >= SMP_DTENSREDUCE_THRESHOLD );
+
+   RT mean, m2;
+   welfordTotal( A.data(), A.spacing(), A.rows(), pageStride( A ), A.pages()*A.rows(), A.columns(),
+                 mean, m2, parallel );
+
+   return std::make_pair( mean, m2 / RT( n-1UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the row-/column-/pagewise mean and variance for the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dt The given dense tensor for the computation.
+// \return A pair of the row-/column-/pagewise means and sample variances.
+// \exception std::invalid_argument Invalid input tensor.
+//
+// This function computes the row-/column-/pagewise mean and
+// <a href="https://en.wikipedia.org/wiki/Variance">sample variance</a> for the given dense
+// tensor \a dt. The shape of both resulting matrices corresponds to the shape of the result
+// of \c sum<RF>(): pages-by-rows for \a blaze::rowwise, pages-by-columns for
+// \a blaze::columnwise and rows-by-columns for \a blaze::pagewise.
+//
+// The computation is performed in a single pass over the tensor. For \a blaze::rowwise every
+// row is accumulated by a vectorized Welford kernel, for \a blaze::columnwise and
+// \a blaze::pagewise the Welford update is applied to complete rows at once. Views such as
+// subtensors are processed in-place. In case the SMP parallelization is active, the independent
+// rows or slices are processed in parallel. In case the extent of the reduced dimension is
+// smaller than 2, a \a std::invalid_argument is thrown.
+*/
+template< size_t RF      // Reduction flag
+        , typename TT >  // Type of the dense tensor
+auto meanvar( const DenseTensor<TT>& dt )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   using RT = WelfordType_t< ElementType_t<TT> >;
+
+   const size_t O( (~dt).pages()   );
+   const size_t M( (~dt).rows()    );
+   const size_t N( (~dt).columns() );
+
+   if( ( RF == rowwise ? N : RF == columnwise ? M : O ) < 2UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid input tensor" );
+   }
+
+   const size_t m( RF == pagewise ? M : O );
+   const size_t n( RF == rowwise  ? M : N );
+
+   DynamicMatrix<RT,rowMajor> mean( m, n );
+   DynamicMatrix<RT,rowMajor> var ( m, n );
+
+   if( O*M*N != 0UL )
+   {
+      WelfordOperand_t<TT> A( ~dt );
+
+      const bool parallel( !isSerialSectionActive() && O*M*N >= SMP_DTENSREDUCE_THRESHOLD );
+
+      const size_t stride( pageStride( A ) );
+
+      if( RF == rowwise ) {
+         welfordAlongRows( A.data(), A.spacing(), M, stride, O*M, N,
+                           mean.data(), var.data(), n, mean.spacing(), parallel );
+      }
+      else if( RF == columnwise ) {
+         welfordAcrossRows( A.data(), A.spacing(), M, stride, N, 1UL, M, O,
+                            mean.data(), var.data(), mean.spacing(), parallel );
+      }
+      else {
+         welfordAcrossRows( A.data(), A.spacing(), M, stride, N, M, O, 1UL,
+                            mean.data(), var.data(), mean.spacing(), parallel );
+      }
+   }
+
+   return std::make_pair( std::move( mean ), std::move( var ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the variance for the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dt The given dense tensor for the variance computation.
+// \return The sample variance of the given tensor.
+// \exception std::invalid_argument Invalid input tensor.
+//
+// This function computes the <a href="https://en.wikipedia.org/wiki/Variance">sample
+// variance</a> for the given dense tensor \a dt in a single numerically stable pass (see
+// meanvar()). In case the size of the given tensor is smaller than 2, a
+// \a std::invalid_argument is thrown.
+*/
+template< typename TT >  // Type of the dense tensor
+inline auto var( const DenseTensor<TT>& dt )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return meanvar( ~dt ).second;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the row-/column-/pagewise variance for the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dt The given dense tensor for the variance computation.
+// \return The row-/column-/pagewise sample variance of the given tensor.
+// \exception std::invalid_argument Invalid input tensor.
+//
+// This function computes the row-/column-/pagewise sample variance for the given dense tensor
+// \a dt in a single numerically stable pass (see meanvar()):
+
+   \code
+   using blaze::DynamicTensor;
+   using blaze::DynamicMatrix;
+
+   DynamicTensor<int> A{ { { 1, 3, 2 }, { 2, 6, 4 } }, { { 9, 6, 3 }, { 4, 5, 2 } } };
+   DynamicMatrix<double> rv, cv, pv;
+
+   rv = var<rowwise>( A );     // Results in ( ( 1, 4 ), ( 9, 2.33333 ) )
+   cv = var<columnwise>( A );  // Results in ( ( 0.5, 4.5, 2 ), ( 12.5, 0.5, 0.5 ) )
+   pv = var<pagewise>( A );    // Results in ( ( 32, 4.5, 0.5 ), ( 2, 0.5, 2 ) )
+   \endcode
+
+// In case the extent of the reduced dimension is smaller than 2, a \a std::invalid_argument
+// is thrown.
+*/
+template< size_t RF      // Reduction flag
+        , typename TT >  // Type of the dense tensor
+inline auto var( const DenseTensor<TT>& dt )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return meanvar<RF>( ~dt ).second;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the (arithmetic) mean for the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dt The given dense tensor for the mean computation.
+// \return The mean of the given tensor.
+// \exception std::invalid_argument Invalid input tensor.
+//
+// This function computes the
+// <a href="https://en.wikipedia.org/wiki/Arithmetic_mean">arithmetic mean</a> for the given
+// dense tensor \a dt. Example:
+
+   \code
+   using blaze::DynamicTensor;
+
+   DynamicTensor<int> A{ { { 1, 4, 3, 6 }, { 7, 2, 6, 8 } } };
+
+   const double m = mean( A );  // Results in 4.625 (37/8)
+   \endcode
+
+// In case the size of the given tensor is 0, a \a std::invalid_argument is thrown. The mean of
+// integral tensors is computed in double precision.
+*/
+template< typename TT >  // Type of the dense tensor
+inline decltype(auto) mean( const DenseTensor<TT>& dt )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using RT = WelfordType_t< ElementType_t<TT> >;
+
+   const size_t n( (~dt).pages() * (~dt).rows() * (~dt).columns() );
+
+   if( n == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid input tensor" );
+   }
+
+   return RT( sum( ~dt ) ) / RT( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the row-/column-/pagewise mean function for the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dt The given dense tensor for the mean computation.
+// \return The row-/column-/pagewise mean of the given tensor.
+// \exception std::invalid_argument Invalid input tensor.
+//
+// This function computes the row-/column-/pagewise
+// <a href="https://en.wikipedia.org/wiki/Arithmetic_mean">arithmetic mean</a> for the given
+// dense tensor \a dt. In case \a RF is set to \a blaze::rowwise, the function returns a
+// pages-by-rows matrix of the means of all rows, in case \a RF is set to \a blaze::columnwise,
+// it returns a pages-by-columns matrix of the means of all columns and in case \a RF is set to
+// \a blaze::pagewise, it returns a rows-by-columns matrix of the means along the pages:
+
+   \code
+   using blaze::DynamicTensor;
+   using blaze::DynamicMatrix;
+
+   DynamicTensor<int> A{ { { 1, 4, 3, 6 }, { 7, 2, 6, 8 } } };
+   DynamicMatrix<double> rm, cm;
+
+   rm = mean<rowwise>( A );     // Results in ( ( 3.5, 5.75 ) )
+   cm = mean<columnwise>( A );  // Results in ( ( 4, 3, 4.5, 7 ) )
+   \endcode
+
+// In case the extent of the reduced dimension is 0, a \a std::invalid_argument is thrown. The
+// means are computed by a single vectorized summation of the reduced dimension.
+*/
+template< size_t RF      // Reduction flag
+        , typename TT >  // Type of the dense tensor
+inline decltype(auto) mean( const DenseTensor<TT>& dt )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   using RT = WelfordType_t< ElementType_t<TT> >;
+
+   const size_t n( RF == rowwise    ? (~dt).columns()
+                 : RF == columnwise ? (~dt).rows()
+                 :                    (~dt).pages() );
+
+   if( n == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid input tensor" );
+   }
+
+   return sum<RF>( ~dt ) * inv( RT( n ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the standard deviation for the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dt The given dense tensor for the standard deviation computation.
+// \return The standard deviation of the given tensor.
+// \exception std::invalid_argument Invalid input tensor.
+//
+// This function computes the
+// <a href="https://en.wikipedia.org/wiki/Standard_deviation">standard deviation</a> for the
+// given dense tensor \a dt, i.e. the square root of the sample variance (see var()). In case
+// the size of the given tensor is smaller than 2, a \a std::invalid_argument is thrown.
+*/
+template< typename TT >  // Type of the dense tensor
+inline auto stddev( const DenseTensor<TT>& dt )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using std::sqrt;
+
+   return sqrt( var( ~dt ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the row-/column-/pagewise standard deviation for the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dt The given dense tensor for the standard deviation computation.
+// \return The row-/column-/pagewise standard deviation of the given tensor.
+// \exception std::invalid_argument Invalid input tensor.
+//
+// This function computes the row-/column-/pagewise
+// <a href="https://en.wikipedia.org/wiki/Standard_deviation">standard deviation</a> for the
+// given dense tensor \a dt (see var()). In case the extent of the reduced dimension is smaller
+// than 2, a \a std::invalid_argument is thrown.
+*/
+template< size_t RF      // Reduction flag
+        , typename TT >  // Type of the dense tensor
+inline auto stddev( const DenseTensor<TT>& dt )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   auto tmp( var<RF>( ~dt ) );
+   tmp = sqrt( tmp );
+   return tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DENSE ARRAY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the total mean and variance of a dense array.
+// \ingroup dense_array
+//
+// \param da The given non-empty dense array.
+// \return A pair of the mean and the sum of squared deviations from the mean.
+*/
+template< typename AT >  // Type of the dense array
+auto meanvar_backend( const DenseArray<AT>& da )
+{
+   using RT = WelfordType_t< ElementType_t<AT> >;
+
+   WelfordOperand_t<AT> A( ~da );
+
+   const size_t columns( A.template dimension<0UL>() );
+   const size_t n( size( A ) );
+   const bool parallel( !isSerialSectionActive() && n >= SMP_DARRREDUCE_THRESHOLD );
+
+   const size_t rows( n / columns );
+
+   RT mean, m2;
+   welfordTotal( A.data(), A.spacing(), rows, rows*A.spacing(), rows, columns, mean, m2, parallel );
+
+   return std::make_pair( mean, m2 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the mean and variance of a dense array along dimension \a R.
+// \ingroup dense_array
+//
+// \param da The given dense array with at least one element along dimension \a R.
+// \return A pair of the means and the sample variances along dimension \a R.
+//
+// Dimension 0 denotes the contiguous columns of the array. The dimensions below \a R are
+// treated as the inner, the dimensions above \a R as the outer extent of the reduction.
+*/
+template< size_t R       // Reduction dimension
+        , typename AT >  // Type of the dense array
+auto meanvar_backend( const DenseArray<AT>& da )
+{
+   constexpr size_t N( AT::num_dimensions );
+
+   BLAZE_STATIC_ASSERT_MSG( N > 1UL, "Invalid array dimensionality" );
+   BLAZE_STATIC_ASSERT_MSG( R < N, "Invalid reduction dimension" );
+
+   using RT = WelfordType_t< ElementType_t<AT> >;
+
+   const std::array<size_t,N>& dims( (~da).dimensions() );
+
+   std::array<size_t,N-1UL> rdims;
+   size_t inner( 1UL ), outer( 1UL ), total( 1UL );
+
+   for( size_t i=0UL, j=0UL; i<N; ++i ) {
+      total *= dims[i];
+      if( i == R ) continue;
+      rdims[j++] = dims[i];
+      if( i > 0UL && i < R ) inner *= dims[i];
+      if( i > R ) outer *= dims[i];
+   }
+
+   DynamicArray<N-1UL,RT> mean( rdims );
+   DynamicArray<N-1UL,RT> var ( rdims );
+
+   if( total != 0UL )
+   {
+      WelfordOperand_t<AT> A( ~da );
+
+      const bool parallel( !isSerialSectionActive() && total >= SMP_DARRREDUCE_THRESHOLD );
+
+      const size_t rows( total / dims[0] );
+
+      if( R == 0UL ) {
+         welfordAlongRows( A.data(), A.spacing(), rows, rows*A.spacing(), rows, dims[0],
+                           mean.data(), var.data(), rdims[0], mean.spacing(), parallel );
+      }
+      else {
+         welfordAcrossRows( A.data(), A.spacing(), rows, rows*A.spacing(),
+                            dims[0], inner, dims[R], outer,
+                            mean.data(), var.data(), mean.spacing(), parallel );
+      }
+   }
+
+   return std::make_pair( std::move( mean ), std::move( var ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the mean and the variance for the given dense array.
+// \ingroup dense_array
+//
+// \param da The given dense array for the computation.
+// \return A pair of the mean and the sample variance of the given array.
+// \exception std::invalid_argument Invalid input array.
+//
+// This function computes both the arithmetic mean and the
+// <a href="https://en.wikipedia.org/wiki/Variance">sample variance</a> for the given dense
+// array \a da by means of a single pass over all elements. Every row is accumulated by a
+// vectorized Welford kernel and the partial results are merged pairwise. In case the size
+// of the given array is smaller than 2, a \a std::invalid_argument is thrown.
+*/
+template< typename AT >  // Type of the dense array
+auto meanvar( const DenseArray<AT>& da )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using RT = WelfordType_t< ElementType_t<AT> >;
+
+   const size_t n( size( ~da ) );
+
+   if( n < 2UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid input array" );
+   }
+
+   const auto mv( meanvar_backend( ~da ) );
+
+   return std::make_pair( mv.first, mv.second / RT( n-1UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the mean and the variance along dimension \a R for the given dense array.
+// \ingroup dense_array
+//
+// \param da The given dense array for the computation.
+// \return A pair of the means and the sample variances along dimension \a R.
+// \exception std::invalid_argument Invalid input array.
+//
+// This function computes the mean and the
+// <a href="https://en.wikipedia.org/wiki/Variance">sample variance</a> along the dimension
+// \a R of the given N-dimensional dense array \a da. Both results are (N-1)-dimensional arrays
+// with the dimension \a R removed. Dimension 0 refers to the columns of the array:
+
+   \code
+   blaze::DynamicArray<3,double> A( 4UL, 5UL, 6UL );
+   // ... Initialization
+
+   const auto mv = meanvar<1UL>( A );  // Two 4x6 arrays, reduced along the 5 rows
+   \endcode
+
+// The computation is performed in a single vectorized Welford pass. In case the SMP
+// parallelization is active, the independent fibers are processed in parallel. In case the
+// extent of dimension \a R is smaller than 2, a \a std::invalid_argument is thrown.
+*/
+template< size_t R       // Reduction dimension
+        , typename AT >  // Type of the dense array
+auto meanvar( const DenseArray<AT>& da )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( R < AT::num_dimensions, "Invalid reduction dimension" );
+
+   if( (~da).template dimension<R>() < 2UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid input array" );
+   }
+
+   return meanvar_backend<R>( ~da );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the variance for the given dense array.
+// \ingroup dense_array
+//
+// \param da The given dense array for the variance computation.
+// \return The sample variance of the given array.
+// \exception std::invalid_argument Invalid input array.
+//
+// This function computes the <a href="https://en.wikipedia.org/wiki/Variance">sample
+// variance</a> for the given dense array \a da in a single numerically stable pass (see
+// meanvar()). In case the size of the given array is smaller than 2, a
+// \a std::invalid_argument is thrown.
+*/
+template< typename AT >  // Type of the dense array
+inline auto var( const DenseArray<AT>& da )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return meanvar( ~da ).second;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the variance along dimension \a R for the given dense array.
+// \ingroup dense_array
+//
+// \param da The given dense array for the variance computation.
+// \return The sample variance along dimension \a R of the given array.
+// \exception std::invalid_argument Invalid input array.
+//
+// This function computes the sample variance along the dimension \a R of the given dense
+// array \a da (see meanvar()). In case the extent of dimension \a R is smaller than 2, a
+// \a std::invalid_argument is thrown.
+*/
+template< size_t R       // Reduction dimension
+        , typename AT >  // Type of the dense array
+inline auto var( const DenseArray<AT>& da )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return meanvar<R>( ~da ).second;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the (arithmetic) mean for the given dense array.
+// \ingroup dense_array
+//
+// \param da The given dense array for the mean computation.
+// \return The mean of the given array.
+// \exception std::invalid_argument Invalid input array.
+//
+// This function computes the
+// <a href="https://en.wikipedia.org/wiki/Arithmetic_mean">arithmetic mean</a> for the given
+// dense array \a da. In case the size of the given array is 0, a \a std::invalid_argument is
+// thrown. The mean of integral arrays is computed in double precision.
+*/
+template< typename AT >  // Type of the dense array
+inline auto mean( const DenseArray<AT>& da )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( size( ~da ) == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid input array" );
+   }
+
+   return meanvar_backend( ~da ).first;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the mean along dimension \a R for the given dense array.
+// \ingroup dense_array
+//
+// \param da The given dense array for the mean computation.
+// \return The mean along dimension \a R of the given array.
+// \exception std::invalid_argument Invalid input array.
+//
+// This function computes the
+// <a href="https://en.wikipedia.org/wiki/Arithmetic_mean">arithmetic mean</a> along the
+// dimension \a R of the given N-dimensional dense array \a da. The result is a
+// (N-1)-dimensional array with the dimension \a R removed. Dimension 0 refers to the columns
+// of the array. In case the extent of dimension \a R is 0, a \a std::invalid_argument is
+// thrown.
+*/
+template< size_t R       // Reduction dimension
+        , typename AT >  // Type of the dense array
+inline auto mean( const DenseArray<AT>& da )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( R < AT::num_dimensions, "Invalid reduction dimension" );
+
+   if( (~da).template dimension<R>() == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid input array" );
+   }
+
+   return meanvar_backend<R>( ~da ).first;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the standard deviation for the given dense array.
+// \ingroup dense_array
+//
+// \param da The given dense array for the standard deviation computation.
+// \return The standard deviation of the given array.
+// \exception std::invalid_argument Invalid input array.
+//
+// This function computes the
+// <a href="https://en.wikipedia.org/wiki/Standard_deviation">standard deviation</a> for the
+// given dense array \a da, i.e. the square root of the sample variance (see var()). In case
+// the size of the given array is smaller than 2, a \a std::invalid_argument is thrown.
+*/
+template< typename AT >  // Type of the dense array
+inline auto stddev( const DenseArray<AT>& da )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using std::sqrt;
+
+   return sqrt( var( ~da ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the standard deviation along dimension \a R for the given dense array.
+// \ingroup dense_array
+//
+// \param da The given dense array for the standard deviation computation.
+// \return The standard deviation along dimension \a R of the given array.
+// \exception std::invalid_argument Invalid input array.
+//
+// This function computes the standard deviation along the dimension \a R of the given dense
+// array \a da (see var()). In case the extent of dimension \a R is smaller than 2, a
+// \a std::invalid_argument is thrown.
+*/
+template< size_t R       // Reduction dimension
+        , typename AT >  // Type of the dense array
+inline auto stddev( const DenseArray<AT>& da )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   auto tmp( var<R>( ~da ) );
+   tmp = sqrt( tmp );
+   return tmp;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
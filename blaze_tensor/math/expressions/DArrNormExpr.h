@@ -136,7 +136,167 @@ struct DArrNormHelper
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Computes a custom norm for the given dense array.
+/*!\brief Default backend implementation of the norm of a block of a dense array.
+// \ingroup dense_array
+//
+// \param dm The given dense array for the norm computation.
+// \param page The first flattened page of the block.
+// \param row The first row of the block.
+// \param column The first column of the block.
+// \param o The number of flattened pages of the block.
+// \param m The number of rows of the block.
+// \param n The number of columns of the block.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \return The sum of the powers of the absolute values of the elements of the block.
+//
+// This function accumulates the given block of a dense array for the norm computation. All
+// dimensions beyond the rows are treated as a single flattened page dimension (see
+// getArrayPages()) and the innermost rows of the block are traversed by means of iterators.
+// This overload is selected in case vectorization cannot be applied.
+*/
+template< typename MT      // Type of the dense array
+        , typename Abs     // Type of the abs operation
+        , typename Power > // Type of the power operation
+inline ElementType_t<MT>
+   darraynorm( const DenseArray<MT>& dm, size_t page, size_t row, size_t column,
+               size_t o, size_t m, size_t n, Abs abs, Power power, FalseType )
+{
+   using ET = ElementType_t<MT>;
+
+   const auto& dims( (~dm).dimensions() );
+
+   BLAZE_INTERNAL_ASSERT( page + o <= getArrayPages( dims ), "Invalid page range"   );
+   BLAZE_INTERNAL_ASSERT( row + m <= dims[1]               , "Invalid row range"    );
+   BLAZE_INTERNAL_ASSERT( column + n <= dims[0]            , "Invalid column range" );
+
+   ET norm{};
+
+   for( size_t k=page; k<page+o; ++k ) {
+      for( size_t i=row; i<row+m; ++i )
+      {
+         auto it( ArrayRowBegin( ~dm, getArrayRowIndices( dims, k, i ) ) + column );
+
+         for( size_t j=0UL; j<n; ++j, ++it ) {
+            norm += power( abs( *it ) );
+         }
+      }
+   }
+
+   return norm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the norm of a block of a dense array.
+// \ingroup dense_array
+//
+// \param dm The given dense array for the norm computation.
+// \param page The first flattened page of the block.
+// \param row The first row of the block.
+// \param column The first column of the block.
+// \param o The number of flattened pages of the block.
+// \param m The number of rows of the block.
+// \param n The number of columns of the block.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \return The sum of the powers of the absolute values of the elements of the block.
+//
+// This function accumulates the given block of a dense array for the norm computation by means
+// of four independent SIMD accumulators. The elements beyond the last full SIMD pack of each row
+// (or all elements in case \a column is not a multiple of the SIMD size) are accumulated by
+// scalar operations.
+*/
+template< typename MT      // Type of the dense array
+        , typename Abs     // Type of the abs operation
+        , typename Power > // Type of the power operation
+inline ElementType_t<MT>
+   darraynorm( const DenseArray<MT>& dm, size_t page, size_t row, size_t column,
+               size_t o, size_t m, size_t n, Abs abs, Power power, TrueType )
+{
+   using ET = ElementType_t<MT>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const auto& dims( (~dm).dimensions() );
+
+   BLAZE_INTERNAL_ASSERT( page + o <= getArrayPages( dims ), "Invalid page range"   );
+   BLAZE_INTERNAL_ASSERT( row + m <= dims[1]               , "Invalid row range"    );
+   BLAZE_INTERNAL_ASSERT( column + n <= dims[0]            , "Invalid column range" );
+
+   const size_t jpos( ( column % SIMDSIZE == 0UL )?( n & size_t(-SIMDSIZE) ):( 0UL ) );
+
+   SIMDTrait_t<ET> xmm1, xmm2, xmm3, xmm4;
+   ET norm{};
+
+   for( size_t k=page; k<page+o; ++k ) {
+      for( size_t i=row; i<row+m; ++i )
+      {
+         auto it( ArrayRowBegin( ~dm, getArrayRowIndices( dims, k, i ) ) + column );
+         size_t j( 0UL );
+
+         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+            xmm1 += power( abs( it.load() ) ); it += SIMDSIZE;
+            xmm2 += power( abs( it.load() ) ); it += SIMDSIZE;
+            xmm3 += power( abs( it.load() ) ); it += SIMDSIZE;
+            xmm4 += power( abs( it.load() ) ); it += SIMDSIZE;
+         }
+         for( ; j<jpos; j+=SIMDSIZE, it+=SIMDSIZE ) {
+            xmm1 += power( abs( it.load() ) );
+         }
+         for( ; j<n; ++j, ++it ) {
+            norm += power( abs( *it ) );
+         }
+      }
+   }
+
+   norm += sum( xmm1 + xmm2 + xmm3 + xmm4 );
+
+   return norm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Accumulation of a block of a dense array for the norm computation.
+// \ingroup dense_array
+//
+// \param dm The given dense array for the norm computation.
+// \param page The first flattened page of the block.
+// \param row The first row of the block.
+// \param column The first column of the block.
+// \param o The number of flattened pages of the block.
+// \param m The number of rows of the block.
+// \param n The number of columns of the block.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \return The sum of the powers of the absolute values of the elements of the block.
+//
+// This function selects the SIMD optimized kernel in case vectorization can be applied. It is
+// the building block of both the serial and the parallel (see smpNorm()) norm computation.
+*/
+template< typename MT      // Type of the dense array
+        , typename Abs     // Type of the abs operation
+        , typename Power > // Type of the power operation
+inline ElementType_t<MT>
+   darraynorm( const DenseArray<MT>& dm, size_t page, size_t row, size_t column,
+               size_t o, size_t m, size_t n, Abs abs, Power power )
+{
+   return darraynorm( ~dm, page, row, column, o, m, n, abs, power,
+                      Bool_t< DArrNormHelper<MT,Abs,Power>::value >() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of a custom norm of a dense array.
 // \ingroup dense_array
 //
 // \param dm The given dense array for the norm computation.
@@ -145,28 +305,20 @@ struct DArrNormHelper
 // \param root The functor for the root operation.
 // \return The norm of the given dense array.
 //
-// This function computes a custom norm of the given dense array by means of the given functors.
-// The following example demonstrates the computation of the L2 norm by means of the blaze::Pow2
-// and blaze::Sqrt functors:
-
-   \code
-   blaze::DenseArray<double> A;
-   // ... Resizing and initialization
-   const double l2 = norm( A, blaze::Pow2(), blaze::Sqrt() );
-   \endcode
+// This function implements the single-threaded computation of a custom norm of a dense array.
 */
 template< typename MT      // Type of the dense array
         , typename Abs     // Type of the abs operation
         , typename Power   // Type of the power operation
         , typename Root >  // Type of the root operation
-decltype(auto) norm_backend( const DenseArray<MT>& dm, Abs abs, Power power, Root root )
+inline decltype(auto) darraynorm( const DenseArray<MT>& dm, Abs abs, Power power, Root root )
 {
    using CT = CompositeType_t<MT>;
    using ET = ElementType_t<MT>;
    using RT = decltype( evaluate( root( std::declval<ET>() ) ) );
 
    if( ArrayDimAnyOf( ( ~dm ).dimensions(),
-          []( size_t i, size_t dim ) { return dim == 0; } ) ) {
+          []( size_t, size_t dim ) { return dim == 0UL; } ) ) {
       return RT{};
    }
 
@@ -174,16 +326,10 @@ decltype(auto) norm_backend( const DenseArray<MT>& dm, Abs abs, Power power, Roo
 
    BLAZE_INTERNAL_ASSERT( tmp.dimensions() == (~dm).dimensions(), "Invalid number of elements" );
 
-   using AT = RemoveCV_t<RemoveReference_t< decltype( ~dm ) > >;
-   constexpr size_t N = AT::num_dimensions;
-
-   std::array< size_t, N > dims{};
-   ET norm( power( abs( tmp( dims ) ) ) );
+   const auto& dims( tmp.dimensions() );
 
-   ArrayForEachGrouped( ( ~dm ).dimensions(),
-      [&]( std::array< size_t, N > const& dims ) {
-         norm += power( abs( tmp( dims ) ) );
-      } );
+   const ET norm( darraynorm( tmp, 0UL, 0UL, 0UL, getArrayPages( dims ), dims[1], dims[0],
+                              abs, power ) );
 
    return evaluate( root( norm ) );
 }
@@ -191,6 +337,41 @@ decltype(auto) norm_backend( const DenseArray<MT>& dm, Abs abs, Power power, Roo
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes a custom norm for the given dense array.
+// \ingroup dense_array
+//
+// \param dm The given dense array for the norm computation.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \param root The functor for the root operation.
+// \return The norm of the given dense array.
+//
+// This function computes a custom norm of the given dense array by means of the given functors.
+// In case a shared memory parallelization mode is active and the array has at least
+// SMP_DARRREDUCE_THRESHOLD elements, the norm is computed in parallel. The following example
+// demonstrates the computation of the L2 norm by means of the blaze::Pow2 and blaze::Sqrt
+// functors:
+
+   \code
+   blaze::DenseArray<double> A;
+   // ... Resizing and initialization
+   const double l2 = norm( A, blaze::Pow2(), blaze::Sqrt() );
+   \endcode
+*/
+template< typename MT      // Type of the dense array
+        , typename Abs     // Type of the abs operation
+        , typename Power   // Type of the power operation
+        , typename Root >  // Type of the root operation
+decltype(auto) norm_backend( const DenseArray<MT>& dm, Abs abs, Power power, Root root )
+{
+   return smpNorm( ~dm, abs, power, root );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Computes the L2 norm for the given dense array.
 // \ingroup dense_array
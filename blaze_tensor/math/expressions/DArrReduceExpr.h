@@ -63,6 +63,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
@@ -924,51 +925,223 @@ struct ArrayHelper
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default backend implementation of the reduction of a dense array.
+/*!\brief Default backend implementation of the reduction of a block of a dense array.
 // \ingroup dense_array
 //
 // \param dm The given dense array for the reduction computation.
+// \param page The first flattened page of the block.
+// \param row The first row of the block.
+// \param column The first column of the block.
+// \param o The number of flattened pages of the block.
+// \param m The number of rows of the block.
+// \param n The number of columns of the block.
 // \param op The reduction operation.
 // \return The result of the reduction operation.
 //
-// This function implements the performance optimized reduction operation for a dense
-// array. Due to the explicit application of the SFINAE principle, this function can only be
-// selected by the compiler in case vectorization cannot be applied.
+// This function implements the reduction of a non-empty block of a dense array. All dimensions
+// beyond the rows are treated as a single flattened page dimension (see getArrayPages()) and
+// the innermost rows of the block are traversed by means of iterators. This overload is selected
+// in case vectorization cannot be applied.
 */
 template< typename MT    // Type of the dense array
         , typename OP >  // Type of the reduction operation
-inline ElementType_t<MT> darrayreduce( const DenseArray<MT>& dm, OP op )
+inline ElementType_t<MT>
+   darrayreduce( const DenseArray<MT>& dm, size_t page, size_t row, size_t column,
+                 size_t o, size_t m, size_t n, OP op, FalseType )
 {
-   using CT = CompositeType_t<MT>;
    using ET = ElementType_t<MT>;
 
-   constexpr size_t N =
-      RemoveCV_t< RemoveReference_t< decltype( ~dm ) > >::num_dimensions;
+   const auto& dims( (~dm).dimensions() );
+
+   BLAZE_INTERNAL_ASSERT( o > 0UL && m > 0UL && n > 0UL, "Invalid block size"   );
+   BLAZE_INTERNAL_ASSERT( page + o <= getArrayPages( dims ), "Invalid page range"   );
+   BLAZE_INTERNAL_ASSERT( row + m <= dims[1]               , "Invalid row range"    );
+   BLAZE_INTERNAL_ASSERT( column + n <= dims[0]            , "Invalid column range" );
+
+   ET redux( *( ArrayRowBegin( ~dm, getArrayRowIndices( dims, page, row ) ) + column ) );
+
+   size_t jbegin( 1UL );
+
+   for( size_t k=page; k<page+o; ++k ) {
+      for( size_t i=row; i<row+m; ++i )
+      {
+         auto it( ArrayRowBegin( ~dm, getArrayRowIndices( dims, k, i ) ) + ( column + jbegin ) );
+
+         for( size_t j=jbegin; j<n; ++j, ++it ) {
+            redux = op( redux, *it );
+         }
+
+         jbegin = 0UL;
+      }
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the reduction of a block of a dense array.
+// \ingroup dense_array
+//
+// \param dm The given dense array for the reduction computation.
+// \param page The first flattened page of the block.
+// \param row The first row of the block.
+// \param column The first column of the block.
+// \param o The number of flattened pages of the block.
+// \param m The number of rows of the block.
+// \param n The number of columns of the block.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the SIMD optimized reduction of a non-empty block of a dense array.
+// The innermost rows are reduced into a single SIMD accumulator, which is only reduced to a
+// scalar value at the very end. The elements beyond the last full SIMD pack of each row are
+// reduced separately. In case \a column is not a multiple of the SIMD size or the rows are too
+// short for a single SIMD pack, the block is reduced by the default kernel.
+*/
+template< typename MT    // Type of the dense array
+        , typename OP >  // Type of the reduction operation
+inline ElementType_t<MT>
+   darrayreduce( const DenseArray<MT>& dm, size_t page, size_t row, size_t column,
+                 size_t o, size_t m, size_t n, OP op, TrueType )
+{
+   using ET = ElementType_t<MT>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const auto& dims( (~dm).dimensions() );
+
+   BLAZE_INTERNAL_ASSERT( o > 0UL && m > 0UL && n > 0UL, "Invalid block size"   );
+   BLAZE_INTERNAL_ASSERT( page + o <= getArrayPages( dims ), "Invalid page range"   );
+   BLAZE_INTERNAL_ASSERT( row + m <= dims[1]               , "Invalid row range"    );
+   BLAZE_INTERNAL_ASSERT( column + n <= dims[0]            , "Invalid column range" );
+
+   const size_t jpos( ( column % SIMDSIZE == 0UL )?( n & size_t(-SIMDSIZE) ):( 0UL ) );
+
+   if( jpos == 0UL ) {
+      return darrayreduce( ~dm, page, row, column, o, m, n, op, FalseType() );
+   }
+
+   const auto first( ArrayRowBegin( ~dm, getArrayRowIndices( dims, page, row ) ) + column );
+
+   SIMDTrait_t<ET> xmm1( first.load() );
+   ET rest{};
+
+   size_t jbegin( SIMDSIZE );
+   size_t jrest ( jpos );
+
+   if( jpos < n ) {
+      rest = *( first + jpos );
+      ++jrest;
+   }
+
+   for( size_t k=page; k<page+o; ++k ) {
+      for( size_t i=row; i<row+m; ++i )
+      {
+         const auto begin( ArrayRowBegin( ~dm, getArrayRowIndices( dims, k, i ) ) + column );
+
+         auto it( begin + jbegin );
+         size_t j( jbegin );
+
+         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+            const SIMDTrait_t<ET> xmm2( it.load() ); it += SIMDSIZE;
+            const SIMDTrait_t<ET> xmm3( it.load() ); it += SIMDSIZE;
+            const SIMDTrait_t<ET> xmm4( it.load() ); it += SIMDSIZE;
+            const SIMDTrait_t<ET> xmm5( it.load() ); it += SIMDSIZE;
+            xmm1 = op( xmm1, op( op( xmm2, xmm3 ), op( xmm4, xmm5 ) ) );
+         }
+         for( ; j<jpos; j+=SIMDSIZE, it+=SIMDSIZE ) {
+            xmm1 = op( xmm1, it.load() );
+         }
+
+         it = begin + jrest;
+
+         for( j=jrest; j<n; ++j, ++it ) {
+            rest = op( rest, *it );
+         }
+
+         jbegin = 0UL;
+         jrest  = jpos;
+      }
+   }
 
-   std::array< size_t, N > dims{};
+   ET redux( reduce( xmm1, op ) );
+
+   if( jpos < n ) {
+      redux = op( redux, rest );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduction of a block of a dense array.
+// \ingroup dense_array
+//
+// \param dm The given dense array for the reduction computation.
+// \param page The first flattened page of the block.
+// \param row The first row of the block.
+// \param column The first column of the block.
+// \param o The number of flattened pages of the block.
+// \param m The number of rows of the block.
+// \param n The number of columns of the block.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given non-empty block of the dense array \a dm and selects the SIMD
+// optimized kernel in case vectorization can be applied. It is the building block of both the
+// serial and the parallel (see smpReduce()) reduction of dense arrays.
+*/
+template< typename MT    // Type of the dense array
+        , typename OP >  // Type of the reduction operation
+inline ElementType_t<MT>
+   darrayreduce( const DenseArray<MT>& dm, size_t page, size_t row, size_t column,
+                 size_t o, size_t m, size_t n, OP op )
+{
+   return darrayreduce( ~dm, page, row, column, o, m, n, op,
+                        Bool_t< ArrayHelper<MT,OP>::value >() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the reduction of a dense array.
+// \ingroup dense_array
+//
+// \param dm The given dense array for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the single-threaded reduction of a dense array. In case the array
+// is empty, a default constructed element is returned.
+*/
+template< typename MT    // Type of the dense array
+        , typename OP >  // Type of the reduction operation
+inline ElementType_t<MT> darrayreduce( const DenseArray<MT>& dm, OP op )
+{
+   using CT = CompositeType_t<MT>;
+   using ET = ElementType_t<MT>;
 
    if( ArrayDimAnyOf( ( ~dm ).dimensions(),
-          []( size_t, size_t dim ) { return dim == 0; } ) )
+          []( size_t, size_t dim ) { return dim == 0UL; } ) )
       return ET{};
 
-   if( ArrayDimAllOf( ( ~dm ).dimensions(),
-          []( size_t, size_t dim ) { return dim == 1; } ) )
-      return ( ~dm )( dims );
-
    CT tmp( ~dm );
 
    BLAZE_INTERNAL_ASSERT( tmp.dimensions() == (~dm).dimensions(), "Invalid number of elements" );
 
-   ET redux = ( ~dm )( dims );   // start with first element
+   const auto& dims( tmp.dimensions() );
 
-   std::array< size_t, N > starts_with{1};
-   ArrayForEachGroupedStartsWith( ( ~dm ).dimensions(),
-      [&]( std::array< size_t, N > const& dims ) {
-         redux = op( redux, tmp( dims ) );
-      },
-      starts_with );
-
-   return redux;
+   return darrayreduce( tmp, 0UL, 0UL, 0UL, getArrayPages( dims ), dims[1], dims[0], op );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -999,6 +1172,9 @@ inline ElementType_t<MT> darrayreduce( const DenseArray<MT>& dm, OP op )
 // possible to create vectorized custom operations. See \ref custom_operations for a detailed
 // overview of the possibilities of custom operations.
 //
+// In case a shared memory parallelization mode is active and the array has at least
+// SMP_DARRREDUCE_THRESHOLD elements, the reduction is performed in parallel.
+//
 // Please note that the evaluation order of the reduction operation is unspecified. Thus the
 // behavior is non-deterministic if \a op is not associative or not commutative. Also, the
 // operation is undefined if the given reduction operation modifies the values.
@@ -1009,7 +1185,7 @@ inline decltype(auto) reduce( const DenseArray<MT>& dm, OP op )
 {
    BLAZE_FUNCTION_TRACE;
 
-   return darrayreduce( ~dm, op );
+   return smpReduce( ~dm, op );
 }
 //*************************************************************************************************
 
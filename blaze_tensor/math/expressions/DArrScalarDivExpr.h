@@ -46,6 +46,7 @@
 #include <blaze_tensor/math/expressions/Forward.h>
 #include <blaze_tensor/math/expressions/DenseArray.h>
 #include <blaze_tensor/math/expressions/ArrScalarDivExpr.h>
+#include <blaze_tensor/math/traits/TemporaryTrait.h>
 
 namespace blaze {
 
@@ -630,7 +631,7 @@ class DArrScalarDivExpr
 
       BLAZE_INTERNAL_ASSERT( ( ~lhs ).dimensions() == rhs.dimensions(), "Invalid number of elements" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryTrait_t<ResultType> tmp( serial( rhs ) );
       addAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -665,7 +666,7 @@ class DArrScalarDivExpr
 
       BLAZE_INTERNAL_ASSERT( ( ~lhs ).dimensions() == rhs.dimensions(), "Invalid number of elements" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryTrait_t<ResultType> tmp( serial( rhs ) );
       subAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -700,7 +701,7 @@ class DArrScalarDivExpr
 
       BLAZE_INTERNAL_ASSERT( ( ~lhs ).dimensions() == rhs.dimensions(), "Invalid number of elements" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryTrait_t<ResultType> tmp( serial( rhs ) );
       schurAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -759,7 +760,7 @@ class DArrScalarDivExpr
 
       BLAZE_INTERNAL_ASSERT( ( ~lhs ).dimensions() == rhs.dimensions(), "Invalid number of elements" );
 
-      const ResultType tmp( rhs );
+      const TemporaryTrait_t<ResultType> tmp( rhs );
       smpAddAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -790,7 +791,7 @@ class DArrScalarDivExpr
 
       BLAZE_INTERNAL_ASSERT( ( ~lhs ).dimensions() == rhs.dimensions(), "Invalid number of elements" );
 
-      const ResultType tmp( rhs );
+      const TemporaryTrait_t<ResultType> tmp( rhs );
       smpSubAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -821,7 +822,7 @@ class DArrScalarDivExpr
 
       BLAZE_INTERNAL_ASSERT( ( ~lhs ).dimensions() == rhs.dimensions(), "Invalid number of elements" );
 
-      const ResultType tmp( rhs );
+      const TemporaryTrait_t<ResultType> tmp( rhs );
       smpSchurAssign( ~lhs, tmp );
    }
    /*! \endcond */
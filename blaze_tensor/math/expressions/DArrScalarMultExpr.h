@@ -46,6 +46,7 @@
 #include <blaze_tensor/math/expressions/DenseArray.h>
 #include <blaze_tensor/math/expressions/Forward.h>
 #include <blaze_tensor/math/expressions/ArrScalarMultExpr.h>
+#include <blaze_tensor/math/traits/TemporaryTrait.h>
 
 namespace blaze {
 
@@ -630,7 +631,7 @@ class DArrScalarMultExpr
 
       BLAZE_INTERNAL_ASSERT( ( ~lhs ).dimensions() == rhs.dimensions(), "Invalid number of elements" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryTrait_t<ResultType> tmp( serial( rhs ) );
       addAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -661,7 +662,7 @@ class DArrScalarMultExpr
 
       BLAZE_INTERNAL_ASSERT( ( ~lhs ).dimensions() == rhs.dimensions(), "Invalid number of elements" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryTrait_t<ResultType> tmp( serial( rhs ) );
       subAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -692,7 +693,7 @@ class DArrScalarMultExpr
 
       BLAZE_INTERNAL_ASSERT( ( ~lhs ).dimensions() == rhs.dimensions(), "Invalid number of elements" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryTrait_t<ResultType> tmp( serial( rhs ) );
       schurAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -751,7 +752,7 @@ class DArrScalarMultExpr
 
       BLAZE_INTERNAL_ASSERT( ( ~lhs ).dimensions() == rhs.dimensions(), "Invalid number of elements" );
 
-      const ResultType tmp( rhs );
+      const TemporaryTrait_t<ResultType> tmp( rhs );
       smpAddAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -782,7 +783,7 @@ class DArrScalarMultExpr
 
       BLAZE_INTERNAL_ASSERT( ( ~lhs ).dimensions() == rhs.dimensions(), "Invalid number of elements" );
 
-      const ResultType tmp( rhs );
+      const TemporaryTrait_t<ResultType> tmp( rhs );
       smpSubAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -813,7 +814,7 @@ class DArrScalarMultExpr
 
       BLAZE_INTERNAL_ASSERT( ( ~lhs ).dimensions() == rhs.dimensions(), "Invalid number of elements" );
 
-      const ResultType tmp( rhs );
+      const TemporaryTrait_t<ResultType> tmp( rhs );
       smpSchurAssign( ~lhs, tmp );
    }
    /*! \endcond */
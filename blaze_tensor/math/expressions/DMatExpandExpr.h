@@ -45,29 +45,47 @@
 #include <blaze/math/Exception.h>
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/expressions/DMatDMatAddExpr.h>
+#include <blaze/math/expressions/DMatDMatSchurExpr.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/ExpandExprData.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/Transformation.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/functors/Sub.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/traits/ExpandTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/IsSIMDEnabled.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/StorageOrder.h>
+#include <blaze/system/CacheSize.h>
 #include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
 #include <blaze/util/InvalidType.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/MaybeUnused.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/typetraits/GetMemberType.h>
 
+#include <blaze_tensor/math/ReductionFlag.h>
+#include <blaze_tensor/math/dense/Expansion.h>
+#include <blaze_tensor/math/expressions/DTensDMatMapExpr.h>
 #include <blaze_tensor/math/expressions/MatExpandExpr.h>
+#include <blaze_tensor/math/typetraits/IsDenseTensor.h>
+#include <blaze_tensor/system/Thresholds.h>
 
 namespace blaze {
 
@@ -102,6 +120,39 @@ class DMatExpandExpr
    BLAZE_CREATE_GET_TYPE_MEMBER_TYPE_TRAIT( GetConstIterator, ConstIterator, INVALID_TYPE );
    //**********************************************************************************************
 
+   //**Expansion kernel strategy*******************************************************************
+   //! Row-major result type of the dense matrix operand.
+   using RRT = If_t< StorageOrder_v<MT> == rowMajor
+                   , ResultType_t<MT>
+                   , OppositeType_t< ResultType_t<MT> > >;
+
+   //! Type for the row access of the dense matrix operand by the expansion kernels.
+   /*! Row-major matrices with direct access to their contiguous rows are used in-place, all
+       other matrix operands are evaluated once into a row-major matrix. */
+   using KT = If_t< StorageOrder_v<MT> == rowMajor &&
+                    IsContiguous_v<MT> && HasConstDataAccess_v<MT>
+                  , CT
+                  , const RRT >;
+
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the expansion kernels. In case the
+       target tensor provides direct access to its contiguous rows, the variable is set to 1 and
+       every row of the matrix operand is written to all pages of the target while it resides in
+       the cache. Otherwise the variable is set to 0 and the default strategy is chosen. */
+   template< typename MT1 >
+   static constexpr bool UseKernel_v =
+      ( IsDenseTensor_v<MT1> && IsContiguous_v<MT1> && HasMutableDataAccess_v<MT1> );
+
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the parallel expansion kernels,
+       which distribute the pages of the target tensor among the threads of the active SMP
+       backend (see smpFor()). */
+   template< typename MT1 >
+   static constexpr bool UseSMPKernel_v = UseKernel_v<MT1>;
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Serial evaluation strategy******************************************************************
    //! Compilation switch for the serial evaluation strategy of the expansion expression.
    /*! The \a useAssign compile time constant expression represents a compilation switch for
@@ -359,6 +410,210 @@ class DMatExpandExpr
    Operand dm_;  //!< Dense matrix of the expansion expression.
    //**********************************************************************************************
 
+   //**Expansion kernels***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Writes every row of the given row-major dense matrix to all pages of a dense tensor.
+   //
+   // \param T The target dense tensor.
+   // \param A The row-major dense matrix operand.
+   // \param parallel \a true in case the pages should be processed in parallel.
+   // \return void
+   //
+   // Targets that exceed the cache are written by means of non-temporal stores.
+   */
+   template< typename MT1    // Type of the target dense tensor
+           , typename MT2 >  // Type of the row-major dense matrix
+   static inline void expandAssign( MT1& T, const MT2& A, bool parallel )
+   {
+      using ET1 = ElementType_t<MT1>;
+      using ET2 = ElementType_t<MT2>;
+
+      using Vectorized = BoolConstant< UseVectorizedExpansion_v<ET2,ET1> >;
+
+      const size_t m( A.rows()    );
+      const size_t n( A.columns() );
+      const size_t o( T.pages()   );
+
+      if( m == 0UL || n == 0UL || o == 0UL )
+         return;
+
+      const bool streaming( useStreaming && o*m*n > ( cacheSize / ( sizeof(ET1) * 3UL ) ) );
+
+      expandPages( m, o, expansionBlockSize( n, sizeof(ET2) ), [&]( size_t i, size_t k ) {
+         expandRow( A.data(i), n, T.data(i,k), streaming, Vectorized() );
+      }, parallel );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Expansion kernels***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Combines every row of the given row-major dense matrix with all pages of a dense
+   //        tensor.
+   //
+   // \param T The target dense tensor.
+   // \param A The row-major dense matrix operand.
+   // \param op The (compound) assignment operation.
+   // \param parallel \a true in case the pages should be processed in parallel.
+   // \return void
+   */
+   template< typename MT1   // Type of the target dense tensor
+           , typename MT2   // Type of the row-major dense matrix
+           , typename OP >  // Type of the (compound) assignment operation
+   static inline void expandUpdate( MT1& T, const MT2& A, OP op, bool parallel )
+   {
+      using ET1 = ElementType_t<MT1>;
+      using ET2 = ElementType_t<MT2>;
+
+      using Vectorized = BoolConstant< UseVectorizedExpansion_v<ET2,ET1> &&
+                                       OP::template simdEnabled<ET1,ET1>() >;
+
+      const size_t m( A.rows()    );
+      const size_t n( A.columns() );
+      const size_t o( T.pages()   );
+
+      if( m == 0UL || n == 0UL || o == 0UL )
+         return;
+
+      expandPages( m, o, expansionBlockSize( n, sizeof(ET2) ), [&]( size_t i, size_t k ) {
+         expandMapRow( T.data(i,k), A.data(i), n, T.data(i,k), op, Vectorized() );
+      }, parallel );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense tensors (expansion kernel)**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix expansion expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side expansion expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense matrix
+   // expansion expression to a dense tensor with contiguous rows. The matrix operand is evaluated
+   // at most once and every row of the matrix is written to all pages of the target tensor while
+   // it resides in the cache. Due to the explicit application of the SFINAE principle, this
+   // function can only be selected by the compiler in case the target tensor provides direct
+   // access to its rows.
+   */
+   template< typename MT1 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseKernel_v<MT1> >
+      assign( Tensor<MT1>& lhs, const DMatExpandExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      KT A( serial( ~rhs.dm_ ) );
+
+      expandAssign( ~lhs, A, false );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense tensors (expansion kernel)*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a dense matrix expansion expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side expansion expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a dense matrix
+   // expansion expression to a dense tensor with contiguous rows. The matrix operand is evaluated
+   // at most once and every row of the matrix is written to all pages of the target tensor while
+   // it resides in the cache. Due to the explicit application of the SFINAE principle, this
+   // function can only be selected by the compiler in case the target tensor provides direct
+   // access to its rows.
+   */
+   template< typename MT1 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseKernel_v<MT1> >
+      addAssign( Tensor<MT1>& lhs, const DMatExpandExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      KT A( serial( ~rhs.dm_ ) );
+
+      expandUpdate( ~lhs, A, Add(), false );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense tensors (expansion kernel)**********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a dense matrix expansion expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side expansion expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a dense matrix
+   // expansion expression to a dense tensor with contiguous rows. The matrix operand is evaluated
+   // at most once and every row of the matrix is written to all pages of the target tensor while
+   // it resides in the cache. Due to the explicit application of the SFINAE principle, this
+   // function can only be selected by the compiler in case the target tensor provides direct
+   // access to its rows.
+   */
+   template< typename MT1 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseKernel_v<MT1> >
+      subAssign( Tensor<MT1>& lhs, const DMatExpandExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      KT A( serial( ~rhs.dm_ ) );
+
+      expandUpdate( ~lhs, A, Sub(), false );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Schur product assignment to dense tensors (expansion kernel)********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Schur product assignment of a dense matrix expansion expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side expansion expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized Schur product assignment of a dense matrix
+   // expansion expression to a dense tensor with contiguous rows. The matrix operand is evaluated
+   // at most once and every row of the matrix is written to all pages of the target tensor while
+   // it resides in the cache. Due to the explicit application of the SFINAE principle, this
+   // function can only be selected by the compiler in case the target tensor provides direct
+   // access to its rows.
+   */
+   template< typename MT1 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseKernel_v<MT1> >
+      schurAssign( Tensor<MT1>& lhs, const DMatExpandExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      KT A( serial( ~rhs.dm_ ) );
+
+      expandUpdate( ~lhs, A, Mult(), false );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to matrices**********************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense matrix expansion expression to a tensor.
@@ -374,7 +629,7 @@ class DMatExpandExpr
    // evaluation.
    */
    template< typename MT1 > // Type of the target tensor
-   friend inline EnableIf_t< UseAssign_v<MT1> >
+   friend inline EnableIf_t< UseAssign_v<MT1> && !UseKernel_v<MT1> >
       assign( Tensor<MT1>& lhs, const DMatExpandExpr& rhs )
    {
       using blaze::expand;
@@ -407,7 +662,7 @@ class DMatExpandExpr
    // intermediate evaluation.
    */
    template< typename MT1 > // Type of the target tensor
-   friend inline EnableIf_t< UseAssign_v<MT1> >
+   friend inline EnableIf_t< UseAssign_v<MT1> && !UseKernel_v<MT1> >
       addAssign( Tensor<MT1>& lhs, const DMatExpandExpr& rhs )
    {
       using blaze::expand;
@@ -440,7 +695,7 @@ class DMatExpandExpr
    // intermediate evaluation.
    */
    template< typename MT1 > // Type of the target tensor
-   friend inline EnableIf_t< UseAssign_v<MT1> >
+   friend inline EnableIf_t< UseAssign_v<MT1> && !UseKernel_v<MT1> >
       subAssign( Tensor<MT1>& lhs, const DMatExpandExpr& rhs )
    {
       using blaze::expand;
@@ -473,7 +728,7 @@ class DMatExpandExpr
    // an intermediate evaluation.
    */
    template< typename MT1 > // Type of the target tensor
-   friend inline EnableIf_t< UseAssign_v<MT1> >
+   friend inline EnableIf_t< UseAssign_v<MT1> && !UseKernel_v<MT1> >
       schurAssign( Tensor<MT1>& lhs, const DMatExpandExpr& rhs )
    {
       using blaze::expand;
@@ -539,7 +794,7 @@ class DMatExpandExpr
    // evaluation strategy is selected.
    */
    template< typename MT1 > // Type of the target tensor
-   friend inline EnableIf_t< UseSMPAssign_v<MT1> >
+   friend inline EnableIf_t< UseSMPAssign_v<MT1> && !UseSMPKernel_v<MT1> >
       smpAssign( Tensor<MT1>& lhs, const DMatExpandExpr& rhs )
    {
       using blaze::expand;
@@ -572,7 +827,7 @@ class DMatExpandExpr
    // specific parallel evaluation strategy is selected.
    */
    template< typename MT1 > // Type of the target tensor
-   friend inline EnableIf_t< UseSMPAssign_v<MT1> >
+   friend inline EnableIf_t< UseSMPAssign_v<MT1> && !UseSMPKernel_v<MT1> >
       smpAddAssign( Tensor<MT1>& lhs, const DMatExpandExpr& rhs )
    {
       using blaze::expand;
@@ -605,7 +860,7 @@ class DMatExpandExpr
    // specific parallel evaluation strategy is selected.
    */
    template< typename MT1 > // Type of the target tensor
-   friend inline EnableIf_t< UseSMPAssign_v<MT1> >
+   friend inline EnableIf_t< UseSMPAssign_v<MT1> && !UseSMPKernel_v<MT1> >
       smpSubAssign( Tensor<MT1>& lhs, const DMatExpandExpr& rhs )
    {
       using blaze::expand;
@@ -638,7 +893,7 @@ class DMatExpandExpr
    // specific parallel evaluation strategy is selected.
    */
    template< typename MT1 > // Type of the target tensor
-   friend inline EnableIf_t< UseSMPAssign_v<MT1> >
+   friend inline EnableIf_t< UseSMPAssign_v<MT1> && !UseSMPKernel_v<MT1> >
       smpSchurAssign( Tensor<MT1>& lhs, const DMatExpandExpr& rhs )
    {
       using blaze::expand;
@@ -689,6 +944,150 @@ class DMatExpandExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to dense tensors (expansion kernel)******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense matrix expansion expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side expansion expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a dense matrix
+   // expansion expression to a dense tensor with contiguous rows. The pages of the target tensor
+   // are distributed among the threads and each thread expands every row of the matrix operand
+   // into its pages while the row resides in the cache. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the target
+   // tensor provides direct access to its rows.
+   */
+   template< typename MT1 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseSMPKernel_v<MT1> >
+      smpAssign( Tensor<MT1>& lhs, const DMatExpandExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      KT A( ~rhs.dm_ );
+
+      const size_t size( (~lhs).pages() * (~lhs).rows() * (~lhs).columns() );
+      const bool parallel( !isSerialSectionActive() && size >= SMP_DTENSASSIGN_THRESHOLD );
+
+      expandAssign( ~lhs, A, parallel );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense tensors (expansion kernel)*********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a dense matrix expansion expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side expansion expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a dense matrix
+   // expansion expression to a dense tensor with contiguous rows. The pages of the target tensor
+   // are distributed among the threads and each thread expands every row of the matrix operand
+   // into its pages while the row resides in the cache. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the target
+   // tensor provides direct access to its rows.
+   */
+   template< typename MT1 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseSMPKernel_v<MT1> >
+      smpAddAssign( Tensor<MT1>& lhs, const DMatExpandExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      KT A( ~rhs.dm_ );
+
+      const size_t size( (~lhs).pages() * (~lhs).rows() * (~lhs).columns() );
+      const bool parallel( !isSerialSectionActive() && size >= SMP_DTENSASSIGN_THRESHOLD );
+
+      expandUpdate( ~lhs, A, Add(), parallel );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense tensors (expansion kernel)******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a dense matrix expansion expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side expansion expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a dense
+   // matrix expansion expression to a dense tensor with contiguous rows. The pages of the target
+   // tensor are distributed among the threads and each thread expands every row of the matrix
+   // operand into its pages while the row resides in the cache. Due to the explicit application
+   // of the SFINAE principle, this function can only be selected by the compiler in case the
+   // target tensor provides direct access to its rows.
+   */
+   template< typename MT1 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseSMPKernel_v<MT1> >
+      smpSubAssign( Tensor<MT1>& lhs, const DMatExpandExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      KT A( ~rhs.dm_ );
+
+      const size_t size( (~lhs).pages() * (~lhs).rows() * (~lhs).columns() );
+      const bool parallel( !isSerialSectionActive() && size >= SMP_DTENSASSIGN_THRESHOLD );
+
+      expandUpdate( ~lhs, A, Sub(), parallel );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP Schur product assignment to dense tensors (expansion kernel)****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP Schur product assignment of a dense matrix expansion expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side expansion expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized SMP Schur product assignment of a dense
+   // matrix expansion expression to a dense tensor with contiguous rows. The pages of the target
+   // tensor are distributed among the threads and each thread expands every row of the matrix
+   // operand into its pages while the row resides in the cache. Due to the explicit application
+   // of the SFINAE principle, this function can only be selected by the compiler in case the
+   // target tensor provides direct access to its rows.
+   */
+   template< typename MT1 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseSMPKernel_v<MT1> >
+      smpSchurAssign( Tensor<MT1>& lhs, const DMatExpandExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      KT A( ~rhs.dm_ );
+
+      const size_t size( (~lhs).pages() * (~lhs).rows() * (~lhs).columns() );
+      const bool parallel( !isSerialSectionActive() && size >= SMP_DTENSASSIGN_THRESHOLD );
+
+      expandUpdate( ~lhs, A, Mult(), parallel );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Compile time checks*************************************************************************
    /*! \cond BLAZE_INTERNAL */
    BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT );
@@ -836,6 +1235,297 @@ inline decltype(auto) expand( const DenseMatrix<MT, SO>& dm, size_t expansion )
 
 
 
+//=================================================================================================
+//
+//  AUXILIARY FUNCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Adapter for the evaluation of a binary operation with swapped operands.
+// \ingroup dense_tensor
+//
+// The pagewise broadcast (see \c map<pagewise>()) passes the tensor element as first and the
+// matrix element as second argument to the given operation. The SwapOperands adapter restores
+// the operand order of \f$ expand(A) \circ B \f$, i.e. it evaluates \f$ A(i,j) \circ B(k,i,j) \f$.
+*/
+template< typename OP >  // Type of the binary operation
+struct SwapOperands
+{
+   //**********************************************************************************************
+   /*!\brief Constructor of the SwapOperands adapter.
+   //
+   // \param op The binary operation.
+   */
+   explicit inline SwapOperands( const OP& op )
+      : op_( op )  // The binary operation
+   {}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the result of the binary operation with swapped operands.
+   //
+   // \param a The tensor element.
+   // \param b The matrix element.
+   // \return The result of \f$ op(b,a) \f$.
+   */
+   template< typename T1, typename T2 >
+   BLAZE_ALWAYS_INLINE decltype(auto) operator()( const T1& a, const T2& b ) const
+   {
+      return op_( b, a );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether SIMD is enabled for the specified data types \a T1 and \a T2.
+   //
+   // \return \a true in case SIMD is enabled for the data types \a T1 and \a T2, \a false if not.
+   */
+   template< typename T1, typename T2 >
+   static constexpr bool simdEnabled() { return IsSIMDEnabled_v<OP,T2,T1>; }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the result of the binary operation with swapped SIMD operands.
+   //
+   // \param a The SIMD vector of tensor elements.
+   // \param b The SIMD vector of matrix elements.
+   // \return The result of \f$ op(b,a) \f$.
+   */
+   template< typename T1, typename T2 >
+   BLAZE_ALWAYS_INLINE decltype(auto) load( const T1& a, const T2& b ) const
+   {
+      return op_.load( b, a );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   OP op_;  //!< The binary operation.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Addition operator for the addition of a dense matrix expansion and a dense tensor
+//        (\f$ C=expand(A)+B \f$).
+// \ingroup dense_tensor
+//
+// \param lhs The dense matrix expansion for the addition.
+// \param rhs The right-hand side dense tensor for the addition.
+// \return The sum of the expanded matrix and the tensor.
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// This operator fuses the expansion of a dense matrix with the subsequent addition of a dense
+// tensor: instead of reading the matrix once per page, the addition is evaluated as pagewise
+// broadcast of the matrix (see \c add<pagewise>()), which combines every row of the matrix with
+// the corresponding rows of all pages while the row resides in the cache:
+
+   \code
+   blaze::DynamicMatrix<double> A( 1000UL, 1000UL );
+   blaze::DynamicTensor<double> B( 256UL, 1000UL, 1000UL ), C;
+   // ... Initialization
+
+   C = expand( A, 256UL ) + B;
+   \endcode
+
+// The operand order is preserved, i.e. every element is evaluated as \f$ A(i,j)+B(k,i,j) \f$.
+// In case the number of pages of the expansion or the number of rows or columns of the matrix
+// don't match the tensor, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CEAs    // Compile time expansion arguments
+        , typename TT >     // Type of the right-hand side dense tensor
+inline decltype(auto)
+   operator+( const DMatExpandExpr<MT,CEAs...>& lhs, const DenseTensor<TT>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( lhs.pages() != (~rhs).pages() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+   }
+
+   return map<pagewise>( ~rhs, lhs.operand(), SwapOperands<Add>( Add() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Operator for the Schur product of a dense matrix expansion and a dense tensor
+//        (\f$ C=expand(A)\circ B \f$).
+// \ingroup dense_tensor
+//
+// \param lhs The dense matrix expansion for the Schur product.
+// \param rhs The right-hand side dense tensor for the Schur product.
+// \return The Schur product of the expanded matrix and the tensor.
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// This operator fuses the expansion of a dense matrix with the subsequent Schur product with
+// a dense tensor. Analogous to the addition operator, the Schur product is evaluated as pagewise
+// broadcast of the matrix (see \c schur<pagewise>()), i.e. as \f$ A(i,j) \cdot B(k,i,j) \f$. In
+// case the number of pages of the expansion or the number of rows or columns of the matrix don't
+// match the tensor, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CEAs    // Compile time expansion arguments
+        , typename TT >     // Type of the right-hand side dense tensor
+inline decltype(auto)
+   operator%( const DMatExpandExpr<MT,CEAs...>& lhs, const DenseTensor<TT>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( lhs.pages() != (~rhs).pages() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+   }
+
+   return map<pagewise>( ~rhs, lhs.operand(), SwapOperands<Mult>( Mult() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition operator for the addition of a dense tensor and a dense matrix expansion
+//        (\f$ C=A+expand(B) \f$).
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side dense tensor for the addition.
+// \param rhs The dense matrix expansion for the addition.
+// \return The sum of the tensor and the expanded matrix.
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// This operator is the counterpart of the addition of a dense matrix expansion and a dense
+// tensor: the addition is evaluated as pagewise broadcast of the matrix (see \c add<pagewise>()),
+// i.e. as \f$ A(k,i,j)+B(i,j) \f$. In case the number of pages of the expansion or the number
+// of rows or columns of the matrix don't match the tensor, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename TT       // Type of the left-hand side dense tensor
+        , typename MT       // Type of the dense matrix
+        , size_t... CEAs >  // Compile time expansion arguments
+inline decltype(auto)
+   operator+( const DenseTensor<TT>& lhs, const DMatExpandExpr<MT,CEAs...>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).pages() != rhs.pages() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+   }
+
+   return map<pagewise>( ~lhs, rhs.operand(), Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Operator for the Schur product of a dense tensor and a dense matrix expansion
+//        (\f$ C=A\circ expand(B) \f$).
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side dense tensor for the Schur product.
+// \param rhs The dense matrix expansion for the Schur product.
+// \return The Schur product of the tensor and the expanded matrix.
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// The Schur product is evaluated as pagewise broadcast of the matrix (see \c schur<pagewise>()),
+// i.e. as \f$ A(k,i,j) \cdot B(i,j) \f$. In case the number of pages of the expansion or the
+// number of rows or columns of the matrix don't match the tensor, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename TT       // Type of the left-hand side dense tensor
+        , typename MT       // Type of the dense matrix
+        , size_t... CEAs >  // Compile time expansion arguments
+inline decltype(auto)
+   operator%( const DenseTensor<TT>& lhs, const DMatExpandExpr<MT,CEAs...>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).pages() != rhs.pages() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+   }
+
+   return map<pagewise>( ~lhs, rhs.operand(), Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition operator for the addition of two dense matrix expansions
+//        (\f$ C=expand(A)+expand(B) \f$).
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side dense matrix expansion for the addition.
+// \param rhs The right-hand side dense matrix expansion for the addition.
+// \return The expansion of the sum of the two matrices.
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// The sum of two expansions with the same number of pages is the expansion of the sum of the
+// two matrices, i.e. the matrix addition is performed only once instead of once per page. In
+// case the number of pages, rows, or columns of the two expansions don't match, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT1       // Type of the left-hand side dense matrix
+        , size_t... CEAs1    // Compile time expansion arguments of the left-hand side
+        , typename MT2       // Type of the right-hand side dense matrix
+        , size_t... CEAs2 >  // Compile time expansion arguments of the right-hand side
+inline decltype(auto)
+   operator+( const DMatExpandExpr<MT1,CEAs1...>& lhs, const DMatExpandExpr<MT2,CEAs2...>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( lhs.pages() != rhs.pages() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+   }
+
+   return expand( lhs.operand() + rhs.operand(), lhs.pages() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Operator for the Schur product of two dense matrix expansions
+//        (\f$ C=expand(A)\circ expand(B) \f$).
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side dense matrix expansion for the Schur product.
+// \param rhs The right-hand side dense matrix expansion for the Schur product.
+// \return The expansion of the Schur product of the two matrices.
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// The Schur product of two expansions with the same number of pages is the expansion of the
+// Schur product of the two matrices. In case the number of pages, rows, or columns of the two
+// expansions don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT1       // Type of the left-hand side dense matrix
+        , size_t... CEAs1    // Compile time expansion arguments of the left-hand side
+        , typename MT2       // Type of the right-hand side dense matrix
+        , size_t... CEAs2 >  // Compile time expansion arguments of the right-hand side
+inline decltype(auto)
+   operator%( const DMatExpandExpr<MT1,CEAs1...>& lhs, const DMatExpandExpr<MT2,CEAs2...>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( lhs.pages() != rhs.pages() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+   }
+
+   return expand( lhs.operand() % rhs.operand(), lhs.pages() );
+}
+//*************************************************************************************************
+
+
+
+
 
 //=================================================================================================
 //
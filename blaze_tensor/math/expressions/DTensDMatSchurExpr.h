@@ -53,13 +53,18 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/SchurExpr.h>
+#include <blaze/math/functors/Mult.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/traits/SchurTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsCommutative.h>
+#include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsHermitian.h>
 #include <blaze/math/typetraits/IsLower.h>
@@ -82,11 +87,15 @@
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/MaybeUnused.h>
+#include <blaze/util/typetraits/IsSame.h>
 
 #include <blaze_tensor/math/constraints/DenseTensor.h>
 #include <blaze_tensor/math/constraints/TensMatSchurExpr.h>
+#include <blaze_tensor/math/dense/Expansion.h>
 #include <blaze_tensor/math/expressions/DenseTensor.h>
 #include <blaze_tensor/math/expressions/TensMatSchurExpr.h>
+#include <blaze_tensor/math/traits/TemporaryTrait.h>
+#include <blaze_tensor/math/typetraits/IsDenseTensor.h>
 #include <blaze_tensor/system/Thresholds.h>
 
 namespace blaze {
@@ -168,6 +177,39 @@ class DTensDMatSchurExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Broadcast kernel strategy*******************************************************************
+   //! Row-major result type of the right-hand side dense matrix expression.
+   using RRT = If_t< SO == rowMajor, RT2, OppositeType_t<RT2> >;
+
+   //! Type for the row access of the dense matrix operand by the broadcast kernels.
+   /*! Row-major matrices with direct access to their contiguous rows are used in-place, all
+       other matrix operands are evaluated once into a row-major matrix. */
+   using KT = If_t< SO == rowMajor && IsContiguous_v<MT> && HasConstDataAccess_v<MT>
+                  , CT2
+                  , const RRT >;
+
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the broadcast kernels. In case
+       both the tensor operand and the target tensor provide direct access to their contiguous
+       rows, the variable is set to 1 and every row of the matrix operand is multiplied with the
+       corresponding rows of all pages while it resides in the cache. This includes the in-place
+       Schur product \f$ T = T \circ M \f$. Otherwise the variable is set to 0 and the default
+       strategy is chosen. */
+   template< typename TT1 >
+   static constexpr bool UseKernel_v =
+      ( IsContiguous_v<TT> && HasConstDataAccess_v<TT> &&
+        IsDenseTensor_v<TT1> && IsContiguous_v<TT1> && HasMutableDataAccess_v<TT1> );
+
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the parallel broadcast kernels,
+       which distribute the pages of the target tensor among the threads of the active SMP
+       backend (see smpFor()). */
+   template< typename TT1 >
+   static constexpr bool UseSMPKernel_v = UseKernel_v<TT1>;
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    using This          = DTensDMatSchurExpr<TT,MT,SO>;   //!< Type of this DTensDMatSchurExpr instance.
@@ -648,6 +690,77 @@ class DTensDMatSchurExpr
    RightOperand rhs_;  //!< Right-hand side dense matrix of the Schur product expression.
    //**********************************************************************************************
 
+   //**Broadcast kernel****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Multiplies every row of the given row-major dense matrix with the corresponding rows
+   //        of all pages of a dense tensor.
+   //
+   // \param C The target dense tensor.
+   // \param A The left-hand side dense tensor operand.
+   // \param B The row-major right-hand side dense matrix operand.
+   // \param parallel \a true in case the pages should be processed in parallel.
+   // \return void
+   //
+   // The target tensor may coincide with the tensor operand, in which case the Schur product
+   // is computed in-place without any temporary tensor.
+   */
+   template< typename TT1   // Type of the target dense tensor
+           , typename TT2   // Type of the left-hand side dense tensor operand
+           , typename MT2 > // Type of the right-hand side dense matrix operand
+   static inline void schurPages( TT1& C, const TT2& A, const MT2& B, bool parallel )
+   {
+      using Vectorized = BoolConstant< simdEnabled && IsSame_v<ET1,ET2> &&
+                                       IsSame_v<ET1,ElementType> &&
+                                       UseVectorizedExpansion_v< ET1, ElementType_t<TT1> > >;
+
+      const size_t m( B.rows()    );
+      const size_t n( B.columns() );
+      const size_t o( A.pages()   );
+
+      if( m == 0UL || n == 0UL || o == 0UL )
+         return;
+
+      expandPages( m, o, expansionBlockSize( n, sizeof(ET2) ), [&]( size_t i, size_t k ) {
+         expandMapRow( A.data(i,k), B.data(i), n, C.data(i,k), Mult(), Vectorized() );
+      }, parallel );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense tensors (broadcast kernel)**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense tensor-dense matrix Schur product to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side Schur product expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense tensor-dense
+   // matrix Schur product expression to a dense tensor with contiguous rows. Every row of the
+   // matrix operand is multiplied with the corresponding rows of all pages while it resides in
+   // the cache. In case the target tensor is the tensor operand itself (\f$ T = T \circ M \f$),
+   // the pages are updated in-place. Due to the explicit application of the SFINAE principle,
+   // this function can only be selected by the compiler in case both the tensor operand and the
+   // target tensor provide direct access to their rows.
+   */
+   template< typename TT1 >  // Type of the target dense tensor
+   friend inline EnableIf_t< UseKernel_v<TT1> >
+      assign( DenseTensor<TT1>& lhs, const DTensDMatSchurExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      KT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
+
+      schurPages( ~lhs, rhs.lhs_, B, false );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense tensors****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a non-commutative dense tensor-dense tensor Schur product to a
@@ -665,7 +778,7 @@ class DTensDMatSchurExpr
    */
    template< typename TT1 >  // Type of the target dense tensor
    friend inline auto assign( DenseTensor<TT1>& lhs, const DTensDMatSchurExpr& rhs )
-      -> EnableIf_t< UseAssign_v<TT1> && !IsCommutative_v<TT,MT> >
+      -> EnableIf_t< UseAssign_v<TT1> && !UseKernel_v<TT1> && !IsCommutative_v<TT,MT> >
    {
       BLAZE_FUNCTION_TRACE;
 
@@ -673,14 +786,9 @@ class DTensDMatSchurExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns");
       BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"  );
 
-      //if( !IsOperation_v<TT> && isSame( ~lhs, rhs.lhs_ ) ) {
-      //   schurAssign( ~lhs, rhs.rhs_ );
-      //}
-      //else {
-         CT1 A( serial( rhs.lhs_ ) );
-         CT2 B( serial( rhs.rhs_ ) );
-         assign( ~lhs, A % B );
-      //}
+      CT1 A( serial( rhs.lhs_ ) );
+      CT2 B( serial( rhs.rhs_ ) );
+      assign( ~lhs, A % B );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -700,7 +808,7 @@ class DTensDMatSchurExpr
    // in case either of the two operands requires an intermediate evaluation.
    */
    template< typename TT1 > // Type of the target dense tensor
-   friend inline EnableIf_t< UseAssign_v<TT1> && IsCommutative_v<TT,MT> >
+   friend inline EnableIf_t< UseAssign_v<TT1> && !UseKernel_v<TT1> && IsCommutative_v<TT,MT> >
       assign( DenseTensor<TT1>& lhs, const DTensDMatSchurExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
@@ -754,7 +862,7 @@ class DTensDMatSchurExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns");
       BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"  );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryTrait_t<ResultType> tmp( serial( rhs ) );
       addAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -791,7 +899,7 @@ class DTensDMatSchurExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns");
       BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"  );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryTrait_t<ResultType> tmp( serial( rhs ) );
       subAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -825,7 +933,7 @@ class DTensDMatSchurExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns");
       BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"  );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryTrait_t<ResultType> tmp( serial( rhs ) );
       schurAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -868,6 +976,42 @@ class DTensDMatSchurExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to dense tensors (broadcast kernel)******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense tensor-dense matrix Schur product to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side Schur product expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a dense tensor-dense
+   // matrix Schur product expression to a dense tensor with contiguous rows. Above the
+   // \a SMP_DTENSDMATSCHUR_THRESHOLD the pages of the target tensor are distributed among the
+   // threads, which multiply every row of the matrix operand with their pages while the row
+   // resides in the cache. Due to the explicit application of the SFINAE principle, this function
+   // can only be selected by the compiler in case both the tensor operand and the target tensor
+   // provide direct access to their rows.
+   */
+   template< typename TT1 >  // Type of the target dense tensor
+   friend inline EnableIf_t< UseSMPKernel_v<TT1> >
+      smpAssign( DenseTensor<TT1>& lhs, const DTensDMatSchurExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      KT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      const bool parallel( !isSerialSectionActive() && rhs.canSMPAssign() );
+
+      schurPages( ~lhs, rhs.lhs_, B, parallel );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to dense tensors************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of non-commutative a dense tensor-dense tensor Schur product to a
@@ -884,7 +1028,8 @@ class DTensDMatSchurExpr
    // in case the expression specific parallel evaluation strategy is selected.
    */
    template< typename TT1 > // Type of the target dense tensor
-   friend inline EnableIf_t< UseSMPAssign_v<TT1> && !IsCommutative_v<TT,MT> >
+   friend inline EnableIf_t< UseSMPAssign_v<TT1> && !UseSMPKernel_v<TT1> &&
+                             !IsCommutative_v<TT,MT> >
       smpAssign( DenseTensor<TT1>& lhs, const DTensDMatSchurExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
@@ -893,14 +1038,9 @@ class DTensDMatSchurExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
       BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
 
-      //if( !IsOperation_v<TT> && isSame( ~lhs, rhs.lhs_ ) ) {
-      //   smpSchurAssign( ~lhs, rhs.rhs_ );
-      //}
-      //else {
-         CT1 A( rhs.lhs_ );
-         CT2 B( rhs.rhs_ );
-         smpAssign( ~lhs, A % B );
-      //}
+      CT1 A( rhs.lhs_ );
+      CT2 B( rhs.rhs_ );
+      smpAssign( ~lhs, A % B );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -921,7 +1061,8 @@ class DTensDMatSchurExpr
    // in case the expression specific parallel evaluation strategy is selected.
    */
    template< typename TT1 > // Type of the target dense tensor
-   friend inline EnableIf_t< UseSMPAssign_v<TT1> && IsCommutative_v<TT,MT> >
+   friend inline EnableIf_t< UseSMPAssign_v<TT1> && !UseSMPKernel_v<TT1> &&
+                             IsCommutative_v<TT,MT> >
       smpAssign( DenseTensor<TT1>& lhs, const DTensDMatSchurExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
@@ -975,7 +1116,7 @@ class DTensDMatSchurExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
       BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
 
-      const ResultType tmp( rhs );
+      const TemporaryTrait_t<ResultType> tmp( rhs );
       smpAddAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -1009,7 +1150,7 @@ class DTensDMatSchurExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
       BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
 
-      const ResultType tmp( rhs );
+      const TemporaryTrait_t<ResultType> tmp( rhs );
       smpSubAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -1043,7 +1184,7 @@ class DTensDMatSchurExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
       BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
 
-      const ResultType tmp( rhs );
+      const TemporaryTrait_t<ResultType> tmp( rhs );
       smpSchurAssign( ~lhs, tmp );
    }
    /*! \endcond */
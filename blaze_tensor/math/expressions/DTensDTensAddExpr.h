@@ -48,6 +48,7 @@
 #include <blaze_tensor/math/expressions/DenseTensor.h>
 #include <blaze_tensor/math/expressions/Forward.h>
 #include <blaze_tensor/math/expressions/TensTensAddExpr.h>
+#include <blaze_tensor/math/traits/TemporaryTrait.h>
 
 namespace blaze {
 
@@ -745,7 +746,7 @@ class DTensDTensAddExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
       BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages(),   "Invalid number of pages"   );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryTrait_t<ResultType> tmp( serial( rhs ) );
       schurAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -892,7 +893,7 @@ class DTensDTensAddExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
       BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages(),   "Invalid number of pages"   );
 
-      const ResultType tmp( rhs );
+      const TemporaryTrait_t<ResultType> tmp( rhs );
       smpSchurAssign( ~lhs, tmp );
    }
    /*! \endcond */
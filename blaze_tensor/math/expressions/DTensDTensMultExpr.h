@@ -42,7 +42,10 @@
 //*************************************************************************************************
 
 #include <blaze/math/expressions/DMatDMatMultExpr.h>
+#include <blaze/util/algorithms/Min.h>
 
+#include <blaze_tensor/config/BLAS.h>
+#include <blaze_tensor/math/blas/gemm.h>
 #include <blaze_tensor/math/constraints/DenseTensor.h>
 #include <blaze_tensor/math/constraints/TensTensMultExpr.h>
 #include <blaze_tensor/math/expressions/DTensScalarMultExpr.h>
@@ -50,6 +53,8 @@
 #include <blaze_tensor/math/expressions/Forward.h>
 #include <blaze_tensor/math/expressions/TensScalarMultExpr.h>
 #include <blaze_tensor/math/expressions/TensTensMultExpr.h>
+#include <blaze_tensor/math/traits/TemporaryTrait.h>
+#include <blaze_tensor/math/views/PageSlice.h>
 
 namespace blaze {
 
@@ -124,7 +129,7 @@ class DTensDTensMultExpr
        will be set to 1, otherwise it will be 0. */
    template< typename T1, typename T2, typename T3 >
    static constexpr bool UseBlasKernel_v =
-      ( BLAZE_BLAS_MODE && BLAZE_USE_BLAS_MATRIX_MATRIX_MULTIPLICATION &&
+      ( BLAZE_BLAS_MODE && BLAZE_USE_BLAS_TENSOR_TENSOR_MULTIPLICATION &&
         IsContiguous_v<T1> && HasMutableDataAccess_v<T1> &&
         IsContiguous_v<T2> && HasConstDataAccess_v<T2> &&
         IsContiguous_v<T3> && HasConstDataAccess_v<T3> &&
@@ -185,10 +190,10 @@ class DTensDTensMultExpr
    using RightOperand = If_t< IsExpression_v<MT2>, const MT2, const MT2& >;
 
    //! Type for the assignment of the left-hand side dense tensor operand.
-   using LT = If_t< evaluateLeft, const RT1, CT1 >;
+   using LT = If_t< evaluateLeft, const TemporaryTrait_t<RT1>, CT1 >;
 
    //! Type for the assignment of the right-hand side dense tensor operand.
-   using RT = If_t< evaluateRight, const RT2, CT2 >;
+   using RT = If_t< evaluateRight, const TemporaryTrait_t<RT2>, CT2 >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -363,10 +368,10 @@ class DTensDTensMultExpr
    */
    inline bool canSMPAssign() const noexcept {
       return ( !BLAZE_BLAS_MODE ||
-               !BLAZE_USE_BLAS_MATRIX_MATRIX_MULTIPLICATION ||
+               !BLAZE_USE_BLAS_TENSOR_TENSOR_MULTIPLICATION ||
                !BLAZE_BLAS_IS_PARALLEL ||
                ( rows() * columns() < DMATDMATMULT_THRESHOLD ) ) &&
-             ( rows() * columns() >= SMP_DMATDMATMULT_THRESHOLD ) &&
+             ( pages() * rows() * columns() >= SMP_DMATDMATMULT_THRESHOLD ) &&
              !IsDiagonal_v<MT1> && !IsDiagonal_v<MT2>;
    }
    //**********************************************************************************************
@@ -426,7 +431,7 @@ class DTensDTensMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Assignment to dense tensors (kernel selection)*********************************************
+   //**Assignment to dense tensors (kernel selection)**********************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Selection of the kernel for an assignment of a dense tensor-dense tensor
    //        multiplication to a dense tensor (\f$ C=A*B \f$).
@@ -436,15 +441,16 @@ class DTensDTensMultExpr
    // \param A The left-hand side multiplication operand.
    // \param B The right-hand side multiplication operand.
    // \return void
+   //
+   // The pages of the tensors are multiplied independently of each other. Therefore the
+   // kernel is selected based on the size of a single page of the target tensor.
    */
    template< typename MT3    // Type of the left-hand side target tensor
            , typename MT4    // Type of the left-hand side tensor operand
            , typename MT5 >  // Type of the right-hand side tensor operand
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      if( ( IsDiagonal_v<MT5> ) ||
-          ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+      if( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD )
          selectSmallAssignKernel( C, A, B );
       else
          selectBlasAssignKernel( C, A, B );
@@ -452,9 +458,9 @@ class DTensDTensMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Default assignment to dense tensors (general/general)**************************************
+   //**Default assignment to dense tensors*********************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Default assignment of a general dense tensor-general dense tensor multiplication
+   /*!\brief Default assignment of a dense tensor-dense tensor multiplication
    //        (\f$ C=A*B \f$).
    // \ingroup dense_tensor
    //
@@ -463,100 +469,28 @@ class DTensDTensMultExpr
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function implements the default assignment of a general dense tensor-general dense
-   // tensor multiplication expression to a dense tensor.
+   // This function implements the default assignment of a dense tensor-dense tensor
+   // multiplication expression to a dense tensor. Each page of the target tensor is computed
+   // as the product of the according pages of the two operands.
    */
    template< typename MT3    // Type of the left-hand side target tensor
            , typename MT4    // Type of the left-hand side tensor operand
            , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline void
-      selectDefaultAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline void selectDefaultAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
+      const size_t O( A.pages()   );
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
       const size_t K( A.columns() );
 
-      BLAZE_INTERNAL_ASSERT( !( SYM || HERM || LOW || UPP ) || ( M == N ), "Broken invariant detected" );
-
-      for( size_t i=0UL; i<M; ++i )
-      {
-         const size_t kbegin( ( IsUpper_v<MT4> )
-                              ?( IsStrictlyUpper_v<MT4> ? i+1UL : i )
-                              :( 0UL ) );
-         const size_t kend( ( IsLower_v<MT4> )
-                            ?( IsStrictlyLower_v<MT4> ? i : i+1UL )
-                            :( K ) );
-         BLAZE_INTERNAL_ASSERT( kbegin <= kend, "Invalid loop indices detected" );
-
-         if( IsStrictlyTriangular_v<MT4> && kbegin == kend ) {
+      for( size_t k=0UL; k<O; ++k ) {
+         for( size_t i=0UL; i<M; ++i ) {
             for( size_t j=0UL; j<N; ++j ) {
-               reset( C(i,j) );
-            }
-            continue;
-         }
-
-         {
-            const size_t jbegin( ( IsUpper_v<MT5> )
-                                 ?( ( IsStrictlyUpper_v<MT5> )
-                                    ?( UPP ? max(i,kbegin+1UL) : kbegin+1UL )
-                                    :( UPP ? max(i,kbegin) : kbegin ) )
-                                 :( UPP ? i : 0UL ) );
-            const size_t jend( ( IsLower_v<MT5> )
-                               ?( ( IsStrictlyLower_v<MT5> )
-                                  ?( LOW ? min(i+1UL,kbegin) : kbegin )
-                                  :( LOW ? min(i,kbegin)+1UL : kbegin+1UL ) )
-                               :( LOW ? i+1UL : N ) );
-
-            if( ( IsUpper_v<MT4> && IsUpper_v<MT5> ) || UPP ) {
-               for( size_t j=0UL; j<jbegin; ++j ) {
-                  reset( C(i,j) );
-               }
-            }
-            else if( IsStrictlyUpper_v<MT5> ) {
-               reset( C(i,0UL) );
-            }
-            for( size_t j=jbegin; j<jend; ++j ) {
-               C(i,j) = A(i,kbegin) * B(kbegin,j);
-            }
-            if( ( IsLower_v<MT4> && IsLower_v<MT5> ) || LOW ) {
-               for( size_t j=jend; j<N; ++j ) {
-                  reset( C(i,j) );
+               ElementType value( A(k,i,0UL) * B(k,0UL,j) );
+               for( size_t l=1UL; l<K; ++l ) {
+                  value += A(k,i,l) * B(k,l,j);
                }
-            }
-            else if( IsStrictlyLower_v<MT5> ) {
-               reset( C(i,N-1UL) );
-            }
-         }
-
-         for( size_t k=kbegin+1UL; k<kend; ++k )
-         {
-            const size_t jbegin( ( IsUpper_v<MT5> )
-                                 ?( ( IsStrictlyUpper_v<MT5> )
-                                    ?( SYM || HERM || UPP ? max( i, k+1UL ) : k+1UL )
-                                    :( SYM || HERM || UPP ? max( i, k ) : k ) )
-                                 :( SYM || HERM || UPP ? i : 0UL ) );
-            const size_t jend( ( IsLower_v<MT5> )
-                               ?( ( IsStrictlyLower_v<MT5> )
-                                  ?( LOW ? min(i+1UL,k-1UL) : k-1UL )
-                                  :( LOW ? min(i+1UL,k) : k ) )
-                               :( LOW ? i+1UL : N ) );
-
-            if( ( SYM || HERM || LOW || UPP ) && ( jbegin > jend ) ) continue;
-            BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-            for( size_t j=jbegin; j<jend; ++j ) {
-               C(i,j) += A(i,k) * B(k,j);
-            }
-            if( IsLower_v<MT5> ) {
-               C(i,jend) = A(i,k) * B(k,jend);
-            }
-         }
-      }
-
-      if( SYM || HERM ) {
-         for( size_t i=1UL; i<M; ++i ) {
-            for( size_t j=0UL; j<i; ++j ) {
-               C(i,j) = HERM ? conj( C(j,i) ) : C(j,i);
+               C(k,i,j) = value;
             }
          }
       }
@@ -564,9 +498,9 @@ class DTensDTensMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Default assignment to dense tensors (general/diagonal)*************************************
+   //**Default assignment to dense tensors (small tensors)*****************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Default assignment of a general dense tensor-diagonal dense tensor multiplication
+   /*!\brief Default assignment of a small dense tensor-dense tensor multiplication
    //        (\f$ C=A*B \f$).
    // \ingroup dense_tensor
    //
@@ -575,52 +509,24 @@ class DTensDTensMultExpr
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function implements the default assignment of a general dense tensor-diagonal dense
-   // tensor multiplication expression to a dense tensor.
+   // This function relays to the default implementation of the assignment of a dense
+   // tensor-dense tensor multiplication expression to a dense tensor.
    */
    template< typename MT3    // Type of the left-hand side target tensor
            , typename MT4    // Type of the left-hand side tensor operand
            , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline EnableIf_t< !IsDiagonal_v<MT4> && IsDiagonal_v<MT5> >
-      selectDefaultAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline EnableIf_t< !UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
+      selectSmallAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT3 );
-
-      const size_t M( A.rows()    );
-      const size_t N( B.columns() );
-
-      for( size_t i=0UL; i<M; ++i )
-      {
-         const size_t jbegin( ( IsUpper_v<MT4> )
-                              ?( IsStrictlyUpper_v<MT4> ? i+1UL : i )
-                              :( 0UL ) );
-         const size_t jend( ( IsLower_v<MT4> )
-                            ?( IsStrictlyLower_v<MT4> ? i : i+1UL )
-                            :( N ) );
-         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-         if( IsUpper_v<MT4> ) {
-            for( size_t j=0UL; j<jbegin; ++j ) {
-               reset( C(i,j) );
-            }
-         }
-         for( size_t j=jbegin; j<jend; ++j ) {
-            C(i,j) = A(i,j) * B(j,j);
-         }
-         if( IsLower_v<MT4> ) {
-            for( size_t j=jend; j<N; ++j ) {
-               reset( C(i,j) );
-            }
-         }
-      }
+      selectDefaultAssignKernel( C, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Default assignment to dense tensors (diagonal/general)*************************************
+   //**Vectorized default assignment to dense tensors (small tensors)******************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Default assignment of a diagonal dense tensor-general dense tensor multiplication
-   //        (\f$ C=A*B \f$).
+   /*!\brief Vectorized default assignment of a small dense tensor-dense tensor
+   //        multiplication (\f$ C=A*B \f$).
    // \ingroup dense_tensor
    //
    // \param C The target left-hand side dense tensor.
@@ -628,41 +534,123 @@ class DTensDTensMultExpr
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function implements the default assignment of a diagonal dense tensor-general dense
-   // tensor multiplication expression to a dense tensor.
+   // This function implements the vectorized default assignment of a dense tensor-dense
+   // tensor multiplication expression to a dense tensor. This kernel is optimized for small
+   // pages: each page is computed by a register-blocked micro-kernel, which updates a block
+   // of 2 rows and 4 SIMD vectors of columns of the target page per pass over the inner
+   // dimension.
    */
    template< typename MT3    // Type of the left-hand side target tensor
            , typename MT4    // Type of the left-hand side tensor operand
            , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline EnableIf_t< IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
-      selectDefaultAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline EnableIf_t< UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
+      selectSmallAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT3 );
+      constexpr bool remainder( !IsPadded_v<MT3> || !IsPadded_v<MT5> );
 
+      const size_t O( A.pages()   );
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
+      const size_t K( A.columns() );
 
-      for( size_t i=0UL; i<M; ++i )
+      const size_t jpos( remainder ? ( N & size_t(-SIMDSIZE) ) : N );
+      BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+      for( size_t k=0UL; k<O; ++k )
       {
-         const size_t jbegin( ( IsUpper_v<MT5> )
-                              ?( IsStrictlyUpper_v<MT5> ? i+1UL : i )
-                              :( 0UL ) );
-         const size_t jend( ( IsLower_v<MT5> )
-                            ?( IsStrictlyLower_v<MT5> ? i : i+1UL )
-                            :( N ) );
-         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
+         size_t j( 0UL );
 
-         if( IsUpper_v<MT5> ) {
-            for( size_t j=0UL; j<jbegin; ++j ) {
-               reset( C(i,j) );
+         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL )
+         {
+            size_t i( 0UL );
+
+            for( ; (i+2UL) <= M; i+=2UL )
+            {
+               SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
+
+               for( size_t l=0UL; l<K; ++l ) {
+                  const SIMDType a1( set( A(k,i    ,l) ) );
+                  const SIMDType a2( set( A(k,i+1UL,l) ) );
+                  const SIMDType b1( B.load(k,l,j             ) );
+                  const SIMDType b2( B.load(k,l,j+SIMDSIZE    ) );
+                  const SIMDType b3( B.load(k,l,j+SIMDSIZE*2UL) );
+                  const SIMDType b4( B.load(k,l,j+SIMDSIZE*3UL) );
+                  xmm1 += a1 * b1;
+                  xmm2 += a1 * b2;
+                  xmm3 += a1 * b3;
+                  xmm4 += a1 * b4;
+                  xmm5 += a2 * b1;
+                  xmm6 += a2 * b2;
+                  xmm7 += a2 * b3;
+                  xmm8 += a2 * b4;
+               }
+
+               C.store( k, i    , j             , xmm1 );
+               C.store( k, i    , j+SIMDSIZE    , xmm2 );
+               C.store( k, i    , j+SIMDSIZE*2UL, xmm3 );
+               C.store( k, i    , j+SIMDSIZE*3UL, xmm4 );
+               C.store( k, i+1UL, j             , xmm5 );
+               C.store( k, i+1UL, j+SIMDSIZE    , xmm6 );
+               C.store( k, i+1UL, j+SIMDSIZE*2UL, xmm7 );
+               C.store( k, i+1UL, j+SIMDSIZE*3UL, xmm8 );
+            }
+
+            if( i < M )
+            {
+               SIMDType xmm1, xmm2, xmm3, xmm4;
+
+               for( size_t l=0UL; l<K; ++l ) {
+                  const SIMDType a1( set( A(k,i,l) ) );
+                  xmm1 += a1 * B.load(k,l,j             );
+                  xmm2 += a1 * B.load(k,l,j+SIMDSIZE    );
+                  xmm3 += a1 * B.load(k,l,j+SIMDSIZE*2UL);
+                  xmm4 += a1 * B.load(k,l,j+SIMDSIZE*3UL);
+               }
+
+               C.store( k, i, j             , xmm1 );
+               C.store( k, i, j+SIMDSIZE    , xmm2 );
+               C.store( k, i, j+SIMDSIZE*2UL, xmm3 );
+               C.store( k, i, j+SIMDSIZE*3UL, xmm4 );
             }
          }
-         for( size_t j=jbegin; j<jend; ++j ) {
-            C(i,j) = A(i,i) * B(i,j);
+
+         for( ; j<jpos; j+=SIMDSIZE )
+         {
+            size_t i( 0UL );
+
+            for( ; (i+2UL) <= M; i+=2UL )
+            {
+               SIMDType xmm1, xmm2;
+
+               for( size_t l=0UL; l<K; ++l ) {
+                  const SIMDType b1( B.load(k,l,j) );
+                  xmm1 += set( A(k,i    ,l) ) * b1;
+                  xmm2 += set( A(k,i+1UL,l) ) * b1;
+               }
+
+               C.store( k, i    , j, xmm1 );
+               C.store( k, i+1UL, j, xmm2 );
+            }
+
+            if( i < M )
+            {
+               SIMDType xmm1;
+
+               for( size_t l=0UL; l<K; ++l ) {
+                  xmm1 += set( A(k,i,l) ) * B.load(k,l,j);
+               }
+
+               C.store( k, i, j, xmm1 );
+            }
          }
-         if( IsLower_v<MT5> ) {
-            for( size_t j=jend; j<N; ++j ) {
-               reset( C(i,j) );
+
+         for( ; remainder && j<N; ++j ) {
+            for( size_t i=0UL; i<M; ++i ) {
+               ElementType value( A(k,i,0UL) * B(k,0UL,j) );
+               for( size_t l=1UL; l<K; ++l ) {
+                  value += A(k,i,l) * B(k,l,j);
+               }
+               C(k,i,j) = value;
             }
          }
       }
@@ -670,9 +658,9 @@ class DTensDTensMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Default assignment to dense tensors (diagonal/diagonal)************************************
+   //**Default assignment to dense tensors (large tensors)*****************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Default assignment of a diagonal dense tensor-diagonal dense tensor multiplication
+   /*!\brief Default assignment of a large dense tensor-dense tensor multiplication
    //        (\f$ C=A*B \f$).
    // \ingroup dense_tensor
    //
@@ -681,29 +669,52 @@ class DTensDTensMultExpr
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function implements the default assignment of a diagonal dense tensor-diagonal dense
-   // tensor multiplication expression to a dense tensor.
+   // This function relays to the default implementation of the assignment of a dense
+   // tensor-dense tensor multiplication expression to a dense tensor.
    */
    template< typename MT3    // Type of the left-hand side target tensor
            , typename MT4    // Type of the left-hand side tensor operand
            , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline EnableIf_t< IsDiagonal_v<MT4> && IsDiagonal_v<MT5> >
-      selectDefaultAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline EnableIf_t< !UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
+      selectLargeAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT3 );
+      selectDefaultAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
 
+   //**Vectorized default assignment to dense tensors (large tensors)******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized default assignment of a large dense tensor-dense tensor
+   //        multiplication (\f$ C=A*B \f$).
+   // \ingroup dense_tensor
+   //
+   // \param C The target left-hand side dense tensor.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the vectorized default assignment of a dense tensor-dense
+   // tensor multiplication expression to a dense tensor. This kernel is optimized for large
+   // pages.
+   */
+   template< typename MT3    // Type of the left-hand side target tensor
+           , typename MT4    // Type of the left-hand side tensor operand
+           , typename MT5 >  // Type of the right-hand side tensor operand
+   static inline EnableIf_t< UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
+      selectLargeAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
       reset( C );
 
-      for( size_t i=0UL; i<A.rows(); ++i ) {
-         C(i,i) = A(i,i) * B(i,i);
-      }
+      selectLargeAddAssignKernel( C, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Default assignment to dense tensors (small tensors)***************************************
+   //**BLAS-based assignment to dense tensors (default)********************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Default assignment of a small dense tensor-dense tensor multiplication (\f$ C=A*B \f$).
+   /*!\brief Default assignment of a dense tensor-dense tensor multiplication
+   //        (\f$ C=A*B \f$).
    // \ingroup dense_tensor
    //
    // \param C The target left-hand side dense tensor.
@@ -711,23 +722,24 @@ class DTensDTensMultExpr
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function relays to the default implementation of the assignment of a dense tensor-
-   // dense tensor multiplication expression to a dense tensor.
+   // This function relays to the default implementation of the assignment of a large
+   // dense tensor-dense tensor multiplication expression to a dense tensor.
    */
    template< typename MT3    // Type of the left-hand side target tensor
            , typename MT4    // Type of the left-hand side tensor operand
            , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline EnableIf_t< !UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
-      selectSmallAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline EnableIf_t< !UseBlasKernel_v<MT3,MT4,MT5> >
+      selectBlasAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      selectDefaultAssignKernel( C, A, B );
+      selectLargeAssignKernel( C, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Vectorized default assignment to row-major dense tensors (small tensors)******************
+   //**BLAS-based assignment to dense tensors******************************************************
+#if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_TENSOR_TENSOR_MULTIPLICATION
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Vectorized default assignment of a small dense tensor-dense tensor multiplication
+   /*!\brief BLAS-based assignment of a dense tensor-dense tensor multiplication
    //        (\f$ C=A*B \f$).
    // \ingroup dense_tensor
    //
@@ -736,154 +748,217 @@ class DTensDTensMultExpr
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function implements the vectorized default assignment of a dense tensor-dense tensor
-   // multiplication expression to a row-major dense tensor. This kernel is optimized for small
-   // tensors.
+   // This function performs the dense tensor-dense tensor multiplication based on the according
+   // BLAS functionality. In case the BLAS library provides a strided batched \c gemm() (see
+   // the BLAZE_USE_BLAS_BATCHED_TENSOR_TENSOR_MULTIPLICATION switch), all pages are multiplied
+   // by a single call, otherwise \c gemm() is called for each page.
    */
    template< typename MT3    // Type of the left-hand side target tensor
            , typename MT4    // Type of the left-hand side tensor operand
            , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline EnableIf_t< UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
-      selectSmallAssignKernel( DenseTensor<MT3>& C, const MT4& A, const MT5& B )
+   static inline EnableIf_t< UseBlasKernel_v<MT3,MT4,MT5> >
+      selectBlasAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      constexpr bool remainder( !IsPadded_v<MT3> || !IsPadded_v<MT5> );
-
-      const size_t M( A.rows()    );
-      const size_t N( B.columns() );
-      const size_t K( A.columns() );
-
-      BLAZE_INTERNAL_ASSERT( ( M == N ), "Broken invariant detected" );
-
-      const size_t jpos( remainder ? ( N & size_t(-SIMDSIZE) ) : N );
-      BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+      using ET = ElementType_t<MT3>;
 
-      if( N > SIMDSIZE*3UL ) {
-         reset( ~C );
+#if BLAZE_USE_BLAS_BATCHED_TENSOR_TENSOR_MULTIPLICATION
+      gemmBatchStrided( C, A, B, ET(1), ET(0) );
+#else
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         auto Ck( pageslice( C, k, unchecked ) );
+         gemm( Ck, pageslice( A, k, unchecked ), pageslice( B, k, unchecked ), ET(1), ET(0) );
       }
+#endif
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
 
-      {
-         size_t j( 0UL );
-
-         if( IsIntegral_v<ElementType> )
-         {
-            for( ; (j+SIMDSIZE*7UL) < jpos; j+=SIMDSIZE*8UL ) {
-               for( size_t i=0UL; i<M; ++i )
-               {
-                  const size_t kbegin( 0UL );
-                  const size_t kend( K );
+   //**Addition assignment to dense tensors*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a dense tensor-dense tensor multiplication to a dense tensor
+   //        (\f$ C+=A*B \f$).
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a dense tensor-
+   // dense tensor multiplication expression to a dense tensor.
+   */
+   template< typename MT > // Type of the target dense tensor
+   friend inline void
+      addAssign( DenseTensor<MT>& lhs, const DTensDTensMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
 
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-                  for( size_t k=kbegin; k<kend; ++k ) {
-                     const SIMDType a1( set( A(i,k) ) );
-                     xmm1 += a1 * B.load(k,j             );
-                     xmm2 += a1 * B.load(k,j+SIMDSIZE    );
-                     xmm3 += a1 * B.load(k,j+SIMDSIZE*2UL);
-                     xmm4 += a1 * B.load(k,j+SIMDSIZE*3UL);
-                     xmm5 += a1 * B.load(k,j+SIMDSIZE*4UL);
-                     xmm6 += a1 * B.load(k,j+SIMDSIZE*5UL);
-                     xmm7 += a1 * B.load(k,j+SIMDSIZE*6UL);
-                     xmm8 += a1 * B.load(k,j+SIMDSIZE*7UL);
-                  }
+      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL || rhs.lhs_.columns() == 0UL ) {
+         return;
+      }
 
-                  (~C).store( i, j             , xmm1 );
-                  (~C).store( i, j+SIMDSIZE    , xmm2 );
-                  (~C).store( i, j+SIMDSIZE*2UL, xmm3 );
-                  (~C).store( i, j+SIMDSIZE*3UL, xmm4 );
-                  (~C).store( i, j+SIMDSIZE*4UL, xmm5 );
-                  (~C).store( i, j+SIMDSIZE*5UL, xmm6 );
-                  (~C).store( i, j+SIMDSIZE*6UL, xmm7 );
-                  (~C).store( i, j+SIMDSIZE*7UL, xmm8 );
-               }
-            }
-         }
+      LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense tensor operand
+      RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense tensor operand
 
-         for( ; (j+SIMDSIZE*4UL) < jpos; j+=SIMDSIZE*5UL )
-         {
-            size_t i( 0UL );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
 
-            for( ; (i+2UL) <= M; i+=2UL )
-            {
-               const size_t kbegin( 0UL );
-               const size_t kend( K );
+      DTensDTensMultExpr::selectAddAssignKernel( ~lhs, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
 
-               SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10;
+   //**Addition assignment to dense tensors (kernel selection)*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the kernel for an addition assignment of a dense tensor-dense tensor
+   //        multiplication to a dense tensor (\f$ C+=A*B \f$).
+   // \ingroup dense_tensor
+   //
+   // \param C The target left-hand side dense tensor.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // The pages of the tensors are multiplied independently of each other. Therefore the
+   // kernel is selected based on the size of a single page of the target tensor.
+   */
+   template< typename MT3    // Type of the left-hand side target tensor
+           , typename MT4    // Type of the left-hand side tensor operand
+           , typename MT5 >  // Type of the right-hand side tensor operand
+   static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      if( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD )
+         selectSmallAddAssignKernel( C, A, B );
+      else
+         selectBlasAddAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
 
-               for( size_t k=kbegin; k<kend; ++k ) {
-                  const SIMDType a1( set( A(i    ,k) ) );
-                  const SIMDType a2( set( A(i+1UL,k) ) );
-                  const SIMDType b1( B.load(k,j             ) );
-                  const SIMDType b2( B.load(k,j+SIMDSIZE    ) );
-                  const SIMDType b3( B.load(k,j+SIMDSIZE*2UL) );
-                  const SIMDType b4( B.load(k,j+SIMDSIZE*3UL) );
-                  const SIMDType b5( B.load(k,j+SIMDSIZE*4UL) );
-                  xmm1  += a1 * b1;
-                  xmm2  += a1 * b2;
-                  xmm3  += a1 * b3;
-                  xmm4  += a1 * b4;
-                  xmm5  += a1 * b5;
-                  xmm6  += a2 * b1;
-                  xmm7  += a2 * b2;
-                  xmm8  += a2 * b3;
-                  xmm9  += a2 * b4;
-                  xmm10 += a2 * b5;
-               }
+   //**Default addition assignment to dense tensors************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default addition assignment of a dense tensor-dense tensor multiplication
+   //        (\f$ C+=A*B \f$).
+   // \ingroup dense_tensor
+   //
+   // \param C The target left-hand side dense tensor.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the default addition assignment of a dense tensor-dense tensor
+   // multiplication expression to a dense tensor. Each page of the target tensor is computed
+   // as the product of the according pages of the two operands.
+   */
+   template< typename MT3    // Type of the left-hand side target tensor
+           , typename MT4    // Type of the left-hand side tensor operand
+           , typename MT5 >  // Type of the right-hand side tensor operand
+   static inline void selectDefaultAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      const size_t O( A.pages()   );
+      const size_t M( A.rows()    );
+      const size_t N( B.columns() );
+      const size_t K( A.columns() );
 
-               (~C).store( i    , j             , xmm1  );
-               (~C).store( i    , j+SIMDSIZE    , xmm2  );
-               (~C).store( i    , j+SIMDSIZE*2UL, xmm3  );
-               (~C).store( i    , j+SIMDSIZE*3UL, xmm4  );
-               (~C).store( i    , j+SIMDSIZE*4UL, xmm5  );
-               (~C).store( i+1UL, j             , xmm6  );
-               (~C).store( i+1UL, j+SIMDSIZE    , xmm7  );
-               (~C).store( i+1UL, j+SIMDSIZE*2UL, xmm8  );
-               (~C).store( i+1UL, j+SIMDSIZE*3UL, xmm9  );
-               (~C).store( i+1UL, j+SIMDSIZE*4UL, xmm10 );
+      for( size_t k=0UL; k<O; ++k ) {
+         for( size_t i=0UL; i<M; ++i ) {
+            for( size_t j=0UL; j<N; ++j ) {
+               ElementType value( A(k,i,0UL) * B(k,0UL,j) );
+               for( size_t l=1UL; l<K; ++l ) {
+                  value += A(k,i,l) * B(k,l,j);
+               }
+               C(k,i,j) += value;
             }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
 
-            if( i < M )
-            {
-               const size_t kbegin( 0UL );
-               const size_t kend( K );
+   //**Default addition assignment to dense tensors (small tensors)********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default addition assignment of a small dense tensor-dense tensor multiplication
+   //        (\f$ C+=A*B \f$).
+   // \ingroup dense_tensor
+   //
+   // \param C The target left-hand side dense tensor.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the default implementation of the addition assignment of a dense
+   // tensor-dense tensor multiplication expression to a dense tensor.
+   */
+   template< typename MT3    // Type of the left-hand side target tensor
+           , typename MT4    // Type of the left-hand side tensor operand
+           , typename MT5 >  // Type of the right-hand side tensor operand
+   static inline EnableIf_t< !UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
+      selectSmallAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      selectDefaultAddAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
 
-               SIMDType xmm1, xmm2, xmm3, xmm4, xmm5;
+   //**Vectorized default addition assignment to dense tensors (small tensors)*********************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized default addition assignment of a small dense tensor-dense tensor
+   //        multiplication (\f$ C+=A*B \f$).
+   // \ingroup dense_tensor
+   //
+   // \param C The target left-hand side dense tensor.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the vectorized default addition assignment of a dense tensor-dense
+   // tensor multiplication expression to a dense tensor. This kernel is optimized for small
+   // pages: each page is computed by a register-blocked micro-kernel, which updates a block
+   // of 2 rows and 4 SIMD vectors of columns of the target page per pass over the inner
+   // dimension.
+   */
+   template< typename MT3    // Type of the left-hand side target tensor
+           , typename MT4    // Type of the left-hand side tensor operand
+           , typename MT5 >  // Type of the right-hand side tensor operand
+   static inline EnableIf_t< UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
+      selectSmallAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      constexpr bool remainder( !IsPadded_v<MT3> || !IsPadded_v<MT5> );
 
-               for( size_t k=kbegin; k<kend; ++k ) {
-                  const SIMDType a1( set( A(i,k) ) );
-                  xmm1 += a1 * B.load(k,j             );
-                  xmm2 += a1 * B.load(k,j+SIMDSIZE    );
-                  xmm3 += a1 * B.load(k,j+SIMDSIZE*2UL);
-                  xmm4 += a1 * B.load(k,j+SIMDSIZE*3UL);
-                  xmm5 += a1 * B.load(k,j+SIMDSIZE*4UL);
-               }
+      const size_t O( A.pages()   );
+      const size_t M( A.rows()    );
+      const size_t N( B.columns() );
+      const size_t K( A.columns() );
 
-               (~C).store( i, j             , xmm1 );
-               (~C).store( i, j+SIMDSIZE    , xmm2 );
-               (~C).store( i, j+SIMDSIZE*2UL, xmm3 );
-               (~C).store( i, j+SIMDSIZE*3UL, xmm4 );
-               (~C).store( i, j+SIMDSIZE*4UL, xmm5 );
-            }
-         }
+      const size_t jpos( remainder ? ( N & size_t(-SIMDSIZE) ) : N );
+      BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+      for( size_t k=0UL; k<O; ++k )
+      {
+         size_t j( 0UL );
 
          for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL )
          {
-            const size_t iend( M );
             size_t i( 0UL );
 
-            for( ; (i+2UL) <= iend; i+=2UL )
+            for( ; (i+2UL) <= M; i+=2UL )
             {
-               const size_t kbegin( 0UL );
-               const size_t kend( K );
-
                SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
 
-               for( size_t k=kbegin; k<kend; ++k ) {
-                  const SIMDType a1( set( A(i    ,k) ) );
-                  const SIMDType a2( set( A(i+1UL,k) ) );
-                  const SIMDType b1( B.load(k,j             ) );
-                  const SIMDType b2( B.load(k,j+SIMDSIZE    ) );
-                  const SIMDType b3( B.load(k,j+SIMDSIZE*2UL) );
-                  const SIMDType b4( B.load(k,j+SIMDSIZE*3UL) );
+               for( size_t l=0UL; l<K; ++l ) {
+                  const SIMDType a1( set( A(k,i    ,l) ) );
+                  const SIMDType a2( set( A(k,i+1UL,l) ) );
+                  const SIMDType b1( B.load(k,l,j             ) );
+                  const SIMDType b2( B.load(k,l,j+SIMDSIZE    ) );
+                  const SIMDType b3( B.load(k,l,j+SIMDSIZE*2UL) );
+                  const SIMDType b4( B.load(k,l,j+SIMDSIZE*3UL) );
                   xmm1 += a1 * b1;
                   xmm2 += a1 * b2;
                   xmm3 += a1 * b3;
@@ -894,392 +969,83 @@ class DTensDTensMultExpr
                   xmm8 += a2 * b4;
                }
 
-               (~C).store( i    , j             , xmm1 );
-               (~C).store( i    , j+SIMDSIZE    , xmm2 );
-               (~C).store( i    , j+SIMDSIZE*2UL, xmm3 );
-               (~C).store( i    , j+SIMDSIZE*3UL, xmm4 );
-               (~C).store( i+1UL, j             , xmm5 );
-               (~C).store( i+1UL, j+SIMDSIZE    , xmm6 );
-               (~C).store( i+1UL, j+SIMDSIZE*2UL, xmm7 );
-               (~C).store( i+1UL, j+SIMDSIZE*3UL, xmm8 );
+               C.store( k, i    , j             , C.load(k,i    ,j             ) + xmm1 );
+               C.store( k, i    , j+SIMDSIZE    , C.load(k,i    ,j+SIMDSIZE    ) + xmm2 );
+               C.store( k, i    , j+SIMDSIZE*2UL, C.load(k,i    ,j+SIMDSIZE*2UL) + xmm3 );
+               C.store( k, i    , j+SIMDSIZE*3UL, C.load(k,i    ,j+SIMDSIZE*3UL) + xmm4 );
+               C.store( k, i+1UL, j             , C.load(k,i+1UL,j             ) + xmm5 );
+               C.store( k, i+1UL, j+SIMDSIZE    , C.load(k,i+1UL,j+SIMDSIZE    ) + xmm6 );
+               C.store( k, i+1UL, j+SIMDSIZE*2UL, C.load(k,i+1UL,j+SIMDSIZE*2UL) + xmm7 );
+               C.store( k, i+1UL, j+SIMDSIZE*3UL, C.load(k,i+1UL,j+SIMDSIZE*3UL) + xmm8 );
             }
 
-            if( i < iend )
+            if( i < M )
             {
-               const size_t kbegin( 0UL );
-               const size_t kend( K );
-
                SIMDType xmm1, xmm2, xmm3, xmm4;
 
-               for( size_t k=kbegin; k<kend; ++k ) {
-                  const SIMDType a1( set( A(i,k) ) );
-                  xmm1 += a1 * B.load(k,j             );
-                  xmm2 += a1 * B.load(k,j+SIMDSIZE    );
-                  xmm3 += a1 * B.load(k,j+SIMDSIZE*2UL);
-                  xmm4 += a1 * B.load(k,j+SIMDSIZE*3UL);
+               for( size_t l=0UL; l<K; ++l ) {
+                  const SIMDType a1( set( A(k,i,l) ) );
+                  xmm1 += a1 * B.load(k,l,j             );
+                  xmm2 += a1 * B.load(k,l,j+SIMDSIZE    );
+                  xmm3 += a1 * B.load(k,l,j+SIMDSIZE*2UL);
+                  xmm4 += a1 * B.load(k,l,j+SIMDSIZE*3UL);
                }
 
-               (~C).store( i, j             , xmm1 );
-               (~C).store( i, j+SIMDSIZE    , xmm2 );
-               (~C).store( i, j+SIMDSIZE*2UL, xmm3 );
-               (~C).store( i, j+SIMDSIZE*3UL, xmm4 );
+               C.store( k, i, j             , C.load(k,i,j             ) + xmm1 );
+               C.store( k, i, j+SIMDSIZE    , C.load(k,i,j+SIMDSIZE    ) + xmm2 );
+               C.store( k, i, j+SIMDSIZE*2UL, C.load(k,i,j+SIMDSIZE*2UL) + xmm3 );
+               C.store( k, i, j+SIMDSIZE*3UL, C.load(k,i,j+SIMDSIZE*3UL) + xmm4 );
             }
          }
 
-         for( ; (j+SIMDSIZE*2UL) < jpos; j+=SIMDSIZE*3UL )
+         for( ; j<jpos; j+=SIMDSIZE )
          {
-            const size_t iend( M );
             size_t i( 0UL );
 
-            for( ; (i+2UL) <= iend; i+=2UL )
+            for( ; (i+2UL) <= M; i+=2UL )
             {
-               const size_t kbegin( 0UL );
-               const size_t kend( K );
-
-               SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6;
+               SIMDType xmm1, xmm2;
 
-               for( size_t k=kbegin; k<kend; ++k ) {
-                  const SIMDType a1( set( A(i    ,k) ) );
-                  const SIMDType a2( set( A(i+1UL,k) ) );
-                  const SIMDType b1( B.load(k,j             ) );
-                  const SIMDType b2( B.load(k,j+SIMDSIZE    ) );
-                  const SIMDType b3( B.load(k,j+SIMDSIZE*2UL) );
-                  xmm1 += a1 * b1;
-                  xmm2 += a1 * b2;
-                  xmm3 += a1 * b3;
-                  xmm4 += a2 * b1;
-                  xmm5 += a2 * b2;
-                  xmm6 += a2 * b3;
+               for( size_t l=0UL; l<K; ++l ) {
+                  const SIMDType b1( B.load(k,l,j) );
+                  xmm1 += set( A(k,i    ,l) ) * b1;
+                  xmm2 += set( A(k,i+1UL,l) ) * b1;
                }
 
-               (~C).store( i    , j             , xmm1 );
-               (~C).store( i    , j+SIMDSIZE    , xmm2 );
-               (~C).store( i    , j+SIMDSIZE*2UL, xmm3 );
-               (~C).store( i+1UL, j             , xmm4 );
-               (~C).store( i+1UL, j+SIMDSIZE    , xmm5 );
-               (~C).store( i+1UL, j+SIMDSIZE*2UL, xmm6 );
+               C.store( k, i    , j, C.load(k,i    ,j) + xmm1 );
+               C.store( k, i+1UL, j, C.load(k,i+1UL,j) + xmm2 );
             }
 
-            if( i < iend )
+            if( i < M )
             {
-               const size_t kbegin( 0UL );
-               const size_t kend( K );
-
-               SIMDType xmm1, xmm2, xmm3;
+               SIMDType xmm1;
 
-               for( size_t k=kbegin; k<kend; ++k ) {
-                  const SIMDType a1( set( A(i,k) ) );
-                  xmm1 += a1 * B.load(k,j             );
-                  xmm2 += a1 * B.load(k,j+SIMDSIZE    );
-                  xmm3 += a1 * B.load(k,j+SIMDSIZE*2UL);
+               for( size_t l=0UL; l<K; ++l ) {
+                  xmm1 += set( A(k,i,l) ) * B.load(k,l,j);
                }
 
-               (~C).store( i, j             , xmm1 );
-               (~C).store( i, j+SIMDSIZE    , xmm2 );
-               (~C).store( i, j+SIMDSIZE*2UL, xmm3 );
+               C.store( k, i, j, C.load(k,i,j) + xmm1 );
             }
          }
 
-         for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL )
-         {
-            const size_t iend( M );
-            size_t i( 0UL );
-
-            for( ; (i+4UL) <= iend; i+=4UL )
-            {
-               const size_t kbegin( 0UL );
-               const size_t kend( K );
+         for( ; remainder && j<N; ++j ) {
+            for( size_t i=0UL; i<M; ++i ) {
+               ElementType value( A(k,i,0UL) * B(k,0UL,j) );
+               for( size_t l=1UL; l<K; ++l ) {
+                  value += A(k,i,l) * B(k,l,j);
+               }
+               C(k,i,j) += value;
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
 
-               SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-
-               for( size_t k=kbegin; k<kend; ++k ) {
-                  const SIMDType a1( set( A(i    ,k) ) );
-                  const SIMDType a2( set( A(i+1UL,k) ) );
-                  const SIMDType a3( set( A(i+2UL,k) ) );
-                  const SIMDType a4( set( A(i+3UL,k) ) );
-                  const SIMDType b1( B.load(k,j         ) );
-                  const SIMDType b2( B.load(k,j+SIMDSIZE) );
-                  xmm1 += a1 * b1;
-                  xmm2 += a1 * b2;
-                  xmm3 += a2 * b1;
-                  xmm4 += a2 * b2;
-                  xmm5 += a3 * b1;
-                  xmm6 += a3 * b2;
-                  xmm7 += a4 * b1;
-                  xmm8 += a4 * b2;
-               }
-
-               (~C).store( i    , j         , xmm1 );
-               (~C).store( i    , j+SIMDSIZE, xmm2 );
-               (~C).store( i+1UL, j         , xmm3 );
-               (~C).store( i+1UL, j+SIMDSIZE, xmm4 );
-               (~C).store( i+2UL, j         , xmm5 );
-               (~C).store( i+2UL, j+SIMDSIZE, xmm6 );
-               (~C).store( i+3UL, j         , xmm7 );
-               (~C).store( i+3UL, j+SIMDSIZE, xmm8 );
-            }
-
-            for( ; (i+3UL) <= iend; i+=3UL )
-            {
-               const size_t kbegin( 0UL );
-               const size_t kend( K );
-
-               SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6;
-
-               for( size_t k=kbegin; k<kend; ++k ) {
-                  const SIMDType a1( set( A(i    ,k) ) );
-                  const SIMDType a2( set( A(i+1UL,k) ) );
-                  const SIMDType a3( set( A(i+2UL,k) ) );
-                  const SIMDType b1( B.load(k,j         ) );
-                  const SIMDType b2( B.load(k,j+SIMDSIZE) );
-                  xmm1 += a1 * b1;
-                  xmm2 += a1 * b2;
-                  xmm3 += a2 * b1;
-                  xmm4 += a2 * b2;
-                  xmm5 += a3 * b1;
-                  xmm6 += a3 * b2;
-               }
-
-               (~C).store( i    , j         , xmm1 );
-               (~C).store( i    , j+SIMDSIZE, xmm2 );
-               (~C).store( i+1UL, j         , xmm3 );
-               (~C).store( i+1UL, j+SIMDSIZE, xmm4 );
-               (~C).store( i+2UL, j         , xmm5 );
-               (~C).store( i+2UL, j+SIMDSIZE, xmm6 );
-            }
-
-            for( ; (i+2UL) <= iend; i+=2UL )
-            {
-               const size_t kbegin( 0UL );
-               const size_t kend( K );
-
-               SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-               size_t k( kbegin );
-
-               for( ; (k+2UL) <= kend; k+=2UL ) {
-                  const SIMDType a1( set( A(i    ,k    ) ) );
-                  const SIMDType a2( set( A(i+1UL,k    ) ) );
-                  const SIMDType a3( set( A(i    ,k+1UL) ) );
-                  const SIMDType a4( set( A(i+1UL,k+1UL) ) );
-                  const SIMDType b1( B.load(k    ,j         ) );
-                  const SIMDType b2( B.load(k    ,j+SIMDSIZE) );
-                  const SIMDType b3( B.load(k+1UL,j         ) );
-                  const SIMDType b4( B.load(k+1UL,j+SIMDSIZE) );
-                  xmm1 += a1 * b1;
-                  xmm2 += a1 * b2;
-                  xmm3 += a2 * b1;
-                  xmm4 += a2 * b2;
-                  xmm5 += a3 * b3;
-                  xmm6 += a3 * b4;
-                  xmm7 += a4 * b3;
-                  xmm8 += a4 * b4;
-               }
-
-               for( ; k<kend; ++k ) {
-                  const SIMDType a1( set( A(i    ,k) ) );
-                  const SIMDType a2( set( A(i+1UL,k) ) );
-                  const SIMDType b1( B.load(k,j         ) );
-                  const SIMDType b2( B.load(k,j+SIMDSIZE) );
-                  xmm1 += a1 * b1;
-                  xmm2 += a1 * b2;
-                  xmm3 += a2 * b1;
-                  xmm4 += a2 * b2;
-               }
-
-               (~C).store( i    , j         , xmm1+xmm5 );
-               (~C).store( i    , j+SIMDSIZE, xmm2+xmm6 );
-               (~C).store( i+1UL, j         , xmm3+xmm7 );
-               (~C).store( i+1UL, j+SIMDSIZE, xmm4+xmm8 );
-            }
-
-            if( i < iend )
-            {
-               const size_t kbegin( 0UL );
-               const size_t kend( K );
-
-               SIMDType xmm1, xmm2, xmm3, xmm4;
-               size_t k( kbegin );
-
-               for( ; (k+2UL) <= kend; k+=2UL ) {
-                  const SIMDType a1( set( A(i,k    ) ) );
-                  const SIMDType a2( set( A(i,k+1UL) ) );
-                  xmm1 += a1 * B.load(k    ,j         );
-                  xmm2 += a1 * B.load(k    ,j+SIMDSIZE);
-                  xmm3 += a2 * B.load(k+1UL,j         );
-                  xmm4 += a2 * B.load(k+1UL,j+SIMDSIZE);
-               }
-
-               for( ; k<kend; ++k ) {
-                  const SIMDType a1( set( A(i,k) ) );
-                  xmm1 += a1 * B.load(k,j         );
-                  xmm2 += a1 * B.load(k,j+SIMDSIZE);
-               }
-
-               (~C).store( i, j         , xmm1+xmm3 );
-               (~C).store( i, j+SIMDSIZE, xmm2+xmm4 );
-            }
-         }
-
-         for( ; j<jpos; j+=SIMDSIZE )
-         {
-            const size_t iend( M );
-            size_t i( 0UL );
-
-            for( ; (i+4UL) <= iend; i+=4UL )
-            {
-               const size_t kbegin( 0UL );
-               const size_t kend( K );
-
-               SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-               size_t k( kbegin );
-
-               for( ; (k+2UL) <= kend; k+=2UL ) {
-                  const SIMDType b1( B.load(k    ,j) );
-                  const SIMDType b2( B.load(k+1UL,j) );
-                  xmm1 += set( A(i    ,k    ) ) * b1;
-                  xmm2 += set( A(i+1UL,k    ) ) * b1;
-                  xmm3 += set( A(i+2UL,k    ) ) * b1;
-                  xmm4 += set( A(i+3UL,k    ) ) * b1;
-                  xmm5 += set( A(i    ,k+1UL) ) * b2;
-                  xmm6 += set( A(i+1UL,k+1UL) ) * b2;
-                  xmm7 += set( A(i+2UL,k+1UL) ) * b2;
-                  xmm8 += set( A(i+3UL,k+1UL) ) * b2;
-               }
-
-               for( ; k<kend; ++k ) {
-                  const SIMDType b1( B.load(k,j) );
-                  xmm1 += set( A(i    ,k) ) * b1;
-                  xmm2 += set( A(i+1UL,k) ) * b1;
-                  xmm3 += set( A(i+2UL,k) ) * b1;
-                  xmm4 += set( A(i+3UL,k) ) * b1;
-               }
-
-               (~C).store( i    , j, xmm1+xmm5 );
-               (~C).store( i+1UL, j, xmm2+xmm6 );
-               (~C).store( i+2UL, j, xmm3+xmm7 );
-               (~C).store( i+3UL, j, xmm4+xmm8 );
-            }
-
-            for( ; (i+3UL) <= iend; i+=3UL )
-            {
-               const size_t kbegin( 0UL );
-               const size_t kend( K );
-
-               SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6;
-               size_t k( kbegin );
-
-               for( ; (k+2UL) <= kend; k+=2UL ) {
-                  const SIMDType b1( B.load(k    ,j) );
-                  const SIMDType b2( B.load(k+1UL,j) );
-                  xmm1 += set( A(i    ,k    ) ) * b1;
-                  xmm2 += set( A(i+1UL,k    ) ) * b1;
-                  xmm3 += set( A(i+2UL,k    ) ) * b1;
-                  xmm4 += set( A(i    ,k+1UL) ) * b2;
-                  xmm5 += set( A(i+1UL,k+1UL) ) * b2;
-                  xmm6 += set( A(i+2UL,k+1UL) ) * b2;
-               }
-
-               for( ; k<kend; ++k ) {
-                  const SIMDType b1( B.load(k,j) );
-                  xmm1 += set( A(i    ,k) ) * b1;
-                  xmm2 += set( A(i+1UL,k) ) * b1;
-                  xmm3 += set( A(i+2UL,k) ) * b1;
-               }
-
-               (~C).store( i    , j, xmm1+xmm4 );
-               (~C).store( i+1UL, j, xmm2+xmm5 );
-               (~C).store( i+2UL, j, xmm3+xmm6 );
-            }
-
-            for( ; (i+2UL) <= iend; i+=2UL )
-            {
-               const size_t kbegin( 0UL );
-               const size_t kend( K );
-
-               SIMDType xmm1, xmm2, xmm3, xmm4;
-               size_t k( kbegin );
-
-               for( ; (k+2UL) <= kend; k+=2UL ) {
-                  const SIMDType b1( B.load(k    ,j) );
-                  const SIMDType b2( B.load(k+1UL,j) );
-                  xmm1 += set( A(i    ,k    ) ) * b1;
-                  xmm2 += set( A(i+1UL,k    ) ) * b1;
-                  xmm3 += set( A(i    ,k+1UL) ) * b2;
-                  xmm4 += set( A(i+1UL,k+1UL) ) * b2;
-               }
-
-               for( ; k<kend; ++k ) {
-                  const SIMDType b1( B.load(k,j) );
-                  xmm1 += set( A(i    ,k) ) * b1;
-                  xmm2 += set( A(i+1UL,k) ) * b1;
-               }
-
-               (~C).store( i    , j, xmm1+xmm3 );
-               (~C).store( i+1UL, j, xmm2+xmm4 );
-            }
-
-            if( i < iend )
-            {
-               const size_t kbegin( 0UL );
-
-               SIMDType xmm1, xmm2;
-               size_t k( kbegin );
-
-               for( ; (k+2UL) <= K; k+=2UL ) {
-                  xmm1 += set( A(i,k    ) ) * B.load(k    ,j);
-                  xmm2 += set( A(i,k+1UL) ) * B.load(k+1UL,j);
-               }
-
-               for( ; k<K; ++k ) {
-                  xmm1 += set( A(i,k) ) * B.load(k,j);
-               }
-
-               (~C).store( i, j, xmm1+xmm2 );
-            }
-         }
-
-         for( ; remainder && j<N; ++j )
-         {
-            size_t i( LOW && UPP ? j : 0UL );
-
-            for( ; (i+2UL) <= M; i+=2UL )
-            {
-               const size_t kbegin( 0UL );
-               const size_t kend( K );
-
-               ElementType value1{};
-               ElementType value2{};
-
-               for( size_t k=kbegin; k<kend; ++k ) {
-                  value1 += A(i    ,k) * B(k,j);
-                  value2 += A(i+1UL,k) * B(k,j);
-               }
-
-               (~C)(i    ,j) = value1;
-               (~C)(i+1UL,j) = value2;
-            }
-
-            if( i < M )
-            {
-               const size_t kbegin( 0UL );
-
-               ElementType value{};
-
-               for( size_t k=kbegin; k<K; ++k ) {
-                  value += A(i,k) * B(k,j);
-               }
-
-               (~C)(i,j) = value;
-            }
-         }
-      }
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**Default assignment to dense tensors (large tensors)***************************************
+   //**Default addition assignment to dense tensors (large tensors)********************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Default assignment of a large dense tensor-dense tensor multiplication (\f$ C=A*B \f$).
+   /*!\brief Default addition assignment of a large dense tensor-dense tensor multiplication
+   //        (\f$ C+=A*B \f$).
    // \ingroup dense_tensor
    //
    // \param C The target left-hand side dense tensor.
@@ -1287,24 +1053,24 @@ class DTensDTensMultExpr
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function relays to the default implementation of the assignment of a dense tensor-
-   // dense tensor multiplication expression to a dense tensor.
+   // This function relays to the default implementation of the addition assignment of a dense
+   // tensor-dense tensor multiplication expression to a dense tensor.
    */
    template< typename MT3    // Type of the left-hand side target tensor
            , typename MT4    // Type of the left-hand side tensor operand
            , typename MT5 >  // Type of the right-hand side tensor operand
    static inline EnableIf_t< !UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
-      selectLargeAssignKernel( MT3& C, const MT4& A, const MT5& B )
+      selectLargeAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      selectDefaultAssignKernel( C, A, B );
+      selectDefaultAddAssignKernel( C, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Vectorized default assignment to dense tensors (large tensors)****************************
+   //**Vectorized default addition assignment to dense tensors (large tensors)*********************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Vectorized default assignment of a large dense tensor-dense tensor multiplication
-   //        (\f$ C=A*B \f$).
+   /*!\brief Vectorized default addition assignment of a large dense tensor-dense tensor
+   //        multiplication (\f$ C+=A*B \f$).
    // \ingroup dense_tensor
    //
    // \param C The target left-hand side dense tensor.
@@ -1312,32 +1078,145 @@ class DTensDTensMultExpr
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function implements the vectorized default assignment of a dense tensor-dense tensor
-   // multiplication expression to a dense tensor. This kernel is optimized for large tensors.
+   // This function implements the vectorized default addition assignment of a dense tensor-dense
+   // tensor multiplication expression to a dense tensor. This kernel is optimized for large
+   // pages: the inner dimension and the columns of each page are traversed in blocks, such
+   // that the currently used block of the right-hand side page remains in cache while the
+   // register-blocked micro-kernel sweeps over all rows of the left-hand side page.
    */
    template< typename MT3    // Type of the left-hand side target tensor
            , typename MT4    // Type of the left-hand side tensor operand
            , typename MT5 >  // Type of the right-hand side tensor operand
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
-      selectLargeAssignKernel( MT3& C, const MT4& A, const MT5& B )
+      selectLargeAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      if( SYM )
-         smmm( C, A, B, ElementType(1) );
-      else if( HERM )
-         hmmm( C, A, B, ElementType(1) );
-      else if( LOW )
-         lmmm( C, A, B, ElementType(1), ElementType(0) );
-      else if( UPP )
-         ummm( C, A, B, ElementType(1), ElementType(0) );
-      else
-         mmm( C, A, B, ElementType(1), ElementType(0) );
+      constexpr bool remainder( !IsPadded_v<MT3> || !IsPadded_v<MT5> );
+
+      constexpr size_t jblock( SIMDSIZE*32UL );
+      constexpr size_t lblock( 64UL );
+
+      const size_t O( A.pages()   );
+      const size_t M( A.rows()    );
+      const size_t N( B.columns() );
+      const size_t K( A.columns() );
+
+      for( size_t k=0UL; k<O; ++k ) {
+         for( size_t jj=0UL; jj<N; jj+=jblock )
+         {
+            const size_t jend( min( jj+jblock, N ) );
+            const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
+            BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+            for( size_t ll=0UL; ll<K; ll+=lblock )
+            {
+               const size_t lend( min( ll+lblock, K ) );
+
+               size_t j( jj );
+
+               for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL )
+               {
+                  size_t i( 0UL );
+
+                  for( ; (i+2UL) <= M; i+=2UL )
+                  {
+                     SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
+
+                     for( size_t l=ll; l<lend; ++l ) {
+                        const SIMDType a1( set( A(k,i    ,l) ) );
+                        const SIMDType a2( set( A(k,i+1UL,l) ) );
+                        const SIMDType b1( B.load(k,l,j             ) );
+                        const SIMDType b2( B.load(k,l,j+SIMDSIZE    ) );
+                        const SIMDType b3( B.load(k,l,j+SIMDSIZE*2UL) );
+                        const SIMDType b4( B.load(k,l,j+SIMDSIZE*3UL) );
+                        xmm1 += a1 * b1;
+                        xmm2 += a1 * b2;
+                        xmm3 += a1 * b3;
+                        xmm4 += a1 * b4;
+                        xmm5 += a2 * b1;
+                        xmm6 += a2 * b2;
+                        xmm7 += a2 * b3;
+                        xmm8 += a2 * b4;
+                     }
+
+                     C.store( k, i    , j             , C.load(k,i    ,j             ) + xmm1 );
+                     C.store( k, i    , j+SIMDSIZE    , C.load(k,i    ,j+SIMDSIZE    ) + xmm2 );
+                     C.store( k, i    , j+SIMDSIZE*2UL, C.load(k,i    ,j+SIMDSIZE*2UL) + xmm3 );
+                     C.store( k, i    , j+SIMDSIZE*3UL, C.load(k,i    ,j+SIMDSIZE*3UL) + xmm4 );
+                     C.store( k, i+1UL, j             , C.load(k,i+1UL,j             ) + xmm5 );
+                     C.store( k, i+1UL, j+SIMDSIZE    , C.load(k,i+1UL,j+SIMDSIZE    ) + xmm6 );
+                     C.store( k, i+1UL, j+SIMDSIZE*2UL, C.load(k,i+1UL,j+SIMDSIZE*2UL) + xmm7 );
+                     C.store( k, i+1UL, j+SIMDSIZE*3UL, C.load(k,i+1UL,j+SIMDSIZE*3UL) + xmm8 );
+                  }
+
+                  if( i < M )
+                  {
+                     SIMDType xmm1, xmm2, xmm3, xmm4;
+
+                     for( size_t l=ll; l<lend; ++l ) {
+                        const SIMDType a1( set( A(k,i,l) ) );
+                        xmm1 += a1 * B.load(k,l,j             );
+                        xmm2 += a1 * B.load(k,l,j+SIMDSIZE    );
+                        xmm3 += a1 * B.load(k,l,j+SIMDSIZE*2UL);
+                        xmm4 += a1 * B.load(k,l,j+SIMDSIZE*3UL);
+                     }
+
+                     C.store( k, i, j             , C.load(k,i,j             ) + xmm1 );
+                     C.store( k, i, j+SIMDSIZE    , C.load(k,i,j+SIMDSIZE    ) + xmm2 );
+                     C.store( k, i, j+SIMDSIZE*2UL, C.load(k,i,j+SIMDSIZE*2UL) + xmm3 );
+                     C.store( k, i, j+SIMDSIZE*3UL, C.load(k,i,j+SIMDSIZE*3UL) + xmm4 );
+                  }
+               }
+
+               for( ; j<jpos; j+=SIMDSIZE )
+               {
+                  size_t i( 0UL );
+
+                  for( ; (i+2UL) <= M; i+=2UL )
+                  {
+                     SIMDType xmm1, xmm2;
+
+                     for( size_t l=ll; l<lend; ++l ) {
+                        const SIMDType b1( B.load(k,l,j) );
+                        xmm1 += set( A(k,i    ,l) ) * b1;
+                        xmm2 += set( A(k,i+1UL,l) ) * b1;
+                     }
+
+                     C.store( k, i    , j, C.load(k,i    ,j) + xmm1 );
+                     C.store( k, i+1UL, j, C.load(k,i+1UL,j) + xmm2 );
+                  }
+
+                  if( i < M )
+                  {
+                     SIMDType xmm1;
+
+                     for( size_t l=ll; l<lend; ++l ) {
+                        xmm1 += set( A(k,i,l) ) * B.load(k,l,j);
+                     }
+
+                     C.store( k, i, j, C.load(k,i,j) + xmm1 );
+                  }
+               }
+
+               for( ; remainder && j<jend; ++j ) {
+                  for( size_t i=0UL; i<M; ++i ) {
+                     ElementType value( A(k,i,ll) * B(k,ll,j) );
+                     for( size_t l=ll+1UL; l<lend; ++l ) {
+                        value += A(k,i,l) * B(k,l,j);
+                     }
+                     C(k,i,j) += value;
+                  }
+               }
+            }
+         }
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**BLAS-based assignment to dense tensors (default)*******************************************
+   //**BLAS-based addition assignment to dense tensors (default)***********************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Default assignment of a dense tensor-dense tensor multiplication (\f$ C=A*B \f$).
+   /*!\brief Default addition assignment of a dense tensor-dense tensor multiplication
+   //        (\f$ C+=A*B \f$).
    // \ingroup dense_tensor
    //
    // \param C The target left-hand side dense tensor.
@@ -1345,24 +1224,25 @@ class DTensDTensMultExpr
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function relays to the default implementation of the assignment of a large dense
-   // tensor-dense tensor multiplication expression to a dense tensor.
+   // This function relays to the default implementation of the addition assignment of a large
+   // dense tensor-dense tensor multiplication expression to a dense tensor.
    */
    template< typename MT3    // Type of the left-hand side target tensor
            , typename MT4    // Type of the left-hand side tensor operand
            , typename MT5 >  // Type of the right-hand side tensor operand
    static inline EnableIf_t< !UseBlasKernel_v<MT3,MT4,MT5> >
-      selectBlasAssignKernel( MT3& C, const MT4& A, const MT5& B )
+      selectBlasAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      selectLargeAssignKernel( C, A, B );
+      selectLargeAddAssignKernel( C, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**BLAS-based assignment to dense tensors*****************************************************
-#if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_MATRIX_MATRIX_MULTIPLICATION
+   //**BLAS-based addition assignment to dense tensors*********************************************
+#if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_TENSOR_TENSOR_MULTIPLICATION
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief BLAS-based assignment of a dense tensor-dense tensor multiplication (\f$ C=A*B \f$).
+   /*!\brief BLAS-based addition assignment of a dense tensor-dense tensor multiplication
+   //        (\f$ C+=A*B \f$).
    // \ingroup dense_tensor
    //
    // \param C The target left-hand side dense tensor.
@@ -1371,38 +1251,48 @@ class DTensDTensMultExpr
    // \return void
    //
    // This function performs the dense tensor-dense tensor multiplication based on the according
-   // BLAS functionality.
+   // BLAS functionality. In case the BLAS library provides a strided batched \c gemm() (see
+   // the BLAZE_USE_BLAS_BATCHED_TENSOR_TENSOR_MULTIPLICATION switch), all pages are multiplied
+   // by a single call, otherwise \c gemm() is called for each page.
    */
    template< typename MT3    // Type of the left-hand side target tensor
            , typename MT4    // Type of the left-hand side tensor operand
            , typename MT5 >  // Type of the right-hand side tensor operand
    static inline EnableIf_t< UseBlasKernel_v<MT3,MT4,MT5> >
-      selectBlasAssignKernel( MT3& C, const MT4& A, const MT5& B )
+      selectBlasAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       using ET = ElementType_t<MT3>;
 
-      gemm( C, A, B, ET(1), ET(0) );
+#if BLAZE_USE_BLAS_BATCHED_TENSOR_TENSOR_MULTIPLICATION
+      gemmBatchStrided( C, A, B, ET(1), ET(1) );
+#else
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         auto Ck( pageslice( C, k, unchecked ) );
+         gemm( Ck, pageslice( A, k, unchecked ), pageslice( B, k, unchecked ), ET(1), ET(1) );
+      }
+#endif
    }
    /*! \endcond */
 #endif
    //**********************************************************************************************
 
-   //**Addition assignment to dense tensors*******************************************************
+   //**Subtraction assignment to dense tensors****************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Addition assignment of a dense tensor-dense tensor multiplication to a dense tensor
-   //        (\f$ C+=A*B \f$).
+   /*!\brief Subtraction assignment of a dense tensor-dense tensor multiplication to a
+   //        dense tensor (\f$ C-=A*B \f$).
    // \ingroup dense_tensor
    //
    // \param lhs The target left-hand side dense tensor.
-   // \param rhs The right-hand side multiplication expression to be added.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
    // \return void
    //
-   // This function implements the performance optimized addition assignment of a dense tensor-
+   // This function implements the performance optimized subtraction assignment of a dense tensor-
    // dense tensor multiplication expression to a dense tensor.
    */
-   template< typename MT > // Type of the target dense tensor
+   template< typename MT  // Type of the target dense tensor
+           , bool SO >    // Storage order of the target dense tensor
    friend inline void
-      addAssign( DenseTensor<MT>& lhs, const DTensDTensMultExpr& rhs )
+      subAssign( DenseTensor<MT>& lhs, const DTensDTensMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
@@ -1423,159 +1313,15 @@ class DTensDTensMultExpr
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
 
-      DTensDTensMultExpr::selectAddAssignKernel( ~lhs, A, B );
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**Addition assignment to dense tensors (kernel selection)************************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Selection of the kernel for an addition assignment of a dense tensor-dense tensor
-   //        multiplication to a dense tensor (\f$ C+=A*B \f$).
-   // \ingroup dense_tensor
-   //
-   // \param C The target left-hand side dense tensor.
-   // \param A The left-hand side multiplication operand.
-   // \param B The right-hand side multiplication operand.
-   // \return void
-   */
-   template< typename MT3    // Type of the left-hand side target tensor
-           , typename MT4    // Type of the left-hand side tensor operand
-           , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
-   {
-      if( ( IsDiagonal_v<MT5> ) ||
-          ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
-         selectSmallAddAssignKernel( C, A, B );
-      else
-         selectBlasAddAssignKernel( C, A, B );
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**Default addition assignment to dense tensors (general/general)*****************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Default addition assignment of a general dense tensor-general dense tensor
-   //        multiplication (\f$ C+=A*B \f$).
-   // \ingroup dense_tensor
-   //
-   // \param C The target left-hand side dense tensor.
-   // \param A The left-hand side multiplication operand.
-   // \param B The right-hand side multiplication operand.
-   // \return void
-   //
-   // This function implements the default addition assignment of a general dense tensor-general
-   // dense tensor multiplication expression to a dense tensor.
-   */
-   template< typename MT3    // Type of the left-hand side target tensor
-           , typename MT4    // Type of the left-hand side tensor operand
-           , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline EnableIf_t< !IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
-      selectDefaultAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
-   {
-      const size_t M( A.rows()    );
-      const size_t N( B.columns() );
-      const size_t K( A.columns() );
-
-      BLAZE_INTERNAL_ASSERT( !( LOW || UPP ) || ( M == N ), "Broken invariant detected" );
-
-      for( size_t i=0UL; i<M; ++i )
-      {
-         const size_t kbegin( ( IsUpper_v<MT4> )
-                              ?( IsStrictlyUpper_v<MT4> ? i+1UL : i )
-                              :( 0UL ) );
-         const size_t kend( ( IsLower_v<MT4> )
-                            ?( IsStrictlyLower_v<MT4> ? i : i+1UL )
-                            :( K ) );
-         BLAZE_INTERNAL_ASSERT( kbegin <= kend, "Invalid loop indices detected" );
-
-         for( size_t k=kbegin; k<kend; ++k )
-         {
-            const size_t jbegin( ( IsUpper_v<MT5> )
-                                 ?( ( IsStrictlyUpper_v<MT5> )
-                                    ?( UPP ? max(i,k+1UL) : k+1UL )
-                                    :( UPP ? max(i,k) : k ) )
-                                 :( UPP ? i : 0UL ) );
-            const size_t jend( ( IsLower_v<MT5> )
-                               ?( ( IsStrictlyLower_v<MT5> )
-                                  ?( LOW ? min(i+1UL,k) : k )
-                                  :( LOW ? min(i,k)+1UL : k+1UL ) )
-                               :( LOW ? i+1UL : N ) );
-
-            if( ( LOW || UPP ) && ( jbegin >= jend ) ) continue;
-            BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-            const size_t jnum( jend - jbegin );
-            const size_t jpos( jbegin + ( jnum & size_t(-2) ) );
-
-            for( size_t j=jbegin; j<jpos; j+=2UL ) {
-               C(i,j    ) += A(i,k) * B(k,j    );
-               C(i,j+1UL) += A(i,k) * B(k,j+1UL);
-            }
-            if( jpos < jend ) {
-               C(i,jpos) += A(i,k) * B(k,jpos);
-            }
-         }
-      }
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**Default addition assignment to dense tensors (general/diagonal)****************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Default addition assignment of a general dense tensor-diagonal dense tensor
-   //        multiplication (\f$ C+=A*B \f$).
-   // \ingroup dense_tensor
-   //
-   // \param C The target left-hand side dense tensor.
-   // \param A The left-hand side multiplication operand.
-   // \param B The right-hand side multiplication operand.
-   // \return void
-   //
-   // This function implements the default addition assignment of a general dense tensor-diagonal
-   // dense tensor multiplication expression to a dense tensor.
-   */
-   template< typename MT3    // Type of the left-hand side target tensor
-           , typename MT4    // Type of the left-hand side tensor operand
-           , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline EnableIf_t< !IsDiagonal_v<MT4> && IsDiagonal_v<MT5> >
-      selectDefaultAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
-   {
-      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT3 );
-
-      const size_t M( A.rows()    );
-      const size_t N( B.columns() );
-
-      for( size_t i=0UL; i<M; ++i )
-      {
-         const size_t jbegin( ( IsUpper_v<MT4> )
-                              ?( IsStrictlyUpper_v<MT4> ? i+1UL : i )
-                              :( 0UL ) );
-         const size_t jend( ( IsLower_v<MT4> )
-                            ?( IsStrictlyLower_v<MT4> ? i : i+1UL )
-                            :( N ) );
-         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-         const size_t jnum( jend - jbegin );
-         const size_t jpos( jbegin + ( jnum & size_t(-2) ) );
-
-         for( size_t j=jbegin; j<jpos; j+=2UL ) {
-            C(i,j    ) += A(i,j    ) * B(j    ,j    );
-            C(i,j+1UL) += A(i,j+1UL) * B(j+1UL,j+1UL);
-         }
-         if( jpos < jend ) {
-            C(i,jpos) += A(i,jpos) * B(jpos,jpos);
-         }
-      }
+      DTensDTensMultExpr::selectSubAssignKernel( ~lhs, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Default addition assignment to dense tensors (diagonal/general)****************************
+   //**Subtraction assignment to dense tensors (kernel selection)**********************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Default addition assignment of a diagonal dense tensor-general dense tensor
-   //        multiplication (\f$ C+=A*B \f$).
+   /*!\brief Selection of the kernel for a subtraction assignment of a dense tensor-dense tensor
+   //        multiplication to a dense tensor (\f$ C-=A*B \f$).
    // \ingroup dense_tensor
    //
    // \param C The target left-hand side dense tensor.
@@ -1583,1940 +1329,223 @@ class DTensDTensMultExpr
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function implements the default addition assignment of a diagonal dense tensor-general
-   // dense tensor multiplication expression to a dense tensor.
+   // The pages of the tensors are multiplied independently of each other. Therefore the
+   // kernel is selected based on the size of a single page of the target tensor.
    */
    template< typename MT3    // Type of the left-hand side target tensor
            , typename MT4    // Type of the left-hand side tensor operand
            , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline EnableIf_t< IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
-      selectDefaultAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT3 );
-
-      const size_t M( A.rows()    );
-      const size_t N( B.columns() );
-
-      for( size_t i=0UL; i<M; ++i )
-      {
-         const size_t jbegin( ( IsUpper_v<MT5> )
-                              ?( IsStrictlyUpper_v<MT5> ? i+1UL : i )
-                              :( 0UL ) );
-         const size_t jend( ( IsLower_v<MT5> )
-                            ?( IsStrictlyLower_v<MT5> ? i : i+1UL )
-                            :( N ) );
-         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-         const size_t jnum( jend - jbegin );
-         const size_t jpos( jbegin + ( jnum & size_t(-2) ) );
-
-         for( size_t j=jbegin; j<jpos; j+=2UL ) {
-            C(i,j    ) += A(i,i) * B(i,j    );
-            C(i,j+1UL) += A(i,i) * B(i,j+1UL);
-         }
-         if( jpos < jend ) {
-            C(i,jpos) += A(i,i) * B(i,jpos);
-         }
-      }
+      if( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD )
+         selectSmallSubAssignKernel( C, A, B );
+      else
+         selectBlasSubAssignKernel( C, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Default addition assignment to dense tensors (diagonal/diagonal)***************************
+   //**Default subtraction assignment to dense tensors*********************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Default addition assignment of a diagonal dense tensor-diagonal dense tensor
-   //        multiplication (\f$ C+=A*B \f$).
+   /*!\brief Default subtraction assignment of a dense tensor-dense tensor multiplication
+   //        (\f$ C-=A*B \f$).
    // \ingroup dense_tensor
    //
    // \param C The target left-hand side dense tensor.
    // \param A The left-hand side multiplication operand.
    // \param B The right-hand side multiplication operand.
-   // \return void
-   //
-   // This function implements the default addition assignment of a diagonal dense tensor-diagonal
-   // dense tensor multiplication expression to a dense tensor.
-   */
-   template< typename MT3    // Type of the left-hand side target tensor
-           , typename MT4    // Type of the left-hand side tensor operand
-           , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline EnableIf_t< IsDiagonal_v<MT4> && IsDiagonal_v<MT5> >
-      selectDefaultAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
-   {
-      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT3 );
-
-      for( size_t i=0UL; i<A.rows(); ++i ) {
-         C(i,i) += A(i,i) * B(i,i);
-      }
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**Default addition assignment to dense tensors (small tensors)******************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Default addition assignment of a small dense tensor-dense tensor multiplication
-   //        (\f$ C+=A*B \f$).
-   // \ingroup dense_tensor
-   //
-   // \param C The target left-hand side dense tensor.
-   // \param A The left-hand side multiplication operand.
-   // \param B The right-hand side multiplication operand.
-   // \return void
-   //
-   // This function relays to the default implementation of the addition assignment of a dense
-   // tensor-dense tensor multiplication expression to a dense tensor.
-   */
-   template< typename MT3    // Type of the left-hand side target tensor
-           , typename MT4    // Type of the left-hand side tensor operand
-           , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline EnableIf_t< !UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
-      selectSmallAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
-   {
-      selectDefaultAddAssignKernel( C, A, B );
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**Vectorized default addition assignment to row-major dense tensors (small tensors)*********
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Vectorized default addition assignment of a small dense tensor-dense tensor
-   //        multiplication (\f$ C+=A*B \f$).
-   // \ingroup dense_tensor
-   //
-   // \param C The target left-hand side dense tensor.
-   // \param A The left-hand side multiplication operand.
-   // \param B The right-hand side multiplication operand.
-   // \return void
-   //
-   // This function implements the vectorized default addition assignment of a dense tensor-dense
-   // tensor multiplication expression to a row-major dense tensor. This kernel is optimized for
-   // small tensors.
-   */
-   template< typename MT3    // Type of the left-hand side target tensor
-           , typename MT4    // Type of the left-hand side tensor operand
-           , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline EnableIf_t< UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
-      selectSmallAddAssignKernel( DenseTensor<MT3>& C, const MT4& A, const MT5& B )
-   {
-      constexpr bool remainder( !IsPadded_v<MT3> || !IsPadded_v<MT5> );
-
-      const size_t M( A.rows()    );
-      const size_t N( B.columns() );
-      const size_t K( A.columns() );
-
-      BLAZE_INTERNAL_ASSERT( !( LOW || UPP ) || ( M == N ), "Broken invariant detected" );
-
-      const size_t jpos( remainder ? ( N & size_t(-SIMDSIZE) ) : N );
-      BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
-
-      size_t j( 0UL );
-
-      if( IsIntegral_v<ElementType> )
-      {
-         for( ; !LOW && !UPP && (j+SIMDSIZE*7UL) < jpos; j+=SIMDSIZE*8UL ) {
-            for( size_t i=0UL; i<M; ++i )
-            {
-               const size_t kbegin( ( IsUpper_v<MT4> )
-                                    ?( ( IsLower_v<MT5> )
-                                       ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                       :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                    :( IsLower_v<MT5> ? j : 0UL ) );
-               const size_t kend( ( IsLower_v<MT4> )
-                                  ?( ( IsUpper_v<MT5> )
-                                     ?( min( ( IsStrictlyLower_v<MT4> ? i : i+1UL ), j+SIMDSIZE*8UL, K ) )
-                                     :( IsStrictlyLower_v<MT4> ? i : i+1UL ) )
-                                  :( IsUpper_v<MT5> ? min( j+SIMDSIZE*8UL, K ) : K ) );
-
-               SIMDType xmm1( (~C).load(i,j             ) );
-               SIMDType xmm2( (~C).load(i,j+SIMDSIZE    ) );
-               SIMDType xmm3( (~C).load(i,j+SIMDSIZE*2UL) );
-               SIMDType xmm4( (~C).load(i,j+SIMDSIZE*3UL) );
-               SIMDType xmm5( (~C).load(i,j+SIMDSIZE*4UL) );
-               SIMDType xmm6( (~C).load(i,j+SIMDSIZE*5UL) );
-               SIMDType xmm7( (~C).load(i,j+SIMDSIZE*6UL) );
-               SIMDType xmm8( (~C).load(i,j+SIMDSIZE*7UL) );
-
-               for( size_t k=kbegin; k<kend; ++k ) {
-                  const SIMDType a1( set( A(i,k) ) );
-                  xmm1 += a1 * B.load(k,j             );
-                  xmm2 += a1 * B.load(k,j+SIMDSIZE    );
-                  xmm3 += a1 * B.load(k,j+SIMDSIZE*2UL);
-                  xmm4 += a1 * B.load(k,j+SIMDSIZE*3UL);
-                  xmm5 += a1 * B.load(k,j+SIMDSIZE*4UL);
-                  xmm6 += a1 * B.load(k,j+SIMDSIZE*5UL);
-                  xmm7 += a1 * B.load(k,j+SIMDSIZE*6UL);
-                  xmm8 += a1 * B.load(k,j+SIMDSIZE*7UL);
-               }
-
-               (~C).store( i, j             , xmm1 );
-               (~C).store( i, j+SIMDSIZE    , xmm2 );
-               (~C).store( i, j+SIMDSIZE*2UL, xmm3 );
-               (~C).store( i, j+SIMDSIZE*3UL, xmm4 );
-               (~C).store( i, j+SIMDSIZE*4UL, xmm5 );
-               (~C).store( i, j+SIMDSIZE*5UL, xmm6 );
-               (~C).store( i, j+SIMDSIZE*6UL, xmm7 );
-               (~C).store( i, j+SIMDSIZE*7UL, xmm8 );
-            }
-         }
-      }
-
-      for( ; !LOW && !UPP && (j+SIMDSIZE*4UL) < jpos; j+=SIMDSIZE*5UL )
-      {
-         size_t i( 0UL );
-
-         for( ; (i+2UL) <= M; i+=2UL )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsLower_v<MT4> )
-                               ?( ( IsUpper_v<MT5> )
-                                  ?( min( ( IsStrictlyLower_v<MT4> ? i+1UL : i+2UL ), j+SIMDSIZE*5UL, K ) )
-                                  :( IsStrictlyLower_v<MT4> ? i+1UL : i+2UL ) )
-                               :( IsUpper_v<MT5> ? min( j+SIMDSIZE*5UL, K ) : K ) );
-
-            SIMDType xmm1 ( (~C).load(i    ,j             ) );
-            SIMDType xmm2 ( (~C).load(i    ,j+SIMDSIZE    ) );
-            SIMDType xmm3 ( (~C).load(i    ,j+SIMDSIZE*2UL) );
-            SIMDType xmm4 ( (~C).load(i    ,j+SIMDSIZE*3UL) );
-            SIMDType xmm5 ( (~C).load(i    ,j+SIMDSIZE*4UL) );
-            SIMDType xmm6 ( (~C).load(i+1UL,j             ) );
-            SIMDType xmm7 ( (~C).load(i+1UL,j+SIMDSIZE    ) );
-            SIMDType xmm8 ( (~C).load(i+1UL,j+SIMDSIZE*2UL) );
-            SIMDType xmm9 ( (~C).load(i+1UL,j+SIMDSIZE*3UL) );
-            SIMDType xmm10( (~C).load(i+1UL,j+SIMDSIZE*4UL) );
-
-            for( size_t k=kbegin; k<kend; ++k ) {
-               const SIMDType a1( set( A(i    ,k) ) );
-               const SIMDType a2( set( A(i+1UL,k) ) );
-               const SIMDType b1( B.load(k,j             ) );
-               const SIMDType b2( B.load(k,j+SIMDSIZE    ) );
-               const SIMDType b3( B.load(k,j+SIMDSIZE*2UL) );
-               const SIMDType b4( B.load(k,j+SIMDSIZE*3UL) );
-               const SIMDType b5( B.load(k,j+SIMDSIZE*4UL) );
-               xmm1  += a1 * b1;
-               xmm2  += a1 * b2;
-               xmm3  += a1 * b3;
-               xmm4  += a1 * b4;
-               xmm5  += a1 * b5;
-               xmm6  += a2 * b1;
-               xmm7  += a2 * b2;
-               xmm8  += a2 * b3;
-               xmm9  += a2 * b4;
-               xmm10 += a2 * b5;
-            }
-
-            (~C).store( i    , j             , xmm1  );
-            (~C).store( i    , j+SIMDSIZE    , xmm2  );
-            (~C).store( i    , j+SIMDSIZE*2UL, xmm3  );
-            (~C).store( i    , j+SIMDSIZE*3UL, xmm4  );
-            (~C).store( i    , j+SIMDSIZE*4UL, xmm5  );
-            (~C).store( i+1UL, j             , xmm6  );
-            (~C).store( i+1UL, j+SIMDSIZE    , xmm7  );
-            (~C).store( i+1UL, j+SIMDSIZE*2UL, xmm8  );
-            (~C).store( i+1UL, j+SIMDSIZE*3UL, xmm9  );
-            (~C).store( i+1UL, j+SIMDSIZE*4UL, xmm10 );
-         }
-
-         if( i < M )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsUpper_v<MT5> )?( min( j+SIMDSIZE*5UL, K ) ):( K ) );
-
-            SIMDType xmm1( (~C).load(i,j             ) );
-            SIMDType xmm2( (~C).load(i,j+SIMDSIZE    ) );
-            SIMDType xmm3( (~C).load(i,j+SIMDSIZE*2UL) );
-            SIMDType xmm4( (~C).load(i,j+SIMDSIZE*3UL) );
-            SIMDType xmm5( (~C).load(i,j+SIMDSIZE*4UL) );
-
-            for( size_t k=kbegin; k<kend; ++k ) {
-               const SIMDType a1( set( A(i,k) ) );
-               xmm1 += a1 * B.load(k,j             );
-               xmm2 += a1 * B.load(k,j+SIMDSIZE    );
-               xmm3 += a1 * B.load(k,j+SIMDSIZE*2UL);
-               xmm4 += a1 * B.load(k,j+SIMDSIZE*3UL);
-               xmm5 += a1 * B.load(k,j+SIMDSIZE*4UL);
-            }
-
-            (~C).store( i, j             , xmm1 );
-            (~C).store( i, j+SIMDSIZE    , xmm2 );
-            (~C).store( i, j+SIMDSIZE*2UL, xmm3 );
-            (~C).store( i, j+SIMDSIZE*3UL, xmm4 );
-            (~C).store( i, j+SIMDSIZE*4UL, xmm5 );
-         }
-      }
-
-      for( ; !LOW && !UPP && (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL )
-      {
-         size_t i( 0UL );
-
-         for( ; (i+2UL) <= M; i+=2UL )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsLower_v<MT4> )
-                               ?( ( IsUpper_v<MT5> )
-                                  ?( min( ( IsStrictlyLower_v<MT4> ? i+1UL : i+2UL ), j+SIMDSIZE*4UL, K ) )
-                                  :( IsStrictlyLower_v<MT4> ? i+1UL : i+2UL ) )
-                               :( IsUpper_v<MT5> ? min( j+SIMDSIZE*4UL, K ) : K ) );
-
-            SIMDType xmm1( (~C).load(i    ,j             ) );
-            SIMDType xmm2( (~C).load(i    ,j+SIMDSIZE    ) );
-            SIMDType xmm3( (~C).load(i    ,j+SIMDSIZE*2UL) );
-            SIMDType xmm4( (~C).load(i    ,j+SIMDSIZE*3UL) );
-            SIMDType xmm5( (~C).load(i+1UL,j             ) );
-            SIMDType xmm6( (~C).load(i+1UL,j+SIMDSIZE    ) );
-            SIMDType xmm7( (~C).load(i+1UL,j+SIMDSIZE*2UL) );
-            SIMDType xmm8( (~C).load(i+1UL,j+SIMDSIZE*3UL) );
-
-            for( size_t k=kbegin; k<kend; ++k ) {
-               const SIMDType a1( set( A(i    ,k) ) );
-               const SIMDType a2( set( A(i+1UL,k) ) );
-               const SIMDType b1( B.load(k,j             ) );
-               const SIMDType b2( B.load(k,j+SIMDSIZE    ) );
-               const SIMDType b3( B.load(k,j+SIMDSIZE*2UL) );
-               const SIMDType b4( B.load(k,j+SIMDSIZE*3UL) );
-               xmm1 += a1 * b1;
-               xmm2 += a1 * b2;
-               xmm3 += a1 * b3;
-               xmm4 += a1 * b4;
-               xmm5 += a2 * b1;
-               xmm6 += a2 * b2;
-               xmm7 += a2 * b3;
-               xmm8 += a2 * b4;
-            }
-
-            (~C).store( i    , j             , xmm1 );
-            (~C).store( i    , j+SIMDSIZE    , xmm2 );
-            (~C).store( i    , j+SIMDSIZE*2UL, xmm3 );
-            (~C).store( i    , j+SIMDSIZE*3UL, xmm4 );
-            (~C).store( i+1UL, j             , xmm5 );
-            (~C).store( i+1UL, j+SIMDSIZE    , xmm6 );
-            (~C).store( i+1UL, j+SIMDSIZE*2UL, xmm7 );
-            (~C).store( i+1UL, j+SIMDSIZE*3UL, xmm8 );
-         }
-
-         if( i < M )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsUpper_v<MT5> )?( min( j+SIMDSIZE*4UL, K ) ):( K ) );
-
-            SIMDType xmm1( (~C).load(i,j             ) );
-            SIMDType xmm2( (~C).load(i,j+SIMDSIZE    ) );
-            SIMDType xmm3( (~C).load(i,j+SIMDSIZE*2UL) );
-            SIMDType xmm4( (~C).load(i,j+SIMDSIZE*3UL) );
-
-            for( size_t k=kbegin; k<kend; ++k ) {
-               const SIMDType a1( set( A(i,k) ) );
-               xmm1 += a1 * B.load(k,j             );
-               xmm2 += a1 * B.load(k,j+SIMDSIZE    );
-               xmm3 += a1 * B.load(k,j+SIMDSIZE*2UL);
-               xmm4 += a1 * B.load(k,j+SIMDSIZE*3UL);
-            }
-
-            (~C).store( i, j             , xmm1 );
-            (~C).store( i, j+SIMDSIZE    , xmm2 );
-            (~C).store( i, j+SIMDSIZE*2UL, xmm3 );
-            (~C).store( i, j+SIMDSIZE*3UL, xmm4 );
-         }
-      }
-
-      for( ; !LOW && !UPP && (j+SIMDSIZE*2UL) < jpos; j+=SIMDSIZE*3UL )
-      {
-         size_t i( 0UL );
-
-         for( ; (i+2UL) <= M; i+=2UL )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsLower_v<MT4> )
-                               ?( ( IsUpper_v<MT5> )
-                                  ?( min( ( IsStrictlyLower_v<MT4> ? i+1UL : i+2UL ), j+SIMDSIZE*3UL, K ) )
-                                  :( IsStrictlyLower_v<MT4> ? i+1UL : i+2UL ) )
-                               :( IsUpper_v<MT5> ? min( j+SIMDSIZE*3UL, K ) : K ) );
-
-            SIMDType xmm1( (~C).load(i    ,j             ) );
-            SIMDType xmm2( (~C).load(i    ,j+SIMDSIZE    ) );
-            SIMDType xmm3( (~C).load(i    ,j+SIMDSIZE*2UL) );
-            SIMDType xmm4( (~C).load(i+1UL,j             ) );
-            SIMDType xmm5( (~C).load(i+1UL,j+SIMDSIZE    ) );
-            SIMDType xmm6( (~C).load(i+1UL,j+SIMDSIZE*2UL) );
-
-            for( size_t k=kbegin; k<kend; ++k ) {
-               const SIMDType a1( set( A(i    ,k) ) );
-               const SIMDType a2( set( A(i+1UL,k) ) );
-               const SIMDType b1( B.load(k,j             ) );
-               const SIMDType b2( B.load(k,j+SIMDSIZE    ) );
-               const SIMDType b3( B.load(k,j+SIMDSIZE*2UL) );
-               xmm1 += a1 * b1;
-               xmm2 += a1 * b2;
-               xmm3 += a1 * b3;
-               xmm4 += a2 * b1;
-               xmm5 += a2 * b2;
-               xmm6 += a2 * b3;
-            }
-
-            (~C).store( i    , j             , xmm1 );
-            (~C).store( i    , j+SIMDSIZE    , xmm2 );
-            (~C).store( i    , j+SIMDSIZE*2UL, xmm3 );
-            (~C).store( i+1UL, j             , xmm4 );
-            (~C).store( i+1UL, j+SIMDSIZE    , xmm5 );
-            (~C).store( i+1UL, j+SIMDSIZE*2UL, xmm6 );
-         }
-
-         if( i < M )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsUpper_v<MT5> )?( min( j+SIMDSIZE*3UL, K ) ):( K ) );
-
-            SIMDType xmm1( (~C).load(i,j             ) );
-            SIMDType xmm2( (~C).load(i,j+SIMDSIZE    ) );
-            SIMDType xmm3( (~C).load(i,j+SIMDSIZE*2UL) );
-
-            for( size_t k=kbegin; k<kend; ++k ) {
-               const SIMDType a1( set( A(i,k) ) );
-               xmm1 += a1 * B.load(k,j             );
-               xmm2 += a1 * B.load(k,j+SIMDSIZE    );
-               xmm3 += a1 * B.load(k,j+SIMDSIZE*2UL);
-            }
-
-            (~C).store( i, j             , xmm1 );
-            (~C).store( i, j+SIMDSIZE    , xmm2 );
-            (~C).store( i, j+SIMDSIZE*2UL, xmm3 );
-         }
-      }
-
-      for( ; !( LOW && UPP ) && (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL )
-      {
-         const size_t iend( UPP ? min(j+SIMDSIZE*2UL,M) : M );
-         size_t i( LOW ? j : 0UL );
-
-         for( ; (i+4UL) <= iend; i+=4UL )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsLower_v<MT4> )
-                               ?( ( IsUpper_v<MT5> )
-                                  ?( min( ( IsStrictlyLower_v<MT4> ? i+3UL : i+4UL ), j+SIMDSIZE*2UL, K ) )
-                                  :( IsStrictlyLower_v<MT4> ? i+3UL : i+4UL ) )
-                               :( IsUpper_v<MT5> ? min( j+SIMDSIZE*2UL, K ) : K ) );
-
-            SIMDType xmm1( (~C).load(i    ,j         ) );
-            SIMDType xmm2( (~C).load(i    ,j+SIMDSIZE) );
-            SIMDType xmm3( (~C).load(i+1UL,j         ) );
-            SIMDType xmm4( (~C).load(i+1UL,j+SIMDSIZE) );
-            SIMDType xmm5( (~C).load(i+2UL,j         ) );
-            SIMDType xmm6( (~C).load(i+2UL,j+SIMDSIZE) );
-            SIMDType xmm7( (~C).load(i+3UL,j         ) );
-            SIMDType xmm8( (~C).load(i+3UL,j+SIMDSIZE) );
-
-            for( size_t k=kbegin; k<kend; ++k ) {
-               const SIMDType a1( set( A(i    ,k) ) );
-               const SIMDType a2( set( A(i+1UL,k) ) );
-               const SIMDType a3( set( A(i+2UL,k) ) );
-               const SIMDType a4( set( A(i+3UL,k) ) );
-               const SIMDType b1( B.load(k,j         ) );
-               const SIMDType b2( B.load(k,j+SIMDSIZE) );
-               xmm1 += a1 * b1;
-               xmm2 += a1 * b2;
-               xmm3 += a2 * b1;
-               xmm4 += a2 * b2;
-               xmm5 += a3 * b1;
-               xmm6 += a3 * b2;
-               xmm7 += a4 * b1;
-               xmm8 += a4 * b2;
-            }
-
-            (~C).store( i    , j         , xmm1 );
-            (~C).store( i    , j+SIMDSIZE, xmm2 );
-            (~C).store( i+1UL, j         , xmm3 );
-            (~C).store( i+1UL, j+SIMDSIZE, xmm4 );
-            (~C).store( i+2UL, j         , xmm5 );
-            (~C).store( i+2UL, j+SIMDSIZE, xmm6 );
-            (~C).store( i+3UL, j         , xmm7 );
-            (~C).store( i+3UL, j+SIMDSIZE, xmm8 );
-         }
-
-         for( ; (i+3UL) <= iend; i+=3UL )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsLower_v<MT4> )
-                               ?( ( IsUpper_v<MT5> )
-                                  ?( min( ( IsStrictlyLower_v<MT4> ? i+2UL : i+3UL ), j+SIMDSIZE*2UL, K ) )
-                                  :( IsStrictlyLower_v<MT4> ? i+2UL : i+3UL ) )
-                               :( IsUpper_v<MT5> ? min( j+SIMDSIZE*2UL, K ) : K ) );
-
-            SIMDType xmm1( (~C).load(i    ,j         ) );
-            SIMDType xmm2( (~C).load(i    ,j+SIMDSIZE) );
-            SIMDType xmm3( (~C).load(i+1UL,j         ) );
-            SIMDType xmm4( (~C).load(i+1UL,j+SIMDSIZE) );
-            SIMDType xmm5( (~C).load(i+2UL,j         ) );
-            SIMDType xmm6( (~C).load(i+2UL,j+SIMDSIZE) );
-
-            for( size_t k=kbegin; k<kend; ++k ) {
-               const SIMDType a1( set( A(i    ,k) ) );
-               const SIMDType a2( set( A(i+1UL,k) ) );
-               const SIMDType a3( set( A(i+2UL,k) ) );
-               const SIMDType b1( B.load(k,j         ) );
-               const SIMDType b2( B.load(k,j+SIMDSIZE) );
-               xmm1 += a1 * b1;
-               xmm2 += a1 * b2;
-               xmm3 += a2 * b1;
-               xmm4 += a2 * b2;
-               xmm5 += a3 * b1;
-               xmm6 += a3 * b2;
-            }
-
-            (~C).store( i    , j         , xmm1 );
-            (~C).store( i    , j+SIMDSIZE, xmm2 );
-            (~C).store( i+1UL, j         , xmm3 );
-            (~C).store( i+1UL, j+SIMDSIZE, xmm4 );
-            (~C).store( i+2UL, j         , xmm5 );
-            (~C).store( i+2UL, j+SIMDSIZE, xmm6 );
-         }
-
-         for( ; (i+2UL) <= iend; i+=2UL )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsLower_v<MT4> )
-                               ?( ( IsUpper_v<MT5> )
-                                  ?( min( ( IsStrictlyLower_v<MT4> ? i+1UL : i+2UL ), j+SIMDSIZE*2UL, K ) )
-                                  :( IsStrictlyLower_v<MT4> ? i+1UL : i+2UL ) )
-                               :( IsUpper_v<MT5> ? min( j+SIMDSIZE*2UL, K ) : K ) );
-
-            SIMDType xmm1( (~C).load(i    ,j         ) );
-            SIMDType xmm2( (~C).load(i    ,j+SIMDSIZE) );
-            SIMDType xmm3( (~C).load(i+1UL,j         ) );
-            SIMDType xmm4( (~C).load(i+1UL,j+SIMDSIZE) );
-            SIMDType xmm5, xmm6, xmm7, xmm8;
-            size_t k( kbegin );
-
-            for( ; (k+2UL) <= kend; k+=2UL ) {
-               const SIMDType a1( set( A(i    ,k    ) ) );
-               const SIMDType a2( set( A(i+1UL,k    ) ) );
-               const SIMDType a3( set( A(i    ,k+1UL) ) );
-               const SIMDType a4( set( A(i+1UL,k+1UL) ) );
-               const SIMDType b1( B.load(k    ,j         ) );
-               const SIMDType b2( B.load(k    ,j+SIMDSIZE) );
-               const SIMDType b3( B.load(k+1UL,j         ) );
-               const SIMDType b4( B.load(k+1UL,j+SIMDSIZE) );
-               xmm1 += a1 * b1;
-               xmm2 += a1 * b2;
-               xmm3 += a2 * b1;
-               xmm4 += a2 * b2;
-               xmm5 += a3 * b3;
-               xmm6 += a3 * b4;
-               xmm7 += a4 * b3;
-               xmm8 += a4 * b4;
-            }
-
-            for( ; k<kend; ++k ) {
-               const SIMDType a1( set( A(i    ,k) ) );
-               const SIMDType a2( set( A(i+1UL,k) ) );
-               const SIMDType b1( B.load(k,j         ) );
-               const SIMDType b2( B.load(k,j+SIMDSIZE) );
-               xmm1 += a1 * b1;
-               xmm2 += a1 * b2;
-               xmm3 += a2 * b1;
-               xmm4 += a2 * b2;
-            }
-
-            (~C).store( i    , j         , xmm1+xmm5 );
-            (~C).store( i    , j+SIMDSIZE, xmm2+xmm6 );
-            (~C).store( i+1UL, j         , xmm3+xmm7 );
-            (~C).store( i+1UL, j+SIMDSIZE, xmm4+xmm8 );
-         }
-
-         if( i < iend )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsUpper_v<MT5> )?( min( j+SIMDSIZE*2UL, K ) ):( K ) );
-
-            SIMDType xmm1( (~C).load(i,j         ) );
-            SIMDType xmm2( (~C).load(i,j+SIMDSIZE) );
-            SIMDType xmm3, xmm4;
-            size_t k( kbegin );
-
-            for( ; (k+2UL) <= kend; k+=2UL ) {
-               const SIMDType a1( set( A(i,k    ) ) );
-               const SIMDType a2( set( A(i,k+1UL) ) );
-               xmm1 += a1 * B.load(k    ,j         );
-               xmm2 += a1 * B.load(k    ,j+SIMDSIZE);
-               xmm3 += a2 * B.load(k+1UL,j         );
-               xmm4 += a2 * B.load(k+1UL,j+SIMDSIZE);
-            }
-
-            for( ; k<kend; ++k ) {
-               const SIMDType a1( set( A(i,k) ) );
-               xmm1 += a1 * B.load(k,j         );
-               xmm2 += a1 * B.load(k,j+SIMDSIZE);
-            }
-
-            (~C).store( i, j         , xmm1+xmm3 );
-            (~C).store( i, j+SIMDSIZE, xmm2+xmm4 );
-         }
-      }
-
-      for( ; j<jpos; j+=SIMDSIZE )
-      {
-         const size_t iend( LOW && UPP ? min(j+SIMDSIZE,M) : M );
-         size_t i( LOW ? j : 0UL );
-
-         for( ; (i+4UL) <= iend; i+=4UL )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsLower_v<MT4> )
-                               ?( IsStrictlyLower_v<MT4> ? i+3UL : i+4UL )
-                               :( K ) );
-
-            SIMDType xmm1( (~C).load(i    ,j) );
-            SIMDType xmm2( (~C).load(i+1UL,j) );
-            SIMDType xmm3( (~C).load(i+2UL,j) );
-            SIMDType xmm4( (~C).load(i+3UL,j) );
-            SIMDType xmm5, xmm6, xmm7, xmm8;
-            size_t k( kbegin );
-
-            for( ; (k+2UL) <= kend; k+=2UL ) {
-               const SIMDType b1( B.load(k    ,j) );
-               const SIMDType b2( B.load(k+1UL,j) );
-               xmm1 += set( A(i    ,k    ) ) * b1;
-               xmm2 += set( A(i+1UL,k    ) ) * b1;
-               xmm3 += set( A(i+2UL,k    ) ) * b1;
-               xmm4 += set( A(i+3UL,k    ) ) * b1;
-               xmm5 += set( A(i    ,k+1UL) ) * b2;
-               xmm6 += set( A(i+1UL,k+1UL) ) * b2;
-               xmm7 += set( A(i+2UL,k+1UL) ) * b2;
-               xmm8 += set( A(i+3UL,k+1UL) ) * b2;
-            }
-
-            for( ; k<kend; ++k ) {
-               const SIMDType b1( B.load(k,j) );
-               xmm1 += set( A(i    ,k) ) * b1;
-               xmm2 += set( A(i+1UL,k) ) * b1;
-               xmm3 += set( A(i+2UL,k) ) * b1;
-               xmm4 += set( A(i+3UL,k) ) * b1;
-            }
-
-            (~C).store( i    , j, xmm1+xmm5 );
-            (~C).store( i+1UL, j, xmm2+xmm6 );
-            (~C).store( i+2UL, j, xmm3+xmm7 );
-            (~C).store( i+3UL, j, xmm4+xmm8 );
-         }
-
-         for( ; (i+3UL) <= iend; i+=3UL )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsLower_v<MT4> )
-                               ?( IsStrictlyLower_v<MT4> ? i+2UL : i+3UL )
-                               :( K ) );
-
-            SIMDType xmm1( (~C).load(i    ,j) );
-            SIMDType xmm2( (~C).load(i+1UL,j) );
-            SIMDType xmm3( (~C).load(i+2UL,j) );
-            SIMDType xmm4, xmm5, xmm6;
-            size_t k( kbegin );
-
-            for( ; (k+2UL) <= kend; k+=2UL ) {
-               const SIMDType b1( B.load(k    ,j) );
-               const SIMDType b2( B.load(k+1UL,j) );
-               xmm1 += set( A(i    ,k    ) ) * b1;
-               xmm2 += set( A(i+1UL,k    ) ) * b1;
-               xmm3 += set( A(i+2UL,k    ) ) * b1;
-               xmm4 += set( A(i    ,k+1UL) ) * b2;
-               xmm5 += set( A(i+1UL,k+1UL) ) * b2;
-               xmm6 += set( A(i+2UL,k+1UL) ) * b2;
-            }
-
-            for( ; k<kend; ++k ) {
-               const SIMDType b1( B.load(k,j) );
-               xmm1 += set( A(i    ,k) ) * b1;
-               xmm2 += set( A(i+1UL,k) ) * b1;
-               xmm3 += set( A(i+2UL,k) ) * b1;
-            }
-
-            (~C).store( i    , j, xmm1+xmm4 );
-            (~C).store( i+1UL, j, xmm2+xmm5 );
-            (~C).store( i+2UL, j, xmm3+xmm6 );
-         }
-
-         for( ; (i+2UL) <= iend; i+=2UL )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsLower_v<MT4> )
-                               ?( IsStrictlyLower_v<MT4> ? i+1UL : i+2UL )
-                               :( K ) );
-
-            SIMDType xmm1( (~C).load(i    ,j) );
-            SIMDType xmm2( (~C).load(i+1UL,j) );
-            SIMDType xmm3, xmm4;
-            size_t k( kbegin );
-
-            for( ; (k+2UL) <= kend; k+=2UL ) {
-               const SIMDType b1( B.load(k    ,j) );
-               const SIMDType b2( B.load(k+1UL,j) );
-               xmm1 += set( A(i    ,k    ) ) * b1;
-               xmm2 += set( A(i+1UL,k    ) ) * b1;
-               xmm3 += set( A(i    ,k+1UL) ) * b2;
-               xmm4 += set( A(i+1UL,k+1UL) ) * b2;
-            }
-
-            for( ; k<kend; ++k ) {
-               const SIMDType b1( B.load(k,j) );
-               xmm1 += set( A(i    ,k) ) * b1;
-               xmm2 += set( A(i+1UL,k) ) * b1;
-            }
-
-            (~C).store( i    , j, xmm1+xmm3 );
-            (~C).store( i+1UL, j, xmm2+xmm4 );
-         }
-
-         if( i < iend )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-
-            SIMDType xmm1( (~C).load(i,j) );
-            SIMDType xmm2;
-            size_t k( kbegin );
-
-            for( ; (k+2UL) <= K; k+=2UL ) {
-               xmm1 += set( A(i,k    ) ) * B.load(k    ,j);
-               xmm2 += set( A(i,k+1UL) ) * B.load(k+1UL,j);
-            }
-
-            for( ; k<K; ++k ) {
-               xmm1 += set( A(i,k) ) * B.load(k,j);
-            }
-
-            (~C).store( i, j, xmm1+xmm2 );
-         }
-      }
-
-      for( ; remainder && j<N; ++j )
-      {
-         const size_t iend( UPP ? j+1UL : M );
-         size_t i( LOW ? j : 0UL );
-
-         for( ; (i+2UL) <= iend; i+=2UL )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsLower_v<MT4> )
-                               ?( IsStrictlyLower_v<MT4> ? i+1UL : i+2UL )
-                               :( K ) );
-
-            ElementType value1( (~C)(i    ,j) );
-            ElementType value2( (~C)(i+1UL,j) );;
-
-            for( size_t k=kbegin; k<kend; ++k ) {
-               value1 += A(i    ,k) * B(k,j);
-               value2 += A(i+1UL,k) * B(k,j);
-            }
-
-            (~C)(i    ,j) = value1;
-            (~C)(i+1UL,j) = value2;
-         }
-
-         if( i < iend )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-
-            ElementType value( (~C)(i,j) );
-
-            for( size_t k=kbegin; k<K; ++k ) {
-               value += A(i,k) * B(k,j);
-            }
-
-            (~C)(i,j) = value;
-         }
-      }
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**Default addition assignment to dense tensors (large tensors)******************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Default addition assignment of a large dense tensor-dense tensor multiplication
-   //        (\f$ C+=A*B \f$).
-   // \ingroup dense_tensor
-   //
-   // \param C The target left-hand side dense tensor.
-   // \param A The left-hand side multiplication operand.
-   // \param B The right-hand side multiplication operand.
-   // \return void
-   //
-   // This function relays to the default implementation of the addition assignment of a dense
-   // tensor-dense tensor multiplication expression to a dense tensor.
-   */
-   template< typename MT3    // Type of the left-hand side target tensor
-           , typename MT4    // Type of the left-hand side tensor operand
-           , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline EnableIf_t< !UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
-      selectLargeAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
-   {
-      selectDefaultAddAssignKernel( C, A, B );
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**Vectorized default addition assignment to dense tensors (large tensors)*******************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Vectorized default addition assignment of a large dense tensor-dense tensor
-   //        multiplication (\f$ C+=A*B \f$).
-   // \ingroup dense_tensor
-   //
-   // \param C The target left-hand side dense tensor.
-   // \param A The left-hand side multiplication operand.
-   // \param B The right-hand side multiplication operand.
-   // \return void
-   //
-   // This function implements the vectorized default addition assignment of a dense tensor-
-   // dense tensor multiplication expression to a dense tensor. This kernel is optimized for
-   // large tensors.
-   */
-   template< typename MT3    // Type of the left-hand side target tensor
-           , typename MT4    // Type of the left-hand side tensor operand
-           , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline EnableIf_t< UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
-      selectLargeAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
-   {
-      if( LOW )
-         lmmm( C, A, B, ElementType(1), ElementType(1) );
-      else if( UPP )
-         ummm( C, A, B, ElementType(1), ElementType(1) );
-      else
-         mmm( C, A, B, ElementType(1), ElementType(1) );
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**BLAS-based addition assignment to dense tensors (default)**********************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Default addition assignment of a dense tensor-dense tensor multiplication
-   //        (\f$ C+=A*B \f$).
-   // \ingroup dense_tensor
-   //
-   // \param C The target left-hand side dense tensor.
-   // \param A The left-hand side multiplication operand.
-   // \param B The right-hand side multiplication operand.
-   // \return void
-   //
-   // This function relays to the default implementation of the addition assignment of a large
-   // dense tensor-dense tensor multiplication expression to a dense tensor.
-   */
-   template< typename MT3    // Type of the left-hand side target tensor
-           , typename MT4    // Type of the left-hand side tensor operand
-           , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline EnableIf_t< !UseBlasKernel_v<MT3,MT4,MT5> >
-      selectBlasAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
-   {
-      selectLargeAddAssignKernel( C, A, B );
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**BLAS-based addition assignment to dense tensors********************************************
-#if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_MATRIX_MATRIX_MULTIPLICATION
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief BLAS-based addition assignment of a dense tensor-dense tensor multiplication
-   //        (\f$ C+=A*B \f$).
-   // \ingroup dense_tensor
-   //
-   // \param C The target left-hand side dense tensor.
-   // \param A The left-hand side multiplication operand.
-   // \param B The right-hand side multiplication operand.
-   // \return void
-   //
-   // This function performs the dense tensor-dense tensor multiplication based on the according
-   // BLAS functionality.
-   */
-   template< typename MT3    // Type of the left-hand side target tensor
-           , typename MT4    // Type of the left-hand side tensor operand
-           , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline EnableIf_t< UseBlasKernel_v<MT3,MT4,MT5> >
-      selectBlasAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
-   {
-      using ET = ElementType_t<MT3>;
-
-      if( IsTriangular_v<MT4> ) {
-         ResultType_t<MT3> tmp( serial( B ) );
-         trmm( tmp, A, CblasLeft, ( IsLower_v<MT4> )?( CblasLower ):( CblasUpper ), ET(1) );
-         addAssign( C, tmp );
-      }
-      else if( IsTriangular_v<MT5> ) {
-         ResultType_t<MT3> tmp( serial( A ) );
-         trmm( tmp, B, CblasRight, ( IsLower_v<MT5> )?( CblasLower ):( CblasUpper ), ET(1) );
-         addAssign( C, tmp );
-      }
-      else {
-         gemm( C, A, B, ET(1), ET(1) );
-      }
-   }
-   /*! \endcond */
-#endif
-   //**********************************************************************************************
-
-   //**Subtraction assignment to dense tensors****************************************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Subtraction assignment of a dense tensor-dense tensor multiplication to a
-   //        dense tensor (\f$ C-=A*B \f$).
-   // \ingroup dense_tensor
-   //
-   // \param lhs The target left-hand side dense tensor.
-   // \param rhs The right-hand side multiplication expression to be subtracted.
-   // \return void
-   //
-   // This function implements the performance optimized subtraction assignment of a dense tensor-
-   // dense tensor multiplication expression to a dense tensor.
-   */
-   template< typename MT  // Type of the target dense tensor
-           , bool SO >    // Storage order of the target dense tensor
-   friend inline void
-      subAssign( DenseTensor<MT>& lhs, const DTensDTensMultExpr& rhs )
-   {
-      BLAZE_FUNCTION_TRACE;
-
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
-
-      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL || rhs.lhs_.columns() == 0UL ) {
-         return;
-      }
-
-      LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense tensor operand
-      RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense tensor operand
-
-      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
-      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
-      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
-      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
-      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
-      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
-
-      DTensDTensMultExpr::selectSubAssignKernel( ~lhs, A, B );
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**Subtraction assignment to dense tensors (kernel selection)*********************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Selection of the kernel for a subtraction assignment of a dense tensor-dense tensor
-   //        multiplication to a dense tensor (\f$ C-=A*B \f$).
-   // \ingroup dense_tensor
-   //
-   // \param C The target left-hand side dense tensor.
-   // \param A The left-hand side multiplication operand.
-   // \param B The right-hand side multiplication operand.
-   // \return void
-   */
-   template< typename MT3    // Type of the left-hand side target tensor
-           , typename MT4    // Type of the left-hand side tensor operand
-           , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
-   {
-      if( ( IsDiagonal_v<MT5> ) ||
-          ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
-         selectSmallSubAssignKernel( C, A, B );
-      else
-         selectBlasSubAssignKernel( C, A, B );
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**Default subtraction assignment to dense tensors (general/general)**************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Default subtraction assignment of a general dense tensor-general dense tensor
-   //        multiplication (\f$ C-=A*B \f$).
-   // \ingroup dense_tensor
-   //
-   // \param C The target left-hand side dense tensor.
-   // \param A The left-hand side multiplication operand.
-   // \param B The right-hand side multiplication operand.
-   // \return void
-   //
-   // This function implements the default subtraction assignment of a general dense tensor-
-   // general dense tensor multiplication expression to a dense tensor.
-   */
-   template< typename MT3    // Type of the left-hand side target tensor
-           , typename MT4    // Type of the left-hand side tensor operand
-           , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline EnableIf_t< !IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
-      selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
-   {
-      const size_t M( A.rows()    );
-      const size_t N( B.columns() );
-      const size_t K( A.columns() );
-
-      BLAZE_INTERNAL_ASSERT( !( LOW || UPP ) || ( M == N ), "Broken invariant detected" );
-
-      for( size_t i=0UL; i<M; ++i )
-      {
-         const size_t kbegin( ( IsUpper_v<MT4> )
-                              ?( IsStrictlyUpper_v<MT4> ? i+1UL : i )
-                              :( 0UL ) );
-         const size_t kend( ( IsLower_v<MT4> )
-                            ?( IsStrictlyLower_v<MT4> ? i : i+1UL )
-                            :( K ) );
-         BLAZE_INTERNAL_ASSERT( kbegin <= kend, "Invalid loop indices detected" );
-
-         for( size_t k=kbegin; k<kend; ++k )
-         {
-            const size_t jbegin( ( IsUpper_v<MT5> )
-                                 ?( ( IsStrictlyUpper_v<MT5> )
-                                    ?( UPP ? max(i,k+1UL) : k+1UL )
-                                    :( UPP ? max(i,k) : k ) )
-                                 :( UPP ? i : 0UL ) );
-            const size_t jend( ( IsLower_v<MT5> )
-                               ?( ( IsStrictlyLower_v<MT5> )
-                                  ?( LOW ? min(i+1UL,k) : k )
-                                  :( LOW ? min(i,k)+1UL : k+1UL ) )
-                               :( LOW ? i+1UL : N ) );
-
-            if( ( LOW || UPP ) && ( jbegin >= jend ) ) continue;
-            BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-            const size_t jnum( jend - jbegin );
-            const size_t jpos( jbegin + ( jnum & size_t(-2) ) );
-
-            for( size_t j=jbegin; j<jpos; j+=2UL ) {
-               C(i,j    ) -= A(i,k) * B(k,j    );
-               C(i,j+1UL) -= A(i,k) * B(k,j+1UL);
-            }
-            if( jpos < jend ) {
-               C(i,jpos) -= A(i,k) * B(k,jpos);
-            }
-         }
-      }
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**Default subtraction assignment to dense tensors (general/diagonal)*************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Default subtraction assignment of a general dense tensor-diagonal dense tensor
-   //        multiplication (\f$ C-=A*B \f$).
-   // \ingroup dense_tensor
-   //
-   // \param C The target left-hand side dense tensor.
-   // \param A The left-hand side multiplication operand.
-   // \param B The right-hand side multiplication operand.
-   // \return void
-   //
-   // This function implements the default subtraction assignment of a general dense tensor-
-   // diagonal dense tensor multiplication expression to a dense tensor.
-   */
-   template< typename MT3    // Type of the left-hand side target tensor
-           , typename MT4    // Type of the left-hand side tensor operand
-           , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline EnableIf_t< !IsDiagonal_v<MT4> && IsDiagonal_v<MT5> >
-      selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
-   {
-      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT3 );
-
-      const size_t M( A.rows()    );
-      const size_t N( B.columns() );
-
-      for( size_t i=0UL; i<M; ++i )
-      {
-         const size_t jbegin( ( IsUpper_v<MT4> )
-                              ?( IsStrictlyUpper_v<MT4> ? i+1UL : i )
-                              :( 0UL ) );
-         const size_t jend( ( IsLower_v<MT4> )
-                            ?( IsStrictlyLower_v<MT4> ? i : i+1UL )
-                            :( N ) );
-         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-         const size_t jnum( jend - jbegin );
-         const size_t jpos( jbegin + ( jnum & size_t(-2) ) );
-
-         for( size_t j=jbegin; j<jpos; j+=2UL ) {
-            C(i,j    ) -= A(i,j    ) * B(j    ,j    );
-            C(i,j+1UL) -= A(i,j+1UL) * B(j+1UL,j+1UL);
-         }
-         if( jpos < jend ) {
-            C(i,jpos) -= A(i,jpos) * B(jpos,jpos);
-         }
-      }
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**Default subtraction assignment to dense tensors (diagonal/general)*************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Default subtraction assignment of a diagonal dense tensor-general dense tensor
-   //        multiplication (\f$ C-=A*B \f$).
-   // \ingroup dense_tensor
-   //
-   // \param C The target left-hand side dense tensor.
-   // \param A The left-hand side multiplication operand.
-   // \param B The right-hand side multiplication operand.
-   // \return void
-   //
-   // This function implements the default subtraction assignment of a diagonal dense tensor-
-   // general dense tensor multiplication expression to a dense tensor.
-   */
-   template< typename MT3    // Type of the left-hand side target tensor
-           , typename MT4    // Type of the left-hand side tensor operand
-           , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline EnableIf_t< IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
-      selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
-   {
-      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT3 );
-
-      const size_t M( A.rows()    );
-      const size_t N( B.columns() );
-
-      for( size_t i=0UL; i<M; ++i )
-      {
-         const size_t jbegin( ( IsUpper_v<MT5> )
-                              ?( IsStrictlyUpper_v<MT5> ? i+1UL : i )
-                              :( 0UL ) );
-         const size_t jend( ( IsLower_v<MT5> )
-                            ?( IsStrictlyLower_v<MT5> ? i : i+1UL )
-                            :( N ) );
-         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-         const size_t jnum( jend - jbegin );
-         const size_t jpos( jbegin + ( jnum & size_t(-2) ) );
-
-         for( size_t j=jbegin; j<jpos; j+=2UL ) {
-            C(i,j    ) -= A(i,i) * B(i,j    );
-            C(i,j+1UL) -= A(i,i) * B(i,j+1UL);
-         }
-         if( jpos < jend ) {
-            C(i,jpos) -= A(i,i) * B(i,jpos);
-         }
-      }
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**Default subtraction assignment to dense tensors (diagonal/diagonal)************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Default subtraction assignment of a diagonal dense tensor-diagonal dense tensor
-   //        multiplication (\f$ C-=A*B \f$).
-   // \ingroup dense_tensor
-   //
-   // \param C The target left-hand side dense tensor.
-   // \param A The left-hand side multiplication operand.
-   // \param B The right-hand side multiplication operand.
-   // \return void
-   //
-   // This function implements the default subtraction assignment of a diagonal dense tensor-
-   // diagonal dense tensor multiplication expression to a dense tensor.
-   */
-   template< typename MT3    // Type of the left-hand side target tensor
-           , typename MT4    // Type of the left-hand side tensor operand
-           , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline EnableIf_t< IsDiagonal_v<MT4> && IsDiagonal_v<MT5> >
-      selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
-   {
-      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT3 );
-
-      for( size_t i=0UL; i<A.rows(); ++i ) {
-         C(i,i) -= A(i,i) * B(i,i);
-      }
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**Default subtraction assignment to dense tensors (small tensors)***************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Default subtraction assignment of a small dense tensor-dense tensor multiplication
-   //        (\f$ C-=A*B \f$).
-   // \ingroup dense_tensor
-   //
-   // \param C The target left-hand side dense tensor.
-   // \param A The left-hand side multiplication operand.
-   // \param B The right-hand side multiplication operand.
-   // \return void
-   //
-   // This function relays to the default implementation of the subtraction assignment of a dense
-   // tensor-dense tensor multiplication expression to a dense tensor.
-   */
-   template< typename MT3    // Type of the left-hand side target tensor
-           , typename MT4    // Type of the left-hand side tensor operand
-           , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline EnableIf_t< !UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
-      selectSmallSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
-   {
-      selectDefaultSubAssignKernel( C, A, B );
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**Vectorized default subtraction assignment to row-major dense tensors (small tensors)******
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Vectorized default subtraction assignment of a small dense tensor-dense tensor
-   //        multiplication (\f$ C-=A*B \f$).
-   // \ingroup dense_tensor
-   //
-   // \param C The target left-hand side dense tensor.
-   // \param A The left-hand side multiplication operand.
-   // \param B The right-hand side multiplication operand.
-   // \return void
-   //
-   // This function implements the vectorized default subtraction assignment of a dense tensor-
-   // dense tensor multiplication expression to a row-major dense tensor. This kernel is optimized
-   // for small tensors.
-   */
-   template< typename MT3    // Type of the left-hand side target tensor
-           , typename MT4    // Type of the left-hand side tensor operand
-           , typename MT5 >  // Type of the right-hand side tensor operand
-   static inline EnableIf_t< UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
-      selectSmallSubAssignKernel( DenseTensor<MT3>& C, const MT4& A, const MT5& B )
-   {
-      constexpr bool remainder( !IsPadded_v<MT3> || !IsPadded_v<MT5> );
-
-      const size_t M( A.rows()    );
-      const size_t N( B.columns() );
-      const size_t K( A.columns() );
-
-      BLAZE_INTERNAL_ASSERT( !( LOW || UPP ) || ( M == N ), "Broken invariant detected" );
-
-      const size_t jpos( remainder ? ( N & size_t(-SIMDSIZE) ) : N );
-      BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
-
-      size_t j( 0UL );
-
-      if( IsIntegral_v<ElementType> )
-      {
-         for( ; !LOW && !UPP && (j+SIMDSIZE*7UL) < jpos; j+=SIMDSIZE*8UL ) {
-            for( size_t i=0UL; i<M; ++i )
-            {
-               const size_t kbegin( ( IsUpper_v<MT4> )
-                                    ?( ( IsLower_v<MT5> )
-                                       ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                       :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                    :( IsLower_v<MT5> ? j : 0UL ) );
-               const size_t kend( ( IsLower_v<MT4> )
-                                  ?( ( IsUpper_v<MT5> )
-                                     ?( min( ( IsStrictlyLower_v<MT4> ? i : i+1UL ), j+SIMDSIZE*8UL, K ) )
-                                     :( IsStrictlyLower_v<MT4> ? i : i+1UL ) )
-                                  :( IsUpper_v<MT5> ? min( j+SIMDSIZE*8UL, K ) : K ) );
-
-               SIMDType xmm1( (~C).load(i,j             ) );
-               SIMDType xmm2( (~C).load(i,j+SIMDSIZE    ) );
-               SIMDType xmm3( (~C).load(i,j+SIMDSIZE*2UL) );
-               SIMDType xmm4( (~C).load(i,j+SIMDSIZE*3UL) );
-               SIMDType xmm5( (~C).load(i,j+SIMDSIZE*4UL) );
-               SIMDType xmm6( (~C).load(i,j+SIMDSIZE*5UL) );
-               SIMDType xmm7( (~C).load(i,j+SIMDSIZE*6UL) );
-               SIMDType xmm8( (~C).load(i,j+SIMDSIZE*7UL) );
-
-               for( size_t k=kbegin; k<kend; ++k ) {
-                  const SIMDType a1( set( A(i,k) ) );
-                  xmm1 -= a1 * B.load(k,j             );
-                  xmm2 -= a1 * B.load(k,j+SIMDSIZE    );
-                  xmm3 -= a1 * B.load(k,j+SIMDSIZE*2UL);
-                  xmm4 -= a1 * B.load(k,j+SIMDSIZE*3UL);
-                  xmm5 -= a1 * B.load(k,j+SIMDSIZE*4UL);
-                  xmm6 -= a1 * B.load(k,j+SIMDSIZE*5UL);
-                  xmm7 -= a1 * B.load(k,j+SIMDSIZE*6UL);
-                  xmm8 -= a1 * B.load(k,j+SIMDSIZE*7UL);
-               }
-
-               (~C).store( i, j             , xmm1 );
-               (~C).store( i, j+SIMDSIZE    , xmm2 );
-               (~C).store( i, j+SIMDSIZE*2UL, xmm3 );
-               (~C).store( i, j+SIMDSIZE*3UL, xmm4 );
-               (~C).store( i, j+SIMDSIZE*4UL, xmm5 );
-               (~C).store( i, j+SIMDSIZE*5UL, xmm6 );
-               (~C).store( i, j+SIMDSIZE*6UL, xmm7 );
-               (~C).store( i, j+SIMDSIZE*7UL, xmm8 );
-            }
-         }
-      }
-
-      for( ; !LOW && !UPP && (j+SIMDSIZE*4UL) < jpos; j+=SIMDSIZE*5UL )
-      {
-         size_t i( 0UL );
-
-         for( ; (i+2UL) <= M; i+=2UL )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsLower_v<MT4> )
-                               ?( ( IsUpper_v<MT5> )
-                                  ?( min( ( IsStrictlyLower_v<MT4> ? i+1UL : i+2UL ), j+SIMDSIZE*5UL, K ) )
-                                  :( IsStrictlyLower_v<MT4> ? i+1UL : i+2UL ) )
-                               :( IsUpper_v<MT5> ? min( j+SIMDSIZE*5UL, K ) : K ) );
-
-            SIMDType xmm1 ( (~C).load(i    ,j             ) );
-            SIMDType xmm2 ( (~C).load(i    ,j+SIMDSIZE    ) );
-            SIMDType xmm3 ( (~C).load(i    ,j+SIMDSIZE*2UL) );
-            SIMDType xmm4 ( (~C).load(i    ,j+SIMDSIZE*3UL) );
-            SIMDType xmm5 ( (~C).load(i    ,j+SIMDSIZE*4UL) );
-            SIMDType xmm6 ( (~C).load(i+1UL,j             ) );
-            SIMDType xmm7 ( (~C).load(i+1UL,j+SIMDSIZE    ) );
-            SIMDType xmm8 ( (~C).load(i+1UL,j+SIMDSIZE*2UL) );
-            SIMDType xmm9 ( (~C).load(i+1UL,j+SIMDSIZE*3UL) );
-            SIMDType xmm10( (~C).load(i+1UL,j+SIMDSIZE*4UL) );
-
-            for( size_t k=kbegin; k<kend; ++k ) {
-               const SIMDType a1( set( A(i    ,k) ) );
-               const SIMDType a2( set( A(i+1UL,k) ) );
-               const SIMDType b1( B.load(k,j             ) );
-               const SIMDType b2( B.load(k,j+SIMDSIZE    ) );
-               const SIMDType b3( B.load(k,j+SIMDSIZE*2UL) );
-               const SIMDType b4( B.load(k,j+SIMDSIZE*3UL) );
-               const SIMDType b5( B.load(k,j+SIMDSIZE*4UL) );
-               xmm1  -= a1 * b1;
-               xmm2  -= a1 * b2;
-               xmm3  -= a1 * b3;
-               xmm4  -= a1 * b4;
-               xmm5  -= a1 * b5;
-               xmm6  -= a2 * b1;
-               xmm7  -= a2 * b2;
-               xmm8  -= a2 * b3;
-               xmm9  -= a2 * b4;
-               xmm10 -= a2 * b5;
-            }
-
-            (~C).store( i    , j             , xmm1  );
-            (~C).store( i    , j+SIMDSIZE    , xmm2  );
-            (~C).store( i    , j+SIMDSIZE*2UL, xmm3  );
-            (~C).store( i    , j+SIMDSIZE*3UL, xmm4  );
-            (~C).store( i    , j+SIMDSIZE*4UL, xmm5  );
-            (~C).store( i+1UL, j             , xmm6  );
-            (~C).store( i+1UL, j+SIMDSIZE    , xmm7  );
-            (~C).store( i+1UL, j+SIMDSIZE*2UL, xmm8  );
-            (~C).store( i+1UL, j+SIMDSIZE*3UL, xmm9  );
-            (~C).store( i+1UL, j+SIMDSIZE*4UL, xmm10 );
-         }
-
-         if( i < M )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsUpper_v<MT5> )?( min( j+SIMDSIZE*5UL, K ) ):( K ) );
-
-            SIMDType xmm1( (~C).load(i,j             ) );
-            SIMDType xmm2( (~C).load(i,j+SIMDSIZE    ) );
-            SIMDType xmm3( (~C).load(i,j+SIMDSIZE*2UL) );
-            SIMDType xmm4( (~C).load(i,j+SIMDSIZE*3UL) );
-            SIMDType xmm5( (~C).load(i,j+SIMDSIZE*4UL) );
-
-            for( size_t k=kbegin; k<kend; ++k ) {
-               const SIMDType a1( set( A(i,k) ) );
-               xmm1 -= a1 * B.load(k,j             );
-               xmm2 -= a1 * B.load(k,j+SIMDSIZE    );
-               xmm3 -= a1 * B.load(k,j+SIMDSIZE*2UL);
-               xmm4 -= a1 * B.load(k,j+SIMDSIZE*3UL);
-               xmm5 -= a1 * B.load(k,j+SIMDSIZE*4UL);
-            }
-
-            (~C).store( i, j             , xmm1 );
-            (~C).store( i, j+SIMDSIZE    , xmm2 );
-            (~C).store( i, j+SIMDSIZE*2UL, xmm3 );
-            (~C).store( i, j+SIMDSIZE*3UL, xmm4 );
-            (~C).store( i, j+SIMDSIZE*4UL, xmm5 );
-         }
-      }
-
-      for( ; !LOW && !UPP && (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL )
-      {
-         size_t i( 0UL );
-
-         for( ; (i+2UL) <= M; i+=2UL )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsLower_v<MT4> )
-                               ?( ( IsUpper_v<MT5> )
-                                  ?( min( ( IsStrictlyLower_v<MT4> ? i+1UL : i+2UL ), j+SIMDSIZE*4UL, K ) )
-                                  :( IsStrictlyLower_v<MT4> ? i+1UL : i+2UL ) )
-                               :( IsUpper_v<MT5> ? min( j+SIMDSIZE*4UL, K ) : K ) );
-
-            SIMDType xmm1( (~C).load(i    ,j             ) );
-            SIMDType xmm2( (~C).load(i    ,j+SIMDSIZE    ) );
-            SIMDType xmm3( (~C).load(i    ,j+SIMDSIZE*2UL) );
-            SIMDType xmm4( (~C).load(i    ,j+SIMDSIZE*3UL) );
-            SIMDType xmm5( (~C).load(i+1UL,j             ) );
-            SIMDType xmm6( (~C).load(i+1UL,j+SIMDSIZE    ) );
-            SIMDType xmm7( (~C).load(i+1UL,j+SIMDSIZE*2UL) );
-            SIMDType xmm8( (~C).load(i+1UL,j+SIMDSIZE*3UL) );
-
-            for( size_t k=kbegin; k<kend; ++k ) {
-               const SIMDType a1( set( A(i    ,k) ) );
-               const SIMDType a2( set( A(i+1UL,k) ) );
-               const SIMDType b1( B.load(k,j             ) );
-               const SIMDType b2( B.load(k,j+SIMDSIZE    ) );
-               const SIMDType b3( B.load(k,j+SIMDSIZE*2UL) );
-               const SIMDType b4( B.load(k,j+SIMDSIZE*3UL) );
-               xmm1 -= a1 * b1;
-               xmm2 -= a1 * b2;
-               xmm3 -= a1 * b3;
-               xmm4 -= a1 * b4;
-               xmm5 -= a2 * b1;
-               xmm6 -= a2 * b2;
-               xmm7 -= a2 * b3;
-               xmm8 -= a2 * b4;
-            }
-
-            (~C).store( i    , j             , xmm1 );
-            (~C).store( i    , j+SIMDSIZE    , xmm2 );
-            (~C).store( i    , j+SIMDSIZE*2UL, xmm3 );
-            (~C).store( i    , j+SIMDSIZE*3UL, xmm4 );
-            (~C).store( i+1UL, j             , xmm5 );
-            (~C).store( i+1UL, j+SIMDSIZE    , xmm6 );
-            (~C).store( i+1UL, j+SIMDSIZE*2UL, xmm7 );
-            (~C).store( i+1UL, j+SIMDSIZE*3UL, xmm8 );
-         }
-
-         if( i < M )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsUpper_v<MT5> )?( min( j+SIMDSIZE*4UL, K ) ):( K ) );
-
-            SIMDType xmm1( (~C).load(i,j             ) );
-            SIMDType xmm2( (~C).load(i,j+SIMDSIZE    ) );
-            SIMDType xmm3( (~C).load(i,j+SIMDSIZE*2UL) );
-            SIMDType xmm4( (~C).load(i,j+SIMDSIZE*3UL) );
-
-            for( size_t k=kbegin; k<kend; ++k ) {
-               const SIMDType a1( set( A(i,k) ) );
-               xmm1 -= a1 * B.load(k,j             );
-               xmm2 -= a1 * B.load(k,j+SIMDSIZE    );
-               xmm3 -= a1 * B.load(k,j+SIMDSIZE*2UL);
-               xmm4 -= a1 * B.load(k,j+SIMDSIZE*3UL);
-            }
-
-            (~C).store( i, j             , xmm1 );
-            (~C).store( i, j+SIMDSIZE    , xmm2 );
-            (~C).store( i, j+SIMDSIZE*2UL, xmm3 );
-            (~C).store( i, j+SIMDSIZE*3UL, xmm4 );
-         }
-      }
-
-      for( ; !LOW && !UPP && (j+SIMDSIZE*2UL) < jpos; j+=SIMDSIZE*3UL )
-      {
-         size_t i( 0UL );
-
-         for( ; (i+2UL) <= M; i+=2UL )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsLower_v<MT4> )
-                               ?( ( IsUpper_v<MT5> )
-                                  ?( min( ( IsStrictlyLower_v<MT4> ? i+1UL : i+2UL ), j+SIMDSIZE*3UL, K ) )
-                                  :( IsStrictlyLower_v<MT4> ? i+1UL : i+2UL ) )
-                               :( IsUpper_v<MT5> ? min( j+SIMDSIZE*3UL, K ) : K ) );
-
-            SIMDType xmm1( (~C).load(i    ,j             ) );
-            SIMDType xmm2( (~C).load(i    ,j+SIMDSIZE    ) );
-            SIMDType xmm3( (~C).load(i    ,j+SIMDSIZE*2UL) );
-            SIMDType xmm4( (~C).load(i+1UL,j             ) );
-            SIMDType xmm5( (~C).load(i+1UL,j+SIMDSIZE    ) );
-            SIMDType xmm6( (~C).load(i+1UL,j+SIMDSIZE*2UL) );
-
-            for( size_t k=kbegin; k<kend; ++k ) {
-               const SIMDType a1( set( A(i    ,k) ) );
-               const SIMDType a2( set( A(i+1UL,k) ) );
-               const SIMDType b1( B.load(k,j             ) );
-               const SIMDType b2( B.load(k,j+SIMDSIZE    ) );
-               const SIMDType b3( B.load(k,j+SIMDSIZE*2UL) );
-               xmm1 -= a1 * b1;
-               xmm2 -= a1 * b2;
-               xmm3 -= a1 * b3;
-               xmm4 -= a2 * b1;
-               xmm5 -= a2 * b2;
-               xmm6 -= a2 * b3;
-            }
-
-            (~C).store( i    , j             , xmm1 );
-            (~C).store( i    , j+SIMDSIZE    , xmm2 );
-            (~C).store( i    , j+SIMDSIZE*2UL, xmm3 );
-            (~C).store( i+1UL, j             , xmm4 );
-            (~C).store( i+1UL, j+SIMDSIZE    , xmm5 );
-            (~C).store( i+1UL, j+SIMDSIZE*2UL, xmm6 );
-         }
-
-         if( i < M )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsUpper_v<MT5> )?( min( j+SIMDSIZE*3UL, K ) ):( K ) );
-
-            SIMDType xmm1( (~C).load(i,j             ) );
-            SIMDType xmm2( (~C).load(i,j+SIMDSIZE    ) );
-            SIMDType xmm3( (~C).load(i,j+SIMDSIZE*2UL) );
-
-            for( size_t k=kbegin; k<kend; ++k ) {
-               const SIMDType a1( set( A(i,k) ) );
-               xmm1 -= a1 * B.load(k,j             );
-               xmm2 -= a1 * B.load(k,j+SIMDSIZE    );
-               xmm3 -= a1 * B.load(k,j+SIMDSIZE*2UL);
-            }
-
-            (~C).store( i, j             , xmm1 );
-            (~C).store( i, j+SIMDSIZE    , xmm2 );
-            (~C).store( i, j+SIMDSIZE*2UL, xmm3 );
-         }
-      }
-
-      for( ; !( LOW && UPP ) && (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL )
-      {
-         const size_t iend( UPP ? min(j+SIMDSIZE*2UL,M) : M );
-         size_t i( LOW ? j : 0UL );
-
-         for( ; (i+4UL) <= iend; i+=4UL )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsLower_v<MT4> )
-                               ?( ( IsUpper_v<MT5> )
-                                  ?( min( ( IsStrictlyLower_v<MT4> ? i+3UL : i+4UL ), j+SIMDSIZE*2UL, K ) )
-                                  :( IsStrictlyLower_v<MT4> ? i+3UL : i+4UL ) )
-                               :( IsUpper_v<MT5> ? min( j+SIMDSIZE*2UL, K ) : K ) );
-
-            SIMDType xmm1( (~C).load(i    ,j         ) );
-            SIMDType xmm2( (~C).load(i    ,j+SIMDSIZE) );
-            SIMDType xmm3( (~C).load(i+1UL,j         ) );
-            SIMDType xmm4( (~C).load(i+1UL,j+SIMDSIZE) );
-            SIMDType xmm5( (~C).load(i+2UL,j         ) );
-            SIMDType xmm6( (~C).load(i+2UL,j+SIMDSIZE) );
-            SIMDType xmm7( (~C).load(i+3UL,j         ) );
-            SIMDType xmm8( (~C).load(i+3UL,j+SIMDSIZE) );
-
-            for( size_t k=kbegin; k<kend; ++k ) {
-               const SIMDType a1( set( A(i    ,k) ) );
-               const SIMDType a2( set( A(i+1UL,k) ) );
-               const SIMDType a3( set( A(i+2UL,k) ) );
-               const SIMDType a4( set( A(i+3UL,k) ) );
-               const SIMDType b1( B.load(k,j         ) );
-               const SIMDType b2( B.load(k,j+SIMDSIZE) );
-               xmm1 -= a1 * b1;
-               xmm2 -= a1 * b2;
-               xmm3 -= a2 * b1;
-               xmm4 -= a2 * b2;
-               xmm5 -= a3 * b1;
-               xmm6 -= a3 * b2;
-               xmm7 -= a4 * b1;
-               xmm8 -= a4 * b2;
-            }
-
-            (~C).store( i    , j         , xmm1 );
-            (~C).store( i    , j+SIMDSIZE, xmm2 );
-            (~C).store( i+1UL, j         , xmm3 );
-            (~C).store( i+1UL, j+SIMDSIZE, xmm4 );
-            (~C).store( i+2UL, j         , xmm5 );
-            (~C).store( i+2UL, j+SIMDSIZE, xmm6 );
-            (~C).store( i+3UL, j         , xmm7 );
-            (~C).store( i+3UL, j+SIMDSIZE, xmm8 );
-         }
-
-         for( ; (i+3UL) <= iend; i+=3UL )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsLower_v<MT4> )
-                               ?( ( IsUpper_v<MT5> )
-                                  ?( min( ( IsStrictlyLower_v<MT4> ? i+2UL : i+3UL ), j+SIMDSIZE*2UL, K ) )
-                                  :( IsStrictlyLower_v<MT4> ? i+2UL : i+3UL ) )
-                               :( IsUpper_v<MT5> ? min( j+SIMDSIZE*2UL, K ) : K ) );
-
-            SIMDType xmm1( (~C).load(i    ,j         ) );
-            SIMDType xmm2( (~C).load(i    ,j+SIMDSIZE) );
-            SIMDType xmm3( (~C).load(i+1UL,j         ) );
-            SIMDType xmm4( (~C).load(i+1UL,j+SIMDSIZE) );
-            SIMDType xmm5( (~C).load(i+2UL,j         ) );
-            SIMDType xmm6( (~C).load(i+2UL,j+SIMDSIZE) );
-
-            for( size_t k=kbegin; k<kend; ++k ) {
-               const SIMDType a1( set( A(i    ,k) ) );
-               const SIMDType a2( set( A(i+1UL,k) ) );
-               const SIMDType a3( set( A(i+2UL,k) ) );
-               const SIMDType b1( B.load(k,j         ) );
-               const SIMDType b2( B.load(k,j+SIMDSIZE) );
-               xmm1 -= a1 * b1;
-               xmm2 -= a1 * b2;
-               xmm3 -= a2 * b1;
-               xmm4 -= a2 * b2;
-               xmm5 -= a3 * b1;
-               xmm6 -= a3 * b2;
-            }
-
-            (~C).store( i    , j         , xmm1 );
-            (~C).store( i    , j+SIMDSIZE, xmm2 );
-            (~C).store( i+1UL, j         , xmm3 );
-            (~C).store( i+1UL, j+SIMDSIZE, xmm4 );
-            (~C).store( i+2UL, j         , xmm5 );
-            (~C).store( i+2UL, j+SIMDSIZE, xmm6 );
-         }
-
-         for( ; (i+2UL) <= iend; i+=2UL )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsLower_v<MT4> )
-                               ?( ( IsUpper_v<MT5> )
-                                  ?( min( ( IsStrictlyLower_v<MT4> ? i+1UL : i+2UL ), j+SIMDSIZE*2UL, K ) )
-                                  :( IsStrictlyLower_v<MT4> ? i+1UL : i+2UL ) )
-                               :( IsUpper_v<MT5> ? min( j+SIMDSIZE*2UL, K ) : K ) );
-
-            SIMDType xmm1( (~C).load(i    ,j         ) );
-            SIMDType xmm2( (~C).load(i    ,j+SIMDSIZE) );
-            SIMDType xmm3( (~C).load(i+1UL,j         ) );
-            SIMDType xmm4( (~C).load(i+1UL,j+SIMDSIZE) );
-            SIMDType xmm5, xmm6, xmm7, xmm8;
-            size_t k( kbegin );
-
-            for( ; (k+2UL) <= kend; k+=2UL ) {
-               const SIMDType a1( set( A(i    ,k    ) ) );
-               const SIMDType a2( set( A(i+1UL,k    ) ) );
-               const SIMDType a3( set( A(i    ,k+1UL) ) );
-               const SIMDType a4( set( A(i+1UL,k+1UL) ) );
-               const SIMDType b1( B.load(k    ,j         ) );
-               const SIMDType b2( B.load(k    ,j+SIMDSIZE) );
-               const SIMDType b3( B.load(k+1UL,j         ) );
-               const SIMDType b4( B.load(k+1UL,j+SIMDSIZE) );
-               xmm1 -= a1 * b1;
-               xmm2 -= a1 * b2;
-               xmm3 -= a2 * b1;
-               xmm4 -= a2 * b2;
-               xmm5 -= a3 * b3;
-               xmm6 -= a3 * b4;
-               xmm7 -= a4 * b3;
-               xmm8 -= a4 * b4;
-            }
-
-            for( ; k<kend; ++k ) {
-               const SIMDType a1( set( A(i    ,k) ) );
-               const SIMDType a2( set( A(i+1UL,k) ) );
-               const SIMDType b1( B.load(k,j         ) );
-               const SIMDType b2( B.load(k,j+SIMDSIZE) );
-               xmm1 -= a1 * b1;
-               xmm2 -= a1 * b2;
-               xmm3 -= a2 * b1;
-               xmm4 -= a2 * b2;
-            }
-
-            (~C).store( i    , j         , xmm1+xmm5 );
-            (~C).store( i    , j+SIMDSIZE, xmm2+xmm6 );
-            (~C).store( i+1UL, j         , xmm3+xmm7 );
-            (~C).store( i+1UL, j+SIMDSIZE, xmm4+xmm8 );
-         }
-
-         if( i < iend )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsUpper_v<MT5> )?( min( j+SIMDSIZE*2UL, K ) ):( K ) );
-
-            SIMDType xmm1( (~C).load(i,j         ) );
-            SIMDType xmm2( (~C).load(i,j+SIMDSIZE) );
-            SIMDType xmm3, xmm4;
-            size_t k( kbegin );
-
-            for( ; (k+2UL) <= kend; k+=2UL ) {
-               const SIMDType a1( set( A(i,k    ) ) );
-               const SIMDType a2( set( A(i,k+1UL) ) );
-               xmm1 -= a1 * B.load(k    ,j         );
-               xmm2 -= a1 * B.load(k    ,j+SIMDSIZE);
-               xmm3 -= a2 * B.load(k+1UL,j         );
-               xmm4 -= a2 * B.load(k+1UL,j+SIMDSIZE);
-            }
+   // \return void
+   //
+   // This function implements the default subtraction assignment of a dense tensor-dense tensor
+   // multiplication expression to a dense tensor. Each page of the target tensor is computed
+   // as the product of the according pages of the two operands.
+   */
+   template< typename MT3    // Type of the left-hand side target tensor
+           , typename MT4    // Type of the left-hand side tensor operand
+           , typename MT5 >  // Type of the right-hand side tensor operand
+   static inline void selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      const size_t O( A.pages()   );
+      const size_t M( A.rows()    );
+      const size_t N( B.columns() );
+      const size_t K( A.columns() );
 
-            for( ; k<kend; ++k ) {
-               const SIMDType a1( set( A(i,k) ) );
-               xmm1 -= a1 * B.load(k,j         );
-               xmm2 -= a1 * B.load(k,j+SIMDSIZE);
+      for( size_t k=0UL; k<O; ++k ) {
+         for( size_t i=0UL; i<M; ++i ) {
+            for( size_t j=0UL; j<N; ++j ) {
+               ElementType value( A(k,i,0UL) * B(k,0UL,j) );
+               for( size_t l=1UL; l<K; ++l ) {
+                  value += A(k,i,l) * B(k,l,j);
+               }
+               C(k,i,j) -= value;
             }
-
-            (~C).store( i, j         , xmm1+xmm3 );
-            (~C).store( i, j+SIMDSIZE, xmm2+xmm4 );
          }
       }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
 
-      for( ; j<jpos; j+=SIMDSIZE )
-      {
-         const size_t iend( LOW && UPP ? min(j+SIMDSIZE,M) : M );
-         size_t i( LOW ? j : 0UL );
-
-         for( ; (i+4UL) <= iend; i+=4UL )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsLower_v<MT4> )
-                               ?( IsStrictlyLower_v<MT4> ? i+3UL : i+4UL )
-                               :( K ) );
+   //**Default subtraction assignment to dense tensors (small tensors)*****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default subtraction assignment of a small dense tensor-dense tensor multiplication
+   //        (\f$ C-=A*B \f$).
+   // \ingroup dense_tensor
+   //
+   // \param C The target left-hand side dense tensor.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the default implementation of the subtraction assignment of a dense
+   // tensor-dense tensor multiplication expression to a dense tensor.
+   */
+   template< typename MT3    // Type of the left-hand side target tensor
+           , typename MT4    // Type of the left-hand side tensor operand
+           , typename MT5 >  // Type of the right-hand side tensor operand
+   static inline EnableIf_t< !UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
+      selectSmallSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      selectDefaultSubAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
 
-            SIMDType xmm1( (~C).load(i    ,j) );
-            SIMDType xmm2( (~C).load(i+1UL,j) );
-            SIMDType xmm3( (~C).load(i+2UL,j) );
-            SIMDType xmm4( (~C).load(i+3UL,j) );
-            SIMDType xmm5, xmm6, xmm7, xmm8;
-            size_t k( kbegin );
+   //**Vectorized default subtraction assignment to dense tensors (small tensors)******************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized default subtraction assignment of a small dense tensor-dense tensor
+   //        multiplication (\f$ C-=A*B \f$).
+   // \ingroup dense_tensor
+   //
+   // \param C The target left-hand side dense tensor.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the vectorized default subtraction assignment of a dense tensor-dense
+   // tensor multiplication expression to a dense tensor. This kernel is optimized for small
+   // pages: each page is computed by a register-blocked micro-kernel, which updates a block
+   // of 2 rows and 4 SIMD vectors of columns of the target page per pass over the inner
+   // dimension.
+   */
+   template< typename MT3    // Type of the left-hand side target tensor
+           , typename MT4    // Type of the left-hand side tensor operand
+           , typename MT5 >  // Type of the right-hand side tensor operand
+   static inline EnableIf_t< UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
+      selectSmallSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      constexpr bool remainder( !IsPadded_v<MT3> || !IsPadded_v<MT5> );
 
-            for( ; (k+2UL) <= kend; k+=2UL ) {
-               const SIMDType b1( B.load(k    ,j) );
-               const SIMDType b2( B.load(k+1UL,j) );
-               xmm1 -= set( A(i    ,k    ) ) * b1;
-               xmm2 -= set( A(i+1UL,k    ) ) * b1;
-               xmm3 -= set( A(i+2UL,k    ) ) * b1;
-               xmm4 -= set( A(i+3UL,k    ) ) * b1;
-               xmm5 -= set( A(i    ,k+1UL) ) * b2;
-               xmm6 -= set( A(i+1UL,k+1UL) ) * b2;
-               xmm7 -= set( A(i+2UL,k+1UL) ) * b2;
-               xmm8 -= set( A(i+3UL,k+1UL) ) * b2;
-            }
+      const size_t O( A.pages()   );
+      const size_t M( A.rows()    );
+      const size_t N( B.columns() );
+      const size_t K( A.columns() );
 
-            for( ; k<kend; ++k ) {
-               const SIMDType b1( B.load(k,j) );
-               xmm1 -= set( A(i    ,k) ) * b1;
-               xmm2 -= set( A(i+1UL,k) ) * b1;
-               xmm3 -= set( A(i+2UL,k) ) * b1;
-               xmm4 -= set( A(i+3UL,k) ) * b1;
-            }
+      const size_t jpos( remainder ? ( N & size_t(-SIMDSIZE) ) : N );
+      BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
 
-            (~C).store( i    , j, xmm1+xmm5 );
-            (~C).store( i+1UL, j, xmm2+xmm6 );
-            (~C).store( i+2UL, j, xmm3+xmm7 );
-            (~C).store( i+3UL, j, xmm4+xmm8 );
-         }
+      for( size_t k=0UL; k<O; ++k )
+      {
+         size_t j( 0UL );
 
-         for( ; (i+3UL) <= iend; i+=3UL )
+         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL )
          {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsLower_v<MT4> )
-                               ?( IsStrictlyLower_v<MT4> ? i+2UL : i+3UL )
-                               :( K ) );
+            size_t i( 0UL );
 
-            SIMDType xmm1( (~C).load(i    ,j) );
-            SIMDType xmm2( (~C).load(i+1UL,j) );
-            SIMDType xmm3( (~C).load(i+2UL,j) );
-            SIMDType xmm4, xmm5, xmm6;
-            size_t k( kbegin );
+            for( ; (i+2UL) <= M; i+=2UL )
+            {
+               SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
 
-            for( ; (k+2UL) <= kend; k+=2UL ) {
-               const SIMDType b1( B.load(k    ,j) );
-               const SIMDType b2( B.load(k+1UL,j) );
-               xmm1 -= set( A(i    ,k    ) ) * b1;
-               xmm2 -= set( A(i+1UL,k    ) ) * b1;
-               xmm3 -= set( A(i+2UL,k    ) ) * b1;
-               xmm4 -= set( A(i    ,k+1UL) ) * b2;
-               xmm5 -= set( A(i+1UL,k+1UL) ) * b2;
-               xmm6 -= set( A(i+2UL,k+1UL) ) * b2;
-            }
+               for( size_t l=0UL; l<K; ++l ) {
+                  const SIMDType a1( set( A(k,i    ,l) ) );
+                  const SIMDType a2( set( A(k,i+1UL,l) ) );
+                  const SIMDType b1( B.load(k,l,j             ) );
+                  const SIMDType b2( B.load(k,l,j+SIMDSIZE    ) );
+                  const SIMDType b3( B.load(k,l,j+SIMDSIZE*2UL) );
+                  const SIMDType b4( B.load(k,l,j+SIMDSIZE*3UL) );
+                  xmm1 += a1 * b1;
+                  xmm2 += a1 * b2;
+                  xmm3 += a1 * b3;
+                  xmm4 += a1 * b4;
+                  xmm5 += a2 * b1;
+                  xmm6 += a2 * b2;
+                  xmm7 += a2 * b3;
+                  xmm8 += a2 * b4;
+               }
 
-            for( ; k<kend; ++k ) {
-               const SIMDType b1( B.load(k,j) );
-               xmm1 -= set( A(i    ,k) ) * b1;
-               xmm2 -= set( A(i+1UL,k) ) * b1;
-               xmm3 -= set( A(i+2UL,k) ) * b1;
+               C.store( k, i    , j             , C.load(k,i    ,j             ) - xmm1 );
+               C.store( k, i    , j+SIMDSIZE    , C.load(k,i    ,j+SIMDSIZE    ) - xmm2 );
+               C.store( k, i    , j+SIMDSIZE*2UL, C.load(k,i    ,j+SIMDSIZE*2UL) - xmm3 );
+               C.store( k, i    , j+SIMDSIZE*3UL, C.load(k,i    ,j+SIMDSIZE*3UL) - xmm4 );
+               C.store( k, i+1UL, j             , C.load(k,i+1UL,j             ) - xmm5 );
+               C.store( k, i+1UL, j+SIMDSIZE    , C.load(k,i+1UL,j+SIMDSIZE    ) - xmm6 );
+               C.store( k, i+1UL, j+SIMDSIZE*2UL, C.load(k,i+1UL,j+SIMDSIZE*2UL) - xmm7 );
+               C.store( k, i+1UL, j+SIMDSIZE*3UL, C.load(k,i+1UL,j+SIMDSIZE*3UL) - xmm8 );
             }
 
-            (~C).store( i    , j, xmm1+xmm4 );
-            (~C).store( i+1UL, j, xmm2+xmm5 );
-            (~C).store( i+2UL, j, xmm3+xmm6 );
-         }
-
-         for( ; (i+2UL) <= iend; i+=2UL )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsLower_v<MT4> )
-                               ?( IsStrictlyLower_v<MT4> ? i+1UL : i+2UL )
-                               :( K ) );
-
-            SIMDType xmm1( (~C).load(i    ,j) );
-            SIMDType xmm2( (~C).load(i+1UL,j) );
-            SIMDType xmm3, xmm4;
-            size_t k( kbegin );
+            if( i < M )
+            {
+               SIMDType xmm1, xmm2, xmm3, xmm4;
 
-            for( ; (k+2UL) <= kend; k+=2UL ) {
-               const SIMDType b1( B.load(k    ,j) );
-               const SIMDType b2( B.load(k+1UL,j) );
-               xmm1 -= set( A(i    ,k    ) ) * b1;
-               xmm2 -= set( A(i+1UL,k    ) ) * b1;
-               xmm3 -= set( A(i    ,k+1UL) ) * b2;
-               xmm4 -= set( A(i+1UL,k+1UL) ) * b2;
-            }
+               for( size_t l=0UL; l<K; ++l ) {
+                  const SIMDType a1( set( A(k,i,l) ) );
+                  xmm1 += a1 * B.load(k,l,j             );
+                  xmm2 += a1 * B.load(k,l,j+SIMDSIZE    );
+                  xmm3 += a1 * B.load(k,l,j+SIMDSIZE*2UL);
+                  xmm4 += a1 * B.load(k,l,j+SIMDSIZE*3UL);
+               }
 
-            for( ; k<kend; ++k ) {
-               const SIMDType b1( B.load(k,j) );
-               xmm1 -= set( A(i    ,k) ) * b1;
-               xmm2 -= set( A(i+1UL,k) ) * b1;
+               C.store( k, i, j             , C.load(k,i,j             ) - xmm1 );
+               C.store( k, i, j+SIMDSIZE    , C.load(k,i,j+SIMDSIZE    ) - xmm2 );
+               C.store( k, i, j+SIMDSIZE*2UL, C.load(k,i,j+SIMDSIZE*2UL) - xmm3 );
+               C.store( k, i, j+SIMDSIZE*3UL, C.load(k,i,j+SIMDSIZE*3UL) - xmm4 );
             }
-
-            (~C).store( i    , j, xmm1+xmm3 );
-            (~C).store( i+1UL, j, xmm2+xmm4 );
          }
 
-         if( i < iend )
+         for( ; j<jpos; j+=SIMDSIZE )
          {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
+            size_t i( 0UL );
 
-            SIMDType xmm1( (~C).load(i,j) );
-            SIMDType xmm2;
-            size_t k( kbegin );
+            for( ; (i+2UL) <= M; i+=2UL )
+            {
+               SIMDType xmm1, xmm2;
 
-            for( ; (k+2UL) <= K; k+=2UL ) {
-               xmm1 -= set( A(i,k    ) ) * B.load(k    ,j);
-               xmm2 -= set( A(i,k+1UL) ) * B.load(k+1UL,j);
-            }
+               for( size_t l=0UL; l<K; ++l ) {
+                  const SIMDType b1( B.load(k,l,j) );
+                  xmm1 += set( A(k,i    ,l) ) * b1;
+                  xmm2 += set( A(k,i+1UL,l) ) * b1;
+               }
 
-            for( ; k<K; ++k ) {
-               xmm1 -= set( A(i,k) ) * B.load(k,j);
+               C.store( k, i    , j, C.load(k,i    ,j) - xmm1 );
+               C.store( k, i+1UL, j, C.load(k,i+1UL,j) - xmm2 );
             }
 
-            (~C).store( i, j, xmm1+xmm2 );
-         }
-      }
-
-      for( ; remainder && j<N; ++j )
-      {
-         const size_t iend( UPP ? j+1UL : M );
-         size_t i( LOW ? j : 0UL );
-
-         for( ; (i+2UL) <= iend; i+=2UL )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-            const size_t kend( ( IsLower_v<MT4> )
-                               ?( IsStrictlyLower_v<MT4> ? i+1UL : i+2UL )
-                               :( K ) );
+            if( i < M )
+            {
+               SIMDType xmm1;
 
-            ElementType value1( (~C)(i    ,j) );
-            ElementType value2( (~C)(i+1UL,j) );
+               for( size_t l=0UL; l<K; ++l ) {
+                  xmm1 += set( A(k,i,l) ) * B.load(k,l,j);
+               }
 
-            for( size_t k=kbegin; k<kend; ++k ) {
-               value1 -= A(i    ,k) * B(k,j);
-               value2 -= A(i+1UL,k) * B(k,j);
+               C.store( k, i, j, C.load(k,i,j) - xmm1 );
             }
-
-            (~C)(i    ,j) = value1;
-            (~C)(i+1UL,j) = value2;
          }
 
-         if( i < iend )
-         {
-            const size_t kbegin( ( IsUpper_v<MT4> )
-                                 ?( ( IsLower_v<MT5> )
-                                    ?( max( ( IsStrictlyUpper_v<MT4> ? i+1UL : i ), j ) )
-                                    :( IsStrictlyUpper_v<MT4> ? i+1UL : i ) )
-                                 :( IsLower_v<MT5> ? j : 0UL ) );
-
-            ElementType value( (~C)(i,j) );
-
-            for( size_t k=kbegin; k<K; ++k ) {
-               value -= A(i,k) * B(k,j);
+         for( ; remainder && j<N; ++j ) {
+            for( size_t i=0UL; i<M; ++i ) {
+               ElementType value( A(k,i,0UL) * B(k,0UL,j) );
+               for( size_t l=1UL; l<K; ++l ) {
+                  value += A(k,i,l) * B(k,l,j);
+               }
+               C(k,i,j) -= value;
             }
-
-            (~C)(i,j) = value;
          }
       }
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Default subtraction assignment to dense tensors (large tensors)***************************
+   //**Default subtraction assignment to dense tensors (large tensors)*****************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a large dense tensor-dense tensor multiplication
    //        (\f$ C-=A*B \f$).
@@ -3541,7 +1570,7 @@ class DTensDTensMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Vectorized default subtraction assignment to dense tensors (large tensors)****************
+   //**Vectorized default subtraction assignment to dense tensors (large tensors)******************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Vectorized default subtraction assignment of a large dense tensor-dense tensor
    //        multiplication (\f$ C-=A*B \f$).
@@ -3552,9 +1581,11 @@ class DTensDTensMultExpr
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function implements the vectorized default subtraction assignment of a dense tensor-
-   // dense tensor multiplication expression to a dense tensor. This kernel is optimized for
-   // large tensors.
+   // This function implements the vectorized default subtraction assignment of a dense tensor-dense
+   // tensor multiplication expression to a dense tensor. This kernel is optimized for large
+   // pages: the inner dimension and the columns of each page are traversed in blocks, such
+   // that the currently used block of the right-hand side page remains in cache while the
+   // register-blocked micro-kernel sweeps over all rows of the left-hand side page.
    */
    template< typename MT3    // Type of the left-hand side target tensor
            , typename MT4    // Type of the left-hand side tensor operand
@@ -3562,17 +1593,130 @@ class DTensDTensMultExpr
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<MT3,MT4,MT5> >
       selectLargeSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      if( LOW )
-         lmmm( C, A, B, ElementType(-1), ElementType(1) );
-      else if( UPP )
-         ummm( C, A, B, ElementType(-1), ElementType(1) );
-      else
-         mmm( C, A, B, ElementType(-1), ElementType(1) );
+      constexpr bool remainder( !IsPadded_v<MT3> || !IsPadded_v<MT5> );
+
+      constexpr size_t jblock( SIMDSIZE*32UL );
+      constexpr size_t lblock( 64UL );
+
+      const size_t O( A.pages()   );
+      const size_t M( A.rows()    );
+      const size_t N( B.columns() );
+      const size_t K( A.columns() );
+
+      for( size_t k=0UL; k<O; ++k ) {
+         for( size_t jj=0UL; jj<N; jj+=jblock )
+         {
+            const size_t jend( min( jj+jblock, N ) );
+            const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
+            BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+            for( size_t ll=0UL; ll<K; ll+=lblock )
+            {
+               const size_t lend( min( ll+lblock, K ) );
+
+               size_t j( jj );
+
+               for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL )
+               {
+                  size_t i( 0UL );
+
+                  for( ; (i+2UL) <= M; i+=2UL )
+                  {
+                     SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
+
+                     for( size_t l=ll; l<lend; ++l ) {
+                        const SIMDType a1( set( A(k,i    ,l) ) );
+                        const SIMDType a2( set( A(k,i+1UL,l) ) );
+                        const SIMDType b1( B.load(k,l,j             ) );
+                        const SIMDType b2( B.load(k,l,j+SIMDSIZE    ) );
+                        const SIMDType b3( B.load(k,l,j+SIMDSIZE*2UL) );
+                        const SIMDType b4( B.load(k,l,j+SIMDSIZE*3UL) );
+                        xmm1 += a1 * b1;
+                        xmm2 += a1 * b2;
+                        xmm3 += a1 * b3;
+                        xmm4 += a1 * b4;
+                        xmm5 += a2 * b1;
+                        xmm6 += a2 * b2;
+                        xmm7 += a2 * b3;
+                        xmm8 += a2 * b4;
+                     }
+
+                     C.store( k, i    , j             , C.load(k,i    ,j             ) - xmm1 );
+                     C.store( k, i    , j+SIMDSIZE    , C.load(k,i    ,j+SIMDSIZE    ) - xmm2 );
+                     C.store( k, i    , j+SIMDSIZE*2UL, C.load(k,i    ,j+SIMDSIZE*2UL) - xmm3 );
+                     C.store( k, i    , j+SIMDSIZE*3UL, C.load(k,i    ,j+SIMDSIZE*3UL) - xmm4 );
+                     C.store( k, i+1UL, j             , C.load(k,i+1UL,j             ) - xmm5 );
+                     C.store( k, i+1UL, j+SIMDSIZE    , C.load(k,i+1UL,j+SIMDSIZE    ) - xmm6 );
+                     C.store( k, i+1UL, j+SIMDSIZE*2UL, C.load(k,i+1UL,j+SIMDSIZE*2UL) - xmm7 );
+                     C.store( k, i+1UL, j+SIMDSIZE*3UL, C.load(k,i+1UL,j+SIMDSIZE*3UL) - xmm8 );
+                  }
+
+                  if( i < M )
+                  {
+                     SIMDType xmm1, xmm2, xmm3, xmm4;
+
+                     for( size_t l=ll; l<lend; ++l ) {
+                        const SIMDType a1( set( A(k,i,l) ) );
+                        xmm1 += a1 * B.load(k,l,j             );
+                        xmm2 += a1 * B.load(k,l,j+SIMDSIZE    );
+                        xmm3 += a1 * B.load(k,l,j+SIMDSIZE*2UL);
+                        xmm4 += a1 * B.load(k,l,j+SIMDSIZE*3UL);
+                     }
+
+                     C.store( k, i, j             , C.load(k,i,j             ) - xmm1 );
+                     C.store( k, i, j+SIMDSIZE    , C.load(k,i,j+SIMDSIZE    ) - xmm2 );
+                     C.store( k, i, j+SIMDSIZE*2UL, C.load(k,i,j+SIMDSIZE*2UL) - xmm3 );
+                     C.store( k, i, j+SIMDSIZE*3UL, C.load(k,i,j+SIMDSIZE*3UL) - xmm4 );
+                  }
+               }
+
+               for( ; j<jpos; j+=SIMDSIZE )
+               {
+                  size_t i( 0UL );
+
+                  for( ; (i+2UL) <= M; i+=2UL )
+                  {
+                     SIMDType xmm1, xmm2;
+
+                     for( size_t l=ll; l<lend; ++l ) {
+                        const SIMDType b1( B.load(k,l,j) );
+                        xmm1 += set( A(k,i    ,l) ) * b1;
+                        xmm2 += set( A(k,i+1UL,l) ) * b1;
+                     }
+
+                     C.store( k, i    , j, C.load(k,i    ,j) - xmm1 );
+                     C.store( k, i+1UL, j, C.load(k,i+1UL,j) - xmm2 );
+                  }
+
+                  if( i < M )
+                  {
+                     SIMDType xmm1;
+
+                     for( size_t l=ll; l<lend; ++l ) {
+                        xmm1 += set( A(k,i,l) ) * B.load(k,l,j);
+                     }
+
+                     C.store( k, i, j, C.load(k,i,j) - xmm1 );
+                  }
+               }
+
+               for( ; remainder && j<jend; ++j ) {
+                  for( size_t i=0UL; i<M; ++i ) {
+                     ElementType value( A(k,i,ll) * B(k,ll,j) );
+                     for( size_t l=ll+1UL; l<lend; ++l ) {
+                        value += A(k,i,l) * B(k,l,j);
+                     }
+                     C(k,i,j) -= value;
+                  }
+               }
+            }
+         }
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**BLAS-based subtraction assignment to dense tensors (default)*******************************
+   //**BLAS-based subtraction assignment to dense tensors (default)********************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a dense tensor-dense tensor multiplication
    //        (\f$ C-=A*B \f$).
@@ -3597,10 +1741,10 @@ class DTensDTensMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
-   //**BLAS-based subraction assignment to dense tensors******************************************
-#if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_MATRIX_MATRIX_MULTIPLICATION
+   //**BLAS-based subtraction assignment to dense tensors******************************************
+#if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_TENSOR_TENSOR_MULTIPLICATION
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief BLAS-based subraction assignment of a dense tensor-dense tensor multiplication
+   /*!\brief BLAS-based subtraction assignment of a dense tensor-dense tensor multiplication
    //        (\f$ C-=A*B \f$).
    // \ingroup dense_tensor
    //
@@ -3610,7 +1754,9 @@ class DTensDTensMultExpr
    // \return void
    //
    // This function performs the dense tensor-dense tensor multiplication based on the according
-   // BLAS functionality.
+   // BLAS functionality. In case the BLAS library provides a strided batched \c gemm() (see
+   // the BLAZE_USE_BLAS_BATCHED_TENSOR_TENSOR_MULTIPLICATION switch), all pages are multiplied
+   // by a single call, otherwise \c gemm() is called for each page.
    */
    template< typename MT3    // Type of the left-hand side target tensor
            , typename MT4    // Type of the left-hand side tensor operand
@@ -3620,19 +1766,14 @@ class DTensDTensMultExpr
    {
       using ET = ElementType_t<MT3>;
 
-      if( IsTriangular_v<MT4> ) {
-         ResultType_t<MT3> tmp( serial( B ) );
-         trmm( tmp, A, CblasLeft, ( IsLower_v<MT4> )?( CblasLower ):( CblasUpper ), ET(1) );
-         subAssign( C, tmp );
-      }
-      else if( IsTriangular_v<MT5> ) {
-         ResultType_t<MT3> tmp( serial( A ) );
-         trmm( tmp, B, CblasRight, ( IsLower_v<MT5> )?( CblasLower ):( CblasUpper ), ET(1) );
-         subAssign( C, tmp );
-      }
-      else {
-         gemm( C, A, B, ET(-1), ET(1) );
+#if BLAZE_USE_BLAS_BATCHED_TENSOR_TENSOR_MULTIPLICATION
+      gemmBatchStrided( C, A, B, ET(-1), ET(1) );
+#else
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         auto Ck( pageslice( C, k, unchecked ) );
+         gemm( Ck, pageslice( A, k, unchecked ), pageslice( B, k, unchecked ), ET(-1), ET(1) );
       }
+#endif
    }
    /*! \endcond */
 #endif
@@ -3664,7 +1805,7 @@ class DTensDTensMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryTrait_t<ResultType> tmp( serial( rhs ) );
       schurAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -3685,8 +1826,7 @@ class DTensDTensMultExpr
    // SFINAE principle this function can only be selected by the compiler in case either of the
    // two tensor operands requires an intermediate evaluation and no symmetry can be exploited.
    */
-   template< typename MT  // Type of the target dense tensor
-           , bool SO >    // Storage order of the target dense tensor
+   template< typename MT >  // Type of the target dense tensor
    friend inline EnableIf_t< IsEvaluationRequired_v<MT,MT1,MT2> >
       smpAssign( DenseTensor<MT>& lhs, const DTensDTensMultExpr& rhs )
    {
@@ -3734,8 +1874,7 @@ class DTensDTensMultExpr
    // in case either of the two tensor operands requires an intermediate evaluation and no
    // symmetry can be exploited.
    */
-   template< typename MT  // Type of the target dense tensor
-           , bool SO >    // Storage order of the target dense tensor
+   template< typename MT >  // Type of the target dense tensor
    friend inline EnableIf_t< IsEvaluationRequired_v<MT,MT1,MT2> >
       smpAddAssign( DenseTensor<MT>& lhs, const DTensDTensMultExpr& rhs )
    {
@@ -3779,8 +1918,7 @@ class DTensDTensMultExpr
    // in case either of the two tensor operands requires an intermediate evaluation and no
    // symmetry can be exploited.
    */
-   template< typename MT  // Type of the target dense tensor
-           , bool SO >    // Storage order of the target dense tensor
+   template< typename MT >  // Type of the target dense tensor
    friend inline EnableIf_t< IsEvaluationRequired_v<MT,MT1,MT2> >
       smpSubAssign( DenseTensor<MT>& lhs, const DTensDTensMultExpr& rhs )
    {
@@ -3834,7 +1972,7 @@ class DTensDTensMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( rhs );
+      const TemporaryTrait_t<ResultType> tmp( rhs );
       smpSchurAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -3978,10 +2116,10 @@ class DTensScalarMultExpr< DTensDTensMultExpr<MT1,MT2>, ST >
    using RightOperand = ST;
 
    //! Type for the assignment of the left-hand side dense tensor operand.
-   using LT = If_t< evaluateLeft, const RT1, CT1 >;
+   using LT = If_t< evaluateLeft, const TemporaryTrait_t<RT1>, CT1 >;
 
    //! Type for the assignment of the right-hand side dense tensor operand.
-   using RT = If_t< evaluateRight, const RT2, CT2 >;
+   using RT = If_t< evaluateRight, const TemporaryTrait_t<RT2>, CT2 >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -5416,7 +3554,7 @@ class DTensScalarMultExpr< DTensDTensMultExpr<MT1,MT2>, ST >
    static inline EnableIf_t< !IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
       selectDefaultAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      const ResultType tmp( serial( A * B * scalar ) );
+      const TemporaryTrait_t<ResultType> tmp( serial( A * B * scalar ) );
       addAssign( C, tmp );
    }
    //**********************************************************************************************
@@ -6438,7 +4576,7 @@ class DTensScalarMultExpr< DTensDTensMultExpr<MT1,MT2>, ST >
    static inline EnableIf_t< !IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
       selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      const ResultType tmp( serial( A * B * scalar ) );
+      const TemporaryTrait_t<ResultType> tmp( serial( A * B * scalar ) );
       subAssign( C, tmp );
    }
    //**********************************************************************************************
@@ -7395,7 +5533,7 @@ class DTensScalarMultExpr< DTensDTensMultExpr<MT1,MT2>, ST >
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryTrait_t<ResultType> tmp( serial( rhs ) );
       schurAssign( ~lhs, tmp );
    }
    //**********************************************************************************************
@@ -7587,7 +5725,7 @@ class DTensScalarMultExpr< DTensDTensMultExpr<MT1,MT2>, ST >
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( rhs );
+      const TemporaryTrait_t<ResultType> tmp( rhs );
       smpSchurAssign( ~lhs, tmp );
    }
    //**********************************************************************************************
@@ -7635,16 +5773,16 @@ class DTensScalarMultExpr< DTensDTensMultExpr<MT1,MT2>, ST >
 // \param lhs The left-hand side tensor for the multiplication.
 // \param rhs The right-hand side tensor for the multiplication.
 // \return The resulting tensor.
-// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Tensor sizes do not match.
 //
-// This operator represents the multiplication of two row-major dense tensors:
+// This operator represents the page-wise multiplication of two row-major dense tensors, i.e.
+// each page of the resulting tensor is the matrix product of the according pages of \a lhs
+// and \a rhs:
 
    \code
-   using blaze::rowMajor;
-
-   blaze::DynamicMatrix<double,rowMajor> A, B, C;
-   // ... Resizing and initialization
-   C = A * B;
+   blaze::DynamicTensor<double> A( 8UL, 64UL, 32UL ), B( 8UL, 32UL, 64UL ), C;
+   // ... Initialization
+   C = A * B;  // C has 8 pages of 64x64 elements
    \endcode
 
 // The operator returns an expression representing a dense tensor of the higher-order element
@@ -7652,7 +5790,7 @@ class DTensScalarMultExpr< DTensDTensMultExpr<MT1,MT2>, ST >
 // Both tensor types \a MT1 and \a MT2 as well as the two element types \a MT1::ElementType
 // and \a MT2::ElementType have to be supported by the MultTrait class template.\n
 // In case the current number of columns of \a lhs and the current number of rows of \a rhs
-// don't match, a \a std::invalid_argument is thrown.
+// or the current numbers of pages don't match, a \a std::invalid_argument is thrown.
 */
 template< typename MT1    // Type of the left-hand side dense tensor
         , typename MT2 >  // Type of the right-hand side dense tensor
@@ -7661,8 +5799,8 @@ inline decltype(auto)
 {
    BLAZE_FUNCTION_TRACE;
 
-   if( (~lhs).columns() != (~rhs).rows() ) {
-      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   if( (~lhs).columns() != (~rhs).rows() || (~lhs).pages() != (~rhs).pages() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
    }
 
    using ReturnType = const DTensDTensMultExpr<MT1,MT2>;
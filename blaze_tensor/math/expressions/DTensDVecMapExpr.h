@@ -0,0 +1,1318 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/expressions/DTensDVecMapExpr.h
+//  \brief Header file for the broadcasting dense tensor/dense vector map expression
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_EXPRESSIONS_DTENSDVECMAPEXPR_H_
+#define _BLAZE_TENSOR_MATH_EXPRESSIONS_DTENSDVECMAPEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Div.h>
+#include <blaze/math/functors/Max.h>
+#include <blaze/math/functors/Min.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/functors/Sub.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/traits/MapTrait.h>
+#include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+#include <blaze_tensor/math/ReductionFlag.h>
+#include <blaze_tensor/math/constraints/DenseTensor.h>
+#include <blaze_tensor/math/dense/BroadcastIterator.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/expressions/Forward.h>
+#include <blaze_tensor/math/expressions/TensVecMapExpr.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DTENSDVECMAPEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for the broadcasting dense tensor-dense vector map() function.
+// \ingroup dense_tensor_expression
+//
+// The DTensDVecMapExpr class represents the compile time expression for the evaluation of a
+// binary custom operation between the elements of a dense tensor and the elements of a dense
+// vector, which spans the dimension of the tensor specified by the reduction flag \a RF and
+// is broadcast along all other dimensions. The element \f$ (k,i,j) \f$ of the tensor is
+// combined with the vector element \f$ j \f$ for \a blaze::rowwise, with \f$ i \f$ for
+// \a blaze::columnwise and with \f$ k \f$ for \a blaze::pagewise.
+*/
+template< typename TT    // Type of the left-hand side dense tensor
+        , typename VT    // Type of the right-hand side dense vector
+        , size_t RF      // Reduction flag
+        , typename OP >  // Type of the custom operation
+class DTensDVecMapExpr
+   : public TensVecMapExpr< DenseTensor< DTensDVecMapExpr<TT,VT,RF,OP> > >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   using RT1 = ResultType_t<TT>;     //!< Result type of the left-hand side tensor expression.
+   using RT2 = ResultType_t<VT>;     //!< Result type of the right-hand side vector expression.
+   using ET1 = ElementType_t<TT>;    //!< Element type of the left-hand side tensor expression.
+   using ET2 = ElementType_t<VT>;    //!< Element type of the right-hand side vector expression.
+   using RN1 = ReturnType_t<TT>;     //!< Return type of the left-hand side tensor expression.
+   using RN2 = ReturnType_t<VT>;     //!< Return type of the right-hand side vector expression.
+   using CT1 = CompositeType_t<TT>;  //!< Composite type of the left-hand side tensor expression.
+   using CT2 = CompositeType_t<VT>;  //!< Composite type of the right-hand side vector expression.
+
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+   //**********************************************************************************************
+
+   //**Broadcasting strategy***********************************************************************
+   //! Compilation switch for the broadcasting of single vector elements.
+   /*! The \a scalar compile time constant expression indicates whether a single vector element
+       is broadcast across a complete row of the tensor (\a blaze::columnwise and
+       \a blaze::pagewise) or whether each row of the tensor is combined elementwise with the
+       vector (\a blaze::rowwise). */
+   static constexpr bool scalar = ( RF != rowwise );
+
+   //! Tag type for the selection of the broadcasting strategy.
+   using ScalarTag = BoolConstant<scalar>;
+   //**********************************************************************************************
+
+   //**Serial evaluation strategy******************************************************************
+   //! Compilation switch for the serial evaluation strategy of the map expression.
+   /*! The \a useAssign compile time constant expression represents a compilation switch for
+       the serial evaluation strategy of the map expression. In case either of the two operands
+       requires an intermediate evaluation, \a useAssign will be set to 1 and the map expression
+       will be evaluated via the \a assign function family. Otherwise \a useAssign will be set
+       to 0 and the expression will be evaluated via the subscript operator. */
+   static constexpr bool useAssign = ( RequiresEvaluation_v<TT> || RequiresEvaluation_v<VT> );
+
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename TT2 >
+   static constexpr bool UseAssign_v = useAssign;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Parallel evaluation strategy****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the parallel evaluation strategy.
+       In case at least one of the two operands is not SMP assignable and at least one of the
+       two operands requires an intermediate evaluation, the variable is set to 1 and the
+       expression specific evaluation strategy is selected. Otherwise the variable is set to
+       0 and the default strategy is chosen. */
+   template< typename TT2 >
+   static constexpr bool UseSMPAssign_v =
+      ( ( !TT::smpAssignable || !VT::smpAssignable ) && useAssign );
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   //! Type of this DTensDVecMapExpr instance.
+   using This = DTensDVecMapExpr<TT,VT,RF,OP>;
+
+   //! Result type for expression template evaluations.
+   using ResultType = typename RT1::template Rebind< MapTrait_t<ET1,ET2,OP> >::Other;
+
+   //! Result type with opposite storage order for expression template evaluations.
+   using OppositeType = OppositeType_t<ResultType>;
+
+   //! Transpose type for expression template evaluations.
+   using TransposeType = TransposeType_t<ResultType>;
+
+   //! Resulting element type.
+   using ElementType = ElementType_t<ResultType>;
+
+   //! Return type for expression template evaluations.
+   using ReturnType = decltype( std::declval<OP>()( std::declval<RN1>(), std::declval<RN2>() ) );
+
+   //! Data type for composite expression templates.
+   using CompositeType = If_t< useAssign, const ResultType, const DTensDVecMapExpr& >;
+
+   //! Composite type of the left-hand side dense tensor expression.
+   using LeftOperand = If_t< IsExpression_v<TT>, const TT, const TT& >;
+
+   //! Composite type of the right-hand side dense vector expression.
+   using RightOperand = If_t< IsExpression_v<VT>, const VT, const VT& >;
+
+   //! Data type of the custom binary operation.
+   using Operation = OP;
+
+   //! Type for the assignment of the left-hand side dense tensor operand.
+   using LT = If_t< RequiresEvaluation_v<TT>, const RT1, CT1 >;
+
+   //! Type for the assignment of the right-hand side dense vector operand.
+   using RT = If_t< RequiresEvaluation_v<VT>, const RT2, CT2 >;
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of the broadcasting map expression.
+   //
+   // In case a single vector element is broadcast across the row of the tensor, the right-hand
+   // side iterator holds the element by value. Therefore it is loaded once per row and kept in
+   // a register instead of being reloaded for every SIMD element.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+      using ValueType        = ElementType;                      //!< Type of the underlying elements.
+      using PointerType      = ElementType*;                     //!< Pointer return type.
+      using ReferenceType    = ElementType&;                     //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying elements.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+
+      //! ConstIterator type of the left-hand side dense tensor expression.
+      using LeftIteratorType = ConstIterator_t<TT>;
+
+      //! ConstIterator type of the right-hand side dense vector expression.
+      using RightIteratorType = If_t< scalar, BroadcastIterator<ET2>, ConstIterator_t<VT> >;
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param left Iterator to the initial left-hand side element.
+      // \param right Iterator to the initial right-hand side element.
+      // \param op The custom binary operation.
+      */
+      explicit inline ConstIterator( LeftIteratorType left, RightIteratorType right, OP op )
+         : left_ ( left  )  // Iterator to the current left-hand side element
+         , right_( right )  // Iterator to the current right-hand side element
+         , op_   ( op    )  // The custom binary operation
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline ConstIterator& operator+=( size_t inc ) {
+         left_  += inc;
+         right_ += inc;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline ConstIterator& operator-=( size_t dec ) {
+         left_  -= dec;
+         right_ -= dec;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() {
+         ++left_;
+         ++right_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) {
+         return ConstIterator( left_++, right_++, op_ );
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline ConstIterator& operator--() {
+         --left_;
+         --right_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator--( int ) {
+         return ConstIterator( left_--, right_--, op_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return The resulting value.
+      */
+      inline ReturnType operator*() const {
+         return op_( *left_, *right_ );
+      }
+      //*******************************************************************************************
+
+      //**Load function****************************************************************************
+      /*!\brief Access to the SIMD elements of the tensor.
+      //
+      // \return The resulting SIMD element.
+      */
+      inline auto load() const noexcept {
+         return op_.load( left_.load(), right_.load() );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const {
+         return left_ == rhs.left_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const {
+         return left_ != rhs.left_;
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      inline bool operator<( const ConstIterator& rhs ) const {
+         return left_ < rhs.left_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      inline bool operator>( const ConstIterator& rhs ) const {
+         return left_ > rhs.left_;
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      inline bool operator<=( const ConstIterator& rhs ) const {
+         return left_ <= rhs.left_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      inline bool operator>=( const ConstIterator& rhs ) const {
+         return left_ >= rhs.left_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const {
+         return left_ - rhs.left_;
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( const ConstIterator& it, size_t inc ) {
+         return ConstIterator( it.left_ + inc, it.right_ + inc, it.op_ );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a ConstIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( size_t inc, const ConstIterator& it ) {
+         return ConstIterator( it.left_ + inc, it.right_ + inc, it.op_ );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const ConstIterator operator-( const ConstIterator& it, size_t dec ) {
+         return ConstIterator( it.left_ - dec, it.right_ - dec, it.op_ );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      LeftIteratorType  left_;   //!< Iterator to the current left-hand side element.
+      RightIteratorType right_;  //!< Iterator to the current right-hand side element.
+      OP                op_;     //!< The custom binary operation.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   static constexpr bool simdEnabled =
+      ( TT::simdEnabled && ( scalar ? IsVectorizable_v<ET2> : VT::simdEnabled ) &&
+        If_t< HasSIMDEnabled_v<OP>, GetSIMDEnabled<OP,ET1,ET2>, HasLoad<OP> >::value );
+
+   //! Compilation switch for the expression template assignment strategy.
+   static constexpr bool smpAssignable = ( TT::smpAssignable && VT::smpAssignable );
+   //**********************************************************************************************
+
+   //**SIMD properties*****************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DTensDVecMapExpr class.
+   //
+   // \param lhs The left-hand side dense tensor operand of the map expression.
+   // \param rhs The right-hand side dense vector operand of the map expression.
+   // \param op The custom binary operation.
+   */
+   explicit inline DTensDVecMapExpr( const TT& lhs, const VT& rhs, OP op ) noexcept
+      : lhs_( lhs )  // Left-hand side dense tensor of the map expression
+      , rhs_( rhs )  // Right-hand side dense vector of the map expression
+      , op_ ( op  )  // The custom binary operation
+   {}
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 3D-access to the tensor elements.
+   //
+   // \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator()( size_t k, size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( i < lhs_.rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < lhs_.columns(), "Invalid column access index" );
+      BLAZE_INTERNAL_ASSERT( k < lhs_.pages()  , "Invalid page access index"   );
+      return op_( lhs_(k,i,j), rhs_[ RF == rowwise ? j : RF == columnwise ? i : k ] );
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the tensor elements.
+   //
+   // \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid tensor access index.
+   */
+   inline ReturnType at( size_t k, size_t i, size_t j ) const {
+      if( i >= lhs_.rows() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+      }
+      if( j >= lhs_.columns() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+      }
+      if( k >= lhs_.pages() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid page access index" );
+      }
+      return (*this)(k,i,j);
+   }
+   //**********************************************************************************************
+
+   //**Load function*******************************************************************************
+   /*!\brief Access to the SIMD elements of the tensor.
+   //
+   // \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return Reference to the accessed values.
+   */
+   BLAZE_ALWAYS_INLINE auto load( size_t k, size_t i, size_t j ) const noexcept {
+      BLAZE_INTERNAL_ASSERT( i < lhs_.rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < lhs_.columns(), "Invalid column access index" );
+      BLAZE_INTERNAL_ASSERT( k < lhs_.pages()  , "Invalid page access index"   );
+      BLAZE_INTERNAL_ASSERT( j % SIMDSIZE == 0UL, "Invalid column access index" );
+      return op_.load( lhs_.load(k,i,j), loadRight( k, i, j, ScalarTag() ) );
+   }
+   //**********************************************************************************************
+
+   //**Begin function******************************************************************************
+   /*!\brief Returns an iterator to the first element of row \a i of page \a k.
+   //
+   // \param i The row index.
+   // \param k The page index.
+   // \return Iterator to the first element of row \a i of page \a k.
+   */
+   inline ConstIterator begin( size_t i, size_t k ) const {
+      return ConstIterator( lhs_.begin(i,k), beginRight( i, k, ScalarTag() ), op_ );
+   }
+   //**********************************************************************************************
+
+   //**End function********************************************************************************
+   /*!\brief Returns an iterator just past the last element of row \a i of page \a k.
+   //
+   // \param i The row index.
+   // \param k The page index.
+   // \return Iterator just past the last element of row \a i of page \a k.
+   */
+   inline ConstIterator end( size_t i, size_t k ) const {
+      return ConstIterator( lhs_.end(i,k), endRight( i, k, ScalarTag() ), op_ );
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the tensor.
+   //
+   // \return The number of rows of the tensor.
+   */
+   inline size_t rows() const noexcept {
+      return lhs_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the tensor.
+   //
+   // \return The number of columns of the tensor.
+   */
+   inline size_t columns() const noexcept {
+      return lhs_.columns();
+   }
+   //**********************************************************************************************
+
+   //**Pages function******************************************************************************
+   /*!\brief Returns the current number of pages of the tensor.
+   //
+   // \return The number of pages of the tensor.
+   */
+   inline size_t pages() const noexcept {
+      return lhs_.pages();
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side dense tensor operand.
+   //
+   // \return The left-hand side dense tensor operand.
+   */
+   inline LeftOperand leftOperand() const noexcept {
+      return lhs_;
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the right-hand side dense vector operand.
+   //
+   // \return The right-hand side dense vector operand.
+   */
+   inline RightOperand rightOperand() const noexcept {
+      return rhs_;
+   }
+   //**********************************************************************************************
+
+   //**Operation access****************************************************************************
+   /*!\brief Returns a copy of the custom operation.
+   //
+   // \return A copy of the custom operation.
+   */
+   inline Operation operation() const {
+      return op_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return ( IsExpression_v<TT> && lhs_.canAlias( alias ) ) ||
+             ( IsExpression_v<VT> && rhs_.canAlias( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return ( lhs_.isAliased( alias ) || rhs_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return lhs_.isAligned() && ( scalar || rhs_.isAligned() );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // Since the broadcast vector is usually much smaller than the tensor, only the size of the
+   // tensor operand decides about the parallel evaluation.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return lhs_.canSMPAssign();
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Right-hand side access**********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Broadcasts the vector element belonging to row \a i of page \a k.
+   //
+   // \param k The page index.
+   // \param i The row index.
+   // \param j The column index.
+   // \return The broadcast vector element.
+   */
+   BLAZE_ALWAYS_INLINE auto loadRight( size_t k, size_t i, size_t j, TrueType ) const noexcept {
+      MAYBE_UNUSED( j );
+      return set( ET2( rhs_[ RF == columnwise ? i : k ] ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Right-hand side access**********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Loads the vector elements belonging to column \a j.
+   //
+   // \param k The page index.
+   // \param i The row index.
+   // \param j The column index.
+   // \return The loaded SIMD element of the vector.
+   */
+   BLAZE_ALWAYS_INLINE auto loadRight( size_t k, size_t i, size_t j, FalseType ) const noexcept {
+      MAYBE_UNUSED( k, i );
+      return rhs_.load( j );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Right-hand side iterators*******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the right-hand side iterators for row \a i of page \a k.
+   //
+   // \param i The row index.
+   // \param k The page index.
+   // \return The right-hand side iterator.
+   */
+   inline auto beginRight( size_t i, size_t k, TrueType ) const {
+      return BroadcastIterator<ET2>( rhs_[ RF == columnwise ? i : k ] );
+   }
+
+   inline auto beginRight( size_t i, size_t k, FalseType ) const {
+      MAYBE_UNUSED( i, k );
+      return rhs_.begin();
+   }
+
+   inline auto endRight( size_t i, size_t k, TrueType ) const {
+      return BroadcastIterator<ET2>( rhs_[ RF == columnwise ? i : k ], lhs_.columns() );
+   }
+
+   inline auto endRight( size_t i, size_t k, FalseType ) const {
+      MAYBE_UNUSED( i, k );
+      return rhs_.end();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   LeftOperand  lhs_;  //!< Left-hand side dense tensor of the map expression.
+   RightOperand rhs_;  //!< Right-hand side dense vector of the map expression.
+   Operation    op_;   //!< The custom binary operation.
+   //**********************************************************************************************
+
+   //**Assignment to dense tensors****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a broadcasting map expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side map expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a
+   // broadcasting map expression to a dense tensor. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case
+   // either of the two operands requires an intermediate evaluation.
+   */
+   template< typename TT2 >  // Type of the target dense tensor
+   friend inline EnableIf_t< UseAssign_v<TT2> >
+      assign( DenseTensor<TT2>& lhs, const DTensDVecMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense tensor operand
+      RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.pages()   == rhs.lhs_.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( B.size() == rhs.rhs_.size(), "Invalid vector size" );
+
+      assign( ~lhs, map<RF>( A, B, rhs.op_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense tensors*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a broadcasting map expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side map expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a
+   // broadcasting map expression to a dense tensor. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case
+   // either of the two operands requires an intermediate evaluation.
+   */
+   template< typename TT2 >  // Type of the target dense tensor
+   friend inline EnableIf_t< UseAssign_v<TT2> >
+      addAssign( DenseTensor<TT2>& lhs, const DTensDVecMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense tensor operand
+      RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.pages()   == rhs.lhs_.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( B.size() == rhs.rhs_.size(), "Invalid vector size" );
+
+      addAssign( ~lhs, map<RF>( A, B, rhs.op_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense tensors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a broadcasting map expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side map expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a
+   // broadcasting map expression to a dense tensor. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case
+   // either of the two operands requires an intermediate evaluation.
+   */
+   template< typename TT2 >  // Type of the target dense tensor
+   friend inline EnableIf_t< UseAssign_v<TT2> >
+      subAssign( DenseTensor<TT2>& lhs, const DTensDVecMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense tensor operand
+      RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.pages()   == rhs.lhs_.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( B.size() == rhs.rhs_.size(), "Invalid vector size" );
+
+      subAssign( ~lhs, map<RF>( A, B, rhs.op_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Schur product assignment to dense tensors**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Schur product assignment of a broadcasting map expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side map expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized Schur product assignment of a
+   // broadcasting map expression to a dense tensor. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case
+   // either of the two operands requires an intermediate evaluation.
+   */
+   template< typename TT2 >  // Type of the target dense tensor
+   friend inline EnableIf_t< UseAssign_v<TT2> >
+      schurAssign( DenseTensor<TT2>& lhs, const DTensDVecMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense tensor operand
+      RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.pages()   == rhs.lhs_.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( B.size() == rhs.rhs_.size(), "Invalid vector size" );
+
+      schurAssign( ~lhs, map<RF>( A, B, rhs.op_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense tensors************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a broadcasting map expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side map expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a
+   // broadcasting map expression to a dense tensor. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case
+   // the expression specific parallel evaluation strategy is selected.
+   */
+   template< typename TT2 >  // Type of the target dense tensor
+   friend inline EnableIf_t< UseSMPAssign_v<TT2> >
+      smpAssign( DenseTensor<TT2>& lhs, const DTensDVecMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense tensor operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.pages()   == rhs.lhs_.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( B.size() == rhs.rhs_.size(), "Invalid vector size" );
+
+      smpAssign( ~lhs, map<RF>( A, B, rhs.op_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense tensors***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a broadcasting map expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side map expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a
+   // broadcasting map expression to a dense tensor. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case
+   // the expression specific parallel evaluation strategy is selected.
+   */
+   template< typename TT2 >  // Type of the target dense tensor
+   friend inline EnableIf_t< UseSMPAssign_v<TT2> >
+      smpAddAssign( DenseTensor<TT2>& lhs, const DTensDVecMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense tensor operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.pages()   == rhs.lhs_.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( B.size() == rhs.rhs_.size(), "Invalid vector size" );
+
+      smpAddAssign( ~lhs, map<RF>( A, B, rhs.op_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense tensors************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a broadcasting map expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side map expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a
+   // broadcasting map expression to a dense tensor. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case
+   // the expression specific parallel evaluation strategy is selected.
+   */
+   template< typename TT2 >  // Type of the target dense tensor
+   friend inline EnableIf_t< UseSMPAssign_v<TT2> >
+      smpSubAssign( DenseTensor<TT2>& lhs, const DTensDVecMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense tensor operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.pages()   == rhs.lhs_.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( B.size() == rhs.rhs_.size(), "Invalid vector size" );
+
+      smpSubAssign( ~lhs, map<RF>( A, B, rhs.op_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP Schur product assignment to dense tensors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP Schur product assignment of a broadcasting map expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side map expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized SMP Schur product assignment of a
+   // broadcasting map expression to a dense tensor. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case
+   // the expression specific parallel evaluation strategy is selected.
+   */
+   template< typename TT2 >  // Type of the target dense tensor
+   friend inline EnableIf_t< UseSMPAssign_v<TT2> >
+      smpSchurAssign( DenseTensor<TT2>& lhs, const DTensDVecMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense tensor operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.pages()   == rhs.lhs_.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( B.size() == rhs.rhs_.size(), "Invalid vector size" );
+
+      smpSchurAssign( ~lhs, map<RF>( A, B, rhs.op_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_TENSOR_TYPE( TT );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( VT );
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Evaluates the given binary operation between the dense tensor \a lhs and the dense
+//        vector \a rhs, which is broadcast along all dimensions except \a RF.
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side dense tensor operand.
+// \param rhs The right-hand side dense vector operand.
+// \param op The custom, binary operation.
+// \return The binary operation applied to each element of \a lhs and the broadcast \a rhs.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The \a map() function evaluates the given binary operation on each element of the input
+// tensor \a lhs and the corresponding element of the input vector \a rhs. The size of the
+// vector has to match the extent of the dimension specified by \a RF, i.e. the tensor element
+// \f$ (k,i,j) \f$ is combined with the vector element \f$ j \f$ for \a blaze::rowwise, with
+// \f$ i \f$ for \a blaze::columnwise and with \f$ k \f$ for \a blaze::pagewise. The following
+// example demonstrates the scaling of each page of a tensor by a separate factor:
+
+   \code
+   blaze::DynamicTensor<double> A, B;
+   blaze::DynamicVector<double> factors;
+   // ... Resizing and initialization
+   B = map<pagewise>( A, factors, []( double x, double f ){ return x * f; } );
+   \endcode
+
+// The function returns an expression representing this operation. The expanded tensor is
+// never created: In case of a rowwise broadcast the vector is combined with each row of the
+// tensor by means of SIMD operations, in all other cases each vector element is loaded once
+// per row of the tensor and kept in a register. In case the size of \a rhs does not match
+// the extent of the dimension specified by \a RF, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< size_t RF      // Reduction flag
+        , typename TT    // Type of the left-hand side dense tensor
+        , typename VT    // Type of the right-hand side dense vector
+        , bool TF        // Transpose flag of the right-hand side dense vector
+        , typename OP >  // Type of the custom operation
+inline decltype(auto)
+   map( const DenseTensor<TT>& lhs, const DenseVector<VT,TF>& rhs, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   const size_t N( RF == rowwise    ? (~lhs).columns()
+                 : RF == columnwise ? (~lhs).rows()
+                 :                    (~lhs).pages() );
+
+   if( (~rhs).size() != N ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   using ReturnType = const DTensDVecMapExpr<TT,VT,RF,OP>;
+   return ReturnType( ~lhs, ~rhs, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Broadcasting addition of the dense vector \a rhs to the dense tensor \a lhs.
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side dense tensor operand.
+// \param rhs The right-hand side dense vector operand.
+// \return The sum of \a lhs and the broadcast \a rhs.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function adds the dense vector \a rhs to each fiber of the dense tensor \a lhs along
+// the dimension specified by \a RF (see the map() function). Example:
+
+   \code
+   blaze::DynamicTensor<double> A, C;
+   blaze::DynamicVector<double> bias;
+   // ... Resizing and initialization
+   C = add<rowwise>( A, bias );  // Adds bias to each row of A
+   \endcode
+*/
+template< size_t RF     // Reduction flag
+        , typename TT   // Type of the left-hand side dense tensor
+        , typename VT   // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag of the right-hand side dense vector
+inline decltype(auto)
+   add( const DenseTensor<TT>& lhs, const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return map<RF>( ~lhs, ~rhs, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Broadcasting subtraction of the dense vector \a rhs from the dense tensor \a lhs.
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side dense tensor operand.
+// \param rhs The right-hand side dense vector operand.
+// \return The difference of \a lhs and the broadcast \a rhs.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function subtracts the dense vector \a rhs from each fiber of the dense tensor \a lhs
+// along the dimension specified by \a RF (see the map() function).
+*/
+template< size_t RF     // Reduction flag
+        , typename TT   // Type of the left-hand side dense tensor
+        , typename VT   // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag of the right-hand side dense vector
+inline decltype(auto)
+   sub( const DenseTensor<TT>& lhs, const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return map<RF>( ~lhs, ~rhs, Sub() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Broadcasting Schur product of the dense tensor \a lhs and the dense vector \a rhs.
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side dense tensor operand.
+// \param rhs The right-hand side dense vector operand.
+// \return The componentwise product of \a lhs and the broadcast \a rhs.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function multiplies each fiber of the dense tensor \a lhs along the dimension
+// specified by \a RF componentwise with the dense vector \a rhs (see the map() function).
+*/
+template< size_t RF     // Reduction flag
+        , typename TT   // Type of the left-hand side dense tensor
+        , typename VT   // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag of the right-hand side dense vector
+inline decltype(auto)
+   schur( const DenseTensor<TT>& lhs, const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return map<RF>( ~lhs, ~rhs, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Broadcasting division of the dense tensor \a lhs by the dense vector \a rhs.
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side dense tensor operand.
+// \param rhs The right-hand side dense vector operand.
+// \return The componentwise quotient of \a lhs and the broadcast \a rhs.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function divides each fiber of the dense tensor \a lhs along the dimension specified
+// by \a RF componentwise by the dense vector \a rhs (see the map() function).
+*/
+template< size_t RF     // Reduction flag
+        , typename TT   // Type of the left-hand side dense tensor
+        , typename VT   // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag of the right-hand side dense vector
+inline decltype(auto)
+   div( const DenseTensor<TT>& lhs, const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return map<RF>( ~lhs, ~rhs, Div() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Broadcasting componentwise minimum of the dense tensor \a lhs and the dense vector
+//        \a rhs.
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side dense tensor operand.
+// \param rhs The right-hand side dense vector operand.
+// \return The componentwise minimum of \a lhs and the broadcast \a rhs.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function computes the componentwise minimum of each fiber of the dense tensor \a lhs
+// along the dimension specified by \a RF and the dense vector \a rhs (see the map() function).
+*/
+template< size_t RF     // Reduction flag
+        , typename TT   // Type of the left-hand side dense tensor
+        , typename VT   // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag of the right-hand side dense vector
+inline decltype(auto)
+   min( const DenseTensor<TT>& lhs, const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return map<RF>( ~lhs, ~rhs, Min() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Broadcasting componentwise maximum of the dense tensor \a lhs and the dense vector
+//        \a rhs.
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side dense tensor operand.
+// \param rhs The right-hand side dense vector operand.
+// \return The componentwise maximum of \a lhs and the broadcast \a rhs.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function computes the componentwise maximum of each fiber of the dense tensor \a lhs
+// along the dimension specified by \a RF and the dense vector \a rhs (see the map() function).
+// The following example applies a rectifier with a separate threshold per page of a tensor:
+
+   \code
+   blaze::DynamicTensor<double> A, C;
+   blaze::DynamicVector<double> threshold;
+   // ... Resizing and initialization
+   C = max<pagewise>( A, threshold );
+   \endcode
+*/
+template< size_t RF     // Reduction flag
+        , typename TT   // Type of the left-hand side dense tensor
+        , typename VT   // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag of the right-hand side dense vector
+inline decltype(auto)
+   max( const DenseTensor<TT>& lhs, const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return map<RF>( ~lhs, ~rhs, Max() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISALIGNED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename TT, typename VT, size_t RF, typename OP >
+struct IsAligned< DTensDVecMapExpr<TT,VT,RF,OP> >
+   : public BoolConstant< IsAligned_v<TT> && ( RF != rowwise || IsAligned_v<VT> ) >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
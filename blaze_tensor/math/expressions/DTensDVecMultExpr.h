@@ -79,6 +79,7 @@
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/constraints/SameType.h>
@@ -86,6 +87,8 @@
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/mpl/If.h>
+#include <blaze/util/NumericCast.h>
+#include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/IsComplex.h>
@@ -101,6 +104,7 @@
 #include <blaze_tensor/math/expressions/DenseTensor.h>
 #include <blaze_tensor/math/expressions/TensVecMultExpr.h>
 #include <blaze_tensor/math/traits/MultTrait.h>
+#include <blaze_tensor/math/traits/TemporaryTrait.h>
 #include <blaze_tensor/math/views/PageSlice.h>
 #include <blaze_tensor/math/views/RowSlice.h>
 #include <blaze_tensor/math/views/Subtensor.h>
@@ -219,10 +223,10 @@ class DTensDVecMultExpr
    using RightOperand = If_t< IsExpression_v<VT>, const VT, const VT& >;
 
    //! Type for the assignment of the left-hand side dense tensor operand.
-   using LT = If_t< evaluateTensor, const TRT, TCT >;
+   using LT = If_t< evaluateTensor, const TemporaryTrait_t<TRT>, TCT >;
 
    //! Type for the assignment of the right-hand side dense vector operand.
-   using RT = If_t< evaluateVector, const VRT, VCT >;
+   using RT = If_t< evaluateVector, const TemporaryTrait_t<VRT>, VCT >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -500,213 +504,90 @@ class DTensDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
-   ////**Vectorized default assignment to dense vectors (small tensors)*****************************
-   ///*! \cond BLAZE_INTERNAL */
-   ///*!\brief Vectorized default assignment of a small dense tensor-dense vector multiplication
-   ////        (\f$ \vec{y}=A*\vec{x} \f$).
-   //// \ingroup dense_vector
-   ////
-   //// \param y The target left-hand side dense matrix.
-   //// \param A The left-hand side dense tensor operand.
-   //// \param x The right-hand side dense vector operand.
-   //// \return void
-   ////
-   //// This function implements the vectorized default assignment kernel for the dense tensor-
-   //// dense vector multiplication. This kernel is optimized for small tensors.
-   //*/
-   //template< typename MT1    // Type of the left-hand side target vector
-   //        , typename TT1    // Type of the left-hand side tensor operand
-   //        , typename VT1 >  // Type of the right-hand side vector operand
-   //static inline auto selectSmallAssignKernel( MT1& y, const TT1& A, const VT1& x )
-   //   -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
-   //{
-   //   constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT1> );
-
-   //   const size_t M( A.rows()    );
-   //   const size_t N( A.columns() );
-
-   //   size_t i( 0UL );
-
-   //   for( ; (i+8UL) <= M; i+=8UL )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i+7UL : i+8UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-   //      size_t j( jbegin );
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         xmm1 += A.load(i    ,j) * x1;
-   //         xmm2 += A.load(i+1UL,j) * x1;
-   //         xmm3 += A.load(i+2UL,j) * x1;
-   //         xmm4 += A.load(i+3UL,j) * x1;
-   //         xmm5 += A.load(i+4UL,j) * x1;
-   //         xmm6 += A.load(i+5UL,j) * x1;
-   //         xmm7 += A.load(i+6UL,j) * x1;
-   //         xmm8 += A.load(i+7UL,j) * x1;
-   //      }
-
-   //      y[i    ] = sum( xmm1 );
-   //      y[i+1UL] = sum( xmm2 );
-   //      y[i+2UL] = sum( xmm3 );
-   //      y[i+3UL] = sum( xmm4 );
-   //      y[i+4UL] = sum( xmm5 );
-   //      y[i+5UL] = sum( xmm6 );
-   //      y[i+6UL] = sum( xmm7 );
-   //      y[i+7UL] = sum( xmm8 );
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i    ] += A(i    ,j) * x[j];
-   //         y[i+1UL] += A(i+1UL,j) * x[j];
-   //         y[i+2UL] += A(i+2UL,j) * x[j];
-   //         y[i+3UL] += A(i+3UL,j) * x[j];
-   //         y[i+4UL] += A(i+4UL,j) * x[j];
-   //         y[i+5UL] += A(i+5UL,j) * x[j];
-   //         y[i+6UL] += A(i+6UL,j) * x[j];
-   //         y[i+7UL] += A(i+7UL,j) * x[j];
-   //      }
-   //   }
-
-   //   for( ; (i+4UL) <= M; i+=4UL )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i+3UL : i+4UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      SIMDType xmm1, xmm2, xmm3, xmm4;
-   //      size_t j( jbegin );
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         xmm1 += A.load(i    ,j) * x1;
-   //         xmm2 += A.load(i+1UL,j) * x1;
-   //         xmm3 += A.load(i+2UL,j) * x1;
-   //         xmm4 += A.load(i+3UL,j) * x1;
-   //      }
-
-   //      y[i    ] = sum( xmm1 );
-   //      y[i+1UL] = sum( xmm2 );
-   //      y[i+2UL] = sum( xmm3 );
-   //      y[i+3UL] = sum( xmm4 );
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i    ] += A(i    ,j) * x[j];
-   //         y[i+1UL] += A(i+1UL,j) * x[j];
-   //         y[i+2UL] += A(i+2UL,j) * x[j];
-   //         y[i+3UL] += A(i+3UL,j) * x[j];
-   //      }
-   //   }
-
-   //   for( ; (i+3UL) <= M; i+=3UL )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i+2UL : i+3UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      SIMDType xmm1, xmm2, xmm3;
-   //      size_t j( jbegin );
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         xmm1 += A.load(i    ,j) * x1;
-   //         xmm2 += A.load(i+1UL,j) * x1;
-   //         xmm3 += A.load(i+2UL,j) * x1;
-   //      }
-
-   //      y[i    ] = sum( xmm1 );
-   //      y[i+1UL] = sum( xmm2 );
-   //      y[i+2UL] = sum( xmm3 );
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i    ] += A(i    ,j) * x[j];
-   //         y[i+1UL] += A(i+1UL,j) * x[j];
-   //         y[i+2UL] += A(i+2UL,j) * x[j];
-   //      }
-   //   }
-
-   //   for( ; (i+2UL) <= M; i+=2UL )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i+1UL : i+2UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      SIMDType xmm1, xmm2;
-   //      size_t j( jbegin );
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         xmm1 += A.load(i    ,j) * x1;
-   //         xmm2 += A.load(i+1UL,j) * x1;
-   //      }
-
-   //      y[i    ] = sum( xmm1 );
-   //      y[i+1UL] = sum( xmm2 );
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i    ] += A(i    ,j) * x[j];
-   //         y[i+1UL] += A(i+1UL,j) * x[j];
-   //      }
-   //   }
-
-   //   if( i < M )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i : i+1UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      SIMDType xmm1;
-   //      size_t j( jbegin );
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         xmm1 += A.load(i,j) * x.load(j);
-   //      }
-
-   //      y[i] = sum( xmm1 );
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i] += A(i,j) * x[j];
-   //      }
-   //   }
-   //}
-   ///*! \endcond */
-   ////**********************************************************************************************
+   //**Vectorized default assignment to dense vectors (small tensors)******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized default assignment of a small dense tensor-dense vector
+   //        multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the vectorized default assignment kernel for the dense
+   // tensor-dense vector multiplication. This kernel is optimized for small tensors. The rows
+   // of all pages of the tensor are traversed as the rows of a single (pages*rows) x columns
+   // matrix, four of them at a time, such that each SIMD load of \a x is reused four times.
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline auto selectSmallAssignKernel( MT1& y, const TT1& A, const VT1& x )
+      -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
+   {
+      constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT1> );
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t R( A.pages() * M );
+
+      const size_t jpos( remainder ? ( N & size_t(-SIMDSIZE) ) : N );
+      BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+      size_t r( 0UL );
+
+      for( ; (r+4UL) <= R; r+=4UL )
+      {
+         const size_t k1( (r    )/M ), i1( (r    )%M );
+         const size_t k2( (r+1UL)/M ), i2( (r+1UL)%M );
+         const size_t k3( (r+2UL)/M ), i3( (r+2UL)%M );
+         const size_t k4( (r+3UL)/M ), i4( (r+3UL)%M );
+
+         SIMDType xmm1, xmm2, xmm3, xmm4;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            const SIMDType x1( x.load(j) );
+            xmm1 += A.load(k1,i1,j) * x1;
+            xmm2 += A.load(k2,i2,j) * x1;
+            xmm3 += A.load(k3,i3,j) * x1;
+            xmm4 += A.load(k4,i4,j) * x1;
+         }
+
+         y(k1,i1) = sum( xmm1 );
+         y(k2,i2) = sum( xmm2 );
+         y(k3,i3) = sum( xmm3 );
+         y(k4,i4) = sum( xmm4 );
+
+         for( ; remainder && j<N; ++j ) {
+            y(k1,i1) += A(k1,i1,j) * x[j];
+            y(k2,i2) += A(k2,i2,j) * x[j];
+            y(k3,i3) += A(k3,i3,j) * x[j];
+            y(k4,i4) += A(k4,i4,j) * x[j];
+         }
+      }
+
+      for( ; r<R; ++r )
+      {
+         const size_t k( r/M ), i( r%M );
+
+         SIMDType xmm1;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            xmm1 += A.load(k,i,j) * x.load(j);
+         }
+
+         y(k,i) = sum( xmm1 );
+
+         for( ; remainder && j<N; ++j ) {
+            y(k,i) += A(k,i,j) * x[j];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
 
    //**Default assignment to dense vectors (large tensors)****************************************
    /*! \cond BLAZE_INTERNAL */
@@ -733,253 +614,32 @@ class DTensDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
-   ////**Vectorized default assignment to dense vectors (large tensors)*****************************
-   ///*! \cond BLAZE_INTERNAL */
-   ///*!\brief Vectorized default assignment of a large dense tensor-dense vector multiplication
-   ////        (\f$ \vec{y}=A*\vec{x} \f$).
-   //// \ingroup dense_vector
-   ////
-   //// \param y The target left-hand side dense vector.
-   //// \param A The left-hand side dense tensor operand.
-   //// \param x The right-hand side dense vector operand.
-   //// \return void
-   ////
-   //// This function implements the vectorized default assignment kernel for the dense tensor-
-   //// dense vector multiplication. This kernel is optimized for large tensors.
-   //*/
-   //template< typename MT1    // Type of the left-hand side target matrix
-   //        , typename TT1    // Type of the left-hand side tensor operand
-   //        , typename VT1 >  // Type of the right-hand side vector operand
-   //static inline auto selectLargeAssignKernel( MT1& y, const TT1& A, const VT1& x )
-   //   -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
-   //{
-   //   constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT1> );
-
-   //   const size_t M( A.rows()    );
-   //   const size_t N( A.columns() );
-
-   //   reset( y );
-
-   //   size_t i( 0UL );
-
-   //   for( ; (i+8UL) <= M; i+=8UL )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i+7UL : i+8UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      size_t j( jbegin );
-
-   //      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-   //         const size_t j1( j+SIMDSIZE     );
-   //         const size_t j2( j+SIMDSIZE*2UL );
-   //         const size_t j3( j+SIMDSIZE*3UL );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         const SIMDType x3( x.load(j2) );
-   //         const SIMDType x4( x.load(j3) );
-   //         y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 + A.load(i    ,j2) * x3 + A.load(i    ,j3) * x4 );
-   //         y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 + A.load(i+1UL,j2) * x3 + A.load(i+1UL,j3) * x4 );
-   //         y[i+2UL] += sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 + A.load(i+2UL,j2) * x3 + A.load(i+2UL,j3) * x4 );
-   //         y[i+3UL] += sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 + A.load(i+3UL,j2) * x3 + A.load(i+3UL,j3) * x4 );
-   //         y[i+4UL] += sum( A.load(i+4UL,j) * x1 + A.load(i+4UL,j1) * x2 + A.load(i+4UL,j2) * x3 + A.load(i+4UL,j3) * x4 );
-   //         y[i+5UL] += sum( A.load(i+5UL,j) * x1 + A.load(i+5UL,j1) * x2 + A.load(i+5UL,j2) * x3 + A.load(i+5UL,j3) * x4 );
-   //         y[i+6UL] += sum( A.load(i+6UL,j) * x1 + A.load(i+6UL,j1) * x2 + A.load(i+6UL,j2) * x3 + A.load(i+6UL,j3) * x4 );
-   //         y[i+7UL] += sum( A.load(i+7UL,j) * x1 + A.load(i+7UL,j1) * x2 + A.load(i+7UL,j2) * x3 + A.load(i+7UL,j3) * x4 );
-   //      }
-
-   //      for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-   //         const size_t j1( j+SIMDSIZE );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 );
-   //         y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 );
-   //         y[i+2UL] += sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 );
-   //         y[i+3UL] += sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 );
-   //         y[i+4UL] += sum( A.load(i+4UL,j) * x1 + A.load(i+4UL,j1) * x2 );
-   //         y[i+5UL] += sum( A.load(i+5UL,j) * x1 + A.load(i+5UL,j1) * x2 );
-   //         y[i+6UL] += sum( A.load(i+6UL,j) * x1 + A.load(i+6UL,j1) * x2 );
-   //         y[i+7UL] += sum( A.load(i+7UL,j) * x1 + A.load(i+7UL,j1) * x2 );
-   //      }
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         y[i    ] += sum( A.load(i    ,j) * x1 );
-   //         y[i+1UL] += sum( A.load(i+1UL,j) * x1 );
-   //         y[i+2UL] += sum( A.load(i+2UL,j) * x1 );
-   //         y[i+3UL] += sum( A.load(i+3UL,j) * x1 );
-   //         y[i+4UL] += sum( A.load(i+4UL,j) * x1 );
-   //         y[i+5UL] += sum( A.load(i+5UL,j) * x1 );
-   //         y[i+6UL] += sum( A.load(i+6UL,j) * x1 );
-   //         y[i+7UL] += sum( A.load(i+7UL,j) * x1 );
-   //      }
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i    ] += A(i    ,j) * x[j];
-   //         y[i+1UL] += A(i+1UL,j) * x[j];
-   //         y[i+2UL] += A(i+2UL,j) * x[j];
-   //         y[i+3UL] += A(i+3UL,j) * x[j];
-   //         y[i+4UL] += A(i+4UL,j) * x[j];
-   //         y[i+5UL] += A(i+5UL,j) * x[j];
-   //         y[i+6UL] += A(i+6UL,j) * x[j];
-   //         y[i+7UL] += A(i+7UL,j) * x[j];
-   //      }
-   //   }
-
-   //   for( ; (i+4UL) <= M; i+=4UL )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i+3UL : i+4UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      size_t j( jbegin );
-
-   //      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-   //         const size_t j1( j+SIMDSIZE     );
-   //         const size_t j2( j+SIMDSIZE*2UL );
-   //         const size_t j3( j+SIMDSIZE*3UL );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         const SIMDType x3( x.load(j2) );
-   //         const SIMDType x4( x.load(j3) );
-   //         y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 + A.load(i    ,j2) * x3 + A.load(i    ,j3) * x4 );
-   //         y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 + A.load(i+1UL,j2) * x3 + A.load(i+1UL,j3) * x4 );
-   //         y[i+2UL] += sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 + A.load(i+2UL,j2) * x3 + A.load(i+2UL,j3) * x4 );
-   //         y[i+3UL] += sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 + A.load(i+3UL,j2) * x3 + A.load(i+3UL,j3) * x4 );
-   //      }
-
-   //      for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-   //         const size_t j1( j+SIMDSIZE );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 );
-   //         y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 );
-   //         y[i+2UL] += sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 );
-   //         y[i+3UL] += sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 );
-   //      }
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         y[i    ] += sum( A.load(i    ,j) * x1 );
-   //         y[i+1UL] += sum( A.load(i+1UL,j) * x1 );
-   //         y[i+2UL] += sum( A.load(i+2UL,j) * x1 );
-   //         y[i+3UL] += sum( A.load(i+3UL,j) * x1 );
-   //      }
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i    ] += A(i    ,j) * x[j];
-   //         y[i+1UL] += A(i+1UL,j) * x[j];
-   //         y[i+2UL] += A(i+2UL,j) * x[j];
-   //         y[i+3UL] += A(i+3UL,j) * x[j];
-   //      }
-   //   }
-
-   //   for( ; (i+2UL) <= M; i+=2UL )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i+1UL : i+2UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      size_t j( jbegin );
-
-   //      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-   //         const size_t j1( j+SIMDSIZE     );
-   //         const size_t j2( j+SIMDSIZE*2UL );
-   //         const size_t j3( j+SIMDSIZE*3UL );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         const SIMDType x3( x.load(j2) );
-   //         const SIMDType x4( x.load(j3) );
-   //         y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 + A.load(i    ,j2) * x3 + A.load(i    ,j3) * x4 );
-   //         y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 + A.load(i+1UL,j2) * x3 + A.load(i+1UL,j3) * x4 );
-   //      }
-
-   //      for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-   //         const size_t j1( j+SIMDSIZE );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 );
-   //         y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 );
-   //      }
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         y[i    ] += sum( A.load(i    ,j) * x1 );
-   //         y[i+1UL] += sum( A.load(i+1UL,j) * x1 );
-   //      }
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i    ] += A(i    ,j) * x[j];
-   //         y[i+1UL] += A(i+1UL,j) * x[j];
-   //      }
-   //   }
-
-   //   if( i < M )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i : i+1UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      size_t j( jbegin );
-
-   //      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-   //         const size_t j1( j+SIMDSIZE     );
-   //         const size_t j2( j+SIMDSIZE*2UL );
-   //         const size_t j3( j+SIMDSIZE*3UL );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         const SIMDType x3( x.load(j2) );
-   //         const SIMDType x4( x.load(j3) );
-   //         y[i] += sum( A.load(i,j) * x1 + A.load(i,j1) * x2 + A.load(i,j2) * x3 + A.load(i,j3) * x4 );
-   //      }
-
-   //      for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-   //         const size_t j1( j+SIMDSIZE );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         y[i] += sum( A.load(i,j) * x1 + A.load(i,j1) * x2 );
-   //      }
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         y[i] += sum( A.load(i,j) * x1 );
-   //      }
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i] += A(i,j) * x[j];
-   //      }
-   //   }
-   //}
-   ///*! \endcond */
-   ////**********************************************************************************************
+   //**Vectorized default assignment to dense vectors (large tensors)******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized default assignment of a large dense tensor-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the vectorized default assignment kernel for the dense tensor-
+   // dense vector multiplication. This kernel is optimized for large tensors.
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline auto selectLargeAssignKernel( MT1& y, const TT1& A, const VT1& x )
+      -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
+   {
+      reset( y );
+
+      selectLargeAddAssignKernel( y, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
 
    //**BLAS-based assignment to dense vectors (default)********************************************
    /*! \cond BLAZE_INTERNAL */
@@ -1008,36 +668,38 @@ class DTensDVecMultExpr
 
    //**BLAS-based assignment to dense vectors******************************************************
 #if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_TENSOR_VECTOR_MULTIPLICATION
-   ///*! \cond BLAZE_INTERNAL */
-   ///*!\brief BLAS-based assignment of a dense tensor-dense vector multiplication
-   ////        (\f$ \vec{y}=A*\vec{x} \f$).
-   //// \ingroup dense_vector
-   ////
-   //// \param y The target left-hand side dense vector.
-   //// \param A The left-hand side dense tensor operand.
-   //// \param x The right-hand side dense vector operand.
-   //// \return void
-   ////
-   //// This function performs the dense tensor-dense vector multiplication based on the according
-   //// BLAS functionality.
-   //*/
-   //template< typename MT1    // Type of the left-hand side target vector
-   //        , typename TT1    // Type of the left-hand side tensor operand
-   //        , typename VT1 >  // Type of the right-hand side vector operand
-   //static inline auto selectBlasAssignKernel( MT1& y, const TT1& A, const VT1& x )
-   //   -> EnableIf_t< UseBlasKernel_v<MT1,TT1,VT1> >
-   //{
-   //   using ET = ElementType_t<MT1>;
-
-   //   if( IsTriangular_v<TT1> ) {
-   //      assign( y, x );
-   //      trmv( y, A, ( IsLower_v<TT1> )?( CblasLower ):( CblasUpper ) );
-   //   }
-   //   else {
-   //      gemv( y, A, x, ET(1), ET(0) );
-   //   }
-   //}
-   ///*! \endcond */
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief BLAS-based assignment of a dense tensor-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the dense tensor-dense vector multiplication based on the according
+   // BLAS functionality. Each page of \a A is a row-major matrix with leading dimension
+   // \c A.spacing(), which is multiplied with \a x into the according row of \a y.
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline auto selectBlasAssignKernel( MT1& y, const TT1& A, const VT1& x )
+      -> EnableIf_t< UseBlasKernel_v<MT1,TT1,VT1> >
+   {
+      using ET = ElementType_t<MT1>;
+
+      const int M  ( numeric_cast<int>( A.rows()    ) );
+      const int N  ( numeric_cast<int>( A.columns() ) );
+      const int lda( numeric_cast<int>( A.spacing() ) );
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         gemv( CblasRowMajor, CblasNoTrans, M, N, ET(1), A.data(0UL,k), lda,
+               x.data(), 1, ET(0), y.data(k), 1 );
+      }
+   }
+   /*! \endcond */
 #endif
    //**********************************************************************************************
 
@@ -1183,213 +845,90 @@ class DTensDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
-   ////**Vectorized default addition assignment to dense vectors (small tensors)********************
-   ///*! \cond BLAZE_INTERNAL */
-   ///*!\brief Vectorized default addition assignment of a small dense tensor-dense vector
-   ////        multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
-   //// \ingroup dense_vector
-   ////
-   //// \param y The target left-hand side dense vector.
-   //// \param A The left-hand side dense tensor operand.
-   //// \param x The right-hand side dense vector operand.
-   //// \return void
-   ////
-   //// This function implements the vectorized default addition assignment kernel for the dense
-   //// tensor-dense vector multiplication. This kernel is optimized for small tensors.
-   //*/
-   //template< typename MT1    // Type of the left-hand side target vector
-   //        , typename TT1    // Type of the left-hand side tensor operand
-   //        , typename VT1 >  // Type of the right-hand side vector operand
-   //static inline auto selectSmallAddAssignKernel( MT1& y, const TT1& A, const VT1& x )
-   //   -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
-   //{
-   //   constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT1> );
-
-   //   const size_t M( A.rows()    );
-   //   const size_t N( A.columns() );
-
-   //   size_t i( 0UL );
-
-   //   for( ; (i+8UL) <= M; i+=8UL )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i+7UL : i+8UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-   //      size_t j( jbegin );
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         xmm1 += A.load(i    ,j) * x1;
-   //         xmm2 += A.load(i+1UL,j) * x1;
-   //         xmm3 += A.load(i+2UL,j) * x1;
-   //         xmm4 += A.load(i+3UL,j) * x1;
-   //         xmm5 += A.load(i+4UL,j) * x1;
-   //         xmm6 += A.load(i+5UL,j) * x1;
-   //         xmm7 += A.load(i+6UL,j) * x1;
-   //         xmm8 += A.load(i+7UL,j) * x1;
-   //      }
-
-   //      y[i    ] += sum( xmm1 );
-   //      y[i+1UL] += sum( xmm2 );
-   //      y[i+2UL] += sum( xmm3 );
-   //      y[i+3UL] += sum( xmm4 );
-   //      y[i+4UL] += sum( xmm5 );
-   //      y[i+5UL] += sum( xmm6 );
-   //      y[i+6UL] += sum( xmm7 );
-   //      y[i+7UL] += sum( xmm8 );
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i    ] += A(i    ,j) * x[j];
-   //         y[i+1UL] += A(i+1UL,j) * x[j];
-   //         y[i+2UL] += A(i+2UL,j) * x[j];
-   //         y[i+3UL] += A(i+3UL,j) * x[j];
-   //         y[i+4UL] += A(i+4UL,j) * x[j];
-   //         y[i+5UL] += A(i+5UL,j) * x[j];
-   //         y[i+6UL] += A(i+6UL,j) * x[j];
-   //         y[i+7UL] += A(i+7UL,j) * x[j];
-   //      }
-   //   }
-
-   //   for( ; (i+4UL) <= M; i+=4UL )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i+3UL : i+4UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      SIMDType xmm1, xmm2, xmm3, xmm4;
-   //      size_t j( jbegin );
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         xmm1 += A.load(i    ,j) * x1;
-   //         xmm2 += A.load(i+1UL,j) * x1;
-   //         xmm3 += A.load(i+2UL,j) * x1;
-   //         xmm4 += A.load(i+3UL,j) * x1;
-   //      }
-
-   //      y[i    ] += sum( xmm1 );
-   //      y[i+1UL] += sum( xmm2 );
-   //      y[i+2UL] += sum( xmm3 );
-   //      y[i+3UL] += sum( xmm4 );
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i    ] += A(i    ,j) * x[j];
-   //         y[i+1UL] += A(i+1UL,j) * x[j];
-   //         y[i+2UL] += A(i+2UL,j) * x[j];
-   //         y[i+3UL] += A(i+3UL,j) * x[j];
-   //      }
-   //   }
-
-   //   for( ; (i+3UL) <= M; i+=3UL )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i+2UL : i+3UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      SIMDType xmm1, xmm2, xmm3;
-   //      size_t j( jbegin );
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         xmm1 += A.load(i    ,j) * x1;
-   //         xmm2 += A.load(i+1UL,j) * x1;
-   //         xmm3 += A.load(i+2UL,j) * x1;
-   //      }
-
-   //      y[i    ] += sum( xmm1 );
-   //      y[i+1UL] += sum( xmm2 );
-   //      y[i+2UL] += sum( xmm3 );
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i    ] += A(i    ,j) * x[j];
-   //         y[i+1UL] += A(i+1UL,j) * x[j];
-   //         y[i+2UL] += A(i+2UL,j) * x[j];
-   //      }
-   //   }
-
-   //   for( ; (i+2UL) <= M; i+=2UL )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i+1UL : i+2UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      SIMDType xmm1, xmm2;
-   //      size_t j( jbegin );
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         xmm1 += A.load(i    ,j) * x1;
-   //         xmm2 += A.load(i+1UL,j) * x1;
-   //      }
-
-   //      y[i    ] += sum( xmm1 );
-   //      y[i+1UL] += sum( xmm2 );
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i    ] += A(i    ,j) * x[j];
-   //         y[i+1UL] += A(i+1UL,j) * x[j];
-   //      }
-   //   }
-
-   //   if( i < M )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i : i+1UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      SIMDType xmm1;
-   //      size_t j( jbegin );
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         xmm1 += A.load(i,j) * x.load(j);
-   //      }
-
-   //      y[i] += sum( xmm1 );
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i] += A(i,j) * x[j];
-   //      }
-   //   }
-   //}
-   ///*! \endcond */
-   ////**********************************************************************************************
+   //**Vectorized default addition assignment to dense vectors (small tensors)*********************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized default addition assignment of a small dense tensor-dense vector
+   //        multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the vectorized default addition assignment kernel for the dense
+   // tensor-dense vector multiplication. This kernel is optimized for small tensors. The rows
+   // of all pages of the tensor are traversed as the rows of a single (pages*rows) x columns
+   // matrix, four of them at a time, such that each SIMD load of \a x is reused four times.
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline auto selectSmallAddAssignKernel( MT1& y, const TT1& A, const VT1& x )
+      -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
+   {
+      constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT1> );
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t R( A.pages() * M );
+
+      const size_t jpos( remainder ? ( N & size_t(-SIMDSIZE) ) : N );
+      BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+      size_t r( 0UL );
+
+      for( ; (r+4UL) <= R; r+=4UL )
+      {
+         const size_t k1( (r    )/M ), i1( (r    )%M );
+         const size_t k2( (r+1UL)/M ), i2( (r+1UL)%M );
+         const size_t k3( (r+2UL)/M ), i3( (r+2UL)%M );
+         const size_t k4( (r+3UL)/M ), i4( (r+3UL)%M );
+
+         SIMDType xmm1, xmm2, xmm3, xmm4;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            const SIMDType x1( x.load(j) );
+            xmm1 += A.load(k1,i1,j) * x1;
+            xmm2 += A.load(k2,i2,j) * x1;
+            xmm3 += A.load(k3,i3,j) * x1;
+            xmm4 += A.load(k4,i4,j) * x1;
+         }
+
+         y(k1,i1) += sum( xmm1 );
+         y(k2,i2) += sum( xmm2 );
+         y(k3,i3) += sum( xmm3 );
+         y(k4,i4) += sum( xmm4 );
+
+         for( ; remainder && j<N; ++j ) {
+            y(k1,i1) += A(k1,i1,j) * x[j];
+            y(k2,i2) += A(k2,i2,j) * x[j];
+            y(k3,i3) += A(k3,i3,j) * x[j];
+            y(k4,i4) += A(k4,i4,j) * x[j];
+         }
+      }
+
+      for( ; r<R; ++r )
+      {
+         const size_t k( r/M ), i( r%M );
+
+         SIMDType xmm1;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            xmm1 += A.load(k,i,j) * x.load(j);
+         }
+
+         y(k,i) += sum( xmm1 );
+
+         for( ; remainder && j<N; ++j ) {
+            y(k,i) += A(k,i,j) * x[j];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
 
    //**Default addition assignment to dense vectors (large tensors)*******************************
    /*! \cond BLAZE_INTERNAL */
@@ -1416,251 +955,97 @@ class DTensDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
-   ////**Vectorized default addition assignment to dense vectors (large tensors)********************
-   ///*! \cond BLAZE_INTERNAL */
-   ///*!\brief Vectorized default addition assignment of a large dense tensor-dense vector
-   ////        multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
-   //// \ingroup dense_vector
-   ////
-   //// \param y The target left-hand side dense vector.
-   //// \param A The left-hand side dense tensor operand.
-   //// \param x The right-hand side dense vector operand.
-   //// \return void
-   ////
-   //// This function implements the vectorized default addition assignment kernel for the dense
-   //// tensor-dense vector multiplication. This kernel is optimized for large tensors.
-   //*/
-   //template< typename MT1    // Type of the left-hand side target vector
-   //        , typename TT1    // Type of the left-hand side tensor operand
-   //        , typename VT1 >  // Type of the right-hand side vector operand
-   //static inline auto selectLargeAddAssignKernel( MT1& y, const TT1& A, const VT1& x )
-   //   -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
-   //{
-   //   constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT1> );
-
-   //   const size_t M( A.rows()    );
-   //   const size_t N( A.columns() );
-
-   //   size_t i( 0UL );
-
-   //   for( ; (i+8UL) <= M; i+=8UL )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i+7UL : i+8UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      size_t j( jbegin );
-
-   //      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-   //         const size_t j1( j+SIMDSIZE     );
-   //         const size_t j2( j+SIMDSIZE*2UL );
-   //         const size_t j3( j+SIMDSIZE*3UL );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         const SIMDType x3( x.load(j2) );
-   //         const SIMDType x4( x.load(j3) );
-   //         y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 + A.load(i    ,j2) * x3 + A.load(i    ,j3) * x4 );
-   //         y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 + A.load(i+1UL,j2) * x3 + A.load(i+1UL,j3) * x4 );
-   //         y[i+2UL] += sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 + A.load(i+2UL,j2) * x3 + A.load(i+2UL,j3) * x4 );
-   //         y[i+3UL] += sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 + A.load(i+3UL,j2) * x3 + A.load(i+3UL,j3) * x4 );
-   //         y[i+4UL] += sum( A.load(i+4UL,j) * x1 + A.load(i+4UL,j1) * x2 + A.load(i+4UL,j2) * x3 + A.load(i+4UL,j3) * x4 );
-   //         y[i+5UL] += sum( A.load(i+5UL,j) * x1 + A.load(i+5UL,j1) * x2 + A.load(i+5UL,j2) * x3 + A.load(i+5UL,j3) * x4 );
-   //         y[i+6UL] += sum( A.load(i+6UL,j) * x1 + A.load(i+6UL,j1) * x2 + A.load(i+6UL,j2) * x3 + A.load(i+6UL,j3) * x4 );
-   //         y[i+7UL] += sum( A.load(i+7UL,j) * x1 + A.load(i+7UL,j1) * x2 + A.load(i+7UL,j2) * x3 + A.load(i+7UL,j3) * x4 );
-   //      }
-
-   //      for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-   //         const size_t j1( j+SIMDSIZE );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 );
-   //         y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 );
-   //         y[i+2UL] += sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 );
-   //         y[i+3UL] += sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 );
-   //         y[i+4UL] += sum( A.load(i+4UL,j) * x1 + A.load(i+4UL,j1) * x2 );
-   //         y[i+5UL] += sum( A.load(i+5UL,j) * x1 + A.load(i+5UL,j1) * x2 );
-   //         y[i+6UL] += sum( A.load(i+6UL,j) * x1 + A.load(i+6UL,j1) * x2 );
-   //         y[i+7UL] += sum( A.load(i+7UL,j) * x1 + A.load(i+7UL,j1) * x2 );
-   //      }
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         y[i    ] += sum( A.load(i    ,j) * x1 );
-   //         y[i+1UL] += sum( A.load(i+1UL,j) * x1 );
-   //         y[i+2UL] += sum( A.load(i+2UL,j) * x1 );
-   //         y[i+3UL] += sum( A.load(i+3UL,j) * x1 );
-   //         y[i+4UL] += sum( A.load(i+4UL,j) * x1 );
-   //         y[i+5UL] += sum( A.load(i+5UL,j) * x1 );
-   //         y[i+6UL] += sum( A.load(i+6UL,j) * x1 );
-   //         y[i+7UL] += sum( A.load(i+7UL,j) * x1 );
-   //      }
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i    ] += A(i    ,j) * x[j];
-   //         y[i+1UL] += A(i+1UL,j) * x[j];
-   //         y[i+2UL] += A(i+2UL,j) * x[j];
-   //         y[i+3UL] += A(i+3UL,j) * x[j];
-   //         y[i+4UL] += A(i+4UL,j) * x[j];
-   //         y[i+5UL] += A(i+5UL,j) * x[j];
-   //         y[i+6UL] += A(i+6UL,j) * x[j];
-   //         y[i+7UL] += A(i+7UL,j) * x[j];
-   //      }
-   //   }
-
-   //   for( ; (i+4UL) <= M; i+=4UL )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i+3UL : i+4UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      size_t j( jbegin );
-
-   //      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-   //         const size_t j1( j+SIMDSIZE     );
-   //         const size_t j2( j+SIMDSIZE*2UL );
-   //         const size_t j3( j+SIMDSIZE*3UL );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         const SIMDType x3( x.load(j2) );
-   //         const SIMDType x4( x.load(j3) );
-   //         y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 + A.load(i    ,j2) * x3 + A.load(i    ,j3) * x4 );
-   //         y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 + A.load(i+1UL,j2) * x3 + A.load(i+1UL,j3) * x4 );
-   //         y[i+2UL] += sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 + A.load(i+2UL,j2) * x3 + A.load(i+2UL,j3) * x4 );
-   //         y[i+3UL] += sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 + A.load(i+3UL,j2) * x3 + A.load(i+3UL,j3) * x4 );
-   //      }
-
-   //      for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-   //         const size_t j1( j+SIMDSIZE );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 );
-   //         y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 );
-   //         y[i+2UL] += sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 );
-   //         y[i+3UL] += sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 );
-   //      }
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         y[i    ] += sum( A.load(i    ,j) * x1 );
-   //         y[i+1UL] += sum( A.load(i+1UL,j) * x1 );
-   //         y[i+2UL] += sum( A.load(i+2UL,j) * x1 );
-   //         y[i+3UL] += sum( A.load(i+3UL,j) * x1 );
-   //      }
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i    ] += A(i    ,j) * x[j];
-   //         y[i+1UL] += A(i+1UL,j) * x[j];
-   //         y[i+2UL] += A(i+2UL,j) * x[j];
-   //         y[i+3UL] += A(i+3UL,j) * x[j];
-   //      }
-   //   }
-
-   //   for( ; (i+2UL) <= M; i+=2UL )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i+1UL : i+2UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      size_t j( jbegin );
-
-   //      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-   //         const size_t j1( j+SIMDSIZE     );
-   //         const size_t j2( j+SIMDSIZE*2UL );
-   //         const size_t j3( j+SIMDSIZE*3UL );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         const SIMDType x3( x.load(j2) );
-   //         const SIMDType x4( x.load(j3) );
-   //         y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 + A.load(i    ,j2) * x3 + A.load(i    ,j3) * x4 );
-   //         y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 + A.load(i+1UL,j2) * x3 + A.load(i+1UL,j3) * x4 );
-   //      }
-
-   //      for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-   //         const size_t j1( j+SIMDSIZE );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 );
-   //         y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 );
-   //      }
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         y[i    ] += sum( A.load(i    ,j) * x1 );
-   //         y[i+1UL] += sum( A.load(i+1UL,j) * x1 );
-   //      }
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i    ] += A(i    ,j) * x[j];
-   //         y[i+1UL] += A(i+1UL,j) * x[j];
-   //      }
-   //   }
-
-   //   if( i < M )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i : i+1UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      size_t j( jbegin );
-
-   //      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-   //         const size_t j1( j+SIMDSIZE     );
-   //         const size_t j2( j+SIMDSIZE*2UL );
-   //         const size_t j3( j+SIMDSIZE*3UL );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         const SIMDType x3( x.load(j2) );
-   //         const SIMDType x4( x.load(j3) );
-   //         y[i] += sum( A.load(i,j) * x1 + A.load(i,j1) * x2 + A.load(i,j2) * x3 + A.load(i,j3) * x4 );
-   //      }
-
-   //      for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-   //         const size_t j1( j+SIMDSIZE );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         y[i] += sum( A.load(i,j) * x1 + A.load(i,j1) * x2 );
-   //      }
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         y[i] += sum( A.load(i,j) * x1 );
-   //      }
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i] += A(i,j) * x[j];
-   //      }
-   //   }
-   //}
-   ///*! \endcond */
-   ////**********************************************************************************************
+   //**Vectorized default addition assignment to dense vectors (large tensors)*********************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized default addition assignment of a large dense tensor-dense vector
+   //        multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the vectorized default addition assignment kernel for the dense
+   // tensor-dense vector multiplication. This kernel is optimized for large tensors. In contrast
+   // to the small tensor kernel the columns are processed in panels, such that the currently
+   // used part of \a x remains in the L1 cache while it is reused for all rows of the tensor.
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline auto selectLargeAddAssignKernel( MT1& y, const TT1& A, const VT1& x )
+      -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
+   {
+      constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT1> );
+      constexpr size_t jblock( ( 16384UL / sizeof( ElementType ) ) & size_t(-SIMDSIZE) );
+
+      BLAZE_STATIC_ASSERT( jblock >= SIMDSIZE );
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t R( A.pages() * M );
+
+      for( size_t jj=0UL; jj<N; jj+=jblock )
+      {
+         const size_t jend( min( jj+jblock, N ) );
+         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
+         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+         size_t r( 0UL );
+
+         for( ; (r+4UL) <= R; r+=4UL )
+         {
+            const size_t k1( (r    )/M ), i1( (r    )%M );
+            const size_t k2( (r+1UL)/M ), i2( (r+1UL)%M );
+            const size_t k3( (r+2UL)/M ), i3( (r+2UL)%M );
+            const size_t k4( (r+3UL)/M ), i4( (r+3UL)%M );
+
+            SIMDType xmm1, xmm2, xmm3, xmm4;
+            size_t j( jj );
+
+            for( ; j<jpos; j+=SIMDSIZE ) {
+               const SIMDType x1( x.load(j) );
+               xmm1 += A.load(k1,i1,j) * x1;
+               xmm2 += A.load(k2,i2,j) * x1;
+               xmm3 += A.load(k3,i3,j) * x1;
+               xmm4 += A.load(k4,i4,j) * x1;
+            }
+
+            y(k1,i1) += sum( xmm1 );
+            y(k2,i2) += sum( xmm2 );
+            y(k3,i3) += sum( xmm3 );
+            y(k4,i4) += sum( xmm4 );
+
+            for( ; remainder && j<jend; ++j ) {
+               y(k1,i1) += A(k1,i1,j) * x[j];
+               y(k2,i2) += A(k2,i2,j) * x[j];
+               y(k3,i3) += A(k3,i3,j) * x[j];
+               y(k4,i4) += A(k4,i4,j) * x[j];
+            }
+         }
+
+         for( ; r<R; ++r )
+         {
+            const size_t k( r/M ), i( r%M );
+
+            SIMDType xmm1;
+            size_t j( jj );
+
+            for( ; j<jpos; j+=SIMDSIZE ) {
+               xmm1 += A.load(k,i,j) * x.load(j);
+            }
+
+            y(k,i) += sum( xmm1 );
+
+            for( ; remainder && j<jend; ++j ) {
+               y(k,i) += A(k,i,j) * x[j];
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
 
    //**BLAS-based addition assignment to dense vectors (default)***********************************
    /*! \cond BLAZE_INTERNAL */
@@ -1689,37 +1074,38 @@ class DTensDVecMultExpr
 
    //**BLAS-based addition assignment to dense vectors*********************************************
 #if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_TENSOR_VECTOR_MULTIPLICATION
-   ///*! \cond BLAZE_INTERNAL */
-   ///*!\brief BLAS-based addition assignment of a tensor-vector multiplication
-   ////        (\f$ \vec{y}+=A*\vec{x} \f$).
-   //// \ingroup dense_vector
-   ////
-   //// \param y The target left-hand side dense vector.
-   //// \param A The left-hand side dense tensor operand.
-   //// \param x The right-hand side dense vector operand.
-   //// \return void
-   ////
-   //// This function performs the dense tensor-dense vector multiplication based on the according
-   //// BLAS functionality.
-   //*/
-   //template< typename MT1    // Type of the left-hand side target vector
-   //        , typename TT1    // Type of the left-hand side tensor operand
-   //        , typename VT1 >  // Type of the right-hand side vector operand
-   //static inline auto selectBlasAddAssignKernel( MT1& y, const TT1& A, const VT1& x )
-   //   -> EnableIf_t< UseBlasKernel_v<MT1,TT1,VT1> >
-   //{
-   //   using ET = ElementType_t<MT1>;
-
-   //   if( IsTriangular_v<TT1> ) {
-   //      ResultType_t<MT1> tmp( serial( x ) );
-   //      trmv( tmp, A, ( IsLower_v<TT1> )?( CblasLower ):( CblasUpper ) );
-   //      addAssign( y, tmp );
-   //   }
-   //   else {
-   //      gemv( y, A, x, ET(1), ET(1) );
-   //   }
-   //}
-   ///*! \endcond */
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief BLAS-based addition assignment of a dense tensor-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the dense tensor-dense vector multiplication based on the according
+   // BLAS functionality. Each page of \a A is a row-major matrix with leading dimension
+   // \c A.spacing(), which is multiplied with \a x into the according row of \a y.
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline auto selectBlasAddAssignKernel( MT1& y, const TT1& A, const VT1& x )
+      -> EnableIf_t< UseBlasKernel_v<MT1,TT1,VT1> >
+   {
+      using ET = ElementType_t<MT1>;
+
+      const int M  ( numeric_cast<int>( A.rows()    ) );
+      const int N  ( numeric_cast<int>( A.columns() ) );
+      const int lda( numeric_cast<int>( A.spacing() ) );
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         gemv( CblasRowMajor, CblasNoTrans, M, N, ET(1), A.data(0UL,k), lda,
+               x.data(), 1, ET(1), y.data(k), 1 );
+      }
+   }
+   /*! \endcond */
 #endif
    //**********************************************************************************************
 
@@ -1839,213 +1225,90 @@ class DTensDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
-   ////**Vectorized default subtraction assignment to dense vectors (small tensors)*****************
-   ///*! \cond BLAZE_INTERNAL */
-   ///*!\brief Vectorized default subtraction assignment of a small dense tensor-dense vector
-   ////        multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
-   //// \ingroup dense_vector
-   ////
-   //// \param y The target left-hand side dense vector.
-   //// \param A The left-hand side dense tensor operand.
-   //// \param x The right-hand side dense vector operand.
-   //// \return void
-   ////
-   //// This function implements the vectorized default subtraction assignment kernel for the dense
-   //// tensor-dense vector multiplication. This kernel is optimized for small tensors.
-   //*/
-   //template< typename MT1    // Type of the left-hand side target vector
-   //        , typename TT1    // Type of the left-hand side tensor operand
-   //        , typename VT1 >  // Type of the right-hand side vector operand
-   //static inline auto selectSmallSubAssignKernel( MT1& y, const TT1& A, const VT1& x )
-   //   -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
-   //{
-   //   constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT1> );
-
-   //   const size_t M( A.rows()    );
-   //   const size_t N( A.columns() );
-
-   //   size_t i( 0UL );
-
-   //   for( ; (i+8UL) <= M; i+=8UL )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i+7UL : i+8UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-   //      size_t j( jbegin );
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         xmm1 += A.load(i    ,j) * x1;
-   //         xmm2 += A.load(i+1UL,j) * x1;
-   //         xmm3 += A.load(i+2UL,j) * x1;
-   //         xmm4 += A.load(i+3UL,j) * x1;
-   //         xmm5 += A.load(i+4UL,j) * x1;
-   //         xmm6 += A.load(i+5UL,j) * x1;
-   //         xmm7 += A.load(i+6UL,j) * x1;
-   //         xmm8 += A.load(i+7UL,j) * x1;
-   //      }
-
-   //      y[i    ] -= sum( xmm1 );
-   //      y[i+1UL] -= sum( xmm2 );
-   //      y[i+2UL] -= sum( xmm3 );
-   //      y[i+3UL] -= sum( xmm4 );
-   //      y[i+4UL] -= sum( xmm5 );
-   //      y[i+5UL] -= sum( xmm6 );
-   //      y[i+6UL] -= sum( xmm7 );
-   //      y[i+7UL] -= sum( xmm8 );
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i    ] -= A(i    ,j) * x[j];
-   //         y[i+1UL] -= A(i+1UL,j) * x[j];
-   //         y[i+2UL] -= A(i+2UL,j) * x[j];
-   //         y[i+3UL] -= A(i+3UL,j) * x[j];
-   //         y[i+4UL] -= A(i+4UL,j) * x[j];
-   //         y[i+5UL] -= A(i+5UL,j) * x[j];
-   //         y[i+6UL] -= A(i+6UL,j) * x[j];
-   //         y[i+7UL] -= A(i+7UL,j) * x[j];
-   //      }
-   //   }
-
-   //   for( ; (i+4UL) <= M; i+=4UL )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i+3UL : i+4UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      SIMDType xmm1, xmm2, xmm3, xmm4;
-   //      size_t j( jbegin );
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         xmm1 += A.load(i    ,j) * x1;
-   //         xmm2 += A.load(i+1UL,j) * x1;
-   //         xmm3 += A.load(i+2UL,j) * x1;
-   //         xmm4 += A.load(i+3UL,j) * x1;
-   //      }
-
-   //      y[i    ] -= sum( xmm1 );
-   //      y[i+1UL] -= sum( xmm2 );
-   //      y[i+2UL] -= sum( xmm3 );
-   //      y[i+3UL] -= sum( xmm4 );
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i    ] -= A(i    ,j) * x[j];
-   //         y[i+1UL] -= A(i+1UL,j) * x[j];
-   //         y[i+2UL] -= A(i+2UL,j) * x[j];
-   //         y[i+3UL] -= A(i+3UL,j) * x[j];
-   //      }
-   //   }
-
-   //   for( ; (i+3UL) <= M; i+=3UL )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i+2UL : i+3UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      SIMDType xmm1, xmm2, xmm3;
-   //      size_t j( jbegin );
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         xmm1 += A.load(i    ,j) * x1;
-   //         xmm2 += A.load(i+1UL,j) * x1;
-   //         xmm3 += A.load(i+2UL,j) * x1;
-   //      }
-
-   //      y[i    ] -= sum( xmm1 );
-   //      y[i+1UL] -= sum( xmm2 );
-   //      y[i+2UL] -= sum( xmm3 );
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i    ] -= A(i    ,j) * x[j];
-   //         y[i+1UL] -= A(i+1UL,j) * x[j];
-   //         y[i+2UL] -= A(i+2UL,j) * x[j];
-   //      }
-   //   }
-
-   //   for( ; (i+2UL) <= M; i+=2UL )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i+1UL : i+2UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      SIMDType xmm1, xmm2;
-   //      size_t j( jbegin );
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         xmm1 += A.load(i    ,j) * x1;
-   //         xmm2 += A.load(i+1UL,j) * x1;
-   //      }
-
-   //      y[i    ] -= sum( xmm1 );
-   //      y[i+1UL] -= sum( xmm2 );
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i    ] -= A(i    ,j) * x[j];
-   //         y[i+1UL] -= A(i+1UL,j) * x[j];
-   //      }
-   //   }
-
-   //   if( i < M )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i : i+1UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      SIMDType xmm1;
-   //      size_t j( jbegin );
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         xmm1 += A.load(i,j) * x.load(j);
-   //      }
-
-   //      y[i] -= sum( xmm1 );
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i] -= A(i,j) * x[j];
-   //      }
-   //   }
-   //}
-   ///*! \endcond */
-   ////**********************************************************************************************
+   //**Vectorized default subtraction assignment to dense vectors (small tensors)******************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized default subtraction assignment of a small dense tensor-dense vector
+   //        multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the vectorized default subtraction assignment kernel for the dense
+   // tensor-dense vector multiplication. This kernel is optimized for small tensors. The rows
+   // of all pages of the tensor are traversed as the rows of a single (pages*rows) x columns
+   // matrix, four of them at a time, such that each SIMD load of \a x is reused four times.
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline auto selectSmallSubAssignKernel( MT1& y, const TT1& A, const VT1& x )
+      -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
+   {
+      constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT1> );
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t R( A.pages() * M );
+
+      const size_t jpos( remainder ? ( N & size_t(-SIMDSIZE) ) : N );
+      BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+      size_t r( 0UL );
+
+      for( ; (r+4UL) <= R; r+=4UL )
+      {
+         const size_t k1( (r    )/M ), i1( (r    )%M );
+         const size_t k2( (r+1UL)/M ), i2( (r+1UL)%M );
+         const size_t k3( (r+2UL)/M ), i3( (r+2UL)%M );
+         const size_t k4( (r+3UL)/M ), i4( (r+3UL)%M );
+
+         SIMDType xmm1, xmm2, xmm3, xmm4;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            const SIMDType x1( x.load(j) );
+            xmm1 += A.load(k1,i1,j) * x1;
+            xmm2 += A.load(k2,i2,j) * x1;
+            xmm3 += A.load(k3,i3,j) * x1;
+            xmm4 += A.load(k4,i4,j) * x1;
+         }
+
+         y(k1,i1) -= sum( xmm1 );
+         y(k2,i2) -= sum( xmm2 );
+         y(k3,i3) -= sum( xmm3 );
+         y(k4,i4) -= sum( xmm4 );
+
+         for( ; remainder && j<N; ++j ) {
+            y(k1,i1) -= A(k1,i1,j) * x[j];
+            y(k2,i2) -= A(k2,i2,j) * x[j];
+            y(k3,i3) -= A(k3,i3,j) * x[j];
+            y(k4,i4) -= A(k4,i4,j) * x[j];
+         }
+      }
+
+      for( ; r<R; ++r )
+      {
+         const size_t k( r/M ), i( r%M );
+
+         SIMDType xmm1;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            xmm1 += A.load(k,i,j) * x.load(j);
+         }
+
+         y(k,i) -= sum( xmm1 );
+
+         for( ; remainder && j<N; ++j ) {
+            y(k,i) -= A(k,i,j) * x[j];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
 
    //**Default subtraction assignment to dense vectors (large tensors)****************************
    /*! \cond BLAZE_INTERNAL */
@@ -2072,251 +1335,97 @@ class DTensDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
-   ////**Vectorized default subtraction assignment to dense vectors (large tensors)*****************
-   ///*! \cond BLAZE_INTERNAL */
-   ///*!\brief Vectorized default subtraction assignment of a large dense tensor-dense vector
-   ////        multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
-   //// \ingroup dense_vector
-   ////
-   //// \param y The target left-hand side dense vector.
-   //// \param A The left-hand side dense tensor operand.
-   //// \param x The right-hand side dense vector operand.
-   //// \return void
-   ////
-   //// This function implements the vectorized default subtraction assignment kernel for the dense
-   //// tensor-dense vector multiplication. This kernel is optimized for large tensors.
-   //*/
-   //template< typename MT1    // Type of the left-hand side target vector
-   //        , typename TT1    // Type of the left-hand side tensor operand
-   //        , typename VT1 >  // Type of the right-hand side vector operand
-   //static inline auto selectLargeSubAssignKernel( MT1& y, const TT1& A, const VT1& x )
-   //   -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
-   //{
-   //   constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT1> );
-
-   //   const size_t M( A.rows()    );
-   //   const size_t N( A.columns() );
-
-   //   size_t i( 0UL );
-
-   //   for( ; (i+8UL) <= M; i+=8UL )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i+7UL : i+8UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      size_t j( jbegin );
-
-   //      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-   //         const size_t j1( j+SIMDSIZE     );
-   //         const size_t j2( j+SIMDSIZE*2UL );
-   //         const size_t j3( j+SIMDSIZE*3UL );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         const SIMDType x3( x.load(j2) );
-   //         const SIMDType x4( x.load(j3) );
-   //         y[i    ] -= sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 + A.load(i    ,j2) * x3 + A.load(i    ,j3) * x4 );
-   //         y[i+1UL] -= sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 + A.load(i+1UL,j2) * x3 + A.load(i+1UL,j3) * x4 );
-   //         y[i+2UL] -= sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 + A.load(i+2UL,j2) * x3 + A.load(i+2UL,j3) * x4 );
-   //         y[i+3UL] -= sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 + A.load(i+3UL,j2) * x3 + A.load(i+3UL,j3) * x4 );
-   //         y[i+4UL] -= sum( A.load(i+4UL,j) * x1 + A.load(i+4UL,j1) * x2 + A.load(i+4UL,j2) * x3 + A.load(i+4UL,j3) * x4 );
-   //         y[i+5UL] -= sum( A.load(i+5UL,j) * x1 + A.load(i+5UL,j1) * x2 + A.load(i+5UL,j2) * x3 + A.load(i+5UL,j3) * x4 );
-   //         y[i+6UL] -= sum( A.load(i+6UL,j) * x1 + A.load(i+6UL,j1) * x2 + A.load(i+6UL,j2) * x3 + A.load(i+6UL,j3) * x4 );
-   //         y[i+7UL] -= sum( A.load(i+7UL,j) * x1 + A.load(i+7UL,j1) * x2 + A.load(i+7UL,j2) * x3 + A.load(i+7UL,j3) * x4 );
-   //      }
-
-   //      for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-   //         const size_t j1( j+SIMDSIZE );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         y[i    ] -= sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 );
-   //         y[i+1UL] -= sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 );
-   //         y[i+2UL] -= sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 );
-   //         y[i+3UL] -= sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 );
-   //         y[i+4UL] -= sum( A.load(i+4UL,j) * x1 + A.load(i+4UL,j1) * x2 );
-   //         y[i+5UL] -= sum( A.load(i+5UL,j) * x1 + A.load(i+5UL,j1) * x2 );
-   //         y[i+6UL] -= sum( A.load(i+6UL,j) * x1 + A.load(i+6UL,j1) * x2 );
-   //         y[i+7UL] -= sum( A.load(i+7UL,j) * x1 + A.load(i+7UL,j1) * x2 );
-   //      }
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         y[i    ] -= sum( A.load(i    ,j) * x1 );
-   //         y[i+1UL] -= sum( A.load(i+1UL,j) * x1 );
-   //         y[i+2UL] -= sum( A.load(i+2UL,j) * x1 );
-   //         y[i+3UL] -= sum( A.load(i+3UL,j) * x1 );
-   //         y[i+4UL] -= sum( A.load(i+4UL,j) * x1 );
-   //         y[i+5UL] -= sum( A.load(i+5UL,j) * x1 );
-   //         y[i+6UL] -= sum( A.load(i+6UL,j) * x1 );
-   //         y[i+7UL] -= sum( A.load(i+7UL,j) * x1 );
-   //      }
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i    ] -= A(i    ,j) * x[j];
-   //         y[i+1UL] -= A(i+1UL,j) * x[j];
-   //         y[i+2UL] -= A(i+2UL,j) * x[j];
-   //         y[i+3UL] -= A(i+3UL,j) * x[j];
-   //         y[i+4UL] -= A(i+4UL,j) * x[j];
-   //         y[i+5UL] -= A(i+5UL,j) * x[j];
-   //         y[i+6UL] -= A(i+6UL,j) * x[j];
-   //         y[i+7UL] -= A(i+7UL,j) * x[j];
-   //      }
-   //   }
-
-   //   for( ; (i+4UL) <= M; i+=4UL )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i+3UL : i+4UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      size_t j( jbegin );
-
-   //      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-   //         const size_t j1( j+SIMDSIZE     );
-   //         const size_t j2( j+SIMDSIZE*2UL );
-   //         const size_t j3( j+SIMDSIZE*3UL );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         const SIMDType x3( x.load(j2) );
-   //         const SIMDType x4( x.load(j3) );
-   //         y[i    ] -= sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 + A.load(i    ,j2) * x3 + A.load(i    ,j3) * x4 );
-   //         y[i+1UL] -= sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 + A.load(i+1UL,j2) * x3 + A.load(i+1UL,j3) * x4 );
-   //         y[i+2UL] -= sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 + A.load(i+2UL,j2) * x3 + A.load(i+2UL,j3) * x4 );
-   //         y[i+3UL] -= sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 + A.load(i+3UL,j2) * x3 + A.load(i+3UL,j3) * x4 );
-   //      }
-
-   //      for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-   //         const size_t j1( j+SIMDSIZE );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         y[i    ] -= sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 );
-   //         y[i+1UL] -= sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 );
-   //         y[i+2UL] -= sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 );
-   //         y[i+3UL] -= sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 );
-   //      }
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         y[i    ] -= sum( A.load(i    ,j) * x1 );
-   //         y[i+1UL] -= sum( A.load(i+1UL,j) * x1 );
-   //         y[i+2UL] -= sum( A.load(i+2UL,j) * x1 );
-   //         y[i+3UL] -= sum( A.load(i+3UL,j) * x1 );
-   //      }
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i    ] -= A(i    ,j) * x[j];
-   //         y[i+1UL] -= A(i+1UL,j) * x[j];
-   //         y[i+2UL] -= A(i+2UL,j) * x[j];
-   //         y[i+3UL] -= A(i+3UL,j) * x[j];
-   //      }
-   //   }
-
-   //   for( ; (i+2UL) <= M; i+=2UL )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i+1UL : i+2UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      size_t j( jbegin );
-
-   //      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-   //         const size_t j1( j+SIMDSIZE     );
-   //         const size_t j2( j+SIMDSIZE*2UL );
-   //         const size_t j3( j+SIMDSIZE*3UL );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         const SIMDType x3( x.load(j2) );
-   //         const SIMDType x4( x.load(j3) );
-   //         y[i    ] -= sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 + A.load(i    ,j2) * x3 + A.load(i    ,j3) * x4 );
-   //         y[i+1UL] -= sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 + A.load(i+1UL,j2) * x3 + A.load(i+1UL,j3) * x4 );
-   //      }
-
-   //      for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-   //         const size_t j1( j+SIMDSIZE );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         y[i    ] -= sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 );
-   //         y[i+1UL] -= sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 );
-   //      }
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         y[i    ] -= sum( A.load(i    ,j) * x1 );
-   //         y[i+1UL] -= sum( A.load(i+1UL,j) * x1 );
-   //      }
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i    ] -= A(i    ,j) * x[j];
-   //         y[i+1UL] -= A(i+1UL,j) * x[j];
-   //      }
-   //   }
-
-   //   if( i < M )
-   //   {
-   //      const size_t jbegin( ( IsUpper_v<TT1> )
-   //                           ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-   //                           :( 0UL ) );
-   //      const size_t jend( ( IsLower_v<TT1> )
-   //                         ?( IsStrictlyLower_v<TT1> ? i : i+1UL )
-   //                         :( N ) );
-   //      BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-
-   //      const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-   //      BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-   //      size_t j( jbegin );
-
-   //      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-   //         const size_t j1( j+SIMDSIZE     );
-   //         const size_t j2( j+SIMDSIZE*2UL );
-   //         const size_t j3( j+SIMDSIZE*3UL );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         const SIMDType x3( x.load(j2) );
-   //         const SIMDType x4( x.load(j3) );
-   //         y[i] -= sum( A.load(i,j) * x1 + A.load(i,j1) * x2 + A.load(i,j2) * x3 + A.load(i,j3) * x4 );
-   //      }
-
-   //      for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-   //         const size_t j1( j+SIMDSIZE );
-   //         const SIMDType x1( x.load(j ) );
-   //         const SIMDType x2( x.load(j1) );
-   //         y[i] -= sum( A.load(i,j) * x1 + A.load(i,j1) * x2 );
-   //      }
-
-   //      for( ; j<jpos; j+=SIMDSIZE ) {
-   //         const SIMDType x1( x.load(j) );
-   //         y[i] -= sum( A.load(i,j) * x1 );
-   //      }
-
-   //      for( ; remainder && j<jend; ++j ) {
-   //         y[i] -= A(i,j) * x[j];
-   //      }
-   //   }
-   //}
-   ///*! \endcond */
-   ////**********************************************************************************************
+   //**Vectorized default subtraction assignment to dense vectors (large tensors)******************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized default subtraction assignment of a large dense tensor-dense vector
+   //        multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the vectorized default subtraction assignment kernel for the dense
+   // tensor-dense vector multiplication. This kernel is optimized for large tensors. In contrast
+   // to the small tensor kernel the columns are processed in panels, such that the currently
+   // used part of \a x remains in the L1 cache while it is reused for all rows of the tensor.
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline auto selectLargeSubAssignKernel( MT1& y, const TT1& A, const VT1& x )
+      -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1> >
+   {
+      constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT1> );
+      constexpr size_t jblock( ( 16384UL / sizeof( ElementType ) ) & size_t(-SIMDSIZE) );
+
+      BLAZE_STATIC_ASSERT( jblock >= SIMDSIZE );
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t R( A.pages() * M );
+
+      for( size_t jj=0UL; jj<N; jj+=jblock )
+      {
+         const size_t jend( min( jj+jblock, N ) );
+         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
+         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+         size_t r( 0UL );
+
+         for( ; (r+4UL) <= R; r+=4UL )
+         {
+            const size_t k1( (r    )/M ), i1( (r    )%M );
+            const size_t k2( (r+1UL)/M ), i2( (r+1UL)%M );
+            const size_t k3( (r+2UL)/M ), i3( (r+2UL)%M );
+            const size_t k4( (r+3UL)/M ), i4( (r+3UL)%M );
+
+            SIMDType xmm1, xmm2, xmm3, xmm4;
+            size_t j( jj );
+
+            for( ; j<jpos; j+=SIMDSIZE ) {
+               const SIMDType x1( x.load(j) );
+               xmm1 += A.load(k1,i1,j) * x1;
+               xmm2 += A.load(k2,i2,j) * x1;
+               xmm3 += A.load(k3,i3,j) * x1;
+               xmm4 += A.load(k4,i4,j) * x1;
+            }
+
+            y(k1,i1) -= sum( xmm1 );
+            y(k2,i2) -= sum( xmm2 );
+            y(k3,i3) -= sum( xmm3 );
+            y(k4,i4) -= sum( xmm4 );
+
+            for( ; remainder && j<jend; ++j ) {
+               y(k1,i1) -= A(k1,i1,j) * x[j];
+               y(k2,i2) -= A(k2,i2,j) * x[j];
+               y(k3,i3) -= A(k3,i3,j) * x[j];
+               y(k4,i4) -= A(k4,i4,j) * x[j];
+            }
+         }
+
+         for( ; r<R; ++r )
+         {
+            const size_t k( r/M ), i( r%M );
+
+            SIMDType xmm1;
+            size_t j( jj );
+
+            for( ; j<jpos; j+=SIMDSIZE ) {
+               xmm1 += A.load(k,i,j) * x.load(j);
+            }
+
+            y(k,i) -= sum( xmm1 );
+
+            for( ; remainder && j<jend; ++j ) {
+               y(k,i) -= A(k,i,j) * x[j];
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
 
    //**BLAS-based subtraction assignment to dense matrices (default)********************************
    /*! \cond BLAZE_INTERNAL */
@@ -2345,37 +1454,38 @@ class DTensDVecMultExpr
 
    //**BLAS-based subtraction assignment to dense vectors******************************************
 #if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_TENSOR_VECTOR_MULTIPLICATION
-   ///*! \cond BLAZE_INTERNAL */
-   ///*!\brief BLAS-based subtraction assignment of a tensor-vector multiplication
-   ////        (\f$ \vec{y}-=A*\vec{x} \f$).
-   //// \ingroup dense_vector
-   ////
-   //// \param y The target left-hand side dense vector.
-   //// \param A The left-hand side dense tensor operand.
-   //// \param x The right-hand side dense vector operand.
-   //// \return void
-   ////
-   //// This function performs the dense tensor-dense vector multiplication based on the according
-   //// BLAS functionality.
-   //*/
-   //template< typename MT1    // Type of the left-hand side target vector
-   //        , typename TT1    // Type of the left-hand side tensor operand
-   //        , typename VT1 >  // Type of the right-hand side vector operand
-   //static inline auto selectBlasSubAssignKernel( MT1& y, const TT1& A, const VT1& x )
-   //   -> EnableIf_t< UseBlasKernel_v<MT1,TT1,VT1> >
-   //{
-   //   using ET = ElementType_t<MT1>;
-
-   //   if( IsTriangular_v<TT1> ) {
-   //      ResultType_t<MT1> tmp( serial( x ) );
-   //      trmv( tmp, A, ( IsLower_v<TT1> )?( CblasLower ):( CblasUpper ) );
-   //      subAssign( y, tmp );
-   //   }
-   //   else {
-   //      gemv( y, A, x, ET(-1), ET(1) );
-   //   }
-   //}
-   ///*! \endcond */
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief BLAS-based subtraction assignment of a dense tensor-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function performs the dense tensor-dense vector multiplication based on the according
+   // BLAS functionality. Each page of \a A is a row-major matrix with leading dimension
+   // \c A.spacing(), which is multiplied with \a x into the according row of \a y.
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline auto selectBlasSubAssignKernel( MT1& y, const TT1& A, const VT1& x )
+      -> EnableIf_t< UseBlasKernel_v<MT1,TT1,VT1> >
+   {
+      using ET = ElementType_t<MT1>;
+
+      const int M  ( numeric_cast<int>( A.rows()    ) );
+      const int N  ( numeric_cast<int>( A.columns() ) );
+      const int lda( numeric_cast<int>( A.spacing() ) );
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         gemv( CblasRowMajor, CblasNoTrans, M, N, ET(-1), A.data(0UL,k), lda,
+               x.data(), 1, ET(1), y.data(k), 1 );
+      }
+   }
+   /*! \endcond */
 #endif
    //**********************************************************************************************
 
@@ -2409,7 +1519,7 @@ class DTensDVecMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryTrait_t<ResultType> tmp( serial( rhs ) );
       schurAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -2615,7 +1725,7 @@ class DTensDVecMultExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( rhs );
+      const TemporaryTrait_t<ResultType> tmp( rhs );
       smpSchurAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -2750,10 +1860,10 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    using RightOperand = ST;
 
    //! Type for the assignment of the dense tensor operand of the left-hand side expression.
-   using LT = If_t< evaluateTensor, const TRT, TCT >;
+   using LT = If_t< evaluateTensor, const TemporaryTrait_t<TRT>, TCT >;
 
    //! Type for the assignment of the dense vector operand of the left-hand side expression.
-   using RT = If_t< evaluateVector, const VRT, VCT >;
+   using RT = If_t< evaluateVector, const TemporaryTrait_t<VRT>, VCT >;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
@@ -2986,7 +2096,7 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    //        (\f$ \vec{y}=s*A*\vec{x} \f$).
    // \ingroup dense_vector
    //
-   // \param y The target left-hand side dense vector.
+   // \param y The target left-hand side dense matrix.
    // \param A The left-hand side dense tensor operand.
    // \param x The right-hand side dense vector operand.
    // \param scalar The scaling factor.
@@ -2999,19 +2109,18 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
            , typename TT1    // Type of the left-hand side tensor operand
            , typename VT1    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
-   static inline auto selectDefaultAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
-      -> EnableIf_t< !UseVectorizedDefaultKernel_v<MT1,TT1,VT1,ST2> >
+   static inline void selectDefaultAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
    {
       y.assign( A * x * scalar );
    }
    //**********************************************************************************************
 
-   //**Default assignment to dense vectors (small tensors)****************************************
+   //**Default assignment to dense vectors (small tensors)*****************************************
    /*!\brief Default assignment of a small scaled dense tensor-dense vector multiplication
    //        (\f$ \vec{y}=s*A*\vec{x} \f$).
    // \ingroup dense_vector
    //
-   // \param y The target left-hand side dense vector.
+   // \param y The target left-hand side dense matrix.
    // \param A The left-hand side dense tensor operand.
    // \param x The right-hand side dense vector operand.
    // \param scalar The scaling factor.
@@ -3020,7 +2129,7 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    // This function relays to the default implementation of the assignment of a scaled dense
    // tensor-dense vector multiplication expression to a dense vector.
    */
-   template< typename MT1    // Type of the left-hand side target vector
+   template< typename MT1    // Type of the left-hand side target matrix
            , typename TT1    // Type of the left-hand side tensor operand
            , typename VT1    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
@@ -3029,222 +2138,99 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    {
       selectDefaultAssignKernel( y, A, x, scalar );
    }
-//   //**********************************************************************************************
-//
-//   //**Vectorized default assignment to dense vectors (small tensors)*****************************
-//   /*!\brief Vectorized default assignment of a small scaled dense tensor-dense vector
-//   //        multiplication (\f$ \vec{y}=s*A*\vec{x} \f$).
-//   // \ingroup dense_vector
-//   //
-//   // \param y The target left-hand side dense vector.
-//   // \param A The left-hand side dense tensor operand.
-//   // \param x The right-hand side dense vector operand.
-//   // \param scalar The scaling factor.
-//   // \return void
-//   //
-//   // This function implements the vectorized default assignment kernel for the scaled dense
-//   // tensor-dense vector multiplication. This kernel is optimized for small tensors.
-//   */
-//   template< typename VT1    // Type of the left-hand side target vector
-//           , typename TT1    // Type of the left-hand side tensor operand
-//           , typename VT2    // Type of the right-hand side vector operand
-//           , typename ST2 >  // Type of the scalar value
-//   static inline auto selectSmallAssignKernel( VT1& y, const TT1& A, const VT2& x, ST2 scalar )
-//      -> EnableIf_t< UseVectorizedDefaultKernel_v<VT1,TT1,VT2,ST2> >
-//   {
-//      constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT2> );
-//
-//      const size_t M( A.rows()    );
-//      const size_t N( A.columns() );
-//
-//      size_t i( 0UL );
-//
-//      for( ; (i+8UL) <= M; i+=8UL )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i+7UL : i+8UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-//         size_t j( jbegin );
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            xmm1 += A.load(i    ,j) * x1;
-//            xmm2 += A.load(i+1UL,j) * x1;
-//            xmm3 += A.load(i+2UL,j) * x1;
-//            xmm4 += A.load(i+3UL,j) * x1;
-//            xmm5 += A.load(i+4UL,j) * x1;
-//            xmm6 += A.load(i+5UL,j) * x1;
-//            xmm7 += A.load(i+6UL,j) * x1;
-//            xmm8 += A.load(i+7UL,j) * x1;
-//         }
-//
-//         y[i    ] = sum( xmm1 ) * scalar;
-//         y[i+1UL] = sum( xmm2 ) * scalar;
-//         y[i+2UL] = sum( xmm3 ) * scalar;
-//         y[i+3UL] = sum( xmm4 ) * scalar;
-//         y[i+4UL] = sum( xmm5 ) * scalar;
-//         y[i+5UL] = sum( xmm6 ) * scalar;
-//         y[i+6UL] = sum( xmm7 ) * scalar;
-//         y[i+7UL] = sum( xmm8 ) * scalar;
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i    ] += A(i    ,j) * x[j] * scalar;
-//            y[i+1UL] += A(i+1UL,j) * x[j] * scalar;
-//            y[i+2UL] += A(i+2UL,j) * x[j] * scalar;
-//            y[i+3UL] += A(i+3UL,j) * x[j] * scalar;
-//            y[i+4UL] += A(i+4UL,j) * x[j] * scalar;
-//            y[i+5UL] += A(i+5UL,j) * x[j] * scalar;
-//            y[i+6UL] += A(i+6UL,j) * x[j] * scalar;
-//            y[i+7UL] += A(i+7UL,j) * x[j] * scalar;
-//         }
-//      }
-//
-//      for( ; (i+4UL) <= M; i+=4UL )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i+3UL : i+4UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         SIMDType xmm1, xmm2, xmm3, xmm4;
-//         size_t j( jbegin );
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            xmm1 += A.load(i    ,j) * x1;
-//            xmm2 += A.load(i+1UL,j) * x1;
-//            xmm3 += A.load(i+2UL,j) * x1;
-//            xmm4 += A.load(i+3UL,j) * x1;
-//         }
-//
-//         y[i    ] = sum( xmm1 ) * scalar;
-//         y[i+1UL] = sum( xmm2 ) * scalar;
-//         y[i+2UL] = sum( xmm3 ) * scalar;
-//         y[i+3UL] = sum( xmm4 ) * scalar;
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i    ] += A(i    ,j) * x[j] * scalar;
-//            y[i+1UL] += A(i+1UL,j) * x[j] * scalar;
-//            y[i+2UL] += A(i+2UL,j) * x[j] * scalar;
-//            y[i+3UL] += A(i+3UL,j) * x[j] * scalar;
-//         }
-//      }
-//
-//      for( ; (i+3UL) <= M; i+=3UL )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i+2UL : i+3UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         SIMDType xmm1, xmm2, xmm3;
-//         size_t j( jbegin );
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            xmm1 += A.load(i    ,j) * x1;
-//            xmm2 += A.load(i+1UL,j) * x1;
-//            xmm3 += A.load(i+2UL,j) * x1;
-//         }
-//
-//         y[i    ] = sum( xmm1 ) * scalar;
-//         y[i+1UL] = sum( xmm2 ) * scalar;
-//         y[i+2UL] = sum( xmm3 ) * scalar;
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i    ] += A(i    ,j) * x[j] * scalar;
-//            y[i+1UL] += A(i+1UL,j) * x[j] * scalar;
-//            y[i+2UL] += A(i+2UL,j) * x[j] * scalar;
-//         }
-//      }
-//
-//      for( ; (i+2UL) <= M; i+=2UL )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i+1UL : i+2UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         SIMDType xmm1, xmm2;
-//         size_t j( jbegin );
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            xmm1 += A.load(i    ,j) * x1;
-//            xmm2 += A.load(i+1UL,j) * x1;
-//         }
-//
-//         y[i    ] = sum( xmm1 ) * scalar;
-//         y[i+1UL] = sum( xmm2 ) * scalar;
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i    ] += A(i    ,j) * x[j] * scalar;
-//            y[i+1UL] += A(i+1UL,j) * x[j] * scalar;
-//         }
-//      }
-//
-//      if( i < M )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i : i+1UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         SIMDType xmm1;
-//         size_t j( jbegin );
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            xmm1 += A.load(i,j) * x.load(j);
-//         }
-//
-//         y[i] = sum( xmm1 ) * scalar;
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i] += A(i,j) * x[j] * scalar;
-//         }
-//      }
-//   }
    //**********************************************************************************************
 
-   //**Default assignment to dense vectors (large tensors)****************************************
+   //**Vectorized default assignment to dense vectors (small tensors)******************************
+   /*!\brief Vectorized default assignment of a small scaled dense tensor-dense vector
+   //        multiplication (\f$ \vec{y}=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function implements the vectorized default assignment kernel for the scaled dense
+   // tensor-dense vector multiplication. This kernel is optimized for small tensors. As in the
+   // unscaled kernel, the rows of all pages are traversed as the rows of a single (pages*rows) x
+   // columns matrix, four of them at a time, and each row sum is scaled once.
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline auto selectSmallAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
+      -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1,ST2> >
+   {
+      constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT1> );
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t R( A.pages() * M );
+
+      const size_t jpos( remainder ? ( N & size_t(-SIMDSIZE) ) : N );
+      BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+      size_t r( 0UL );
+
+      for( ; (r+4UL) <= R; r+=4UL )
+      {
+         const size_t k1( (r    )/M ), i1( (r    )%M );
+         const size_t k2( (r+1UL)/M ), i2( (r+1UL)%M );
+         const size_t k3( (r+2UL)/M ), i3( (r+2UL)%M );
+         const size_t k4( (r+3UL)/M ), i4( (r+3UL)%M );
+
+         SIMDType xmm1, xmm2, xmm3, xmm4;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            const SIMDType x1( x.load(j) );
+            xmm1 += A.load(k1,i1,j) * x1;
+            xmm2 += A.load(k2,i2,j) * x1;
+            xmm3 += A.load(k3,i3,j) * x1;
+            xmm4 += A.load(k4,i4,j) * x1;
+         }
+
+         y(k1,i1) = sum( xmm1 ) * scalar;
+         y(k2,i2) = sum( xmm2 ) * scalar;
+         y(k3,i3) = sum( xmm3 ) * scalar;
+         y(k4,i4) = sum( xmm4 ) * scalar;
+
+         for( ; remainder && j<N; ++j ) {
+            y(k1,i1) += A(k1,i1,j) * x[j] * scalar;
+            y(k2,i2) += A(k2,i2,j) * x[j] * scalar;
+            y(k3,i3) += A(k3,i3,j) * x[j] * scalar;
+            y(k4,i4) += A(k4,i4,j) * x[j] * scalar;
+         }
+      }
+
+      for( ; r<R; ++r )
+      {
+         const size_t k( r/M ), i( r%M );
+
+         SIMDType xmm1;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            xmm1 += A.load(k,i,j) * x.load(j);
+         }
+
+         y(k,i) = sum( xmm1 ) * scalar;
+
+         for( ; remainder && j<N; ++j ) {
+            y(k,i) += A(k,i,j) * x[j] * scalar;
+         }
+      }
+   }
+   //**********************************************************************************************
+
+   //**Default assignment to dense vectors (large tensors)*****************************************
    /*!\brief Default assignment of a large scaled dense tensor-dense vector multiplication
    //        (\f$ \vec{y}=s*A*\vec{x} \f$).
    // \ingroup dense_vector
    //
-   // \param y The target left-hand side dense vector.
+   // \param y The target left-hand side dense matrix.
    // \param A The left-hand side dense tensor operand.
    // \param x The right-hand side dense vector operand.
    // \param scalar The scaling factor.
@@ -3253,7 +2239,7 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    // This function relays to the default implementation of the assignment of a scaled dense
    // tensor-dense vector multiplication expression to a dense vector.
    */
-   template< typename MT1    // Type of the left-hand side target vector
+   template< typename MT1    // Type of the left-hand side target matrix
            , typename TT1    // Type of the left-hand side tensor operand
            , typename VT1    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
@@ -3264,271 +2250,31 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    }
    //**********************************************************************************************
 
-//   //**Vectorized default assignment to dense vectors (large tensors)*****************************
-//   /*!\brief Vectorized default assignment of a large scaled dense tensor-dense vector
-//   //        multiplication (\f$ \vec{y}=s*A*\vec{x} \f$).
-//   // \ingroup dense_vector
-//   //
-//   // \param y The target left-hand side dense vector.
-//   // \param A The left-hand side dense tensor operand.
-//   // \param x The right-hand side dense vector operand.
-//   // \param scalar The scaling factor.
-//   // \return void
-//   //
-//   // This function implements the vectorized default assignment kernel for the scaled dense
-//   // tensor-dense vector multiplication. This kernel is optimized for large tensors.
-//   */
-//   template< typename VT1    // Type of the left-hand side target vector
-//           , typename TT1    // Type of the left-hand side tensor operand
-//           , typename VT2    // Type of the right-hand side vector operand
-//           , typename ST2 >  // Type of the scalar value
-//   static inline auto selectLargeAssignKernel( VT1& y, const TT1& A, const VT2& x, ST2 scalar )
-//      -> EnableIf_t< UseVectorizedDefaultKernel_v<VT1,TT1,VT2,ST2> >
-//   {
-//      constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT2> );
-//
-//      const size_t M( A.rows()    );
-//      const size_t N( A.columns() );
-//
-//      reset( y );
-//
-//      size_t i( 0UL );
-//
-//      for( ; (i+8UL) <= M; i+=8UL )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i+7UL : i+8UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         size_t j( jbegin );
-//
-//         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-//            const size_t j1( j+SIMDSIZE     );
-//            const size_t j2( j+SIMDSIZE*2UL );
-//            const size_t j3( j+SIMDSIZE*3UL );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            const SIMDType x3( x.load(j2) );
-//            const SIMDType x4( x.load(j3) );
-//            y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 + A.load(i    ,j2) * x3 + A.load(i    ,j3) * x4 );
-//            y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 + A.load(i+1UL,j2) * x3 + A.load(i+1UL,j3) * x4 );
-//            y[i+2UL] += sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 + A.load(i+2UL,j2) * x3 + A.load(i+2UL,j3) * x4 );
-//            y[i+3UL] += sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 + A.load(i+3UL,j2) * x3 + A.load(i+3UL,j3) * x4 );
-//            y[i+4UL] += sum( A.load(i+4UL,j) * x1 + A.load(i+4UL,j1) * x2 + A.load(i+4UL,j2) * x3 + A.load(i+4UL,j3) * x4 );
-//            y[i+5UL] += sum( A.load(i+5UL,j) * x1 + A.load(i+5UL,j1) * x2 + A.load(i+5UL,j2) * x3 + A.load(i+5UL,j3) * x4 );
-//            y[i+6UL] += sum( A.load(i+6UL,j) * x1 + A.load(i+6UL,j1) * x2 + A.load(i+6UL,j2) * x3 + A.load(i+6UL,j3) * x4 );
-//            y[i+7UL] += sum( A.load(i+7UL,j) * x1 + A.load(i+7UL,j1) * x2 + A.load(i+7UL,j2) * x3 + A.load(i+7UL,j3) * x4 );
-//         }
-//
-//         for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-//            const size_t j1( j+SIMDSIZE );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 );
-//            y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 );
-//            y[i+2UL] += sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 );
-//            y[i+3UL] += sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 );
-//            y[i+4UL] += sum( A.load(i+4UL,j) * x1 + A.load(i+4UL,j1) * x2 );
-//            y[i+5UL] += sum( A.load(i+5UL,j) * x1 + A.load(i+5UL,j1) * x2 );
-//            y[i+6UL] += sum( A.load(i+6UL,j) * x1 + A.load(i+6UL,j1) * x2 );
-//            y[i+7UL] += sum( A.load(i+7UL,j) * x1 + A.load(i+7UL,j1) * x2 );
-//         }
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            y[i    ] += sum( A.load(i    ,j) * x1 );
-//            y[i+1UL] += sum( A.load(i+1UL,j) * x1 );
-//            y[i+2UL] += sum( A.load(i+2UL,j) * x1 );
-//            y[i+3UL] += sum( A.load(i+3UL,j) * x1 );
-//            y[i+4UL] += sum( A.load(i+4UL,j) * x1 );
-//            y[i+5UL] += sum( A.load(i+5UL,j) * x1 );
-//            y[i+6UL] += sum( A.load(i+6UL,j) * x1 );
-//            y[i+7UL] += sum( A.load(i+7UL,j) * x1 );
-//         }
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i    ] += A(i    ,j) * x[j];
-//            y[i+1UL] += A(i+1UL,j) * x[j];
-//            y[i+2UL] += A(i+2UL,j) * x[j];
-//            y[i+3UL] += A(i+3UL,j) * x[j];
-//            y[i+4UL] += A(i+4UL,j) * x[j];
-//            y[i+5UL] += A(i+5UL,j) * x[j];
-//            y[i+6UL] += A(i+6UL,j) * x[j];
-//            y[i+7UL] += A(i+7UL,j) * x[j];
-//         }
-//
-//         y[i    ] *= scalar;
-//         y[i+1UL] *= scalar;
-//         y[i+2UL] *= scalar;
-//         y[i+3UL] *= scalar;
-//         y[i+4UL] *= scalar;
-//         y[i+5UL] *= scalar;
-//         y[i+6UL] *= scalar;
-//         y[i+7UL] *= scalar;
-//      }
-//
-//      for( ; (i+4UL) <= M; i+=4UL )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i+3UL : i+4UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         size_t j( jbegin );
-//
-//         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-//            const size_t j1( j+SIMDSIZE     );
-//            const size_t j2( j+SIMDSIZE*2UL );
-//            const size_t j3( j+SIMDSIZE*3UL );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            const SIMDType x3( x.load(j2) );
-//            const SIMDType x4( x.load(j3) );
-//            y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 + A.load(i    ,j2) * x3 + A.load(i    ,j3) * x4 );
-//            y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 + A.load(i+1UL,j2) * x3 + A.load(i+1UL,j3) * x4 );
-//            y[i+2UL] += sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 + A.load(i+2UL,j2) * x3 + A.load(i+2UL,j3) * x4 );
-//            y[i+3UL] += sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 + A.load(i+3UL,j2) * x3 + A.load(i+3UL,j3) * x4 );
-//         }
-//
-//         for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-//            const size_t j1( j+SIMDSIZE );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 );
-//            y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 );
-//            y[i+2UL] += sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 );
-//            y[i+3UL] += sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 );
-//         }
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            y[i    ] += sum( A.load(i    ,j) * x1 );
-//            y[i+1UL] += sum( A.load(i+1UL,j) * x1 );
-//            y[i+2UL] += sum( A.load(i+2UL,j) * x1 );
-//            y[i+3UL] += sum( A.load(i+3UL,j) * x1 );
-//         }
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i    ] += A(i    ,j) * x[j];
-//            y[i+1UL] += A(i+1UL,j) * x[j];
-//            y[i+2UL] += A(i+2UL,j) * x[j];
-//            y[i+3UL] += A(i+3UL,j) * x[j];
-//         }
-//
-//         y[i    ] *= scalar;
-//         y[i+1UL] *= scalar;
-//         y[i+2UL] *= scalar;
-//         y[i+3UL] *= scalar;
-//      }
-//
-//      for( ; (i+2UL) <= M; i+=2UL )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i+1UL : i+2UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         size_t j( jbegin );
-//
-//         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-//            const size_t j1( j+SIMDSIZE     );
-//            const size_t j2( j+SIMDSIZE*2UL );
-//            const size_t j3( j+SIMDSIZE*3UL );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            const SIMDType x3( x.load(j2) );
-//            const SIMDType x4( x.load(j3) );
-//            y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 + A.load(i    ,j2) * x3 + A.load(i    ,j3) * x4 );
-//            y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 + A.load(i+1UL,j2) * x3 + A.load(i+1UL,j3) * x4 );
-//         }
-//
-//         for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-//            const size_t j1( j+SIMDSIZE );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 );
-//            y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 );
-//         }
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            y[i    ] += sum( A.load(i    ,j) * x1 );
-//            y[i+1UL] += sum( A.load(i+1UL,j) * x1 );
-//         }
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i    ] += A(i    ,j) * x[j];
-//            y[i+1UL] += A(i+1UL,j) * x[j];
-//         }
-//
-//         y[i    ] *= scalar;
-//         y[i+1UL] *= scalar;
-//      }
-//
-//      if( i < M )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i : i+1UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         size_t j( jbegin );
-//
-//         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-//            const size_t j1( j+SIMDSIZE     );
-//            const size_t j2( j+SIMDSIZE*2UL );
-//            const size_t j3( j+SIMDSIZE*3UL );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            const SIMDType x3( x.load(j2) );
-//            const SIMDType x4( x.load(j3) );
-//            y[i] += sum( A.load(i,j) * x1 + A.load(i,j1) * x2 + A.load(i,j2) * x3 + A.load(i,j3) * x4 );
-//         }
-//
-//         for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-//            const size_t j1( j+SIMDSIZE );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            y[i] += sum( A.load(i,j) * x1 + A.load(i,j1) * x2 );
-//         }
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            y[i] += sum( A.load(i,j) * x1 );
-//         }
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i] += A(i,j) * x[j];
-//         }
-//
-//         y[i] *= scalar;
-//      }
-//   }
+   //**Vectorized default assignment to dense vectors (large tensors)******************************
+   /*!\brief Vectorized default assignment of a large scaled dense tensor-dense vector
+   //        multiplication (\f$ \vec{y}=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function implements the vectorized default assignment kernel for the scaled dense
+   // tensor-dense vector multiplication. This kernel is optimized for large tensors.
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline auto selectLargeAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
+      -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1,ST2> >
+   {
+      reset( y );
+
+      selectLargeAddAssignKernel( y, A, x, scalar );
+   }
    //**********************************************************************************************
 
    //**BLAS-based assignment to dense vectors (default)********************************************
@@ -3542,8 +2288,8 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function relays to the default implementation of the assignment of a large scaled
-   // dense tensor-dense vector multiplication expression to a dense vector.
+   // This function relays to the default implementation of the assignment of a large scaled dense
+   // tensor-dense vector multiplication expression to a dense vector.
    */
    template< typename MT1    // Type of the left-hand side target matrix
            , typename TT1    // Type of the left-hand side tensor operand
@@ -3558,36 +2304,38 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
 
    //**BLAS-based assignment to dense vectors******************************************************
 #if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_TENSOR_VECTOR_MULTIPLICATION
-//   /*!\brief BLAS-based assignment of a scaled dense tensor-dense vector multiplication
-//   //        (\f$ \vec{y}=s*A*\vec{x} \f$).
-//   // \ingroup dense_vector
-//   //
-//   // \param y The target left-hand side dense vector.
-//   // \param A The left-hand side dense tensor operand.
-//   // \param x The right-hand side dense vector operand.
-//   // \param scalar The scaling factor.
-//   // \return void
-//   //
-//   // This function performs the scaled dense tensor-dense vector multiplication based on the
-//   // according BLAS functionality.
-//   */
-//   template< typename VT1    // Type of the left-hand side target vector
-//           , typename TT1    // Type of the left-hand side tensor operand
-//           , typename VT2    // Type of the right-hand side vector operand
-//           , typename ST2 >  // Type of the scalar value
-//   static inline auto selectBlasAssignKernel( VT1& y, const TT1& A, const VT2& x, ST2 scalar )
-//      -> EnableIf_t< UseBlasKernel_v<VT1,TT1,VT2,ST2> >
-//   {
-//      using ET = ElementType_t<VT1>;
-//
-//      if( IsTriangular_v<TT1> ) {
-//         assign( y, scalar * x );
-//         trmv( y, A, ( IsLower_v<TT1> )?( CblasLower ):( CblasUpper ) );
-//      }
-//      else {
-//         gemv( y, A, x, ET(scalar), ET(0) );
-//      }
-//   }
+   /*!\brief BLAS-based assignment of a scaled dense tensor-dense vector multiplication
+   //        (\f$ \vec{y}=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled dense tensor-dense vector multiplication based on the
+   // according BLAS functionality. Each page of \a A is multiplied with \a x into the according
+   // row of \a y, with the scaling factor passed as the \c alpha argument of \c gemv().
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline auto selectBlasAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
+      -> EnableIf_t< UseBlasKernel_v<MT1,TT1,VT1,ST2> >
+   {
+      using ET = ElementType_t<MT1>;
+
+      const int M  ( numeric_cast<int>( A.rows()    ) );
+      const int N  ( numeric_cast<int>( A.columns() ) );
+      const int lda( numeric_cast<int>( A.spacing() ) );
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         gemv( CblasRowMajor, CblasNoTrans, M, N, ET(scalar), A.data(0UL,k), lda,
+               x.data(), 1, ET(0), y.data(k), 1 );
+      }
+   }
 #endif
    //**********************************************************************************************
 
@@ -3688,16 +2436,16 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    //        (\f$ \vec{y}+=s*A*\vec{x} \f$).
    // \ingroup dense_vector
    //
-   // \param y The target left-hand side dense vector.
+   // \param y The target left-hand side dense matrix.
    // \param A The left-hand side dense tensor operand.
    // \param x The right-hand side dense vector operand.
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function implements the default addition assignment kernel for the scaled dense tensor-
-   // dense vector multiplication.
+   // This function implements the default addition assignment kernel for the scaled dense
+   // tensor-dense vector multiplication.
    */
-   template< typename MT1    // Type of the left-hand side target vector
+   template< typename MT1    // Type of the left-hand side target matrix
            , typename TT1    // Type of the left-hand side tensor operand
            , typename VT1    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
@@ -3707,12 +2455,12 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    }
    //**********************************************************************************************
 
-   //**Default addition assignment to dense vectors (small tensors)*******************************
+   //**Default addition assignment to dense vectors (small tensors)********************************
    /*!\brief Default addition assignment of a small scaled dense tensor-dense vector multiplication
    //        (\f$ \vec{y}+=s*A*\vec{x} \f$).
    // \ingroup dense_vector
    //
-   // \param y The target left-hand side dense vector.
+   // \param y The target left-hand side dense matrix.
    // \param A The left-hand side dense tensor operand.
    // \param x The right-hand side dense vector operand.
    // \param scalar The scaling factor.
@@ -3721,7 +2469,7 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    // This function relays to the default implementation of the addition assignment of a scaled
    // dense tensor-dense vector multiplication expression to a dense vector.
    */
-   template< typename MT1    // Type of the left-hand side target vector
+   template< typename MT1    // Type of the left-hand side target matrix
            , typename TT1    // Type of the left-hand side tensor operand
            , typename VT1    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
@@ -3732,220 +2480,97 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    }
    //**********************************************************************************************
 
-   //**Vectorized default addition assignment to dense vectors (small tensors)********************
+   //**Vectorized default addition assignment to dense vectors (small tensors)*********************
    /*!\brief Vectorized default addition assignment of a small scaled dense tensor-dense vector
    //        multiplication (\f$ \vec{y}+=s*A*\vec{x} \f$).
    // \ingroup dense_vector
    //
-   // \param y The target left-hand side dense vector.
+   // \param y The target left-hand side dense matrix.
    // \param A The left-hand side dense tensor operand.
    // \param x The right-hand side dense vector operand.
    // \param scalar The scaling factor.
    // \return void
    //
    // This function implements the vectorized default addition assignment kernel for the scaled
-   // dense tensor-dense vector multiplication. This kernel is optimized for small tensors.
-//   */
-//   template< typename VT1    // Type of the left-hand side target vector
-//           , typename TT1    // Type of the left-hand side tensor operand
-//           , typename VT2    // Type of the right-hand side vector operand
-//           , typename ST2 >  // Type of the scalar value
-//   static inline auto selectSmallAddAssignKernel( VT1& y, const TT1& A, const VT2& x, ST2 scalar )
-//      -> EnableIf_t< UseVectorizedDefaultKernel_v<VT1,TT1,VT2,ST2> >
-//   {
-//      constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT2> );
-//
-//      const size_t M( A.rows()    );
-//      const size_t N( A.columns() );
-//
-//      size_t i( 0UL );
-//
-//      for( ; (i+8UL) <= M; i+=8UL )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i+7UL : i+8UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-//         size_t j( jbegin );
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            xmm1 += A.load(i    ,j) * x1;
-//            xmm2 += A.load(i+1UL,j) * x1;
-//            xmm3 += A.load(i+2UL,j) * x1;
-//            xmm4 += A.load(i+3UL,j) * x1;
-//            xmm5 += A.load(i+4UL,j) * x1;
-//            xmm6 += A.load(i+5UL,j) * x1;
-//            xmm7 += A.load(i+6UL,j) * x1;
-//            xmm8 += A.load(i+7UL,j) * x1;
-//         }
-//
-//         y[i    ] += sum( xmm1 ) * scalar;
-//         y[i+1UL] += sum( xmm2 ) * scalar;
-//         y[i+2UL] += sum( xmm3 ) * scalar;
-//         y[i+3UL] += sum( xmm4 ) * scalar;
-//         y[i+4UL] += sum( xmm5 ) * scalar;
-//         y[i+5UL] += sum( xmm6 ) * scalar;
-//         y[i+6UL] += sum( xmm7 ) * scalar;
-//         y[i+7UL] += sum( xmm8 ) * scalar;
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i    ] += A(i    ,j) * x[j] * scalar;
-//            y[i+1UL] += A(i+1UL,j) * x[j] * scalar;
-//            y[i+2UL] += A(i+2UL,j) * x[j] * scalar;
-//            y[i+3UL] += A(i+3UL,j) * x[j] * scalar;
-//            y[i+4UL] += A(i+4UL,j) * x[j] * scalar;
-//            y[i+5UL] += A(i+5UL,j) * x[j] * scalar;
-//            y[i+6UL] += A(i+6UL,j) * x[j] * scalar;
-//            y[i+7UL] += A(i+7UL,j) * x[j] * scalar;
-//         }
-//      }
-//
-//      for( ; (i+4UL) <= M; i+=4UL )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i+3UL : i+4UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         SIMDType xmm1, xmm2, xmm3, xmm4;
-//         size_t j( jbegin );
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            xmm1 += A.load(i    ,j) * x1;
-//            xmm2 += A.load(i+1UL,j) * x1;
-//            xmm3 += A.load(i+2UL,j) * x1;
-//            xmm4 += A.load(i+3UL,j) * x1;
-//         }
-//
-//         y[i    ] += sum( xmm1 ) * scalar;
-//         y[i+1UL] += sum( xmm2 ) * scalar;
-//         y[i+2UL] += sum( xmm3 ) * scalar;
-//         y[i+3UL] += sum( xmm4 ) * scalar;
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i    ] += A(i    ,j) * x[j] * scalar;
-//            y[i+1UL] += A(i+1UL,j) * x[j] * scalar;
-//            y[i+2UL] += A(i+2UL,j) * x[j] * scalar;
-//            y[i+3UL] += A(i+3UL,j) * x[j] * scalar;
-//         }
-//      }
-//
-//      for( ; (i+3UL) <= M; i+=3UL )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i+2UL : i+3UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         SIMDType xmm1, xmm2, xmm3;
-//         size_t j( jbegin );
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            xmm1 += A.load(i    ,j) * x1;
-//            xmm2 += A.load(i+1UL,j) * x1;
-//            xmm3 += A.load(i+2UL,j) * x1;
-//         }
-//
-//         y[i    ] += sum( xmm1 ) * scalar;
-//         y[i+1UL] += sum( xmm2 ) * scalar;
-//         y[i+2UL] += sum( xmm3 ) * scalar;
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i    ] += A(i    ,j) * x[j] * scalar;
-//            y[i+1UL] += A(i+1UL,j) * x[j] * scalar;
-//            y[i+2UL] += A(i+2UL,j) * x[j] * scalar;
-//         }
-//      }
-//
-//      for( ; (i+2UL) <= M; i+=2UL )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i+1UL : i+2UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         SIMDType xmm1, xmm2;
-//         size_t j( jbegin );
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            xmm1 += A.load(i    ,j) * x1;
-//            xmm2 += A.load(i+1UL,j) * x1;
-//         }
-//
-//         y[i    ] += sum( xmm1 ) * scalar;
-//         y[i+1UL] += sum( xmm2 ) * scalar;
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i    ] += A(i    ,j) * x[j] * scalar;
-//            y[i+1UL] += A(i+1UL,j) * x[j] * scalar;
-//         }
-//      }
-//
-//      if( i < M )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i : i+1UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         SIMDType xmm1;
-//         size_t j( jbegin );
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            xmm1 += A.load(i,j) * x.load(j);
-//         }
-//
-//         y[i] += sum( xmm1 ) * scalar;
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i] += A(i,j) * x[j] * scalar;
-//         }
-//      }
-//   }
+   // dense tensor-dense vector multiplication. This kernel is optimized for small tensors. As in
+   // the unscaled kernel, the rows of all pages are traversed as the rows of a single (pages*rows)
+   // x columns matrix, four of them at a time, and each row sum is scaled once.
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline auto selectSmallAddAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
+      -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1,ST2> >
+   {
+      constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT1> );
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t R( A.pages() * M );
+
+      const size_t jpos( remainder ? ( N & size_t(-SIMDSIZE) ) : N );
+      BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+      size_t r( 0UL );
+
+      for( ; (r+4UL) <= R; r+=4UL )
+      {
+         const size_t k1( (r    )/M ), i1( (r    )%M );
+         const size_t k2( (r+1UL)/M ), i2( (r+1UL)%M );
+         const size_t k3( (r+2UL)/M ), i3( (r+2UL)%M );
+         const size_t k4( (r+3UL)/M ), i4( (r+3UL)%M );
+
+         SIMDType xmm1, xmm2, xmm3, xmm4;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            const SIMDType x1( x.load(j) );
+            xmm1 += A.load(k1,i1,j) * x1;
+            xmm2 += A.load(k2,i2,j) * x1;
+            xmm3 += A.load(k3,i3,j) * x1;
+            xmm4 += A.load(k4,i4,j) * x1;
+         }
+
+         y(k1,i1) += sum( xmm1 ) * scalar;
+         y(k2,i2) += sum( xmm2 ) * scalar;
+         y(k3,i3) += sum( xmm3 ) * scalar;
+         y(k4,i4) += sum( xmm4 ) * scalar;
+
+         for( ; remainder && j<N; ++j ) {
+            y(k1,i1) += A(k1,i1,j) * x[j] * scalar;
+            y(k2,i2) += A(k2,i2,j) * x[j] * scalar;
+            y(k3,i3) += A(k3,i3,j) * x[j] * scalar;
+            y(k4,i4) += A(k4,i4,j) * x[j] * scalar;
+         }
+      }
+
+      for( ; r<R; ++r )
+      {
+         const size_t k( r/M ), i( r%M );
+
+         SIMDType xmm1;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            xmm1 += A.load(k,i,j) * x.load(j);
+         }
+
+         y(k,i) += sum( xmm1 ) * scalar;
+
+         for( ; remainder && j<N; ++j ) {
+            y(k,i) += A(k,i,j) * x[j] * scalar;
+         }
+      }
+   }
    //**********************************************************************************************
 
-   //**Default addition assignment to dense vectors (large tensors)*******************************
+   //**Default addition assignment to dense vectors (large tensors)********************************
    /*!\brief Default addition assignment of a large scaled dense tensor-dense vector multiplication
    //        (\f$ \vec{y}+=s*A*\vec{x} \f$).
    // \ingroup dense_vector
    //
-   // \param y The target left-hand side dense vector.
+   // \param y The target left-hand side dense matrix.
    // \param A The left-hand side dense tensor operand.
    // \param x The right-hand side dense vector operand.
    // \param scalar The scaling factor.
@@ -3954,7 +2579,7 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    // This function relays to the default implementation of the addition assignment of a scaled
    // dense tensor-dense vector multiplication expression to a dense vector.
    */
-   template< typename MT1    // Type of the left-hand side target vector
+   template< typename MT1    // Type of the left-hand side target matrix
            , typename TT1    // Type of the left-hand side tensor operand
            , typename VT1    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
@@ -3965,250 +2590,96 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    }
    //**********************************************************************************************
 
-   //**Vectorized default addition assignment to dense vectors (large tensors)********************
+   //**Vectorized default addition assignment to dense vectors (large tensors)*********************
    /*!\brief Vectorized default addition assignment of a large scaled dense tensor-dense vector
    //        multiplication (\f$ \vec{y}+=s*A*\vec{x} \f$).
    // \ingroup dense_vector
    //
-   // \param y The target left-hand side dense vector.
+   // \param y The target left-hand side dense matrix.
    // \param A The left-hand side dense tensor operand.
    // \param x The right-hand side dense vector operand.
    // \param scalar The scaling factor.
    // \return void
    //
    // This function implements the vectorized default addition assignment kernel for the scaled
-   // dense tensor-dense vector multiplication. This kernel is optimized for large tensors.
-//   */
-//   template< typename VT1    // Type of the left-hand side target vector
-//           , typename TT1    // Type of the left-hand side tensor operand
-//           , typename VT2    // Type of the right-hand side vector operand
-//           , typename ST2 >  // Type of the scalar value
-//   static inline auto selectLargeAddAssignKernel( VT1& y, const TT1& A, const VT2& x, ST2 scalar )
-//      -> EnableIf_t< UseVectorizedDefaultKernel_v<VT1,TT1,VT2,ST2> >
-//   {
-//      constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT2> );
-//
-//      const size_t M( A.rows()    );
-//      const size_t N( A.columns() );
-//
-//      size_t i( 0UL );
-//
-//      for( ; (i+8UL) <= M; i+=8UL )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i+7UL : i+8UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         size_t j( jbegin );
-//
-//         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-//            const size_t j1( j+SIMDSIZE     );
-//            const size_t j2( j+SIMDSIZE*2UL );
-//            const size_t j3( j+SIMDSIZE*3UL );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            const SIMDType x3( x.load(j2) );
-//            const SIMDType x4( x.load(j3) );
-//            y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 + A.load(i    ,j2) * x3 + A.load(i    ,j3) * x4 ) * scalar;
-//            y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 + A.load(i+1UL,j2) * x3 + A.load(i+1UL,j3) * x4 ) * scalar;
-//            y[i+2UL] += sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 + A.load(i+2UL,j2) * x3 + A.load(i+2UL,j3) * x4 ) * scalar;
-//            y[i+3UL] += sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 + A.load(i+3UL,j2) * x3 + A.load(i+3UL,j3) * x4 ) * scalar;
-//            y[i+4UL] += sum( A.load(i+4UL,j) * x1 + A.load(i+4UL,j1) * x2 + A.load(i+4UL,j2) * x3 + A.load(i+4UL,j3) * x4 ) * scalar;
-//            y[i+5UL] += sum( A.load(i+5UL,j) * x1 + A.load(i+5UL,j1) * x2 + A.load(i+5UL,j2) * x3 + A.load(i+5UL,j3) * x4 ) * scalar;
-//            y[i+6UL] += sum( A.load(i+6UL,j) * x1 + A.load(i+6UL,j1) * x2 + A.load(i+6UL,j2) * x3 + A.load(i+6UL,j3) * x4 ) * scalar;
-//            y[i+7UL] += sum( A.load(i+7UL,j) * x1 + A.load(i+7UL,j1) * x2 + A.load(i+7UL,j2) * x3 + A.load(i+7UL,j3) * x4 ) * scalar;
-//         }
-//
-//         for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-//            const size_t j1( j+SIMDSIZE );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 ) * scalar;
-//            y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 ) * scalar;
-//            y[i+2UL] += sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 ) * scalar;
-//            y[i+3UL] += sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 ) * scalar;
-//            y[i+4UL] += sum( A.load(i+4UL,j) * x1 + A.load(i+4UL,j1) * x2 ) * scalar;
-//            y[i+5UL] += sum( A.load(i+5UL,j) * x1 + A.load(i+5UL,j1) * x2 ) * scalar;
-//            y[i+6UL] += sum( A.load(i+6UL,j) * x1 + A.load(i+6UL,j1) * x2 ) * scalar;
-//            y[i+7UL] += sum( A.load(i+7UL,j) * x1 + A.load(i+7UL,j1) * x2 ) * scalar;
-//         }
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            y[i    ] += sum( A.load(i    ,j) * x1 ) * scalar;
-//            y[i+1UL] += sum( A.load(i+1UL,j) * x1 ) * scalar;
-//            y[i+2UL] += sum( A.load(i+2UL,j) * x1 ) * scalar;
-//            y[i+3UL] += sum( A.load(i+3UL,j) * x1 ) * scalar;
-//            y[i+4UL] += sum( A.load(i+4UL,j) * x1 ) * scalar;
-//            y[i+5UL] += sum( A.load(i+5UL,j) * x1 ) * scalar;
-//            y[i+6UL] += sum( A.load(i+6UL,j) * x1 ) * scalar;
-//            y[i+7UL] += sum( A.load(i+7UL,j) * x1 ) * scalar;
-//         }
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i    ] += A(i    ,j) * x[j] * scalar;
-//            y[i+1UL] += A(i+1UL,j) * x[j] * scalar;
-//            y[i+2UL] += A(i+2UL,j) * x[j] * scalar;
-//            y[i+3UL] += A(i+3UL,j) * x[j] * scalar;
-//            y[i+4UL] += A(i+4UL,j) * x[j] * scalar;
-//            y[i+5UL] += A(i+5UL,j) * x[j] * scalar;
-//            y[i+6UL] += A(i+6UL,j) * x[j] * scalar;
-//            y[i+7UL] += A(i+7UL,j) * x[j] * scalar;
-//         }
-//      }
-//
-//      for( ; (i+4UL) <= M; i+=4UL )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i+3UL : i+4UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         size_t j( jbegin );
-//
-//         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-//            const size_t j1( j+SIMDSIZE     );
-//            const size_t j2( j+SIMDSIZE*2UL );
-//            const size_t j3( j+SIMDSIZE*3UL );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            const SIMDType x3( x.load(j2) );
-//            const SIMDType x4( x.load(j3) );
-//            y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 + A.load(i    ,j2) * x3 + A.load(i    ,j3) * x4 ) * scalar;
-//            y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 + A.load(i+1UL,j2) * x3 + A.load(i+1UL,j3) * x4 ) * scalar;
-//            y[i+2UL] += sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 + A.load(i+2UL,j2) * x3 + A.load(i+2UL,j3) * x4 ) * scalar;
-//            y[i+3UL] += sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 + A.load(i+3UL,j2) * x3 + A.load(i+3UL,j3) * x4 ) * scalar;
-//         }
-//
-//         for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-//            const size_t j1( j+SIMDSIZE );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 ) * scalar;
-//            y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 ) * scalar;
-//            y[i+2UL] += sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 ) * scalar;
-//            y[i+3UL] += sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 ) * scalar;
-//         }
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            y[i    ] += sum( A.load(i    ,j) * x1 ) * scalar;
-//            y[i+1UL] += sum( A.load(i+1UL,j) * x1 ) * scalar;
-//            y[i+2UL] += sum( A.load(i+2UL,j) * x1 ) * scalar;
-//            y[i+3UL] += sum( A.load(i+3UL,j) * x1 ) * scalar;
-//         }
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i    ] += A(i    ,j) * x[j] * scalar;
-//            y[i+1UL] += A(i+1UL,j) * x[j] * scalar;
-//            y[i+2UL] += A(i+2UL,j) * x[j] * scalar;
-//            y[i+3UL] += A(i+3UL,j) * x[j] * scalar;
-//         }
-//      }
-//
-//      for( ; (i+2UL) <= M; i+=2UL )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i+1UL : i+2UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         size_t j( jbegin );
-//
-//         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-//            const size_t j1( j+SIMDSIZE     );
-//            const size_t j2( j+SIMDSIZE*2UL );
-//            const size_t j3( j+SIMDSIZE*3UL );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            const SIMDType x3( x.load(j2) );
-//            const SIMDType x4( x.load(j3) );
-//            y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 + A.load(i    ,j2) * x3 + A.load(i    ,j3) * x4 ) * scalar;
-//            y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 + A.load(i+1UL,j2) * x3 + A.load(i+1UL,j3) * x4 ) * scalar;
-//         }
-//
-//         for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-//            const size_t j1( j+SIMDSIZE );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            y[i    ] += sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 ) * scalar;
-//            y[i+1UL] += sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 ) * scalar;
-//         }
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            y[i    ] += sum( A.load(i    ,j) * x1 ) * scalar;
-//            y[i+1UL] += sum( A.load(i+1UL,j) * x1 ) * scalar;
-//         }
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i    ] += A(i    ,j) * x[j] * scalar;
-//            y[i+1UL] += A(i+1UL,j) * x[j] * scalar;
-//         }
-//      }
-//
-//      if( i < M )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i : i+1UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         size_t j( jbegin );
-//
-//         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-//            const size_t j1( j+SIMDSIZE     );
-//            const size_t j2( j+SIMDSIZE*2UL );
-//            const size_t j3( j+SIMDSIZE*3UL );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            const SIMDType x3( x.load(j2) );
-//            const SIMDType x4( x.load(j3) );
-//            y[i] += sum( A.load(i,j) * x1 + A.load(i,j1) * x2 + A.load(i,j2) * x3 + A.load(i,j3) * x4 ) * scalar;
-//         }
-//
-//         for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-//            const size_t j1( j+SIMDSIZE );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            y[i] += sum( A.load(i,j) * x1 + A.load(i,j1) * x2 ) * scalar;
-//         }
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            y[i] += sum( A.load(i,j) * x1 ) * scalar;
-//         }
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i] += A(i,j) * x[j] * scalar;
-//         }
-//      }
-//   }
+   // dense tensor-dense vector multiplication. This kernel is optimized for large tensors. The
+   // columns are processed in panels, such that the currently used part of \a x remains in the L1
+   // cache while it is reused for all rows of the tensor.
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline auto selectLargeAddAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
+      -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1,ST2> >
+   {
+      constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT1> );
+      constexpr size_t jblock( ( 16384UL / sizeof( ElementType ) ) & size_t(-SIMDSIZE) );
+
+      BLAZE_STATIC_ASSERT( jblock >= SIMDSIZE );
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t R( A.pages() * M );
+
+      for( size_t jj=0UL; jj<N; jj+=jblock )
+      {
+         const size_t jend( min( jj+jblock, N ) );
+         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
+         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+         size_t r( 0UL );
+
+         for( ; (r+4UL) <= R; r+=4UL )
+         {
+            const size_t k1( (r    )/M ), i1( (r    )%M );
+            const size_t k2( (r+1UL)/M ), i2( (r+1UL)%M );
+            const size_t k3( (r+2UL)/M ), i3( (r+2UL)%M );
+            const size_t k4( (r+3UL)/M ), i4( (r+3UL)%M );
+
+            SIMDType xmm1, xmm2, xmm3, xmm4;
+            size_t j( jj );
+
+            for( ; j<jpos; j+=SIMDSIZE ) {
+               const SIMDType x1( x.load(j) );
+               xmm1 += A.load(k1,i1,j) * x1;
+               xmm2 += A.load(k2,i2,j) * x1;
+               xmm3 += A.load(k3,i3,j) * x1;
+               xmm4 += A.load(k4,i4,j) * x1;
+            }
+
+            y(k1,i1) += sum( xmm1 ) * scalar;
+            y(k2,i2) += sum( xmm2 ) * scalar;
+            y(k3,i3) += sum( xmm3 ) * scalar;
+            y(k4,i4) += sum( xmm4 ) * scalar;
+
+            for( ; remainder && j<jend; ++j ) {
+               y(k1,i1) += A(k1,i1,j) * x[j] * scalar;
+               y(k2,i2) += A(k2,i2,j) * x[j] * scalar;
+               y(k3,i3) += A(k3,i3,j) * x[j] * scalar;
+               y(k4,i4) += A(k4,i4,j) * x[j] * scalar;
+            }
+         }
+
+         for( ; r<R; ++r )
+         {
+            const size_t k( r/M ), i( r%M );
+
+            SIMDType xmm1;
+            size_t j( jj );
+
+            for( ; j<jpos; j+=SIMDSIZE ) {
+               xmm1 += A.load(k,i,j) * x.load(j);
+            }
+
+            y(k,i) += sum( xmm1 ) * scalar;
+
+            for( ; remainder && j<jend; ++j ) {
+               y(k,i) += A(k,i,j) * x[j] * scalar;
+            }
+         }
+      }
+   }
    //**********************************************************************************************
 
    //**BLAS-based addition assignment to dense vectors (default)***********************************
@@ -4216,7 +2687,7 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    //        (\f$ \vec{y}+=s*A*\vec{x} \f$).
    // \ingroup dense_vector
    //
-   // \param y The target left-hand side dense vector.
+   // \param y The target left-hand side dense matrix.
    // \param A The left-hand side dense tensor operand.
    // \param x The right-hand side dense vector operand.
    // \param scalar The scaling factor.
@@ -4238,37 +2709,38 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
 
    //**BLAS-based addition assignment to dense vectors*********************************************
 #if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_TENSOR_VECTOR_MULTIPLICATION
-//   /*!\brief BLAS-based addition assignment of a scaled dense tensor-dense vector multiplication
-//   //        (\f$ \vec{y}+=s*A*\vec{x} \f$).
-//   // \ingroup dense_vector
-//   //
-//   // \param y The target left-hand side dense vector.
-//   // \param A The left-hand side dense tensor operand.
-//   // \param x The right-hand side dense vector operand.
-//   // \param scalar The scaling factor.
-//   // \return void
-//   //
-//   // This function performs the scaled dense tensor-dense vector multiplication based on the
-//   // according BLAS functionality.
-//   */
-//   template< typename VT1    // Type of the left-hand side target vector
-//           , typename TT1    // Type of the left-hand side tensor operand
-//           , typename VT2    // Type of the right-hand side vector operand
-//           , typename ST2 >  // Type of the scalar value
-//   static inline auto selectBlasAddAssignKernel( VT1& y, const TT1& A, const VT2& x, ST2 scalar )
-//      -> EnableIf_t< UseBlasKernel_v<VT1,TT1,VT2,ST2> >
-//   {
-//      using ET = ElementType_t<VT1>;
-//
-//      if( IsTriangular_v<TT1> ) {
-//         ResultType_t<VT1> tmp( serial( scalar * x ) );
-//         trmv( tmp, A, ( IsLower_v<TT1> )?( CblasLower ):( CblasUpper ) );
-//         addAssign( y, tmp );
-//      }
-//      else {
-//         gemv( y, A, x, ET(scalar), ET(1) );
-//      }
-//   }
+   /*!\brief BLAS-based addition assignment of a scaled dense tensor-dense vector multiplication
+   //        (\f$ \vec{y}+=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled dense tensor-dense vector multiplication based on the
+   // according BLAS functionality. Each page of \a A is multiplied with \a x into the according
+   // row of \a y, with the scaling factor passed as the \c alpha argument of \c gemv().
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline auto selectBlasAddAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
+      -> EnableIf_t< UseBlasKernel_v<MT1,TT1,VT1,ST2> >
+   {
+      using ET = ElementType_t<MT1>;
+
+      const int M  ( numeric_cast<int>( A.rows()    ) );
+      const int N  ( numeric_cast<int>( A.columns() ) );
+      const int lda( numeric_cast<int>( A.spacing() ) );
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         gemv( CblasRowMajor, CblasNoTrans, M, N, ET(scalar), A.data(0UL,k), lda,
+               x.data(), 1, ET(1), y.data(k), 1 );
+      }
+   }
 #endif
    //**********************************************************************************************
 
@@ -4364,7 +2836,7 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    }
    //**********************************************************************************************
 
-   //**Default subtraction assignment to dense vectors (small tensors)****************************
+   //**Default subtraction assignment to dense vectors (small tensors)*****************************
    /*!\brief Default subtraction assignment of a small scaled dense tensor-dense vector
    //        multiplication (\f$ \vec{y}-=s*A*\vec{x} \f$).
    // \ingroup dense_vector
@@ -4375,8 +2847,8 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function relays to the default implementation of the subtraction assignment of a
-   // scaled dense tensor-dense vector multiplication expression to a dense vector.
+   // This function relays to the default implementation of the subtraction assignment of a scaled
+   // dense tensor-dense vector multiplication expression to a dense vector.
    */
    template< typename MT1    // Type of the left-hand side target matrix
            , typename TT1    // Type of the left-hand side tensor operand
@@ -4389,229 +2861,106 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    }
    //**********************************************************************************************
 
-   //**Vectorized default subtraction assignment to dense vectors (small tensors)*****************
+   //**Vectorized default subtraction assignment to dense vectors (small tensors)******************
    /*!\brief Vectorized default subtraction assignment of a small scaled dense tensor-dense vector
    //        multiplication (\f$ \vec{y}-=s*A*\vec{x} \f$).
    // \ingroup dense_vector
    //
-   // \param y The target left-hand side dense vector.
+   // \param y The target left-hand side dense matrix.
    // \param A The left-hand side dense tensor operand.
    // \param x The right-hand side dense vector operand.
    // \param scalar The scaling factor.
    // \return void
    //
    // This function implements the vectorized default subtraction assignment kernel for the scaled
-   // dense tensor-dense vector multiplication. This kernel is optimized for small tensors.
+   // dense tensor-dense vector multiplication. This kernel is optimized for small tensors. As in
+   // the unscaled kernel, the rows of all pages are traversed as the rows of a single (pages*rows)
+   // x columns matrix, four of them at a time, and each row sum is scaled once.
    */
-//   template< typename VT1    // Type of the left-hand side target vector
-//           , typename TT1    // Type of the left-hand side tensor operand
-//           , typename VT2    // Type of the right-hand side vector operand
-//           , typename ST2 >  // Type of the scalar value
-//   static inline auto selectSmallSubAssignKernel( VT1& y, const TT1& A, const VT2& x, ST2 scalar )
-//      -> EnableIf_t< UseVectorizedDefaultKernel_v<VT1,TT1,VT2,ST2> >
-//   {
-//      constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT2> );
-//
-//      const size_t M( A.rows()    );
-//      const size_t N( A.columns() );
-//
-//      size_t i( 0UL );
-//
-//      for( ; (i+8UL) <= M; i+=8UL )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i+7UL : i+8UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-//         size_t j( jbegin );
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            xmm1 += A.load(i    ,j) * x1;
-//            xmm2 += A.load(i+1UL,j) * x1;
-//            xmm3 += A.load(i+2UL,j) * x1;
-//            xmm4 += A.load(i+3UL,j) * x1;
-//            xmm5 += A.load(i+4UL,j) * x1;
-//            xmm6 += A.load(i+5UL,j) * x1;
-//            xmm7 += A.load(i+6UL,j) * x1;
-//            xmm8 += A.load(i+7UL,j) * x1;
-//         }
-//
-//         y[i    ] -= sum( xmm1 ) * scalar;
-//         y[i+1UL] -= sum( xmm2 ) * scalar;
-//         y[i+2UL] -= sum( xmm3 ) * scalar;
-//         y[i+3UL] -= sum( xmm4 ) * scalar;
-//         y[i+4UL] -= sum( xmm5 ) * scalar;
-//         y[i+5UL] -= sum( xmm6 ) * scalar;
-//         y[i+6UL] -= sum( xmm7 ) * scalar;
-//         y[i+7UL] -= sum( xmm8 ) * scalar;
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i    ] -= A(i    ,j) * x[j] * scalar;
-//            y[i+1UL] -= A(i+1UL,j) * x[j] * scalar;
-//            y[i+2UL] -= A(i+2UL,j) * x[j] * scalar;
-//            y[i+3UL] -= A(i+3UL,j) * x[j] * scalar;
-//            y[i+4UL] -= A(i+4UL,j) * x[j] * scalar;
-//            y[i+5UL] -= A(i+5UL,j) * x[j] * scalar;
-//            y[i+6UL] -= A(i+6UL,j) * x[j] * scalar;
-//            y[i+7UL] -= A(i+7UL,j) * x[j] * scalar;
-//         }
-//      }
-//
-//      for( ; (i+4UL) <= M; i+=4UL )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i+3UL : i+4UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         SIMDType xmm1, xmm2, xmm3, xmm4;
-//         size_t j( jbegin );
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            xmm1 += A.load(i    ,j) * x1;
-//            xmm2 += A.load(i+1UL,j) * x1;
-//            xmm3 += A.load(i+2UL,j) * x1;
-//            xmm4 += A.load(i+3UL,j) * x1;
-//         }
-//
-//         y[i    ] -= sum( xmm1 ) * scalar;
-//         y[i+1UL] -= sum( xmm2 ) * scalar;
-//         y[i+2UL] -= sum( xmm3 ) * scalar;
-//         y[i+3UL] -= sum( xmm4 ) * scalar;
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i    ] -= A(i    ,j) * x[j] * scalar;
-//            y[i+1UL] -= A(i+1UL,j) * x[j] * scalar;
-//            y[i+2UL] -= A(i+2UL,j) * x[j] * scalar;
-//            y[i+3UL] -= A(i+3UL,j) * x[j] * scalar;
-//         }
-//      }
-//
-//      for( ; (i+3UL) <= M; i+=3UL )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i+2UL : i+3UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         SIMDType xmm1, xmm2, xmm3;
-//         size_t j( jbegin );
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            xmm1 += A.load(i    ,j) * x1;
-//            xmm2 += A.load(i+1UL,j) * x1;
-//            xmm3 += A.load(i+2UL,j) * x1;
-//         }
-//
-//         y[i    ] -= sum( xmm1 ) * scalar;
-//         y[i+1UL] -= sum( xmm2 ) * scalar;
-//         y[i+2UL] -= sum( xmm3 ) * scalar;
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i    ] -= A(i    ,j) * x[j] * scalar;
-//            y[i+1UL] -= A(i+1UL,j) * x[j] * scalar;
-//            y[i+2UL] -= A(i+2UL,j) * x[j] * scalar;
-//         }
-//      }
-//
-//      for( ; (i+2UL) <= M; i+=2UL )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i+1UL : i+2UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         SIMDType xmm1, xmm2;
-//         size_t j( jbegin );
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            xmm1 += A.load(i    ,j) * x1;
-//            xmm2 += A.load(i+1UL,j) * x1;
-//         }
-//
-//         y[i    ] -= sum( xmm1 ) * scalar;
-//         y[i+1UL] -= sum( xmm2 ) * scalar;
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i    ] -= A(i    ,j) * x[j] * scalar;
-//            y[i+1UL] -= A(i+1UL,j) * x[j] * scalar;
-//         }
-//      }
-//
-//      if( i < M )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i : i+1UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         SIMDType xmm1;
-//         size_t j( jbegin );
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            xmm1 += A.load(i,j) * x.load(j);
-//         }
-//
-//         y[i] -= sum( xmm1 ) * scalar;
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i] -= A(i,j) * x[j] * scalar;
-//         }
-//      }
-//   }
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline auto selectSmallSubAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
+      -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1,ST2> >
+   {
+      constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT1> );
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t R( A.pages() * M );
+
+      const size_t jpos( remainder ? ( N & size_t(-SIMDSIZE) ) : N );
+      BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+      size_t r( 0UL );
+
+      for( ; (r+4UL) <= R; r+=4UL )
+      {
+         const size_t k1( (r    )/M ), i1( (r    )%M );
+         const size_t k2( (r+1UL)/M ), i2( (r+1UL)%M );
+         const size_t k3( (r+2UL)/M ), i3( (r+2UL)%M );
+         const size_t k4( (r+3UL)/M ), i4( (r+3UL)%M );
+
+         SIMDType xmm1, xmm2, xmm3, xmm4;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            const SIMDType x1( x.load(j) );
+            xmm1 += A.load(k1,i1,j) * x1;
+            xmm2 += A.load(k2,i2,j) * x1;
+            xmm3 += A.load(k3,i3,j) * x1;
+            xmm4 += A.load(k4,i4,j) * x1;
+         }
+
+         y(k1,i1) -= sum( xmm1 ) * scalar;
+         y(k2,i2) -= sum( xmm2 ) * scalar;
+         y(k3,i3) -= sum( xmm3 ) * scalar;
+         y(k4,i4) -= sum( xmm4 ) * scalar;
+
+         for( ; remainder && j<N; ++j ) {
+            y(k1,i1) -= A(k1,i1,j) * x[j] * scalar;
+            y(k2,i2) -= A(k2,i2,j) * x[j] * scalar;
+            y(k3,i3) -= A(k3,i3,j) * x[j] * scalar;
+            y(k4,i4) -= A(k4,i4,j) * x[j] * scalar;
+         }
+      }
+
+      for( ; r<R; ++r )
+      {
+         const size_t k( r/M ), i( r%M );
+
+         SIMDType xmm1;
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            xmm1 += A.load(k,i,j) * x.load(j);
+         }
+
+         y(k,i) -= sum( xmm1 ) * scalar;
+
+         for( ; remainder && j<N; ++j ) {
+            y(k,i) -= A(k,i,j) * x[j] * scalar;
+         }
+      }
+   }
    //**********************************************************************************************
 
-   //**Default subtraction assignment to dense vectors (large tensors)****************************
+   //**Default subtraction assignment to dense vectors (large tensors)*****************************
    /*!\brief Default subtraction assignment of a large scaled dense tensor-dense vector
    //        multiplication (\f$ \vec{y}-=s*A*\vec{x} \f$).
    // \ingroup dense_vector
    //
-   // \param y The target left-hand side dense vector.
+   // \param y The target left-hand side dense matrix.
    // \param A The left-hand side dense tensor operand.
    // \param x The right-hand side dense vector operand.
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function relays to the default implementation of the subtraction assignment of a
-   // scaled dense tensor-dense vector multiplication expression to a dense vector.
+   // This function relays to the default implementation of the subtraction assignment of a scaled
+   // dense tensor-dense vector multiplication expression to a dense vector.
    */
-   template< typename MT1    // Type of the left-hand side target vector
+   template< typename MT1    // Type of the left-hand side target matrix
            , typename TT1    // Type of the left-hand side tensor operand
            , typename VT1    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
@@ -4620,252 +2969,98 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    {
       selectDefaultSubAssignKernel( y, A, x, scalar );
    }
-//   //**********************************************************************************************
-//
-//   //**Vectorized default subtraction assignment to dense vectors (large tensors)*****************
-//   /*!\brief Vectorized default subtraction assignment of a large scaled dense tensor-dense vector
-//   //        multiplication (\f$ \vec{y}-=s*A*\vec{x} \f$).
-//   // \ingroup dense_vector
-//   //
-//   // \param y The target left-hand side dense vector.
-//   // \param A The left-hand side dense tensor operand.
-//   // \param x The right-hand side dense vector operand.
-//   // \param scalar The scaling factor.
-//   // \return void
-//   //
-//   // This function implements the vectorized default subtraction assignment kernel for the scaled
-//   // dense tensor-dense vector multiplication. This kernel is optimized for large tensors.
-//   */
-//   template< typename VT1    // Type of the left-hand side target vector
-//           , typename TT1    // Type of the left-hand side tensor operand
-//           , typename VT2    // Type of the right-hand side vector operand
-//           , typename ST2 >  // Type of the scalar value
-//   static inline auto selectLargeSubAssignKernel( VT1& y, const TT1& A, const VT2& x, ST2 scalar )
-//      -> EnableIf_t< UseVectorizedDefaultKernel_v<VT1,TT1,VT2,ST2> >
-//   {
-//      constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT2> );
-//
-//      const size_t M( A.rows()    );
-//      const size_t N( A.columns() );
-//
-//      size_t i( 0UL );
-//
-//      for( ; (i+8UL) <= M; i+=8UL )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i+7UL : i+8UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         size_t j( jbegin );
-//
-//         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-//            const size_t j1( j+SIMDSIZE     );
-//            const size_t j2( j+SIMDSIZE*2UL );
-//            const size_t j3( j+SIMDSIZE*3UL );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            const SIMDType x3( x.load(j2) );
-//            const SIMDType x4( x.load(j3) );
-//            y[i    ] -= sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 + A.load(i    ,j2) * x3 + A.load(i    ,j3) * x4 ) * scalar;
-//            y[i+1UL] -= sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 + A.load(i+1UL,j2) * x3 + A.load(i+1UL,j3) * x4 ) * scalar;
-//            y[i+2UL] -= sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 + A.load(i+2UL,j2) * x3 + A.load(i+2UL,j3) * x4 ) * scalar;
-//            y[i+3UL] -= sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 + A.load(i+3UL,j2) * x3 + A.load(i+3UL,j3) * x4 ) * scalar;
-//            y[i+4UL] -= sum( A.load(i+4UL,j) * x1 + A.load(i+4UL,j1) * x2 + A.load(i+4UL,j2) * x3 + A.load(i+4UL,j3) * x4 ) * scalar;
-//            y[i+5UL] -= sum( A.load(i+5UL,j) * x1 + A.load(i+5UL,j1) * x2 + A.load(i+5UL,j2) * x3 + A.load(i+5UL,j3) * x4 ) * scalar;
-//            y[i+6UL] -= sum( A.load(i+6UL,j) * x1 + A.load(i+6UL,j1) * x2 + A.load(i+6UL,j2) * x3 + A.load(i+6UL,j3) * x4 ) * scalar;
-//            y[i+7UL] -= sum( A.load(i+7UL,j) * x1 + A.load(i+7UL,j1) * x2 + A.load(i+7UL,j2) * x3 + A.load(i+7UL,j3) * x4 ) * scalar;
-//         }
-//
-//         for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-//            const size_t j1( j+SIMDSIZE );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            y[i    ] -= sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 ) * scalar;
-//            y[i+1UL] -= sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 ) * scalar;
-//            y[i+2UL] -= sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 ) * scalar;
-//            y[i+3UL] -= sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 ) * scalar;
-//            y[i+4UL] -= sum( A.load(i+4UL,j) * x1 + A.load(i+4UL,j1) * x2 ) * scalar;
-//            y[i+5UL] -= sum( A.load(i+5UL,j) * x1 + A.load(i+5UL,j1) * x2 ) * scalar;
-//            y[i+6UL] -= sum( A.load(i+6UL,j) * x1 + A.load(i+6UL,j1) * x2 ) * scalar;
-//            y[i+7UL] -= sum( A.load(i+7UL,j) * x1 + A.load(i+7UL,j1) * x2 ) * scalar;
-//         }
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            y[i    ] -= sum( A.load(i    ,j) * x1 ) * scalar;
-//            y[i+1UL] -= sum( A.load(i+1UL,j) * x1 ) * scalar;
-//            y[i+2UL] -= sum( A.load(i+2UL,j) * x1 ) * scalar;
-//            y[i+3UL] -= sum( A.load(i+3UL,j) * x1 ) * scalar;
-//            y[i+4UL] -= sum( A.load(i+4UL,j) * x1 ) * scalar;
-//            y[i+5UL] -= sum( A.load(i+5UL,j) * x1 ) * scalar;
-//            y[i+6UL] -= sum( A.load(i+6UL,j) * x1 ) * scalar;
-//            y[i+7UL] -= sum( A.load(i+7UL,j) * x1 ) * scalar;
-//         }
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i    ] -= A(i    ,j) * x[j] * scalar;
-//            y[i+1UL] -= A(i+1UL,j) * x[j] * scalar;
-//            y[i+2UL] -= A(i+2UL,j) * x[j] * scalar;
-//            y[i+3UL] -= A(i+3UL,j) * x[j] * scalar;
-//            y[i+4UL] -= A(i+4UL,j) * x[j] * scalar;
-//            y[i+5UL] -= A(i+5UL,j) * x[j] * scalar;
-//            y[i+6UL] -= A(i+6UL,j) * x[j] * scalar;
-//            y[i+7UL] -= A(i+7UL,j) * x[j] * scalar;
-//         }
-//      }
-//
-//      for( ; (i+4UL) <= M; i+=4UL )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i+3UL : i+4UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         size_t j( jbegin );
-//
-//         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-//            const size_t j1( j+SIMDSIZE     );
-//            const size_t j2( j+SIMDSIZE*2UL );
-//            const size_t j3( j+SIMDSIZE*3UL );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            const SIMDType x3( x.load(j2) );
-//            const SIMDType x4( x.load(j3) );
-//            y[i    ] -= sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 + A.load(i    ,j2) * x3 + A.load(i    ,j3) * x4 ) * scalar;
-//            y[i+1UL] -= sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 + A.load(i+1UL,j2) * x3 + A.load(i+1UL,j3) * x4 ) * scalar;
-//            y[i+2UL] -= sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 + A.load(i+2UL,j2) * x3 + A.load(i+2UL,j3) * x4 ) * scalar;
-//            y[i+3UL] -= sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 + A.load(i+3UL,j2) * x3 + A.load(i+3UL,j3) * x4 ) * scalar;
-//         }
-//
-//         for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-//            const size_t j1( j+SIMDSIZE );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            y[i    ] -= sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 ) * scalar;
-//            y[i+1UL] -= sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 ) * scalar;
-//            y[i+2UL] -= sum( A.load(i+2UL,j) * x1 + A.load(i+2UL,j1) * x2 ) * scalar;
-//            y[i+3UL] -= sum( A.load(i+3UL,j) * x1 + A.load(i+3UL,j1) * x2 ) * scalar;
-//         }
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            y[i    ] -= sum( A.load(i    ,j) * x1 ) * scalar;
-//            y[i+1UL] -= sum( A.load(i+1UL,j) * x1 ) * scalar;
-//            y[i+2UL] -= sum( A.load(i+2UL,j) * x1 ) * scalar;
-//            y[i+3UL] -= sum( A.load(i+3UL,j) * x1 ) * scalar;
-//         }
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i    ] -= A(i    ,j) * x[j] * scalar;
-//            y[i+1UL] -= A(i+1UL,j) * x[j] * scalar;
-//            y[i+2UL] -= A(i+2UL,j) * x[j] * scalar;
-//            y[i+3UL] -= A(i+3UL,j) * x[j] * scalar;
-//         }
-//      }
-//
-//      for( ; (i+2UL) <= M; i+=2UL )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i+1UL : i+2UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         size_t j( jbegin );
-//
-//         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-//            const size_t j1( j+SIMDSIZE     );
-//            const size_t j2( j+SIMDSIZE*2UL );
-//            const size_t j3( j+SIMDSIZE*3UL );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            const SIMDType x3( x.load(j2) );
-//            const SIMDType x4( x.load(j3) );
-//            y[i    ] -= sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 + A.load(i    ,j2) * x3 + A.load(i    ,j3) * x4 ) * scalar;
-//            y[i+1UL] -= sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 + A.load(i+1UL,j2) * x3 + A.load(i+1UL,j3) * x4 ) * scalar;
-//         }
-//
-//         for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-//            const size_t j1( j+SIMDSIZE );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            y[i    ] -= sum( A.load(i    ,j) * x1 + A.load(i    ,j1) * x2 ) * scalar;
-//            y[i+1UL] -= sum( A.load(i+1UL,j) * x1 + A.load(i+1UL,j1) * x2 ) * scalar;
-//         }
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            y[i    ] -= sum( A.load(i    ,j) * x1 ) * scalar;
-//            y[i+1UL] -= sum( A.load(i+1UL,j) * x1 ) * scalar;
-//         }
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i    ] -= A(i    ,j) * x[j] * scalar;
-//            y[i+1UL] -= A(i+1UL,j) * x[j] * scalar;
-//         }
-//      }
-//
-//      if( i < M )
-//      {
-//         const size_t jbegin( ( IsUpper_v<TT1> )
-//                              ?( ( IsStrictlyUpper_v<TT1> ? i+1UL : i ) & size_t(-SIMDSIZE) )
-//                              :( 0UL ) );
-//         const size_t jend( ( IsLower_v<TT1> )
-//                            ?( IsStrictlyLower_v<TT1> ? i : i+1UL )
-//                            :( N ) );
-//         BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
-//
-//         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
-//         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//         size_t j( jbegin );
-//
-//         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
-//            const size_t j1( j+SIMDSIZE     );
-//            const size_t j2( j+SIMDSIZE*2UL );
-//            const size_t j3( j+SIMDSIZE*3UL );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            const SIMDType x3( x.load(j2) );
-//            const SIMDType x4( x.load(j3) );
-//            y[i] -= sum( A.load(i,j) * x1 + A.load(i,j1) * x2 + A.load(i,j2) * x3 + A.load(i,j3) * x4 ) * scalar;
-//         }
-//
-//         for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
-//            const size_t j1( j+SIMDSIZE );
-//            const SIMDType x1( x.load(j ) );
-//            const SIMDType x2( x.load(j1) );
-//            y[i] -= sum( A.load(i,j) * x1 + A.load(i,j1) * x2 ) * scalar;
-//         }
-//
-//         for( ; j<jpos; j+=SIMDSIZE ) {
-//            const SIMDType x1( x.load(j) );
-//            y[i] -= sum( A.load(i,j) * x1 ) * scalar;
-//         }
-//
-//         for( ; remainder && j<jend; ++j ) {
-//            y[i] -= A(i,j) * x[j] * scalar;
-//         }
-//      }
-//   }
+   //**********************************************************************************************
+
+   //**Vectorized default subtraction assignment to dense vectors (large tensors)******************
+   /*!\brief Vectorized default subtraction assignment of a large scaled dense tensor-dense vector
+   //        multiplication (\f$ \vec{y}-=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function implements the vectorized default subtraction assignment kernel for the scaled
+   // dense tensor-dense vector multiplication. This kernel is optimized for large tensors. The
+   // columns are processed in panels, such that the currently used part of \a x remains in the L1
+   // cache while it is reused for all rows of the tensor.
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline auto selectLargeSubAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
+      -> EnableIf_t< UseVectorizedDefaultKernel_v<MT1,TT1,VT1,ST2> >
+   {
+      constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<VT1> );
+      constexpr size_t jblock( ( 16384UL / sizeof( ElementType ) ) & size_t(-SIMDSIZE) );
+
+      BLAZE_STATIC_ASSERT( jblock >= SIMDSIZE );
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t R( A.pages() * M );
+
+      for( size_t jj=0UL; jj<N; jj+=jblock )
+      {
+         const size_t jend( min( jj+jblock, N ) );
+         const size_t jpos( remainder ? ( jend & size_t(-SIMDSIZE) ) : jend );
+         BLAZE_INTERNAL_ASSERT( !remainder || ( jend - ( jend % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+         size_t r( 0UL );
+
+         for( ; (r+4UL) <= R; r+=4UL )
+         {
+            const size_t k1( (r    )/M ), i1( (r    )%M );
+            const size_t k2( (r+1UL)/M ), i2( (r+1UL)%M );
+            const size_t k3( (r+2UL)/M ), i3( (r+2UL)%M );
+            const size_t k4( (r+3UL)/M ), i4( (r+3UL)%M );
+
+            SIMDType xmm1, xmm2, xmm3, xmm4;
+            size_t j( jj );
+
+            for( ; j<jpos; j+=SIMDSIZE ) {
+               const SIMDType x1( x.load(j) );
+               xmm1 += A.load(k1,i1,j) * x1;
+               xmm2 += A.load(k2,i2,j) * x1;
+               xmm3 += A.load(k3,i3,j) * x1;
+               xmm4 += A.load(k4,i4,j) * x1;
+            }
+
+            y(k1,i1) -= sum( xmm1 ) * scalar;
+            y(k2,i2) -= sum( xmm2 ) * scalar;
+            y(k3,i3) -= sum( xmm3 ) * scalar;
+            y(k4,i4) -= sum( xmm4 ) * scalar;
+
+            for( ; remainder && j<jend; ++j ) {
+               y(k1,i1) -= A(k1,i1,j) * x[j] * scalar;
+               y(k2,i2) -= A(k2,i2,j) * x[j] * scalar;
+               y(k3,i3) -= A(k3,i3,j) * x[j] * scalar;
+               y(k4,i4) -= A(k4,i4,j) * x[j] * scalar;
+            }
+         }
+
+         for( ; r<R; ++r )
+         {
+            const size_t k( r/M ), i( r%M );
+
+            SIMDType xmm1;
+            size_t j( jj );
+
+            for( ; j<jpos; j+=SIMDSIZE ) {
+               xmm1 += A.load(k,i,j) * x.load(j);
+            }
+
+            y(k,i) -= sum( xmm1 ) * scalar;
+
+            for( ; remainder && j<jend; ++j ) {
+               y(k,i) -= A(k,i,j) * x[j] * scalar;
+            }
+         }
+      }
+   }
    //**********************************************************************************************
 
    //**BLAS-based subtraction assignment to dense vectors (default)********************************
@@ -4873,7 +3068,7 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    //        (\f$ \vec{y}-=s*A*\vec{x} \f$).
    // \ingroup dense_vector
    //
-   // \param y The target left-hand side dense vector.
+   // \param y The target left-hand side dense matrix.
    // \param A The left-hand side dense tensor operand.
    // \param x The right-hand side dense vector operand.
    // \param scalar The scaling factor.
@@ -4882,7 +3077,7 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    // This function relays to the default implementation of the subtraction assignment of a large
    // scaled dense tensor-dense vector multiplication expression to a dense vector.
    */
-   template< typename MT1    // Type of the left-hand side target vector
+   template< typename MT1    // Type of the left-hand side target matrix
            , typename TT1    // Type of the left-hand side tensor operand
            , typename VT1    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
@@ -4895,37 +3090,38 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
 
    //**BLAS-based subtraction assignment to dense vectors******************************************
 #if BLAZE_BLAS_MODE && BLAZE_USE_BLAS_TENSOR_VECTOR_MULTIPLICATION
-//   /*!\brief BLAS-based subtraction assignment of a scaled dense tensor-dense vector multiplication
-//   //        (\f$ \vec{y}-=s*A*\vec{x} \f$).
-//   // \ingroup dense_vector
-//   //
-//   // \param y The target left-hand side dense vector.
-//   // \param A The left-hand side dense tensor operand.
-//   // \param x The right-hand side dense vector operand.
-//   // \param scalar The scaling factor.
-//   // \return void
-//   //
-//   // This function performs the scaled dense tensor-dense vector multiplication based on the
-//   // according BLAS functionality.
-//   */
-//   template< typename VT1    // Type of the left-hand side target vector
-//           , typename TT1    // Type of the left-hand side tensor operand
-//           , typename VT2    // Type of the right-hand side vector operand
-//           , typename ST2 >  // Type of the scalar value
-//   static inline auto selectBlasSubAssignKernel( VT1& y, const TT1& A, const VT2& x, ST2 scalar )
-//      -> EnableIf_t< UseBlasKernel_v<VT1,TT1,VT2,ST2> >
-//   {
-//      using ET = ElementType_t<VT1>;
-//
-//      if( IsTriangular_v<TT1> ) {
-//         ResultType_t<VT1> tmp( serial( scalar * x ) );
-//         trmv( tmp, A, ( IsLower_v<TT1> )?( CblasLower ):( CblasUpper ) );
-//         subAssign( y, tmp );
-//      }
-//      else {
-//         gemv( y, A, x, ET(-scalar), ET(1) );
-//      }
-//   }
+   /*!\brief BLAS-based subtraction assignment of a scaled dense tensor-dense vector multiplication
+   //        (\f$ \vec{y}-=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   //
+   // This function performs the scaled dense tensor-dense vector multiplication based on the
+   // according BLAS functionality. Each page of \a A is multiplied with \a x into the according
+   // row of \a y, with the scaling factor passed as the \c alpha argument of \c gemv().
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline auto selectBlasSubAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
+      -> EnableIf_t< UseBlasKernel_v<MT1,TT1,VT1,ST2> >
+   {
+      using ET = ElementType_t<MT1>;
+
+      const int M  ( numeric_cast<int>( A.rows()    ) );
+      const int N  ( numeric_cast<int>( A.columns() ) );
+      const int lda( numeric_cast<int>( A.spacing() ) );
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         gemv( CblasRowMajor, CblasNoTrans, M, N, ET(-scalar), A.data(0UL,k), lda,
+               x.data(), 1, ET(1), y.data(k), 1 );
+      }
+   }
 #endif
    //**********************************************************************************************
 
@@ -4958,7 +3154,7 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryTrait_t<ResultType> tmp( serial( rhs ) );
       schurAssign( ~lhs, tmp );
    }
    //**********************************************************************************************
@@ -5166,7 +3362,7 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const ResultType tmp( rhs );
+      const TemporaryTrait_t<ResultType> tmp( rhs );
       smpMultAssign( ~lhs, tmp );
    }
    //**********************************************************************************************
@@ -75,6 +75,7 @@
 #include <blaze_tensor/math/constraints/Tensor.h>
 #include <blaze_tensor/math/expressions/DenseTensor.h>
 #include <blaze_tensor/math/expressions/TensReduceExpr.h>
+#include <blaze_tensor/math/traits/TemporaryTrait.h>
 
 namespace blaze {
 
@@ -616,7 +617,7 @@ class DTensReduceExpr<MT,OP,columnwise>
       BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryTrait_t<ResultType> tmp( serial( rhs ) );
       assign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -655,7 +656,7 @@ class DTensReduceExpr<MT,OP,columnwise>
          }
       }
       else {
-         const ResultType tmp( serial( rhs ) );
+         const TemporaryTrait_t<ResultType> tmp( serial( rhs ) );
          addAssign( ~lhs, tmp );
       }
    }
@@ -688,7 +689,7 @@ class DTensReduceExpr<MT,OP,columnwise>
       BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryTrait_t<ResultType> tmp( serial( rhs ) );
       addAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -727,7 +728,7 @@ class DTensReduceExpr<MT,OP,columnwise>
          }
       }
       else {
-         const ResultType tmp( serial( rhs ) );
+         const TemporaryTrait_t<ResultType> tmp( serial( rhs ) );
          subAssign( ~lhs, tmp );
       }
    }
@@ -760,7 +761,7 @@ class DTensReduceExpr<MT,OP,columnwise>
       BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryTrait_t<ResultType> tmp( serial( rhs ) );
       subAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -799,7 +800,7 @@ class DTensReduceExpr<MT,OP,columnwise>
          }
       }
       else {
-         const ResultType tmp( serial( rhs ) );
+         const TemporaryTrait_t<ResultType> tmp( serial( rhs ) );
          multAssign( ~lhs, tmp );
       }
    }
@@ -832,7 +833,7 @@ class DTensReduceExpr<MT,OP,columnwise>
       BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryTrait_t<ResultType> tmp( serial( rhs ) );
       multAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -864,7 +865,7 @@ class DTensReduceExpr<MT,OP,columnwise>
       BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
 
-      const ResultType tmp( serial( rhs ) );
+      const TemporaryTrait_t<ResultType> tmp( serial( rhs ) );
       divAssign( ~lhs, tmp );
    }
    /*! \endcond */
@@ -3088,6 +3089,9 @@ inline auto dtensreduce( const DenseTensor<MT>& dm, Add /*op*/ )
 // possible to create vectorized custom operations. See \ref custom_operations for a detailed
 // overview of the possibilities of custom operations.
 //
+// In case a shared memory parallelization mode is active and the tensor has at least
+// SMP_DTENSREDUCE_THRESHOLD elements, the reduction is performed in parallel.
+//
 // Please note that the evaluation order of the reduction operation is unspecified. Thus the
 // behavior is non-deterministic if \a op is not associative or not commutative. Also, the
 // operation is undefined if the given reduction operation modifies the values.
@@ -3098,7 +3102,7 @@ inline decltype(auto) reduce( const DenseTensor<MT>& dm, OP op )
 {
    BLAZE_FUNCTION_TRACE;
 
-   return dtensreduce( ~dm, op );
+   return smpReduce( ~dm, op );
 }
 //*************************************************************************************************
 
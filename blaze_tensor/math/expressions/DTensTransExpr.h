@@ -53,8 +53,10 @@
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/simd/SIMDTrait.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsHermitian.h>
 #include <blaze/math/typetraits/IsLower.h>
@@ -66,13 +68,16 @@
 #include <blaze/math/typetraits/IsUniUpper.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/system/Blocking.h>
 #include <blaze/system/Inline.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/InvalidType.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/mpl/If.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
 #include <blaze/util/typetraits/GetMemberType.h>
 
 #include <blaze_tensor/math/constraints/DenseTensor.h>
@@ -80,6 +85,7 @@
 #include <blaze_tensor/math/expressions/DTensTransposer.h>
 #include <blaze_tensor/math/expressions/DenseTensor.h>
 #include <blaze_tensor/math/expressions/TensTransExpr.h>
+#include <blaze_tensor/math/simd/Transpose.h>
 
 
 namespace blaze {
@@ -100,7 +106,7 @@ namespace blaze {
 template< typename MT,        // Type of the dense tensor
           size_t... CTAs >    // Compile time arguments
 class DTensTransExpr
-   : public TensTransExpr< DenseTensor< DTensTransExpr<MT> > >
+   : public TensTransExpr< DenseTensor< DTensTransExpr<MT,CTAs...> > >
    , public DTensTransExprData<CTAs...>
    , private If< IsComputation_v<MT> >::template Type< Computation, Transformation >
 {
@@ -145,9 +151,25 @@ class DTensTransExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Blocked evaluation strategy*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the cache-blocked transposition
+       kernels. In case the dense tensor operand does not require an intermediate evaluation and
+       both the operand and the target tensor provide direct access to their contiguous rows, the
+       variable is set to 1 and the blocked kernels are selected. Otherwise the variable is set
+       to 0 and the default strategy is chosen. */
+   template< typename MT2 >
+   static constexpr bool UseBlockedKernel_v =
+      ( !useAssign &&
+        IsContiguous_v<MT> && HasConstDataAccess_v<MT> &&
+        IsContiguous_v<MT2> && HasMutableDataAccess_v<MT2> );
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
-   using This          = DTensTransExpr<MT>;          //!< Type of this DTensTransExpr instance.
+   using This          = DTensTransExpr<MT,CTAs...>;  //!< Type of this DTensTransExpr instance.
    using ResultType    = TransposeType_t<MT>;         //!< Result type for expression template evaluations.
    using OppositeType  = OppositeType_t<ResultType>;  //!< Result type with opposite storage order for expression template evaluations.
    using TransposeType = ResultType_t<MT>;            //!< Transpose type for expression template evaluations.
@@ -417,6 +439,269 @@ class DTensTransExpr
    Operand dm_;  //!< Dense tensor of the transposition expression.
    //**********************************************************************************************
 
+   //**Block transposition kernel*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Transposition kernel for a single 2D block of the dense tensor operand.
+   // \ingroup dense_tensor
+   //
+   // \param dst Function returning the address of the target row for a given row index.
+   // \param src The address of the first element of the 2D slice of the operand.
+   // \param sj The stride of the operand along the result columns.
+   // \param ibegin The first row of the block.
+   // \param iend The end of the rows of the block.
+   // \param jbegin The first column of the block.
+   // \param jend The end of the columns of the block.
+   // \param op The element-wise assignment operation.
+   // \return void
+   //
+   // This function applies \a op to the elements \a dst(i)[j] and \a src[i+j*sj] of the given
+   // block. The block is processed in square tiles of \a SIMDSIZE x \a SIMDSIZE elements, which
+   // are transposed in SIMD registers (see transposeTile()) into a small buffer before they are
+   // applied row by row. The remaining rows and columns are processed element by element.
+   */
+   template< typename DST   // Type of the target row access function
+           , typename OP >  // Type of the element-wise assignment operation
+   static inline void transposeBlock( DST dst, const ElementType* src, size_t sj,
+                                      size_t ibegin, size_t iend, size_t jbegin, size_t jend,
+                                      OP op )
+   {
+      constexpr size_t SIMDSIZE( SIMDTrait<ElementType>::size );
+
+      alignas( AlignmentOf_v<ElementType> ) ElementType tile[SIMDSIZE*SIMDSIZE];
+
+      const size_t ipos( ibegin + ( ( iend - ibegin ) & size_t(-SIMDSIZE) ) );
+      const size_t jpos( jbegin + ( ( jend - jbegin ) & size_t(-SIMDSIZE) ) );
+
+      size_t i( ibegin );
+
+      for( ; i<ipos; i+=SIMDSIZE )
+      {
+         for( size_t j=jbegin; j<jpos; j+=SIMDSIZE ) {
+            transposeTile( src + i + j*sj, sj, tile );
+            for( size_t ii=0UL; ii<SIMDSIZE; ++ii ) {
+               auto* d( dst( i+ii ) + j );
+               for( size_t jj=0UL; jj<SIMDSIZE; ++jj ) {
+                  op( d[jj], tile[ii*SIMDSIZE+jj] );
+               }
+            }
+         }
+         for( size_t ii=i; ii<i+SIMDSIZE; ++ii ) {
+            auto* d( dst( ii ) );
+            for( size_t j=jpos; j<jend; ++j ) {
+               op( d[j], src[ii+j*sj] );
+            }
+         }
+      }
+
+      for( ; i<iend; ++i ) {
+         auto* d( dst( i ) );
+         for( size_t j=jbegin; j<jend; ++j ) {
+            op( d[j], src[i+j*sj] );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Blocked transposition kernel***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Cache-blocked kernel for the transposition of a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param C The target left-hand side dense tensor.
+   // \param rhs The right-hand side transposition expression.
+   // \param op The element-wise assignment operation.
+   // \return void
+   //
+   // This function implements the kernel for all permutations of the dense tensor operand. Each
+   // permutation is reduced to the strides of the operand along the three result dimensions. In
+   // case the columns of the operand remain the columns of the result, the rows are processed
+   // as contiguous row copies. Otherwise the result dimension that walks the contiguous columns
+   // of the operand is combined with the result columns into a 2D transposition, which is tiled
+   // in blocks of size \a BLOCK_SIZE to keep both the read and the write streams in the cache.
+   // Each block is transposed by means of transposeBlock().
+   */
+   template< typename MT2   // Type of the target dense tensor
+           , typename OP >  // Type of the element-wise assignment operation
+   static inline void transposeKernel( MT2& C, const DTensTransExpr& rhs, OP op )
+   {
+      const auto& A( rhs.dm_ );
+
+      const size_t O( C.pages() );
+      const size_t M( C.rows() );
+      const size_t N( C.columns() );
+
+      if( O == 0UL || M == 0UL || N == 0UL )
+         return;
+
+      const auto idx( rhs.idces() );
+
+      const size_t strides[3] = {
+         ( A.pages() > 1UL ? static_cast<size_t>( A.data( 0UL, 1UL ) - A.data( 0UL, 0UL ) ) : 0UL ),
+         ( A.rows()  > 1UL ? static_cast<size_t>( A.data( 1UL, 0UL ) - A.data( 0UL, 0UL ) ) : 0UL ),
+         1UL };
+
+      const size_t sk( strides[idx[0]] );
+      const size_t si( strides[idx[1]] );
+      const size_t sj( strides[idx[2]] );
+
+      const ElementType_t<MT>* base( A.data( 0UL, 0UL ) );
+
+      if( idx[2] == 2UL )
+      {
+         for( size_t k=0UL; k<O; ++k ) {
+            for( size_t i=0UL; i<M; ++i ) {
+               auto* dst( C.data( i, k ) );
+               const auto* src( base + k*sk + i*si );
+               for( size_t j=0UL; j<N; ++j ) {
+                  op( dst[j], src[j] );
+               }
+            }
+         }
+      }
+      else if( idx[1] == 2UL )
+      {
+         for( size_t k=0UL; k<O; ++k ) {
+            const auto dst( [&C,k]( size_t i ){ return C.data( i, k ); } );
+            for( size_t ii=0UL; ii<M; ii+=BLOCK_SIZE ) {
+               const size_t iend( min( ii+BLOCK_SIZE, M ) );
+               for( size_t jj=0UL; jj<N; jj+=BLOCK_SIZE ) {
+                  const size_t jend( min( jj+BLOCK_SIZE, N ) );
+                  transposeBlock( dst, base + k*sk, sj, ii, iend, jj, jend, op );
+               }
+            }
+         }
+      }
+      else
+      {
+         for( size_t i=0UL; i<M; ++i ) {
+            const auto dst( [&C,i]( size_t k ){ return C.data( i, k ); } );
+            for( size_t kk=0UL; kk<O; kk+=BLOCK_SIZE ) {
+               const size_t kend( min( kk+BLOCK_SIZE, O ) );
+               for( size_t jj=0UL; jj<N; jj+=BLOCK_SIZE ) {
+                  const size_t jend( min( jj+BLOCK_SIZE, N ) );
+                  transposeBlock( dst, base + i*si, sj, kk, kend, jj, jend, op );
+               }
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Blocked assignment to dense tensors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Blocked assignment of a dense tensor transposition expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side transposition expression to be assigned.
+   // \return void
+   //
+   // This function implements the cache-blocked assignment of a dense tensor transposition
+   // expression to a dense tensor. Due to the explicit application of the SFINAE principle,
+   // this function can only be selected by the compiler in case both the operand and the
+   // target tensor provide direct access to their contiguous rows.
+   */
+   template< typename MT2 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseBlockedKernel_v<MT2> >
+      assign( DenseTensor<MT2>& lhs, const DTensTransExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      transposeKernel( ~lhs, rhs, []( auto& a, const auto& b ){ a = b; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Blocked addition assignment to dense tensors***********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Blocked addition assignment of a dense tensor transposition expression to a dense
+   //        tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side transposition expression to be added.
+   // \return void
+   //
+   // This function implements the cache-blocked addition assignment of a dense tensor
+   // transposition expression to a dense tensor.
+   */
+   template< typename MT2 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseBlockedKernel_v<MT2> >
+      addAssign( DenseTensor<MT2>& lhs, const DTensTransExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      transposeKernel( ~lhs, rhs, []( auto& a, const auto& b ){ a += b; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Blocked subtraction assignment to dense tensors********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Blocked subtraction assignment of a dense tensor transposition expression to a
+   //        dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side transposition expression to be subtracted.
+   // \return void
+   //
+   // This function implements the cache-blocked subtraction assignment of a dense tensor
+   // transposition expression to a dense tensor.
+   */
+   template< typename MT2 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseBlockedKernel_v<MT2> >
+      subAssign( DenseTensor<MT2>& lhs, const DTensTransExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      transposeKernel( ~lhs, rhs, []( auto& a, const auto& b ){ a -= b; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Blocked Schur product assignment to dense tensors******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Blocked Schur product assignment of a dense tensor transposition expression to a
+   //        dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side transposition expression for the Schur product.
+   // \return void
+   //
+   // This function implements the cache-blocked Schur product assignment of a dense tensor
+   // transposition expression to a dense tensor.
+   */
+   template< typename MT2 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseBlockedKernel_v<MT2> >
+      schurAssign( DenseTensor<MT2>& lhs, const DTensTransExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      transposeKernel( ~lhs, rhs, []( auto& a, const auto& b ){ a *= b; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense tensors****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense tensor transposition expression to a dense tensor.
@@ -441,8 +726,8 @@ class DTensTransExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      DTensTransposer<MT2> tmp( ~lhs, rhs.pages(), rhs.rows(), rhs.columns() );
-      assign( tmp, rhs.dm_ );
+      const RT tmp( serial( rhs.dm_ ) );
+      assign( ~lhs, trans( tmp, rhs.idces().data(), 3UL ) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -509,8 +794,8 @@ class DTensTransExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      DTensTransposer<MT2> tmp( ~lhs, rhs.pages(), rhs.rows(), rhs.columns() );
-      addAssign( tmp, rhs.dm_ );
+      const RT tmp( serial( rhs.dm_ ) );
+      addAssign( ~lhs, trans( tmp, rhs.idces().data(), 3UL ) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -543,8 +828,8 @@ class DTensTransExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      DTensTransposer<MT2> tmp( ~lhs, rhs.pages(), rhs.rows(), rhs.columns() );
-      subAssign( tmp, rhs.dm_ );
+      const RT tmp( serial( rhs.dm_ ) );
+      subAssign( ~lhs, trans( tmp, rhs.idces().data(), 3UL ) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -577,8 +862,8 @@ class DTensTransExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      DTensTransposer<MT2> tmp( ~lhs, rhs.pages(), rhs.rows(), rhs.columns() );
-      schurAssign( tmp, rhs.dm_ );
+      const RT tmp( serial( rhs.dm_ ) );
+      schurAssign( ~lhs, trans( tmp, rhs.idces().data(), 3UL ) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -619,8 +904,8 @@ class DTensTransExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      DTensTransposer<MT2> tmp( ~lhs, rhs.pages(), rhs.rows(), rhs.columns() );
-      smpAssign( tmp, rhs.dm_ );
+      const RT tmp( rhs.dm_ );
+      smpAssign( ~lhs, trans( tmp, rhs.idces().data(), 3UL ) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -687,8 +972,8 @@ class DTensTransExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      DTensTransposer<MT2> tmp( ~lhs, rhs.pages(), rhs.rows(), rhs.columns() );
-      smpAddAssign( tmp, rhs.dm_ );
+      const RT tmp( rhs.dm_ );
+      smpAddAssign( ~lhs, trans( tmp, rhs.idces().data(), 3UL ) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -721,8 +1006,8 @@ class DTensTransExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      DTensTransposer<MT2> tmp( ~lhs, rhs.pages(), rhs.rows(), rhs.columns() );
-      smpSubAssign( tmp, rhs.dm_ );
+      const RT tmp( rhs.dm_ );
+      smpSubAssign( ~lhs, trans( tmp, rhs.idces().data(), 3UL ) );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -756,8 +1041,8 @@ class DTensTransExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      DTensTransposer<MT2> tmp( ~lhs, rhs.pages(), rhs.rows(), rhs.columns() );
-      smpSchurAssign( tmp, rhs.dm_ );
+      const RT tmp( rhs.dm_ );
+      smpSchurAssign( ~lhs, trans( tmp, rhs.idces().data(), 3UL ) );
    }
    /*! \endcond */
    //**********************************************************************************************
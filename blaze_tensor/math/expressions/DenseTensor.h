@@ -98,6 +98,9 @@ BLAZE_ALWAYS_INLINE typename TT::ElementType* data( const DenseTensor<TT>& dm )
 
 template< typename TT >
 BLAZE_ALWAYS_INLINE size_t spacing( const DenseTensor<TT>& dm ) noexcept;
+
+template< typename TT >
+BLAZE_ALWAYS_INLINE size_t pageStride( const DenseTensor<TT>& dm ) noexcept;
 //@}
 //*************************************************************************************************
 
@@ -244,6 +247,28 @@ BLAZE_ALWAYS_INLINE size_t spacing( const DenseTensor<TT>& dm ) noexcept
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Returns the distance between the beginning of two pages.
+// \ingroup dense_tensor
+//
+// \param dm The given tensor.
+// \return The number of elements between the first elements of two consecutive pages.
+//
+// The given tensor has to provide constant data access. For a view the page distance is
+// determined by the underlying tensor and therefore generally differs from \c rows()*spacing()
+// of the view itself.
+*/
+template< typename TT > // Type of the tensor
+BLAZE_ALWAYS_INLINE size_t pageStride( const DenseTensor<TT>& dm ) noexcept
+{
+   if( (~dm).pages() > 1UL )
+      return static_cast<size_t>( (~dm).data( 0UL, 1UL ) - (~dm).data( 0UL, 0UL ) );
+   else
+      return (~dm).rows() * (~dm).spacing();
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -57,11 +57,13 @@ template< typename > struct DenseArray;
 template< typename > struct DenseTensor;
 
 template< typename > class DTensSerialExpr;
+template< typename, typename, size_t, typename > class DTensDMatMapExpr;
 template< typename, typename, bool > class DTensDMatSchurExpr;
 template< typename, typename > class DTensDTensAddExpr;
 template< typename, typename > class DTensDTensMultExpr;
 template< typename, typename > class DTensDTensSchurExpr;
 template< typename, typename > class DTensDTensSubExpr;
+template< typename, typename, size_t, typename > class DTensDVecMapExpr;
 template< typename, typename > class DTensDVecMultExpr;
 template< typename, typename > class DTensMapExpr;
 template< typename > class DTensRavelExpr;
@@ -127,6 +129,12 @@ decltype(auto) map( const DenseTensor<TT>&, OP );
 template< typename TT1, typename TT2, typename OP >
 decltype(auto) map( const DenseTensor<TT1>&, const DenseTensor<TT2>&, OP );
 
+template< size_t RF, typename TT, typename MT, bool SO, typename OP >
+decltype(auto) map( const DenseTensor<TT>&, const DenseMatrix<MT,SO>&, OP );
+
+template< size_t RF, typename TT, typename VT, bool TF, typename OP >
+decltype(auto) map( const DenseTensor<TT>&, const DenseVector<VT,TF>&, OP );
+
 template< typename TT, typename OP >
 decltype(auto) map( const DenseArray<TT>&, OP );
 
@@ -0,0 +1,680 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/serialization/ArraySerializer.h
+//  \brief Serialization of dense arrays
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+#ifndef _BLAZE_TENSOR_MATH_SERIALIZATION_ARRAYSERIALIZER_H_
+#define _BLAZE_TENSOR_MATH_SERIALIZATION_ARRAYSERIALIZER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+#include <blaze_tensor/math/expressions/Array.h>
+#include <blaze_tensor/math/expressions/DenseArray.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Serializer for dense N-dimensional arrays.
+// \ingroup math_serialization
+//
+// The ArraySerializer implements the necessary logic to serialize dense arrays, i.e. to convert
+// them into a portable, binary representation. The following example demonstrates the
+// (de-)serialization process of arrays:
+
+   \code
+   using blaze::DynamicArray;
+
+   // Serialization of a 4-dimensional array
+   {
+      DynamicArray<4UL,double> A( 2UL, 3UL, 4UL, 5UL );
+
+      // ... Initialization
+
+      // Creating an archive that writes into the file "arrays.blaze"
+      blaze::Archive<std::ofstream> archive( "arrays.blaze" );
+
+      archive << A;
+   }
+
+   // Reconstitution of the array
+   {
+      DynamicArray<4UL,double> A;
+
+      // Creating an archive that reads from the file "arrays.blaze"
+      blaze::Archive<std::ifstream> archive( "arrays.blaze" );
+
+      archive >> A;
+   }
+   \endcode
+
+// Each serialized array consists of a header, which holds the version of the format, the type of
+// the array, the type and size of the elements, the number of dimensions and the extent of each
+// dimension (in the order returned by the \c dimensions() member function, starting with the
+// number of columns), followed by the elements in row-major order. The padding elements of the
+// array are not part of the archive. Array expressions are evaluated before their serialization.
+// In case the elements are of built-in data type, every row of the array is written to and read
+// from the archive in a single bulk operation directly from or into the memory of the array.
+// Arrays can only be reconstituted into arrays of the same dimensionality and element type, and
+// into non-resizable arrays (as for instance CustomArray) only in case the extents match.
+*/
+class ArraySerializer
+{
+ private:
+   //**Auxiliary alias declarations****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Type for the row access of the serialized array.
+   /*! Arrays with direct access to their contiguous rows are serialized in-place, all other
+       arrays (i.e. array expressions) are evaluated first. */
+   template< typename TT >
+   using RowAccessType_t =
+      If_t< IsContiguous_v<TT> && HasConstDataAccess_v<TT>, const TT&, const ResultType_t<TT> >;
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline ArraySerializer();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   // No explicitly declared copy assignment operator.
+   //**********************************************************************************************
+
+   //**Serialization functions*********************************************************************
+   /*!\name Serialization functions */
+   //@{
+   template< typename Archive, typename TT >
+   void serialize( Archive& archive, const Array<TT>& arr );
+   //@}
+   //**********************************************************************************************
+
+   //**Deserialization functions*******************************************************************
+   /*!\name Deserialization functions */
+   //@{
+   template< typename Archive, typename TT >
+   void deserialize( Archive& archive, Array<TT>& arr );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Serialization functions*********************************************************************
+   /*!\name Serialization functions */
+   //@{
+   template< typename Archive, typename TT >
+   void serializeHeader( Archive& archive, const TT& arr );
+
+   template< typename Archive, typename TT >
+   void serializeArray( Archive& archive, const TT& arr );
+
+   template< typename Archive, typename Type >
+   DisableIf_t< IsNumeric_v<Type> > serializeRow( Archive& archive, const Type* row, size_t n );
+
+   template< typename Archive, typename Type >
+   EnableIf_t< IsNumeric_v<Type> > serializeRow( Archive& archive, const Type* row, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Deserialization functions*******************************************************************
+   /*!\name Deserialization functions */
+   //@{
+   template< typename Archive, typename TT, size_t N >
+   void deserializeHeader( Archive& archive, const TT& arr, std::array<size_t,N>& dims );
+
+   template< typename TT, size_t N >
+   DisableIf_t< IsResizable_v<TT> >
+      prepareArray( DenseArray<TT>& arr, const std::array<size_t,N>& dims );
+
+   template< typename TT, size_t N >
+   EnableIf_t< IsResizable_v<TT> >
+      prepareArray( DenseArray<TT>& arr, const std::array<size_t,N>& dims );
+
+   template< typename Archive, typename TT >
+   void deserializeArray( Archive& archive, DenseArray<TT>& arr );
+
+   template< typename Archive, typename Type >
+   DisableIf_t< IsNumeric_v<Type> > deserializeRow( Archive& archive, Type* row, size_t n );
+
+   template< typename Archive, typename Type >
+   EnableIf_t< IsNumeric_v<Type> > deserializeRow( Archive& archive, Type* row, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename TT >
+   static size_t numRows( const TT& arr ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   uint8_t  version_;      //!< The version of the archive.
+   uint8_t  type_;         //!< The type of the array.
+   uint8_t  elementType_;  //!< The type of an element.
+   uint8_t  elementSize_;  //!< The size in bytes of a single element of the array.
+   uint64_t dimensions_;   //!< The number of dimensions of the array.
+   uint64_t number_;       //!< The total number of elements contained in the array.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor of the ArraySerializer class.
+*/
+ArraySerializer::ArraySerializer()
+   : version_    ( 0U  )  // The version of the archive
+   , type_       ( 0U  )  // The type of the array
+   , elementType_( 0U  )  // The type of an element
+   , elementSize_( 0U  )  // The size in bytes of a single element of the array
+   , dimensions_ ( 0UL )  // The number of dimensions of the array
+   , number_     ( 0UL )  // The total number of elements contained in the array
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SERIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Serializes the given array and writes it to the archive.
+//
+// \param archive The archive to be written.
+// \param arr The array to be serialized.
+// \return void
+// \exception std::runtime_error Error during serialization.
+//
+// This function serializes the given array and writes it to the given archive. In case any
+// error is detected during the serialization, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the array
+void ArraySerializer::serialize( Archive& archive, const Array<TT>& arr )
+{
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Faulty archive detected" );
+   }
+
+   RowAccessType_t<TT> A( ~arr );
+
+   serializeHeader( archive, A );
+   serializeArray ( archive, A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes all meta information about the given array.
+//
+// \param archive The archive to be written.
+// \param arr The array to be serialized.
+// \return void
+// \exception std::runtime_error File header could not be serialized.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the array
+void ArraySerializer::serializeHeader( Archive& archive, const TT& arr )
+{
+   using ET = ElementType_t<TT>;
+
+   constexpr size_t N( TT::num_dimensions );
+
+   archive << uint8_t ( 1U );
+   archive << uint8_t ( 0U );
+   archive << uint8_t ( TypeValueMapping<ET>::value );
+   archive << uint8_t ( sizeof( ET ) );
+   archive << uint64_t( N );
+
+   size_t number( 1UL );
+   for( size_t d=0UL; d<N; ++d ) {
+      archive << uint64_t( arr.dimensions()[d] );
+      number *= arr.dimensions()[d];
+   }
+
+   archive << uint64_t( number );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File header could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a dense array.
+//
+// \param archive The archive to be written.
+// \param arr The array to be serialized.
+// \return void
+// \exception std::runtime_error Dense array could not be serialized.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the array
+void ArraySerializer::serializeArray( Archive& archive, const TT& arr )
+{
+   const size_t n( arr.dimensions()[0] );
+   const size_t m( numRows( arr ) );
+
+   if( n == 0UL ) return;
+
+   for( size_t i=0UL; i<m && archive; ++i ) {
+      serializeRow( archive, arr.data() + i*arr.spacing(), n );
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense array could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes a single row of a dense array element by element.
+//
+// \param archive The archive to be written.
+// \param row Pointer to the first element of the row.
+// \param n The number of elements of the row.
+// \return void
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Type of the elements
+DisableIf_t< IsNumeric_v<Type> >
+   ArraySerializer::serializeRow( Archive& archive, const Type* row, size_t n )
+{
+   size_t j( 0UL );
+   while( ( j < n ) && ( archive << row[j] ) ) {
+      ++j;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes a single row of a dense array by a single bulk write.
+//
+// \param archive The archive to be written.
+// \param row Pointer to the first element of the row.
+// \param n The number of elements of the row.
+// \return void
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Type of the elements
+EnableIf_t< IsNumeric_v<Type> >
+   ArraySerializer::serializeRow( Archive& archive, const Type* row, size_t n )
+{
+   archive.write( row, n );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESERIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Deserializes an array from the given archive.
+//
+// \param archive The archive to be read from.
+// \param arr The array to be deserialized.
+// \return void
+// \exception std::runtime_error Error during deserialization.
+//
+// This function deserializes the contents of the array from the archive and reconstitutes the
+// given array. In case any error is detected during the deserialization process (for instance
+// an invalid dimensionality or element type, an invalid number of elements, or a size mismatch
+// for a non-resizable array), a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the array
+void ArraySerializer::deserialize( Archive& archive, Array<TT>& arr )
+{
+   BLAZE_STATIC_ASSERT_MSG( IsContiguous_v<TT> && HasMutableDataAccess_v<TT>,
+                            "Array without direct access to its rows detected" );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Faulty archive detected" );
+   }
+
+   std::array< size_t, TT::num_dimensions > dims;
+
+   deserializeHeader( archive, ~arr, dims );
+   prepareArray( ~arr, dims );
+   deserializeArray( archive, ~arr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes all meta information about the given array.
+//
+// \param archive The archive to be read from.
+// \param arr The array to be deserialized.
+// \param dims The extents of the serialized array.
+// \return void
+// \exception std::runtime_error Error during deserialization.
+//
+// This function deserializes all meta information about the given array contained in the
+// header of the given archive. In case any error is detected during the deserialization
+// process (for instance an invalid dimensionality or element type, an invalid number of
+// elements, or a size mismatch for a non-resizable array), a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT       // Type of the array
+        , size_t N >        // Number of dimensions
+void ArraySerializer::deserializeHeader( Archive& archive, const TT& arr,
+                                         std::array<size_t,N>& dims )
+{
+   using ET = ElementType_t<TT>;
+
+   if( !( archive >> version_ >> type_ >> elementType_ >> elementSize_ >> dimensions_ ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+   else if( version_ != 1UL ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid version detected" );
+   }
+   else if( type_ != 0U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid array type detected" );
+   }
+   else if( elementType_ != TypeValueMapping<ET>::value ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+   }
+   else if( elementSize_ != sizeof( ET ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element size detected" );
+   }
+   else if( dimensions_ != N ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of dimensions detected" );
+   }
+
+   size_t number( 1UL );
+
+   for( size_t d=0UL; d<N; ++d ) {
+      uint64_t dim( 0UL );
+      if( !( archive >> dim ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+      dims[d]  = dim;
+      number  *= dim;
+   }
+
+   if( !( archive >> number_ ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+   else if( number_ != number ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+   else if( !IsResizable_v<TT> && dims != arr.dimensions() ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid array size detected" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prepares the given non-resizable dense array for the deserialization process.
+//
+// \param arr The dense array to be prepared.
+// \param dims The extents of the serialized array.
+// \return void
+*/
+template< typename TT  // Type of the array
+        , size_t N >   // Number of dimensions
+DisableIf_t< IsResizable_v<TT> >
+   ArraySerializer::prepareArray( DenseArray<TT>& arr, const std::array<size_t,N>& dims )
+{
+   MAYBE_UNUSED( arr, dims );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prepares the given resizable dense array for the deserialization process.
+//
+// \param arr The dense array to be prepared.
+// \param dims The extents of the serialized array.
+// \return void
+*/
+template< typename TT  // Type of the array
+        , size_t N >   // Number of dimensions
+EnableIf_t< IsResizable_v<TT> >
+   ArraySerializer::prepareArray( DenseArray<TT>& arr, const std::array<size_t,N>& dims )
+{
+   (~arr).resize( dims, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a dense array.
+//
+// \param archive The archive to be read from.
+// \param arr The dense array to be reconstituted.
+// \return void
+// \exception std::runtime_error Dense array could not be deserialized.
+//
+// Every row of the array is read directly into the (aligned) memory of the array. The padding
+// elements of the array are not touched.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the array
+void ArraySerializer::deserializeArray( Archive& archive, DenseArray<TT>& arr )
+{
+   const size_t n( (~arr).dimensions()[0] );
+   const size_t m( numRows( ~arr ) );
+
+   if( n == 0UL ) return;
+
+   for( size_t i=0UL; i<m && archive; ++i ) {
+      deserializeRow( archive, (~arr).data() + i*(~arr).spacing(), n );
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense array could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a single row of a dense array element by element.
+//
+// \param archive The archive to be read from.
+// \param row Pointer to the first element of the row.
+// \param n The number of elements of the row.
+// \return void
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Type of the elements
+DisableIf_t< IsNumeric_v<Type> >
+   ArraySerializer::deserializeRow( Archive& archive, Type* row, size_t n )
+{
+   size_t j( 0UL );
+   while( ( j < n ) && ( archive >> row[j] ) ) {
+      ++j;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a single row of a dense array by a single bulk read.
+//
+// \param archive The archive to be read from.
+// \param row Pointer to the first element of the row.
+// \param n The number of elements of the row.
+// \return void
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Type of the elements
+EnableIf_t< IsNumeric_v<Type> >
+   ArraySerializer::deserializeRow( Archive& archive, Type* row, size_t n )
+{
+   archive.read( row, n );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the total number of rows of the given dense array.
+//
+// \param arr The dense array.
+// \return The product of all extents except the number of columns.
+*/
+template< typename TT >  // Type of the array
+size_t ArraySerializer::numRows( const TT& arr ) noexcept
+{
+   size_t m( 1UL );
+   for( size_t d=1UL; d<TT::num_dimensions; ++d ) {
+      m *= arr.dimensions()[d];
+   }
+   return m;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Serializes the given array and writes it to the archive.
+// \ingroup math_serialization
+//
+// \param archive The archive to be written.
+// \param arr The array to be serialized.
+// \return void
+// \exception std::runtime_error Error during serialization.
+//
+// The serialize() function converts the given dense array into a portable, binary
+// representation (see the ArraySerializer class for details on the format). In case an error
+// is encountered during serialization, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the array
+void serialize( Archive& archive, const Array<TT>& arr )
+{
+   ArraySerializer().serialize( archive, ~arr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes an array from the given archive.
+// \ingroup math_serialization
+//
+// \param archive The archive to be read from.
+// \param arr The array to be deserialized.
+// \return void
+// \exception std::runtime_error Array could not be deserialized.
+//
+// The deserialize() function reconstitutes a dense array with direct access to its elements
+// (as for instance DynamicArray or CustomArray) from the given archive. In case an error is
+// encountered during deserialization, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the array
+void deserialize( Archive& archive, Array<TT>& arr )
+{
+   ArraySerializer().deserialize( archive, ~arr );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1257 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/serialization/Npy.h
+//  \brief Reading and writing of NumPy .npy files
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+#ifndef _BLAZE_TENSOR_MATH_SERIALIZATION_NPY_H_
+#define _BLAZE_TENSOR_MATH_SERIALIZATION_NPY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegerSequence.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/typetraits/IsBoolean.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSigned.h>
+
+#include <blaze_tensor/math/dense/CustomArray.h>
+#include <blaze_tensor/math/dense/CustomTensor.h>
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NPY UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The meta information stored in the header of a NumPy \c .npy file.
+// \ingroup math_serialization
+*/
+struct NpyHeader
+{
+   std::string         descr;         //!< The NumPy type descriptor of the elements (e.g. "<f8").
+   bool                fortranOrder;  //!< \a true in case the elements are in column-major order.
+   std::vector<size_t> shape;         //!< The extents of the stored array, outermost first.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Type for the row access of an array that is written to a \c .npy file.
+// \ingroup math_serialization
+//
+// Vectors, matrices, tensors and arrays with direct access to their contiguous rows are written
+// in-place, all other data structures (i.e. expressions) are evaluated first.
+*/
+template< typename T >
+using NpyAccessType_t =
+   If_t< IsContiguous_v<T> && HasConstDataAccess_v<T>, const T&, const ResultType_t<T> >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the executing platform stores multi-byte values in little-endian order.
+// \ingroup math_serialization
+//
+// \return \a true in case of a little-endian platform, \a false otherwise.
+*/
+inline bool isNpyLittleEndian() noexcept
+{
+   const uint16_t value( 1U );
+   unsigned char byte( 0U );
+   std::memcpy( &byte, &value, 1UL );
+   return byte == 1U;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the NumPy type descriptor of the given element type.
+// \ingroup math_serialization
+//
+// \return The type descriptor in native byte order (e.g. "<f8" for \c double on x86).
+*/
+template< typename Type >  // Type of the elements
+std::string npyDescr()
+{
+   BLAZE_STATIC_ASSERT_MSG( IsNumeric_v<Type> || IsBoolean_v<Type>,
+                            "Unsupported element type for npy files detected" );
+
+   const char kind( IsBoolean_v<Type>       ? 'b'
+                  : IsComplex_v<Type>       ? 'c'
+                  : IsFloatingPoint_v<Type> ? 'f'
+                  : IsSigned_v<Type>        ? 'i'
+                  : 'u' );
+   const char order( sizeof( Type ) == 1UL ? '|' : ( isNpyLittleEndian() ? '<' : '>' ) );
+
+   return std::string{ order, kind } + std::to_string( sizeof( Type ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks whether the given NumPy type descriptor matches the given element type.
+// \ingroup math_serialization
+//
+// \param descr The NumPy type descriptor read from a \c .npy file.
+// \return void
+// \exception std::runtime_error Invalid element type detected.
+// \exception std::runtime_error Non-native byte order detected.
+*/
+template< typename Type >  // Type of the elements
+void checkNpyDescr( const std::string& descr )
+{
+   const std::string expected( npyDescr<Type>() );
+
+   if( descr.size() < 3UL || descr.compare( 1UL, std::string::npos, expected, 1UL ) != 0 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+   }
+
+   if( sizeof( Type ) > 1UL && descr[0] != '=' && descr[0] != expected[0] ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Non-native byte order detected" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the position of the value of the given key within a \c .npy header dictionary.
+// \ingroup math_serialization
+//
+// \param header The header dictionary.
+// \param key The key of the requested value.
+// \return The position of the first character of the value.
+// \exception std::runtime_error Invalid npy header detected.
+*/
+inline size_t findNpyValue( const std::string& header, const std::string& key )
+{
+   const std::string quoted( "'" + key + "'" );
+
+   size_t pos( header.find( quoted ) );
+   if( pos != std::string::npos )
+      pos = header.find_first_not_of( ' ', pos + quoted.size() );
+   if( pos != std::string::npos && header[pos] == ':' )
+      pos = header.find_first_not_of( ' ', pos + 1UL );
+   else
+      pos = std::string::npos;
+
+   if( pos == std::string::npos ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid npy header detected" );
+   }
+
+   return pos;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads the header of a NumPy \c .npy file from the given input stream.
+// \ingroup math_serialization
+//
+// \param is The input stream positioned at the beginning of the \c .npy data.
+// \return The meta information contained in the header.
+// \exception std::runtime_error Invalid npy header detected.
+//
+// This function supports the versions 1.0, 2.0 and 3.0 of the \c .npy format. On return, the
+// input stream is positioned at the first element of the stored array.
+*/
+inline NpyHeader readNpyHeader( std::istream& is )
+{
+   unsigned char prefix[12];
+
+   if( !is.read( reinterpret_cast<char*>( prefix ), 10L ) ||
+       std::memcmp( prefix, "\x93NUMPY", 6UL ) != 0 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid npy header detected" );
+   }
+
+   size_t length( prefix[8] | ( size_t( prefix[9] ) << 8 ) );
+
+   if( prefix[6] == 2U || prefix[6] == 3U ) {
+      if( !is.read( reinterpret_cast<char*>( prefix+10 ), 2L ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid npy header detected" );
+      }
+      length |= ( size_t( prefix[10] ) << 16 ) | ( size_t( prefix[11] ) << 24 );
+   }
+   else if( prefix[6] != 1U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unsupported npy version detected" );
+   }
+
+   std::string header( length, ' ' );
+
+   if( length == 0UL || !is.read( &header[0], static_cast<std::streamsize>( length ) ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid npy header detected" );
+   }
+
+   NpyHeader result;
+
+   // Extracting the type descriptor (structured types are not supported)
+   {
+      const size_t pos( findNpyValue( header, "descr" ) );
+      const size_t end( header.find( '\'', pos+1UL ) );
+
+      if( header[pos] != '\'' || end == std::string::npos ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Unsupported npy element type detected" );
+      }
+
+      result.descr = header.substr( pos+1UL, end-pos-1UL );
+   }
+
+   // Extracting the storage order
+   {
+      const size_t pos( findNpyValue( header, "fortran_order" ) );
+
+      if( header.compare( pos, 4UL, "True" ) == 0 )
+         result.fortranOrder = true;
+      else if( header.compare( pos, 5UL, "False" ) == 0 )
+         result.fortranOrder = false;
+      else {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid npy header detected" );
+      }
+   }
+
+   // Extracting the shape
+   {
+      const size_t pos( findNpyValue( header, "shape" ) );
+      const size_t end( header.find( ')', pos ) );
+
+      if( header[pos] != '(' || end == std::string::npos ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid npy header detected" );
+      }
+
+      for( size_t i=pos+1UL; i<end; ) {
+         if( header[i] >= '0' && header[i] <= '9' ) {
+            char* next( nullptr );
+            result.shape.push_back( std::strtoull( header.c_str()+i, &next, 10 ) );
+            i = static_cast<size_t>( next - header.c_str() );
+         }
+         else if( header[i] == ' ' || header[i] == ',' || header[i] == 'L' ) {
+            ++i;
+         }
+         else {
+            BLAZE_THROW_RUNTIME_ERROR( "Invalid npy header detected" );
+         }
+      }
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the header of a NumPy \c .npy file to the given output stream.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param descr The NumPy type descriptor of the elements.
+// \param fortranOrder \a true in case the elements are written in column-major order.
+// \param shape The extents of the array, outermost first.
+// \return void
+// \exception std::runtime_error Faulty npy stream detected.
+//
+// The header is written in version 1.0 of the \c .npy format unless the header dictionary
+// exceeds the 64 KiB limit of this version. The dictionary is padded with spaces such that the
+// elements start at a multiple of 64 bytes.
+*/
+inline void writeNpyHeader( std::ostream& os, const std::string& descr, bool fortranOrder,
+                            const std::vector<size_t>& shape )
+{
+   std::string header( "{'descr': '" + descr + "', 'fortran_order': " +
+                       ( fortranOrder ? "True" : "False" ) + ", 'shape': (" );
+
+   for( size_t d=0UL; d<shape.size(); ++d ) {
+      if( d > 0UL ) header += ", ";
+      header += std::to_string( shape[d] );
+   }
+
+   header += ( shape.size() == 1UL ? ",), }" : "), }" );
+
+   size_t prefix( 10UL );
+   size_t length( ( ( prefix + header.size() + 64UL ) & ~size_t( 63UL ) ) - prefix );
+
+   if( length > 65535UL ) {
+      prefix = 12UL;
+      length = ( ( prefix + header.size() + 64UL ) & ~size_t( 63UL ) ) - prefix;
+   }
+
+   header.append( length - header.size() - 1UL, ' ' );
+   header += '\n';
+
+   const char magic[] = { '\x93', 'N', 'U', 'M', 'P', 'Y', char( prefix == 10UL ? 1 : 2 ), 0,
+                          char( length & 0xFF ), char( ( length >> 8 ) & 0xFF ),
+                          char( ( length >> 16 ) & 0xFF ), char( ( length >> 24 ) & 0xFF ) };
+
+   if( !os.write( magic, static_cast<std::streamsize>( prefix ) ) ||
+       !os.write( header.data(), static_cast<std::streamsize>( header.size() ) ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Faulty npy stream detected" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads the elements of a \c .npy file into padded row storage.
+// \ingroup math_serialization
+//
+// \param is The input stream positioned at the first element.
+// \param shape The extents of the array in the order of the storage, outermost first.
+// \param fortranOrder \a true in case the file stores the elements in reversed index order.
+// \param data Pointer to the first row of the storage.
+// \param spacing The number of elements between the beginning of two rows of the storage.
+// \return void
+// \exception std::runtime_error Faulty npy data detected.
+//
+// In case the storage order of the file matches the storage order of the target, every row is
+// read with a single bulk operation directly into the memory of the target and the padding
+// elements are not touched. Otherwise all elements are read into a temporary buffer first and
+// scattered into the rows of the target.
+*/
+template< typename Type >  // Type of the elements
+void readNpyRows( std::istream& is, const std::vector<size_t>& shape, bool fortranOrder,
+                  Type* data, size_t spacing )
+{
+   const size_t rank( shape.size() );
+   const size_t n( shape[rank-1UL] );
+
+   size_t m( 1UL );
+   for( size_t d=0UL; d+1UL<rank; ++d ) {
+      m *= shape[d];
+   }
+
+   if( m == 0UL || n == 0UL )
+      return;
+
+   if( !fortranOrder || rank == 1UL )
+   {
+      for( size_t i=0UL; i<m; ++i ) {
+         if( !is.read( reinterpret_cast<char*>( data + i*spacing ),
+                       static_cast<std::streamsize>( n*sizeof( Type ) ) ) ) {
+            BLAZE_THROW_RUNTIME_ERROR( "Faulty npy data detected" );
+         }
+      }
+      return;
+   }
+
+   std::vector<Type> buffer( m*n );
+
+   if( !is.read( reinterpret_cast<char*>( buffer.data() ),
+                 static_cast<std::streamsize>( m*n*sizeof( Type ) ) ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Faulty npy data detected" );
+   }
+
+   // In reversed index order the first index of the storage runs fastest within the file
+   std::vector<size_t> strides( rank, 1UL ), index( rank, 0UL );
+   for( size_t d=1UL; d<rank; ++d ) {
+      strides[d] = strides[d-1UL] * shape[d-1UL];
+   }
+
+   size_t base( 0UL );
+
+   for( size_t i=0UL; i<m; ++i )
+   {
+      Type* row( data + i*spacing );
+      for( size_t j=0UL; j<n; ++j ) {
+         row[j] = buffer[base + j*strides[rank-1UL]];
+      }
+
+      for( size_t d=rank-1UL; d-- > 0UL; ) {
+         base += strides[d];
+         if( ++index[d] < shape[d] )
+            break;
+         base -= index[d] * strides[d];
+         index[d] = 0UL;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the elements of padded row storage to a \c .npy file.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param data Pointer to the first row of the storage.
+// \param m The number of rows.
+// \param n The number of elements per row.
+// \param spacing The number of elements between the beginning of two rows.
+// \return void
+// \exception std::runtime_error Faulty npy stream detected.
+*/
+template< typename Type >  // Type of the elements
+void writeNpyRows( std::ostream& os, const Type* data, size_t m, size_t n, size_t spacing )
+{
+   for( size_t i=0UL; i<m && n>0UL; ++i ) {
+      if( !os.write( reinterpret_cast<const char*>( data + i*spacing ),
+                     static_cast<std::streamsize>( n*sizeof( Type ) ) ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Faulty npy stream detected" );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads the header of a \c .npy file and checks its element type and rank.
+// \ingroup math_serialization
+//
+// \param is The input stream positioned at the beginning of the \c .npy data.
+// \param rank The expected number of dimensions.
+// \return The meta information contained in the header.
+// \exception std::runtime_error Invalid npy header detected.
+*/
+template< typename Type >  // Type of the elements
+NpyHeader readNpyHeader( std::istream& is, size_t rank )
+{
+   NpyHeader header( readNpyHeader( is ) );
+
+   checkNpyDescr<Type>( header.descr );
+
+   if( header.shape.size() != rank ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of dimensions detected" );
+   }
+
+   return header;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resizes the given resizable vector to the size stored in a \c .npy file.
+// \ingroup math_serialization
+*/
+template< typename VT, bool TF >
+EnableIf_t< IsResizable_v<VT> > prepareNpy( DenseVector<VT,TF>& vec, size_t n )
+{
+   (~vec).resize( n, false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the size of the given non-resizable vector against a \c .npy file.
+// \ingroup math_serialization
+*/
+template< typename VT, bool TF >
+DisableIf_t< IsResizable_v<VT> > prepareNpy( DenseVector<VT,TF>& vec, size_t n )
+{
+   if( (~vec).size() != n ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid vector size detected" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resizes the given resizable matrix to the size stored in a \c .npy file.
+// \ingroup math_serialization
+*/
+template< typename MT, bool SO >
+EnableIf_t< IsResizable_v<MT> > prepareNpy( DenseMatrix<MT,SO>& mat, size_t m, size_t n )
+{
+   (~mat).resize( m, n, false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the size of the given non-resizable matrix against a \c .npy file.
+// \ingroup math_serialization
+*/
+template< typename MT, bool SO >
+DisableIf_t< IsResizable_v<MT> > prepareNpy( DenseMatrix<MT,SO>& mat, size_t m, size_t n )
+{
+   if( (~mat).rows() != m || (~mat).columns() != n ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix size detected" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resizes the given resizable tensor to the size stored in a \c .npy file.
+// \ingroup math_serialization
+*/
+template< typename TT >
+EnableIf_t< IsResizable_v<TT> > prepareNpy( DenseTensor<TT>& tens, size_t o, size_t m, size_t n )
+{
+   (~tens).resize( o, m, n, false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the size of the given non-resizable tensor against a \c .npy file.
+// \ingroup math_serialization
+*/
+template< typename TT >
+DisableIf_t< IsResizable_v<TT> > prepareNpy( DenseTensor<TT>& tens, size_t o, size_t m, size_t n )
+{
+   if( (~tens).pages() != o || (~tens).rows() != m || (~tens).columns() != n ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid tensor size detected" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resizes the given resizable array to the dimensions stored in a \c .npy file.
+// \ingroup math_serialization
+*/
+template< typename TT, size_t N >
+EnableIf_t< IsResizable_v<TT> >
+   prepareNpy( DenseArray<TT>& arr, const std::array<size_t,N>& dims )
+{
+   (~arr).resize( dims, false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the dimensions of the given non-resizable array against a \c .npy file.
+// \ingroup math_serialization
+*/
+template< typename TT, size_t N >
+DisableIf_t< IsResizable_v<TT> >
+   prepareNpy( DenseArray<TT>& arr, const std::array<size_t,N>& dims )
+{
+   if( (~arr).dimensions() != dims ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid array size detected" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NPY LOAD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reads a dense vector from a NumPy \c .npy stream.
+// \ingroup math_serialization
+//
+// \param is The input stream positioned at the beginning of the \c .npy data.
+// \param vec The target vector.
+// \return void
+// \exception std::runtime_error Vector could not be read.
+//
+// The \c .npy data has to contain a one-dimensional array of the element type of the vector in
+// native byte order. Resizable vectors are resized accordingly, all other vectors must already
+// have the stored size. The elements are read in a single bulk operation directly into the
+// memory of the vector.
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+void loadNpy( std::istream& is, DenseVector<VT,TF>& vec )
+{
+   BLAZE_STATIC_ASSERT_MSG( IsContiguous_v<VT> && HasMutableDataAccess_v<VT>,
+                            "Vector without contiguous data access detected" );
+
+   using ET = ElementType_t<VT>;
+
+   const NpyHeader header( readNpyHeader<ET>( is, 1UL ) );
+
+   prepareNpy( ~vec, header.shape[0] );
+   readNpyRows( is, header.shape, false, (~vec).data(), header.shape[0] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a dense matrix from a NumPy \c .npy stream.
+// \ingroup math_serialization
+//
+// \param is The input stream positioned at the beginning of the \c .npy data.
+// \param mat The target matrix.
+// \return void
+// \exception std::runtime_error Matrix could not be read.
+//
+// The \c .npy data has to contain a two-dimensional array of the element type of the matrix in
+// native byte order. Both C and Fortran order are supported. In case the order of the file
+// matches the storage order of the matrix (C order for row-major and Fortran order for
+// column-major matrices), every row/column is read in a single bulk operation directly into the
+// padded memory of the matrix. Resizable matrices are resized accordingly, all other matrices
+// must already have the stored size.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void loadNpy( std::istream& is, DenseMatrix<MT,SO>& mat )
+{
+   BLAZE_STATIC_ASSERT_MSG( IsContiguous_v<MT> && HasMutableDataAccess_v<MT>,
+                            "Matrix without contiguous data access detected" );
+
+   using ET = ElementType_t<MT>;
+
+   NpyHeader header( readNpyHeader<ET>( is, 2UL ) );
+
+   prepareNpy( ~mat, header.shape[0], header.shape[1] );
+
+   if( SO == columnMajor ) {
+      std::swap( header.shape[0], header.shape[1] );
+      header.fortranOrder = !header.fortranOrder;
+   }
+
+   readNpyRows( is, header.shape, header.fortranOrder, (~mat).data(), (~mat).spacing() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a dense tensor from a NumPy \c .npy stream.
+// \ingroup math_serialization
+//
+// \param is The input stream positioned at the beginning of the \c .npy data.
+// \param tens The target tensor.
+// \return void
+// \exception std::runtime_error Tensor could not be read.
+//
+// The \c .npy data has to contain a three-dimensional array of shape (pages, rows, columns) of
+// the element type of the tensor in native byte order. In case of C order, every row is read in
+// a single bulk operation directly into the padded memory of the tensor, in case of Fortran
+// order the elements are reordered via a temporary buffer. Resizable tensors are resized
+// accordingly, all other tensors must already have the stored size.
+*/
+template< typename TT >  // Type of the tensor
+void loadNpy( std::istream& is, DenseTensor<TT>& tens )
+{
+   BLAZE_STATIC_ASSERT_MSG( IsContiguous_v<TT> && HasMutableDataAccess_v<TT>,
+                            "Tensor without contiguous data access detected" );
+
+   using ET = ElementType_t<TT>;
+
+   const NpyHeader header( readNpyHeader<ET>( is, 3UL ) );
+
+   prepareNpy( ~tens, header.shape[0], header.shape[1], header.shape[2] );
+   readNpyRows( is, header.shape, header.fortranOrder, (~tens).data(), (~tens).spacing() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a dense N-dimensional array from a NumPy \c .npy stream.
+// \ingroup math_serialization
+//
+// \param is The input stream positioned at the beginning of the \c .npy data.
+// \param arr The target array.
+// \return void
+// \exception std::runtime_error Array could not be read.
+//
+// The \c .npy data has to contain an N-dimensional array of the element type of the array in
+// native byte order. The NumPy shape lists the extents outermost first, i.e. in the reversed
+// order of the \c dimensions() member function (the last NumPy extent is the number of columns).
+// In case of C order, every row is read in a single bulk operation directly into the padded
+// memory of the array, in case of Fortran order the elements are reordered via a temporary
+// buffer. Resizable arrays are resized accordingly, all other arrays must already have the
+// stored dimensions.
+*/
+template< typename TT >  // Type of the array
+void loadNpy( std::istream& is, DenseArray<TT>& arr )
+{
+   BLAZE_STATIC_ASSERT_MSG( IsContiguous_v<TT> && HasMutableDataAccess_v<TT>,
+                            "Array without contiguous data access detected" );
+
+   using ET = ElementType_t<TT>;
+
+   constexpr size_t N( TT::num_dimensions );
+
+   const NpyHeader header( readNpyHeader<ET>( is, N ) );
+
+   std::array<size_t,N> dims;
+   for( size_t d=0UL; d<N; ++d ) {
+      dims[d] = header.shape[N-1UL-d];
+   }
+
+   prepareNpy( ~arr, dims );
+   readNpyRows( is, header.shape, header.fortranOrder, (~arr).data(), (~arr).spacing() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a dense vector, matrix, tensor or array from the given NumPy \c .npy file.
+// \ingroup math_serialization
+//
+// \param filename The name of the \c .npy file.
+// \param x The target data structure.
+// \return void
+// \exception std::runtime_error Data could not be read.
+
+   \code
+   blaze::DynamicTensor<float> T;
+   blaze::loadNpy( "activations.npy", T );  // np.save( "activations.npy", a ), a.shape == (o,m,n)
+   \endcode
+*/
+template< typename T >  // Type of the target data structure
+void loadNpy( const std::string& filename, T& x )
+{
+   std::ifstream is( filename, std::ios::in | std::ios::binary );
+
+   if( !is ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Npy file could not be opened" );
+   }
+
+   loadNpy( is, x );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NPY SAVE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writes a dense vector as one-dimensional NumPy array to the given output stream.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param vec The vector to be written.
+// \return void
+// \exception std::runtime_error Faulty npy stream detected.
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+void saveNpy( std::ostream& os, const DenseVector<VT,TF>& vec )
+{
+   using ET = ElementType_t<VT>;
+
+   NpyAccessType_t<VT> v( ~vec );
+
+   writeNpyHeader( os, npyDescr<ET>(), false, { v.size() } );
+   writeNpyRows( os, v.data(), 1UL, v.size(), v.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes a dense matrix as two-dimensional NumPy array to the given output stream.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param mat The matrix to be written.
+// \return void
+// \exception std::runtime_error Faulty npy stream detected.
+//
+// Row-major matrices are written in C order, column-major matrices in Fortran order. In both
+// cases every row/column is written in a single bulk operation directly from the memory of the
+// matrix.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void saveNpy( std::ostream& os, const DenseMatrix<MT,SO>& mat )
+{
+   using ET = ElementType_t<MT>;
+
+   NpyAccessType_t<MT> A( ~mat );
+
+   const size_t m( SO == rowMajor ? A.rows() : A.columns() );
+   const size_t n( SO == rowMajor ? A.columns() : A.rows() );
+
+   writeNpyHeader( os, npyDescr<ET>(), SO == columnMajor, { A.rows(), A.columns() } );
+   writeNpyRows( os, A.data(), m, n, A.spacing() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes a dense tensor as three-dimensional NumPy array to the given output stream.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param tens The tensor to be written.
+// \return void
+// \exception std::runtime_error Faulty npy stream detected.
+//
+// The tensor is written in C order with shape (pages, rows, columns). Every row is written in a
+// single bulk operation directly from the memory of the tensor.
+*/
+template< typename TT >  // Type of the tensor
+void saveNpy( std::ostream& os, const DenseTensor<TT>& tens )
+{
+   using ET = ElementType_t<TT>;
+
+   NpyAccessType_t<TT> A( ~tens );
+
+   writeNpyHeader( os, npyDescr<ET>(), false, { A.pages(), A.rows(), A.columns() } );
+   writeNpyRows( os, A.data(), A.pages()*A.rows(), A.columns(), A.spacing() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes a dense N-dimensional array as NumPy array to the given output stream.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param arr The array to be written.
+// \return void
+// \exception std::runtime_error Faulty npy stream detected.
+//
+// The array is written in C order. The NumPy shape lists the extents outermost first, i.e. in
+// the reversed order of the \c dimensions() member function. Every row is written in a single
+// bulk operation directly from the memory of the array.
+*/
+template< typename TT >  // Type of the array
+void saveNpy( std::ostream& os, const DenseArray<TT>& arr )
+{
+   using ET = ElementType_t<TT>;
+
+   constexpr size_t N( TT::num_dimensions );
+
+   NpyAccessType_t<TT> A( ~arr );
+
+   std::vector<size_t> shape( N );
+   size_t m( 1UL );
+   for( size_t d=0UL; d<N; ++d ) {
+      shape[d] = A.dimensions()[N-1UL-d];
+      if( d > 0UL ) m *= A.dimensions()[d];
+   }
+
+   writeNpyHeader( os, npyDescr<ET>(), false, shape );
+   writeNpyRows( os, A.data(), m, A.dimensions()[0], A.spacing() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes a dense vector, matrix, tensor or array to the given NumPy \c .npy file.
+// \ingroup math_serialization
+//
+// \param filename The name of the \c .npy file.
+// \param x The data structure to be written.
+// \return void
+// \exception std::runtime_error Data could not be written.
+*/
+template< typename T >  // Type of the data structure
+void saveNpy( const std::string& filename, const T& x )
+{
+   std::ofstream os( filename, std::ios::out | std::ios::binary | std::ios::trunc );
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Npy file could not be opened" );
+   }
+
+   saveNpy( os, x );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS NPYARRAY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Owning buffer for the unpadded elements of a NumPy \c .npy file.
+// \ingroup math_serialization
+//
+// The NpyArray class reads a complete \c .npy file into a single buffer without any padding and
+// provides direct, zero-copy views on the elements in the form of unaligned, unpadded custom
+// tensors and arrays:
+
+   \code
+   blaze::NpyArray file( "weights.npy" );  // file.shape() == { 4, 32, 64 }
+
+   blaze::CustomTensor<float,blaze::unaligned,blaze::unpadded> W( file.tensor<float>() );
+   blaze::CustomArray<3,float,blaze::unaligned,blaze::unpadded> A( file.array<3,float>() );
+   \endcode
+
+// The views refer to the memory of the NpyArray and are invalidated by its destruction. Views
+// are only available for files in C order and for the element type stored in the file;
+// otherwise a \a std::runtime_error exception is thrown.
+*/
+class NpyArray
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline NpyArray();
+   explicit inline NpyArray( std::istream& is );
+   explicit inline NpyArray( const std::string& filename );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline const std::string&         descr       () const noexcept;
+   inline bool                       fortranOrder() const noexcept;
+   inline const std::vector<size_t>& shape       () const noexcept;
+   inline size_t                     size        () const noexcept;
+
+   template< typename Type > inline Type* data();
+
+   template< typename Type >
+   inline CustomTensor<Type,unaligned,unpadded> tensor();
+
+   template< size_t N, typename Type >
+   inline CustomArray<N,Type,unaligned,unpadded> array();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void read( std::istream& is );
+
+   template< typename Type >
+   inline void checkView( size_t rank ) const;
+
+   template< size_t N, typename Type, size_t... Is >
+   inline CustomArray<N,Type,unaligned,unpadded> array( index_sequence<Is...> );
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Block = std::max_align_t;  //!< Type of the blocks of the element buffer.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   NpyHeader                  header_;  //!< The meta information of the file.
+   size_t                     size_;    //!< The total number of elements.
+   std::unique_ptr< Block[] > buffer_;  //!< The unpadded elements of the file.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The default constructor of the NpyArray class.
+*/
+inline NpyArray::NpyArray()
+   : header_()           // The meta information of the file
+   , size_  ( 0UL )      // The total number of elements
+   , buffer_( nullptr )  // The unpadded elements of the file
+{
+   header_.fortranOrder = false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads the \c .npy data from the given input stream.
+//
+// \param is The input stream positioned at the beginning of the \c .npy data.
+// \exception std::runtime_error Npy data could not be read.
+*/
+inline NpyArray::NpyArray( std::istream& is )
+   : NpyArray()
+{
+   read( is );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads the given \c .npy file.
+//
+// \param filename The name of the \c .npy file.
+// \exception std::runtime_error Npy file could not be read.
+*/
+inline NpyArray::NpyArray( const std::string& filename )
+   : NpyArray()
+{
+   std::ifstream is( filename, std::ios::in | std::ios::binary );
+
+   if( !is ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Npy file could not be opened" );
+   }
+
+   read( is );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the NumPy type descriptor of the elements (e.g. "<f8").
+//
+// \return The type descriptor.
+*/
+inline const std::string& NpyArray::descr() const noexcept
+{
+   return header_.descr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the elements are stored in Fortran (i.e. column-major) order.
+//
+// \return \a true in case of Fortran order, \a false in case of C order.
+*/
+inline bool NpyArray::fortranOrder() const noexcept
+{
+   return header_.fortranOrder;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the extents of the stored array, outermost first.
+//
+// \return The NumPy shape of the stored array.
+*/
+inline const std::vector<size_t>& NpyArray::shape() const noexcept
+{
+   return header_.shape;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of stored elements.
+//
+// \return The total number of elements.
+*/
+inline size_t NpyArray::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the stored elements.
+//
+// \return Pointer to the first element.
+// \exception std::runtime_error Invalid element type detected.
+*/
+template< typename Type >  // Type of the elements
+inline Type* NpyArray::data()
+{
+   checkNpyDescr<Type>( header_.descr );
+   return reinterpret_cast<Type*>( buffer_.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an unpadded custom tensor referring to the stored elements.
+//
+// \return The custom tensor of shape (pages, rows, columns).
+// \exception std::runtime_error Tensor could not be created.
+*/
+template< typename Type >  // Type of the elements
+inline CustomTensor<Type,unaligned,unpadded> NpyArray::tensor()
+{
+   checkView<Type>( 3UL );
+
+   return CustomTensor<Type,unaligned,unpadded>( reinterpret_cast<Type*>( buffer_.get() ),
+                                                 header_.shape[0], header_.shape[1],
+                                                 header_.shape[2] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an unpadded custom array referring to the stored elements.
+//
+// \return The N-dimensional custom array.
+// \exception std::runtime_error Array could not be created.
+*/
+template< size_t N         // Dimensionality of the array
+        , typename Type >  // Type of the elements
+inline CustomArray<N,Type,unaligned,unpadded> NpyArray::array()
+{
+   checkView<Type>( N );
+
+   return array<N,Type>( make_index_sequence<N>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the custom array from the NumPy shape (outermost extent first).
+//
+// \return The N-dimensional custom array.
+*/
+template< size_t N          // Dimensionality of the array
+        , typename Type     // Type of the elements
+        , size_t... Is >    // Indices of the extents
+inline CustomArray<N,Type,unaligned,unpadded> NpyArray::array( index_sequence<Is...> )
+{
+   return CustomArray<N,Type,unaligned,unpadded>(
+      reinterpret_cast<Type*>( buffer_.get() ), header_.shape[Is]... );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads the header and all elements of the \c .npy data into the buffer.
+//
+// \param is The input stream positioned at the beginning of the \c .npy data.
+// \return void
+// \exception std::runtime_error Npy data could not be read.
+*/
+inline void NpyArray::read( std::istream& is )
+{
+   header_ = readNpyHeader( is );
+
+   const size_t elementSize( std::strtoul( header_.descr.c_str()+2, nullptr, 10 ) );
+
+   if( header_.descr.size() < 3UL || elementSize == 0UL ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Unsupported npy element type detected" );
+   }
+
+   size_ = 1UL;
+   for( size_t extent : header_.shape ) {
+      size_ *= extent;
+   }
+
+   const size_t bytes( size_*elementSize );
+
+   buffer_.reset( new Block[ bytes / sizeof( Block ) + 1UL ] );
+
+   if( !is.read( reinterpret_cast<char*>( buffer_.get() ),
+                 static_cast<std::streamsize>( bytes ) ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Faulty npy data detected" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether the stored elements can be viewed as custom tensor or array.
+//
+// \param rank The number of dimensions of the requested view.
+// \return void
+// \exception std::runtime_error Invalid element type, rank or storage order detected.
+*/
+template< typename Type >  // Type of the elements
+inline void NpyArray::checkView( size_t rank ) const
+{
+   checkNpyDescr<Type>( header_.descr );
+
+   if( header_.shape.size() != rank ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of dimensions detected" );
+   }
+
+   if( header_.fortranOrder ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Npy data in Fortran order cannot be viewed in-place" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,797 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/serialization/Npz.h
+//  \brief Reading and writing of uncompressed NumPy .npz archives
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+#ifndef _BLAZE_TENSOR_MATH_SERIALIZATION_NPZ_H_
+#define _BLAZE_TENSOR_MATH_SERIALIZATION_NPZ_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/util/Types.h>
+
+#include <blaze_tensor/math/serialization/Npy.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NPZ UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Decodes an unsigned little-endian value of the given number of bytes.
+// \ingroup math_serialization
+//
+// \param bytes Pointer to the first byte of the value.
+// \param n The number of bytes of the value.
+// \return The decoded value.
+*/
+inline uint64_t npzValue( const unsigned char* bytes, size_t n ) noexcept
+{
+   uint64_t value( 0UL );
+   for( size_t i=n; i-- > 0UL; ) {
+      value = ( value << 8 ) | bytes[i];
+   }
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes an unsigned value as little-endian value of the given number of bytes.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param value The value to be written.
+// \param n The number of bytes of the value.
+// \return void
+*/
+inline void writeNpzValue( std::ostream& os, uint64_t value, size_t n )
+{
+   for( size_t i=0UL; i<n; ++i ) {
+      os.put( static_cast<char>( ( value >> ( 8UL*i ) ) & 0xFFU ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the CRC-32 checksum of a zip archive entry.
+// \ingroup math_serialization
+//
+// \param data Pointer to the first byte of the entry.
+// \param n The number of bytes of the entry.
+// \return The CRC-32 checksum.
+*/
+inline uint32_t npzCrc32( const char* data, size_t n ) noexcept
+{
+   static const std::array<uint32_t,256UL> table( []() {
+      std::array<uint32_t,256UL> t;
+      for( uint32_t i=0U; i<256U; ++i ) {
+         uint32_t c( i );
+         for( size_t k=0UL; k<8UL; ++k ) {
+            c = ( c & 1U ) ? ( 0xEDB88320U ^ ( c >> 1 ) ) : ( c >> 1 );
+         }
+         t[i] = c;
+      }
+      return t;
+   }() );
+
+   uint32_t crc( 0xFFFFFFFFU );
+   for( size_t i=0UL; i<n; ++i ) {
+      crc = table[( crc ^ static_cast<unsigned char>( data[i] ) ) & 0xFFU] ^ ( crc >> 8 );
+   }
+   return crc ^ 0xFFFFFFFFU;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS NPZREADER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reader for uncompressed NumPy \c .npz archives.
+// \ingroup math_serialization
+//
+// The NpzReader class provides access to the arrays stored in a \c .npz archive as written by
+// \c numpy.savez(). Every entry is read via the \c .npy functionality, i.e. directly into the
+// padded memory of any dense vector, matrix, tensor or array, or as NpyArray for zero-copy views:
+
+   \code
+   blaze::NpzReader archive( "model.npz" );  // numpy.savez( "model.npz", W=w, b=b )
+
+   blaze::DynamicTensor<float> W;
+   blaze::DynamicVector<float> b;
+
+   archive.load( "W", W );
+   archive.load( "b", b );
+   \endcode
+
+// The entries are addressed by the names given to \c numpy.savez(), the \c .npy extension of the
+// archive members is optional. Only entries stored without compression are supported, entries
+// of \c numpy.savez_compressed() archives result in a \a std::runtime_error exception. Archives
+// with zip64 extensions (e.g. entries larger than 4 GiB) are supported.
+*/
+class NpzReader
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline NpzReader( std::istream& is );
+   explicit inline NpzReader( const std::string& filename );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline std::vector<std::string> names() const;
+   inline bool contains( const std::string& name ) const;
+
+   template< typename T >
+   inline void load( const std::string& name, T& x );
+
+   inline NpyArray array( const std::string& name );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   //! Meta information of a single archive entry.
+   struct Entry
+   {
+      std::string name;    //!< The name of the entry within the archive.
+      uint64_t    offset;  //!< The offset of the local header of the entry.
+      bool        stored;  //!< \a true in case the entry is stored without compression.
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void read( std::vector<unsigned char>& buffer, uint64_t offset, size_t n );
+   inline void readDirectory();
+   inline const Entry* find( const std::string& name ) const;
+   inline void seek( const std::string& name );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::unique_ptr<std::ifstream> file_;     //!< The archive file in case of a named archive.
+   std::istream&                  is_;       //!< The input stream of the archive.
+   std::vector<Entry>             entries_;  //!< The entries of the archive.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Opens the \c .npz archive contained in the given input stream.
+//
+// \param is The seekable input stream of the archive.
+// \exception std::runtime_error Invalid npz archive detected.
+//
+// The archive has to start at the beginning of the given input stream.
+*/
+inline NpzReader::NpzReader( std::istream& is )
+   : file_   ()      // The archive file in case of a named archive
+   , is_     ( is )  // The input stream of the archive
+   , entries_()      // The entries of the archive
+{
+   readDirectory();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Opens the given \c .npz archive.
+//
+// \param filename The name of the \c .npz file.
+// \exception std::runtime_error Invalid npz archive detected.
+*/
+inline NpzReader::NpzReader( const std::string& filename )
+   : file_   ( new std::ifstream( filename, std::ios::in | std::ios::binary ) )
+   , is_     ( *file_ )  // The input stream of the archive
+   , entries_()          // The entries of the archive
+{
+   if( !is_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Npz file could not be opened" );
+   }
+
+   readDirectory();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the names of all entries of the archive (without \c .npy extension).
+//
+// \return The names of all entries in the order of the archive.
+*/
+inline std::vector<std::string> NpzReader::names() const
+{
+   std::vector<std::string> result;
+   result.reserve( entries_.size() );
+
+   for( const Entry& entry : entries_ ) {
+      const size_t n( entry.name.size() );
+      if( n > 4UL && entry.name.compare( n-4UL, 4UL, ".npy" ) == 0 )
+         result.push_back( entry.name.substr( 0UL, n-4UL ) );
+      else
+         result.push_back( entry.name );
+   }
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the archive contains an entry with the given name.
+//
+// \param name The name of the entry (with or without \c .npy extension).
+// \return \a true in case the entry exists, \a false otherwise.
+*/
+inline bool NpzReader::contains( const std::string& name ) const
+{
+   return find( name ) != nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads the given entry into a dense vector, matrix, tensor or array.
+//
+// \param name The name of the entry (with or without \c .npy extension).
+// \param x The target data structure.
+// \return void
+// \exception std::runtime_error Entry could not be read.
+//
+// For more information about the supported data structures and element types, see the
+// loadNpy() functions.
+*/
+template< typename T >  // Type of the target data structure
+inline void NpzReader::load( const std::string& name, T& x )
+{
+   seek( name );
+   loadNpy( is_, x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads the given entry into an unpadded NpyArray.
+//
+// \param name The name of the entry (with or without \c .npy extension).
+// \return The unpadded elements of the entry.
+// \exception std::runtime_error Entry could not be read.
+*/
+inline NpyArray NpzReader::array( const std::string& name )
+{
+   seek( name );
+   return NpyArray( is_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads the given number of bytes at the given position of the archive.
+//
+// \param buffer The target buffer.
+// \param offset The position within the archive.
+// \param n The number of bytes to be read.
+// \return void
+// \exception std::runtime_error Invalid npz archive detected.
+*/
+inline void NpzReader::read( std::vector<unsigned char>& buffer, uint64_t offset, size_t n )
+{
+   buffer.resize( n );
+
+   is_.clear();
+   is_.seekg( static_cast<std::streamoff>( offset ) );
+
+   if( !is_.read( reinterpret_cast<char*>( buffer.data() ), static_cast<std::streamsize>( n ) ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid npz archive detected" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads the central directory of the archive.
+//
+// \return void
+// \exception std::runtime_error Invalid npz archive detected.
+*/
+inline void NpzReader::readDirectory()
+{
+   std::vector<unsigned char> buffer;
+
+   is_.seekg( 0L, std::ios::end );
+   const std::streamoff end( is_.tellg() );
+
+   if( !is_ || end < 22L ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid npz archive detected" );
+   }
+
+   // Searching the end of central directory record (followed by an optional comment)
+   const size_t tail( static_cast<size_t>( std::min<std::streamoff>( end, 22L + 65535L ) ) );
+   read( buffer, static_cast<uint64_t>( end ) - tail, tail );
+
+   size_t pos( tail - 22UL );
+   while( npzValue( buffer.data()+pos, 4UL ) != 0x06054b50UL ) {
+      if( pos == 0UL ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid npz archive detected" );
+      }
+      --pos;
+   }
+
+   uint64_t count ( npzValue( buffer.data()+pos+10UL, 2UL ) );
+   uint64_t size  ( npzValue( buffer.data()+pos+12UL, 4UL ) );
+   uint64_t offset( npzValue( buffer.data()+pos+16UL, 4UL ) );
+
+   // Evaluating the zip64 end of central directory record via its locator
+   if( count == 0xFFFFUL || size == 0xFFFFFFFFUL || offset == 0xFFFFFFFFUL )
+   {
+      if( pos < 20UL || npzValue( buffer.data()+pos-20UL, 4UL ) != 0x07064b50UL ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid npz archive detected" );
+      }
+
+      read( buffer, npzValue( buffer.data()+pos-12UL, 8UL ), 56UL );
+
+      if( npzValue( buffer.data(), 4UL ) != 0x06064b50UL ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid npz archive detected" );
+      }
+
+      count  = npzValue( buffer.data()+32UL, 8UL );
+      size   = npzValue( buffer.data()+40UL, 8UL );
+      offset = npzValue( buffer.data()+48UL, 8UL );
+   }
+
+   read( buffer, offset, size );
+
+   entries_.clear();
+   entries_.reserve( count );
+
+   for( pos=0UL; count > 0UL; --count )
+   {
+      const unsigned char* header( buffer.data()+pos );
+
+      if( pos + 46UL > size || npzValue( header, 4UL ) != 0x02014b50UL ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid npz archive detected" );
+      }
+
+      const uint64_t method( npzValue( header+10UL, 2UL ) );
+      uint64_t compressed  ( npzValue( header+20UL, 4UL ) );
+      uint64_t uncompressed( npzValue( header+24UL, 4UL ) );
+      uint64_t local       ( npzValue( header+42UL, 4UL ) );
+
+      const size_t nameLength   ( npzValue( header+28UL, 2UL ) );
+      const size_t extraLength  ( npzValue( header+30UL, 2UL ) );
+      const size_t commentLength( npzValue( header+32UL, 2UL ) );
+
+      if( pos + 46UL + nameLength + extraLength + commentLength > size ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid npz archive detected" );
+      }
+
+      // Evaluating the zip64 extended information, which replaces all saturated fields
+      const unsigned char* extra( header + 46UL + nameLength );
+      const unsigned char* const last( extra + extraLength );
+
+      while( extra + 4UL <= last )
+      {
+         const size_t length( npzValue( extra+2UL, 2UL ) );
+         const unsigned char* field( extra+4UL );
+
+         if( npzValue( extra, 2UL ) == 0x0001UL && field + length <= last ) {
+            if( uncompressed == 0xFFFFFFFFUL ) {
+               uncompressed = npzValue( field, 8UL );
+               field += 8UL;
+            }
+            if( compressed == 0xFFFFFFFFUL ) {
+               compressed = npzValue( field, 8UL );
+               field += 8UL;
+            }
+            if( local == 0xFFFFFFFFUL ) {
+               local = npzValue( field, 8UL );
+            }
+         }
+
+         extra += 4UL + length;
+      }
+
+      entries_.push_back( Entry{ std::string( reinterpret_cast<const char*>( header+46UL ),
+                                              nameLength ),
+                                 local, method == 0UL && compressed == uncompressed } );
+
+      pos += 46UL + nameLength + extraLength + commentLength;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches the entry with the given name.
+//
+// \param name The name of the entry (with or without \c .npy extension).
+// \return Pointer to the entry, \a nullptr in case no such entry exists.
+*/
+inline const NpzReader::Entry* NpzReader::find( const std::string& name ) const
+{
+   for( const Entry& entry : entries_ ) {
+      if( entry.name == name || entry.name == name + ".npy" )
+         return &entry;
+   }
+
+   return nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Positions the input stream at the beginning of the data of the given entry.
+//
+// \param name The name of the entry (with or without \c .npy extension).
+// \return void
+// \exception std::runtime_error Entry could not be found or is compressed.
+*/
+inline void NpzReader::seek( const std::string& name )
+{
+   const Entry* entry( find( name ) );
+
+   if( entry == nullptr ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Npz entry could not be found" );
+   }
+
+   if( !entry->stored ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Compressed npz entries are not supported" );
+   }
+
+   std::vector<unsigned char> header;
+   read( header, entry->offset, 30UL );
+
+   if( npzValue( header.data(), 4UL ) != 0x04034b50UL ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid npz archive detected" );
+   }
+
+   is_.seekg( static_cast<std::streamoff>( entry->offset + 30UL +
+                                           npzValue( header.data()+26UL, 2UL ) +
+                                           npzValue( header.data()+28UL, 2UL ) ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS NPZWRITER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writer for uncompressed NumPy \c .npz archives.
+// \ingroup math_serialization
+//
+// The NpzWriter class stores dense vectors, matrices, tensors and arrays as members of a \c .npz
+// archive that can be read via \c numpy.load():
+
+   \code
+   {
+      blaze::NpzWriter archive( "model.npz" );
+
+      archive.add( "W", W );  // Any dense tensor
+      archive.add( "b", b );  // Any dense vector
+   }  // The archive is completed by close() or the destructor
+
+   // Python: d = numpy.load( "model.npz" ); d["W"], d["b"]
+   \endcode
+
+// The entries are stored without compression and without zip64 extensions, i.e. neither a
+// single entry nor the complete archive may exceed 4 GiB. In case an entry cannot be added, a
+// \a std::runtime_error exception is thrown.
+*/
+class NpzWriter
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline NpzWriter( std::ostream& os );
+   explicit inline NpzWriter( const std::string& filename );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~NpzWriter();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename T >
+   inline void add( const std::string& name, const T& x );
+
+   inline void close();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   //! Meta information of a single archive entry.
+   struct Entry
+   {
+      std::string name;    //!< The name of the entry within the archive.
+      uint32_t    crc;     //!< The CRC-32 checksum of the entry.
+      uint32_t    size;    //!< The size of the entry in bytes.
+      uint32_t    offset;  //!< The offset of the local header of the entry.
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void writeHeader( uint64_t signature, const Entry& entry );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::unique_ptr<std::ofstream> file_;     //!< The archive file in case of a named archive.
+   std::ostream&                  os_;       //!< The output stream of the archive.
+   std::vector<Entry>             entries_;  //!< The entries written so far.
+   uint64_t                       offset_;   //!< The number of bytes written so far.
+   bool                           closed_;   //!< \a true in case the archive has been completed.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Starts a new \c .npz archive in the given output stream.
+//
+// \param os The output stream of the archive.
+//
+// The archive has to start at the beginning of the given output stream.
+*/
+inline NpzWriter::NpzWriter( std::ostream& os )
+   : file_   ()         // The archive file in case of a named archive
+   , os_     ( os )     // The output stream of the archive
+   , entries_()         // The entries written so far
+   , offset_ ( 0UL )    // The number of bytes written so far
+   , closed_ ( false )  // The completion flag
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the given \c .npz archive.
+//
+// \param filename The name of the \c .npz file.
+// \exception std::runtime_error Npz file could not be opened.
+*/
+inline NpzWriter::NpzWriter( const std::string& filename )
+   : file_   ( new std::ofstream( filename, std::ios::out | std::ios::binary | std::ios::trunc ) )
+   , os_     ( *file_ )  // The output stream of the archive
+   , entries_()          // The entries written so far
+   , offset_ ( 0UL )     // The number of bytes written so far
+   , closed_ ( false )   // The completion flag
+{
+   if( !os_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Npz file could not be opened" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The destructor of the NpzWriter class.
+//
+// The destructor completes the archive in case close() has not been called explicitly. Since
+// errors cannot be reported from the destructor, close() should be called explicitly in case
+// the success of the final write operation is relevant.
+*/
+inline NpzWriter::~NpzWriter()
+{
+   try {
+      close();
+   }
+   catch( ... ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adds a dense vector, matrix, tensor or array to the archive.
+//
+// \param name The name of the entry (the \c .npy extension is appended).
+// \param x The data structure to be written.
+// \return void
+// \exception std::runtime_error Entry could not be added.
+//
+// The entry is serialized via the saveNpy() functions into a temporary buffer, which is required
+// to compute the checksum stored in front of the data.
+*/
+template< typename T >  // Type of the data structure
+inline void NpzWriter::add( const std::string& name, const T& x )
+{
+   if( closed_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Npz archive has already been closed" );
+   }
+
+   std::ostringstream buffer;
+   saveNpy( buffer, x );
+   const std::string data( buffer.str() );
+
+   const Entry entry{ name + ".npy", npzCrc32( data.data(), data.size() ),
+                      static_cast<uint32_t>( data.size() ), static_cast<uint32_t>( offset_ ) };
+
+   if( data.size() >= 0xFFFFFFFFUL || offset_ >= 0xFFFFFFFFUL || entries_.size() >= 0xFFFFUL ||
+       entry.name.size() > 0xFFFFUL ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Npz archive exceeds the size limits of the zip format" );
+   }
+
+   writeHeader( 0x04034b50UL, entry );
+
+   if( !os_.write( data.data(), static_cast<std::streamsize>( data.size() ) ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Faulty npz stream detected" );
+   }
+
+   offset_ += 30UL + entry.name.size() + data.size();
+   entries_.push_back( entry );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Completes the archive by writing the central directory.
+//
+// \return void
+// \exception std::runtime_error Faulty npz stream detected.
+//
+// After the archive has been closed, no further entries can be added. Repeated calls have no
+// effect.
+*/
+inline void NpzWriter::close()
+{
+   if( closed_ )
+      return;
+
+   closed_ = true;
+
+   uint64_t size( 0UL );
+
+   for( const Entry& entry : entries_ ) {
+      writeHeader( 0x02014b50UL, entry );
+      size += 46UL + entry.name.size();
+   }
+
+   if( offset_ + size >= 0xFFFFFFFFUL ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Npz archive exceeds the size limits of the zip format" );
+   }
+
+   writeNpzValue( os_, 0x06054b50UL, 4UL );  // End of central directory signature
+   writeNpzValue( os_, 0UL, 4UL );           // Number of this disk and of the directory disk
+   writeNpzValue( os_, entries_.size(), 2UL );
+   writeNpzValue( os_, entries_.size(), 2UL );
+   writeNpzValue( os_, size, 4UL );
+   writeNpzValue( os_, offset_, 4UL );
+   writeNpzValue( os_, 0UL, 2UL );           // Length of the archive comment
+
+   if( !os_.flush() ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Faulty npz stream detected" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the local or central directory header of the given entry.
+//
+// \param signature The signature of the header (local or central directory header).
+// \param entry The entry to be described.
+// \return void
+// \exception std::runtime_error Faulty npz stream detected.
+*/
+inline void NpzWriter::writeHeader( uint64_t signature, const Entry& entry )
+{
+   const bool central( signature == 0x02014b50UL );
+
+   writeNpzValue( os_, signature, 4UL );
+   if( central )
+      writeNpzValue( os_, 20UL, 2UL );      // Version made by
+   writeNpzValue( os_, 20UL, 2UL );         // Version needed to extract
+   writeNpzValue( os_, 0UL, 2UL );          // General purpose flags
+   writeNpzValue( os_, 0UL, 2UL );          // Compression method (stored)
+   writeNpzValue( os_, 0UL, 2UL );          // Modification time
+   writeNpzValue( os_, 0x21UL, 2UL );       // Modification date (1980-01-01)
+   writeNpzValue( os_, entry.crc, 4UL );
+   writeNpzValue( os_, entry.size, 4UL );   // Compressed size
+   writeNpzValue( os_, entry.size, 4UL );   // Uncompressed size
+   writeNpzValue( os_, entry.name.size(), 2UL );
+   writeNpzValue( os_, 0UL, 2UL );          // Length of the extra field
+   if( central ) {
+      writeNpzValue( os_, 0UL, 2UL );       // Length of the file comment
+      writeNpzValue( os_, 0UL, 2UL );       // Disk number start
+      writeNpzValue( os_, 0UL, 2UL );       // Internal file attributes
+      writeNpzValue( os_, 0UL, 4UL );       // External file attributes
+      writeNpzValue( os_, entry.offset, 4UL );
+   }
+
+   if( !os_.write( entry.name.data(), static_cast<std::streamsize>( entry.name.size() ) ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Faulty npz stream detected" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,646 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/serialization/TensorSerializer.h
+//  \brief Serialization of dense tensors
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+#ifndef _BLAZE_TENSOR_MATH_SERIALIZATION_TENSORSERIALIZER_H_
+#define _BLAZE_TENSOR_MATH_SERIALIZATION_TENSORSERIALIZER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/expressions/Tensor.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Serializer for dense tensors.
+// \ingroup math_serialization
+//
+// The TensorSerializer implements the necessary logic to serialize dense tensors, i.e. to
+// convert them into a portable, binary representation. The following example demonstrates
+// the (de-)serialization process of tensors:
+
+   \code
+   using blaze::DynamicTensor;
+   using blaze::StaticTensor;
+
+   // Serialization of both tensors
+   {
+      StaticTensor<double,2UL,3UL,5UL> T1;
+      DynamicTensor<int> T2;
+
+      // ... Resizing and initialization
+
+      // Creating an archive that writes into the file "tensors.blaze"
+      blaze::Archive<std::ofstream> archive( "tensors.blaze" );
+
+      // Serialization of both tensors into the same archive. Note that T1 lies before T2!
+      archive << T1 << T2;
+   }
+
+   // Reconstitution of both tensors
+   {
+      DynamicTensor<double> T1;
+      DynamicTensor<int> T2;
+
+      // Creating an archive that reads from the file "tensors.blaze"
+      blaze::Archive<std::ifstream> archive( "tensors.blaze" );
+
+      // Reconstituting the former T1 tensor into T1. Note that it is possible to reconstitute
+      // the tensor into a different kind of tensor (StaticTensor -> DynamicTensor), but that
+      // the type of elements has to be the same.
+      archive >> T1 >> T2;
+   }
+   \endcode
+
+// Each serialized tensor consists of a header, which holds the version of the format, the type
+// of the tensor, the type and size of the elements as well as the number of pages, rows and
+// columns, followed by the elements in row-major order. The padding elements of the tensor are
+// not part of the archive. In case the elements are of built-in data type and the tensor
+// provides direct access to its rows, every row is written to and read from the archive in a
+// single bulk operation directly from or into the memory of the tensor. Therefore it is possible
+// to reconstitute a serialized tensor into any kind of dense tensor with the same element type
+// (for instance from a StaticTensor into a DynamicTensor). Note however, that it is only
+// possible to reconstitute a tensor of different size into a resizable tensor.
+*/
+class TensorSerializer
+{
+ private:
+   //**Auxiliary variable templates****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the selection of the bulk serialization of the tensor rows.
+   template< typename TT >
+   static constexpr bool UseBulkWrite_v =
+      ( IsNumeric_v< ElementType_t<TT> > && IsContiguous_v<TT> && HasConstDataAccess_v<TT> );
+
+   //! Helper variable template for the selection of the bulk deserialization of the tensor rows.
+   template< typename TT >
+   static constexpr bool UseBulkRead_v =
+      ( IsNumeric_v< ElementType_t<TT> > && IsContiguous_v<TT> && HasMutableDataAccess_v<TT> );
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline TensorSerializer();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   // No explicitly declared copy assignment operator.
+   //**********************************************************************************************
+
+   //**Serialization functions*********************************************************************
+   /*!\name Serialization functions */
+   //@{
+   template< typename Archive, typename TT >
+   void serialize( Archive& archive, const Tensor<TT>& tens );
+   //@}
+   //**********************************************************************************************
+
+   //**Deserialization functions*******************************************************************
+   /*!\name Deserialization functions */
+   //@{
+   template< typename Archive, typename TT >
+   void deserialize( Archive& archive, Tensor<TT>& tens );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Serialization functions*********************************************************************
+   /*!\name Serialization functions */
+   //@{
+   template< typename Archive, typename TT >
+   void serializeHeader( Archive& archive, const TT& tens );
+
+   template< typename Archive, typename TT >
+   auto serializeTensor( Archive& archive, const DenseTensor<TT>& tens )
+      -> DisableIf_t< UseBulkWrite_v<TT> >;
+
+   template< typename Archive, typename TT >
+   auto serializeTensor( Archive& archive, const DenseTensor<TT>& tens )
+      -> EnableIf_t< UseBulkWrite_v<TT> >;
+   //@}
+   //**********************************************************************************************
+
+   //**Deserialization functions*******************************************************************
+   /*!\name Deserialization functions */
+   //@{
+   template< typename Archive, typename TT >
+   void deserializeHeader( Archive& archive, const TT& tens );
+
+   template< typename TT >
+   DisableIf_t< IsResizable_v<TT> > prepareTensor( DenseTensor<TT>& tens );
+
+   template< typename TT >
+   EnableIf_t< IsResizable_v<TT> > prepareTensor( DenseTensor<TT>& tens );
+
+   template< typename Archive, typename TT >
+   auto deserializeTensor( Archive& archive, DenseTensor<TT>& tens )
+      -> DisableIf_t< UseBulkRead_v<TT> >;
+
+   template< typename Archive, typename TT >
+   auto deserializeTensor( Archive& archive, DenseTensor<TT>& tens )
+      -> EnableIf_t< UseBulkRead_v<TT> >;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   uint8_t  version_;      //!< The version of the archive.
+   uint8_t  type_;         //!< The type of the tensor.
+   uint8_t  elementType_;  //!< The type of an element.
+   uint8_t  elementSize_;  //!< The size in bytes of a single element of the tensor.
+   uint64_t pages_;        //!< The number of pages of the tensor.
+   uint64_t rows_;         //!< The number of rows of the tensor.
+   uint64_t columns_;      //!< The number of columns of the tensor.
+   uint64_t number_;       //!< The total number of elements contained in the tensor.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor of the TensorSerializer class.
+*/
+TensorSerializer::TensorSerializer()
+   : version_    ( 0U  )  // The version of the archive
+   , type_       ( 0U  )  // The type of the tensor
+   , elementType_( 0U  )  // The type of an element
+   , elementSize_( 0U  )  // The size in bytes of a single element of the tensor
+   , pages_      ( 0UL )  // The number of pages of the tensor
+   , rows_       ( 0UL )  // The number of rows of the tensor
+   , columns_    ( 0UL )  // The number of columns of the tensor
+   , number_     ( 0UL )  // The total number of elements contained in the tensor
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SERIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Serializes the given tensor and writes it to the archive.
+//
+// \param archive The archive to be written.
+// \param tens The tensor to be serialized.
+// \return void
+// \exception std::runtime_error Error during serialization.
+//
+// This function serializes the given tensor and writes it to the given archive. In case any
+// error is detected during the serialization, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the tensor
+void TensorSerializer::serialize( Archive& archive, const Tensor<TT>& tens )
+{
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Faulty archive detected" );
+   }
+
+   serializeHeader( archive, ~tens );
+   serializeTensor( archive, ~tens );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes all meta information about the given tensor.
+//
+// \param archive The archive to be written.
+// \param tens The tensor to be serialized.
+// \return void
+// \exception std::runtime_error File header could not be serialized.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the tensor
+void TensorSerializer::serializeHeader( Archive& archive, const TT& tens )
+{
+   using ET = ElementType_t<TT>;
+
+   archive << uint8_t ( 1U );
+   archive << uint8_t ( 0U );
+   archive << uint8_t ( TypeValueMapping<ET>::value );
+   archive << uint8_t ( sizeof( ET ) );
+   archive << uint64_t( tens.pages() );
+   archive << uint64_t( tens.rows() );
+   archive << uint64_t( tens.columns() );
+   archive << uint64_t( tens.pages() * tens.rows() * tens.columns() );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File header could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a dense tensor.
+//
+// \param archive The archive to be written.
+// \param tens The tensor to be serialized.
+// \return void
+// \exception std::runtime_error Dense tensor could not be serialized.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the tensor
+auto TensorSerializer::serializeTensor( Archive& archive, const DenseTensor<TT>& tens )
+   -> DisableIf_t< UseBulkWrite_v<TT> >
+{
+   for( size_t k=0UL; k<(~tens).pages(); ++k ) {
+      for( size_t i=0UL; i<(~tens).rows(); ++i ) {
+         size_t j( 0UL );
+         while( ( j < (~tens).columns() ) && ( archive << (~tens)(k,i,j) ) ) {
+            ++j;
+         }
+      }
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense tensor could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a dense tensor with direct access to its rows.
+//
+// \param archive The archive to be written.
+// \param tens The tensor to be serialized.
+// \return void
+// \exception std::runtime_error Dense tensor could not be serialized.
+//
+// Every row of the tensor is written to the archive by a single bulk write, which skips the
+// padding elements at the end of the row.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the tensor
+auto TensorSerializer::serializeTensor( Archive& archive, const DenseTensor<TT>& tens )
+   -> EnableIf_t< UseBulkWrite_v<TT> >
+{
+   const size_t n( (~tens).columns() );
+
+   if( n == 0UL ) return;
+
+   for( size_t k=0UL; k<(~tens).pages(); ++k ) {
+      for( size_t i=0UL; i<(~tens).rows() && archive; ++i ) {
+         archive.write( (~tens).data(i,k), n );
+      }
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense tensor could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESERIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Deserializes a tensor from the given archive.
+//
+// \param archive The archive to be read from.
+// \param tens The tensor to be deserialized.
+// \return void
+// \exception std::runtime_error Error during deserialization.
+//
+// This function deserializes the contents of the tensor from the archive and reconstitutes the
+// given tensor. In case any error is detected during the deserialization process (for instance
+// an invalid type of tensor or element type, an invalid number of elements, or a size mismatch
+// for a non-resizable tensor), a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the tensor
+void TensorSerializer::deserialize( Archive& archive, Tensor<TT>& tens )
+{
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Faulty archive detected" );
+   }
+
+   deserializeHeader( archive, ~tens );
+   prepareTensor( ~tens );
+   deserializeTensor( archive, ~tens );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes all meta information about the given tensor.
+//
+// \param archive The archive to be read from.
+// \param tens The tensor to be deserialized.
+// \return void
+// \exception std::runtime_error Error during deserialization.
+//
+// This function deserializes all meta information about the given tensor contained in the
+// header of the given archive. In case any error is detected during the deserialization
+// process (for instance an invalid type of tensor or element type, an invalid number of
+// elements, or a size mismatch for a non-resizable tensor), a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the tensor
+void TensorSerializer::deserializeHeader( Archive& archive, const TT& tens )
+{
+   using ET = ElementType_t<TT>;
+
+   if( !( archive >> version_ >> type_ >> elementType_ >> elementSize_ >>
+                     pages_ >> rows_ >> columns_ >> number_ ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+   else if( version_ != 1UL ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid version detected" );
+   }
+   else if( type_ != 0U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid tensor type detected" );
+   }
+   else if( elementType_ != TypeValueMapping<ET>::value ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+   }
+   else if( elementSize_ != sizeof( ET ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element size detected" );
+   }
+   else if( !IsResizable_v<TT> &&
+            ( pages_ != tens.pages() || rows_ != tens.rows() || columns_ != tens.columns() ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid tensor size detected" );
+   }
+   else if( number_ != pages_*rows_*columns_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prepares the given non-resizable dense tensor for the deserialization process.
+//
+// \param tens The dense tensor to be prepared.
+// \return void
+*/
+template< typename TT >  // Type of the tensor
+DisableIf_t< IsResizable_v<TT> > TensorSerializer::prepareTensor( DenseTensor<TT>& tens )
+{
+   MAYBE_UNUSED( tens );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prepares the given resizable dense tensor for the deserialization process.
+//
+// \param tens The dense tensor to be prepared.
+// \return void
+*/
+template< typename TT >  // Type of the tensor
+EnableIf_t< IsResizable_v<TT> > TensorSerializer::prepareTensor( DenseTensor<TT>& tens )
+{
+   (~tens).resize( pages_, rows_, columns_, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a dense tensor.
+//
+// \param archive The archive to be read from.
+// \param tens The dense tensor to be reconstituted.
+// \return void
+// \exception std::runtime_error Dense tensor could not be deserialized.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the tensor
+auto TensorSerializer::deserializeTensor( Archive& archive, DenseTensor<TT>& tens )
+   -> DisableIf_t< UseBulkRead_v<TT> >
+{
+   using ET = ElementType_t<TT>;
+
+   ET value{};
+
+   for( size_t k=0UL; k<pages_; ++k ) {
+      for( size_t i=0UL; i<rows_; ++i ) {
+         size_t j( 0UL );
+         while( ( j != columns_ ) && ( archive >> value ) ) {
+            (~tens)(k,i,j) = value;
+            ++j;
+         }
+      }
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense tensor could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a dense tensor with direct access to its rows.
+//
+// \param archive The archive to be read from.
+// \param tens The dense tensor to be reconstituted.
+// \return void
+// \exception std::runtime_error Dense tensor could not be deserialized.
+//
+// Every row of the tensor is read from the archive by a single bulk read directly into the
+// (aligned) memory of the tensor. The padding elements of the tensor are not touched.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the tensor
+auto TensorSerializer::deserializeTensor( Archive& archive, DenseTensor<TT>& tens )
+   -> EnableIf_t< UseBulkRead_v<TT> >
+{
+   if( columns_ == 0UL ) return;
+
+   for( size_t k=0UL; k<pages_; ++k ) {
+      for( size_t i=0UL; i<rows_ && archive; ++i ) {
+         archive.read( (~tens).data(i,k), columns_ );
+      }
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense tensor could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Serializes the given tensor and writes it to the archive.
+// \ingroup math_serialization
+//
+// \param archive The archive to be written.
+// \param tens The tensor to be serialized.
+// \return void
+// \exception std::runtime_error Error during serialization.
+//
+// The serialize() function converts the given tensor into a portable, binary representation.
+// The following example demonstrates the (de-)serialization process of tensors:
+
+   \code
+   using blaze::DynamicTensor;
+   using blaze::StaticTensor;
+
+   // Serialization of both tensors
+   {
+      StaticTensor<double,2UL,3UL,5UL> T1;
+      DynamicTensor<int> T2;
+
+      // ... Resizing and initialization
+
+      // Creating an archive that writes into the file "tensors.blaze"
+      blaze::Archive<std::ofstream> archive( "tensors.blaze" );
+
+      // Serialization of both tensors into the same archive. Note that T1 lies before T2!
+      archive << T1 << T2;
+   }
+
+   // Reconstitution of both tensors
+   {
+      DynamicTensor<double> T1;
+      DynamicTensor<int> T2;
+
+      // Creating an archive that reads from the file "tensors.blaze"
+      blaze::Archive<std::ifstream> archive( "tensors.blaze" );
+
+      // Reconstituting the former T1 tensor into T1. Note that it is possible to reconstitute
+      // the tensor into a different kind of tensor (StaticTensor -> DynamicTensor), but that
+      // the type of elements has to be the same.
+      archive >> T1 >> T2;
+   }
+   \endcode
+
+// As the example demonstrates, the tensor serialization offers an enormous flexibility. However,
+// several actions result in errors:
+//
+//  - restoring tensors of different element type (e.g. serializing a DynamicTensor<float> and
+//    restoring a DynamicTensor<double>),
+//  - restoring a tensor of different size into a non-resizable tensor (e.g. StaticTensor or
+//    CustomTensor).
+//
+// In case an error is encountered during (de-)serialization, a \a std::runtime_error is
+// thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the tensor
+void serialize( Archive& archive, const Tensor<TT>& tens )
+{
+   TensorSerializer().serialize( archive, ~tens );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a tensor from the given archive.
+// \ingroup math_serialization
+//
+// \param archive The archive to be read from.
+// \param tens The tensor to be deserialized.
+// \return void
+// \exception std::runtime_error Tensor could not be deserialized.
+//
+// For more information about the tensor serialization and deserialization, see the
+// serialize() function.
+*/
+template< typename Archive  // Type of the archive
+        , typename TT >     // Type of the tensor
+void deserialize( Archive& archive, Tensor<TT>& tens )
+{
+   TensorSerializer().deserialize( archive, ~tens );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
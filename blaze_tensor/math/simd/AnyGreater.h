@@ -0,0 +1,106 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/simd/AnyGreater.h
+//  \brief Header file for the SIMD any-greater functionality
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_SIMD_ANYGREATER_H_
+#define _BLAZE_TENSOR_MATH_SIMD_ANYGREATER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ANYGREATER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether any element of a vector of 'float' values is greater than the
+//        corresponding element of a second vector.
+// \ingroup simd
+//
+// \param a The left-hand side SIMD vector.
+// \param b The right-hand side SIMD vector.
+// \return \a true if \f$ a_l > b_l \f$ for at least one lane \a l, \a false if not.
+//
+// This function is only available for AVX2 and AVX-512.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_AVX2_MODE
+BLAZE_ALWAYS_INLINE bool anyGreater( const SIMDfloat& a, const SIMDfloat& b ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_cmp_ps_mask( a.value, b.value, _CMP_GT_OQ ) != 0;
+#else
+   return _mm256_movemask_ps( _mm256_cmp_ps( a.value, b.value, _CMP_GT_OQ ) ) != 0;
+#endif
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether any element of a vector of 'double' values is greater than the
+//        corresponding element of a second vector.
+// \ingroup simd
+//
+// \param a The left-hand side SIMD vector.
+// \param b The right-hand side SIMD vector.
+// \return \a true if \f$ a_l > b_l \f$ for at least one lane \a l, \a false if not.
+//
+// This function is only available for AVX2 and AVX-512.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_AVX2_MODE
+BLAZE_ALWAYS_INLINE bool anyGreater( const SIMDdouble& a, const SIMDdouble& b ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_cmp_pd_mask( a.value, b.value, _CMP_GT_OQ ) != 0;
+#else
+   return _mm256_movemask_pd( _mm256_cmp_pd( a.value, b.value, _CMP_GT_OQ ) ) != 0;
+#endif
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
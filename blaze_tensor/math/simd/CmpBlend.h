@@ -0,0 +1,126 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/simd/CmpBlend.h
+//  \brief Header file for the SIMD compare-and-blend functionality
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_SIMD_CMPBLEND_H_
+#define _BLAZE_TENSOR_MATH_SIMD_CMPBLEND_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  COMPARE-AND-BLEND FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compare-and-blend of a vector of 'float' values and their 32-bit indices.
+// \ingroup simd
+//
+// \param a The left-hand side SIMD vector, which is updated.
+// \param ia The indices of the elements of \a a, which are updated.
+// \param b The right-hand side SIMD vector.
+// \param ib The indices of the elements of \a b.
+// \return void
+//
+// Every element of \a a (and its index in \a ia) is replaced by the corresponding element of
+// \a b (and its index in \a ib) in case it is greater (\a GT set to \a true) or less (\a GT set
+// to \a false) than the element of \a a. In case of equal elements \a a is retained. This
+// function is only available for AVX2 and AVX-512.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_AVX2_MODE
+template< bool GT >  // Compare by greater than (true) or less than (false)
+BLAZE_ALWAYS_INLINE void cmpBlend( SIMDfloat& a, SIMDint32& ia,
+                                   const SIMDfloat& b, const SIMDint32& ib ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const __mmask16 mask( _mm512_cmp_ps_mask( b.value, a.value, GT ? _CMP_GT_OQ : _CMP_LT_OQ ) );
+   a.value  = _mm512_mask_blend_ps( mask, a.value, b.value );
+   ia.value = _mm512_mask_blend_epi32( mask, ia.value, ib.value );
+#else
+   const __m256 mask( _mm256_cmp_ps( b.value, a.value, GT ? _CMP_GT_OQ : _CMP_LT_OQ ) );
+   a.value  = _mm256_blendv_ps( a.value, b.value, mask );
+   ia.value = _mm256_castps_si256( _mm256_blendv_ps( _mm256_castsi256_ps( ia.value ),
+                                                     _mm256_castsi256_ps( ib.value ), mask ) );
+#endif
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compare-and-blend of a vector of 'double' values and their 64-bit indices.
+// \ingroup simd
+//
+// \param a The left-hand side SIMD vector, which is updated.
+// \param ia The indices of the elements of \a a, which are updated.
+// \param b The right-hand side SIMD vector.
+// \param ib The indices of the elements of \a b.
+// \return void
+//
+// This function works as the 'float' overload, but blends 64-bit indices. It is only available
+// for AVX2 and AVX-512.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_AVX2_MODE
+template< bool GT >  // Compare by greater than (true) or less than (false)
+BLAZE_ALWAYS_INLINE void cmpBlend( SIMDdouble& a, SIMDint64& ia,
+                                   const SIMDdouble& b, const SIMDint64& ib ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const __mmask8 mask( _mm512_cmp_pd_mask( b.value, a.value, GT ? _CMP_GT_OQ : _CMP_LT_OQ ) );
+   a.value  = _mm512_mask_blend_pd( mask, a.value, b.value );
+   ia.value = _mm512_mask_blend_epi64( mask, ia.value, ib.value );
+#else
+   const __m256d mask( _mm256_cmp_pd( b.value, a.value, GT ? _CMP_GT_OQ : _CMP_LT_OQ ) );
+   a.value  = _mm256_blendv_pd( a.value, b.value, mask );
+   ia.value = _mm256_castpd_si256( _mm256_blendv_pd( _mm256_castsi256_pd( ia.value ),
+                                                     _mm256_castsi256_pd( ib.value ), mask ) );
+#endif
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
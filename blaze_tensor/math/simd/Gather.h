@@ -0,0 +1,165 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/simd/Gather.h
+//  \brief Header file for the SIMD gather functionality
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_SIMD_GATHER_H_
+#define _BLAZE_TENSOR_MATH_SIMD_GATHER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/Loada.h>
+#include <blaze/math/simd/Loadu.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <climits>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GATHER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Strided load of a vector of elements.
+// \ingroup simd
+//
+// \param address The address of the first element.
+// \param stride The distance between two consecutive elements.
+// \return The SIMD vector of the gathered elements.
+//
+// This function loads the elements \a address[0], \a address[stride], \a address[2*stride], ...
+// into a single SIMD vector. In case \a stride is 1 the function degenerates to an unaligned
+// load of contiguous elements. This default implementation collects the elements in an aligned
+// buffer, which is then loaded as a whole. It is used for all element types for which no gather
+// instruction is available.
+*/
+template< typename T >  // Type of the scalar elements
+BLAZE_ALWAYS_INLINE const SIMDTrait_t<T> gather( const T* address, size_t stride ) noexcept
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<T>::size );
+
+   if( stride == 1UL ) {
+      return loadu( address );
+   }
+
+   alignas( AlignmentOf_v<T> ) T buffer[SIMDSIZE];
+   for( size_t k=0UL; k<SIMDSIZE; ++k ) {
+      buffer[k] = address[k*stride];
+   }
+   return loada( buffer );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Strided load of a vector of 'float' values.
+// \ingroup simd
+//
+// \param address The address of the first element.
+// \param stride The distance between two consecutive elements.
+// \return The SIMD vector of the gathered elements.
+//
+// This overload uses the AVX2 and AVX-512 gather instructions. Since the instructions use 32-bit
+// indices, strides that exceed the index range are handled by the default implementation.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_AVX2_MODE
+BLAZE_ALWAYS_INLINE const SIMDfloat gather( const float* address, size_t stride ) noexcept
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<float>::size );
+
+   if( stride == 1UL ) {
+      return loadu( address );
+   }
+   if( stride > size_t( INT_MAX ) / ( SIMDSIZE-1UL ) ) {
+      return gather<float>( address, stride );
+   }
+
+   const int s( static_cast<int>( stride ) );
+
+#if BLAZE_AVX512F_MODE
+   const __m512i index( _mm512_set_epi32( 15*s, 14*s, 13*s, 12*s, 11*s, 10*s, 9*s, 8*s,
+                                          7*s, 6*s, 5*s, 4*s, 3*s, 2*s, s, 0 ) );
+   return _mm512_i32gather_ps( index, address, 4 );
+#else
+   const __m256i index( _mm256_set_epi32( 7*s, 6*s, 5*s, 4*s, 3*s, 2*s, s, 0 ) );
+   return _mm256_i32gather_ps( address, index, 4 );
+#endif
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Strided load of a vector of 'double' values.
+// \ingroup simd
+//
+// \param address The address of the first element.
+// \param stride The distance between two consecutive elements.
+// \return The SIMD vector of the gathered elements.
+//
+// This overload uses the AVX2 and AVX-512 gather instructions with 64-bit indices.
+*/
+#if BLAZE_AVX512F_MODE || BLAZE_AVX2_MODE
+BLAZE_ALWAYS_INLINE const SIMDdouble gather( const double* address, size_t stride ) noexcept
+{
+   if( stride == 1UL ) {
+      return loadu( address );
+   }
+
+   const long long s( static_cast<long long>( stride ) );
+
+#if BLAZE_AVX512F_MODE
+   const __m512i index( _mm512_set_epi64( 7*s, 6*s, 5*s, 4*s, 3*s, 2*s, s, 0 ) );
+   return _mm512_i64gather_pd( index, address, 8 );
+#else
+   const __m256i index( _mm256_set_epi64x( 3*s, 2*s, s, 0 ) );
+   return _mm256_i64gather_pd( address, index, 8 );
+#endif
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
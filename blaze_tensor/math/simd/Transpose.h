@@ -0,0 +1,200 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/simd/Transpose.h
+//  \brief Header file for the SIMD tile transposition functionality
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_SIMD_TRANSPOSE_H_
+#define _BLAZE_TENSOR_MATH_SIMD_TRANSPOSE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TILE TRANSPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Transposition of a square tile of elements.
+// \ingroup simd
+//
+// \param src The address of the first element of the tile.
+// \param stride The distance between two consecutive rows of the tile.
+// \param dst The aligned, contiguous target buffer of \a SIMDSIZE x \a SIMDSIZE elements.
+// \return void
+//
+// This function transposes the \a SIMDSIZE x \a SIMDSIZE tile starting at \a src, whose rows
+// are \a stride elements apart, into the buffer \a dst, i.e. \a dst[j*SIMDSIZE+i] is set to
+// \a src[i*stride+j]. \a SIMDSIZE is the number of elements of type \a T per SIMD vector. This
+// default implementation copies the elements one by one. It is used for all element types for
+// which no in-register transposition is available.
+*/
+template< typename T >  // Type of the scalar elements
+BLAZE_ALWAYS_INLINE void transposeTile( const T* src, size_t stride, T* dst ) noexcept
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<T>::size );
+
+   for( size_t i=0UL; i<SIMDSIZE; ++i ) {
+      for( size_t j=0UL; j<SIMDSIZE; ++j ) {
+         dst[j*SIMDSIZE+i] = src[i*stride+j];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Transposition of a square tile of 'float' values.
+// \ingroup simd
+//
+// \param src The address of the first element of the tile.
+// \param stride The distance between two consecutive rows of the tile.
+// \param dst The aligned, contiguous target buffer of \a SIMDSIZE x \a SIMDSIZE elements.
+// \return void
+//
+// This overload loads the rows of the 4x4 (SSE) or 8x8 (AVX) tile into SIMD registers and
+// transposes them by means of unpack and shuffle instructions.
+*/
+#if ( BLAZE_SSE_MODE || BLAZE_AVX_MODE ) && !BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE void transposeTile( const float* src, size_t stride, float* dst ) noexcept
+{
+#if BLAZE_AVX_MODE
+   const __m256 r0( _mm256_loadu_ps( src          ) );
+   const __m256 r1( _mm256_loadu_ps( src+  stride ) );
+   const __m256 r2( _mm256_loadu_ps( src+2*stride ) );
+   const __m256 r3( _mm256_loadu_ps( src+3*stride ) );
+   const __m256 r4( _mm256_loadu_ps( src+4*stride ) );
+   const __m256 r5( _mm256_loadu_ps( src+5*stride ) );
+   const __m256 r6( _mm256_loadu_ps( src+6*stride ) );
+   const __m256 r7( _mm256_loadu_ps( src+7*stride ) );
+
+   const __m256 t0( _mm256_unpacklo_ps( r0, r1 ) );
+   const __m256 t1( _mm256_unpackhi_ps( r0, r1 ) );
+   const __m256 t2( _mm256_unpacklo_ps( r2, r3 ) );
+   const __m256 t3( _mm256_unpackhi_ps( r2, r3 ) );
+   const __m256 t4( _mm256_unpacklo_ps( r4, r5 ) );
+   const __m256 t5( _mm256_unpackhi_ps( r4, r5 ) );
+   const __m256 t6( _mm256_unpacklo_ps( r6, r7 ) );
+   const __m256 t7( _mm256_unpackhi_ps( r6, r7 ) );
+
+   const __m256 s0( _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 1, 0, 1, 0 ) ) );
+   const __m256 s1( _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+   const __m256 s2( _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 1, 0, 1, 0 ) ) );
+   const __m256 s3( _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+   const __m256 s4( _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE( 1, 0, 1, 0 ) ) );
+   const __m256 s5( _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+   const __m256 s6( _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE( 1, 0, 1, 0 ) ) );
+   const __m256 s7( _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+
+   _mm256_store_ps( dst     , _mm256_permute2f128_ps( s0, s4, 0x20 ) );
+   _mm256_store_ps( dst+ 8UL, _mm256_permute2f128_ps( s1, s5, 0x20 ) );
+   _mm256_store_ps( dst+16UL, _mm256_permute2f128_ps( s2, s6, 0x20 ) );
+   _mm256_store_ps( dst+24UL, _mm256_permute2f128_ps( s3, s7, 0x20 ) );
+   _mm256_store_ps( dst+32UL, _mm256_permute2f128_ps( s0, s4, 0x31 ) );
+   _mm256_store_ps( dst+40UL, _mm256_permute2f128_ps( s1, s5, 0x31 ) );
+   _mm256_store_ps( dst+48UL, _mm256_permute2f128_ps( s2, s6, 0x31 ) );
+   _mm256_store_ps( dst+56UL, _mm256_permute2f128_ps( s3, s7, 0x31 ) );
+#else
+   __m128 r0( _mm_loadu_ps( src          ) );
+   __m128 r1( _mm_loadu_ps( src+  stride ) );
+   __m128 r2( _mm_loadu_ps( src+2*stride ) );
+   __m128 r3( _mm_loadu_ps( src+3*stride ) );
+
+   _MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+
+   _mm_store_ps( dst      , r0 );
+   _mm_store_ps( dst+ 4UL, r1 );
+   _mm_store_ps( dst+ 8UL, r2 );
+   _mm_store_ps( dst+12UL, r3 );
+#endif
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Transposition of a square tile of 'double' values.
+// \ingroup simd
+//
+// \param src The address of the first element of the tile.
+// \param stride The distance between two consecutive rows of the tile.
+// \param dst The aligned, contiguous target buffer of \a SIMDSIZE x \a SIMDSIZE elements.
+// \return void
+//
+// This overload loads the rows of the 2x2 (SSE2) or 4x4 (AVX) tile into SIMD registers and
+// transposes them by means of unpack and lane permutation instructions.
+*/
+#if ( BLAZE_SSE2_MODE || BLAZE_AVX_MODE ) && !BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE void transposeTile( const double* src, size_t stride, double* dst ) noexcept
+{
+#if BLAZE_AVX_MODE
+   const __m256d r0( _mm256_loadu_pd( src          ) );
+   const __m256d r1( _mm256_loadu_pd( src+  stride ) );
+   const __m256d r2( _mm256_loadu_pd( src+2*stride ) );
+   const __m256d r3( _mm256_loadu_pd( src+3*stride ) );
+
+   const __m256d t0( _mm256_unpacklo_pd( r0, r1 ) );
+   const __m256d t1( _mm256_unpackhi_pd( r0, r1 ) );
+   const __m256d t2( _mm256_unpacklo_pd( r2, r3 ) );
+   const __m256d t3( _mm256_unpackhi_pd( r2, r3 ) );
+
+   _mm256_store_pd( dst      , _mm256_permute2f128_pd( t0, t2, 0x20 ) );
+   _mm256_store_pd( dst+ 4UL, _mm256_permute2f128_pd( t1, t3, 0x20 ) );
+   _mm256_store_pd( dst+ 8UL, _mm256_permute2f128_pd( t0, t2, 0x31 ) );
+   _mm256_store_pd( dst+12UL, _mm256_permute2f128_pd( t1, t3, 0x31 ) );
+#else
+   const __m128d r0( _mm_loadu_pd( src        ) );
+   const __m128d r1( _mm_loadu_pd( src+stride ) );
+
+   _mm_store_pd( dst    , _mm_unpacklo_pd( r0, r1 ) );
+   _mm_store_pd( dst+2UL, _mm_unpackhi_pd( r0, r1 ) );
+#endif
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,356 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/smp/ArrayBlockAssign.h
+//  \brief Header file for the block-wise (compound) assignment kernels of dense arrays
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_SMP_ARRAYBLOCKASSIGN_H_
+#define _BLAZE_TENSOR_MATH_SMP_ARRAYBLOCKASSIGN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/Expression.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/functors/Sub.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/util/ArrayForEach.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic wrapper for the plain assignment of a single (SIMD) element.
+// \ingroup smp
+//
+// In combination with the blaze::Add, blaze::Sub and blaze::Mult functors this functor allows
+// to express all (compound) assignments of the block kernels as \f$ a = op( a, b ) \f$.
+*/
+struct ArrayBlockCopy
+{
+   template< typename T1, typename T2 >
+   BLAZE_ALWAYS_INLINE constexpr const T2& operator()( const T1& /*a*/, const T2& b ) const {
+      return b;
+   }
+
+   template< typename T1, typename T2 >
+   static constexpr bool simdEnabled() { return IsSIMDCombinable_v<T1,T2>; }
+
+   template< typename T1, typename T2 >
+   BLAZE_ALWAYS_INLINE const T2& load( const T1& /*a*/, const T2& b ) const {
+      return b;
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCK DECOMPOSITION FUNCTIONALITY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Handle for a block of a dense array.
+// \ingroup smp
+//
+// The ArrayBlock class template represents a block of flattened pages, rows and columns of a
+// dense array (see arrayBlockAssign()). Since ND arrays don't provide a view type for arbitrary
+// blocks, ArrayBlock is used to hand the single blocks of a partitioned array to the thread
+// backend.
+*/
+template< typename TT >  // Type of the dense array
+class ArrayBlock
+   : public Expression< ArrayBlock<TT> >
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the ArrayBlock class template.
+   //
+   // \param array The dense array containing the block.
+   // \param page The first flattened page of the block.
+   // \param row The first row of the block.
+   // \param column The first column of the block.
+   // \param o The number of flattened pages of the block.
+   // \param m The number of rows of the block.
+   // \param n The number of columns of the block.
+   */
+   explicit inline ArrayBlock( TT& array, size_t page, size_t row, size_t column,
+                               size_t o, size_t m, size_t n ) noexcept
+      : array_ ( array  )  // The dense array containing the block
+      , page_  ( page   )  // The first flattened page of the block
+      , row_   ( row    )  // The first row of the block
+      , column_( column )  // The first column of the block
+      , o_     ( o      )  // The number of flattened pages of the block
+      , m_     ( m      )  // The number of rows of the block
+      , n_     ( n      )  // The number of columns of the block
+   {}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline TT&    operand() const noexcept { return array_;  }
+   inline size_t page   () const noexcept { return page_;   }
+   inline size_t row    () const noexcept { return row_;    }
+   inline size_t column () const noexcept { return column_; }
+   inline size_t pages  () const noexcept { return o_;      }
+   inline size_t rows   () const noexcept { return m_;      }
+   inline size_t columns() const noexcept { return n_;      }
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   TT&    array_;   //!< The dense array containing the block.
+   size_t page_;    //!< The first flattened page of the block.
+   size_t row_;     //!< The first row of the block.
+   size_t column_;  //!< The first column of the block.
+   size_t o_;       //!< The number of flattened pages of the block.
+   size_t m_;       //!< The number of rows of the block.
+   size_t n_;       //!< The number of columns of the block.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCK ASSIGNMENT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the (compound) assignment of a single row segment.
+// \ingroup smp
+//
+// \param left Iterator to the first element of the left-hand side row segment.
+// \param right Iterator to the first element of the right-hand side row segment.
+// \param n The number of elements in the row segment.
+// \param op The (compound) assignment operation.
+// \return void
+*/
+template< bool SIMD        // Compile time switch for the SIMD kernel
+        , typename IT1     // Type of the left-hand side iterator
+        , typename IT2     // Type of the right-hand side iterator
+        , typename OP >    // Type of the assignment operation
+BLAZE_ALWAYS_INLINE EnableIf_t< !SIMD >
+   arrayRowAssign( IT1 left, IT2 right, size_t n, OP op )
+{
+   for( size_t j=0UL; j<n; ++j, ++left, ++right ) {
+      *left = op( *left, *right );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD kernel for the (compound) assignment of a single row segment.
+// \ingroup smp
+//
+// \param left Iterator to the first element of the left-hand side row segment.
+// \param right Iterator to the first element of the right-hand side row segment.
+// \param n The number of elements in the row segment.
+// \param op The (compound) assignment operation.
+// \return void
+//
+// The row segment is required to start at a multiple of the SIMD size of the element type.
+*/
+template< bool SIMD        // Compile time switch for the SIMD kernel
+        , typename IT1     // Type of the left-hand side iterator
+        , typename IT2     // Type of the right-hand side iterator
+        , typename OP >    // Type of the assignment operation
+BLAZE_ALWAYS_INLINE EnableIf_t< SIMD >
+   arrayRowAssign( IT1 left, IT2 right, size_t n, OP op )
+{
+   constexpr size_t SIMDSIZE( SIMDTrait< RemoveCV_t< typename IT1::ValueType > >::size );
+
+   const size_t jpos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   size_t j( 0UL );
+
+   for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+      left.store( op.load( left.load(), right.load() ) ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( op.load( left.load(), right.load() ) ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( op.load( left.load(), right.load() ) ); left += SIMDSIZE; right += SIMDSIZE;
+      left.store( op.load( left.load(), right.load() ) ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; j<jpos; j+=SIMDSIZE, left+=SIMDSIZE, right+=SIMDSIZE ) {
+      left.store( op.load( left.load(), right.load() ) );
+   }
+   for( ; j<n; ++j, ++left, ++right ) {
+      *left = op( *left, *right );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time check whether a block assignment can be vectorized.
+// \ingroup smp
+*/
+template< typename TT1   // Type of the left-hand side dense array
+        , typename TT2   // Type of the right-hand side dense array
+        , typename OP >  // Type of the assignment operation
+constexpr bool IsArrayBlockVectorizable_v =
+   ( TT1::simdEnabled && TT2::simdEnabled &&
+     IsSIMDCombinable_v< ElementType_t<TT1>, ElementType_t<TT2> > &&
+     OP::template simdEnabled< ElementType_t<TT1>, ElementType_t<TT2> >() );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief (Compound) assignment of a block of a dense array to the same block of a dense array.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense array.
+// \param rhs The right-hand side dense array to be assigned.
+// \param page The first flattened page of the block.
+// \param row The first row of the block.
+// \param column The first column of the block.
+// \param o The number of flattened pages of the block.
+// \param m The number of rows of the block.
+// \param n The number of columns of the block.
+// \param op The (compound) assignment operation.
+// \return void
+//
+// This function performs the given (compound) assignment for the given block of the arrays.
+// All dimensions beyond the rows are treated as a single flattened page dimension (see
+// getArrayPages()). In case \a column is a multiple of the SIMD size the block is evaluated
+// by means of SIMD operations.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename TT1   // Type of the left-hand side dense array
+        , typename TT2   // Type of the right-hand side dense array
+        , typename OP >  // Type of the assignment operation
+void arrayBlockAssign( DenseArray<TT1>& lhs, const DenseArray<TT2>& rhs,
+                       size_t page, size_t row, size_t column,
+                       size_t o, size_t m, size_t n, OP op )
+{
+   constexpr bool simdEnabled( IsArrayBlockVectorizable_v<TT1,TT2,OP> );
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_t<TT1> >::size );
+
+   const auto& dims( (~rhs).dimensions() );
+
+   BLAZE_INTERNAL_ASSERT( page + o <= getArrayPages( dims ), "Invalid page range"   );
+   BLAZE_INTERNAL_ASSERT( row + m <= dims[1]               , "Invalid row range"    );
+   BLAZE_INTERNAL_ASSERT( column + n <= dims[0]            , "Invalid column range" );
+
+   const bool vectorize( simdEnabled && column % SIMDSIZE == 0UL );
+
+   for( size_t k=page; k<page+o; ++k ) {
+      for( size_t i=row; i<row+m; ++i )
+      {
+         const auto indices( getArrayRowIndices( dims, k, i ) );
+
+         auto left ( ArrayRowBegin( ~lhs, indices ) + column );
+         auto right( ArrayRowBegin( ~rhs, indices ) + column );
+
+         if( vectorize )
+            arrayRowAssign<simdEnabled>( left, right, n, op );
+         else
+            arrayRowAssign<false>( left, right, n, op );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief (Compound) assignment of a dense array block to a dense array block.
+// \ingroup smp
+//
+// \param lhs The target left-hand side block.
+// \param rhs The right-hand side block to be assigned.
+// \param op The (compound) assignment operation.
+// \return void
+//
+// This function performs the given (compound) assignment for the block represented by \a lhs.
+// Both blocks are required to cover the same pages, rows and columns.
+*/
+template< typename TT1   // Type of the left-hand side dense array
+        , typename TT2   // Type of the right-hand side dense array
+        , typename OP >  // Type of the assignment operation
+inline void arrayBlockAssign( ArrayBlock<TT1>& lhs, const ArrayBlock<TT2>& rhs, OP op )
+{
+   BLAZE_INTERNAL_ASSERT( lhs.page()   == rhs.page()  , "Invalid page offset"   );
+   BLAZE_INTERNAL_ASSERT( lhs.row()    == rhs.row()   , "Invalid row offset"    );
+   BLAZE_INTERNAL_ASSERT( lhs.column() == rhs.column(), "Invalid column offset" );
+
+   arrayBlockAssign( lhs.operand(), rhs.operand(), lhs.page(), lhs.row(), lhs.column(),
+                     lhs.pages(), lhs.rows(), lhs.columns(), op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -108,6 +108,99 @@ ThreadMapping createThreadMapping( size_t threads, const Tensor<MT>& A )
 /*! \endcond */
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief 3D mapping of threads onto the pages, rows and columns of a tensor.
+// \ingroup smp
+*/
+using TensorThreadMapping = std::tuple< size_t, size_t, size_t >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a 3D mapping of threads for a block of the given extents.
+// \ingroup smp
+//
+// \param threads The total number of threads to be mapped.
+// \param pages The number of pages to be partitioned.
+// \param rows The number of rows to be partitioned.
+// \param columns The number of columns to be partitioned.
+// \param simdsize The granularity of the column split (i.e. the SIMD size of the element type).
+// \return 3D mapping of the given number of threads.
+//
+// This function creates a 3D mapping of the given number of threads for a \a pages x \a rows x
+// \a columns block, such that every thread is assigned a single contiguous sub-block. Among all
+// factorizations of \a threads into page, row and column splits the mapping with the smallest
+// largest block is selected, whereby columns are only split into multiples of \a simdsize. In
+// case several mappings result in the same block size, page splits are preferred over row splits
+// and row splits over column splits, since they result in larger contiguous memory regions per
+// thread.
+*/
+inline TensorThreadMapping createTensorThreadMapping( size_t threads, size_t pages, size_t rows,
+                                                      size_t columns, size_t simdsize = 1UL )
+{
+   const size_t O( pages );
+   const size_t M( rows );
+   const size_t N( ( columns + simdsize - 1UL ) / simdsize );
+
+   threads = max( threads, 1UL );
+
+   TensorThreadMapping mapping( 1UL, 1UL, threads );
+   size_t minBlockSize( ~size_t(0) );
+
+   for( size_t o=threads; o>0UL; --o )
+   {
+      if( threads % o != 0UL )
+         continue;
+
+      for( size_t m=threads/o; m>0UL; --m )
+      {
+         if( ( threads / o ) % m != 0UL )
+            continue;
+
+         const size_t n( threads / ( o*m ) );
+
+         const size_t blockSize( ( ( O + o - 1UL ) / o ) *
+                                 ( ( M + m - 1UL ) / m ) *
+                                 ( ( N + n - 1UL ) / n ) );
+
+         if( blockSize < minBlockSize ) {
+            minBlockSize = blockSize;
+            mapping = TensorThreadMapping( o, m, n );
+         }
+      }
+   }
+
+   return mapping;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a 3D mapping of threads.
+// \ingroup smp
+//
+// \param threads The total number of threads to be mapped.
+// \param A The tensor the mapping is created for.
+// \param simdsize The granularity of the column split (i.e. the SIMD size of the element type).
+// \return 3D mapping of the given number of threads.
+//
+// This function creates a 3D mapping of the given number of threads for the given tensor \a A,
+// such that every thread is assigned a single contiguous subtensor (see the extent-based
+// overload of createTensorThreadMapping() for details).
+*/
+template< typename MT >  // Type of the tensor
+TensorThreadMapping createTensorThreadMapping( size_t threads, const Tensor<MT>& A, size_t simdsize = 1UL )
+{
+   return createTensorThreadMapping( threads, (~A).pages(), (~A).rows(), (~A).columns(), simdsize );
+}
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -41,6 +41,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/Aliases.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
@@ -48,6 +49,7 @@
 #include <blaze/util/StaticAssert.h>
 
 #include <blaze_tensor/math/expressions/Array.h>
+#include <blaze_tensor/math/expressions/DenseArray.h>
 #include <blaze_tensor/math/typetraits/IsDenseArray.h>
 
 namespace blaze {
@@ -76,6 +78,12 @@ inline EnableIf_t< IsDenseArray_v<TT1> >
 template< typename TT1, typename TT2 >
 inline EnableIf_t< IsDenseArray_v<TT1> >
    smpSchurAssign( Array<TT1>& lhs, const Array<TT2>& rhs );
+
+template< typename TT, typename OP >
+inline ElementType_t<TT> smpReduce( const DenseArray<TT>& dm, OP op );
+
+template< typename TT, typename Abs, typename Power, typename Root >
+inline decltype(auto) smpNorm( const DenseArray<TT>& dm, Abs abs, Power power, Root root );
 //@}
 //*************************************************************************************************
 
@@ -232,6 +240,68 @@ inline EnableIf_t< IsDenseArray_v<AT1> >
 
 
 
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP reduction of a dense array.
+// \ingroup smp
+//
+// \param dm The dense array to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default SMP reduction of a dense array.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename TT    // Type of the dense array
+        , typename OP >  // Type of the reduction operation
+inline ElementType_t<TT> smpReduce( const DenseArray<TT>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return darrayreduce( ~dm, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP norm computation of a dense array.
+// \ingroup smp
+//
+// \param dm The dense array for the norm computation.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \param root The functor for the root operation.
+// \return The norm of the given dense array.
+//
+// This function implements the default SMP norm computation of a dense array.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// norm() function family.
+*/
+template< typename TT      // Type of the dense array
+        , typename Abs     // Type of the abs operation
+        , typename Power   // Type of the power operation
+        , typename Root >  // Type of the root operation
+inline decltype(auto) smpNorm( const DenseArray<TT>& dm, Abs abs, Power power, Root root )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return darraynorm( ~dm, abs, power, root );
+}
+//*************************************************************************************************
+
+
+
+
 
 //=================================================================================================
 //
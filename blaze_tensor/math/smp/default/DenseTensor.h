@@ -41,12 +41,14 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/Aliases.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/StaticAssert.h>
 
+#include <blaze_tensor/math/expressions/DenseTensor.h>
 #include <blaze_tensor/math/expressions/Tensor.h>
 #include <blaze_tensor/math/typetraits/IsDenseTensor.h>
 
@@ -76,6 +78,9 @@ inline EnableIf_t< IsDenseTensor_v<TT1> >
 template< typename TT1, typename TT2 >
 inline EnableIf_t< IsDenseTensor_v<TT1> >
    smpSchurAssign( Tensor<TT1>& lhs, const Tensor<TT2>& rhs );
+
+template< typename TT, typename OP >
+inline ElementType_t<TT> smpReduce( const DenseTensor<TT>& dm, OP op );
 //@}
 //*************************************************************************************************
 
@@ -240,6 +245,31 @@ inline EnableIf_t< IsDenseTensor_v<MT1> >
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP reduction of a dense tensor.
+// \ingroup smp
+//
+// \param dm The dense tensor to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default SMP reduction of a dense tensor.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename TT    // Type of the dense tensor
+        , typename OP >  // Type of the reduction operation
+inline ElementType_t<TT> smpReduce( const DenseTensor<TT>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dtensreduce( ~dm, op );
+}
+//*************************************************************************************************
+
+
 
 
 
@@ -48,12 +48,14 @@
 #include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/constraints/SMPAssignable.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/shims/Evaluate.h>
 #include <blaze/math/simd/SIMDTrait.h>
 #include <blaze/math/smp/Functions.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
 #include <blaze/math/typetraits/IsSMPAssignable.h>
-#include <blaze/math/views/Submatrix.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
@@ -61,13 +63,14 @@
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/algorithms/Min.h>
+#include <tuple>
 
 #include <blaze_tensor/config/HPX.h>
 #include <blaze_tensor/math/expressions/DenseArray.h>
-#include <blaze_tensor/math/smp/ArrayThreadMapping.h>
+#include <blaze_tensor/math/smp/ArrayBlockAssign.h>
+#include <blaze_tensor/math/smp/TensorThreadMapping.h>
 #include <blaze_tensor/math/typetraits/IsDenseArray.h>
-#include <blaze_tensor/math/views/QuatSlice.h>
-// #include <blaze_tensor/math/views/ArraySlice.h>
+#include <blaze_tensor/system/Thresholds.h>
 
 namespace blaze {
 
@@ -104,20 +107,18 @@ void hpxAssign( DenseArray<TT1>& lhs, const DenseArray<TT2>& rhs, OP op )
 
    BLAZE_FUNCTION_TRACE;
 
-   using ET1 = ElementType_t<TT1>;
-   using ET2 = ElementType_t<TT2>;
-
-   constexpr bool simdEnabled( TT1::simdEnabled && TT2::simdEnabled && IsSIMDCombinable_v<ET1,ET2> );
+   constexpr bool simdEnabled( IsArrayBlockVectorizable_v<TT1,TT2,OP> );
    constexpr size_t SIMDSIZE( SIMDTrait< ElementType_t<TT1> >::size );
 
-   const bool lhsAligned( (~lhs).isAligned() );
-   const bool rhsAligned( (~rhs).isAligned() );
+   const auto& dims( (~rhs).dimensions() );
+
+   const size_t pages  ( getArrayPages( dims ) );
+   const size_t rows   ( dims[1] );
+   const size_t columns( dims[0] );
 
-   const size_t pages = (~rhs).template dimension<2>();
-   const size_t rows  = (~rhs).template dimension<1>();
-   const size_t columns = (~rhs).template dimension<0>();
+   if( pages == 0UL || rows == 0UL || columns == 0UL )
+      return;
 
-   const size_t threads    ( getNumThreads() );
    const size_t numPages( min( static_cast<std::size_t>( BLAZE_HPX_TENSOR_BLOCK_SIZE_PAGE ), pages ) );
    const size_t numRows ( min( static_cast<std::size_t>( BLAZE_HPX_TENSOR_BLOCK_SIZE_ROW ),  rows ) );
    const size_t numCols ( min( static_cast<std::size_t>( BLAZE_HPX_TENSOR_BLOCK_SIZE_COLUMN ), columns ) );
@@ -137,46 +138,21 @@ void hpxAssign( DenseArray<TT1>& lhs, const DenseArray<TT2>& rhs, OP op )
 
    hpx::parallel::execution::dynamic_chunk_size chunkSize ( BLAZE_HPX_TENSOR_CHUNK_SIZE );
 
-   //for_loop( par.with( chunkSize ), size_t(0), equalShare0 * equalShare1 * equalShare2, [&](size_t i)
-   //{
-   //   //const size_t page  ( ( i / (equalShare1 * equalShare2 )) * pagesPerIter );
-   //   const size_t row   ( ( i / equalShare2 ) * rowsPerIter );
-   //   const size_t column( ( i % equalShare2 ) * colsPerIter );
-
-   //   if( page >= pages || row >= rows || column >= columns )
-   //      return;
-
-   //    for (size_t k = 0; k != (~rhs).quats(); ++k)
-   //    {
-   //       const size_t o( min( pagesPerIter, pages   - page    ) );
-   //       const size_t m( min( rowsPerIter,  rows    - row    ) );
-   //       const size_t n( min( colsPerIter,  columns - column ) );
-
-   //       auto lhs_slice = quatslice( ~lhs, k );
-   //       auto rhs_slice = quatslice( ~rhs, k );
-
-   //       if( simdEnabled && lhsAligned && rhsAligned ) {
-   //          auto       target( subtensor  ( ~lhs_slice, page, row, column, o, m, n ) );
-   //          const auto source( subtensor  ( ~rhs_slice, page, row, column, o, m, n ) );
-   //          op( target, source );
-   //       }
-   //       else if( simdEnabled && lhsAligned ) {
-   //          auto       target( subtensor  ( ~lhs_slice, page, row, column, o, m, n ) );
-   //          const auto source( subtensor  ( ~rhs_slice, page, row, column, o, m, n ) );
-   //          op( target, source );
-   //       }
-   //       else if( simdEnabled && rhsAligned ) {
-   //          auto       target( subtensor  ( ~lhs_slice, page, row, column, o, m, n ) );
-   //          const auto source( subtensor  ( ~rhs_slice, page, row, column, o, m, n ) );
-   //          op( target, source );
-   //       }
-   //       else {
-   //          auto       target( subtensor  ( ~lhs_slice, page, row, column, o, m, n ));
-   //          const auto source( subtensor  ( ~rhs_slice, page, row, column, o, m, n ));
-   //          op(target, source);
-   //       }
-   //    }
-   //} );
+   for_loop( par.with( chunkSize ), size_t(0), equalShare0 * equalShare1 * equalShare2, [&](size_t i)
+   {
+      const size_t page  ( ( i / ( equalShare1 * equalShare2 ) ) * pagesPerIter );
+      const size_t row   ( ( ( i / equalShare2 ) % equalShare1 ) * rowsPerIter );
+      const size_t column( ( i % equalShare2 ) * colsPerIter );
+
+      if( page >= pages || row >= rows || column >= columns )
+         return;
+
+      const size_t o( min( pagesPerIter, pages   - page   ) );
+      const size_t m( min( rowsPerIter,  rows    - row    ) );
+      const size_t n( min( colsPerIter,  columns - column ) );
+
+      arrayBlockAssign( ~lhs, ~rhs, page, row, column, o, m, n, op );
+   } );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -257,7 +233,7 @@ inline EnableIf_t< IsDenseArray_v<TT1> && IsSMPAssignable_v<TT1> && IsSMPAssigna
       assign( ~lhs, ~rhs );
    }
    else {
-      hpxAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ assign( a, b ); } );
+      hpxAssign( ~lhs, ~rhs, ArrayBlockCopy() );
    }
 }
 /*! \endcond */
@@ -339,7 +315,7 @@ inline EnableIf_t< IsDenseArray_v<TT1> && IsSMPAssignable_v<TT1> && IsSMPAssigna
       addAssign( ~lhs, ~rhs );
    }
    else {
-      hpxAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ addAssign( a, b ); } );
+      hpxAssign( ~lhs, ~rhs, Add() );
    }
 }
 /*! \endcond */
@@ -421,7 +397,7 @@ inline EnableIf_t< IsDenseArray_v<TT1> && IsSMPAssignable_v<TT1> && IsSMPAssigna
       subAssign( ~lhs, ~rhs );
    }
    else {
-      hpxAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ subAssign( a, b ); } );
+      hpxAssign( ~lhs, ~rhs, Sub() );
    }
 }
 /*! \endcond */
@@ -503,7 +479,7 @@ inline EnableIf_t< IsDenseArray_v<TT1> && IsSMPAssignable_v<TT1> && IsSMPAssigna
       schurAssign( ~lhs, ~rhs );
    }
    else {
-      hpxAssign( ~lhs, ~rhs, []( auto& a, const auto& b ){ schurAssign( a, b ); } );
+      hpxAssign( ~lhs, ~rhs, Mult() );
    }
 }
 /*! \endcond */
@@ -551,6 +527,201 @@ inline EnableIf_t< IsDenseArray_v<TT1> >
 
 
 
+//=================================================================================================
+//
+//  HPX-BASED REDUCTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the HPX-based SMP reductions of a dense array.
+// \ingroup math
+//
+// \param dm The dense array to be reduced.
+// \param kernel The reduction kernel for a single block of the array.
+// \param op The operation to combine the partial results.
+// \return The combined result of all blocks.
+//
+// This function is the backend implementation of the HPX-based SMP reductions of a dense array.
+// All dimensions beyond the rows are flattened into a single page dimension (see getArrayPages())
+// and the array is partitioned into SIMD-aligned blocks of pages, rows and columns (see
+// createTensorThreadMapping()). Each block is reduced by a single thread by means of the given
+// \a kernel, and the partial results are combined afterwards by means of \a op.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() or norm() functions.
+*/
+template< typename MT    // Type of the dense array
+        , typename KT    // Type of the block reduction kernel
+        , typename OP >  // Type of the combining operation
+ElementType_t<MT> hpxReduce( const DenseArray<MT>& dm, KT kernel, OP op )
+{
+   using hpx::parallel::for_loop;
+   using hpx::parallel::execution::par;
+
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<MT>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const auto& dims( (~dm).dimensions() );
+
+   const size_t pages  ( getArrayPages( dims ) );
+   const size_t rows   ( dims[1] );
+   const size_t columns( dims[0] );
+
+   const TensorThreadMapping threads(
+      createTensorThreadMapping( getNumThreads(), pages, rows, columns, SIMDSIZE ) );
+
+   const size_t addon0        ( ( ( pages % std::get<0>( threads ) ) != 0UL )? 1UL : 0UL );
+   const size_t pagesPerThread( pages / std::get<0>( threads ) + addon0 );
+
+   const size_t addon1       ( ( ( rows % std::get<1>( threads ) ) != 0UL )? 1UL : 0UL );
+   const size_t rowsPerThread( rows / std::get<1>( threads ) + addon1 );
+
+   const size_t addon2     ( ( ( columns % std::get<2>( threads ) ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( columns / std::get<2>( threads ) + addon2 );
+   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
+   const size_t colsPerThread( ( rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+
+   const size_t pageBlocks( ( pages   + pagesPerThread - 1UL ) / pagesPerThread );
+   const size_t rowBlocks ( ( rows    + rowsPerThread  - 1UL ) / rowsPerThread  );
+   const size_t colBlocks ( ( columns + colsPerThread  - 1UL ) / colsPerThread  );
+   const size_t blocks    ( pageBlocks * rowBlocks * colBlocks );
+
+   DynamicVector<ET> partials( blocks );
+
+   for_loop( par, size_t(0), blocks, [&](size_t b)
+   {
+      const size_t page  ( ( b / ( rowBlocks * colBlocks ) ) * pagesPerThread );
+      const size_t row   ( ( ( b / colBlocks ) % rowBlocks ) * rowsPerThread );
+      const size_t column( ( b % colBlocks ) * colsPerThread );
+
+      const size_t o( min( pagesPerThread, pages   - page   ) );
+      const size_t m( min( rowsPerThread,  rows    - row    ) );
+      const size_t n( min( colsPerThread,  columns - column ) );
+
+      partials[b] = kernel( ~dm, page, row, column, o, m, n );
+   } );
+
+   ET redux( partials[0UL] );
+   for( size_t b=1UL; b<blocks; ++b ) {
+      redux = op( redux, partials[b] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the HPX-based SMP reduction of a dense array.
+// \ingroup smp
+//
+// \param dm The dense array to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the HPX-based SMP reduction of a dense array. In case the array has
+// less than SMP_DARRREDUCE_THRESHOLD elements or in case a serial section is active, the
+// reduction is performed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense array
+        , typename OP >  // Type of the reduction operation
+inline ElementType_t<MT> smpReduce( const DenseArray<MT>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using CT = CompositeType_t<MT>;
+
+   const auto& dims( (~dm).dimensions() );
+   const size_t size( getArrayPages( dims ) * dims[1] * dims[0] );
+
+   if( isSerialSectionActive() || size == 0UL || size < SMP_DARRREDUCE_THRESHOLD ) {
+      return darrayreduce( ~dm, op );
+   }
+
+   CT tmp( ~dm );
+
+   return hpxReduce( tmp, [op]( const auto& array, size_t page, size_t row, size_t column,
+                                size_t o, size_t m, size_t n ) {
+      return darrayreduce( array, page, row, column, o, m, n, op );
+   }, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the HPX-based SMP norm computation of a dense array.
+// \ingroup smp
+//
+// \param dm The dense array for the norm computation.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \param root The functor for the root operation.
+// \return The norm of the given dense array.
+//
+// This function implements the HPX-based SMP norm computation of a dense array. Every thread
+// accumulates the powers of the absolute values of its block, the root is applied to the sum of
+// all partial results. In case the array has less than SMP_DARRREDUCE_THRESHOLD elements or in
+// case a serial section is active, the norm is computed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// norm() function family.
+*/
+template< typename MT      // Type of the dense array
+        , typename Abs     // Type of the abs operation
+        , typename Power   // Type of the power operation
+        , typename Root >  // Type of the root operation
+inline decltype(auto) smpNorm( const DenseArray<MT>& dm, Abs abs, Power power, Root root )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using CT = CompositeType_t<MT>;
+   using ET = ElementType_t<MT>;
+
+   const auto& dims( (~dm).dimensions() );
+   const size_t size( getArrayPages( dims ) * dims[1] * dims[0] );
+
+   if( isSerialSectionActive() || size == 0UL || size < SMP_DARRREDUCE_THRESHOLD ) {
+      return darraynorm( ~dm, abs, power, root );
+   }
+
+   CT tmp( ~dm );
+
+   const ET norm( hpxReduce( tmp, [abs,power]( const auto& array, size_t page, size_t row,
+                                               size_t column, size_t o, size_t m, size_t n ) {
+      return darraynorm( array, page, row, column, o, m, n, abs, power );
+   }, Add() ) );
+
+   return evaluate( root( norm ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
@@ -48,6 +48,7 @@
 #include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/constraints/SMPAssignable.h>
+#include <blaze/math/dense/DynamicVector.h>
 #include <blaze/math/simd/SIMDTrait.h>
 #include <blaze/math/smp/Functions.h>
 #include <blaze/math/smp/SerialSection.h>
@@ -67,6 +68,8 @@
 #include <blaze_tensor/math/smp/TensorThreadMapping.h>
 #include <blaze_tensor/math/typetraits/IsDenseTensor.h>
 #include <blaze_tensor/math/views/PageSlice.h>
+#include <blaze_tensor/math/views/Subtensor.h>
+#include <blaze_tensor/system/Thresholds.h>
 
 namespace blaze {
 
@@ -557,6 +560,139 @@ inline EnableIf_t< IsDenseTensor_v<TT1> >
 
 
 
+//=================================================================================================
+//
+//  HPX-BASED REDUCTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the HPX-based SMP reduction of a dense tensor.
+// \ingroup math
+//
+// \param dm The dense tensor to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function is the backend implementation of the HPX-based SMP reduction of a dense
+// tensor. The tensor is partitioned into SIMD-aligned subtensors (see createTensorThreadMapping()),
+// each of which is reduced by a single thread. The partial results are combined afterwards.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense tensor
+        , typename OP >  // Type of the reduction operation
+ElementType_t<MT> hpxReduce( const DenseTensor<MT>& dm, OP op )
+{
+   using hpx::parallel::for_loop;
+   using hpx::parallel::execution::par;
+
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<MT>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const size_t pages  ( (~dm).pages()   );
+   const size_t rows   ( (~dm).rows()    );
+   const size_t columns( (~dm).columns() );
+
+   const TensorThreadMapping threads( createTensorThreadMapping( getNumThreads(), ~dm, SIMDSIZE ) );
+
+   const size_t addon0        ( ( ( pages % std::get<0>( threads ) ) != 0UL )? 1UL : 0UL );
+   const size_t pagesPerThread( pages / std::get<0>( threads ) + addon0 );
+
+   const size_t addon1       ( ( ( rows % std::get<1>( threads ) ) != 0UL )? 1UL : 0UL );
+   const size_t rowsPerThread( rows / std::get<1>( threads ) + addon1 );
+
+   const size_t addon2     ( ( ( columns % std::get<2>( threads ) ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( columns / std::get<2>( threads ) + addon2 );
+   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
+   const size_t colsPerThread( ( rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+
+   const size_t pageBlocks( ( pages   + pagesPerThread - 1UL ) / pagesPerThread );
+   const size_t rowBlocks ( ( rows    + rowsPerThread  - 1UL ) / rowsPerThread  );
+   const size_t colBlocks ( ( columns + colsPerThread  - 1UL ) / colsPerThread  );
+   const size_t blocks    ( pageBlocks * rowBlocks * colBlocks );
+
+   DynamicVector<ET> partials( blocks );
+
+   for_loop( par, size_t(0), blocks, [&](size_t b)
+   {
+      const size_t page  ( ( b / ( rowBlocks * colBlocks ) ) * pagesPerThread );
+      const size_t row   ( ( ( b / colBlocks ) % rowBlocks ) * rowsPerThread );
+      const size_t column( ( b % colBlocks ) * colsPerThread );
+
+      const size_t o( min( pagesPerThread, pages   - page   ) );
+      const size_t m( min( rowsPerThread,  rows    - row    ) );
+      const size_t n( min( colsPerThread,  columns - column ) );
+
+      partials[b] = dtensreduce( subtensor( ~dm, page, row, column, o, m, n, unchecked ), op );
+   } );
+
+   ET redux( partials[0UL] );
+   for( size_t b=1UL; b<blocks; ++b ) {
+      redux = op( redux, partials[b] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the HPX-based SMP reduction of a dense tensor.
+// \ingroup smp
+//
+// \param dm The dense tensor to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the HPX-based SMP reduction of a dense tensor. In case the tensor
+// has less than SMP_DTENSREDUCE_THRESHOLD elements or in case a serial section is active, the
+// reduction is performed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense tensor
+        , typename OP >  // Type of the reduction operation
+inline ElementType_t<MT> smpReduce( const DenseTensor<MT>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using CT = CompositeType_t<MT>;
+
+   const size_t size( (~dm).pages() * (~dm).rows() * (~dm).columns() );
+
+   if( isSerialSectionActive() || size == 0UL || size < SMP_DTENSREDUCE_THRESHOLD ) {
+      return dtensreduce( ~dm, op );
+   }
+
+   CT tmp( ~dm );
+
+   return hpxReduce( tmp, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
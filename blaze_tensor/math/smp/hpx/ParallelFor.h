@@ -0,0 +1,137 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/smp/hpx/ParallelFor.h
+//  \brief Header file for the HPX-based SMP loop over independent slices
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_SMP_HPX_PARALLELFOR_H_
+#define _BLAZE_TENSOR_MATH_SMP_HPX_PARALLELFOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <hpx/include/parallel_for_loop.hpp>
+
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/algorithms/Min.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief HPX-based implementation of the SMP loop over independent slices.
+// \ingroup smp
+//
+// \param n The number of slices.
+// \param parallel \a true in case the slices should be processed in parallel.
+// \param op The slice operation, which is called with the first and one past the last slice.
+// \return void
+//
+// This function implements the HPX-based SMP loop over \a n independent slices. The range
+// \f$ [0..n) \f$ is split into one contiguous chunk per HPX worker thread and \a op is called
+// once per chunk, such that \a op can set up thread-local buffers once for all of its slices.
+// In case \a parallel is \a false or in case a serial or parallel section is active, \a op is
+// called once for the complete range. Since \a op is executed within a parallel section, it
+// must only perform serial operations (see the serial() function).\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of slice-wise kernels.
+*/
+template< typename OP >  // Type of the slice operation
+void smpFor( size_t n, bool parallel, OP op )
+{
+   using hpx::parallel::for_loop;
+   using hpx::parallel::execution::par;
+
+   BLAZE_FUNCTION_TRACE;
+
+   if( n == 0UL )
+      return;
+
+   if( !parallel || isSerialSectionActive() || isParallelSectionActive() ) {
+      op( size_t(0), n );
+      return;
+   }
+
+   const size_t threads( getNumThreads() );
+   const size_t addon  ( ( ( n % threads ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerThread( n / threads + addon );
+   const size_t chunks( ( n + sizePerThread - 1UL ) / sizePerThread );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      for_loop( par, size_t(0), chunks, [&](size_t c)
+      {
+         const size_t begin( c * sizePerThread );
+         op( begin, min( begin + sizePerThread, n ) );
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_HPX_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,790 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/smp/threads/DenseArray.h
+//  \brief Header file for the C++11/Boost thread-based dense array SMP implementation
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_SMP_THREADS_DENSEARRAY_H_
+#define _BLAZE_TENSOR_MATH_SMP_THREADS_DENSEARRAY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/SMPAssignable.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/shims/Evaluate.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/ThreadMapping.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/algorithms/Min.h>
+#include <tuple>
+
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/smp/ArrayBlockAssign.h>
+#include <blaze_tensor/math/smp/TensorThreadMapping.h>
+#include <blaze_tensor/math/typetraits/IsDenseArray.h>
+#include <blaze_tensor/system/Thresholds.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  THREAD-BASED ASSIGNMENT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP (compound) assignment of a dense array to a
+//        dense array.
+// \ingroup math
+//
+// \param lhs The target left-hand side dense array.
+// \param rhs The right-hand side dense array to be assigned.
+// \param op The (compound) assignment operation.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment of a
+// dense array to a dense array. The (flattened) pages, rows and columns of the arrays are
+// partitioned according to the 3D thread mapping and every thread evaluates a single block.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename TT1   // Type of the left-hand side dense array
+        , typename TT2   // Type of the right-hand side dense array
+        , typename OP >  // Type of the assignment operation
+void threadAssign( DenseArray<TT1>& lhs, const DenseArray<TT2>& rhs, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   constexpr bool simdEnabled( IsArrayBlockVectorizable_v<TT1,TT2,OP> );
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_t<TT1> >::size );
+
+   const auto& dims( (~rhs).dimensions() );
+
+   const size_t pages  ( getArrayPages( dims ) );
+   const size_t rows   ( dims[1] );
+   const size_t columns( dims[0] );
+
+   const TensorThreadMapping threads(
+      createTensorThreadMapping( TheThreadBackend::size(), pages, rows, columns,
+                                 ( simdEnabled )?( SIMDSIZE ):( 1UL ) ) );
+
+   const size_t addon0        ( ( ( pages % std::get<0>( threads ) ) != 0UL )? 1UL : 0UL );
+   const size_t pagesPerThread( pages / std::get<0>( threads ) + addon0 );
+
+   const size_t addon1       ( ( ( rows % std::get<1>( threads ) ) != 0UL )? 1UL : 0UL );
+   const size_t rowsPerThread( rows / std::get<1>( threads ) + addon1 );
+
+   const size_t addon2     ( ( ( columns % std::get<2>( threads ) ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( columns / std::get<2>( threads ) + addon2 );
+   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
+   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+
+   for( size_t k=0UL; k<std::get<0>( threads ); ++k )
+   {
+      const size_t page( k*pagesPerThread );
+
+      if( page >= pages )
+         continue;
+
+      for( size_t i=0UL; i<std::get<1>( threads ); ++i )
+      {
+         const size_t row( i*rowsPerThread );
+
+         if( row >= rows )
+            continue;
+
+         for( size_t j=0UL; j<std::get<2>( threads ); ++j )
+         {
+            const size_t column( j*colsPerThread );
+
+            if( column >= columns )
+               continue;
+
+            const size_t o( min( pagesPerThread, pages   - page   ) );
+            const size_t m( min( rowsPerThread,  rows    - row    ) );
+            const size_t n( min( colsPerThread,  columns - column ) );
+
+            ArrayBlock<TT1>             target( ~lhs, page, row, column, o, m, n );
+            const ArrayBlock<const TT2> source( ~rhs, page, row, column, o, m, n );
+            TheThreadBackend::schedule( target, source, [op]( auto& a, const auto& b ){
+               arrayBlockAssign( a, b, op );
+            } );
+         }
+      }
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PLAIN ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP assignment to a dense array.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense array.
+// \param rhs The right-hand side array to be assigned.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP assignment to a dense array.
+// Due to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case both operands are SMP-assignable and the element types of both operands are
+// not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename TT1  // Type of the left-hand side dense array
+        , typename TT2 > // Type of the right-hand side array
+inline EnableIf_t< IsDenseArray_v<TT1> && ( !IsSMPAssignable_v<TT1> || !IsSMPAssignable_v<TT2> ) >
+   smpAssign( Array<TT1>& lhs, const Array<TT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == (~rhs).dimensions()   , "Invalid array sizes"    );
+
+   assign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP assignment to a dense array.
+// \ingroup math
+//
+// \param lhs The target left-hand side dense array.
+// \param rhs The right-hand side array to be assigned.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP assignment to a dense array. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case both operands are SMP-assignable and the element types of both operands
+// are not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename TT1  // Type of the left-hand side dense array
+        , typename TT2 > // Type of the right-hand side array
+inline EnableIf_t< IsDenseArray_v<TT1> && IsSMPAssignable_v<TT1> && IsSMPAssignable_v<TT2> >
+   smpAssign( Array<TT1>& lhs, const Array<TT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<TT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<TT2> );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == (~rhs).dimensions()   , "Invalid array sizes"    );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         assign( ~lhs, ~rhs );
+      }
+      else {
+         threadAssign( ~lhs, ~rhs, ArrayBlockCopy() );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDITION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP addition assignment to a dense
+//        array.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense array.
+// \param rhs The right-hand side array to be added.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP addition assignment to a dense
+// array. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case both operands are SMP-assignable and the element types of both
+// operands are not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename TT1  // Type of the left-hand side dense array
+        , typename TT2 > // Type of the right-hand side array
+inline EnableIf_t< IsDenseArray_v<TT1> && ( !IsSMPAssignable_v<TT1> || !IsSMPAssignable_v<TT2> ) >
+   smpAddAssign( Array<TT1>& lhs, const Array<TT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == (~rhs).dimensions()   , "Invalid array sizes"    );
+
+   addAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP addition assignment to a dense array.
+// \ingroup math
+//
+// \param lhs The target left-hand side dense array.
+// \param rhs The right-hand side array to be added.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP addition assignment to a dense array.
+// Due to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case both operands are SMP-assignable and the element types of both operands are
+// not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename TT1  // Type of the left-hand side dense array
+        , typename TT2 > // Type of the right-hand side array
+inline EnableIf_t< IsDenseArray_v<TT1> && IsSMPAssignable_v<TT1> && IsSMPAssignable_v<TT2> >
+   smpAddAssign( Array<TT1>& lhs, const Array<TT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<TT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<TT2> );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == (~rhs).dimensions()   , "Invalid array sizes"    );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         addAssign( ~lhs, ~rhs );
+      }
+      else {
+         threadAssign( ~lhs, ~rhs, Add() );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRACTION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP subtracction assignment to a
+//        dense array.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense array.
+// \param rhs The right-hand side array to be subtracted.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP subtraction assignment to a
+// dense array. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case both operands are SMP-assignable and the element types of both
+// operands are not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename TT1  // Type of the left-hand side dense array
+        , typename TT2 > // Type of the right-hand side array
+inline EnableIf_t< IsDenseArray_v<TT1> && ( !IsSMPAssignable_v<TT1> || !IsSMPAssignable_v<TT2> ) >
+   smpSubAssign( Array<TT1>& lhs, const Array<TT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == (~rhs).dimensions()   , "Invalid array sizes"    );
+
+   subAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP subtracction assignment to a dense
+//        array.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense array.
+// \param rhs The right-hand side array to be subtracted.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP subtraction assignment of a
+// array to a dense array. Due to the explicit application of the SFINAE principle, this function
+// can only be selected by the compiler in case both operands are SMP-assignable and the element
+// types of both operands are not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename TT1  // Type of the left-hand side dense array
+        , typename TT2 > // Type of the right-hand side array
+inline EnableIf_t< IsDenseArray_v<TT1> && IsSMPAssignable_v<TT1> && IsSMPAssignable_v<TT2> >
+   smpSubAssign( Array<TT1>& lhs, const Array<TT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<TT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<TT2> );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == (~rhs).dimensions()   , "Invalid array sizes"    );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         subAssign( ~lhs, ~rhs );
+      }
+      else {
+         threadAssign( ~lhs, ~rhs, Sub() );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SCHUR PRODUCT ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP Schur product assignment to a
+//        dense array.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense array.
+// \param rhs The right-hand side array for the Schur product.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP Schur product assignment to a
+// dense array. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case both operands are SMP-assignable and the element types of both
+// operands are not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename TT1  // Type of the left-hand side dense array
+        , typename TT2 > // Type of the right-hand side array
+inline EnableIf_t< IsDenseArray_v<TT1> && ( !IsSMPAssignable_v<TT1> || !IsSMPAssignable_v<TT2> ) >
+   smpSchurAssign( Array<TT1>& lhs, const Array<TT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == (~rhs).dimensions()   , "Invalid array sizes"    );
+
+   schurAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP Schur product assignment to a dense
+//        array.
+// \ingroup math
+//
+// \param lhs The target left-hand side dense array.
+// \param rhs The right-hand side array for the Schur product.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP Schur product assignment to a dense
+// array. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case both operands are SMP-assignable and the element types of both
+// operands are not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename TT1  // Type of the left-hand side dense array
+        , typename TT2 > // Type of the right-hand side array
+inline EnableIf_t< IsDenseArray_v<TT1> && IsSMPAssignable_v<TT1> && IsSMPAssignable_v<TT2> >
+   smpSchurAssign( Array<TT1>& lhs, const Array<TT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<TT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<TT2> );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == (~rhs).dimensions()   , "Invalid array sizes"    );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         schurAssign( ~lhs, ~rhs );
+      }
+      else {
+         threadAssign( ~lhs, ~rhs, Mult() );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTIPLICATION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP multiplication assignment to a
+//        dense array.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense array.
+// \param rhs The right-hand side array to be multiplied.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP multiplication assignment to a
+// dense array.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename TT1  // Type of the left-hand side dense array
+        , typename TT2 > // Type of the right-hand side array
+inline EnableIf_t< IsDenseArray_v<TT1> >
+   smpMultAssign( Array<TT1>& lhs, const Array<TT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == (~rhs).dimensions()   , "Invalid array sizes"    );
+
+   multAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD-BASED REDUCTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP reductions of a dense array.
+// \ingroup math
+//
+// \param dm The dense array to be reduced.
+// \param kernel The reduction kernel for a single block of the array.
+// \param op The operation to combine the partial results.
+// \return The combined result of all blocks.
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP reductions of
+// a dense array. All dimensions beyond the rows are flattened into a single page dimension (see
+// getArrayPages()) and the array is partitioned into SIMD-aligned blocks of pages, rows and
+// columns (see createTensorThreadMapping()). Each block is reduced by a single thread by means
+// of the given \a kernel, and the partial results are combined afterwards by means of \a op.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() or norm() functions.
+*/
+template< typename MT    // Type of the dense array
+        , typename KT    // Type of the block reduction kernel
+        , typename OP >  // Type of the combining operation
+ElementType_t<MT> threadReduce( const DenseArray<MT>& dm, KT kernel, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   using ET = ElementType_t<MT>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const auto& dims( (~dm).dimensions() );
+
+   const size_t pages  ( getArrayPages( dims ) );
+   const size_t rows   ( dims[1] );
+   const size_t columns( dims[0] );
+
+   const TensorThreadMapping threads(
+      createTensorThreadMapping( TheThreadBackend::size(), pages, rows, columns, SIMDSIZE ) );
+
+   const size_t addon0        ( ( ( pages % std::get<0>( threads ) ) != 0UL )? 1UL : 0UL );
+   const size_t pagesPerThread( pages / std::get<0>( threads ) + addon0 );
+
+   const size_t addon1       ( ( ( rows % std::get<1>( threads ) ) != 0UL )? 1UL : 0UL );
+   const size_t rowsPerThread( rows / std::get<1>( threads ) + addon1 );
+
+   const size_t addon2     ( ( ( columns % std::get<2>( threads ) ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( columns / std::get<2>( threads ) + addon2 );
+   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
+   const size_t colsPerThread( ( rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+
+   const size_t pageBlocks( ( pages   + pagesPerThread - 1UL ) / pagesPerThread );
+   const size_t rowBlocks ( ( rows    + rowsPerThread  - 1UL ) / rowsPerThread  );
+   const size_t colBlocks ( ( columns + colsPerThread  - 1UL ) / colsPerThread  );
+   const size_t blocks    ( pageBlocks * rowBlocks * colBlocks );
+
+   DynamicVector<ET> partials( blocks );
+
+   for( size_t b=0UL; b<blocks; ++b )
+   {
+      const size_t page  ( ( b / ( rowBlocks * colBlocks ) ) * pagesPerThread );
+      const size_t row   ( ( ( b / colBlocks ) % rowBlocks ) * rowsPerThread );
+      const size_t column( ( b % colBlocks ) * colsPerThread );
+
+      const size_t o( min( pagesPerThread, pages   - page   ) );
+      const size_t m( min( rowsPerThread,  rows    - row    ) );
+      const size_t n( min( colsPerThread,  columns - column ) );
+
+      auto                       target( subvector( partials, b, 1UL, unchecked ) );
+      const ArrayBlock<const MT> source( ~dm, page, row, column, o, m, n );
+      TheThreadBackend::schedule( target, source, [kernel]( auto& result, const auto& block ){
+         result[0UL] = kernel( block.operand(), block.page(), block.row(), block.column(),
+                               block.pages(), block.rows(), block.columns() );
+      } );
+   }
+
+   TheThreadBackend::wait();
+
+   ET redux( partials[0UL] );
+   for( size_t b=1UL; b<blocks; ++b ) {
+      redux = op( redux, partials[b] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP reduction of a dense array.
+// \ingroup smp
+//
+// \param dm The dense array to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the C++11/Boost thread-based SMP reduction of a dense array. In case
+// the array has less than SMP_DARRREDUCE_THRESHOLD elements or in case a serial section is
+// active, the reduction is performed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense array
+        , typename OP >  // Type of the reduction operation
+inline ElementType_t<MT> smpReduce( const DenseArray<MT>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using CT = CompositeType_t<MT>;
+   using ET = ElementType_t<MT>;
+
+   const auto& dims( (~dm).dimensions() );
+   const size_t size( getArrayPages( dims ) * dims[1] * dims[0] );
+
+   if( isSerialSectionActive() || isParallelSectionActive() ||
+       size == 0UL || size < SMP_DARRREDUCE_THRESHOLD ) {
+      return darrayreduce( ~dm, op );
+   }
+
+   CT tmp( ~dm );
+   ET redux{};
+
+   BLAZE_PARALLEL_SECTION
+   {
+      redux = threadReduce( tmp, [op]( const auto& array, size_t page, size_t row, size_t column,
+                                       size_t o, size_t m, size_t n ) {
+         return darrayreduce( array, page, row, column, o, m, n, op );
+      }, op );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP norm computation of a dense array.
+// \ingroup smp
+//
+// \param dm The dense array for the norm computation.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \param root The functor for the root operation.
+// \return The norm of the given dense array.
+//
+// This function implements the C++11/Boost thread-based SMP norm computation of a dense array.
+// Every thread accumulates the powers of the absolute values of its block, the root is applied
+// to the sum of all partial results. In case the array has less than SMP_DARRREDUCE_THRESHOLD
+// elements or in case a serial section is active, the norm is computed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// norm() function family.
+*/
+template< typename MT      // Type of the dense array
+        , typename Abs     // Type of the abs operation
+        , typename Power   // Type of the power operation
+        , typename Root >  // Type of the root operation
+inline decltype(auto) smpNorm( const DenseArray<MT>& dm, Abs abs, Power power, Root root )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using CT = CompositeType_t<MT>;
+   using ET = ElementType_t<MT>;
+
+   const auto& dims( (~dm).dimensions() );
+   const size_t size( getArrayPages( dims ) * dims[1] * dims[0] );
+
+   if( isSerialSectionActive() || isParallelSectionActive() ||
+       size == 0UL || size < SMP_DARRREDUCE_THRESHOLD ) {
+      return darraynorm( ~dm, abs, power, root );
+   }
+
+   CT tmp( ~dm );
+   ET norm{};
+
+   BLAZE_PARALLEL_SECTION
+   {
+      norm = threadReduce( tmp, [abs,power]( const auto& array, size_t page, size_t row,
+                                             size_t column, size_t o, size_t m, size_t n ) {
+         return darraynorm( array, page, row, column, o, m, n, abs, power );
+      }, Add() );
+   }
+
+   return evaluate( root( norm ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -41,9 +41,12 @@
 // Includes
 //*************************************************************************************************
 
+#include <tuple>
 #include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/constraints/SMPAssignable.h>
+#include <blaze/math/dense/DynamicVector.h>
 #include <blaze/math/simd/SIMDTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
@@ -51,7 +54,7 @@
 #include <blaze/math/smp/threads/ThreadBackend.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
 #include <blaze/math/typetraits/IsSMPAssignable.h>
-#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
@@ -63,7 +66,8 @@
 #include <blaze_tensor/math/expressions/DenseTensor.h>
 #include <blaze_tensor/math/smp/TensorThreadMapping.h>
 #include <blaze_tensor/math/typetraits/IsDenseTensor.h>
-#include <blaze_tensor/math/views/PageSlice.h>
+#include <blaze_tensor/math/views/Subtensor.h>
+#include <blaze_tensor/system/Thresholds.h>
 
 namespace blaze {
 
@@ -84,7 +88,8 @@ namespace blaze {
 // \return void
 //
 // This function is the backend implementation of the C++11/Boost thread-based SMP assignment
-// of a dense tensor to a dense tensor.\n
+// of a dense tensor to a dense tensor. The tensor is partitioned into one subtensor per thread
+// (see createTensorThreadMapping()).\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
@@ -108,58 +113,63 @@ void threadAssign( DenseTensor<MT1>& lhs, const DenseTensor<MT2>& rhs, OP op )
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~rhs ) );
+   const TensorThreadMapping threads(
+      createTensorThreadMapping( TheThreadBackend::size(), ~rhs, simdEnabled ? SIMDSIZE : 1UL ) );
 
-   const size_t addon1     ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare1( (~rhs).rows() / threads.first + addon1 );
-   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
-   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
+   const size_t addon0        ( ( ( (~rhs).pages() % std::get<0>( threads ) ) != 0UL )? 1UL : 0UL );
+   const size_t pagesPerThread( (~rhs).pages() / std::get<0>( threads ) + addon0 );
 
-   const size_t addon2     ( ( ( (~rhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare2( (~rhs).columns() / threads.second + addon2 );
+   const size_t addon1       ( ( ( (~rhs).rows() % std::get<1>( threads ) ) != 0UL )? 1UL : 0UL );
+   const size_t rowsPerThread( (~rhs).rows() / std::get<1>( threads ) + addon1 );
+
+   const size_t addon2     ( ( ( (~rhs).columns() % std::get<2>( threads ) ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( (~rhs).columns() / std::get<2>( threads ) + addon2 );
    const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
    const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
 
-   for( size_t i=0UL; i<threads.first; ++i )
+   for( size_t k=0UL; k<std::get<0>( threads ); ++k )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t page( k*pagesPerThread );
 
-      if( row >= (~lhs).rows() )
+      if( page >= (~rhs).pages() )
          continue;
 
-      for( size_t j=0UL; j<threads.second; ++j )
+      for( size_t i=0UL; i<std::get<1>( threads ); ++i )
       {
-         const size_t column( j*colsPerThread );
+         const size_t row( i*rowsPerThread );
 
-         if( column >= (~rhs).columns() )
+         if( row >= (~rhs).rows() )
             continue;
 
-         for (size_t k = 0; k != (~rhs).pages(); ++k)
+         for( size_t j=0UL; j<std::get<2>( threads ); ++j )
          {
-            const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
-            const size_t n( min( colsPerThread, (~rhs).columns() - column ) );
+            const size_t column( j*colsPerThread );
+
+            if( column >= (~rhs).columns() )
+               continue;
 
-            auto lhs_slice = pageslice( ~lhs, k );
-            auto rhs_slice = pageslice( ~rhs, k );
+            const size_t o( min( pagesPerThread, (~rhs).pages()   - page   ) );
+            const size_t m( min( rowsPerThread,  (~rhs).rows()    - row    ) );
+            const size_t n( min( colsPerThread,  (~rhs).columns() - column ) );
 
             if( simdEnabled && lhsAligned && rhsAligned ) {
-               auto       target( submatrix<aligned>( ~lhs_slice, row, column, m, n, unchecked ) );
-               const auto source( submatrix<aligned>( ~rhs_slice, row, column, m, n, unchecked ) );
+               auto       target( subtensor<aligned>( ~lhs, page, row, column, o, m, n, unchecked ) );
+               const auto source( subtensor<aligned>( ~rhs, page, row, column, o, m, n, unchecked ) );
                TheThreadBackend::schedule( target, source, op );
             }
             else if( simdEnabled && lhsAligned ) {
-               auto       target( submatrix<aligned>  ( ~lhs_slice, row, column, m, n, unchecked ) );
-               const auto source( submatrix<unaligned>( ~rhs_slice, row, column, m, n, unchecked ) );
+               auto       target( subtensor<aligned>  ( ~lhs, page, row, column, o, m, n, unchecked ) );
+               const auto source( subtensor<unaligned>( ~rhs, page, row, column, o, m, n, unchecked ) );
                TheThreadBackend::schedule( target, source, op );
             }
             else if( simdEnabled && rhsAligned ) {
-               auto       target( submatrix<unaligned>( ~lhs_slice, row, column, m, n, unchecked ) );
-               const auto source( submatrix<aligned>  ( ~rhs_slice, row, column, m, n, unchecked ) );
+               auto       target( subtensor<unaligned>( ~lhs, page, row, column, o, m, n, unchecked ) );
+               const auto source( subtensor<aligned>  ( ~rhs, page, row, column, o, m, n, unchecked ) );
                TheThreadBackend::schedule( target, source, op );
             }
             else {
-               auto       target( submatrix<unaligned>( ~lhs_slice, row, column, m, n, unchecked ) );
-               const auto source( submatrix<unaligned>( ~rhs_slice, row, column, m, n, unchecked ) );
+               auto       target( subtensor<unaligned>( ~lhs, page, row, column, o, m, n, unchecked ) );
+               const auto source( subtensor<unaligned>( ~rhs, page, row, column, o, m, n, unchecked ) );
                TheThreadBackend::schedule( target, source, op );
             }
          }
@@ -575,6 +585,154 @@ inline EnableIf_t< IsDenseTensor_v<MT1> >
 
 
 
+//=================================================================================================
+//
+//  THREAD-BASED REDUCTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP reduction of a dense tensor.
+// \ingroup math
+//
+// \param dm The dense tensor to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP reduction of a
+// dense tensor. The tensor is partitioned into SIMD-aligned subtensors (see
+// createTensorThreadMapping()), each of which is reduced by a single thread. The partial results
+// are combined afterwards.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense tensor
+        , typename OP >  // Type of the reduction operation
+ElementType_t<MT> threadReduce( const DenseTensor<MT>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   using ET = ElementType_t<MT>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const size_t pages  ( (~dm).pages()   );
+   const size_t rows   ( (~dm).rows()    );
+   const size_t columns( (~dm).columns() );
+
+   const TensorThreadMapping threads(
+      createTensorThreadMapping( TheThreadBackend::size(), ~dm, SIMDSIZE ) );
+
+   const size_t addon0        ( ( ( pages % std::get<0>( threads ) ) != 0UL )? 1UL : 0UL );
+   const size_t pagesPerThread( pages / std::get<0>( threads ) + addon0 );
+
+   const size_t addon1       ( ( ( rows % std::get<1>( threads ) ) != 0UL )? 1UL : 0UL );
+   const size_t rowsPerThread( rows / std::get<1>( threads ) + addon1 );
+
+   const size_t addon2     ( ( ( columns % std::get<2>( threads ) ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( columns / std::get<2>( threads ) + addon2 );
+   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
+   const size_t colsPerThread( ( rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+
+   const size_t pageBlocks( ( pages   + pagesPerThread - 1UL ) / pagesPerThread );
+   const size_t rowBlocks ( ( rows    + rowsPerThread  - 1UL ) / rowsPerThread  );
+   const size_t colBlocks ( ( columns + colsPerThread  - 1UL ) / colsPerThread  );
+   const size_t blocks    ( pageBlocks * rowBlocks * colBlocks );
+
+   DynamicVector<ET> partials( blocks );
+
+   for( size_t b=0UL; b<blocks; ++b )
+   {
+      const size_t page  ( ( b / ( rowBlocks * colBlocks ) ) * pagesPerThread );
+      const size_t row   ( ( ( b / colBlocks ) % rowBlocks ) * rowsPerThread );
+      const size_t column( ( b % colBlocks ) * colsPerThread );
+
+      const size_t o( min( pagesPerThread, pages   - page   ) );
+      const size_t m( min( rowsPerThread,  rows    - row    ) );
+      const size_t n( min( colsPerThread,  columns - column ) );
+
+      auto       target( subvector( partials, b, 1UL, unchecked ) );
+      const auto source( subtensor( ~dm, page, row, column, o, m, n, unchecked ) );
+      TheThreadBackend::schedule( target, source, [op]( auto& result, const auto& block ){
+         result[0UL] = dtensreduce( block, op );
+      } );
+   }
+
+   TheThreadBackend::wait();
+
+   ET redux( partials[0UL] );
+   for( size_t b=1UL; b<blocks; ++b ) {
+      redux = op( redux, partials[b] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP reduction of a dense tensor.
+// \ingroup smp
+//
+// \param dm The dense tensor to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the C++11/Boost thread-based SMP reduction of a dense tensor. In case
+// the tensor has less than SMP_DTENSREDUCE_THRESHOLD elements or in case a serial section is
+// active, the reduction is performed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense tensor
+        , typename OP >  // Type of the reduction operation
+inline ElementType_t<MT> smpReduce( const DenseTensor<MT>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using CT = CompositeType_t<MT>;
+   using ET = ElementType_t<MT>;
+
+   const size_t size( (~dm).pages() * (~dm).rows() * (~dm).columns() );
+
+   if( isSerialSectionActive() || isParallelSectionActive() ||
+       size == 0UL || size < SMP_DTENSREDUCE_THRESHOLD ) {
+      return dtensreduce( ~dm, op );
+   }
+
+   CT tmp( ~dm );
+   ET redux{};
+
+   BLAZE_PARALLEL_SECTION
+   {
+      redux = threadReduce( tmp, op );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
@@ -123,8 +123,8 @@ auto evalDilatedSubtensorTrait( const volatile T& )
 // class template:
 
    \code
-   template< typename T1>
-   struct SubtensorTrait< DynamicTensor<T1> >
+   template< typename T1, typename A >
+   struct SubtensorTrait< DynamicTensor<T1,A> >
    {
       using Type = DynamicTensor<T1>;
    };
@@ -114,8 +114,8 @@ auto evalRowSliceTrait( const volatile T& )
 // following example shows the according specialization for the DynamicTensor class template:
 
    \code
-   template< typename T1, size_t... CRAs >
-   struct RowSliceTrait< DynamicTensor<T1>, CRAs... >
+   template< typename T1, typename A, size_t... CRAs >
+   struct RowSliceTrait< DynamicTensor<T1,A>, CRAs... >
    {
       using Type = DynamicMatrix<T1,false>;
    };
@@ -0,0 +1,106 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/traits/TemporaryTrait.h
+//  \brief Header file for the temporary trait
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_TENSOR_MATH_TRAITS_TEMPORARYTRAIT_H_
+#define _BLAZE_TENSOR_MATH_TRAITS_TEMPORARYTRAIT_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Base template for the TemporaryTrait class.
+// \ingroup math_traits
+//
+// The TemporaryTrait class template selects the data type of temporaries that are created and
+// destroyed within the library during the evaluation of an expression, for instance the result
+// of an aliased assignment or an evaluated operand of a multiplication. TemporaryTrait defines
+// the nested type \a Type, which is a type with the same semantics as the given type \a T, but
+// which takes its memory from the arena of the calling thread in case an ArenaScope is open
+// (see ArenaAllocator). Per default, \a Type is \a T itself. In case the arena allocation of
+// temporaries is enabled (see BLAZE_USE_ARENA_TEMPORARIES), the DynamicTensor and DynamicArray
+// class templates specialize the trait to use an ArenaAllocator, which falls back to the aligned
+// system allocator while no ArenaScope is open:
+
+   \code
+   template< typename T, typename A >
+   struct TemporaryTrait< DynamicTensor<T,A> >
+   {
+      using Type = DynamicTensor< T, ArenaAllocator<T> >;
+   };
+   \endcode
+
+// Note that TemporaryTrait must not be used for objects that may outlive the function that
+// creates them, as for instance results that are returned to the caller.
+*/
+template< typename T >  // Type of the operand
+struct TemporaryTrait
+{
+ public:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   using Type = T;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary alias declaration for the TemporaryTrait type trait.
+// \ingroup math_traits
+//
+// The TemporaryTrait_t alias declaration provides a convenient shortcut to access the nested
+// \a Type of the TemporaryTrait class template. For instance, given the tensor type \a TT the
+// following two type definitions are identical:
+
+   \code
+   using Type1 = typename blaze::TemporaryTrait<TT>::Type;
+   using Type2 = blaze::TemporaryTrait_t<TT>;
+   \endcode
+*/
+template< typename T >  // Type of the operand
+using TemporaryTrait_t = typename TemporaryTrait<T>::Type;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
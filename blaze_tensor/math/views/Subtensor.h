@@ -989,30 +989,22 @@ inline decltype(auto) subtensor( const TensMatSchurExpr<TT>& tensor, RSAs... arg
 // This function returns an expression representing the specified subtensor of the given
 // tensor/tensor multiplication.
 */
-// template< AlignmentFlag AF    // Alignment flag
-//         , size_t... CSAs      // Compile time subtensor arguments
-//         , typename TT         // Tensor base type of the expression
-//         , typename... RSAs >  // Runtime subtensor arguments
-// inline decltype(auto) subtensor( const TensTensMultExpr<TT>& tensor, RSAs... args )
-// {
-//    BLAZE_FUNCTION_TRACE;
-//
-//    using TT1 = RemoveReference_t< LeftOperand_t< TensorType_t<TT> > >;
-//    using TT2 = RemoveReference_t< RightOperand_t< TensorType_t<TT> > >;
-//
-//    const SubtensorData<CSAs...> sd( args... );
-//
-//    BLAZE_DECLTYPE_AUTO( left , (~tensor).leftOperand()  );
-//    BLAZE_DECLTYPE_AUTO( right, (~tensor).rightOperand() );
-//
-//    const size_t begin( 0UL );
-//    const size_t end( left.columns() );
-//
-//    const size_t diff( ( begin < end )?( end - begin ):( 0UL ) );
-//
-//    return subtensor<AF>( left, sd.row(), begin, sd.page(), sd.rows(), diff, sd.pages() ) *
-//           subtensor<AF>( right, begin, sd.column(), sd.page(), diff, sd.columns(), sd.pages() );
-// }
+template< AlignmentFlag AF    // Alignment flag
+        , size_t... CSAs      // Compile time subtensor arguments
+        , typename TT         // Tensor base type of the expression
+        , typename... RSAs >  // Runtime subtensor arguments
+inline decltype(auto) subtensor( const TensTensMultExpr<TT>& tensor, RSAs... args )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const SubtensorData<CSAs...> st( args... );
+
+   decltype(auto) left ( (~tensor).leftOperand()  );
+   decltype(auto) right( (~tensor).rightOperand() );
+
+   return subtensor<AF>( left , st.page(), st.row(), 0UL, st.pages(), st.rows(), left.columns() ) *
+          subtensor<AF>( right, st.page(), 0UL, st.column(), st.pages(), right.rows(), st.columns() );
+}
 /*! \endcond */
 //*************************************************************************************************
 
@@ -1305,7 +1297,10 @@ inline decltype(auto) subtensor( const DeclExpr<TT>& tensor, RSAs... args )
 // \return View on the specified subtensor of the transpose operation.
 //
 // This function returns an expression representing the specified subtensor of the given tensor
-// transpose operation.
+// transpose operation. The requested ranges are mapped through the permutation of the transpose
+// operation onto the operand, i.e. the result is the transpose of a subtensor of the operand.
+// Since the mapped subtensor in general does not start on an aligned boundary of the operand,
+// the subtensor of the operand is always created as unaligned view.
 */
 template< AlignmentFlag AF    // Alignment flag
         , typename TT         // Tensor base type of the expression
@@ -1315,7 +1310,20 @@ inline decltype(auto)
 {
    BLAZE_FUNCTION_TRACE;
 
-   return trans( subtensor<AF>( (~tensor).operand(), page, column, row, n, m, o, args... ), (~tensor).idces() );
+   const auto idx( (~tensor).idces() );
+
+   size_t offsets[3];
+   size_t sizes[3];
+
+   offsets[idx[0]] = page;   sizes[idx[0]] = o;
+   offsets[idx[1]] = row;    sizes[idx[1]] = m;
+   offsets[idx[2]] = column; sizes[idx[2]] = n;
+
+   const size_t indices[3] = { idx[0], idx[1], idx[2] };
+
+   return trans( subtensor<unaligned>( (~tensor).operand(), offsets[0], offsets[1], offsets[2],
+                                       sizes[0], sizes[1], sizes[2], args... ),
+                 indices, 3UL );
 }
 /*! \endcond */
 //*************************************************************************************************
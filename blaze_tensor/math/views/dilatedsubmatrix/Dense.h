@@ -109,6 +109,8 @@
 #include <blaze/util/typetraits/IsReference.h>
 
 #include <blaze_tensor/math/constraints/DilatedSubmatrix.h>
+#include <blaze_tensor/math/simd/Gather.h>
+#include <blaze_tensor/math/simd/Scatter.h>
 #include <blaze_tensor/math/traits/DilatedSubmatrixTrait.h>
 #include <blaze_tensor/math/views/dilatedsubmatrix/BaseTemplate.h>
 #include <blaze_tensor/math/views/dilatedsubmatrix/DilatedSubmatrixData.h>
@@ -444,6 +446,117 @@ class DilatedSubmatrix<MT,false,true,CSAs...>
       }
       //*******************************************************************************************
 
+      //**Load function****************************************************************************
+      /*!\brief Load of a SIMD element of the dense dilatedsubmatrix.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs a strided load of the current SIMD element of the dilatedsubmatrix
+      // iterator. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function explicitly
+      // might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType load() const noexcept {
+         return gather( &*iterator_, columndilation_ );
+      }
+      //*******************************************************************************************
+
+      //**Loada function***************************************************************************
+      /*!\brief Aligned load of a SIMD element of the dense dilatedsubmatrix.
+      //
+      // \return The loaded SIMD element.
+      //
+      // The elements of a dilatedsubmatrix are never aligned, therefore this function performs
+      // the same strided load as the load() function. This function must \b NOT be called
+      // explicitly! It is used internally for the performance optimized evaluation of expression
+      // templates. Calling this function explicitly might result in erroneous results and/or in
+      // compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType loada() const noexcept {
+         return load();
+      }
+      //*******************************************************************************************
+
+      //**Loadu function***************************************************************************
+      /*!\brief Unaligned load of a SIMD element of the dense dilatedsubmatrix.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs an unaligned, strided load of the current SIMD element of the
+      // dilatedsubmatrix iterator. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling this
+      // function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType loadu() const noexcept {
+         return load();
+      }
+      //*******************************************************************************************
+
+      //**Store function***************************************************************************
+      /*!\brief Store of a SIMD element of the dense dilatedsubmatrix.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs a strided store of the current SIMD element of the dilatedsubmatrix
+      // iterator. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function explicitly
+      // might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void store( const SIMDType& value ) const noexcept {
+         scatter( &*iterator_, columndilation_, value );
+      }
+      //*******************************************************************************************
+
+      //**Storea function**************************************************************************
+      /*!\brief Aligned store of a SIMD element of the dense dilatedsubmatrix.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // The elements of a dilatedsubmatrix are never aligned, therefore this function performs
+      // the same strided store as the store() function. This function must \b NOT be called
+      // explicitly! It is used internally for the performance optimized evaluation of expression
+      // templates. Calling this function explicitly might result in erroneous results and/or in
+      // compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void storea( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
+      //**Storeu function**************************************************************************
+      /*!\brief Unaligned store of a SIMD element of the dense dilatedsubmatrix.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an unaligned, strided store of the current SIMD element of the
+      // dilatedsubmatrix iterator. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling this
+      // function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void storeu( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
+      //**Stream function**************************************************************************
+      /*!\brief Aligned, non-temporal store of a SIMD element of the dense dilatedsubmatrix.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // Strided elements cannot be streamed, therefore this function performs the same strided
+      // store as the store() function. This function must \b NOT be called explicitly! It is
+      // used internally for the performance optimized evaluation of expression templates. Calling
+      // this function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void stream( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
       //**Base function****************************************************************************
       /*!\brief Access to the current position of the DilatedSubmatrix iterator.
       //
@@ -493,7 +606,7 @@ class DilatedSubmatrix<MT,false,true,CSAs...>
 
    //**Compilation flags***************************************************************************
    //! Compilation switch for the expression template evaluation strategy.
-   static constexpr bool simdEnabled = false;
+   static constexpr bool simdEnabled = MT::simdEnabled && IsContiguous_v<MT>;
 
    //! Compilation switch for the expression template assignment strategy.
    static constexpr bool smpAssignable = MT::smpAssignable;
@@ -605,6 +718,45 @@ class DilatedSubmatrix<MT,false,true,CSAs...>
    //@}
    //**********************************************************************************************
 
+ private:
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedAddAssign_v =
+      ( VectorizedAssign_v<MT2> &&
+        HasSIMDAdd_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedSubAssign_v =
+      ( VectorizedAssign_v<MT2> &&
+        HasSIMDSub_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedSchurAssign_v =
+      ( VectorizedAssign_v<MT2> &&
+        HasSIMDMult_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
+   //**SIMD properties*****************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
+   //**********************************************************************************************
+
  public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
@@ -624,14 +776,42 @@ class DilatedSubmatrix<MT,false,true,CSAs...>
    inline bool isAligned() const noexcept { return false; }
    inline bool canSMPAssign() const noexcept;
 
+   BLAZE_ALWAYS_INLINE SIMDType load ( size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loada( size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loadu( size_t i, size_t j ) const noexcept;
+
+   BLAZE_ALWAYS_INLINE void store ( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storea( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storeu( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void stream( size_t i, size_t j, const SIMDType& value ) noexcept;
+
+   template< typename MT2 >
+   inline auto assign( const DenseMatrix<MT2,false>& rhs ) -> EnableIf_t< !VectorizedAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto assign( const DenseMatrix<MT2,false>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto addAssign( const DenseMatrix<MT2,false>& rhs ) -> EnableIf_t< !VectorizedAddAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto addAssign( const DenseMatrix<MT2,false>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto subAssign( const DenseMatrix<MT2,false>& rhs ) -> EnableIf_t< !VectorizedSubAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto subAssign( const DenseMatrix<MT2,false>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto schurAssign( const DenseMatrix<MT2,false>& rhs ) -> EnableIf_t< !VectorizedSchurAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto schurAssign( const DenseMatrix<MT2,false>& rhs ) -> EnableIf_t< VectorizedSchurAssign_v<MT2> >;
 
-   template< typename MT2 > inline void assign( const DenseMatrix<MT2,false>& rhs );
    template< typename MT2 > inline void assign( const DenseMatrix<MT2,true>& rhs );
-   template< typename MT2 > inline void addAssign( const DenseMatrix<MT2,false>& rhs );
    template< typename MT2 > inline void addAssign( const DenseMatrix<MT2,true>& rhs );
-   template< typename MT2 > inline void subAssign( const DenseMatrix<MT2,false>& rhs );
    template< typename MT2 > inline void subAssign( const DenseMatrix<MT2,true>& rhs );
-   template< typename MT2 > inline void schurAssign( const DenseMatrix<MT2,false>& rhs );
    template< typename MT2 > inline void schurAssign( const DenseMatrix<MT2,true>& rhs );
 
 
@@ -2123,6 +2303,190 @@ inline bool DilatedSubmatrix<MT,false,true,CSAs...>::canSMPAssign() const noexce
 /*! \endcond */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Load of a SIMD element of the dense dilatedsubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function gathers the SIMDSIZE consecutive elements of row i of the dilatedsubmatrix,
+// starting at element (i,j). In case the column dilation is 1 the gather degenerates to a
+// contiguous unaligned load. This function must \b NOT be called explicitly! It is used internally
+// for the performance optimized evaluation of expression templates. Calling this function
+// explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubmatrix<MT,false,true,CSAs...>::SIMDType
+   DilatedSubmatrix<MT,false,true,CSAs...>::load( size_t i, size_t j ) const noexcept
+{
+   return loadu( i, j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned load of a SIMD element of the dense dilatedsubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// The elements of a dilatedsubmatrix are never aligned, therefore this function performs the same
+// strided load as the load() function. This function must \b NOT be called explicitly! It is used
+// internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubmatrix<MT,false,true,CSAs...>::SIMDType
+   DilatedSubmatrix<MT,false,true,CSAs...>::loada( size_t i, size_t j ) const noexcept
+{
+   return loadu( i, j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned load of a SIMD element of the dense dilatedsubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs the strided load of the SIMD element starting at element (i,j). This
+// function must \b NOT be called explicitly! It is used internally for the performance optimized
+// evaluation of expression templates. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubmatrix<MT,false,true,CSAs...>::SIMDType
+   DilatedSubmatrix<MT,false,true,CSAs...>::loadu( size_t i, size_t j ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( i < rows()           , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns()        , "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( j + SIMDSIZE <= columns(), "Invalid column access index" );
+
+   return gather( matrix_.data( row() + i*rowdilation() ) + column() + j*columndilation(),
+                  columndilation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Store of a SIMD element of the dense dilatedsubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function scatters the SIMDSIZE elements of the given SIMD element to row i of the
+// dilatedsubmatrix, starting at element (i,j). In case the column dilation is 1 the scatter
+// degenerates to a contiguous unaligned store. This function must \b NOT be called explicitly! It
+// is used internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubmatrix<MT,false,true,CSAs...>::store( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   storeu( i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned store of a SIMD element of the dense dilatedsubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// The elements of a dilatedsubmatrix are never aligned, therefore this function performs the same
+// strided store as the store() function. This function must \b NOT be called explicitly! It is used
+// internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubmatrix<MT,false,true,CSAs...>::storea( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   storeu( i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned store of a SIMD element of the dense dilatedsubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs the strided store of the SIMD element starting at element (i,j). This
+// function must \b NOT be called explicitly! It is used internally for the performance optimized
+// evaluation of expression templates. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubmatrix<MT,false,true,CSAs...>::storeu( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( i < rows()           , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns()        , "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( j + SIMDSIZE <= columns(), "Invalid column access index" );
+
+   scatter( matrix_.data( row() + i*rowdilation() ) + column() + j*columndilation(),
+            columndilation(), value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned, non-temporal store of a SIMD element of the dense dilatedsubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// Strided elements cannot be streamed, therefore this function performs the same strided store as
+// the store() function. This function must \b NOT be called explicitly! It is used internally for
+// the performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubmatrix<MT,false,true,CSAs...>::stream( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   storeu( i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a row-major dense matrix.
@@ -2138,7 +2502,8 @@ inline bool DilatedSubmatrix<MT,false,true,CSAs...>::canSMPAssign() const noexce
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void DilatedSubmatrix<MT,false,true,CSAs...>::assign( const DenseMatrix<MT2,false>& rhs )
+inline auto DilatedSubmatrix<MT,false,true,CSAs...>::assign( const DenseMatrix<MT2,false>& rhs )
+   -> EnableIf_t< !VectorizedAssign_v<MT2> >
 {
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
@@ -2159,6 +2524,50 @@ inline void DilatedSubmatrix<MT,false,true,CSAs...>::assign( const DenseMatrix<M
 /*! \endcond */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto DilatedSubmatrix<MT,false,true,CSAs...>::assign( const DenseMatrix<MT2,false>& rhs )
+   -> EnableIf_t< VectorizedAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t jpos( columns() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( columns() - ( columns() % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<rows(); ++i )
+   {
+      size_t j( 0UL );
+      Iterator left( begin(i) );
+      ConstIterator_t<MT2> right( (~rhs).begin(i) );
+
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; j<columns(); ++j ) {
+         *left = *right; ++left; ++right;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a column-major dense matrix.
@@ -2214,7 +2623,8 @@ inline void DilatedSubmatrix<MT,false,true,CSAs...>::assign( const DenseMatrix<M
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void DilatedSubmatrix<MT,false,true,CSAs...>::addAssign( const DenseMatrix<MT2,false>& rhs )
+inline auto DilatedSubmatrix<MT,false,true,CSAs...>::addAssign( const DenseMatrix<MT2,false>& rhs )
+   -> EnableIf_t< !VectorizedAddAssign_v<MT2> >
 {
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
@@ -2242,6 +2652,50 @@ inline void DilatedSubmatrix<MT,false,true,CSAs...>::addAssign( const DenseMatri
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the addition assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto DilatedSubmatrix<MT,false,true,CSAs...>::addAssign( const DenseMatrix<MT2,false>& rhs )
+   -> EnableIf_t< VectorizedAddAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t jpos( columns() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( columns() - ( columns() % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<rows(); ++i )
+   {
+      size_t j( 0UL );
+      Iterator left( begin(i) );
+      ConstIterator_t<MT2> right( (~rhs).begin(i) );
+
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; j<columns(); ++j ) {
+         *left += *right; ++left; ++right;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the addition assignment of a column-major dense matrix.
@@ -2297,7 +2751,8 @@ inline void DilatedSubmatrix<MT,false,true,CSAs...>::addAssign( const DenseMatri
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void DilatedSubmatrix<MT,false,true,CSAs...>::subAssign( const DenseMatrix<MT2,false>& rhs )
+inline auto DilatedSubmatrix<MT,false,true,CSAs...>::subAssign( const DenseMatrix<MT2,false>& rhs )
+   -> EnableIf_t< !VectorizedSubAssign_v<MT2> >
 {
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
@@ -2325,6 +2780,50 @@ inline void DilatedSubmatrix<MT,false,true,CSAs...>::subAssign( const DenseMatri
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the subtraction assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto DilatedSubmatrix<MT,false,true,CSAs...>::subAssign( const DenseMatrix<MT2,false>& rhs )
+   -> EnableIf_t< VectorizedSubAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t jpos( columns() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( columns() - ( columns() % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<rows(); ++i )
+   {
+      size_t j( 0UL );
+      Iterator left( begin(i) );
+      ConstIterator_t<MT2> right( (~rhs).begin(i) );
+
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; j<columns(); ++j ) {
+         *left -= *right; ++left; ++right;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the subtraction assignment of a column-major dense matrix.
@@ -2380,7 +2879,8 @@ inline void DilatedSubmatrix<MT,false,true,CSAs...>::subAssign( const DenseMatri
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void DilatedSubmatrix<MT,false,true,CSAs...>::schurAssign( const DenseMatrix<MT2,false>& rhs )
+inline auto DilatedSubmatrix<MT,false,true,CSAs...>::schurAssign( const DenseMatrix<MT2,false>& rhs )
+   -> EnableIf_t< !VectorizedSchurAssign_v<MT2> >
 {
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
@@ -2402,6 +2902,50 @@ inline void DilatedSubmatrix<MT,false,true,CSAs...>::schurAssign( const DenseMat
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the Schur product assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto DilatedSubmatrix<MT,false,true,CSAs...>::schurAssign( const DenseMatrix<MT2,false>& rhs )
+   -> EnableIf_t< VectorizedSchurAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t jpos( columns() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( columns() - ( columns() % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<rows(); ++i )
+   {
+      size_t j( 0UL );
+      Iterator left( begin(i) );
+      ConstIterator_t<MT2> right( (~rhs).begin(i) );
+
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; j<columns(); ++j ) {
+         *left *= *right; ++left; ++right;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the Schur product assignment of a column-major dense matrix.
@@ -2777,6 +3321,117 @@ class DilatedSubmatrix<MT,true,true,CSAs...>
       }
       //*******************************************************************************************
 
+      //**Load function****************************************************************************
+      /*!\brief Load of a SIMD element of the dense dilatedsubmatrix.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs a strided load of the current SIMD element of the dilatedsubmatrix
+      // iterator. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function explicitly
+      // might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType load() const noexcept {
+         return gather( &*iterator_, rowdilation_ );
+      }
+      //*******************************************************************************************
+
+      //**Loada function***************************************************************************
+      /*!\brief Aligned load of a SIMD element of the dense dilatedsubmatrix.
+      //
+      // \return The loaded SIMD element.
+      //
+      // The elements of a dilatedsubmatrix are never aligned, therefore this function performs
+      // the same strided load as the load() function. This function must \b NOT be called
+      // explicitly! It is used internally for the performance optimized evaluation of expression
+      // templates. Calling this function explicitly might result in erroneous results and/or in
+      // compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType loada() const noexcept {
+         return load();
+      }
+      //*******************************************************************************************
+
+      //**Loadu function***************************************************************************
+      /*!\brief Unaligned load of a SIMD element of the dense dilatedsubmatrix.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs an unaligned, strided load of the current SIMD element of the
+      // dilatedsubmatrix iterator. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling this
+      // function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType loadu() const noexcept {
+         return load();
+      }
+      //*******************************************************************************************
+
+      //**Store function***************************************************************************
+      /*!\brief Store of a SIMD element of the dense dilatedsubmatrix.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs a strided store of the current SIMD element of the dilatedsubmatrix
+      // iterator. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function explicitly
+      // might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void store( const SIMDType& value ) const noexcept {
+         scatter( &*iterator_, rowdilation_, value );
+      }
+      //*******************************************************************************************
+
+      //**Storea function**************************************************************************
+      /*!\brief Aligned store of a SIMD element of the dense dilatedsubmatrix.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // The elements of a dilatedsubmatrix are never aligned, therefore this function performs
+      // the same strided store as the store() function. This function must \b NOT be called
+      // explicitly! It is used internally for the performance optimized evaluation of expression
+      // templates. Calling this function explicitly might result in erroneous results and/or in
+      // compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void storea( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
+      //**Storeu function**************************************************************************
+      /*!\brief Unaligned store of a SIMD element of the dense dilatedsubmatrix.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an unaligned, strided store of the current SIMD element of the
+      // dilatedsubmatrix iterator. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling this
+      // function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void storeu( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
+      //**Stream function**************************************************************************
+      /*!\brief Aligned, non-temporal store of a SIMD element of the dense dilatedsubmatrix.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // Strided elements cannot be streamed, therefore this function performs the same strided
+      // store as the store() function. This function must \b NOT be called explicitly! It is
+      // used internally for the performance optimized evaluation of expression templates. Calling
+      // this function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void stream( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
       //**Base function****************************************************************************
       /*!\brief Access to the current position of the dilatedsubmatrix iterator.
       //
@@ -2826,7 +3481,7 @@ class DilatedSubmatrix<MT,true,true,CSAs...>
 
    //**Compilation flags***************************************************************************
    //! Compilation switch for the expression template evaluation strategy.
-   static constexpr bool simdEnabled = false;
+   static constexpr bool simdEnabled = MT::simdEnabled && IsContiguous_v<MT>;
 
    //! Compilation switch for the expression template assignment strategy.
    static constexpr bool smpAssignable = MT::smpAssignable;
@@ -2938,6 +3593,45 @@ class DilatedSubmatrix<MT,true,true,CSAs...>
    //@}
    //**********************************************************************************************
 
+ private:
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedAddAssign_v =
+      ( VectorizedAssign_v<MT2> &&
+        HasSIMDAdd_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedSubAssign_v =
+      ( VectorizedAssign_v<MT2> &&
+        HasSIMDSub_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedSchurAssign_v =
+      ( VectorizedAssign_v<MT2> &&
+        HasSIMDMult_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
+   //**SIMD properties*****************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
+   //**********************************************************************************************
+
  public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
@@ -2957,14 +3651,43 @@ class DilatedSubmatrix<MT,true,true,CSAs...>
    inline bool isAligned() const noexcept { return false; }
    inline bool canSMPAssign() const noexcept;
 
+   BLAZE_ALWAYS_INLINE SIMDType load ( size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loada( size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loadu( size_t i, size_t j ) const noexcept;
+
+   BLAZE_ALWAYS_INLINE void store ( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storea( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storeu( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void stream( size_t i, size_t j, const SIMDType& value ) noexcept;
+
+   template< typename MT2 >
+   inline auto assign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< !VectorizedAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto assign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto addAssign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< !VectorizedAddAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto addAssign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto subAssign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< !VectorizedSubAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto subAssign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto schurAssign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< !VectorizedSchurAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto schurAssign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< VectorizedSchurAssign_v<MT2> >;
+
    template< typename MT2 > inline void assign( const DenseMatrix<MT2,false>& rhs );
-   template< typename MT2 > inline void assign( const DenseMatrix<MT2,true>& rhs );
    template< typename MT2 > inline void addAssign( const DenseMatrix<MT2,false>& rhs );
-   template< typename MT2 > inline void addAssign( const DenseMatrix<MT2,true>& rhs );
    template< typename MT2 > inline void subAssign( const DenseMatrix<MT2,false>& rhs );
-   template< typename MT2 > inline void subAssign( const DenseMatrix<MT2,true>& rhs );
    template< typename MT2 > inline void schurAssign( const DenseMatrix<MT2,false>& rhs );
-   template< typename MT2 > inline void schurAssign( const DenseMatrix<MT2,true>& rhs );
    //@}
    //**********************************************************************************************
 
@@ -4415,6 +5138,190 @@ inline bool DilatedSubmatrix<MT,true,true,CSAs...>::canSMPAssign() const noexcep
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Load of a SIMD element of the dense dilatedsubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function gathers the SIMDSIZE consecutive elements of column j of the dilatedsubmatrix,
+// starting at element (i,j). In case the row dilation is 1 the gather degenerates to a contiguous
+// unaligned load. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly might
+// result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubmatrix<MT,true,true,CSAs...>::SIMDType
+   DilatedSubmatrix<MT,true,true,CSAs...>::load( size_t i, size_t j ) const noexcept
+{
+   return loadu( i, j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned load of a SIMD element of the dense dilatedsubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// The elements of a dilatedsubmatrix are never aligned, therefore this function performs the same
+// strided load as the load() function. This function must \b NOT be called explicitly! It is used
+// internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubmatrix<MT,true,true,CSAs...>::SIMDType
+   DilatedSubmatrix<MT,true,true,CSAs...>::loada( size_t i, size_t j ) const noexcept
+{
+   return loadu( i, j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned load of a SIMD element of the dense dilatedsubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs the strided load of the SIMD element starting at element (i,j). This
+// function must \b NOT be called explicitly! It is used internally for the performance optimized
+// evaluation of expression templates. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubmatrix<MT,true,true,CSAs...>::SIMDType
+   DilatedSubmatrix<MT,true,true,CSAs...>::loadu( size_t i, size_t j ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( i < rows()           , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( i + SIMDSIZE <= rows(), "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns()        , "Invalid column access index" );
+
+   return gather( matrix_.data( column() + j*columndilation() ) + row() + i*rowdilation(),
+                  rowdilation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Store of a SIMD element of the dense dilatedsubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function scatters the SIMDSIZE elements of the given SIMD element to column j of the
+// dilatedsubmatrix, starting at element (i,j). In case the row dilation is 1 the scatter
+// degenerates to a contiguous unaligned store. This function must \b NOT be called explicitly! It
+// is used internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubmatrix<MT,true,true,CSAs...>::store( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   storeu( i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned store of a SIMD element of the dense dilatedsubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// The elements of a dilatedsubmatrix are never aligned, therefore this function performs the same
+// strided store as the store() function. This function must \b NOT be called explicitly! It is used
+// internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubmatrix<MT,true,true,CSAs...>::storea( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   storeu( i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned store of a SIMD element of the dense dilatedsubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs the strided store of the SIMD element starting at element (i,j). This
+// function must \b NOT be called explicitly! It is used internally for the performance optimized
+// evaluation of expression templates. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubmatrix<MT,true,true,CSAs...>::storeu( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( i < rows()           , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( i + SIMDSIZE <= rows(), "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns()        , "Invalid column access index" );
+
+   scatter( matrix_.data( column() + j*columndilation() ) + row() + i*rowdilation(),
+            rowdilation(), value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned, non-temporal store of a SIMD element of the dense dilatedsubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// Strided elements cannot be streamed, therefore this function performs the same strided store as
+// the store() function. This function must \b NOT be called explicitly! It is used internally for
+// the performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubmatrix<MT,true,true,CSAs...>::stream( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   storeu( i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a column-major dense matrix.
@@ -4430,8 +5337,8 @@ inline bool DilatedSubmatrix<MT,true,true,CSAs...>::canSMPAssign() const noexcep
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void DilatedSubmatrix<MT,true,true,CSAs...>::assign( const DenseMatrix<MT2,true>& rhs )
-
+inline auto DilatedSubmatrix<MT,true,true,CSAs...>::assign( const DenseMatrix<MT2,true>& rhs )
+   -> EnableIf_t< !VectorizedAssign_v<MT2> >
 {
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
@@ -4453,6 +5360,50 @@ inline void DilatedSubmatrix<MT,true,true,CSAs...>::assign( const DenseMatrix<MT
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto DilatedSubmatrix<MT,true,true,CSAs...>::assign( const DenseMatrix<MT2,true>& rhs )
+   -> EnableIf_t< VectorizedAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t ipos( rows() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( rows() - ( rows() % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<columns(); ++j )
+   {
+      size_t i( 0UL );
+      Iterator left( begin(j) );
+      ConstIterator_t<MT2> right( (~rhs).begin(j) );
+
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; i<rows(); ++i ) {
+         *left = *right; ++left; ++right;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a row-major dense matrix.
@@ -4538,7 +5489,8 @@ inline void DilatedSubmatrix<MT,true,true,CSAs...>::assign( const DenseMatrix<MT
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void DilatedSubmatrix<MT,true,true,CSAs...>::addAssign( const DenseMatrix<MT2,true>& rhs )
+inline auto DilatedSubmatrix<MT,true,true,CSAs...>::addAssign( const DenseMatrix<MT2,true>& rhs )
+   -> EnableIf_t< !VectorizedAddAssign_v<MT2> >
 {
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
@@ -4566,6 +5518,50 @@ inline void DilatedSubmatrix<MT,true,true,CSAs...>::addAssign( const DenseMatrix
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the addition assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto DilatedSubmatrix<MT,true,true,CSAs...>::addAssign( const DenseMatrix<MT2,true>& rhs )
+   -> EnableIf_t< VectorizedAddAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t ipos( rows() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( rows() - ( rows() % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<columns(); ++j )
+   {
+      size_t i( 0UL );
+      Iterator left( begin(j) );
+      ConstIterator_t<MT2> right( (~rhs).begin(j) );
+
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; i<rows(); ++i ) {
+         *left += *right; ++left; ++right;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the addition assignment of a row-major dense matrix.
@@ -4679,7 +5675,8 @@ inline void DilatedSubmatrix<MT,true,true,CSAs...>::addAssign( const DenseMatrix
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void DilatedSubmatrix<MT,true,true,CSAs...>::subAssign( const DenseMatrix<MT2,true>& rhs )
+inline auto DilatedSubmatrix<MT,true,true,CSAs...>::subAssign( const DenseMatrix<MT2,true>& rhs )
+   -> EnableIf_t< !VectorizedSubAssign_v<MT2> >
 {
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
@@ -4707,6 +5704,50 @@ inline void DilatedSubmatrix<MT,true,true,CSAs...>::subAssign( const DenseMatrix
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the subtraction assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto DilatedSubmatrix<MT,true,true,CSAs...>::subAssign( const DenseMatrix<MT2,true>& rhs )
+   -> EnableIf_t< VectorizedSubAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t ipos( rows() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( rows() - ( rows() % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<columns(); ++j )
+   {
+      size_t i( 0UL );
+      Iterator left( begin(j) );
+      ConstIterator_t<MT2> right( (~rhs).begin(j) );
+
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; i<rows(); ++i ) {
+         *left -= *right; ++left; ++right;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the subtraction assignment of a row-major dense matrix.
@@ -4820,7 +5861,8 @@ inline void DilatedSubmatrix<MT,true,true,CSAs...>::subAssign( const DenseMatrix
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void DilatedSubmatrix<MT,true,true,CSAs...>::schurAssign( const DenseMatrix<MT2,true>& rhs )
+inline auto DilatedSubmatrix<MT,true,true,CSAs...>::schurAssign( const DenseMatrix<MT2,true>& rhs )
+   -> EnableIf_t< !VectorizedSchurAssign_v<MT2> >
 {
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
@@ -4842,6 +5884,50 @@ inline void DilatedSubmatrix<MT,true,true,CSAs...>::schurAssign( const DenseMatr
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the Schur product assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto DilatedSubmatrix<MT,true,true,CSAs...>::schurAssign( const DenseMatrix<MT2,true>& rhs )
+   -> EnableIf_t< VectorizedSchurAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t ipos( rows() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( rows() - ( rows() % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<columns(); ++j )
+   {
+      size_t i( 0UL );
+      Iterator left( begin(j) );
+      ConstIterator_t<MT2> right( (~rhs).begin(j) );
+
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; i<rows(); ++i ) {
+         *left *= *right; ++left; ++right;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the Schur product assignment of a row-major dense matrix.
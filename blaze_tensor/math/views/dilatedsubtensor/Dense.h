@@ -106,6 +106,8 @@
 #include <blaze_tensor/math/constraints/RowMajorTensor.h>
 #include <blaze_tensor/math/dense/InitializerTensor.h>
 #include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/simd/Gather.h>
+#include <blaze_tensor/math/simd/Scatter.h>
 #include <blaze_tensor/math/traits/DilatedSubtensorTrait.h>
 #include <blaze_tensor/math/views/dilatedsubtensor/BaseTemplate.h>
 #include <blaze_tensor/math/views/dilatedsubtensor/DilatedSubtensorData.h>
@@ -445,6 +447,117 @@ class DilatedSubtensor<TT,true,CSAs...>
       }
       //*******************************************************************************************
 
+      //**Load function****************************************************************************
+      /*!\brief Load of a SIMD element of the dense dilatedsubtensor.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs a strided load of the current SIMD element of the dilatedsubtensor
+      // iterator. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function explicitly
+      // might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType load() const noexcept {
+         return gather( &*iterator_, columndilation_ );
+      }
+      //*******************************************************************************************
+
+      //**Loada function***************************************************************************
+      /*!\brief Aligned load of a SIMD element of the dense dilatedsubtensor.
+      //
+      // \return The loaded SIMD element.
+      //
+      // The elements of a dilatedsubtensor are never aligned, therefore this function performs
+      // the same strided load as the load() function. This function must \b NOT be called
+      // explicitly! It is used internally for the performance optimized evaluation of expression
+      // templates. Calling this function explicitly might result in erroneous results and/or in
+      // compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType loada() const noexcept {
+         return load();
+      }
+      //*******************************************************************************************
+
+      //**Loadu function***************************************************************************
+      /*!\brief Unaligned load of a SIMD element of the dense dilatedsubtensor.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs an unaligned, strided load of the current SIMD element of the
+      // dilatedsubtensor iterator. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling this
+      // function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType loadu() const noexcept {
+         return load();
+      }
+      //*******************************************************************************************
+
+      //**Store function***************************************************************************
+      /*!\brief Store of a SIMD element of the dense dilatedsubtensor.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs a strided store of the current SIMD element of the dilatedsubtensor
+      // iterator. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function explicitly
+      // might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void store( const SIMDType& value ) const noexcept {
+         scatter( &*iterator_, columndilation_, value );
+      }
+      //*******************************************************************************************
+
+      //**Storea function**************************************************************************
+      /*!\brief Aligned store of a SIMD element of the dense dilatedsubtensor.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // The elements of a dilatedsubtensor are never aligned, therefore this function performs
+      // the same strided store as the store() function. This function must \b NOT be called
+      // explicitly! It is used internally for the performance optimized evaluation of expression
+      // templates. Calling this function explicitly might result in erroneous results and/or in
+      // compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void storea( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
+      //**Storeu function**************************************************************************
+      /*!\brief Unaligned store of a SIMD element of the dense dilatedsubtensor.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an unaligned, strided store of the current SIMD element of the
+      // dilatedsubtensor iterator. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling this
+      // function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void storeu( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
+      //**Stream function**************************************************************************
+      /*!\brief Aligned, non-temporal store of a SIMD element of the dense dilatedsubtensor.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // Strided elements cannot be streamed, therefore this function performs the same strided
+      // store as the store() function. This function must \b NOT be called explicitly! It is
+      // used internally for the performance optimized evaluation of expression templates. Calling
+      // this function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void stream( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
       //**Base function****************************************************************************
       /*!\brief Access to the current position of the DilatedSubtensor iterator.
       //
@@ -505,7 +618,7 @@ class DilatedSubtensor<TT,true,CSAs...>
 
    //**Compilation flags***************************************************************************
    //! Compilation switch for the expression template evaluation strategy.
-   static constexpr bool simdEnabled = false;
+   static constexpr bool simdEnabled = TT::simdEnabled && IsContiguous_v<TT>;
 
    //! Compilation switch for the expression template assignment strategy.
    static constexpr bool smpAssignable = TT::smpAssignable;
@@ -620,6 +733,45 @@ class DilatedSubtensor<TT,true,CSAs...>
    //@}
    //**********************************************************************************************
 
+ private:
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename TT2 >
+   static constexpr bool VectorizedAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && TT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<TT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename TT2 >
+   static constexpr bool VectorizedAddAssign_v =
+      ( VectorizedAssign_v<TT2> &&
+        HasSIMDAdd_v< ElementType, ElementType_t<TT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename TT2 >
+   static constexpr bool VectorizedSubAssign_v =
+      ( VectorizedAssign_v<TT2> &&
+        HasSIMDSub_v< ElementType, ElementType_t<TT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename TT2 >
+   static constexpr bool VectorizedSchurAssign_v =
+      ( VectorizedAssign_v<TT2> &&
+        HasSIMDMult_v< ElementType, ElementType_t<TT2> > );
+   //**********************************************************************************************
+
+   //**SIMD properties*****************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
+   //**********************************************************************************************
+
  public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
@@ -639,12 +791,38 @@ class DilatedSubtensor<TT,true,CSAs...>
    inline bool isAligned() const noexcept { return false; }
    inline bool canSMPAssign() const noexcept;
 
+   BLAZE_ALWAYS_INLINE SIMDType load ( size_t k, size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loada( size_t k, size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loadu( size_t k, size_t i, size_t j ) const noexcept;
+
+   BLAZE_ALWAYS_INLINE void store ( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storea( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storeu( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void stream( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept;
+
+   template< typename TT2 >
+   inline auto assign( const DenseTensor<TT2>& rhs ) -> EnableIf_t< !VectorizedAssign_v<TT2> >;
+
+   template< typename TT2 >
+   inline auto assign( const DenseTensor<TT2>& rhs ) -> EnableIf_t< VectorizedAssign_v<TT2> >;
+
+   template< typename TT2 >
+   inline auto addAssign( const DenseTensor<TT2>& rhs ) -> EnableIf_t< !VectorizedAddAssign_v<TT2> >;
+
+   template< typename TT2 >
+   inline auto addAssign( const DenseTensor<TT2>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<TT2> >;
+
+   template< typename TT2 >
+   inline auto subAssign( const DenseTensor<TT2>& rhs ) -> EnableIf_t< !VectorizedSubAssign_v<TT2> >;
+
+   template< typename TT2 >
+   inline auto subAssign( const DenseTensor<TT2>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<TT2> >;
 
-   template< typename TT2 > inline auto assign( const DenseTensor<TT2>& rhs );
-   template< typename TT2 > inline auto addAssign( const DenseTensor<TT2>& rhs );
-   template< typename TT2 > inline auto subAssign( const DenseTensor<TT2>& rhs );
-   template< typename TT2 > inline auto schurAssign( const DenseTensor<TT2>& rhs );
+   template< typename TT2 >
+   inline auto schurAssign( const DenseTensor<TT2>& rhs ) -> EnableIf_t< !VectorizedSchurAssign_v<TT2> >;
 
+   template< typename TT2 >
+   inline auto schurAssign( const DenseTensor<TT2>& rhs ) -> EnableIf_t< VectorizedSchurAssign_v<TT2> >;
 
    //@}
    //**********************************************************************************************
@@ -2117,6 +2295,199 @@ inline bool DilatedSubtensor<TT,true,CSAs...>::canSMPAssign() const noexcept
 /*! \endcond */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Load of a SIMD element of the dense dilatedsubtensor.
+//
+// \param k Access index for the page. The index has to be in the range [0..O-1].
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function gathers the SIMDSIZE consecutive elements of row i in page k of the
+// dilatedsubtensor, starting at element (k,i,j). In case the column dilation is 1 the gather
+// degenerates to a contiguous unaligned load. This function must \b NOT be called explicitly! It is
+// used internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename TT       // Type of the dense tensor
+        , size_t... CSAs >  // Compile time DilatedSubtensor arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubtensor<TT,true,CSAs...>::SIMDType
+   DilatedSubtensor<TT,true,CSAs...>::load( size_t k, size_t i, size_t j ) const noexcept
+{
+   return loadu( k, i, j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned load of a SIMD element of the dense dilatedsubtensor.
+//
+// \param k Access index for the page. The index has to be in the range [0..O-1].
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// The elements of a dilatedsubtensor are never aligned, therefore this function performs the same
+// strided load as the load() function. This function must \b NOT be called explicitly! It is used
+// internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename TT       // Type of the dense tensor
+        , size_t... CSAs >  // Compile time DilatedSubtensor arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubtensor<TT,true,CSAs...>::SIMDType
+   DilatedSubtensor<TT,true,CSAs...>::loada( size_t k, size_t i, size_t j ) const noexcept
+{
+   return loadu( k, i, j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned load of a SIMD element of the dense dilatedsubtensor.
+//
+// \param k Access index for the page. The index has to be in the range [0..O-1].
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs the strided load of the SIMD element starting at element (k,i,j). This
+// function must \b NOT be called explicitly! It is used internally for the performance optimized
+// evaluation of expression templates. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename TT       // Type of the dense tensor
+        , size_t... CSAs >  // Compile time DilatedSubtensor arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubtensor<TT,true,CSAs...>::SIMDType
+   DilatedSubtensor<TT,true,CSAs...>::loadu( size_t k, size_t i, size_t j ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( k < pages()          , "Invalid page access index"   );
+   BLAZE_INTERNAL_ASSERT( i < rows()           , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns()        , "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( j + SIMDSIZE <= columns(), "Invalid column access index" );
+
+   return gather( tensor_.data( row() + i*rowdilation(), page() + k*pagedilation() ) + column() + j*columndilation(),
+                  columndilation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Store of a SIMD element of the dense dilatedsubtensor.
+//
+// \param k Access index for the page. The index has to be in the range [0..O-1].
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function scatters the SIMDSIZE elements of the given SIMD element to row i in page k of the
+// dilatedsubtensor, starting at element (k,i,j). In case the column dilation is 1 the scatter
+// degenerates to a contiguous unaligned store. This function must \b NOT be called explicitly! It
+// is used internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename TT       // Type of the dense tensor
+        , size_t... CSAs >  // Compile time DilatedSubtensor arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubtensor<TT,true,CSAs...>::store( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   storeu( k, i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned store of a SIMD element of the dense dilatedsubtensor.
+//
+// \param k Access index for the page. The index has to be in the range [0..O-1].
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// The elements of a dilatedsubtensor are never aligned, therefore this function performs the same
+// strided store as the store() function. This function must \b NOT be called explicitly! It is used
+// internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename TT       // Type of the dense tensor
+        , size_t... CSAs >  // Compile time DilatedSubtensor arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubtensor<TT,true,CSAs...>::storea( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   storeu( k, i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned store of a SIMD element of the dense dilatedsubtensor.
+//
+// \param k Access index for the page. The index has to be in the range [0..O-1].
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs the strided store of the SIMD element starting at element (k,i,j). This
+// function must \b NOT be called explicitly! It is used internally for the performance optimized
+// evaluation of expression templates. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename TT       // Type of the dense tensor
+        , size_t... CSAs >  // Compile time DilatedSubtensor arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubtensor<TT,true,CSAs...>::storeu( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( k < pages()          , "Invalid page access index"   );
+   BLAZE_INTERNAL_ASSERT( i < rows()           , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns()        , "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( j + SIMDSIZE <= columns(), "Invalid column access index" );
+
+   scatter( tensor_.data( row() + i*rowdilation(), page() + k*pagedilation() ) + column() + j*columndilation(),
+            columndilation(), value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned, non-temporal store of a SIMD element of the dense dilatedsubtensor.
+//
+// \param k Access index for the page. The index has to be in the range [0..O-1].
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// Strided elements cannot be streamed, therefore this function performs the same strided store as
+// the store() function. This function must \b NOT be called explicitly! It is used internally for
+// the performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename TT       // Type of the dense tensor
+        , size_t... CSAs >  // Compile time DilatedSubtensor arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubtensor<TT,true,CSAs...>::stream( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   storeu( k, i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a row-major dense tensor.
@@ -2133,6 +2504,7 @@ template< typename TT       // Type of the dense tensor
         , size_t... CSAs >  // Compile time DilatedSubtensor arguments
 template< typename TT2 >    // Type of the right-hand side dense tensor
 inline auto DilatedSubtensor<TT,true,CSAs...>::assign( const DenseTensor<TT2>& rhs )
+   -> EnableIf_t< !VectorizedAssign_v<TT2> >
 {
    BLAZE_INTERNAL_ASSERT( pages()   == (~rhs).pages()  , "Invalid number of pages"  );
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"   );
@@ -2157,6 +2529,53 @@ inline auto DilatedSubtensor<TT,true,CSAs...>::assign( const DenseTensor<TT2>& r
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a row-major dense tensor.
+//
+// \param rhs The right-hand side dense tensor to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename TT       // Type of the dense tensor
+        , size_t... CSAs >  // Compile time DilatedSubtensor arguments
+template< typename TT2 >    // Type of the right-hand side dense tensor
+inline auto DilatedSubtensor<TT,true,CSAs...>::assign( const DenseTensor<TT2>& rhs )
+   -> EnableIf_t< VectorizedAssign_v<TT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( pages()   == (~rhs).pages()  , "Invalid number of pages"  );
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"   );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns");
+
+   const size_t jpos( columns() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( columns() - ( columns() % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   for( size_t k=0UL; k<pages(); ++k ) {
+      for( size_t i=0UL; i<rows(); ++i )
+      {
+         size_t j( 0UL );
+         Iterator left( begin( i, k ) );
+         ConstIterator_t<TT2> right( (~rhs).begin( i, k ) );
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         }
+         for( ; j<columns(); ++j ) {
+            *left = *right; ++left; ++right;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the addition assignment of a row-major dense tensor.
@@ -2173,6 +2592,7 @@ template< typename TT       // Type of the dense tensor
         , size_t... CSAs >  // Compile time DilatedSubtensor arguments
 template< typename TT2 >    // Type of the right-hand side dense tensor
 inline auto DilatedSubtensor<TT,true,CSAs...>::addAssign( const DenseTensor<TT2>& rhs )
+   -> EnableIf_t< !VectorizedAddAssign_v<TT2> >
 {
    BLAZE_INTERNAL_ASSERT( pages()   == (~rhs).pages()  , "Invalid number of pages"  );
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"   );
@@ -2199,6 +2619,53 @@ inline auto DilatedSubtensor<TT,true,CSAs...>::addAssign( const DenseTensor<TT2>
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the addition assignment of a row-major dense tensor.
+//
+// \param rhs The right-hand side dense tensor to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename TT       // Type of the dense tensor
+        , size_t... CSAs >  // Compile time DilatedSubtensor arguments
+template< typename TT2 >    // Type of the right-hand side dense tensor
+inline auto DilatedSubtensor<TT,true,CSAs...>::addAssign( const DenseTensor<TT2>& rhs )
+   -> EnableIf_t< VectorizedAddAssign_v<TT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( pages()   == (~rhs).pages()  , "Invalid number of pages"  );
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"   );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns");
+
+   const size_t jpos( columns() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( columns() - ( columns() % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   for( size_t k=0UL; k<pages(); ++k ) {
+      for( size_t i=0UL; i<rows(); ++i )
+      {
+         size_t j( 0UL );
+         Iterator left( begin( i, k ) );
+         ConstIterator_t<TT2> right( (~rhs).begin( i, k ) );
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         }
+         for( ; j<columns(); ++j ) {
+            *left += *right; ++left; ++right;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the subtraction assignment of a row-major dense tensor.
@@ -2215,6 +2682,7 @@ template< typename TT       // Type of the dense tensor
         , size_t... CSAs >  // Compile time DilatedSubtensor arguments
 template< typename TT2 >    // Type of the right-hand side dense tensor
 inline auto DilatedSubtensor<TT,true,CSAs...>::subAssign( const DenseTensor<TT2>& rhs )
+   -> EnableIf_t< !VectorizedSubAssign_v<TT2> >
 {
    BLAZE_INTERNAL_ASSERT( pages()   == (~rhs).pages()  , "Invalid number of pages"  );
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"   );
@@ -2242,6 +2710,53 @@ inline auto DilatedSubtensor<TT,true,CSAs...>::subAssign( const DenseTensor<TT2>
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the subtraction assignment of a row-major dense tensor.
+//
+// \param rhs The right-hand side dense tensor to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename TT       // Type of the dense tensor
+        , size_t... CSAs >  // Compile time DilatedSubtensor arguments
+template< typename TT2 >    // Type of the right-hand side dense tensor
+inline auto DilatedSubtensor<TT,true,CSAs...>::subAssign( const DenseTensor<TT2>& rhs )
+   -> EnableIf_t< VectorizedSubAssign_v<TT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( pages()   == (~rhs).pages()  , "Invalid number of pages"  );
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"   );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns");
+
+   const size_t jpos( columns() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( columns() - ( columns() % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   for( size_t k=0UL; k<pages(); ++k ) {
+      for( size_t i=0UL; i<rows(); ++i )
+      {
+         size_t j( 0UL );
+         Iterator left( begin( i, k ) );
+         ConstIterator_t<TT2> right( (~rhs).begin( i, k ) );
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         }
+         for( ; j<columns(); ++j ) {
+            *left -= *right; ++left; ++right;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the Schur product assignment of a row-major dense tensor.
@@ -2258,6 +2773,7 @@ template< typename TT       // Type of the dense tensor
         , size_t... CSAs >  // Compile time DilatedSubtensor arguments
 template< typename TT2 >    // Type of the right-hand side dense tensor
 inline auto DilatedSubtensor<TT,true,CSAs...>::schurAssign( const DenseTensor<TT2>& rhs )
+   -> EnableIf_t< !VectorizedSchurAssign_v<TT2> >
 {
    BLAZE_INTERNAL_ASSERT( pages()   == (~rhs).pages()  , "Invalid number of pages"  );
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"   );
@@ -2282,6 +2798,53 @@ inline auto DilatedSubtensor<TT,true,CSAs...>::schurAssign( const DenseTensor<TT
 /*! \endcond */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the Schur product assignment of a row-major dense tensor.
+//
+// \param rhs The right-hand side dense tensor for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename TT       // Type of the dense tensor
+        , size_t... CSAs >  // Compile time DilatedSubtensor arguments
+template< typename TT2 >    // Type of the right-hand side dense tensor
+inline auto DilatedSubtensor<TT,true,CSAs...>::schurAssign( const DenseTensor<TT2>& rhs )
+   -> EnableIf_t< VectorizedSchurAssign_v<TT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( pages()   == (~rhs).pages()  , "Invalid number of pages"  );
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"   );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns");
+
+   const size_t jpos( columns() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( columns() - ( columns() % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   for( size_t k=0UL; k<pages(); ++k ) {
+      for( size_t i=0UL; i<rows(); ++i )
+      {
+         size_t j( 0UL );
+         Iterator left( begin( i, k ) );
+         ConstIterator_t<TT2> right( (~rhs).begin( i, k ) );
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         }
+         for( ; j<columns(); ++j ) {
+            *left *= *right; ++left; ++right;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -86,6 +86,8 @@
 #include <iterator>
 
 #include <blaze_tensor/math/constraints/DilatedSubvector.h>
+#include <blaze_tensor/math/simd/Gather.h>
+#include <blaze_tensor/math/simd/Scatter.h>
 #include <blaze_tensor/math/traits/DilatedSubvectorTrait.h>
 #include <blaze_tensor/math/views/dilatedsubvector/BaseTemplate.h>
 #include <blaze_tensor/math/views/dilatedsubvector/DilatedSubvectorData.h>
@@ -409,6 +411,117 @@ class DilatedSubvector<VT,TF,true,CSAs...>
       }
       //*******************************************************************************************
 
+      //**Load function****************************************************************************
+      /*!\brief Load of a SIMD element of the dense dilatedsubvector.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs a strided load of the current SIMD element of the dilatedsubvector
+      // iterator. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function explicitly
+      // might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType load() const noexcept {
+         return gather( &*iterator_, dilation_ );
+      }
+      //*******************************************************************************************
+
+      //**Loada function***************************************************************************
+      /*!\brief Aligned load of a SIMD element of the dense dilatedsubvector.
+      //
+      // \return The loaded SIMD element.
+      //
+      // The elements of a dilatedsubvector are never aligned, therefore this function performs
+      // the same strided load as the load() function. This function must \b NOT be called
+      // explicitly! It is used internally for the performance optimized evaluation of expression
+      // templates. Calling this function explicitly might result in erroneous results and/or in
+      // compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType loada() const noexcept {
+         return load();
+      }
+      //*******************************************************************************************
+
+      //**Loadu function***************************************************************************
+      /*!\brief Unaligned load of a SIMD element of the dense dilatedsubvector.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs an unaligned, strided load of the current SIMD element of the
+      // dilatedsubvector iterator. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling this
+      // function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType loadu() const noexcept {
+         return load();
+      }
+      //*******************************************************************************************
+
+      //**Store function***************************************************************************
+      /*!\brief Store of a SIMD element of the dense dilatedsubvector.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs a strided store of the current SIMD element of the dilatedsubvector
+      // iterator. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function explicitly
+      // might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void store( const SIMDType& value ) const noexcept {
+         scatter( &*iterator_, dilation_, value );
+      }
+      //*******************************************************************************************
+
+      //**Storea function**************************************************************************
+      /*!\brief Aligned store of a SIMD element of the dense dilatedsubvector.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // The elements of a dilatedsubvector are never aligned, therefore this function performs
+      // the same strided store as the store() function. This function must \b NOT be called
+      // explicitly! It is used internally for the performance optimized evaluation of expression
+      // templates. Calling this function explicitly might result in erroneous results and/or in
+      // compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void storea( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
+      //**Storeu function**************************************************************************
+      /*!\brief Unaligned store of a SIMD element of the dense dilatedsubvector.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an unaligned, strided store of the current SIMD element of the
+      // dilatedsubvector iterator. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling this
+      // function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void storeu( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
+      //**Stream function**************************************************************************
+      /*!\brief Aligned, non-temporal store of a SIMD element of the dense dilatedsubvector.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // Strided elements cannot be streamed, therefore this function performs the same strided
+      // store as the store() function. This function must \b NOT be called explicitly! It is
+      // used internally for the performance optimized evaluation of expression templates. Calling
+      // this function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void stream( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
       //**Base function****************************************************************************
       /*!\brief Access to the current position of the dilatedsubvector iterator.
       //
@@ -447,7 +560,7 @@ class DilatedSubvector<VT,TF,true,CSAs...>
 
    //**Compilation flags***************************************************************************
    //! Compilation switch for the expression template evaluation strategy.
-   static constexpr bool simdEnabled = false;
+   static constexpr bool simdEnabled = VT::simdEnabled && IsContiguous_v<VT>;
 
    //! Compilation switch for the expression template assignment strategy.
    static constexpr bool smpAssignable = VT::smpAssignable;
@@ -527,6 +640,53 @@ class DilatedSubvector<VT,TF,true,CSAs...>
    //@}
    //**********************************************************************************************
 
+ private:
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT2 >
+   static constexpr bool VectorizedAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && VT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<VT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT2 >
+   static constexpr bool VectorizedAddAssign_v =
+      ( VectorizedAssign_v<VT2> &&
+        HasSIMDAdd_v< ElementType, ElementType_t<VT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT2 >
+   static constexpr bool VectorizedSubAssign_v =
+      ( VectorizedAssign_v<VT2> &&
+        HasSIMDSub_v< ElementType, ElementType_t<VT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT2 >
+   static constexpr bool VectorizedMultAssign_v =
+      ( VectorizedAssign_v<VT2> &&
+        HasSIMDMult_v< ElementType, ElementType_t<VT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT2 >
+   static constexpr bool VectorizedDivAssign_v =
+      ( VectorizedAssign_v<VT2> &&
+        HasSIMDDiv_v< ElementType, ElementType_t<VT2> > );
+   //**********************************************************************************************
+
+   //**SIMD properties*****************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
+   //**********************************************************************************************
+
  public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
@@ -546,19 +706,52 @@ class DilatedSubvector<VT,TF,true,CSAs...>
    inline bool isAligned   () const noexcept { return false; }
    inline bool canSMPAssign() const noexcept;
 
-   template< typename VT2 > inline void assign( const DenseVector <VT2,TF>& rhs );
+   BLAZE_ALWAYS_INLINE SIMDType load ( size_t index ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loada( size_t index ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loadu( size_t index ) const noexcept;
+
+   BLAZE_ALWAYS_INLINE void store ( size_t index, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storea( size_t index, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storeu( size_t index, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void stream( size_t index, const SIMDType& value ) noexcept;
+
+   template< typename VT2 >
+   inline auto assign( const DenseVector<VT2,TF>& rhs ) -> EnableIf_t< !VectorizedAssign_v<VT2> >;
+
+   template< typename VT2 >
+   inline auto assign( const DenseVector<VT2,TF>& rhs ) -> EnableIf_t< VectorizedAssign_v<VT2> >;
+
 //    template< typename VT2 > inline void assign( const SparseVector<VT2,TF>& rhs );
 
-   template< typename VT2 > inline void addAssign( const DenseVector <VT2,TF>& rhs );
+   template< typename VT2 >
+   inline auto addAssign( const DenseVector<VT2,TF>& rhs ) -> EnableIf_t< !VectorizedAddAssign_v<VT2> >;
+
+   template< typename VT2 >
+   inline auto addAssign( const DenseVector<VT2,TF>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<VT2> >;
+
 //    template< typename VT2 > inline void addAssign( const SparseVector<VT2,TF>& rhs );
 
-   template< typename VT2 > inline void subAssign( const DenseVector <VT2,TF>& rhs );
+   template< typename VT2 >
+   inline auto subAssign( const DenseVector<VT2,TF>& rhs ) -> EnableIf_t< !VectorizedSubAssign_v<VT2> >;
+
+   template< typename VT2 >
+   inline auto subAssign( const DenseVector<VT2,TF>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<VT2> >;
+
 //    template< typename VT2 > inline void subAssign( const SparseVector<VT2,TF>& rhs );
 
-   template< typename VT2 > inline void multAssign( const DenseVector <VT2,TF>& rhs );
+   template< typename VT2 >
+   inline auto multAssign( const DenseVector<VT2,TF>& rhs ) -> EnableIf_t< !VectorizedMultAssign_v<VT2> >;
+
+   template< typename VT2 >
+   inline auto multAssign( const DenseVector<VT2,TF>& rhs ) -> EnableIf_t< VectorizedMultAssign_v<VT2> >;
+
 //    template< typename VT2 > inline void multAssign( const SparseVector<VT2,TF>& rhs );
 
-   template< typename VT2 > inline void divAssign( const DenseVector <VT2,TF>& rhs );
+   template< typename VT2 >
+   inline auto divAssign( const DenseVector<VT2,TF>& rhs ) -> EnableIf_t< !VectorizedDivAssign_v<VT2> >;
+
+   template< typename VT2 >
+   inline auto divAssign( const DenseVector<VT2,TF>& rhs ) -> EnableIf_t< VectorizedDivAssign_v<VT2> >;
    //@}
    //**********************************************************************************************
 
@@ -1633,6 +1826,186 @@ inline bool DilatedSubvector<VT,TF,true,CSAs...>::canSMPAssign() const noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Load of a SIMD element of the dense dilatedsubvector.
+//
+// \param index Access index. The index must be smaller than the number of dilatedsubvector elements.
+// \return The loaded SIMD element.
+//
+// This function gathers the SIMDSIZE elements starting at the given index, which are dilation()
+// elements apart in the underlying vector. In case the dilation is 1 the gather degenerates to a
+// contiguous unaligned load. This function must \b NOT be called explicitly! It is used internally
+// for the performance optimized evaluation of expression templates. Calling this function
+// explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubvector<VT,TF,true,CSAs...>::SIMDType
+   DilatedSubvector<VT,TF,true,CSAs...>::load( size_t index ) const noexcept
+{
+   return loadu( index );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned load of a SIMD element of the dense dilatedsubvector.
+//
+// \param index Access index. The index must be smaller than the number of dilatedsubvector elements.
+// \return The loaded SIMD element.
+//
+// The elements of a dilatedsubvector are never aligned, therefore this function performs the same
+// strided load as the load() function. This function must \b NOT be called explicitly! It is used
+// internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubvector<VT,TF,true,CSAs...>::SIMDType
+   DilatedSubvector<VT,TF,true,CSAs...>::loada( size_t index ) const noexcept
+{
+   return loadu( index );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned load of a SIMD element of the dense dilatedsubvector.
+//
+// \param index Access index. The index must be smaller than the number of dilatedsubvector elements.
+// \return The loaded SIMD element.
+//
+// This function performs the strided load of the SIMD element starting at the given index. This
+// function must \b NOT be called explicitly! It is used internally for the performance optimized
+// evaluation of expression templates. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubvector<VT,TF,true,CSAs...>::SIMDType
+   DilatedSubvector<VT,TF,true,CSAs...>::loadu( size_t index ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( index < size(), "Invalid dilatedsubvector access index" );
+   BLAZE_INTERNAL_ASSERT( index + SIMDSIZE <= size(), "Invalid dilatedsubvector access index" );
+
+   return gather( data() + index*dilation(), dilation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Store of a SIMD element of the dense dilatedsubvector.
+//
+// \param index Access index. The index must be smaller than the number of dilatedsubvector elements.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function scatters the SIMDSIZE elements of the given SIMD element to the dilatedsubvector,
+// starting at the given index. In case the dilation is 1 the scatter degenerates to a contiguous
+// unaligned store. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly might
+// result in erroneous results and/or in compilation errors.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubvector<VT,TF,true,CSAs...>::store( size_t index, const SIMDType& value ) noexcept
+{
+   storeu( index, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned store of a SIMD element of the dense dilatedsubvector.
+//
+// \param index Access index. The index must be smaller than the number of dilatedsubvector elements.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// The elements of a dilatedsubvector are never aligned, therefore this function performs the same
+// strided store as the store() function. This function must \b NOT be called explicitly! It is used
+// internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubvector<VT,TF,true,CSAs...>::storea( size_t index, const SIMDType& value ) noexcept
+{
+   storeu( index, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned store of a SIMD element of the dense dilatedsubvector.
+//
+// \param index Access index. The index must be smaller than the number of dilatedsubvector elements.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs the strided store of the SIMD element starting at the given index. This
+// function must \b NOT be called explicitly! It is used internally for the performance optimized
+// evaluation of expression templates. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubvector<VT,TF,true,CSAs...>::storeu( size_t index, const SIMDType& value ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( index < size(), "Invalid dilatedsubvector access index" );
+   BLAZE_INTERNAL_ASSERT( index + SIMDSIZE <= size(), "Invalid dilatedsubvector access index" );
+
+   scatter( data() + index*dilation(), dilation(), value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned, non-temporal store of a SIMD element of the dense dilatedsubvector.
+//
+// \param index Access index. The index must be smaller than the number of dilatedsubvector elements.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// Strided elements cannot be streamed, therefore this function performs the same strided store as
+// the store() function. This function must \b NOT be called explicitly! It is used internally for
+// the performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubvector<VT,TF,true,CSAs...>::stream( size_t index, const SIMDType& value ) noexcept
+{
+   storeu( index, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
@@ -1650,7 +2023,8 @@ template< typename VT       // Type of the dense vector
         , bool TF           // Transpose flag
         , size_t... CSAs >  // Compile time dilatedsubvector arguments
 template< typename VT2 >    // Type of the right-hand side dense vector
-inline void DilatedSubvector<VT,TF,true,CSAs...>::assign( const DenseVector<VT2,TF>& rhs )
+inline auto DilatedSubvector<VT,TF,true,CSAs...>::assign( const DenseVector<VT2,TF>& rhs )
+   -> EnableIf_t< !VectorizedAssign_v<VT2> >
 {
    BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
 
@@ -1667,6 +2041,47 @@ inline void DilatedSubvector<VT,TF,true,CSAs...>::assign( const DenseVector<VT2,
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+template< typename VT2 >    // Type of the right-hand side dense vector
+inline auto DilatedSubvector<VT,TF,true,CSAs...>::assign( const DenseVector<VT2,TF>& rhs )
+   -> EnableIf_t< VectorizedAssign_v<VT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( size() - ( size() % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+   Iterator left( begin() );
+   ConstIterator_t<VT2> right( (~rhs).begin() );
+
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; i<size(); ++i ) {
+      *left = *right; ++left; ++right;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
@@ -1711,7 +2126,8 @@ template< typename VT       // Type of the dense vector
         , bool TF           // Transpose flag
         , size_t... CSAs >  // Compile time dilatedsubvector arguments
 template< typename VT2 >    // Type of the right-hand side dense vector
-inline void DilatedSubvector<VT,TF,true,CSAs...>::addAssign( const DenseVector<VT2,TF>& rhs )
+inline auto DilatedSubvector<VT,TF,true,CSAs...>::addAssign( const DenseVector<VT2,TF>& rhs )
+   -> EnableIf_t< !VectorizedAddAssign_v<VT2> >
 {
    BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
 
@@ -1728,6 +2144,47 @@ inline void DilatedSubvector<VT,TF,true,CSAs...>::addAssign( const DenseVector<V
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the addition assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+template< typename VT2 >    // Type of the right-hand side dense vector
+inline auto DilatedSubvector<VT,TF,true,CSAs...>::addAssign( const DenseVector<VT2,TF>& rhs )
+   -> EnableIf_t< VectorizedAddAssign_v<VT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( size() - ( size() % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+   Iterator left( begin() );
+   ConstIterator_t<VT2> right( (~rhs).begin() );
+
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; i<size(); ++i ) {
+      *left += *right; ++left; ++right;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the addition assignment of a sparse vector.
@@ -1771,7 +2228,8 @@ template< typename VT       // Type of the dense vector
         , bool TF           // Transpose flag
         , size_t... CSAs >  // Compile time dilatedsubvector arguments
 template< typename VT2 >    // Type of the right-hand side dense vector
-inline void DilatedSubvector<VT,TF,true,CSAs...>::subAssign( const DenseVector<VT2,TF>& rhs )
+inline auto DilatedSubvector<VT,TF,true,CSAs...>::subAssign( const DenseVector<VT2,TF>& rhs )
+   -> EnableIf_t< !VectorizedSubAssign_v<VT2> >
 {
    BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
 
@@ -1788,6 +2246,47 @@ inline void DilatedSubvector<VT,TF,true,CSAs...>::subAssign( const DenseVector<V
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the subtraction assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+template< typename VT2 >    // Type of the right-hand side dense vector
+inline auto DilatedSubvector<VT,TF,true,CSAs...>::subAssign( const DenseVector<VT2,TF>& rhs )
+   -> EnableIf_t< VectorizedSubAssign_v<VT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( size() - ( size() % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+   Iterator left( begin() );
+   ConstIterator_t<VT2> right( (~rhs).begin() );
+
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; i<size(); ++i ) {
+      *left -= *right; ++left; ++right;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the subtraction assignment of a sparse vector.
@@ -1831,7 +2330,8 @@ template< typename VT       // Type of the dense vector
         , bool TF           // Transpose flag
         , size_t... CSAs >  // Compile time dilatedsubvector arguments
 template< typename VT2 >    // Type of the right-hand side dense vector
-inline void DilatedSubvector<VT,TF,true,CSAs...>::multAssign( const DenseVector<VT2,TF>& rhs )
+inline auto DilatedSubvector<VT,TF,true,CSAs...>::multAssign( const DenseVector<VT2,TF>& rhs )
+   -> EnableIf_t< !VectorizedMultAssign_v<VT2> >
 {
    BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
 
@@ -1848,6 +2348,47 @@ inline void DilatedSubvector<VT,TF,true,CSAs...>::multAssign( const DenseVector<
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the multiplication assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+template< typename VT2 >    // Type of the right-hand side dense vector
+inline auto DilatedSubvector<VT,TF,true,CSAs...>::multAssign( const DenseVector<VT2,TF>& rhs )
+   -> EnableIf_t< VectorizedMultAssign_v<VT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( size() - ( size() % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+   Iterator left( begin() );
+   ConstIterator_t<VT2> right( (~rhs).begin() );
+
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; i<size(); ++i ) {
+      *left *= *right; ++left; ++right;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the multiplication assignment of a sparse vector.
@@ -1904,7 +2445,8 @@ template< typename VT       // Type of the dense vector
         , bool TF           // Transpose flag
         , size_t... CSAs >  // Compile time dilatedsubvector arguments
 template< typename VT2 >    // Type of the right-hand side dense vector
-inline void DilatedSubvector<VT,TF,true,CSAs...>::divAssign( const DenseVector<VT2,TF>& rhs )
+inline auto DilatedSubvector<VT,TF,true,CSAs...>::divAssign( const DenseVector<VT2,TF>& rhs )
+   -> EnableIf_t< !VectorizedDivAssign_v<VT2> >
 {
    BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
 
@@ -1919,6 +2461,47 @@ inline void DilatedSubvector<VT,TF,true,CSAs...>::divAssign( const DenseVector<V
 }
 /*! \endcond */
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the division assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector divisor.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+template< typename VT2 >    // Type of the right-hand side dense vector
+inline auto DilatedSubvector<VT,TF,true,CSAs...>::divAssign( const DenseVector<VT2,TF>& rhs )
+   -> EnableIf_t< VectorizedDivAssign_v<VT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( size() - ( size() % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+   Iterator left( begin() );
+   ConstIterator_t<VT2> right( (~rhs).begin() );
+
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      left.store( left.load() / right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+   }
+   for( ; i<size(); ++i ) {
+      *left /= *right; ++left; ++right;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
 } // namespace blaze
 
 #endif
@@ -112,6 +112,48 @@ constexpr size_t SMP_DTENSASSIGN_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP dense array assignment threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DARRASSIGN_THRESHOLD while the Blaze
+// debug mode is active. It specifies when an assignment with a simple dense array can be executed
+// in parallel. In case the number of elements of the target array is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DARRASSIGN_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense tensor reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DTENSREDUCE_THRESHOLD while the Blaze
+// debug mode is active. It specifies when the total reduction of a dense tensor can be executed
+// in parallel. In case the number of elements of the tensor is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DTENSREDUCE_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense array reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DARRREDUCE_THRESHOLD while the Blaze
+// debug mode is active. It specifies when the total reduction of a dense array can be executed
+// in parallel. In case the number of elements of the array is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DARRREDUCE_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief SMP row-major dense matrix/dense vector multiplication threshold.
 // \ingroup config
@@ -144,6 +186,9 @@ constexpr size_t SMP_DTENSDMATSCHUR_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 constexpr size_t SMP_DTENSASSIGN_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DTENSASSIGN_DEBUG_THRESHOLD    : BLAZE_SMP_DTENSASSIGN_THRESHOLD     );
+constexpr size_t SMP_DARRASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DARRASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DARRASSIGN_THRESHOLD      );
+constexpr size_t SMP_DTENSREDUCE_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DTENSREDUCE_DEBUG_THRESHOLD    : BLAZE_SMP_DTENSREDUCE_THRESHOLD     );
+constexpr size_t SMP_DARRREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DARRREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_DARRREDUCE_THRESHOLD      );
 constexpr size_t SMP_DTENSDMATSCHUR_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DTENSDMATSCHUR_DEBUG_THRESHOLD : BLAZE_SMP_DTENSDMATSCHUR_THRESHOLD  );
 constexpr size_t SMP_DTENSDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DTENSDVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DTENSDVECMULT_THRESHOLD  );
 /*! \endcond */
@@ -167,6 +212,9 @@ namespace {
 BLAZE_STATIC_ASSERT( blaze::DTENSDVECMULT_THRESHOLD  > 0UL );
 
 BLAZE_STATIC_ASSERT( blaze::SMP_DTENSASSIGN_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DARRASSIGN_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DTENSREDUCE_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DARRREDUCE_THRESHOLD     >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DTENSDMATSCHUR_THRESHOLD >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DTENSDVECMULT_THRESHOLD  >= 0UL );
 
@@ -0,0 +1,719 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/util/ArenaAllocator.h
+//  \brief Header file for the thread-local arena allocator
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_UTIL_ARENAALLOCATOR_H_
+#define _BLAZE_TENSOR_UTIL_ARENAALLOCATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Thread-local bump allocator for temporary tensors and arrays.
+// \ingroup util
+//
+// The Arena class manages a list of large memory chunks from which memory is handed out by
+// simply advancing an offset. Individual deallocations are no-ops; instead, all memory that has
+// been handed out within an ArenaScope is recycled at once when the scope ends. The chunks
+// themselves are kept alive, so that subsequent scopes reuse the same memory without calling
+// the system allocator. Each thread owns exactly one arena, which is accessible via the
+// Arena::local() function. The arena is used by means of the ArenaAllocator class template,
+// for instance as allocator of a DynamicTensor:
+
+   \code
+   using Tmp = blaze::DynamicTensor< double, blaze::ArenaAllocator<double> >;
+
+   for( const auto& request : batch )
+   {
+      blaze::ArenaScope scope;       // Activates the arena of the calling thread
+
+      Tmp A( exp( request.input ) );  // Memory is taken from the arena
+      Tmp B( A * 2.0 );               // ... as is this
+
+      request.output = A + B;         // The result is allocated as usual
+   }                                  // All arena memory of this iteration is recycled
+   \endcode
+
+// In case the arena allocation of temporaries is enabled (see BLAZE_USE_ARENA_TEMPORARIES),
+// the temporaries that are created internally during the evaluation of an expression (as for
+// instance the evaluated operands of a tensor multiplication or the temporary result of an
+// aliased assignment, see TemporaryTrait) are taken from the arena as well while an ArenaScope
+// is open. Otherwise they use the default allocator. Results that are returned by value, for
+// instance by softmax(), are always allocated as usual, since they outlive the function that
+// creates them.
+//
+// Every allocation remembers the arena it has been taken from. Therefore tensors and arrays
+// using an ArenaAllocator may be destroyed on any thread (for instance by an OpenMP worker or
+// after a move to another thread) and tensors allocated outside of an ArenaScope may be
+// destroyed within one. However, the following lifetime rules apply to all tensors and arrays
+// holding arena memory:
+//
+//  - they must be destroyed before the ArenaScope they have been allocated in ends, since the
+//    memory is handed out again afterwards;
+//  - they must be destroyed before release() is called on their arena and before the thread
+//    owning the arena exits.
+//
+// In debug builds (see BLAZE_USER_ASSERT) a violation of the first two rules is detected when
+// the scope ends or the arena is released, respectively.
+*/
+class Arena
+{
+ public:
+   //**Type definitions****************************************************************************
+   //! Position within the arena.
+   struct Marker {
+      size_t chunk;   //!< Index of the current chunk.
+      size_t offset;  //!< Offset within the current chunk.
+   };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline Arena( size_t chunkSize = 1048576UL ) noexcept;
+
+   Arena( const Arena& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~Arena();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   Arena& operator=( const Arena& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline Arena& local() noexcept;
+
+   inline void*  allocate  ( size_t bytes, size_t alignment );
+   inline void   deallocate( const void* ptr ) noexcept;
+   inline bool   owns      ( const void* ptr ) const noexcept;
+   inline size_t live      () const noexcept;
+   inline bool   isActive() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline Marker mark    () const noexcept;
+   inline void   rewind  ( const Marker& marker ) noexcept;
+   inline void   release () noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   //! Memory chunk of the arena.
+   struct Chunk {
+      byte_t* data;  //!< The first byte of the chunk.
+      size_t  size;  //!< The size of the chunk in bytes.
+   };
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<Chunk> chunks_;  //!< The memory chunks of the arena.
+   size_t chunk_;               //!< Index of the current chunk.
+   size_t offset_;              //!< Offset of the next free byte in the current chunk.
+   size_t chunkSize_;           //!< The minimum size of newly allocated chunks.
+   size_t depth_;               //!< The number of active scopes.
+   std::atomic<size_t> live_;   //!< The number of handed out, not yet deallocated blocks.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   friend class ArenaScope;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for Arena.
+//
+// \param chunkSize The minimum size of the memory chunks in bytes.
+//
+// No memory is allocated until the first allocation request.
+*/
+inline Arena::Arena( size_t chunkSize ) noexcept
+   : chunks_   ()            // The memory chunks of the arena
+   , chunk_    ( 0UL )       // Index of the current chunk
+   , offset_   ( 0UL )       // Offset of the next free byte
+   , chunkSize_( chunkSize ) // The minimum size of newly allocated chunks
+   , depth_    ( 0UL )       // The number of active scopes
+   , live_     ( 0UL )       // The number of handed out, not yet deallocated blocks
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for Arena.
+*/
+inline Arena::~Arena()
+{
+   release();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the arena of the calling thread.
+//
+// \return Reference to the thread-local arena.
+*/
+inline Arena& Arena::local() noexcept
+{
+   static thread_local Arena arena;
+   return arena;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocation of memory from the arena.
+//
+// \param bytes The number of bytes to be allocated.
+// \param alignment The required alignment of the memory (must be a power of two).
+// \return Pointer to the allocated memory.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function hands out the next \a bytes bytes of the current chunk. In case the current
+// chunk is exhausted, the next chunk is used, and only in case no large enough chunk is left,
+// a new chunk is allocated from the system. Every block handed out by this function has to be
+// returned via deallocate() once it is no longer used.
+*/
+inline void* Arena::allocate( size_t bytes, size_t alignment )
+{
+   BLAZE_INTERNAL_ASSERT( ( alignment & ( alignment-1UL ) ) == 0UL, "Invalid alignment" );
+
+   while( chunk_ < chunks_.size() )
+   {
+      const Chunk& chunk( chunks_[chunk_] );
+      const size_t address( reinterpret_cast<size_t>( chunk.data ) + offset_ );
+      const size_t begin( offset_ + ( ( alignment - address % alignment ) % alignment ) );
+
+      if( begin + bytes <= chunk.size ) {
+         offset_ = begin + bytes;
+         ++live_;
+         return chunk.data + begin;
+      }
+
+      ++chunk_;
+      offset_ = 0UL;
+   }
+
+   const size_t size( ( bytes + alignment > chunkSize_ )?( bytes + alignment ):( chunkSize_ ) );
+   const Chunk chunk{ blaze::allocate<byte_t>( size ), size };
+
+   try {
+      chunks_.push_back( chunk );
+   }
+   catch( ... ) {
+      blaze::deallocate( chunk.data );
+      throw;
+   }
+
+   chunk_  = chunks_.size() - 1UL;
+   offset_ = 0UL;
+
+   return allocate( bytes, alignment );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returning a block of memory to the arena.
+//
+// \param ptr The block to be returned.
+// \return void
+//
+// The memory itself is only recycled when the enclosing ArenaScope ends. This function may be
+// called on any thread. The owning arena of a block is identified by the header written by the
+// ArenaAllocator, therefore the chunks of the arena are not inspected.
+*/
+inline void Arena::deallocate( const void* ptr ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( live_ > 0UL, "Arena memory returned twice" );
+
+   MAYBE_UNUSED( ptr );
+
+   --live_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given memory has been handed out by the arena.
+//
+// \param ptr The pointer to be checked.
+// \return \a true in case the pointer refers to arena memory, \a false if not.
+//
+// This function inspects the chunks of the arena and must therefore only be called on the
+// thread that owns the arena.
+*/
+inline bool Arena::owns( const void* ptr ) const noexcept
+{
+   const byte_t* p( static_cast<const byte_t*>( ptr ) );
+
+   for( const Chunk& chunk : chunks_ ) {
+      if( p >= chunk.data && p < chunk.data + chunk.size )
+         return true;
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of blocks that have been handed out and not yet returned.
+//
+// \return The number of live blocks.
+*/
+inline size_t Arena::live() const noexcept
+{
+   return live_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the arena is active, i.e. whether an ArenaScope is open.
+//
+// \return \a true in case the arena is active, \a false if not.
+*/
+inline bool Arena::isActive() const noexcept
+{
+   return depth_ > 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total size of all memory chunks of the arena.
+//
+// \return The capacity of the arena in bytes.
+*/
+inline size_t Arena::capacity() const noexcept
+{
+   size_t total( 0UL );
+   for( const Chunk& chunk : chunks_ ) {
+      total += chunk.size;
+   }
+   return total;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current position within the arena.
+//
+// \return The current position.
+*/
+inline Arena::Marker Arena::mark() const noexcept
+{
+   return Marker{ chunk_, offset_ };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Recycling of all memory handed out after the given position.
+//
+// \param marker The position to return to.
+// \return void
+*/
+inline void Arena::rewind( const Marker& marker ) noexcept
+{
+   chunk_  = marker.chunk;
+   offset_ = marker.offset;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returning all memory chunks of the arena to the system.
+//
+// \return void
+//
+// This function must not be called while an ArenaScope is open or while any tensor or array
+// still holds memory of the arena.
+*/
+inline void Arena::release() noexcept
+{
+   BLAZE_USER_ASSERT( depth_ == 0UL, "Arena released within an active scope" );
+   BLAZE_USER_ASSERT( live_  == 0UL, "Arena released while its memory is still in use" );
+
+   for( const Chunk& chunk : chunks_ ) {
+      blaze::deallocate( chunk.data );
+   }
+
+   chunks_.clear();
+   chunk_  = 0UL;
+   offset_ = 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ARENASCOPE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scope guard for the arena of the calling thread.
+// \ingroup util
+//
+// An ArenaScope activates the arena of the calling thread for its lifetime. While a scope is
+// open, all allocations via an ArenaAllocator on this thread are served from the arena. When
+// the scope ends, all arena memory that has been handed out within the scope is recycled.
+// Scopes can be nested; an inner scope only recycles the memory handed out within itself.
+// All tensors and arrays that have taken memory from the arena within the scope must have been
+// destroyed when the scope ends.
+*/
+class ArenaScope
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline ArenaScope() noexcept
+      : arena_ ( Arena::local() )  // The arena of the calling thread
+      , marker_( arena_.mark() )   // The position of the arena at the beginning of the scope
+      , live_  ( arena_.live() )   // The number of live blocks at the beginning of the scope
+   {
+      ++arena_.depth_;
+   }
+
+   ArenaScope( const ArenaScope& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~ArenaScope()
+   {
+      BLAZE_USER_ASSERT( arena_.live() <= live_, "Arena memory outlives its scope" );
+
+      arena_.rewind( marker_ );
+      --arena_.depth_;
+   }
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   ArenaScope& operator=( const ArenaScope& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Arena& arena_;         //!< The arena of the calling thread.
+   Arena::Marker marker_; //!< The position of the arena at the beginning of the scope.
+   size_t live_;          //!< The number of live blocks at the beginning of the scope.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ARENAALLOCATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocator drawing memory from the arena of the calling thread.
+// \ingroup util
+//
+// The ArenaAllocator class template is a stateless allocator that serves all allocations from
+// the arena of the calling thread in case an ArenaScope is open, and from the aligned system
+// allocator (see AlignedAllocator) otherwise. Each allocation is preceded by a small header
+// recording the arena it has been taken from (or none), such that the memory is returned to
+// its origin independent of the thread that deallocates it. Deallocations of arena memory do
+// not release the memory; it is recycled by the according ArenaScope. The allocator can be used
+// as allocator of the DynamicTensor and DynamicArray class templates. See the Arena class for
+// the lifetime rules of arena memory.
+*/
+template< typename Type >  // Type of the allocated elements
+class ArenaAllocator
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ValueType      = Type;               //!< Type of the allocated values.
+   using Pointer        = Type*;              //!< Type of a pointer to the allocated values.
+   using ConstPointer   = const Type*;        //!< Pointer-to-const to the allocated values.
+   using Reference      = Type&;              //!< Type of a reference to the allocated values.
+   using ConstReference = const Type&;        //!< Reference-to-const to the allocated values.
+   using SizeType       = std::size_t;        //!< Size type of the arena allocator.
+   using DifferenceType = std::ptrdiff_t;     //!< Difference type of the arena allocator.
+
+   // STL allocator requirements
+   using value_type      = ValueType;       //!< Type of the allocated values.
+   using pointer         = Pointer;         //!< Type of a pointer to the allocated values.
+   using const_pointer   = ConstPointer;    //!< Pointer-to-const to the allocated values.
+   using reference       = Reference;       //!< Type of a reference to the allocated values.
+   using const_reference = ConstReference;  //!< Reference-to-const to the allocated values.
+   using size_type       = SizeType;        //!< Size type of the arena allocator.
+   using difference_type = DifferenceType;  //!< Difference type of the arena allocator.
+   //**********************************************************************************************
+
+   //**rebind class definition*********************************************************************
+   /*!\brief Implementation of the ArenaAllocator rebind mechanism.
+   */
+   template< typename Type2 >
+   struct rebind
+   {
+      using other = ArenaAllocator<Type2>;  //!< Type of the other allocator.
+   };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   ArenaAllocator() noexcept = default;
+
+   template< typename Type2 >
+   inline ArenaAllocator( const ArenaAllocator<Type2>& ) noexcept {}
+   //@}
+   //**********************************************************************************************
+
+   //**Allocation functions************************************************************************
+   /*!\name Allocation functions */
+   //@{
+   inline Pointer allocate  ( size_t numObjects );
+   inline void    deallocate( Pointer ptr, size_t numObjects ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   //! The alignment of the allocated memory.
+   static constexpr size_t alignment = AlignmentOf_v<Type>;
+
+   //! The number of bytes required in front of each allocation for the owning arena.
+   static constexpr size_t headerBytes = ( alignment > sizeof(Arena*) ? alignment : sizeof(Arena*) );
+
+   //! The number of elements reserved in front of each allocation for the owning arena.
+   static constexpr size_t header = ( headerBytes + sizeof(Type) - 1UL ) / sizeof(Type);
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT( ( header * sizeof(Type) ) % alignment == 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocates aligned memory for the specified number of objects.
+//
+// \param numObjects The number of objects to be allocated.
+// \return Pointer to the newly allocated memory.
+// \exception std::bad_alloc Allocation failed.
+//
+// In case an ArenaScope is open on the calling thread, the memory is taken from the arena of
+// the calling thread. Otherwise the memory is allocated via the aligned system allocator. In
+// both cases the origin of the memory is recorded in front of the returned pointer. This
+// function only allocates memory; the objects are not constructed.
+*/
+template< typename Type >
+inline typename ArenaAllocator<Type>::Pointer
+   ArenaAllocator<Type>::allocate( size_t numObjects )
+{
+   Arena& arena( Arena::local() );
+   Arena* owner( nullptr );
+   Pointer ptr( nullptr );
+
+   if( arena.isActive() ) {
+      ptr = static_cast<Pointer>( arena.allocate( ( numObjects+header )*sizeof(Type), alignment ) );
+      owner = &arena;
+   }
+   else {
+      ptr = AlignedAllocator<Type>().allocate( numObjects+header );
+   }
+
+   ptr += header;
+   std::memcpy( reinterpret_cast<byte_t*>( ptr ) - sizeof(Arena*), &owner, sizeof(Arena*) );
+
+   return ptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of memory.
+//
+// \param ptr The address of the first element of the array to be deallocated.
+// \param numObjects The number of objects to be deallocated.
+// \return void
+//
+// Memory taken from an arena is returned to the arena it has been allocated from, which may
+// be the arena of another thread, and is recycled by the according ArenaScope. All other memory
+// is returned to the aligned system allocator.
+*/
+template< typename Type >
+inline void ArenaAllocator<Type>::deallocate( Pointer ptr, size_t numObjects ) noexcept
+{
+   if( ptr == nullptr )
+      return;
+
+   Arena* owner( nullptr );
+   std::memcpy( &owner, reinterpret_cast<const byte_t*>( ptr ) - sizeof(Arena*), sizeof(Arena*) );
+
+   ptr -= header;
+
+   if( owner != nullptr ) {
+      owner->deallocate( ptr );
+   }
+   else {
+      AlignedAllocator<Type>().deallocate( ptr, numObjects+header );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two ArenaAllocator objects.
+//
+// \return \a true.
+*/
+template< typename T1, typename T2 >
+inline bool operator==( const ArenaAllocator<T1>&, const ArenaAllocator<T2>& ) noexcept
+{
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two ArenaAllocator objects.
+//
+// \return \a false.
+*/
+template< typename T1, typename T2 >
+inline bool operator!=( const ArenaAllocator<T1>&, const ArenaAllocator<T2>& ) noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
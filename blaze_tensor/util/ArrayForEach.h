@@ -39,6 +39,7 @@
 #include <array>
 #include <utility>
 
+#include <blaze/system/Inline.h>
 #include <blaze/util/SmallArray.h>
 #include <blaze/util/StaticAssert.h>
 
@@ -368,6 +369,99 @@ void ArrayForEachGrouped(
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief ArrayForEachRow function to iterate over all innermost rows of arbitrary dimension data.
+// \ingroup util
+//
+// The given functor is invoked once per row with the ND index of the first element of that
+// row (i.e. the index with \a currdims[0] == 0).
+*/
+template< size_t N, typename F >
+void ArrayForEachRow(
+   std::array< size_t, N > const& dims, F const& f )
+{
+   BLAZE_STATIC_ASSERT( N >= 2 );
+
+   std::array< size_t, N > rowdims( dims );
+   rowdims[0] = 1UL;
+
+   std::array< size_t, N > currdims{};
+   ArrayForEachGrouped( rowdims, f, currdims );
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of the innermost row identified by \a dims.
+// \ingroup util
+//
+// This function translates the ND index \a dims (with \a dims[0] being the column index) into
+// the variadic \a begin( i, dims... ) call of the given dense array.
+*/
+template< typename AT, size_t N, size_t... Is >
+BLAZE_ALWAYS_INLINE decltype(auto) ArrayRowBegin(
+   AT& array, std::array< size_t, N > const& dims, std::index_sequence< Is... > )
+{
+   return array.begin( dims[1], dims[N - 1 - Is]... );
+}
+
+template< typename AT, size_t N >
+BLAZE_ALWAYS_INLINE decltype(auto) ArrayRowBegin(
+   AT& array, std::array< size_t, N > const& dims )
+{
+   BLAZE_STATIC_ASSERT( N >= 2 );
+   return ArrayRowBegin( array, dims, std::make_index_sequence< N - 2 >{} );
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of flattened pages of an ND array.
+// \ingroup util
+//
+// \param dims The dimensions of the array.
+// \return The product of all dimensions except rows and columns.
+//
+// All dimensions beyond the rows (i.e. \a dims[2] to \a dims[N-1]) are flattened into a single
+// page index, such that an ND array can be partitioned like a tensor.
+*/
+template< size_t N >
+inline size_t getArrayPages( const std::array< size_t, N >& dims ) noexcept
+{
+   size_t pages( 1UL );
+   for( size_t i=2UL; i<N; ++i ) {
+      pages *= dims[i];
+   }
+   return pages;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the ND index of the first element of a row of an ND array.
+// \ingroup util
+//
+// \param dims The dimensions of the array.
+// \param page The flattened page index in the range \f$[0..getArrayPages(dims)-1]\f$.
+// \param row The row index in the range \f$[0..dims[1]-1]\f$.
+// \return The ND index of the first element of the row.
+*/
+template< size_t N >
+inline std::array< size_t, N >
+   getArrayRowIndices( const std::array< size_t, N >& dims, size_t page, size_t row ) noexcept
+{
+   std::array< size_t, N > indices{};
+   indices[1] = row;
+   for( size_t i=2UL; i<N; ++i ) {
+      indices[i] = page % dims[i];
+      page /= dims[i];
+   }
+   return indices;
+}
+/*! \endcond */
+//*************************************************************************************************
+
 //*************************************************************************************************
 /*!\brief ArrayForEach2 function to iterate over arbitrary dimension data.
 // \ingroup util
@@ -0,0 +1,141 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/util/Memory.h
+//  \brief Header file for the allocator based element allocation functions
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_UTIL_MEMORY_H_
+#define _BLAZE_TENSOR_UTIL_MEMORY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+
+#include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ALLOCATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocation of an array of elements by means of the given allocator.
+// \ingroup util
+//
+// \param alloc The allocator to be used for the allocation.
+// \param n The number of elements to be allocated.
+// \return Pointer to the first allocated element (\c nullptr in case \a n is 0).
+// \exception std::bad_alloc Allocation failed.
+//
+// This function allocates an array of \a n elements of the value type of the given allocator.
+// Analogous to the blaze::allocate() function, elements of built-in data type are left
+// uninitialized, whereas elements of class type are default constructed.
+*/
+template< typename Alloc >  // Type of the allocator
+inline typename std::allocator_traits<Alloc>::value_type*
+   allocateElements( Alloc& alloc, size_t n )
+{
+   using Traits = std::allocator_traits<Alloc>;
+   using Type   = typename Traits::value_type;
+
+   if( n == 0UL )
+      return nullptr;
+
+   Type* ptr( Traits::allocate( alloc, n ) );
+
+   if( !IsBuiltin_v<Type> )
+   {
+      size_t i( 0UL );
+
+      try {
+         for( ; i<n; ++i ) {
+            ::new( static_cast<void*>( ptr+i ) ) Type;
+         }
+      }
+      catch( ... ) {
+         while( i > 0UL ) {
+            ptr[--i].~Type();
+         }
+         Traits::deallocate( alloc, ptr, n );
+         throw;
+      }
+   }
+
+   return ptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of an array of elements by means of the given allocator.
+// \ingroup util
+//
+// \param alloc The allocator that has been used for the allocation.
+// \param ptr Pointer to the first element of the array (may be \c nullptr).
+// \param n The number of elements of the array.
+// \return void
+//
+// This function destroys and deallocates an array of \a n elements that has been allocated by
+// the allocateElements() function.
+*/
+template< typename Alloc >  // Type of the allocator
+inline void deallocateElements( Alloc& alloc,
+                                typename std::allocator_traits<Alloc>::value_type* ptr,
+                                size_t n ) noexcept
+{
+   using Traits = std::allocator_traits<Alloc>;
+   using Type   = typename Traits::value_type;
+
+   if( ptr == nullptr )
+      return;
+
+   if( !IsBuiltin_v<Type> ) {
+      for( size_t i=0UL; i<n; ++i ) {
+         ptr[i].~Type();
+      }
+   }
+
+   Traits::deallocate( alloc, ptr, n );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -105,12 +105,17 @@ class GeneralTest
    void testMinimum();
    void testMaximum();
    void testSoftmax();
+   void testMeanVar();
 //    void testTrace();
    void testL1Norm();
    void testL2Norm();
    void testL3Norm();
    void testL4Norm();
    void testLpNorm();
+   void testSerialization();
+   void testNpy();
+   void testAssignment();
+   void testSMPAssignment();
 
    template< typename Type >
    void checkRows( const Type& tensor, size_t expectedRows ) const;
@@ -105,12 +105,21 @@ class GeneralTest
    void testMinimum();
    void testMaximum();
    void testSoftmax();
+   void testMeanVar();
+   void testArgReduce();
+   void testNormalization();
+   void testBroadcast();
+   void testExpansion();
+   void testSerialization();
+   void testNpy();
 //    void testTrace();
    void testL1Norm();
    void testL2Norm();
    void testL3Norm();
    void testL4Norm();
    void testLpNorm();
+   void testSMPAssignment();
+   void testSMPReduction();
 
    template< typename Type >
    void checkRows( const Type& tensor, size_t expectedRows ) const;
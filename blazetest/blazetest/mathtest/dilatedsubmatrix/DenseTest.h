@@ -116,6 +116,7 @@ class DenseTest
    void testColumn();
    void testColumns();
    void testBand();
+   void testVectorization();
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
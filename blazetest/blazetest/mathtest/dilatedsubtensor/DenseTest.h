@@ -112,6 +112,7 @@ class DenseTest
    void testPageslice();
    void testRowslice();
    void testColumnslice();
+   void testVectorization();
 
 
    template< typename Type >
@@ -102,6 +102,7 @@ class DenseTest
    void testIsSame      ();
    void testDilatedSubvector   ();
    void testElements    ();
+   void testVectorization();
 
    template< typename Type >
    void checkSize( const Type& vector, size_t expectedSize ) const;
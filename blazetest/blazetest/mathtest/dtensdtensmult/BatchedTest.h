@@ -0,0 +1,168 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dtensdtensmult/BatchedTest.h
+//  \brief Header file for the page-batched dense tensor/dense tensor multiplication test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//  Copyright (C) 2019 Bita Hasheminezhad - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZETEST_MATHTEST_DTENSDTENSMULT_BATCHEDTEST_H_
+#define _BLAZETEST_MATHTEST_DTENSDTENSMULT_BATCHEDTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+
+#include <blaze_tensor/math/DynamicTensor.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dtensdtensmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the page-batched dense tensor/dense tensor multiplication test.
+//
+// This class represents a test suite for the dense tensor/dense tensor multiplication, which
+// multiplies the according pages of the two operands. The results of the assignment, addition
+// assignment and subtraction assignment are compared to page-wise dense matrix multiplications
+// for a range of page sizes, which cover both the small and the large tensor kernels, and for
+// subtensor operands and targets, whose pages are not \c rows()*spacing() elements apart.
+*/
+class BatchedTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   using DTens  = blaze::DynamicTensor<int>;     //!< Dense tensor type.
+   using DDTens = blaze::DynamicTensor<double>;  //!< Dense tensor type with BLAS-compatible elements.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit BatchedTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testDTensDTensMult( size_t o, size_t m, size_t k, size_t n );
+   void testSubtensorMult ( size_t o, size_t m, size_t k, size_t n );
+
+   template< typename TT >
+   void checkResult( const TT& computedResult, const TT& A, const TT& B,
+                     const TT& initial, int sign );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename TT >
+   void initialize( TT& tensor, int offset );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the page-batched dense tensor/dense tensor multiplication.
+//
+// \return void
+*/
+void runTest()
+{
+   BatchedTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the page-batched dense tensor/dense tensor multiplication test.
+*/
+#define RUN_DTENSDTENSMULT_BATCHED_TEST \
+   blazetest::mathtest::dtensdtensmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dtensdtensmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -117,6 +117,7 @@ class ClassTest
    void testTranspose   ();
    void testCTranspose  ();
    void testIsDefault   ();
+   void testAllocator   ();
 
    template< typename Type >
    void checkRows( const Type& tensor, size_t expectedRows ) const;
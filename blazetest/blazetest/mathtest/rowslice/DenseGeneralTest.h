@@ -95,6 +95,7 @@ class DenseGeneralTest
    void testSubAssign();
    void testMultAssign();
    void testSchurAssign();
+   void testVectorizedAssign();
    void testScaling();
    void testFunctionCall();
    void testAt();
@@ -38,14 +38,26 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <cmath>
 #include <cstdlib>
 #include <iostream>
+#include <memory>
+#include <sstream>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/CacheSize.h>
 #include <blaze/system/Platform.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Serialization.h>
+#include <blaze/util/policies/Deallocate.h>
 #include <blazetest/mathtest/IsEqual.h>
 
 #include <blaze_tensor/math/CustomArray.h>
 #include <blaze_tensor/math/DynamicArray.h>
+#include <blaze_tensor/math/Serialization.h>
 #include <blaze_tensor/math/dense/DenseArray.h>
+#include <blaze_tensor/system/Thresholds.h>
 
 #include <blazetest/mathtest/densearray/GeneralTest.h>
 
@@ -84,12 +96,17 @@ GeneralTest::GeneralTest()
    testMinimum();
    testMaximum();
    testSoftmax();
+   testMeanVar();
 //    testTrace();
    testL1Norm();
    testL2Norm();
    testL3Norm();
    testL4Norm();
    testLpNorm();
+   testSerialization();
+   testNpy();
+   testAssignment();
+   testSMPAssignment();
 }
 //*************************************************************************************************
 
@@ -2352,6 +2369,30 @@ void GeneralTest::testMinimum()
             throw std::runtime_error( oss.str() );
          }
       }
+
+      // Attempt to find the minimum in the row remainder of a large array
+      {
+         blaze::DynamicArray<3, int> arr( blaze::init_from_value, 3, 3UL, 4UL, 37UL );
+         arr(1,2,16) = -1;
+         arr(2,3,36) = -2;
+
+         checkRows    ( arr,   4UL );
+         checkColumns ( arr,  37UL );
+         checkPages   ( arr,   3UL );
+         checkNonZeros( arr, 444UL );
+
+         const int minimum = min( arr );
+
+         if( minimum != -2 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Sixth computation failed\n"
+                << " Details:\n"
+                << "   Result: " << minimum << "\n"
+                << "   Expected result: -2\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
    }
 }
 //*************************************************************************************************
@@ -2588,6 +2629,68 @@ void GeneralTest::testSoftmax()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the \c meanvar() function family for dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the mean and variance functions for dense arrays. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testMeanVar()
+{
+   //=====================================================================================
+   // Row-major array tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major meanvar()";
+
+      blaze::DynamicArray<3, int> A{ { { 1, 3, 2 }, { 2, 6, 4 } }, { { 9, 6, 3 }, { 4, 5, 2 } } };
+
+      const auto mv = meanvar( A );
+
+      if( !isEqual( mean( A ), 47.0/12.0 ) || !isEqual( mv.first, 47.0/12.0 ) ||
+          !isEqual( var( A ), 683.0/132.0 ) || !isEqual( mv.second, 683.0/132.0 ) ||
+          !isEqual( stddev( A ), std::sqrt( 683.0/132.0 ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mean/variance computation failed\n"
+             << " Details:\n"
+             << "   Result: ( " << mv.first << ", " << mv.second << " )\n"
+             << "   Expected result: ( " << 47.0/12.0 << ", " << 683.0/132.0 << " )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major var<R>()";
+
+      blaze::DynamicArray<3, int> A{ { { 1, 3, 2 }, { 2, 6, 4 } }, { { 9, 6, 3 }, { 4, 5, 2 } } };
+
+      const blaze::DynamicArray<2, double> v0( blaze::var<0UL>( A ) );
+      const blaze::DynamicArray<2, double> v1( blaze::var<1UL>( A ) );
+      const blaze::DynamicArray<2, double> v2( blaze::var<2UL>( A ) );
+
+      const blaze::DynamicArray<2, double> v0ref{ { 1.0, 4.0 }, { 9.0, 7.0/3.0 } };
+      const blaze::DynamicArray<2, double> v1ref{ { 0.5, 4.5, 2.0 }, { 12.5, 0.5, 0.5 } };
+      const blaze::DynamicArray<2, double> v2ref{ { 32.0, 4.5, 0.5 }, { 2.0, 0.5, 2.0 } };
+
+      if( v0 != v0ref || v1 != v1ref || v2 != v2ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Variance computation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << v0 << "\n" << v1 << "\n" << v2 << "\n"
+             << "   Expected result:\n" << v0ref << "\n" << v1ref << "\n" << v2ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 #if 0
 //*************************************************************************************************
 /*!\brief Test of the \c trace() function for dense arrays.
@@ -2742,6 +2845,23 @@ void GeneralTest::testL1Norm()
             throw std::runtime_error( oss.str() );
          }
       }
+
+      {
+         blaze::DynamicArray< 3, int > arr( blaze::init_from_value, 1, 3UL, 5UL, 37UL );
+         arr(0,0,0) = -4;
+
+         const int norm = blaze::l1Norm( arr );
+
+         if( !isEqual( norm, 558 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: L1 norm computation failed\n"
+                << " Details:\n"
+                << "   Result: " << norm << "\n"
+                << "   Expected result: 558\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
    }
 }
 //*************************************************************************************************
@@ -3105,6 +3225,566 @@ void GeneralTest::testLpNorm()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the (de-)serialization of dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the serialization of dense arrays via blaze::Archive. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testSerialization()
+{
+   {
+      test_ = "Serialization of dense arrays";
+
+      blaze::DynamicArray<4, double> A( 2UL, 3UL, 4UL, 17UL );
+      randomize( A, -5.0, 5.0 );
+
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+
+      archive << A << ( A * 2.0 );
+
+      blaze::DynamicArray<4, double> B, D( 1UL, 1UL, 1UL, 1UL );
+
+      archive >> B >> D;
+
+      if( B != A || D != A * 2.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Serialization failed\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n" << D << "\n"
+             << "   Expected result:\n" << A << "\n" << ( A * 2.0 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Deserialization into an array of different dimensionality";
+
+      blaze::DynamicArray<4, double> A( 2UL, 3UL, 4UL, 17UL );
+      randomize( A, -5.0, 5.0 );
+
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+
+      archive << A;
+
+      blaze::DynamicArray<3, double> B;
+
+      try {
+         archive >> B;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Deserialization into an array of different dimensionality succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( "Invalid number of dimensions" ) == std::string::npos )
+            throw;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the NumPy \c .npy functionality for dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the loadNpy() and saveNpy() functions and of the NpyArray
+// class for dense arrays. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void GeneralTest::testNpy()
+{
+   {
+      test_ = "Npy round-trip of dense arrays";
+
+      blaze::DynamicArray<4, double> A( 2UL, 3UL, 4UL, 17UL );
+      randomize( A, -5.0, 5.0 );
+
+      std::stringstream stream;
+      blaze::saveNpy( stream, A );
+      blaze::saveNpy( stream, A * 2.0 );
+      blaze::saveNpy( stream, A );
+
+      blaze::DynamicArray<4, double> B, D( 1UL, 1UL, 1UL, 1UL );
+      blaze::loadNpy( stream, B );
+      blaze::loadNpy( stream, D );
+
+      blaze::NpyArray file( stream );
+      const blaze::CustomArray<4, double, blaze::unaligned, blaze::unpadded> V(
+         file.array<4, double>() );
+
+      if( B != A || D != A * 2.0 || V != A ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Npy round-trip failed\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n" << D << "\n" << V << "\n"
+             << "   Expected result:\n" << A << "\n" << ( A * 2.0 ) << "\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Loading npy data of different dimensionality";
+
+      blaze::DynamicArray<4, double> A( 2UL, 3UL, 4UL, 17UL );
+      randomize( A, -5.0, 5.0 );
+
+      std::stringstream stream;
+      blaze::saveNpy( stream, A );
+
+      blaze::DynamicArray<3, double> B;
+
+      try {
+         blaze::loadNpy( stream, B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Loading npy data of different dimensionality succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( "Invalid number of dimensions" ) == std::string::npos )
+            throw;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the (compound) assignment kernels of dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the (vectorized) assignment, addition assignment, subtraction
+// assignment, and Schur product assignment of DynamicArray and CustomArray targets. The row
+// length is chosen such that the rows are padded and the kernels have to handle a remainder. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testAssignment()
+{
+   //=====================================================================================
+   // Row-major DynamicArray tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major DynamicArray (compound) assignment";
+
+      blaze::DynamicArray<3, int> A( 5UL, 7UL, 37UL ), B( 5UL, 7UL, 37UL );
+      randomize( A, -5, 5 );
+      randomize( B, -5, 5 );
+
+      blaze::DynamicArray<3, int> C, R( 5UL, 7UL, 37UL );
+      C  = A * 2;
+      C += max( A, B );
+      C -= A;
+      C %= B;
+
+      for( size_t k=0UL; k<5UL; ++k ) {
+         for( size_t i=0UL; i<7UL; ++i ) {
+            for( size_t j=0UL; j<37UL; ++j ) {
+               R(k,i,j) = ( A(k,i,j) * 2 + std::max( A(k,i,j), B(k,i,j) ) - A(k,i,j) ) * B(k,i,j);
+            }
+         }
+      }
+
+      if( C != R ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major DynamicArray assignment exceeding the cache size";
+
+      const size_t rows( blaze::cacheSize / ( sizeof(double) * 3UL * 8UL * 131UL ) + 1UL );
+
+      blaze::DynamicArray<3, double> A( 8UL, rows, 131UL );
+      randomize( A, -5.0, 5.0 );
+
+      blaze::DynamicArray<3, double> C;
+      C = A * 2.0;
+
+      for( size_t k=0UL; k<8UL; ++k ) {
+         for( size_t i=0UL; i<rows; ++i ) {
+            for( size_t j=0UL; j<131UL; ++j )
+            {
+               if( !isEqual( C(k,i,j), A(k,i,j) * 2.0 ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Streaming assignment failed\n"
+                      << " Details:\n"
+                      << "   Result: " << C(k,i,j) << "\n"
+                      << "   Expected result: " << A(k,i,j) * 2.0 << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major CustomArray tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CustomArray (compound) assignment (aligned/padded)";
+
+      using blaze::aligned;
+      using blaze::padded;
+
+      const size_t spacing( blaze::nextMultiple<size_t>( 37UL, 16UL ) );
+
+      blaze::DynamicArray<3, int> A( 5UL, 7UL, 37UL ), B( 5UL, 7UL, 37UL );
+      randomize( A, -5, 5 );
+      randomize( B, -5, 5 );
+
+      std::unique_ptr<int[],blaze::Deallocate> memory( blaze::allocate<int>( 5UL*7UL*spacing ) );
+      blaze::CustomArray<3, int, aligned, padded> C( memory.get(), 5UL, 7UL, 37UL, spacing );
+      C  = A * 2;
+      C += max( A, B );
+      C -= A;
+      C %= B;
+
+      blaze::DynamicArray<3, int> R( 5UL, 7UL, 37UL );
+
+      for( size_t k=0UL; k<5UL; ++k ) {
+         for( size_t i=0UL; i<7UL; ++i ) {
+            for( size_t j=0UL; j<37UL; ++j ) {
+               R(k,i,j) = ( A(k,i,j) * 2 + std::max( A(k,i,j), B(k,i,j) ) - A(k,i,j) ) * B(k,i,j);
+            }
+         }
+      }
+
+      if( C != R ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CustomArray (compound) assignment (unaligned/unpadded)";
+
+      using blaze::unaligned;
+      using blaze::unpadded;
+
+      blaze::DynamicArray<3, int> A( 5UL, 7UL, 37UL ), B( 5UL, 7UL, 37UL );
+      randomize( A, -5, 5 );
+      randomize( B, -5, 5 );
+
+      std::unique_ptr<int[]> memory( new int[5UL*7UL*37UL+1UL] );
+      blaze::CustomArray<3, int, unaligned, unpadded> C( memory.get()+1UL, 5UL, 7UL, 37UL );
+      C  = A * 2;
+      C += max( A, B );
+      C -= A;
+      C %= B;
+
+      blaze::DynamicArray<3, int> R( 5UL, 7UL, 37UL );
+
+      for( size_t k=0UL; k<5UL; ++k ) {
+         for( size_t i=0UL; i<7UL; ++i ) {
+            for( size_t j=0UL; j<37UL; ++j ) {
+               R(k,i,j) = ( A(k,i,j) * 2 + std::max( A(k,i,j), B(k,i,j) ) - A(k,i,j) ) * B(k,i,j);
+            }
+         }
+      }
+
+      if( C != R ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP (compound) assignment of dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the shared memory parallel (compound) assignment of dense
+// arrays. The arrays exceed the SMP_DARRASSIGN_THRESHOLD, have four dimensions, and a row length
+// that is not a multiple of the SIMD width, such that the blocks assigned by the individual
+// threads start at arbitrary columns. Additionally, arrays with few wide and many narrow rows
+// and arrays directly at the threshold are assigned. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testSMPAssignment()
+{
+   //=====================================================================================
+   // Row-major DynamicArray tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major DynamicArray SMP (compound) assignment";
+
+      const size_t rows( blaze::SMP_DARRASSIGN_THRESHOLD / ( 3UL * 5UL * 67UL ) + 2UL );
+
+      blaze::DynamicArray<4, int> A( 3UL, 5UL, rows, 67UL ), B( 3UL, 5UL, rows, 67UL );
+      randomize( A, -5, 5 );
+      randomize( B, -5, 5 );
+
+      blaze::DynamicArray<4, int> C, R( 3UL, 5UL, rows, 67UL );
+      C  = A * 2;
+      C += max( A, B );
+      C -= A;
+      C %= B;
+
+      for( size_t l=0UL; l<3UL; ++l ) {
+         for( size_t k=0UL; k<5UL; ++k ) {
+            for( size_t i=0UL; i<rows; ++i ) {
+               for( size_t j=0UL; j<67UL; ++j ) {
+                  R(l,k,i,j) = ( A(l,k,i,j) * 2 + std::max( A(l,k,i,j), B(l,k,i,j) ) - A(l,k,i,j) )
+                             * B(l,k,i,j);
+               }
+            }
+         }
+      }
+
+      if( C != R ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: SMP assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major DynamicArray SMP (compound) assignment (few wide rows)";
+
+      const size_t columns( blaze::SMP_DARRASSIGN_THRESHOLD / 6UL + 13UL );
+
+      blaze::DynamicArray<3, int> A( 3UL, 2UL, columns ), B( 3UL, 2UL, columns );
+      randomize( A, -5, 5 );
+      randomize( B, -5, 5 );
+
+      blaze::DynamicArray<3, int> C, R( 3UL, 2UL, columns );
+      C  = A * 2;
+      C += max( A, B );
+      C -= A;
+      C %= B;
+
+      for( size_t k=0UL; k<3UL; ++k ) {
+         for( size_t i=0UL; i<2UL; ++i ) {
+            for( size_t j=0UL; j<columns; ++j ) {
+               R(k,i,j) = ( A(k,i,j) * 2 + std::max( A(k,i,j), B(k,i,j) ) - A(k,i,j) ) * B(k,i,j);
+            }
+         }
+      }
+
+      if( C != R ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: SMP assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major DynamicArray SMP (compound) assignment (many narrow rows)";
+
+      const size_t rows( blaze::SMP_DARRASSIGN_THRESHOLD / 3UL + 7UL );
+
+      blaze::DynamicArray<2, int> A( rows, 3UL ), B( rows, 3UL );
+      randomize( A, -5, 5 );
+      randomize( B, -5, 5 );
+
+      blaze::DynamicArray<2, int> C, R( rows, 3UL );
+      C  = A * 2;
+      C += max( A, B );
+      C -= A;
+      C %= B;
+
+      for( size_t i=0UL; i<rows; ++i ) {
+         for( size_t j=0UL; j<3UL; ++j ) {
+            R(i,j) = ( A(i,j) * 2 + std::max( A(i,j), B(i,j) ) - A(i,j) ) * B(i,j);
+         }
+      }
+
+      if( C != R ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: SMP assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major DynamicArray SMP assignment around the threshold and in a serial section";
+
+      for( size_t n : { blaze::SMP_DARRASSIGN_THRESHOLD - 1UL, blaze::SMP_DARRASSIGN_THRESHOLD } )
+      {
+         blaze::DynamicArray<2, int> A( 1UL, n ), B( 1UL, n );
+         randomize( A, -5, 5 );
+         randomize( B, -5, 5 );
+
+         blaze::DynamicArray<2, int> C, D, R( 1UL, n );
+         C  = A;
+         C += B;
+
+         BLAZE_SERIAL_SECTION
+         {
+            D  = A;
+            D += B;
+         }
+
+         for( size_t j=0UL; j<n; ++j ) {
+            R(0,j) = A(0,j) + B(0,j);
+         }
+
+         if( C != R || D != R ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: SMP assignment failed\n"
+                << " Details:\n"
+                << "   Number of elements: " << n << "\n"
+                << "   Result:\n" << C << "\n" << D << "\n"
+                << "   Expected result:\n" << R << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major CustomArray tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CustomArray SMP (compound) assignment (aligned/padded)";
+
+      using blaze::aligned;
+      using blaze::padded;
+
+      const size_t rows   ( blaze::SMP_DARRASSIGN_THRESHOLD / ( 3UL * 5UL * 67UL ) + 2UL );
+      const size_t spacing( blaze::nextMultiple<size_t>( 67UL, 16UL ) );
+
+      blaze::DynamicArray<4, int> A( 3UL, 5UL, rows, 67UL ), B( 3UL, 5UL, rows, 67UL );
+      randomize( A, -5, 5 );
+      randomize( B, -5, 5 );
+
+      std::unique_ptr<int[],blaze::Deallocate> memory(
+         blaze::allocate<int>( 3UL*5UL*rows*spacing ) );
+      blaze::CustomArray<4, int, aligned, padded> C( memory.get(), 3UL, 5UL, rows, 67UL, spacing );
+      C  = A * 2;
+      C += max( A, B );
+      C -= A;
+      C %= B;
+
+      blaze::DynamicArray<4, int> R( 3UL, 5UL, rows, 67UL );
+
+      for( size_t l=0UL; l<3UL; ++l ) {
+         for( size_t k=0UL; k<5UL; ++k ) {
+            for( size_t i=0UL; i<rows; ++i ) {
+               for( size_t j=0UL; j<67UL; ++j ) {
+                  R(l,k,i,j) = ( A(l,k,i,j) * 2 + std::max( A(l,k,i,j), B(l,k,i,j) ) - A(l,k,i,j) )
+                             * B(l,k,i,j);
+               }
+            }
+         }
+      }
+
+      if( C != R ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: SMP assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CustomArray SMP (compound) assignment (unaligned/unpadded)";
+
+      using blaze::unaligned;
+      using blaze::unpadded;
+
+      const size_t rows( blaze::SMP_DARRASSIGN_THRESHOLD / ( 3UL * 5UL * 67UL ) + 2UL );
+
+      blaze::DynamicArray<4, int> A( 3UL, 5UL, rows, 67UL ), B( 3UL, 5UL, rows, 67UL );
+      randomize( A, -5, 5 );
+      randomize( B, -5, 5 );
+
+      std::unique_ptr<int[]> memory( new int[3UL*5UL*rows*67UL+1UL] );
+      blaze::CustomArray<4, int, unaligned, unpadded> C( memory.get()+1UL, 3UL, 5UL, rows, 67UL );
+      C  = A * 2;
+      C += max( A, B );
+      C -= A;
+      C %= B;
+
+      blaze::DynamicArray<4, int> R( 3UL, 5UL, rows, 67UL );
+
+      for( size_t l=0UL; l<3UL; ++l ) {
+         for( size_t k=0UL; k<5UL; ++k ) {
+            for( size_t i=0UL; i<rows; ++i ) {
+               for( size_t j=0UL; j<67UL; ++j ) {
+                  R(l,k,i,j) = ( A(l,k,i,j) * 2 + std::max( A(l,k,i,j), B(l,k,i,j) ) - A(l,k,i,j) )
+                             * B(l,k,i,j);
+               }
+            }
+         }
+      }
+
+      if( C != R ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: SMP assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 } // namespace densearray
 
 } // namespace mathtest
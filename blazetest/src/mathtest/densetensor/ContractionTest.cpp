@@ -0,0 +1,463 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/densetensor/ContractionTest.cpp
+//  \brief Source file for the dense tensor contraction test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//  Copyright (C) 2019 Bita Hasheminezhad - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other tenserials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <blaze_tensor/math/PageSlice.h>
+#include <blazetest/mathtest/densetensor/ContractionTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace densetensor {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the dense tensor contraction test class.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ContractionTest::ContractionTest()
+{
+   testTensorMatrix(  1UL,  1UL,  1UL,  1UL );
+   testTensorMatrix(  3UL,  2UL,  5UL,  7UL );
+   testTensorMatrix(  4UL,  7UL, 16UL, 33UL );
+   testTensorMatrix(  2UL, 31UL, 67UL, 19UL );
+
+   testTensorTensor(  1UL,  1UL,  1UL,  1UL );
+   testTensorTensor(  3UL,  2UL,  5UL,  7UL );
+   testTensorTensor(  5UL,  4UL, 16UL,  9UL );
+
+   testEinsum(  2UL,  3UL,  4UL,  5UL );
+   testEinsum(  3UL,  9UL, 16UL, 17UL );
+
+   testErrors();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the contraction of a dense tensor and a dense matrix.
+//
+// \param o The number of pages of the tensor.
+// \param m The number of rows of the tensor.
+// \param k The number of columns of the tensor.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the contraction of an \a o x \a m x \a k tensor with a matrix over each
+// of the dimensions of the tensor. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ContractionTest::testTensorMatrix( size_t o, size_t m, size_t k, size_t n )
+{
+   std::ostringstream oss;
+   oss << o << "x" << m << "x" << k << ", n=" << n;
+
+   DTens A( o, m, k );
+   initialize( A, 1 );
+
+   {
+      test_ = "tensordot<1>( tensor, matrix ) (" + oss.str() + ")";
+
+      DMat B( k, n );
+      initialize( B, 2 );
+
+      const DTens C( blaze::tensordot<1UL>( A, B ) );
+
+      DTens expected( o, m, n );
+      for( size_t p=0UL; p<o; ++p ) {
+         blaze::pageslice( expected, p ) = blaze::pageslice( A, p ) * B;
+      }
+
+      checkResult( C, expected );
+   }
+
+   {
+      test_ = "tensordot( tensor, matrix, {1}, {0} ) (" + oss.str() + ")";
+
+      DMat B( m, n );
+      initialize( B, 3 );
+
+      const DTens C( blaze::tensordot( A, B, std::array<size_t,1UL>{ { 1UL } },
+                                             std::array<size_t,1UL>{ { 0UL } } ) );
+
+      DTens expected( o, k, n, 0 );
+      for( size_t p=0UL; p<o; ++p )
+         for( size_t l=0UL; l<k; ++l )
+            for( size_t j=0UL; j<n; ++j )
+               for( size_t i=0UL; i<m; ++i )
+                  expected(p,l,j) += A(p,i,l) * B(i,j);
+
+      checkResult( C, expected );
+   }
+
+   {
+      test_ = "tensordot<1>( matrix, tensor ) (" + oss.str() + ")";
+
+      DMat B( n, o );
+      initialize( B, 4 );
+
+      const DTens C( blaze::tensordot<1UL>( B, A ) );
+
+      DTens expected( n, m, k, 0 );
+      for( size_t a=0UL; a<n; ++a )
+         for( size_t i=0UL; i<m; ++i )
+            for( size_t l=0UL; l<k; ++l )
+               for( size_t p=0UL; p<o; ++p )
+                  expected(a,i,l) += B(a,p) * A(p,i,l);
+
+      checkResult( C, expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the contraction of two dense tensors.
+//
+// \param o The number of pages of the left-hand side tensor.
+// \param m The number of rows of the left-hand side tensor.
+// \param n The number of columns of the left-hand side tensor.
+// \param q The number of columns of the right-hand side tensor.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the contraction of two tensors over one and over two dimensions. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ContractionTest::testTensorTensor( size_t o, size_t m, size_t n, size_t q )
+{
+   std::ostringstream oss;
+   oss << o << "x" << m << "x" << n << ", q=" << q;
+
+   DTens A( o, m, n );
+   initialize( A, 1 );
+
+   {
+      test_ = "tensordot<2>( tensor, tensor ) (" + oss.str() + ")";
+
+      DTens B( m, n, q );
+      initialize( B, 2 );
+
+      const DMat C( blaze::tensordot<2UL>( A, B ) );
+
+      DMat expected( o, q, 0 );
+      for( size_t p=0UL; p<o; ++p )
+         for( size_t l=0UL; l<q; ++l )
+            for( size_t i=0UL; i<m; ++i )
+               for( size_t j=0UL; j<n; ++j )
+                  expected(p,l) += A(p,i,j) * B(i,j,l);
+
+      checkResult( C, expected );
+   }
+
+   {
+      test_ = "tensordot<1>( tensor, tensor ) (" + oss.str() + ")";
+
+      DTens B( n, m, q );
+      initialize( B, 3 );
+
+      const DArr C( blaze::tensordot<1UL>( A, B ) );
+
+      DArr expected( blaze::init_from_value, 0, o, m, m, q );
+      for( size_t p=0UL; p<o; ++p )
+         for( size_t i=0UL; i<m; ++i )
+            for( size_t a=0UL; a<m; ++a )
+               for( size_t b=0UL; b<q; ++b )
+                  for( size_t j=0UL; j<n; ++j )
+                     expected(p,i,a,b) += A(p,i,j) * B(j,a,b);
+
+      checkResult( C, expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the einsum() function.
+//
+// \param o The number of pages of the tensor.
+// \param m The number of rows of the tensor.
+// \param k The number of columns of the tensor.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests einsum() specifications that result in the natural order, the swapped
+// order and general permutations of the remaining dimensions of three- and four-dimensional
+// results. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ContractionTest::testEinsum( size_t o, size_t m, size_t k, size_t n )
+{
+   std::ostringstream oss;
+   oss << o << "x" << m << "x" << k << ", n=" << n;
+
+   DTens A( o, m, k );
+   DMat  B( k, n );
+
+   initialize( A, 1 );
+   initialize( B, 2 );
+
+   {
+      test_ = "einsum( \"ijk,kl->ijl\" ) (" + oss.str() + ")";
+
+      DTens C;
+      blaze::einsum( "ijk,kl->ijl", A, B, C );
+
+      checkResult( C, blaze::tensordot<1UL>( A, B ) );
+   }
+
+   {
+      test_ = "einsum( \"ijk,kl->lij\" ) (" + oss.str() + ")";
+
+      DTens C;
+      blaze::einsum( "ijk,kl->lij", A, B, C );
+
+      DTens expected( n, o, m, 0 );
+      for( size_t l=0UL; l<n; ++l )
+         for( size_t p=0UL; p<o; ++p )
+            for( size_t i=0UL; i<m; ++i )
+               for( size_t j=0UL; j<k; ++j )
+                  expected(l,p,i) += A(p,i,j) * B(j,l);
+
+      checkResult( C, expected );
+   }
+
+   {
+      test_ = "einsum( \"ijk,kl->jil\" ) (" + oss.str() + ")";
+
+      DTens C;
+      blaze::einsum( "ijk,kl->jil", A, B, C );
+
+      DTens expected( m, o, n, 0 );
+      for( size_t i=0UL; i<m; ++i )
+         for( size_t p=0UL; p<o; ++p )
+            for( size_t l=0UL; l<n; ++l )
+               for( size_t j=0UL; j<k; ++j )
+                  expected(i,p,l) += A(p,i,j) * B(j,l);
+
+      checkResult( C, expected );
+   }
+
+   {
+      test_ = "einsum( \"ijk,klm->jmil\" ) (" + oss.str() + ")";
+
+      DTens D( k, n, m );
+      initialize( D, 6 );
+
+      DArr C;
+      blaze::einsum( "ijk,klm->jmil", A, D, C );
+
+      DArr expected( blaze::init_from_value, 0, m, m, o, n );
+      for( size_t i=0UL; i<m; ++i )
+         for( size_t a=0UL; a<m; ++a )
+            for( size_t p=0UL; p<o; ++p )
+               for( size_t l=0UL; l<n; ++l )
+                  for( size_t j=0UL; j<k; ++j )
+                     expected(i,a,p,l) += A(p,i,j) * D(j,l,a);
+
+      checkResult( C, expected );
+   }
+
+   {
+      test_ = "einsum( \"ij,jk\" ) (" + oss.str() + ")";
+
+      DMat X( m, k );
+      initialize( X, 3 );
+
+      DMat C;
+      blaze::einsum( "ij,jk", X, B, C );
+
+      checkResult( C, DMat( X * B ) );
+   }
+
+   {
+      test_ = "einsum( \"ij,kj->ki\" ) (" + oss.str() + ")";
+
+      DMat X( m, k );
+      DMat Y( n, k );
+      initialize( X, 4 );
+      initialize( Y, 5 );
+
+      DMat C;
+      blaze::einsum( "ij,kj->ki", X, Y, C );
+
+      checkResult( C, DMat( Y * blaze::trans( X ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of tensordot() and einsum().
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ContractionTest::testErrors()
+{
+   DTens A( 2UL, 3UL, 4UL );
+   DMat  B( 5UL, 6UL );
+   DTens C;
+
+   initialize( A, 1 );
+   initialize( B, 2 );
+
+   try {
+      test_ = "tensordot<1>() with non-matching extents";
+
+      C = blaze::tensordot<1UL>( A, B );
+
+      throw std::runtime_error( " Test : " + test_ + "\n Error: Missing exception\n" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      test_ = "einsum() with an invalid specification";
+
+      blaze::einsum( "ijk,kl->ijm", A, B, C );
+
+      throw std::runtime_error( " Test : " + test_ + "\n Error: Missing exception\n" );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initializing the given tensor with small, deterministic values.
+//
+// \param tensor The tensor to be initialized.
+// \param offset The offset of the generated values.
+// \return void
+*/
+void ContractionTest::initialize( DTens& tensor, int offset )
+{
+   for( size_t k=0UL; k<tensor.pages(); ++k ) {
+      for( size_t i=0UL; i<tensor.rows(); ++i ) {
+         for( size_t j=0UL; j<tensor.columns(); ++j ) {
+            tensor(k,i,j) = static_cast<int>( ( offset + 3*k + 5*i + 7*j ) % 11 ) - 5;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initializing the given matrix with small, deterministic values.
+//
+// \param matrix The matrix to be initialized.
+// \param offset The offset of the generated values.
+// \return void
+*/
+void ContractionTest::initialize( DMat& matrix, int offset )
+{
+   for( size_t i=0UL; i<matrix.rows(); ++i ) {
+      for( size_t j=0UL; j<matrix.columns(); ++j ) {
+         matrix(i,j) = static_cast<int>( ( offset + 5*i + 3*j ) % 7 ) - 3;
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace densetensor
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running dense tensor contraction test..." << std::endl;
+
+   try
+   {
+      RUN_DENSETENSOR_CONTRACTION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during dense tensor contraction test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
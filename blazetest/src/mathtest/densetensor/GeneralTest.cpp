@@ -38,13 +38,24 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <cmath>
 #include <cstdlib>
 #include <iostream>
+#include <sstream>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/system/Platform.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Serialization.h>
 #include <blazetest/mathtest/IsEqual.h>
 
+#include <blaze_tensor/math/CustomTensor.h>
 #include <blaze_tensor/math/DynamicTensor.h>
+#include <blaze_tensor/math/Serialization.h>
+#include <blaze_tensor/math/StaticTensor.h>
+#include <blaze_tensor/math/Subtensor.h>
 #include <blaze_tensor/math/dense/DenseTensor.h>
+#include <blaze_tensor/system/Thresholds.h>
 
 #include <blazetest/mathtest/densetensor/GeneralTest.h>
 
@@ -83,12 +94,21 @@ GeneralTest::GeneralTest()
    testMinimum();
    testMaximum();
    testSoftmax();
+   testMeanVar();
+   testArgReduce();
+   testNormalization();
+   testBroadcast();
+   testExpansion();
+   testSerialization();
+   testNpy();
 //    testTrace();
    testL1Norm();
    testL2Norm();
    testL3Norm();
    testL4Norm();
    testLpNorm();
+   testSMPAssignment();
+   testSMPReduction();
 }
 //*************************************************************************************************
 
@@ -2583,236 +2603,418 @@ void GeneralTest::testSoftmax()
          throw std::runtime_error( oss.str() );
       }
    }
-}
-//*************************************************************************************************
-
-
-#if 0
-//*************************************************************************************************
-/*!\brief Test of the \c trace() function for dense tensors.
-//
-// \return void
-// \exception std::runtime_error Error detected.
-//
-// This function performs a test of the \c trace() function for dense tensors. In case an error
-// is detected, a \a std::runtime_error exception is thrown.
-*/
-void GeneralTest::testTrace()
-{
-   //=====================================================================================
-   // Row-major tensor tests
-   //=====================================================================================
 
    {
-      test_ = "Row-major trace()";
-
-      // Determining the trace of a 0x0 tensor
-      {
-         blaze::DynamicTensor<int> tens;
+      test_ = "Row-major softmax<rowwise>()";
 
-         checkRows   ( tens, 0UL );
-         checkColumns( tens, 0UL );
-
-         const int trace = blaze::trace( tens );
-
-         if( trace != 0 ) {
-            std::ostringstream oss;
-            oss << " Test: " << test_ << "\n"
-                << " Error: First computation failed\n"
-                << " Details:\n"
-                << "   Result: " << trace << "\n"
-                << "   Expected result: 0\n";
-            throw std::runtime_error( oss.str() );
+      blaze::DynamicTensor<double> A( 3UL, 4UL, 5UL );
+      randomize( A, -5.0, 5.0 );
+      A(1,2,3) = 1000.0;
+
+      const blaze::DynamicTensor<double> B( blaze::softmax<blaze::rowwise>( A ) );
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            double s( 0.0 );
+            for( size_t j=0UL; j<A.columns(); ++j )
+               s += B(k,i,j);
+            if( !isEqual( s, 1.0 ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Softmax computation failed\n"
+                   << " Details:\n"
+                   << "   Row sum (" << k << "," << i << "): " << s << "\n"
+                   << "   Expected result: 1\n";
+               throw std::runtime_error( oss.str() );
+            }
          }
       }
+   }
 
-      // Determining the trace of a 3x3 tensor
-      {
-         const blaze::DynamicTensor<int> tens{ { -1,  2, -3 }
-                                                            , { -4, -5,  6 }
-                                                            , {  7, -8, -9 } };
+   {
+      test_ = "Row-major softmax<columnwise>()";
 
-         checkRows    ( tens, 3UL );
-         checkColumns ( tens, 3UL );
-         checkNonZeros( tens, 9UL );
+      blaze::DynamicTensor<double> A( 3UL, 4UL, 5UL );
+      randomize( A, -5.0, 5.0 );
+      A(1,2,3) = 1000.0;
+
+      const blaze::DynamicTensor<double> B( blaze::softmax<blaze::columnwise>( A ) );
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            double s( 0.0 );
+            for( size_t i=0UL; i<A.rows(); ++i )
+               s += B(k,i,j);
+            if( !isEqual( s, 1.0 ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Softmax computation failed\n"
+                   << " Details:\n"
+                   << "   Column sum (" << k << "," << j << "): " << s << "\n"
+                   << "   Expected result: 1\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
 
-         const int trace = blaze::trace( tens );
+   {
+      test_ = "Row-major softmax<pagewise>()";
 
-         if( trace != -15 ) {
-            std::ostringstream oss;
-            oss << " Test: " << test_ << "\n"
-                << " Error: Second computation failed\n"
-                << " Details:\n"
-                << "   Result: " << trace << "\n"
-                << "   Expected result: -15\n";
-            throw std::runtime_error( oss.str() );
+      blaze::DynamicTensor<double> A( 3UL, 4UL, 5UL );
+      randomize( A, -5.0, 5.0 );
+      A(1,2,3) = 1000.0;
+
+      const blaze::DynamicTensor<double> B( blaze::softmax<blaze::pagewise>( A ) );
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            double s( 0.0 );
+            for( size_t k=0UL; k<A.pages(); ++k )
+               s += B(k,i,j);
+            if( !isEqual( s, 1.0 ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Softmax computation failed\n"
+                   << " Details:\n"
+                   << "   Page sum (" << i << "," << j << "): " << s << "\n"
+                   << "   Expected result: 1\n";
+               throw std::runtime_error( oss.str() );
+            }
          }
       }
+   }
 
-      // Determining the trace of a non-square tensor
-      try
-      {
-         blaze::DynamicTensor<int> tens( 2UL, 3UL );
+   {
+      test_ = "Row-major logsoftmax()";
 
-         checkRows   ( tens, 2UL );
-         checkColumns( tens, 3UL );
+      blaze::DynamicTensor<double> A( 3UL, 4UL, 5UL );
+      randomize( A, -5.0, 5.0 );
 
-         const int trace = blaze::trace( tens );
+      const blaze::DynamicTensor<double> B1( logsoftmax( A ) );
+      const blaze::DynamicTensor<double> B2( blaze::logsoftmax<blaze::rowwise>( A ) );
+      const blaze::DynamicTensor<double> B3( blaze::logsoftmax<blaze::columnwise>( A ) );
+      const blaze::DynamicTensor<double> B4( blaze::logsoftmax<blaze::pagewise>( A ) );
 
+      if( B1 != log( softmax( A ) ) ||
+          B2 != log( blaze::softmax<blaze::rowwise>( A ) ) ||
+          B3 != log( blaze::softmax<blaze::columnwise>( A ) ) ||
+          B4 != log( blaze::softmax<blaze::pagewise>( A ) ) ) {
          std::ostringstream oss;
          oss << " Test: " << test_ << "\n"
-             << " Error: Trace computation on a non-square tensor succeeded\n"
+             << " Error: Log-softmax computation failed\n"
              << " Details:\n"
-             << "   Result:\n" << trace << "\n";
+             << "   Result:\n" << B1 << "\n"
+             << "   Expected result:\n" << log( softmax( A ) ) << "\n";
          throw std::runtime_error( oss.str() );
       }
-      catch( std::invalid_argument& ) {}
    }
 }
 //*************************************************************************************************
-#endif
+
 
 //*************************************************************************************************
-/*!\brief Test of the \c l1Norm() function for dense tensors.
+/*!\brief Test of the \c meanvar() function family for dense tensors.
 //
 // \return void
 // \exception std::runtime_error Error detected.
 //
-// This function performs a test of the \c l1Norm() function for dense tensors. In case an
-// error is detected, a \a std::runtime_error exception is thrown.
+// This function performs a test of the mean and variance functions for dense tensors. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
 */
-void GeneralTest::testL1Norm()
+void GeneralTest::testMeanVar()
 {
    //=====================================================================================
    // Row-major tensor tests
    //=====================================================================================
 
    {
-      test_ = "l1Norm() function";
+      test_ = "Row-major meanvar()";
 
-      {
-         blaze::DynamicTensor<int> tens;
+      blaze::DynamicTensor<int> A{ { { 1, 3, 2 }, { 2, 6, 4 } }, { { 9, 6, 3 }, { 4, 5, 2 } } };
 
-         const int norm = blaze::l1Norm( tens );
+      const auto mv = meanvar( A );
 
-         if( !isEqual( norm, 0 ) ) {
-            std::ostringstream oss;
-            oss << " Test: " << test_ << "\n"
-                << " Error: L1 norm computation failed\n"
-                << " Details:\n"
-                << "   Result: " << norm << "\n"
-                << "   Expected result: 0\n";
-            throw std::runtime_error( oss.str() );
-         }
+      if( !isEqual( mean( A ), 47.0/12.0 ) || !isEqual( mv.first, 47.0/12.0 ) ||
+          !isEqual( var( A ), 683.0/132.0 ) || !isEqual( mv.second, 683.0/132.0 ) ||
+          !isEqual( stddev( A ), std::sqrt( 683.0/132.0 ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mean/variance computation failed\n"
+             << " Details:\n"
+             << "   Result: ( " << mv.first << ", " << mv.second << " )\n"
+             << "   Expected result: ( " << 47.0/12.0 << ", " << 683.0/132.0 << " )\n";
+         throw std::runtime_error( oss.str() );
       }
+   }
 
-      {
-         blaze::DynamicTensor<int> tens( 2UL, 3UL, 7UL, 0 );
+   {
+      test_ = "Row-major var<rowwise>(), var<columnwise>() and var<pagewise>()";
 
-         const int norm = blaze::l1Norm( tens );
+      blaze::DynamicTensor<int> A{ { { 1, 3, 2 }, { 2, 6, 4 } }, { { 9, 6, 3 }, { 4, 5, 2 } } };
 
-         if( !isEqual( norm, 0 ) ) {
-            std::ostringstream oss;
-            oss << " Test: " << test_ << "\n"
-                << " Error: L1 norm computation failed\n"
-                << " Details:\n"
-                << "   Result: " << norm << "\n"
-                << "   Expected result: 0\n";
-            throw std::runtime_error( oss.str() );
+      const blaze::DynamicMatrix<double> rv( blaze::var<blaze::rowwise>( A ) );
+      const blaze::DynamicMatrix<double> cv( blaze::var<blaze::columnwise>( A ) );
+      const blaze::DynamicMatrix<double> pv( blaze::var<blaze::pagewise>( A ) );
+
+      const blaze::DynamicMatrix<double> rvref{ { 1.0, 4.0 }, { 9.0, 7.0/3.0 } };
+      const blaze::DynamicMatrix<double> cvref{ { 0.5, 4.5, 2.0 }, { 12.5, 0.5, 0.5 } };
+      const blaze::DynamicMatrix<double> pvref{ { 32.0, 4.5, 0.5 }, { 2.0, 0.5, 2.0 } };
+
+      if( rv != rvref || cv != cvref || pv != pvref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Variance computation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << rv << "\n" << cv << "\n" << pv << "\n"
+             << "   Expected result:\n" << rvref << "\n" << cvref << "\n" << pvref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major meanvar<RF>() with large offset";
+
+      blaze::DynamicTensor<double> A( 3UL, 5UL, 37UL );
+      randomize( A, -5.0, 5.0 );
+      A = map( A, []( double a ){ return a + 1.0E6; } );
+
+      const auto rmv = blaze::meanvar<blaze::rowwise>( A );
+      const auto pmv = blaze::meanvar<blaze::pagewise>( A );
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            double m( 0.0 ), v( 0.0 );
+            for( size_t j=0UL; j<A.columns(); ++j )
+               m += A(k,i,j);
+            m /= A.columns();
+            for( size_t j=0UL; j<A.columns(); ++j )
+               v += ( A(k,i,j) - m ) * ( A(k,i,j) - m );
+            v /= ( A.columns() - 1UL );
+
+            if( !isEqual( rmv.first(k,i), m ) || !isEqual( rmv.second(k,i), v ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Rowwise mean/variance computation failed\n"
+                   << " Details:\n"
+                   << "   Result: ( " << rmv.first(k,i) << ", " << rmv.second(k,i) << " )\n"
+                   << "   Expected result: ( " << m << ", " << v << " )\n";
+               throw std::runtime_error( oss.str() );
+            }
          }
       }
 
-      {
-         blaze::DynamicTensor< int > tens{
-            {{0, 0, 1, 0, 1, 0, 0}, {0, -2, 0, 0, 0, -1, 0},
-               {0, 0, 0, 2, 0, 0, 0}},
-            {{0, 0, 1, 0, 1, 0, 0}, {0, -2, 0, 0, 0, -1, 0},
-               {0, 0, 0, 2, 0, 0, 0}}};
+      if( pmv.first != blaze::mean<blaze::pagewise>( A ) ||
+          blaze::stddev<blaze::pagewise>( A ) != sqrt( pmv.second ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Pagewise mean/variance computation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << pmv.first << "\n"
+             << "   Expected result:\n" << blaze::mean<blaze::pagewise>( A ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
 
-         const int norm = blaze::l1Norm( tens );
+   {
+      test_ = "Row-major meanvar() and meanvar<RF>() of a subtensor";
 
-         if( !isEqual( norm, 14 ) ) {
-            std::ostringstream oss;
-            oss << " Test: " << test_ << "\n"
-                << " Error: L1 norm computation failed\n"
-                << " Details:\n"
-                << "   Result: " << norm << "\n"
-                << "   Expected result: 14\n";
-            throw std::runtime_error( oss.str() );
-         }
+      blaze::DynamicTensor<double> A( 5UL, 7UL, 41UL );
+      randomize( A, -5.0, 5.0 );
+
+      const auto sA = blaze::subtensor( A, 1UL, 2UL, 3UL, 3UL, 4UL, 33UL );
+      const blaze::DynamicTensor<double> B( sA );
+
+      const auto mv  = meanvar( sA );
+      const auto ref = meanvar( B );
+
+      if( !isEqual( mv.first, ref.first ) || !isEqual( mv.second, ref.second ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mean/variance computation of a subtensor failed\n"
+             << " Details:\n"
+             << "   Result: ( " << mv.first << ", " << mv.second << " )\n"
+             << "   Expected result: ( " << ref.first << ", " << ref.second << " )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const auto rmv = blaze::meanvar<blaze::rowwise>( sA );
+      const auto cmv = blaze::meanvar<blaze::columnwise>( sA );
+      const auto pmv = blaze::meanvar<blaze::pagewise>( sA );
+
+      if( rmv.first  != blaze::meanvar<blaze::rowwise>( B ).first ||
+          rmv.second != blaze::meanvar<blaze::rowwise>( B ).second ||
+          cmv.first  != blaze::meanvar<blaze::columnwise>( B ).first ||
+          cmv.second != blaze::meanvar<blaze::columnwise>( B ).second ||
+          pmv.first  != blaze::meanvar<blaze::pagewise>( B ).first ||
+          pmv.second != blaze::meanvar<blaze::pagewise>( B ).second ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Row-/column-/pagewise mean/variance computation of a subtensor failed\n"
+             << " Details:\n"
+             << "   Result:\n" << rmv.second << "\n" << cmv.second << "\n" << pmv.second << "\n";
+         throw std::runtime_error( oss.str() );
       }
    }
 }
 //*************************************************************************************************
 
+
 //*************************************************************************************************
-/*!\brief Test of the \c l2Norm() function for dense tensors.
+/*!\brief Test of the \c argmin(), \c argmax() and \c topk() functions for dense tensors.
 //
 // \return void
 // \exception std::runtime_error Error detected.
 //
-// This function performs a test of the \c l2Norm() function for dense tensors. In case an
-// error is detected, a \a std::runtime_error exception is thrown.
+// This function performs a test of the \c argmin(), \c argmax() and \c topk() functions for
+// dense tensors. In case an error is detected, a \a std::runtime_error exception is thrown.
 */
-void GeneralTest::testL2Norm()
+void GeneralTest::testArgReduce()
 {
    //=====================================================================================
    // Row-major tensor tests
    //=====================================================================================
 
    {
-      test_ = "l2Norm() function";
+      test_ = "Row-major argmin<RF>() and argmax<RF>()";
+
+      blaze::DynamicTensor<int> A{ { { 1, 3, 2 }, { 2, 6, 4 } }, { { 9, 6, 3 }, { 4, 5, 2 } } };
+
+      const blaze::DynamicMatrix<size_t> rmin( blaze::argmin<blaze::rowwise>( A ) );
+      const blaze::DynamicMatrix<size_t> cmin( blaze::argmin<blaze::columnwise>( A ) );
+      const blaze::DynamicMatrix<size_t> pmin( blaze::argmin<blaze::pagewise>( A ) );
+      const blaze::DynamicMatrix<size_t> rmax( blaze::argmax<blaze::rowwise>( A ) );
+      const blaze::DynamicMatrix<size_t> cmax( blaze::argmax<blaze::columnwise>( A ) );
+      const blaze::DynamicMatrix<size_t> pmax( blaze::argmax<blaze::pagewise>( A ) );
+
+      const blaze::DynamicMatrix<size_t> rminref{ { 0, 0 }, { 2, 2 } };
+      const blaze::DynamicMatrix<size_t> cminref{ { 0, 0, 0 }, { 1, 1, 1 } };
+      const blaze::DynamicMatrix<size_t> pminref{ { 0, 0, 0 }, { 0, 1, 1 } };
+      const blaze::DynamicMatrix<size_t> rmaxref{ { 1, 1 }, { 0, 1 } };
+      const blaze::DynamicMatrix<size_t> cmaxref{ { 1, 1, 1 }, { 0, 0, 0 } };
+      const blaze::DynamicMatrix<size_t> pmaxref{ { 1, 1, 1 }, { 1, 0, 0 } };
+
+      if( rmin != rminref || cmin != cminref || pmin != pminref ||
+          rmax != rmaxref || cmax != cmaxref || pmax != pmaxref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Index reduction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << rmin << "\n" << cmin << "\n" << pmin << "\n"
+             << rmax << "\n" << cmax << "\n" << pmax << "\n"
+             << "   Expected result:\n" << rminref << "\n" << cminref << "\n" << pminref << "\n"
+             << rmaxref << "\n" << cmaxref << "\n" << pmaxref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
 
-      {
-         blaze::DynamicTensor<int> tens;
+   {
+      test_ = "Row-major argmax<rowwise>() with SIMD kernel";
+
+      blaze::DynamicTensor<float> A( 2UL, 3UL, 67UL );
+      randomize( A, -1.0F, 1.0F );
+      A(1,2,65) = 2.0F;
+      A(1,2,3)  = 2.0F;
+
+      const blaze::DynamicMatrix<size_t> rmax( blaze::argmax<blaze::rowwise>( A ) );
+      const blaze::DynamicMatrix<size_t> rmin( blaze::argmin<blaze::rowwise>( A ) );
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            size_t imax( 0UL ), imin( 0UL );
+            for( size_t j=1UL; j<A.columns(); ++j ) {
+               if( A(k,i,j) > A(k,i,imax) ) imax = j;
+               if( A(k,i,j) < A(k,i,imin) ) imin = j;
+            }
+
+            if( rmax(k,i) != imax || rmin(k,i) != imin ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Index reduction failed\n"
+                   << " Details:\n"
+                   << "   Result: ( " << rmin(k,i) << ", " << rmax(k,i) << " )\n"
+                   << "   Expected result: ( " << imin << ", " << imax << " )\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
 
-         const double norm = blaze::l2Norm( tens );
+   {
+      test_ = "Row-major topk<RF>()";
 
-         if( !isEqual( norm, 0.0 ) ) {
-            std::ostringstream oss;
-            oss << " Test: " << test_ << "\n"
-                << " Error: L2 norm computation failed\n"
-                << " Details:\n"
-                << "   Result: " << norm << "\n"
-                << "   Expected result: 0\n";
-            throw std::runtime_error( oss.str() );
-         }
+      blaze::DynamicTensor<int> A{ { { 1, 3, 2 }, { 2, 6, 4 } }, { { 9, 6, 3 }, { 4, 5, 2 } } };
+
+      const auto rt = blaze::topk<blaze::rowwise>( A, 2UL );
+      const auto pt = blaze::topk<blaze::pagewise>( A, 1UL );
+
+      const blaze::DynamicTensor<int> rvref{ { { 3, 2 }, { 6, 4 } }, { { 9, 6 }, { 5, 4 } } };
+      const blaze::DynamicTensor<size_t> riref{ { { 1, 2 }, { 1, 2 } }, { { 0, 1 }, { 1, 0 } } };
+      const blaze::DynamicTensor<int> pvref{ { { 9, 6, 3 }, { 4, 6, 4 } } };
+      const blaze::DynamicTensor<size_t> piref{ { { 1, 1, 1 }, { 1, 0, 0 } } };
+
+      if( rt.first != rvref || rt.second != riref || pt.first != pvref || pt.second != piref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Top-k selection failed\n"
+             << " Details:\n"
+             << "   Result:\n" << rt.first << "\n" << rt.second << "\n"
+             << pt.first << "\n" << pt.second << "\n"
+             << "   Expected result:\n" << rvref << "\n" << riref << "\n"
+             << pvref << "\n" << piref << "\n";
+         throw std::runtime_error( oss.str() );
       }
+   }
 
-      {
-         blaze::DynamicTensor<int> tens( 2UL, 3UL, 7UL, 0 );
+   {
+      test_ = "Row-major topk<columnwise>() with invalid number of elements";
 
-         const double norm = blaze::l2Norm( tens );
+      blaze::DynamicTensor<int> A( 2UL, 3UL, 4UL, 0 );
 
-         if( !isEqual( norm, 0.0 ) ) {
-            std::ostringstream oss;
-            oss << " Test: " << test_ << "\n"
-                << " Error: L2 norm computation failed\n"
-                << " Details:\n"
-                << "   Result: " << norm << "\n"
-                << "   Expected result: 0\n";
-            throw std::runtime_error( oss.str() );
-         }
+      try {
+         blaze::topk<blaze::columnwise>( A, 4UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Top-k selection of too many elements succeeded\n";
+         throw std::runtime_error( oss.str() );
       }
+      catch( std::invalid_argument& ) {}
+   }
 
-      {
-         blaze::DynamicTensor< int > tens{
-            {{0, 0, 1, 0, 1, 0, 0}, {0, -2, 0, 0, 0, -1, 0},
-               {0, 0, 0, 2, 0, 0, 0}},
-            {{0, 0, 1, 0, 1, 0, 0}, {0, -2, 0, 0, 0, -1, 0},
-               {0, 0, 0, 2, 0, 0, 0}}};
+   {
+      test_ = "Row-major argmax<RF>() and topk<RF>() of a subtensor";
 
-         const double norm = blaze::l2Norm( tens );
+      blaze::DynamicTensor<double> A( 6UL, 9UL, 45UL );
+      randomize( A, -5.0, 5.0 );
 
-         if( !isEqual( norm, 4.6904157598234297 ) ) {
-            std::ostringstream oss;
-            oss << " Test: " << test_ << "\n"
-                << " Error: L2 norm computation failed\n"
-                << " Details:\n"
-                << "   Result: " << norm << "\n"
-                << "   Expected result: 4.6904157598234297\n";
-            throw std::runtime_error( oss.str() );
-         }
+      const auto sA = blaze::subtensor( A, 1UL, 2UL, 5UL, 4UL, 6UL, 37UL );
+      const blaze::DynamicTensor<double> B( sA );
+
+      if( blaze::argmax<blaze::rowwise>( sA )    != blaze::argmax<blaze::rowwise>( B )    ||
+          blaze::argmin<blaze::columnwise>( sA ) != blaze::argmin<blaze::columnwise>( B ) ||
+          blaze::argmax<blaze::pagewise>( sA )   != blaze::argmax<blaze::pagewise>( B ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Index reduction of a subtensor failed\n"
+             << " Details:\n"
+             << "   Result:\n" << blaze::argmax<blaze::pagewise>( sA ) << "\n"
+             << "   Expected result:\n" << blaze::argmax<blaze::pagewise>( B ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const auto ct = blaze::topk<blaze::columnwise>( sA, 3UL );
+      const auto pt = blaze::topk<blaze::pagewise>( sA, 2UL );
+
+      if( ct != blaze::topk<blaze::columnwise>( B, 3UL ) ||
+          pt != blaze::topk<blaze::pagewise>( B, 2UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Top-k selection of a subtensor failed\n"
+             << " Details:\n"
+             << "   Result:\n" << pt.first << "\n" << pt.second << "\n"
+             << "   Expected result:\n" << blaze::topk<blaze::pagewise>( B, 2UL ).first << "\n";
+         throw std::runtime_error( oss.str() );
       }
    }
 }
@@ -2820,34 +3022,854 @@ void GeneralTest::testL2Norm()
 
 
 //*************************************************************************************************
-/*!\brief Test of the \c l3Norm() function for dense tensors.
+/*!\brief Test of the \c layernorm() and \c batchnorm() functions for dense tensors.
 //
 // \return void
 // \exception std::runtime_error Error detected.
 //
-// This function performs a test of the \c l3Norm() function for dense tensors. In case an
-// error is detected, a \a std::runtime_error exception is thrown.
+// This function performs a test of the \c layernorm() and \c batchnorm() functions for dense
+// tensors. In case an error is detected, a \a std::runtime_error exception is thrown.
 */
-void GeneralTest::testL3Norm()
+void GeneralTest::testNormalization()
 {
    //=====================================================================================
    // Row-major tensor tests
    //=====================================================================================
 
    {
-      test_ = "l3Norm() function";
+      test_ = "Row-major layernorm<rowwise>() and layernorm<pagewise>()";
 
-      {
-         blaze::DynamicTensor<int> tens;
+      blaze::DynamicTensor<double> A( 3UL, 4UL, 19UL );
+      randomize( A, -5.0, 5.0 );
+
+      blaze::DynamicVector<double> rgamma( 19UL ), rbeta( 19UL );
+      blaze::DynamicVector<double> pgamma( 3UL ), pbeta( 3UL );
+      randomize( rgamma, 0.5, 2.0 );
+      randomize( rbeta, -1.0, 1.0 );
+      randomize( pgamma, 0.5, 2.0 );
+      randomize( pbeta, -1.0, 1.0 );
+
+      blaze::DynamicTensor<double> R, P;
+      R = blaze::layernorm<blaze::rowwise >( A, rgamma, rbeta, 1.0E-3 );
+      P = blaze::layernorm<blaze::pagewise>( A, pgamma, pbeta, 1.0E-3 );
+
+      const auto rmv = blaze::meanvar<blaze::rowwise>( A );
+      const auto pmv = blaze::meanvar<blaze::pagewise>( A );
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            for( size_t j=0UL; j<A.columns(); ++j )
+            {
+               const double rvar( rmv.second(k,i) * ( A.columns() - 1UL ) / A.columns() );
+               const double pvar( pmv.second(i,j) * ( A.pages() - 1UL ) / A.pages() );
+               const double r( ( A(k,i,j) - rmv.first(k,i) ) / std::sqrt( rvar + 1.0E-3 )
+                             * rgamma[j] + rbeta[j] );
+               const double p( ( A(k,i,j) - pmv.first(i,j) ) / std::sqrt( pvar + 1.0E-3 )
+                             * pgamma[k] + pbeta[k] );
+
+               if( !isEqual( R(k,i,j), r ) || !isEqual( P(k,i,j), p ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Layer normalization failed\n"
+                      << " Details:\n"
+                      << "   Result: ( " << R(k,i,j) << ", " << P(k,i,j) << " )\n"
+                      << "   Expected result: ( " << r << ", " << p << " )\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Row-major batchnorm<columnwise>()";
+
+      blaze::DynamicTensor<int> A{ { { 1, 3, 2 }, { 3, 7, 4 } }, { { 9, 6, 3 }, { 5, 4, 1 } } };
+
+      const blaze::DynamicMatrix<double> mean { { 2.0, 5.0, 3.0 }, { 7.0, 5.0, 2.0 } };
+      const blaze::DynamicMatrix<double> var  { { 4.0, 1.0, 4.0 }, { 1.0, 4.0, 1.0 } };
+      const blaze::DynamicMatrix<double> gamma{ { 1.0, 2.0, 1.0 }, { 2.0, 1.0, 2.0 } };
+      const blaze::DynamicMatrix<double> beta { { 0.0, 1.0, 0.0 }, { 1.0, 0.0, 1.0 } };
+
+      blaze::DynamicTensor<double> B;
+      B = blaze::batchnorm<blaze::columnwise>( A, mean, var, gamma, beta, 0.0 );
+
+      const blaze::DynamicTensor<double> ref{ { { -0.5, -3.0, -0.5 }, {  0.5,  5.0,  0.5 } },
+                                              { {  5.0,  0.5,  3.0 }, { -3.0, -0.5, -1.0 } } };
+
+      if( B != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Batch normalization failed\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the broadcasting \c map() functions between dense tensors and dense matrices
+//        or vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the broadcasting \c map(), \c add(), \c sub(), \c schur(),
+// \c div(), \c min(), and \c max() functions between dense tensors and dense matrices or dense
+// vectors. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testBroadcast()
+{
+   //=====================================================================================
+   // Row-major tensor/matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major tensor/matrix add<rowwise>(), sub<columnwise>() and min<pagewise>()";
+
+      blaze::DynamicTensor<double> A( 3UL, 4UL, 19UL );
+      randomize( A, -5.0, 5.0 );
+
+      blaze::DynamicMatrix<double> rm( 3UL, 4UL ), cm( 3UL, 19UL );
+      blaze::DynamicMatrix<double,blaze::columnMajor> pm( 4UL, 19UL );
+      randomize( rm, -5.0, 5.0 );
+      randomize( cm, -5.0, 5.0 );
+      randomize( pm, -5.0, 5.0 );
+
+      blaze::DynamicTensor<double> R, C, P;
+      R = blaze::add<blaze::rowwise   >( A, rm );
+      C = blaze::sub<blaze::columnwise>( A, cm );
+      P = blaze::min<blaze::pagewise  >( A, pm );
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            for( size_t j=0UL; j<A.columns(); ++j )
+            {
+               const double r( A(k,i,j) + rm(k,i) );
+               const double c( A(k,i,j) - cm(k,j) );
+               const double p( std::min( A(k,i,j), pm(i,j) ) );
+
+               if( !isEqual( R(k,i,j), r ) || !isEqual( C(k,i,j), c ) || !isEqual( P(k,i,j), p ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Broadcasting operation failed\n"
+                      << " Details:\n"
+                      << "   Result: ( " << R(k,i,j) << ", " << C(k,i,j) << ", "
+                                          << P(k,i,j) << " )\n"
+                      << "   Expected result: ( " << r << ", " << c << ", " << p << " )\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Row-major tensor/matrix map<rowwise>()";
+
+      blaze::DynamicTensor<int> A{ { { 1, 3, 2 }, { 2, 6, 4 } }, { { 9, 6, 3 }, { 4, 5, 2 } } };
+
+      blaze::DynamicTensor<int> B;
+      B = blaze::map<blaze::rowwise>( A, blaze::max<blaze::rowwise>( A ),
+                                      []( int x, int m ){ return m - x; } );
+
+      const blaze::DynamicTensor<int> ref{ { { 2, 0, 1 }, { 4, 0, 2 } },
+                                           { { 0, 3, 6 }, { 1, 0, 3 } } };
+
+      if( B != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Broadcasting map operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major tensor/vector tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major tensor/vector div<rowwise>(), max<columnwise>() and schur<pagewise>()";
+
+      blaze::DynamicTensor<double> A( 3UL, 4UL, 19UL );
+      randomize( A, -5.0, 5.0 );
+
+      blaze::DynamicVector<double,blaze::rowVector> rv( 19UL );
+      blaze::DynamicVector<double> cv( 4UL ), pv( 3UL );
+      randomize( rv, 1.0, 5.0 );
+      randomize( cv, -5.0, 5.0 );
+      randomize( pv, -5.0, 5.0 );
+
+      blaze::DynamicTensor<double> R, C, P;
+      R = blaze::div  <blaze::rowwise   >( A, rv );
+      C = blaze::max  <blaze::columnwise>( A, cv );
+      P = blaze::schur<blaze::pagewise  >( A, pv );
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            for( size_t j=0UL; j<A.columns(); ++j )
+            {
+               const double r( A(k,i,j) / rv[j] );
+               const double c( std::max( A(k,i,j), cv[i] ) );
+               const double p( A(k,i,j) * pv[k] );
+
+               if( !isEqual( R(k,i,j), r ) || !isEqual( C(k,i,j), c ) || !isEqual( P(k,i,j), p ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Broadcasting operation failed\n"
+                      << " Details:\n"
+                      << "   Result: ( " << R(k,i,j) << ", " << C(k,i,j) << ", "
+                                          << P(k,i,j) << " )\n"
+                      << "   Expected result: ( " << r << ", " << c << ", " << p << " )\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Row-major broadcasting with mismatching operand sizes";
+
+      blaze::DynamicTensor<int> A( 2UL, 3UL, 4UL, 1 );
+      blaze::DynamicMatrix<int> M( 3UL, 4UL, 1 );
+      blaze::DynamicVector<int> v( 3UL, 1 );
+
+      try {
+         blaze::DynamicTensor<int> B;
+         B = blaze::add<blaze::columnwise>( A, M );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Broadcasting of a mismatching matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         blaze::DynamicTensor<int> B;
+         B = blaze::add<blaze::rowwise>( A, v );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Broadcasting of a mismatching vector succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Test of the expansion kernels for dense matrix expansions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assignment, addition assignment, subtraction assignment,
+// and Schur product assignment of dense matrix expansions to dense tensors and of the fused
+// addition and Schur product of dense matrix expansions and dense tensors. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testExpansion()
+{
+   //=====================================================================================
+   // Row-major expansion assignment tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major expand() assignment and compound assignments";
+
+      blaze::DynamicMatrix<double> M( 5UL, 19UL );
+      blaze::DynamicMatrix<double,blaze::columnMajor> CM( 5UL, 19UL );
+      randomize( M , -5.0, 5.0 );
+      randomize( CM, -5.0, 5.0 );
+
+      blaze::DynamicTensor<double> A( 4UL, 5UL, 19UL );
+      randomize( A, -5.0, 5.0 );
+
+      blaze::DynamicTensor<double> E, C, S( 4UL, 5UL, 19UL ), P( 4UL, 5UL, 19UL );
+      E = blaze::expand( M, 4UL );
+      C = blaze::expand<4UL>( CM );
+      S = A;
+      S -= blaze::expand( M, 4UL );
+      P = A;
+      P %= blaze::expand( M, 4UL );
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            for( size_t j=0UL; j<A.columns(); ++j )
+            {
+               if( !isEqual( E(k,i,j), M(i,j) ) || !isEqual( C(k,i,j), CM(i,j) ) ||
+                   !isEqual( S(k,i,j), A(k,i,j) - M(i,j) ) ||
+                   !isEqual( P(k,i,j), A(k,i,j) * M(i,j) ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Expansion failed\n"
+                      << " Details:\n"
+                      << "   Result: ( " << E(k,i,j) << ", " << C(k,i,j) << ", "
+                                          << S(k,i,j) << ", " << P(k,i,j) << " )\n"
+                      << "   Expected result: ( " << M(i,j) << ", " << CM(i,j) << ", "
+                                                   << A(k,i,j) - M(i,j) << ", "
+                                                   << A(k,i,j) * M(i,j) << " )\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Row-major expand() addition assignment to a subtensor";
+
+      blaze::DynamicMatrix<int> M{ { 1, 2, 3 }, { 4, 5, 6 } };
+
+      blaze::DynamicTensor<int> A( 3UL, 4UL, 5UL, 0 );
+      auto sub = blaze::subtensor( A, 1UL, 1UL, 2UL, 2UL, 2UL, 3UL );
+      sub += blaze::expand( M, 2UL );
+
+      const blaze::DynamicTensor<int> ref{ { { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+                                             { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 } },
+                                           { { 0, 0, 0, 0, 0 }, { 0, 0, 1, 2, 3 },
+                                             { 0, 0, 4, 5, 6 }, { 0, 0, 0, 0, 0 } },
+                                           { { 0, 0, 0, 0, 0 }, { 0, 0, 1, 2, 3 },
+                                             { 0, 0, 4, 5, 6 }, { 0, 0, 0, 0, 0 } } };
+
+      if( A != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Expansion to a subtensor failed\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major fused expansion tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major fused expand() + tensor and expand() % tensor";
+
+      blaze::DynamicMatrix<double> M( 5UL, 19UL );
+      randomize( M, -5.0, 5.0 );
+
+      blaze::DynamicTensor<double> A( 4UL, 5UL, 19UL );
+      randomize( A, -5.0, 5.0 );
+
+      blaze::DynamicTensor<double> R, P, I( A );
+      R = blaze::expand( M, 4UL ) + A;
+      P = blaze::expand( M, 4UL ) % A;
+      I = blaze::expand( M, 4UL ) + I;
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            for( size_t j=0UL; j<A.columns(); ++j )
+            {
+               const double r( M(i,j) + A(k,i,j) );
+               const double p( M(i,j) * A(k,i,j) );
+
+               if( !isEqual( R(k,i,j), r ) || !isEqual( P(k,i,j), p ) || !isEqual( I(k,i,j), r ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Fused expansion failed\n"
+                      << " Details:\n"
+                      << "   Result: ( " << R(k,i,j) << ", " << P(k,i,j) << ", "
+                                          << I(k,i,j) << " )\n"
+                      << "   Expected result: ( " << r << ", " << p << ", " << r << " )\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Row-major fused tensor + expand(), tensor % expand(), and expand() op expand()";
+
+      blaze::DynamicMatrix<double> M( 5UL, 19UL ), N( 5UL, 19UL );
+      randomize( M, -5.0, 5.0 );
+      randomize( N, -5.0, 5.0 );
+
+      blaze::DynamicTensor<double> A( 4UL, 5UL, 19UL );
+      randomize( A, -5.0, 5.0 );
+
+      blaze::DynamicTensor<double> R, P, S, Q;
+      R = A + blaze::expand( M, 4UL );
+      P = A % blaze::expand( M, 4UL );
+      S = blaze::expand( M, 4UL ) + blaze::expand( N, 4UL );
+      Q = blaze::expand<4UL>( M ) % blaze::expand<4UL>( N );
+
+      for( size_t k=0UL; k<A.pages(); ++k ) {
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            for( size_t j=0UL; j<A.columns(); ++j )
+            {
+               const double r( A(k,i,j) + M(i,j) );
+               const double p( A(k,i,j) * M(i,j) );
+               const double s( M(i,j) + N(i,j) );
+               const double q( M(i,j) * N(i,j) );
+
+               if( !isEqual( R(k,i,j), r ) || !isEqual( P(k,i,j), p ) ||
+                   !isEqual( S(k,i,j), s ) || !isEqual( Q(k,i,j), q ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Fused expansion failed\n"
+                      << " Details:\n"
+                      << "   Result: ( " << R(k,i,j) << ", " << P(k,i,j) << ", "
+                                          << S(k,i,j) << ", " << Q(k,i,j) << " )\n"
+                      << "   Expected result: ( " << r << ", " << p << ", "
+                                                   << s << ", " << q << " )\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Row-major fused expand() + tensor with mismatching number of pages";
+
+      blaze::DynamicMatrix<int> M( 3UL, 4UL, 1 );
+      blaze::DynamicTensor<int> A( 2UL, 3UL, 4UL, 1 );
+
+      try {
+         blaze::DynamicTensor<int> B;
+         B = blaze::expand( M, 3UL ) + A;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition of a mismatching expansion succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+
+#if 0
+//*************************************************************************************************
+/*!\brief Test of the \c trace() function for dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c trace() function for dense tensors. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testTrace()
+{
+   //=====================================================================================
+   // Row-major tensor tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major trace()";
+
+      // Determining the trace of a 0x0 tensor
+      {
+         blaze::DynamicTensor<int> tens;
+
+         checkRows   ( tens, 0UL );
+         checkColumns( tens, 0UL );
+
+         const int trace = blaze::trace( tens );
+
+         if( trace != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << trace << "\n"
+                << "   Expected result: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Determining the trace of a 3x3 tensor
+      {
+         const blaze::DynamicTensor<int> tens{ { -1,  2, -3 }
+                                                            , { -4, -5,  6 }
+                                                            , {  7, -8, -9 } };
+
+         checkRows    ( tens, 3UL );
+         checkColumns ( tens, 3UL );
+         checkNonZeros( tens, 9UL );
+
+         const int trace = blaze::trace( tens );
+
+         if( trace != -15 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result: " << trace << "\n"
+                << "   Expected result: -15\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Determining the trace of a non-square tensor
+      try
+      {
+         blaze::DynamicTensor<int> tens( 2UL, 3UL );
+
+         checkRows   ( tens, 2UL );
+         checkColumns( tens, 3UL );
+
+         const int trace = blaze::trace( tens );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Trace computation on a non-square tensor succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << trace << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+#endif
+
+//*************************************************************************************************
+/*!\brief Test of the \c l1Norm() function for dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c l1Norm() function for dense tensors. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testL1Norm()
+{
+   //=====================================================================================
+   // Row-major tensor tests
+   //=====================================================================================
+
+   {
+      test_ = "l1Norm() function";
+
+      {
+         blaze::DynamicTensor<int> tens;
+
+         const int norm = blaze::l1Norm( tens );
+
+         if( !isEqual( norm, 0 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: L1 norm computation failed\n"
+                << " Details:\n"
+                << "   Result: " << norm << "\n"
+                << "   Expected result: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         blaze::DynamicTensor<int> tens( 2UL, 3UL, 7UL, 0 );
+
+         const int norm = blaze::l1Norm( tens );
+
+         if( !isEqual( norm, 0 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: L1 norm computation failed\n"
+                << " Details:\n"
+                << "   Result: " << norm << "\n"
+                << "   Expected result: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         blaze::DynamicTensor< int > tens{
+            {{0, 0, 1, 0, 1, 0, 0}, {0, -2, 0, 0, 0, -1, 0},
+               {0, 0, 0, 2, 0, 0, 0}},
+            {{0, 0, 1, 0, 1, 0, 0}, {0, -2, 0, 0, 0, -1, 0},
+               {0, 0, 0, 2, 0, 0, 0}}};
+
+         const int norm = blaze::l1Norm( tens );
+
+         if( !isEqual( norm, 14 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: L1 norm computation failed\n"
+                << " Details:\n"
+                << "   Result: " << norm << "\n"
+                << "   Expected result: 14\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Test of the \c l2Norm() function for dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c l2Norm() function for dense tensors. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testL2Norm()
+{
+   //=====================================================================================
+   // Row-major tensor tests
+   //=====================================================================================
+
+   {
+      test_ = "l2Norm() function";
+
+      {
+         blaze::DynamicTensor<int> tens;
+
+         const double norm = blaze::l2Norm( tens );
+
+         if( !isEqual( norm, 0.0 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: L2 norm computation failed\n"
+                << " Details:\n"
+                << "   Result: " << norm << "\n"
+                << "   Expected result: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         blaze::DynamicTensor<int> tens( 2UL, 3UL, 7UL, 0 );
+
+         const double norm = blaze::l2Norm( tens );
+
+         if( !isEqual( norm, 0.0 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: L2 norm computation failed\n"
+                << " Details:\n"
+                << "   Result: " << norm << "\n"
+                << "   Expected result: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         blaze::DynamicTensor< int > tens{
+            {{0, 0, 1, 0, 1, 0, 0}, {0, -2, 0, 0, 0, -1, 0},
+               {0, 0, 0, 2, 0, 0, 0}},
+            {{0, 0, 1, 0, 1, 0, 0}, {0, -2, 0, 0, 0, -1, 0},
+               {0, 0, 0, 2, 0, 0, 0}}};
+
+         const double norm = blaze::l2Norm( tens );
+
+         if( !isEqual( norm, 4.6904157598234297 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: L2 norm computation failed\n"
+                << " Details:\n"
+                << "   Result: " << norm << "\n"
+                << "   Expected result: 4.6904157598234297\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c l3Norm() function for dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c l3Norm() function for dense tensors. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testL3Norm()
+{
+   //=====================================================================================
+   // Row-major tensor tests
+   //=====================================================================================
+
+   {
+      test_ = "l3Norm() function";
+
+      {
+         blaze::DynamicTensor<int> tens;
+
+         const double norm = blaze::l3Norm( tens );
+
+         if( !isEqual( norm, 0.0 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: L3 norm computation failed\n"
+                << " Details:\n"
+                << "   Result: " << norm << "\n"
+                << "   Expected result: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         blaze::DynamicTensor<int> tens( 2UL, 3UL, 7UL, 0 );
+
+         const double norm = blaze::l3Norm( tens );
+
+         if( !isEqual( norm, 0.0 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: L3 norm computation failed\n"
+                << " Details:\n"
+                << "   Result: " << norm << "\n"
+                << "   Expected result: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         blaze::DynamicTensor< int > tens{
+            {{0, 0, 1, 0, 1, 0, 0}, {0, -2, 0, 0, 0, -1, 0},
+               {0, 0, 0, 2, 0, 0, 0}},
+            {{0, 0, 1, 0, 1, 0, 0}, {0, -2, 0, 0, 0, -1, 0},
+               {0, 0, 0, 2, 0, 0, 0}}};
+
+         const double norm = blaze::l3Norm( tens );
+
+         if( !isEqual( norm, 3.3619754067989636 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: L3 norm computation failed\n"
+                << " Details:\n"
+                << "   Result: " << norm << "\n"
+                << "   Expected result: 3.3619754067989636\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c l4Norm() function for dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c l4Norm() function for dense tensors. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testL4Norm()
+{
+   //=====================================================================================
+   // Row-major tensor tests
+   //=====================================================================================
+
+   {
+      test_ = "l4Norm() function";
+
+      {
+         blaze::DynamicTensor<int> tens;
+
+         const double norm = blaze::l4Norm( tens );
+
+         if( !isEqual( norm, 0.0 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: L4 norm computation failed\n"
+                << " Details:\n"
+                << "   Result: " << norm << "\n"
+                << "   Expected result: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         blaze::DynamicTensor<int> tens( 2UL, 3UL, 7UL, 0 );
+
+         const double norm = blaze::l4Norm( tens );
+
+         if( !isEqual( norm, 0.0 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: L4 norm computation failed\n"
+                << " Details:\n"
+                << "   Result: " << norm << "\n"
+                << "   Expected result: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
 
-         const double norm = blaze::l3Norm( tens );
+      {
+         blaze::DynamicTensor< int > tens{
+            {{0, 0, 1, 0, 1, 0, 0}, {0, -2, 0, 0, 0, -1, 0},
+               {0, 0, 0, 2, 0, 0, 0}},
+            {{0, 0, 1, 0, 1, 0, 0}, {0, -2, 0, 0, 0, -1, 0},
+               {0, 0, 0, 2, 0, 0, 0}}};
 
-         if( !isEqual( norm, 0.0 ) ) {
+         const double norm = blaze::l4Norm( tens );
+
+         if( !isEqual( norm, 2.8925076085190780 ) ) {
             std::ostringstream oss;
             oss << " Test: " << test_ << "\n"
-                << " Error: L3 norm computation failed\n"
+                << " Error: L4 norm computation failed\n"
                 << " Details:\n"
                 << "   Result: " << norm << "\n"
+                << "   Expected result: 2.8925076085190780\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c lpNorm() function for dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c lpNorm() function for dense tensors. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testLpNorm()
+{
+   //=====================================================================================
+   // Row-major tensor tests
+   //=====================================================================================
+
+   {
+      test_ = "lpNorm() function";
+
+      {
+         blaze::DynamicTensor<int> tens;
+
+         const double norm1 = blaze::lpNorm( tens, 2 );
+         const double norm2 = blaze::lpNorm<2UL>( tens );
+
+         if( !isEqual( norm1, 0.0 ) || !isEqual( norm2, 0.0 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Lp norm computation failed\n"
+                << " Details:\n"
+                << "   lpNorm<2>(): " << norm1 << "\n"
+                << "   lpNorm(2): " << norm2 << "\n"
                 << "   Expected result: 0\n";
             throw std::runtime_error( oss.str() );
          }
@@ -2856,37 +3878,320 @@ void GeneralTest::testL3Norm()
       {
          blaze::DynamicTensor<int> tens( 2UL, 3UL, 7UL, 0 );
 
-         const double norm = blaze::l3Norm( tens );
+         const double norm1 = blaze::lpNorm( tens, 2 );
+         const double norm2 = blaze::lpNorm<2UL>( tens );
 
-         if( !isEqual( norm, 0.0 ) ) {
+         if( !isEqual( norm1, 0.0 ) || !isEqual( norm2, 0.0 ) ) {
             std::ostringstream oss;
             oss << " Test: " << test_ << "\n"
-                << " Error: L3 norm computation failed\n"
+                << " Error: Lp norm computation failed\n"
                 << " Details:\n"
-                << "   Result: " << norm << "\n"
+                << "   lpNorm<2>(): " << norm1 << "\n"
+                << "   lpNorm(2): " << norm2 << "\n"
                 << "   Expected result: 0\n";
             throw std::runtime_error( oss.str() );
          }
       }
 
-      {
-         blaze::DynamicTensor< int > tens{
-            {{0, 0, 1, 0, 1, 0, 0}, {0, -2, 0, 0, 0, -1, 0},
-               {0, 0, 0, 2, 0, 0, 0}},
-            {{0, 0, 1, 0, 1, 0, 0}, {0, -2, 0, 0, 0, -1, 0},
-               {0, 0, 0, 2, 0, 0, 0}}};
+      {
+         blaze::DynamicTensor<int> tens( 2UL, 5UL, 10UL );
+         randomize( tens, -5, 5 );
+
+         const int norm1( blaze::lpNorm( tens, 1 ) );
+         const int norm2( blaze::lpNorm<1UL>( tens ) );
+         const int norm3( blaze::l1Norm( tens ) );
+
+         if( !isEqual( norm1, norm3 ) || !isEqual( norm2, norm3 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Lp norm computation failed\n"
+                << " Details:\n"
+                << "   lpNorm<1>(): " << norm1 << "\n"
+                << "   lpNorm(1): " << norm2 << "\n"
+                << "   Expected result: " << norm3 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         blaze::DynamicTensor<int> tens( 2UL, 5UL, 10UL );
+         randomize( tens, -5, 5 );
+
+         const double norm1( blaze::lpNorm( tens, 2 ) );
+         const double norm2( blaze::lpNorm<2UL>( tens ) );
+         const double norm3( blaze::l2Norm( tens ) );
+
+         if( !isEqual( norm1, norm3 ) || !isEqual( norm2, norm3 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Lp norm computation failed\n"
+                << " Details:\n"
+                << "   lpNorm<2>(): " << norm1 << "\n"
+                << "   lpNorm(2): " << norm2 << "\n"
+                << "   Expected result: " << norm3 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         blaze::DynamicTensor<int> tens( 2UL, 5UL, 10UL );
+         randomize( tens, -5, 5 );
+
+         const double norm1( blaze::lpNorm( tens, 3 ) );
+         const double norm2( blaze::lpNorm<3UL>( tens ) );
+         const double norm3( blaze::l3Norm( tens ) );
+
+         if( !isEqual( norm1, norm3 ) || !isEqual( norm2, norm3 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Lp norm computation failed\n"
+                << " Details:\n"
+                << "   lpNorm<3>(): " << norm1 << "\n"
+                << "   lpNorm(3): " << norm2 << "\n"
+                << "   Expected result: " << norm3 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         blaze::DynamicTensor<int> tens( 2UL, 5UL, 10UL );
+         randomize( tens, -5, 5 );
+
+         const double norm1( blaze::lpNorm( tens, 4 ) );
+         const double norm2( blaze::lpNorm<4UL>( tens ) );
+         const double norm3( blaze::l4Norm( tens ) );
+
+         if( !isEqual( norm1, norm3 ) || !isEqual( norm2, norm3 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Lp norm computation failed\n"
+                << " Details:\n"
+                << "   lpNorm<4>(): " << norm1 << "\n"
+                << "   lpNorm(4): " << norm2 << "\n"
+                << "   Expected result: " << norm3 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the (de-)serialization of dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the serialization of dense tensors via blaze::Archive. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testSerialization()
+{
+   {
+      test_ = "Serialization of dense tensors";
+
+      blaze::DynamicTensor<double> A( 3UL, 5UL, 19UL );
+      randomize( A, -5.0, 5.0 );
+
+      blaze::StaticTensor<int,2UL,3UL,4UL> S;
+      randomize( S, -5, 5 );
+
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+
+      archive << A << S << ( A * 2.0 );
+
+      blaze::DynamicTensor<double> B, D;
+      blaze::DynamicTensor<int> T( 7UL, 7UL, 7UL );
+
+      archive >> B >> T >> D;
+
+      if( B != A || T != S || D != A * 2.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Serialization failed\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n" << T << "\n" << D << "\n"
+             << "   Expected result:\n" << A << "\n" << S << "\n" << ( A * 2.0 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Deserialization into a non-resizable tensor of different size";
+
+      blaze::DynamicTensor<double> A( 3UL, 5UL, 19UL );
+      randomize( A, -5.0, 5.0 );
+
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+
+      archive << A;
+
+      blaze::StaticTensor<double,2UL,3UL,4UL> S;
+
+      try {
+         archive >> S;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Deserialization into a tensor of different size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << S << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( "Invalid tensor size" ) == std::string::npos )
+            throw;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the NumPy \c .npy and \c .npz functionality for dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the loadNpy() and saveNpy() functions and of the NpyArray,
+// NpzReader and NpzWriter classes. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void GeneralTest::testNpy()
+{
+   {
+      test_ = "Npy round-trip of dense tensors";
+
+      blaze::DynamicTensor<double> A( 3UL, 5UL, 19UL );
+      randomize( A, -5.0, 5.0 );
+
+      std::stringstream stream;
+      blaze::saveNpy( stream, A );
+      blaze::saveNpy( stream, A * 2.0 );
+
+      blaze::DynamicTensor<double> B, D( 1UL, 1UL, 1UL );
+      blaze::loadNpy( stream, B );
+      blaze::loadNpy( stream, D );
+
+      if( B != A || D != A * 2.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Npy round-trip failed\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n" << D << "\n"
+             << "   Expected result:\n" << A << "\n" << ( A * 2.0 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Npy round-trip of a column-major matrix (Fortran order)";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> M( 5UL, 7UL );
+      randomize( M, -5, 5 );
+
+      std::stringstream stream;
+      blaze::saveNpy( stream, M );
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> R;
+      blaze::loadNpy( stream, R );
+
+      if( R != M ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Npy round-trip failed\n"
+             << " Details:\n"
+             << "   Result:\n" << R << "\n"
+             << "   Expected result:\n" << M << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Unpadded view on npy data";
+
+      blaze::DynamicTensor<double> A( 3UL, 5UL, 19UL );
+      randomize( A, -5.0, 5.0 );
+
+      std::stringstream stream;
+      blaze::saveNpy( stream, A );
+
+      blaze::NpyArray file( stream );
+      const blaze::CustomTensor<double,blaze::unaligned,blaze::unpadded> V( file.tensor<double>() );
+
+      if( V != A ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid view on npy data\n"
+             << " Details:\n"
+             << "   Result:\n" << V << "\n"
+             << "   Expected result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Npz round-trip of a tensor and a matrix";
+
+      blaze::DynamicTensor<double> A( 3UL, 5UL, 19UL );
+      randomize( A, -5.0, 5.0 );
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> M( 5UL, 7UL );
+      randomize( M, -5, 5 );
+
+      std::stringstream stream;
+      {
+         blaze::NpzWriter writer( stream );
+         writer.add( "A", A );
+         writer.add( "M", M );
+      }
+
+      blaze::NpzReader reader( stream );
+
+      blaze::DynamicTensor<double> B;
+      blaze::DynamicMatrix<int,blaze::rowMajor> R;
+      reader.load( "M", R );
+      reader.load( "A", B );
+
+      if( reader.names().size() != 2UL || B != A || R != M ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Npz round-trip failed\n"
+             << " Details:\n"
+             << "   Number of entries: " << reader.names().size() << "\n"
+             << "   Result:\n" << B << "\n" << R << "\n"
+             << "   Expected result:\n" << A << "\n" << M << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Loading npy data of different element type";
 
-         const double norm = blaze::l3Norm( tens );
+      blaze::DynamicTensor<double> A( 3UL, 5UL, 19UL );
+      randomize( A, -5.0, 5.0 );
 
-         if( !isEqual( norm, 3.3619754067989636 ) ) {
-            std::ostringstream oss;
-            oss << " Test: " << test_ << "\n"
-                << " Error: L3 norm computation failed\n"
-                << " Details:\n"
-                << "   Result: " << norm << "\n"
-                << "   Expected result: 3.3619754067989636\n";
-            throw std::runtime_error( oss.str() );
-         }
+      std::stringstream stream;
+      blaze::saveNpy( stream, A );
+
+      blaze::DynamicTensor<float> F;
+
+      try {
+         blaze::loadNpy( stream, F );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Loading npy data of different element type succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << F << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( "Invalid element type" ) == std::string::npos )
+            throw;
       }
    }
 }
@@ -2894,216 +4199,357 @@ void GeneralTest::testL3Norm()
 
 
 //*************************************************************************************************
-/*!\brief Test of the \c l4Norm() function for dense tensors.
+/*!\brief Test of the SMP (compound) assignment of dense tensors.
 //
 // \return void
 // \exception std::runtime_error Error detected.
 //
-// This function performs a test of the \c l4Norm() function for dense tensors. In case an
-// error is detected, a \a std::runtime_error exception is thrown.
+// This function performs a test of the shared memory parallel (compound) assignment of dense
+// tensors, which partitions the target into one subtensor per thread. The tensors exceed the
+// SMP assignment thresholds, have a padded row length that is not a multiple of the SIMD width,
+// and are either deep (many pages of few rows) or flat (few pages of many rows). Additionally,
+// subtensors are used as targets. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
 */
-void GeneralTest::testL4Norm()
+void GeneralTest::testSMPAssignment()
 {
+   const size_t threshold( std::max( blaze::SMP_DMATASSIGN_THRESHOLD,
+                                     blaze::SMP_DTENSASSIGN_THRESHOLD ) );
+
+
    //=====================================================================================
-   // Row-major tensor tests
+   // Row-major DynamicTensor tests
    //=====================================================================================
 
    {
-      test_ = "l4Norm() function";
+      test_ = "Row-major DynamicTensor SMP (compound) assignment (flat tensor)";
 
-      {
-         blaze::DynamicTensor<int> tens;
+      const size_t rows( threshold / 67UL + 3UL );
 
-         const double norm = blaze::l4Norm( tens );
+      blaze::DynamicTensor<int> A( 3UL, rows, 67UL ), B( 3UL, rows, 67UL );
+      randomize( A, -5, 5 );
+      randomize( B, -5, 5 );
 
-         if( !isEqual( norm, 0.0 ) ) {
-            std::ostringstream oss;
-            oss << " Test: " << test_ << "\n"
-                << " Error: L4 norm computation failed\n"
-                << " Details:\n"
-                << "   Result: " << norm << "\n"
-                << "   Expected result: 0\n";
-            throw std::runtime_error( oss.str() );
+      blaze::DynamicTensor<int> C, R( 3UL, rows, 67UL );
+      C  = A * 2;
+      C += B;
+      C -= A;
+      C %= B;
+
+      for( size_t k=0UL; k<3UL; ++k ) {
+         for( size_t i=0UL; i<rows; ++i ) {
+            for( size_t j=0UL; j<67UL; ++j ) {
+               R(k,i,j) = ( A(k,i,j) * 2 + B(k,i,j) - A(k,i,j) ) * B(k,i,j);
+            }
          }
       }
 
-      {
-         blaze::DynamicTensor<int> tens( 2UL, 3UL, 7UL, 0 );
+      if( C != R ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: SMP assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
 
-         const double norm = blaze::l4Norm( tens );
+   {
+      test_ = "Row-major DynamicTensor SMP (compound) assignment (deep tensor)";
 
-         if( !isEqual( norm, 0.0 ) ) {
-            std::ostringstream oss;
-            oss << " Test: " << test_ << "\n"
-                << " Error: L4 norm computation failed\n"
-                << " Details:\n"
-                << "   Result: " << norm << "\n"
-                << "   Expected result: 0\n";
-            throw std::runtime_error( oss.str() );
+      const size_t columns( threshold / 2UL + 13UL );
+
+      blaze::DynamicTensor<int> A( 37UL, 2UL, columns ), B( 37UL, 2UL, columns );
+      randomize( A, -5, 5 );
+      randomize( B, -5, 5 );
+
+      blaze::DynamicTensor<int> C, R( 37UL, 2UL, columns );
+      C  = A * 2;
+      C += B;
+      C -= A;
+      C %= B;
+
+      for( size_t k=0UL; k<37UL; ++k ) {
+         for( size_t i=0UL; i<2UL; ++i ) {
+            for( size_t j=0UL; j<columns; ++j ) {
+               R(k,i,j) = ( A(k,i,j) * 2 + B(k,i,j) - A(k,i,j) ) * B(k,i,j);
+            }
          }
       }
 
-      {
-         blaze::DynamicTensor< int > tens{
-            {{0, 0, 1, 0, 1, 0, 0}, {0, -2, 0, 0, 0, -1, 0},
-               {0, 0, 0, 2, 0, 0, 0}},
-            {{0, 0, 1, 0, 1, 0, 0}, {0, -2, 0, 0, 0, -1, 0},
-               {0, 0, 0, 2, 0, 0, 0}}};
+      if( C != R ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: SMP assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
 
-         const double norm = blaze::l4Norm( tens );
 
-         if( !isEqual( norm, 2.8925076085190780 ) ) {
-            std::ostringstream oss;
-            oss << " Test: " << test_ << "\n"
-                << " Error: L4 norm computation failed\n"
-                << " Details:\n"
-                << "   Result: " << norm << "\n"
-                << "   Expected result: 2.8925076085190780\n";
-            throw std::runtime_error( oss.str() );
+   //=====================================================================================
+   // Row-major subtensor tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major subtensor SMP (compound) assignment";
+
+      const size_t rows( threshold / 67UL + 3UL );
+
+      blaze::DynamicTensor<int> A( 3UL, rows, 67UL ), B( 3UL, rows, 67UL );
+      randomize( A, -5, 5 );
+      randomize( B, -5, 5 );
+
+      blaze::DynamicTensor<int> C( 5UL, rows+4UL, 73UL );
+      randomize( C, -5, 5 );
+
+      blaze::DynamicTensor<int> R( C );
+
+      auto sub = blaze::subtensor( C, 1UL, 2UL, 3UL, 3UL, rows, 67UL );
+      sub  = A * 2;
+      sub += B;
+      sub -= A;
+      sub %= B;
+
+      for( size_t k=0UL; k<3UL; ++k ) {
+         for( size_t i=0UL; i<rows; ++i ) {
+            for( size_t j=0UL; j<67UL; ++j ) {
+               R(k+1UL,i+2UL,j+3UL) = ( A(k,i,j) * 2 + B(k,i,j) - A(k,i,j) ) * B(k,i,j);
+            }
+         }
+      }
+
+      if( C != R ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: SMP assignment to a subtensor failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major SMP assignment of a subtensor";
+
+      const size_t rows( threshold / 67UL + 3UL );
+
+      blaze::DynamicTensor<int> A( 5UL, rows+4UL, 73UL );
+      randomize( A, -5, 5 );
+
+      blaze::DynamicTensor<int> C, R( 3UL, rows, 67UL );
+      C = blaze::subtensor( A, 1UL, 2UL, 3UL, 3UL, rows, 67UL ) * 2;
+
+      for( size_t k=0UL; k<3UL; ++k ) {
+         for( size_t i=0UL; i<rows; ++i ) {
+            for( size_t j=0UL; j<67UL; ++j ) {
+               R(k,i,j) = A(k+1UL,i+2UL,j+3UL) * 2;
+            }
          }
       }
+
+      if( C != R ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: SMP assignment of a subtensor failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
    }
 }
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief Test of the \c lpNorm() function for dense tensors.
+/*!\brief Test of the SMP total reduction of dense tensors.
 //
 // \return void
 // \exception std::runtime_error Error detected.
 //
-// This function performs a test of the \c lpNorm() function for dense tensors. In case an
-// error is detected, a \a std::runtime_error exception is thrown.
+// This function performs a test of the shared memory parallel total reduction of dense tensors
+// via the \c sum(), \c min(), and \c max() functions. The reduced tensors exceed the
+// SMP_DTENSREDUCE_THRESHOLD and have a padded row length, and both subtensors and tensor
+// expressions are reduced. Additionally, tensors directly at the threshold are reduced. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
 */
-void GeneralTest::testLpNorm()
+void GeneralTest::testSMPReduction()
 {
+   const size_t threshold( blaze::SMP_DTENSREDUCE_THRESHOLD );
+
+
    //=====================================================================================
-   // Row-major tensor tests
+   // Row-major DynamicTensor tests
    //=====================================================================================
 
    {
-      test_ = "lpNorm() function";
+      test_ = "Row-major SMP total reduction of a flat tensor";
 
-      {
-         blaze::DynamicTensor<int> tens;
+      const size_t rows( threshold / ( 3UL * 67UL ) + 3UL );
 
-         const double norm1 = blaze::lpNorm( tens, 2 );
-         const double norm2 = blaze::lpNorm<2UL>( tens );
+      blaze::DynamicTensor<int> A( 3UL, rows, 67UL );
+      randomize( A, -5, 5 );
+      A(2UL,rows-1UL,66UL) =  100;
+      A(1UL,0UL,33UL)      = -100;
 
-         if( !isEqual( norm1, 0.0 ) || !isEqual( norm2, 0.0 ) ) {
-            std::ostringstream oss;
-            oss << " Test: " << test_ << "\n"
-                << " Error: Lp norm computation failed\n"
-                << " Details:\n"
-                << "   lpNorm<2>(): " << norm1 << "\n"
-                << "   lpNorm(2): " << norm2 << "\n"
-                << "   Expected result: 0\n";
-            throw std::runtime_error( oss.str() );
+      int s( 0 );
+      for( size_t k=0UL; k<3UL; ++k ) {
+         for( size_t i=0UL; i<rows; ++i ) {
+            for( size_t j=0UL; j<67UL; ++j ) {
+               s += A(k,i,j);
+            }
          }
       }
 
-      {
-         blaze::DynamicTensor<int> tens( 2UL, 3UL, 7UL, 0 );
+      if( sum( A ) != s || min( A ) != -100 || max( A ) != 100 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: SMP reduction failed\n"
+             << " Details:\n"
+             << "   Result: ( " << sum( A ) << ", " << min( A ) << ", " << max( A ) << " )\n"
+             << "   Expected result: ( " << s << ", -100, 100 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
 
-         const double norm1 = blaze::lpNorm( tens, 2 );
-         const double norm2 = blaze::lpNorm<2UL>( tens );
+   {
+      test_ = "Row-major SMP total reduction of a deep tensor";
 
-         if( !isEqual( norm1, 0.0 ) || !isEqual( norm2, 0.0 ) ) {
-            std::ostringstream oss;
-            oss << " Test: " << test_ << "\n"
-                << " Error: Lp norm computation failed\n"
-                << " Details:\n"
-                << "   lpNorm<2>(): " << norm1 << "\n"
-                << "   lpNorm(2): " << norm2 << "\n"
-                << "   Expected result: 0\n";
-            throw std::runtime_error( oss.str() );
+      const size_t columns( threshold / ( 37UL * 2UL ) + 13UL );
+
+      blaze::DynamicTensor<int> A( 37UL, 2UL, columns );
+      randomize( A, -5, 5 );
+      A(36UL,1UL,columns-1UL) =  100;
+      A(18UL,0UL,5UL)         = -100;
+
+      int s( 0 );
+      for( size_t k=0UL; k<37UL; ++k ) {
+         for( size_t i=0UL; i<2UL; ++i ) {
+            for( size_t j=0UL; j<columns; ++j ) {
+               s += A(k,i,j);
+            }
          }
       }
 
+      if( sum( A ) != s || min( A ) != -100 || max( A ) != 100 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: SMP reduction failed\n"
+             << " Details:\n"
+             << "   Result: ( " << sum( A ) << ", " << min( A ) << ", " << max( A ) << " )\n"
+             << "   Expected result: ( " << s << ", -100, 100 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major SMP total reduction around the threshold and in a serial section";
+
+      for( size_t n : { threshold - 1UL, threshold } )
       {
-         blaze::DynamicTensor<int> tens( 2UL, 5UL, 10UL );
-         randomize( tens, -5, 5 );
+         blaze::DynamicTensor<int> A( 1UL, 1UL, n );
+         randomize( A, -5, 5 );
 
-         const int norm1( blaze::lpNorm( tens, 1 ) );
-         const int norm2( blaze::lpNorm<1UL>( tens ) );
-         const int norm3( blaze::l1Norm( tens ) );
+         int s( 0 );
+         for( size_t j=0UL; j<n; ++j ) {
+            s += A(0UL,0UL,j);
+         }
 
-         if( !isEqual( norm1, norm3 ) || !isEqual( norm2, norm3 ) ) {
+         int serial( 0 );
+         BLAZE_SERIAL_SECTION
+         {
+            serial = sum( A );
+         }
+
+         if( sum( A ) != s || serial != s ) {
             std::ostringstream oss;
             oss << " Test: " << test_ << "\n"
-                << " Error: Lp norm computation failed\n"
+                << " Error: SMP reduction failed\n"
                 << " Details:\n"
-                << "   lpNorm<1>(): " << norm1 << "\n"
-                << "   lpNorm(1): " << norm2 << "\n"
-                << "   Expected result: " << norm3 << "\n";
+                << "   Number of elements: " << n << "\n"
+                << "   Result: ( " << sum( A ) << ", " << serial << " )\n"
+                << "   Expected result: " << s << "\n";
             throw std::runtime_error( oss.str() );
          }
       }
+   }
 
-      {
-         blaze::DynamicTensor<int> tens( 2UL, 5UL, 10UL );
-         randomize( tens, -5, 5 );
 
-         const double norm1( blaze::lpNorm( tens, 2 ) );
-         const double norm2( blaze::lpNorm<2UL>( tens ) );
-         const double norm3( blaze::l2Norm( tens ) );
+   //=====================================================================================
+   // Row-major subtensor and expression tests
+   //=====================================================================================
 
-         if( !isEqual( norm1, norm3 ) || !isEqual( norm2, norm3 ) ) {
-            std::ostringstream oss;
-            oss << " Test: " << test_ << "\n"
-                << " Error: Lp norm computation failed\n"
-                << " Details:\n"
-                << "   lpNorm<2>(): " << norm1 << "\n"
-                << "   lpNorm(2): " << norm2 << "\n"
-                << "   Expected result: " << norm3 << "\n";
-            throw std::runtime_error( oss.str() );
-         }
-      }
+   {
+      test_ = "Row-major SMP total reduction of a subtensor";
 
-      {
-         blaze::DynamicTensor<int> tens( 2UL, 5UL, 10UL );
-         randomize( tens, -5, 5 );
+      const size_t rows( threshold / ( 3UL * 67UL ) + 3UL );
 
-         const double norm1( blaze::lpNorm( tens, 3 ) );
-         const double norm2( blaze::lpNorm<3UL>( tens ) );
-         const double norm3( blaze::l3Norm( tens ) );
+      blaze::DynamicTensor<int> A( 5UL, rows+4UL, 73UL );
+      randomize( A, -5, 5 );
+      A(0UL,0UL,0UL)       =  200;
+      A(4UL,rows+3UL,72UL) = -200;
+      A(3UL,rows+1UL,69UL) =  100;
+      A(1UL,2UL,3UL)       = -100;
 
-         if( !isEqual( norm1, norm3 ) || !isEqual( norm2, norm3 ) ) {
-            std::ostringstream oss;
-            oss << " Test: " << test_ << "\n"
-                << " Error: Lp norm computation failed\n"
-                << " Details:\n"
-                << "   lpNorm<3>(): " << norm1 << "\n"
-                << "   lpNorm(3): " << norm2 << "\n"
-                << "   Expected result: " << norm3 << "\n";
-            throw std::runtime_error( oss.str() );
+      const auto sub( blaze::subtensor( A, 1UL, 2UL, 3UL, 3UL, rows, 67UL ) );
+
+      int s( 0 );
+      for( size_t k=0UL; k<3UL; ++k ) {
+         for( size_t i=0UL; i<rows; ++i ) {
+            for( size_t j=0UL; j<67UL; ++j ) {
+               s += A(k+1UL,i+2UL,j+3UL);
+            }
          }
       }
 
-      {
-         blaze::DynamicTensor<int> tens( 2UL, 5UL, 10UL );
-         randomize( tens, -5, 5 );
+      if( sum( sub ) != s || min( sub ) != -100 || max( sub ) != 100 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: SMP reduction of a subtensor failed\n"
+             << " Details:\n"
+             << "   Result: ( " << sum( sub ) << ", " << min( sub ) << ", " << max( sub ) << " )\n"
+             << "   Expected result: ( " << s << ", -100, 100 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
 
-         const double norm1( blaze::lpNorm( tens, 4 ) );
-         const double norm2( blaze::lpNorm<4UL>( tens ) );
-         const double norm3( blaze::l4Norm( tens ) );
+   {
+      test_ = "Row-major SMP total reduction of a tensor expression";
 
-         if( !isEqual( norm1, norm3 ) || !isEqual( norm2, norm3 ) ) {
-            std::ostringstream oss;
-            oss << " Test: " << test_ << "\n"
-                << " Error: Lp norm computation failed\n"
-                << " Details:\n"
-                << "   lpNorm<4>(): " << norm1 << "\n"
-                << "   lpNorm(4): " << norm2 << "\n"
-                << "   Expected result: " << norm3 << "\n";
-            throw std::runtime_error( oss.str() );
+      const size_t rows( threshold / ( 3UL * 67UL ) + 3UL );
+
+      blaze::DynamicTensor<int> A( 3UL, rows, 67UL ), B( 3UL, rows, 67UL );
+      randomize( A, -5, 5 );
+      randomize( B, -5, 5 );
+
+      int s( 0 );
+      for( size_t k=0UL; k<3UL; ++k ) {
+         for( size_t i=0UL; i<rows; ++i ) {
+            for( size_t j=0UL; j<67UL; ++j ) {
+               s += A(k,i,j) * 2 + B(k,i,j);
+            }
          }
       }
+
+      if( sum( A * 2 + B ) != s ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: SMP reduction of a tensor expression failed\n"
+             << " Details:\n"
+             << "   Result: " << sum( A * 2 + B ) << "\n"
+             << "   Expected result: " << s << "\n";
+         throw std::runtime_error( oss.str() );
+      }
    }
 }
 //*************************************************************************************************
 
+
 } // namespace densetensor
 
 } // namespace mathtest
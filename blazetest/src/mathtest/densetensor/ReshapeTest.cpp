@@ -0,0 +1,433 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/densetensor/ReshapeTest.cpp
+//  \brief Source file for the dense tensor reshape test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//  Copyright (C) 2019 Bita Hasheminezhad - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other tenserials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/densetensor/ReshapeTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace densetensor {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the dense tensor reshape test class.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ReshapeTest::ReshapeTest()
+{
+   testView( 1UL,  1UL,  1UL );
+   testView( 3UL,  4UL,  5UL );
+   testView( 2UL,  7UL, 16UL );
+
+   testCopy( 1UL,  1UL,  1UL );
+   testCopy( 3UL,  4UL,  5UL );
+   testCopy( 2UL,  7UL, 16UL );
+
+   testDilated();
+   testErrors();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the reshape() function.
+//
+// \param o The number of pages of the tensor.
+// \param m The number of rows of the tensor.
+// \param n The number of columns of the tensor.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests views on an \a o x \a m x \a n tensor in different shapes. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ReshapeTest::testView( size_t o, size_t m, size_t n )
+{
+   std::ostringstream oss;
+   oss << o << "x" << m << "x" << n;
+
+   DTens A( o, m, n );
+   initialize( A );
+
+   DMat expected( o*m, n );
+   for( size_t k=0UL; k<o; ++k )
+      for( size_t i=0UL; i<m; ++i )
+         for( size_t j=0UL; j<n; ++j )
+            expected(k*m+i,j) = A(k,i,j);
+
+   {
+      test_ = "reshape( tensor, pages*rows, columns ) (" + oss.str() + ")";
+
+      auto B = blaze::reshape( A, o*m, n );
+
+      checkResult( B, expected );
+
+      B(o*m-1UL,n-1UL) = 42;
+
+      if( A(o-1UL,m-1UL,n-1UL) != 42 || B.data() != A.data() ) {
+         throw std::runtime_error( " Test : " + test_ + "\n Error: Invalid view detected\n" );
+      }
+
+      A(o-1UL,m-1UL,n-1UL) = expected(o*m-1UL,n-1UL);
+   }
+
+   {
+      test_ = "reshape( matrix, pages, rows, columns ) (" + oss.str() + ")";
+
+      const auto B = blaze::reshape( expected, o, m, n );
+
+      checkResult( B, A );
+   }
+
+   {
+      test_ = "reshape( const tensor, 1, pages, rows, columns ) (" + oss.str() + ")";
+
+      const DTens& C( A );
+      const auto B = blaze::reshape( C, 1UL, o, m, n );
+
+      for( size_t k=0UL; k<o; ++k ) {
+         for( size_t i=0UL; i<m; ++i ) {
+            for( size_t j=0UL; j<n; ++j ) {
+               if( B(0UL,k,i,j) != A(k,i,j) ) {
+                  std::ostringstream err;
+                  err << " Test : " << test_ << "\n"
+                      << " Error: Incorrect element (" << k << "," << i << "," << j << ")\n";
+                  throw std::runtime_error( err.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "reshape( single row tensor, size ) (" + oss.str() + ")";
+
+      DTens C( 1UL, 1UL, o*m*n );
+      for( size_t l=0UL; l<o*m*n; ++l )
+         C(0UL,0UL,l) = expected(l/n,l%n);
+
+      checkResult( blaze::reshape( C, o, m, n ), A );
+
+      const auto v = blaze::reshape( C, o*m*n );
+
+      for( size_t l=0UL; l<o*m*n; ++l ) {
+         if( v[l] != C(0UL,0UL,l) ) {
+            throw std::runtime_error( " Test : " + test_ + "\n Error: Incorrect element\n" );
+         }
+      }
+
+      if( blaze::canReshape( A, o*m*n ) != ( m*o == 1UL || A.spacing() == n ) ) {
+         throw std::runtime_error( " Test : " + test_ + "\n Error: Invalid layout check\n" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reshapeCopy() function.
+//
+// \param o The number of pages of the tensor.
+// \param m The number of rows of the tensor.
+// \param n The number of columns of the tensor.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests copies of an \a o x \a m x \a n tensor and of a tensor expression in
+// different shapes. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ReshapeTest::testCopy( size_t o, size_t m, size_t n )
+{
+   std::ostringstream oss;
+   oss << o << "x" << m << "x" << n;
+
+   DTens A( o, m, n );
+   initialize( A );
+
+   DVec expected( o*m*n );
+   for( size_t l=0UL; l<o*m*n; ++l )
+      expected[l] = A(l/(m*n),(l/n)%m,l%n);
+
+   {
+      test_ = "reshapeCopy( tensor, size ) (" + oss.str() + ")";
+
+      const DVec v( blaze::reshapeCopy( A, o*m*n ) );
+
+      checkResult( v, expected );
+   }
+
+   {
+      test_ = "reshapeCopy( tensor, columns, rows*pages ) (" + oss.str() + ")";
+
+      const DMat B( blaze::reshapeCopy( A, n, m*o ) );
+
+      for( size_t l=0UL; l<o*m*n; ++l ) {
+         if( B(l/(m*o),l%(m*o)) != expected[l] ) {
+            std::ostringstream err;
+            err << " Test : " << test_ << "\n"
+                << " Error: Incorrect result detected\n"
+                << " Details:\n"
+                << "   Computed result:\n" << B << "\n";
+            throw std::runtime_error( err.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "reshapeCopy( tensor expression, size ) (" + oss.str() + ")";
+
+      const DVec v( blaze::reshapeCopy( A + A, o*m*n ) );
+
+      checkResult( v, expected * 2 );
+   }
+
+   {
+      test_ = "reshapeCopy( tensor, 1, pages, rows, columns ) (" + oss.str() + ")";
+
+      const DArr B( blaze::reshapeCopy( A, 1UL, o, m, n ) );
+
+      checkResult( blaze::reshape( B, o, m, n ), A );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reshape functions for dilated views.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that dilated submatrices and subtensors, whose rows are not contiguous,
+// are rejected by reshape() and are copied element by element by reshapeCopy(). In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ReshapeTest::testDilated()
+{
+   DTens A( 4UL, 6UL, 10UL );
+   initialize( A );
+
+   {
+      test_ = "reshapeCopy( dilated submatrix, size )";
+
+      DMat M( blaze::reshape( A, 24UL, 10UL ) );
+
+      auto D = blaze::dilatedsubmatrix( M, 1UL, 0UL, 3UL, 4UL, 2UL, 2UL );
+
+      if( blaze::canReshape( D, 12UL ) || blaze::canReshape( D, 3UL, 4UL ) ) {
+         throw std::runtime_error( " Test : " + test_ + "\n Error: Invalid view detected\n" );
+      }
+
+      try {
+         blaze::reshape( D, 3UL, 4UL );
+
+         throw std::runtime_error( " Test : " + test_ + "\n Error: Missing exception\n" );
+      }
+      catch( std::invalid_argument& ) {}
+
+      DVec expected( 12UL );
+      for( size_t l=0UL; l<12UL; ++l )
+         expected[l] = M(1UL+2UL*(l/4UL),2UL*(l%4UL));
+
+      const DVec v( blaze::reshapeCopy( D, 12UL ) );
+
+      checkResult( v, expected );
+   }
+
+   {
+      test_ = "reshapeCopy( dilated subtensor, size )";
+
+      auto D = blaze::dilatedsubtensor( A, 0UL, 1UL, 0UL, 2UL, 3UL, 5UL, 2UL, 2UL, 2UL );
+
+      if( blaze::canReshape( D, 6UL, 5UL ) || blaze::canReshape( D, 30UL ) ) {
+         throw std::runtime_error( " Test : " + test_ + "\n Error: Invalid view detected\n" );
+      }
+
+      try {
+         blaze::reshape( D, 6UL, 5UL );
+
+         throw std::runtime_error( " Test : " + test_ + "\n Error: Missing exception\n" );
+      }
+      catch( std::invalid_argument& ) {}
+
+      DVec expected( 30UL );
+      for( size_t l=0UL; l<30UL; ++l )
+         expected[l] = A(2UL*(l/15UL),1UL+2UL*((l/5UL)%3UL),2UL*(l%5UL));
+
+      const DVec v( blaze::reshapeCopy( D, 30UL ) );
+
+      checkResult( v, expected );
+
+      const DMat B( blaze::reshapeCopy( D, 6UL, 5UL ) );
+
+      checkResult( DVec( blaze::reshapeCopy( B, 30UL ) ), expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the reshape functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that invalid extents and layouts are rejected with a
+// \a std::invalid_argument exception.
+*/
+void ReshapeTest::testErrors()
+{
+   DTens A( 2UL, 3UL, 5UL );
+   initialize( A );
+
+   try {
+      test_ = "reshape() with non-matching extents";
+
+      blaze::reshape( A, 7UL, 5UL );
+
+      throw std::runtime_error( " Test : " + test_ + "\n Error: Missing exception\n" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      test_ = "reshapeCopy() with non-matching extents";
+
+      blaze::reshapeCopy( A, 31UL );
+
+      throw std::runtime_error( " Test : " + test_ + "\n Error: Missing exception\n" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   if( !blaze::canReshape( A, 30UL ) )
+   {
+      try {
+         test_ = "reshape() of a padded tensor into a vector";
+
+         blaze::reshape( A, 30UL );
+
+         throw std::runtime_error( " Test : " + test_ + "\n Error: Missing exception\n" );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initializing the given tensor with small, deterministic values.
+//
+// \param tensor The tensor to be initialized.
+// \return void
+*/
+void ReshapeTest::initialize( DTens& tensor )
+{
+   for( size_t k=0UL; k<tensor.pages(); ++k ) {
+      for( size_t i=0UL; i<tensor.rows(); ++i ) {
+         for( size_t j=0UL; j<tensor.columns(); ++j ) {
+            tensor(k,i,j) = static_cast<int>( ( 3*k + 5*i + 7*j ) % 11 ) - 5;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace densetensor
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running dense tensor reshape test..." << std::endl;
+
+   try
+   {
+      RUN_DENSETENSOR_RESHAPE_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during dense tensor reshape test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -98,6 +98,7 @@ DenseTest::DenseTest()
    testColumn();
    testColumns();
    testBand();
+   testVectorization();
 }
 //*************************************************************************************************
 
@@ -5526,6 +5527,123 @@ void DenseTest::testBand()
 //
 
 
+//*************************************************************************************************
+/*!\brief Test of the SIMD assignment kernels of the DilatedSubmatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the vectorized assign(), addAssign(), subAssign() and
+// schurAssign() kernels of row-major and column-major dilatedsubmatrices. Both a dilation of 1,
+// which degenerates to contiguous loads and stores, and larger dilations are tested with sizes
+// that are not a multiple of the SIMD width. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void DenseTest::testVectorization()
+{
+   using blaze::dilatedsubmatrix;
+
+   const size_t rowoffsets     [] = {  3UL,  2UL };
+   const size_t columnoffsets  [] = {  5UL,  1UL };
+   const size_t ms             [] = { 13UL,  9UL };
+   const size_t ns             [] = { 37UL, 19UL };
+   const size_t rowdilations   [] = {  1UL,  2UL };
+   const size_t columndilations[] = {  1UL,  3UL };
+
+   for( size_t t=0UL; t<2UL; ++t )
+   {
+      const size_t row           ( rowoffsets[t] );
+      const size_t column        ( columnoffsets[t] );
+      const size_t m             ( ms[t] );
+      const size_t n             ( ns[t] );
+      const size_t rowdilation   ( rowdilations[t] );
+      const size_t columndilation( columndilations[t] );
+
+      auto row_indices    = generate_indices( row, m, rowdilation );
+      auto column_indices = generate_indices( column, n, columndilation );
+
+
+      //=====================================================================================
+      // Row-major dilatedsubmatrix tests
+      //=====================================================================================
+
+      {
+         test_ = "Row-major dilatedsubmatrix vectorized assignment kernels";
+
+         initialize();
+
+         MT mat( m, n );
+         randomize( mat, int(randmin), int(randmax) );
+
+         RCMT sm1 = blaze::rows( blaze::columns( mat1_, column_indices.data(),
+                                    column_indices.size() ),
+            row_indices.data(), row_indices.size() );
+         DSMT sm2 = dilatedsubmatrix( mat2_, row, column, m, n, rowdilation, columndilation );
+
+         sm1 = mat * 3;
+         sm2 = mat * 3;
+         sm1 += mat;
+         sm2 += mat;
+         sm1 -= mat * 2;
+         sm2 -= mat * 2;
+         sm1 %= mat;
+         sm2 %= mat;
+
+         if( sm1 != sm2 || mat1_ != mat2_ ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assignment failed\n"
+                << " Details:\n"
+                << "   Dilation: " << rowdilation << "x" << columndilation << "\n"
+                << "   Result:\n" << sm2 << "\n"
+                << "   Expected result:\n" << sm1 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+
+      //=====================================================================================
+      // Column-major dilatedsubmatrix tests
+      //=====================================================================================
+
+      {
+         test_ = "Column-major dilatedsubmatrix vectorized assignment kernels";
+
+         initialize();
+
+         OMT mat( m, n );
+         randomize( mat, int(randmin), int(randmax) );
+
+         OCRMT sm1 = blaze::columns(
+            blaze::rows( tmat1_, row_indices.data(), row_indices.size() ),
+            column_indices.data(), column_indices.size() );
+         ODSMT sm2 = dilatedsubmatrix( tmat2_, row, column, m, n, rowdilation, columndilation );
+
+         sm1 = mat * 3;
+         sm2 = mat * 3;
+         sm1 += mat;
+         sm2 += mat;
+         sm1 -= mat * 2;
+         sm2 -= mat * 2;
+         sm1 %= mat;
+         sm2 %= mat;
+
+         if( sm1 != sm2 || tmat1_ != tmat2_ ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assignment failed\n"
+                << " Details:\n"
+                << "   Dilation: " << rowdilation << "x" << columndilation << "\n"
+                << "   Result:\n" << sm2 << "\n"
+                << "   Expected result:\n" << sm1 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //=================================================================================================
 //
 //  UTILITY FUNCTIONS
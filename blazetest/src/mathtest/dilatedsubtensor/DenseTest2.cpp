@@ -96,6 +96,7 @@ DenseTest::DenseTest()
    testPageslice();
    testRowslice();
    testColumnslice();
+   testVectorization();
    //testPageslices();
    //testRowslices();
    //testColumnslices();
@@ -2214,6 +2215,84 @@ void DenseTest::testColumnslice()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the SIMD assignment kernels of the DilatedSubtensor class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the vectorized assign(), addAssign(), subAssign() and
+// schurAssign() kernels of dilatedsubtensors. Both a dilation of 1, which degenerates to
+// contiguous loads and stores, and larger dilations are tested with a number of columns that
+// is not a multiple of the SIMD width. The results are compared to the element-wise evaluation
+// on the underlying tensor. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void DenseTest::testVectorization()
+{
+   using blaze::dilatedsubtensor;
+
+   const size_t pageoffsets    [] = {  1UL,  2UL };
+   const size_t rowoffsets     [] = {  3UL,  1UL };
+   const size_t columnoffsets  [] = {  5UL,  2UL };
+   const size_t os             [] = {  3UL,  3UL };
+   const size_t ms             [] = {  5UL,  7UL };
+   const size_t ns             [] = { 37UL, 19UL };
+   const size_t pagedilations  [] = {  1UL,  2UL };
+   const size_t rowdilations   [] = {  1UL,  3UL };
+   const size_t columndilations[] = {  1UL,  3UL };
+
+   for( size_t t=0UL; t<2UL; ++t )
+   {
+      test_ = "Row-major dilatedsubtensor vectorized assignment kernels";
+
+      initialize();
+
+      const size_t page          ( pageoffsets[t] );
+      const size_t row           ( rowoffsets[t] );
+      const size_t column        ( columnoffsets[t] );
+      const size_t o             ( os[t] );
+      const size_t m             ( ms[t] );
+      const size_t n             ( ns[t] );
+      const size_t pagedilation  ( pagedilations[t] );
+      const size_t rowdilation   ( rowdilations[t] );
+      const size_t columndilation( columndilations[t] );
+
+      TT tens( o, m, n );
+      randomize( tens, int(randmin), int(randmax) );
+
+      DSTT st = dilatedsubtensor( tens2_, page, row, column, o, m, n,
+                                  pagedilation, rowdilation, columndilation );
+
+      st = tens * 3;
+      st += tens;
+      st -= tens * 2;
+      st %= tens;
+
+      for( size_t k=0UL; k<o; ++k ) {
+         for( size_t i=0UL; i<m; ++i ) {
+            for( size_t j=0UL; j<n; ++j ) {
+               int& value( tens1_( page+k*pagedilation, row+i*rowdilation, column+j*columndilation ) );
+               value = ( tens(k,i,j)*3 + tens(k,i,j) - tens(k,i,j)*2 ) * tens(k,i,j);
+            }
+         }
+      }
+
+      if( tens1_ != tens2_ ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Dilation: " << pagedilation << "x" << rowdilation << "x" << columndilation << "\n"
+             << "   Result:\n" << st << "\n"
+             << "   Expected result:\n" << ( tens * 2 ) % tens << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
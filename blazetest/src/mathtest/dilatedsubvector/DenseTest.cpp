@@ -95,6 +95,7 @@ DenseTest::DenseTest()
    testIsSame();
    testDilatedSubvector();
    testElements();
+   testVectorization();
 }
 //*************************************************************************************************
 
@@ -3184,6 +3185,93 @@ void DenseTest::testElements()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the SIMD evaluation of the DilatedSubvector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the vectorized assignment kernels and of the vectorized
+// evaluation of expressions involving dilatedsubvectors. Both a dilation of 1, which degenerates
+// to contiguous loads and stores, and a larger dilation are tested with sizes that are not a
+// multiple of the SIMD width. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void DenseTest::testVectorization()
+{
+   using blaze::dilatedsubvector;
+
+   const size_t offsets  [] = { 3UL, 5UL };
+   const size_t sizes    [] = { 37UL, 19UL };
+   const size_t dilations[] = { 1UL, 3UL };
+
+   for( size_t n=0UL; n<2UL; ++n )
+   {
+      const size_t offset  ( offsets[n] );
+      const size_t size    ( sizes[n] );
+      const size_t dilation( dilations[n] );
+
+      auto indices = generate_indices( offset, size, dilation );
+
+      {
+         test_ = "DilatedSubvector vectorized expression evaluation";
+
+         initialize();
+
+         ASVT sv1 = blaze::elements( vec1_, indices.data(), indices.size() );
+         USVT sv2 = dilatedsubvector( vec2_, offset, size, dilation );
+
+         const VT res1( sv1 + sv1 * 2 );
+         const VT res2( sv2 + sv2 * 2 );
+
+         if( res1 != res2 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Evaluation failed\n"
+                << " Details:\n"
+                << "   Dilation: " << dilation << "\n"
+                << "   Result:\n" << res2 << "\n"
+                << "   Expected result:\n" << res1 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         test_ = "DilatedSubvector vectorized assignment kernels";
+
+         initialize();
+
+         VT vec( size );
+         randomize( vec, int(randmin), int(randmax) );
+
+         ASVT sv1 = blaze::elements( vec1_, indices.data(), indices.size() );
+         USVT sv2 = dilatedsubvector( vec2_, offset, size, dilation );
+
+         sv1 = vec * 3;
+         sv2 = vec * 3;
+         sv1 += vec;
+         sv2 += vec;
+         sv1 -= vec * 2;
+         sv2 -= vec * 2;
+         sv1 *= vec;
+         sv2 *= vec;
+
+         if( sv1 != sv2 || vec1_ != vec2_ ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assignment failed\n"
+                << " Details:\n"
+                << "   Dilation: " << dilation << "\n"
+                << "   Result:\n" << sv2 << "\n"
+                << "   Expected result:\n" << sv1 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
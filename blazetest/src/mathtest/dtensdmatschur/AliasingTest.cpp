@@ -110,6 +110,40 @@ void AliasingTest::testDTensDMatSchur()
       checkResult( dC2x3x3_, result_ );
    }
 
+   // In-place assignment to left-hand side operand with a column-major matrix
+   {
+      test_ = "DTensDMatSchur - In-place assignment with a column-major matrix";
+
+      initialize();
+
+      for( size_t k=0UL; k<dA2x3x4_.pages(); ++k )
+         for( size_t i=0UL; i<dA2x3x4_.rows(); ++i )
+            for( size_t j=0UL; j<dA2x3x4_.columns(); ++j )
+               res_(k,i,j) = dA2x3x4_(k,i,j) * dB3x4_(i,j);
+
+      dA2x3x4_ = dA2x3x4_ % dB3x4_;
+
+      checkResult( dA2x3x4_, res_ );
+   }
+
+   // In-place assignment to left-hand side operand with a matrix expression
+   {
+      test_ = "DTensDMatSchur - In-place assignment with a matrix expression";
+
+      initialize();
+
+      const DMat M( dA3x3_ * dA3x3_ );
+
+      for( size_t k=0UL; k<dC2x3x3_.pages(); ++k )
+         for( size_t i=0UL; i<dC2x3x3_.rows(); ++i )
+            for( size_t j=0UL; j<dC2x3x3_.columns(); ++j )
+               result_(k,i,j) = dC2x3x3_(k,i,j) * M(i,j);
+
+      dC2x3x3_ = dC2x3x3_ % ( dA3x3_ * dA3x3_ );
+
+      checkResult( dC2x3x3_, result_ );
+   }
+
    // Assignment to first operand of left-hand side compound
     {
        test_ = "DTensDMatSchur - Assignment to first operand of left-hand side compound";
@@ -0,0 +1,340 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dtensdtensmult/BatchedTest.cpp
+//  \brief Source file for the page-batched dense tensor/dense tensor multiplication test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//  Copyright (C) 2019 Bita Hasheminezhad - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other tenserials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze_tensor/math/PageSlice.h>
+#include <blaze_tensor/math/Subtensor.h>
+#include <blazetest/mathtest/dtensdtensmult/BatchedTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dtensdtensmult {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the page-batched multiplication test class.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+BatchedTest::BatchedTest()
+{
+   testDTensDTensMult(  1UL,  1UL,   1UL,   1UL );
+   testDTensDTensMult(  3UL,  2UL,   5UL,   7UL );
+   testDTensDTensMult(  2UL,  5UL,   3UL,  17UL );
+   testDTensDTensMult(  4UL,  7UL,   9UL,  33UL );
+   testDTensDTensMult( 16UL,  8UL,   8UL,   8UL );
+   testDTensDTensMult(  3UL, 64UL,  64UL,  64UL );
+   testDTensDTensMult(  2UL, 21UL, 130UL, 300UL );
+
+   testSubtensorMult(  1UL,  3UL,   4UL,   5UL );
+   testSubtensorMult(  3UL,  7UL,   9UL,  33UL );
+   testSubtensorMult(  4UL, 64UL,  64UL,  64UL );
+   testSubtensorMult(  2UL, 21UL, 130UL, 300UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the page-batched dense tensor/dense tensor multiplication.
+//
+// \param o The number of pages of all involved tensors.
+// \param m The number of rows of the left-hand side tensor.
+// \param k The number of columns of the left-hand side tensor.
+// \param n The number of columns of the right-hand side tensor.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment, the addition assignment and the subtraction assignment
+// of the multiplication of an \a o x \a m x \a k tensor and an \a o x \a k x \a n tensor. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void BatchedTest::testDTensDTensMult( size_t o, size_t m, size_t k, size_t n )
+{
+   std::ostringstream oss;
+   oss << o << "x" << m << "x" << k << " * " << o << "x" << k << "x" << n;
+
+   DTens A( o, m, k );
+   DTens B( o, k, n );
+   DTens C( o, m, n );
+
+   initialize( A, 1 );
+   initialize( B, 2 );
+
+   {
+      test_ = "DTensDTensMult - Assignment (" + oss.str() + ")";
+
+      initialize( C, 3 );
+      const DTens initial( C );
+
+      C = A * B;
+
+      checkResult( C, A, B, initial, 0 );
+   }
+
+   {
+      test_ = "DTensDTensMult - Addition assignment (" + oss.str() + ")";
+
+      initialize( C, 3 );
+      const DTens initial( C );
+
+      C += A * B;
+
+      checkResult( C, A, B, initial, 1 );
+   }
+
+   {
+      test_ = "DTensDTensMult - Subtraction assignment (" + oss.str() + ")";
+
+      initialize( C, 3 );
+      const DTens initial( C );
+
+      C -= A * B;
+
+      checkResult( C, A, B, initial, -1 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the page-batched multiplication of subtensors.
+//
+// \param o The number of pages of all involved subtensors.
+// \param m The number of rows of the left-hand side subtensor.
+// \param k The number of columns of the left-hand side subtensor.
+// \param n The number of columns of the right-hand side subtensor.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment, the addition assignment and the subtraction assignment
+// of the multiplication of an \a o x \a m x \a k subtensor and an \a o x \a k x \a n subtensor
+// to an \a o x \a m x \a n subtensor. All subtensors are interior parts of larger tensors with
+// BLAS-compatible element type, such that consecutive pages of the views are further apart
+// than \c rows()*spacing() of the view. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void BatchedTest::testSubtensorMult( size_t o, size_t m, size_t k, size_t n )
+{
+   std::ostringstream oss;
+   oss << "subtensor " << o << "x" << m << "x" << k << " * " << o << "x" << k << "x" << n;
+
+   DDTens A( o+2UL, m+3UL, k+5UL );
+   DDTens B( o+2UL, k+3UL, n+5UL );
+   DDTens C( o+2UL, m+3UL, n+5UL );
+
+   initialize( A, 1 );
+   initialize( B, 2 );
+
+   auto sA( blaze::subtensor( A, 1UL, 2UL, 3UL, o, m, k ) );
+   auto sB( blaze::subtensor( B, 1UL, 1UL, 4UL, o, k, n ) );
+   auto sC( blaze::subtensor( C, 1UL, 3UL, 2UL, o, m, n ) );
+
+   const DDTens a( sA );
+   const DDTens b( sB );
+
+   {
+      test_ = "DTensDTensMult - Assignment to subtensor (" + oss.str() + ")";
+
+      initialize( C, 3 );
+      const DDTens initial( sC );
+
+      sC = a * b;
+
+      checkResult( DDTens( sC ), a, b, initial, 0 );
+   }
+
+   {
+      test_ = "DTensDTensMult - Assignment of subtensors (" + oss.str() + ")";
+
+      initialize( C, 3 );
+      const DDTens initial( sC );
+
+      sC = sA * sB;
+
+      checkResult( DDTens( sC ), a, b, initial, 0 );
+   }
+
+   {
+      test_ = "DTensDTensMult - Addition assignment of subtensors (" + oss.str() + ")";
+
+      initialize( C, 3 );
+      const DDTens initial( sC );
+
+      sC += sA * sB;
+
+      checkResult( DDTens( sC ), a, b, initial, 1 );
+   }
+
+   {
+      test_ = "DTensDTensMult - Subtraction assignment of subtensors (" + oss.str() + ")";
+
+      initialize( C, 3 );
+      const DDTens initial( sC );
+
+      sC -= sA * sB;
+
+      checkResult( DDTens( sC ), a, b, initial, -1 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the computed result against page-wise dense matrix multiplications.
+//
+// \param computedResult The computed result.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param initial The value of the target tensor before the operation.
+// \param sign 0 for an assignment, 1 for an addition and -1 for a subtraction assignment.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename TT >  // Type of the dense tensors
+void BatchedTest::checkResult( const TT& computedResult, const TT& A, const TT& B,
+                               const TT& initial, int sign )
+{
+   using MT = blaze::DynamicMatrix< blaze::ElementType_t<TT> >;
+
+   for( size_t page=0UL; page<A.pages(); ++page )
+   {
+      MT expected( blaze::pageslice( A, page ) * blaze::pageslice( B, page ) );
+
+      if( sign > 0 )
+         expected = blaze::pageslice( initial, page ) + expected;
+      else if( sign < 0 )
+         expected = blaze::pageslice( initial, page ) - expected;
+
+      if( blaze::pageslice( computedResult, page ) != expected ) {
+         std::ostringstream oss;
+         oss << " Test : " << test_ << "\n"
+             << " Error: Incorrect result detected in page " << page << "\n"
+             << " Details:\n"
+             << "   Computed result:\n" << blaze::pageslice( computedResult, page ) << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initializing the given tensor with small, deterministic values.
+//
+// \param tensor The tensor to be initialized.
+// \param offset The offset of the generated values.
+// \return void
+*/
+template< typename TT >  // Type of the dense tensor
+void BatchedTest::initialize( TT& tensor, int offset )
+{
+   for( size_t k=0UL; k<tensor.pages(); ++k ) {
+      for( size_t i=0UL; i<tensor.rows(); ++i ) {
+         for( size_t j=0UL; j<tensor.columns(); ++j ) {
+            tensor(k,i,j) = static_cast<int>( ( offset + 3*k + 5*i + 7*j ) % 11 ) - 5;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace dtensdtensmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running page-batched multiplication test..." << std::endl;
+
+   try
+   {
+      RUN_DTENSDTENSMULT_BATCHED_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during page-batched multiplication test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
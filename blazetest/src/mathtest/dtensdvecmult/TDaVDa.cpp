@@ -0,0 +1,104 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dtensdvecmult/TDaVDa.cpp
+//  \brief Source file for the TDaVDa dense tensor/dense vector multiplication math test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//  Copyright (C) 2019 Bita Hasheminezhad - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/DynamicVector.h>
+#include <blazetest/mathtest/creator/DynamicTensor.h>
+#include <blazetest/mathtest/dtensdvecmult/OperationTest.h>
+#include <blazetest/system/MathTest.h>
+
+#include <blaze_tensor/math/dense/DynamicMatrix.h>
+#include <blaze_tensor/math/dense/DynamicVector.h>
+#include <blaze_tensor/math/StaticTensor.h>
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+#if defined(BLAZE_USE_HPX_THREADS)
+#include <hpx/hpx_main.hpp>
+#endif
+
+//*************************************************************************************************
+int main()
+
+{
+   std::cout << "   Running 'TDaVDa'..." << std::endl;
+
+   using blazetest::mathtest::TypeA;
+
+   try
+   {
+      // Tensor type definitions
+      using TDa = blaze::DynamicTensor<TypeA>;
+      using VDa = blaze::DynamicVector<TypeA>;
+
+      // Creator type definitions
+      using CTDa = blazetest::Creator<TDa>;
+      using CVDa = blazetest::Creator<VDa>;
+
+      // Running the tests
+      for (size_t k = 0UL; k <= 5UL; ++k) {
+         for (size_t i = 0UL; i <= 6UL; ++i) {
+            for (size_t j = 0UL; j <= 9UL; ++j) {
+               RUN_DTENSDVECMULT_OPERATION_TEST( CTDa( k, i, j ), CVDa( j ) );
+            }
+         }
+      }
+
+      // Running tests with large tensors
+      RUN_DTENSDVECMULT_OPERATION_TEST( CTDa(  3UL, 17UL,  67UL ), CVDa(  67UL ) );
+      RUN_DTENSDVECMULT_OPERATION_TEST( CTDa(  5UL, 31UL, 127UL ), CVDa( 127UL ) );
+      RUN_DTENSDVECMULT_OPERATION_TEST( CTDa( 13UL,  7UL, 128UL ), CVDa( 128UL ) );
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during dense tensor/dense vector multiplication:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -51,6 +51,8 @@
 #include <blazetest/mathtest/RandomMinimum.h>
 
 #include <blaze_tensor/math/CustomTensor.h>
+#include <blaze_tensor/math/Subtensor.h>
+#include <blaze_tensor/util/ArenaAllocator.h>
 #include <blazetest/mathtest/dynamictensor/ClassTest.h>
 
 namespace blazetest {
@@ -89,6 +91,7 @@ ClassTest::ClassTest()
    testTranspose();
    testCTranspose();
    testIsDefault();
+   testAllocator();
 }
 //*************************************************************************************************
 
@@ -2040,6 +2043,53 @@ void ClassTest::testResize()
       checkPages   ( mat, 0UL );
       checkNonZeros( mat, 0UL );
    }
+
+   {
+      test_ = "Row-major DynamicTensor::resize() within the capacity";
+
+      blaze::DynamicTensor<int> mat( 4UL, 2UL, 3UL );
+
+      for( size_t k=0UL; k<4UL; ++k )
+         for( size_t i=0UL; i<2UL; ++i )
+            for( size_t j=0UL; j<3UL; ++j )
+               mat(k,i,j) = int( 100UL*k + 10UL*i + j );
+
+      const int* data( mat.data() );
+
+      // Shrinking the number of pages and rows and preserving the elements
+      mat.resize( 3UL, 1UL, 3UL, true );
+
+      checkRows    ( mat, 1UL );
+      checkColumns ( mat, 3UL );
+      checkPages   ( mat, 3UL );
+
+      // Growing the number of pages and rows and preserving the elements
+      mat.resize( 4UL, 2UL, 3UL, true );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkPages   ( mat, 4UL );
+
+      if( mat.data() != data ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing within the capacity reallocated the tensor\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t k=0UL; k<3UL; ++k ) {
+         for( size_t j=0UL; j<3UL; ++j ) {
+            if( mat(k,0UL,j) != int( 100UL*k + j ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Resizing the tensor failed\n"
+                   << " Details:\n"
+                   << "   Result:\n" << mat << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
 }
 //*************************************************************************************************
 
@@ -2911,6 +2961,58 @@ void ClassTest::testTranspose()
             }
          }
       }
+
+      {
+         test_ = "Row-major non-cubic transpose (stress test)";
+
+         const size_t o( blaze::rand<size_t>( 1UL, 80UL ) );
+         const size_t m( blaze::rand<size_t>( 1UL, 80UL ) );
+         const size_t n( blaze::rand<size_t>( 1UL, 80UL ) );
+
+         blaze::DynamicTensor<int> mat1( o, m, n, 0 );
+         randomize( mat1 );
+
+         const size_t dims[3] = { o, m, n };
+         const size_t indices[6][3] = {
+             {0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+
+         for( const auto& idx : indices )
+         {
+            blaze::DynamicTensor<int> mat2( trans( mat1, idx, 3UL ) );
+            blaze::DynamicTensor<int> mat3( dims[idx[0]], dims[idx[1]], dims[idx[2]], 0 );
+            subtensor( mat3, 0UL, 0UL, 0UL, mat3.pages(), mat3.rows(), mat3.columns() ) =
+               subtensor( trans( mat1, idx, 3UL ), 0UL, 0UL, 0UL, mat3.pages(), mat3.rows(), mat3.columns() );
+            blaze::DynamicTensor<int> mat4( mat1 );
+            transpose( mat4, idx, 3UL );
+
+            checkPages  ( mat4, dims[idx[0]] );
+            checkRows   ( mat4, dims[idx[1]] );
+            checkColumns( mat4, dims[idx[2]] );
+
+            for( size_t k=0UL; k<mat2.pages(); ++k ) {
+               for( size_t i=0UL; i<mat2.rows(); ++i ) {
+                  for( size_t j=0UL; j<mat2.columns(); ++j ) {
+                     size_t pos[3];
+                     pos[idx[0]] = k;
+                     pos[idx[1]] = i;
+                     pos[idx[2]] = j;
+
+                     if( mat2(k,i,j) != mat1(pos[0],pos[1],pos[2]) ||
+                         mat3(k,i,j) != mat1(pos[0],pos[1],pos[2]) ||
+                         mat4(k,i,j) != mat1(pos[0],pos[1],pos[2]) ) {
+                        std::ostringstream oss;
+                        oss << " Test: " << test_ << "\n"
+                            << " Error: Transpose operation failed\n"
+                            << " Details:\n"
+                            << "   Permutation: (" << idx[0] << "," << idx[1] << "," << idx[2] << ")\n"
+                            << "   Element (" << k << "," << i << "," << j << ")\n";
+                        throw std::runtime_error( oss.str() );
+                     }
+                  }
+               }
+            }
+         }
+      }
    }
 }
 //*************************************************************************************************
@@ -3319,6 +3421,134 @@ void ClassTest::testIsDefault()
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Test of a DynamicTensor with a custom allocator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the DynamicTensor class template in combination with the
+// blaze::ArenaAllocator. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testAllocator()
+{
+   //=====================================================================================
+   // Row-major tensor tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major DynamicTensor with ArenaAllocator";
+
+      blaze::ArenaScope scope;
+
+      const size_t live( blaze::Arena::local().live() );
+
+      blaze::DynamicTensor<int, blaze::ArenaAllocator<int> > tens( 2UL, 2UL, 3UL, 0 );
+      tens(0,0,0) = 1;
+      tens(0,1,2) = 2;
+      tens(1,1,1) = 3;
+
+      checkPages   ( tens, 2UL );
+      checkRows    ( tens, 2UL );
+      checkColumns ( tens, 3UL );
+      checkNonZeros( tens, 3UL );
+
+      if( !blaze::Arena::local().owns( tens.data() ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Tensor storage not allocated from the arena\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      tens.resize( 3UL, 4UL, 5UL, true );
+
+      checkPages   ( tens, 3UL );
+      checkRows    ( tens, 4UL );
+      checkColumns ( tens, 5UL );
+
+      if( blaze::Arena::local().live() != live+1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of live arena blocks\n"
+             << " Details:\n"
+             << "   Number of live blocks  : " << blaze::Arena::local().live() - live << "\n"
+             << "   Expected number        : 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( tens(0,0,0) != 1 || tens(0,1,2) != 2 || tens(1,1,1) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the tensor failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const blaze::DynamicTensor<int> copy( tens );
+
+      if( copy != tens ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Copying the tensor failed\n"
+             << " Details:\n"
+             << "   Result:\n" << copy << "\n"
+             << "   Expected result:\n" << tens << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major DynamicTensor with ArenaAllocator outside of an ArenaScope";
+
+      using TensorType = blaze::DynamicTensor<int, blaze::ArenaAllocator<int> >;
+
+      TensorType heap( 2UL, 3UL, 4UL, 1 );
+
+      if( blaze::Arena::local().owns( heap.data() ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Tensor storage allocated from an inactive arena\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      {
+         blaze::ArenaScope scope;
+
+         TensorType tmp( 2UL, 3UL, 4UL, 2 );
+         tmp += heap;
+
+         heap = TensorType();  // Releasing heap memory within the scope
+         heap.resize( 1UL, 1UL, 1UL, false );
+         heap = tmp;           // Re-allocating within the scope hands out arena memory
+         heap = TensorType( 2UL, 3UL, 4UL, 3 );
+
+         if( heap.pages() != 2UL || heap(1,2,3) != 3 || tmp(1,2,3) != 3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Mixing arena and heap memory failed\n"
+                << " Details:\n"
+                << "   Result:\n" << heap << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         heap = TensorType();
+      }
+
+      if( blaze::Arena::local().live() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Arena memory leaked\n"
+             << " Details:\n"
+             << "   Number of live blocks: " << blaze::Arena::local().live() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 } // namespace dynamictensor
 
 } // namespace mathtest
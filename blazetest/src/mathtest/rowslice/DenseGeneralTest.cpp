@@ -80,6 +80,7 @@ DenseGeneralTest::DenseGeneralTest()
    testSubAssign();
    testMultAssign();
    testSchurAssign();
+   testVectorizedAssign();
    testScaling();
    testFunctionCall();
    testAt();
@@ -1917,6 +1918,116 @@ void DenseGeneralTest::testSchurAssign()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the RowSlice assignment kernels with large operands.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the (vectorized) assignment, addition assignment,
+// subtraction assignment, and Schur product assignment kernels of the RowSlice specialization
+// with row-major and column-major matrices whose number of rows is no multiple of the SIMD
+// width. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseGeneralTest::testVectorizedAssign()
+{
+   const size_t M( 37UL );
+   const size_t N( 3UL );
+
+   MT tens( N, 2UL, M, 1 );
+
+   blaze::DynamicMatrix<int,blaze::columnMajor> cmat( M, N );
+   blaze::DynamicMatrix<int,blaze::rowMajor>    rmat( M, N );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         cmat(i,j) = static_cast<int>( 3UL*i + j ) % 7 - 3;
+         rmat(i,j) = static_cast<int>( i + 5UL*j ) % 5 - 2;
+      }
+   }
+
+   RT rs = blaze::rowslice( tens, 1UL );
+
+   {
+      test_ = "RowSlice assignment of a column-major matrix";
+
+      rs = cmat;
+
+      if( rs != cmat ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << rs << "\n"
+             << "   Expected result:\n" << cmat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "RowSlice addition assignment of a row-major matrix";
+
+      rs += rmat;
+
+      if( rs != cmat + rmat ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << rs << "\n"
+             << "   Expected result:\n" << ( cmat + rmat ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "RowSlice subtraction assignment of a column-major matrix";
+
+      rs -= cmat;
+
+      if( rs != rmat ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << rs << "\n"
+             << "   Expected result:\n" << rmat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "RowSlice Schur product assignment of a column-major matrix";
+
+      rs %= cmat;
+
+      if( rs != ( rmat % cmat ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Schur product assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << rs << "\n"
+             << "   Expected result:\n" << ( rmat % cmat ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t k=0UL; k<N; ++k ) {
+         for( size_t j=0UL; j<M; ++j ) {
+            if( tens(k,0UL,j) != 1 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Unrelated tensor row modified\n"
+                   << " Details:\n"
+                   << "   Result:\n" << tens << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of all RowSlice (self-)scaling operations.
 //